@@ -0,0 +1,219 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara_core_array_benchmark.cpp
+ *  \brief      Microbenchmarks of ara::core::Array against std::array.
+ *
+ *  \details    Each operation is timed on both containers for every element type and size below:
+ *              - construct:   value-initialization ("{}")
+ *              - at:          checked read of every element
+ *              - index:       unchecked read of every element (operator[])
+ *              - fill:        fill() with one value
+ *              - swap:        swap() of two arrays
+ *              - equal:       operator== of two equal arrays (full scan)
+ *              - less:        operator< of two equal arrays (full scan)
+ *
+ *              Element types: std::uint8_t, std::uint32_t, double and Sample (a non-trivially comparable struct).
+ *              Sizes: 16, 256 and 4096 elements.
+ *********************************************************************************************************************/
+
+#include "benchmark_harness.h"
+#include "ara/core/array.h"  // ara::core::Array
+
+#include <array>             // For std::array
+#include <cstddef>           // For std::size_t
+#include <cstdint>           // For std::uint8_t, std::uint32_t, std::uint64_t
+#include <string>            // For std::string, std::to_string
+#include <type_traits>       // For std::is_arithmetic_v
+
+/**********************************************************************************************************************
+ *  ELEMENT TYPES
+ *********************************************************************************************************************/
+/*!
+ * \brief  Aggregate element with user-defined (noexcept) comparisons.
+ */
+struct Sample {
+    std::uint32_t id;
+    float         value;
+
+    auto operator==(const Sample& other) const noexcept -> bool
+    {
+        return (id == other.id) && !(value < other.value) && !(other.value < value);
+    }
+
+    auto operator<(const Sample& other) const noexcept -> bool
+    {
+        return (id < other.id) || ((id == other.id) && (value < other.value));
+    }
+};
+
+template <typename T>
+struct TypeName;
+
+template <>
+struct TypeName<std::uint8_t> {
+    static constexpr const char* kValue{"uint8_t"};
+};
+
+template <>
+struct TypeName<std::uint32_t> {
+    static constexpr const char* kValue{"uint32_t"};
+};
+
+template <>
+struct TypeName<double> {
+    static constexpr const char* kValue{"double"};
+};
+
+template <>
+struct TypeName<Sample> {
+    static constexpr const char* kValue{"Sample"};
+};
+
+/*!
+ * \brief  Deterministic element \c index of the benchmark data.
+ */
+template <typename T>
+static auto MakeElement(std::size_t index) -> T
+{
+    if constexpr (std::is_arithmetic_v<T>) {
+        return static_cast<T>(index % 100U);
+    } else {
+        return T{static_cast<std::uint32_t>(index), static_cast<float>(index % 100U)};
+    }
+}
+
+/*!
+ * \brief  Integer summarizing an element (accumulated by the read benchmarks).
+ */
+template <typename T>
+static auto Key(const T& element) -> std::uint64_t
+{
+    if constexpr (std::is_arithmetic_v<T>) {
+        return static_cast<std::uint64_t>(element);
+    } else {
+        return element.id;
+    }
+}
+
+/**********************************************************************************************************************
+ *  BENCHMARKS
+ *********************************************************************************************************************/
+/*!
+ * \brief  Registers every operation of \c Container (an array of N elements of T) under \c subject.
+ */
+template <typename Container, typename T, std::size_t N>
+static auto RunContainer(benchmark::Runner& runner, const char* subject) -> void
+{
+    std::string const suffix = std::string{"/"} + TypeName<T>::kValue + "/" + std::to_string(N);
+
+    // Static storage: the 4096-element arrays do not belong on the stack of every benchmark body
+    static Container first{};
+    static Container second{};
+    for (std::size_t index = 0U; index < N; ++index) {
+        first[index]  = MakeElement<T>(index);
+        second[index] = MakeElement<T>(index);
+    }
+    T const value = MakeElement<T>(42U);
+
+    runner.Run("construct" + suffix, subject, []() {
+        Container local{};
+        benchmark::DoNotOptimize(local);
+    });
+
+    runner.Run("at" + suffix, subject, []() {
+        benchmark::DoNotOptimize(first);
+        std::uint64_t sum = 0U;
+        for (std::size_t index = 0U; index < N; ++index) {
+            sum += Key(first.at(index));
+        }
+        benchmark::DoNotOptimize(sum);
+    });
+
+    runner.Run("index" + suffix, subject, []() {
+        benchmark::DoNotOptimize(first);
+        std::uint64_t sum = 0U;
+        for (std::size_t index = 0U; index < N; ++index) {
+            sum += Key(first[index]);
+        }
+        benchmark::DoNotOptimize(sum);
+    });
+
+    runner.Run("fill" + suffix, subject, [&value]() {
+        second.fill(value);
+        benchmark::DoNotOptimize(second);
+    });
+
+    // Restore equal contents for the comparisons (fill() above changed the second array)
+    for (std::size_t index = 0U; index < N; ++index) {
+        second[index] = MakeElement<T>(index);
+    }
+
+    runner.Run("swap" + suffix, subject, []() {
+        first.swap(second);
+        benchmark::DoNotOptimize(first);
+        benchmark::DoNotOptimize(second);
+    });
+
+    runner.Run("equal" + suffix, subject, []() {
+        benchmark::DoNotOptimize(first);
+        benchmark::DoNotOptimize(second);
+        bool result = (first == second);
+        benchmark::DoNotOptimize(result);
+    });
+
+    runner.Run("less" + suffix, subject, []() {
+        benchmark::DoNotOptimize(first);
+        benchmark::DoNotOptimize(second);
+        bool result = (first < second);
+        benchmark::DoNotOptimize(result);
+    });
+}
+
+/*!
+ * \brief  Runs all operations on ara::core::Array and std::array for one element type and size.
+ */
+template <typename T, std::size_t N>
+static auto RunPair(benchmark::Runner& runner) -> void
+{
+    RunContainer<ara::core::Array<T, N>, T, N>(runner, "ara::core::Array");
+    RunContainer<std::array<T, N>, T, N>(runner, "std::array");
+}
+
+/*!
+ * \brief  Runs all sizes for one element type.
+ */
+template <typename T>
+static auto RunType(benchmark::Runner& runner) -> void
+{
+    RunPair<T, 16U>(runner);
+    RunPair<T, 256U>(runner);
+    RunPair<T, 4096U>(runner);
+}
+
+/**********************************************************************************************************************
+ *  MAIN FUNCTION
+ *********************************************************************************************************************/
+int main(int argc, char* argv[])
+{
+    benchmark::Options options;
+    if (!benchmark::ParseOptions(argc, argv, options)) {
+        return 1;
+    }
+
+    std::cerr << "=== ara::core::Array vs std::array (" << benchmark::kPlatform << "/" << benchmark::kArchitecture
+              << ") ===\n";
+    benchmark::Runner runner{"ara_core_array", options};
+    RunType<std::uint8_t>(runner);
+    RunType<std::uint32_t>(runner);
+    RunType<double>(runner);
+    RunType<Sample>(runner);
+
+    return runner.Finish();
+}
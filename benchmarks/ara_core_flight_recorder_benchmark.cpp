@@ -0,0 +1,87 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara_core_flight_recorder_benchmark.cpp
+ *  \brief      Microbenchmarks of ara::core::FlightRecorder::Record() against a clock read and a locked ring.
+ *
+ *  \details    One operation records one event (timestamp, tag, two arguments):
+ *              - steady_clock_now:        std::chrono::steady_clock::now() alone, the cost of a timestamp
+ *              - mutex_ring_record:       steady_clock timestamp into a shared ring guarded by a std::mutex
+ *              - flight_recorder_record:  FlightRecorder::Record(), counter timestamp into the thread's own ring
+ *********************************************************************************************************************/
+
+#include "benchmark_harness.h"
+#include "ara/core/flight_recorder.h"   // ara::core::FlightRecorder
+
+#include <chrono>            // For std::chrono::steady_clock
+#include <cstddef>           // For std::size_t
+#include <cstdint>           // For std::uint64_t
+#include <mutex>             // For std::mutex, std::lock_guard
+
+/*!
+ * \brief  The locked ring of the comparison: same record layout and capacity as a FlightRing.
+ */
+struct MutexRing {
+    struct Record {
+        std::uint64_t timestamp;
+        const char*   tag;
+        std::uint64_t arg0;
+        std::uint64_t arg1;
+    };
+
+    std::mutex    mutex{};
+    std::uint64_t written{0U};
+    Record        records[ara::core::FlightRecorder::kRecordCapacity]{};
+
+    auto Add(const char* tag, std::uint64_t arg0, std::uint64_t arg1) noexcept -> void
+    {
+        auto const now = static_cast<std::uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+        std::lock_guard<std::mutex> const lock{mutex};
+        records[written & (ara::core::FlightRecorder::kRecordCapacity - 1U)] = Record{now, tag, arg0, arg1};
+        ++written;
+    }
+};
+
+/**********************************************************************************************************************
+ *  MAIN FUNCTION
+ *********************************************************************************************************************/
+int main(int argc, char* argv[])
+{
+    benchmark::Options options;
+    if (!benchmark::ParseOptions(argc, argv, options)) {
+        return 1;
+    }
+
+    std::cerr << "=== ara::core::FlightRecorder vs steady_clock / mutex ring (" << benchmark::kPlatform << "/"
+              << benchmark::kArchitecture << ") ===\n";
+
+    static MutexRing ring{};
+    static std::uint64_t value{0U};
+    ara::core::FlightRecorder::Record("warm-up");  // Claims the ring of the benchmark thread
+
+    benchmark::Runner runner{"ara_core_flight_recorder", options};
+    constexpr const char* kSubject = "1 event";
+
+    runner.Run("steady_clock_now", kSubject, []() {
+        auto now = std::chrono::steady_clock::now();
+        benchmark::DoNotOptimize(now);
+    });
+    runner.Run("mutex_ring_record", kSubject, []() {
+        benchmark::DoNotOptimize(value);
+        ring.Add("event", value, value + 1U);
+        ++value;
+    });
+    runner.Run("flight_recorder_record", kSubject, []() {
+        benchmark::DoNotOptimize(value);
+        ara::core::FlightRecorder::Record("event", value, value + 1U);
+        ++value;
+    });
+
+    return runner.Finish();
+}
@@ -0,0 +1,145 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara_core_huge_page_arena_benchmark.cpp
+ *  \brief      Microbenchmarks of ara::core::pmr::HugePageArena against a buffer on 4 KiB pages.
+ *
+ *  \details    A 32 MiB buffer, as a large frame store or lookup table:
+ *              - sweep_base_pages:  4096 loads scattered over the pages of a pre-faulted buffer on base pages
+ *                                   (transparent huge pages disabled for it), one TLB entry per 4 KiB
+ *              - sweep_arena:       the same loads over a HugePageArena, one TLB entry per 2 MiB
+ *              - first_touch:       writing 2 MiB of a freshly mapped buffer, one page fault per 4 KiB page
+ *              - arena_touch:       writing 2 MiB of the pre-faulted arena
+ *              The arena falls back to base pages (advised for transparent huge pages) when no huge page is
+ *              reserved (vm.nr_hugepages); the backing is printed before the results.
+ *********************************************************************************************************************/
+
+#include "benchmark_harness.h"
+#include "ara/core/array.h"             // ara::core::Array
+#include "ara/core/huge_page_arena.h"   // ara::core::pmr::HugePageArena
+
+#include <cstddef>           // For std::size_t
+#include <cstdint>           // For std::uint32_t, std::uint64_t
+#include <sys/mman.h>        // For mmap, munmap, madvise
+
+using ara::core::Array;
+using ara::core::pmr::HugePageArena;
+using ara::core::pmr::HugePageArenaConfig;
+using ara::core::pmr::HugePageErrorCode;
+
+/*!
+ * \brief  Size of the swept buffer.
+ */
+constexpr std::size_t kBufferSize = 32U * 1024U * 1024U;
+
+/*!
+ * \brief  Loads per sweep.
+ */
+constexpr std::size_t kLoads = 4096U;
+
+/*!
+ * \brief  Bytes written by a touch pass (one huge page).
+ */
+constexpr std::size_t kTouchSize = 2U * 1024U * 1024U;
+
+/*!
+ * \brief  Base page size assumed for the access pattern.
+ */
+constexpr std::size_t kPage = 4096U;
+
+/*!
+ * \brief  Sums the bytes at \c offsets of \c base.
+ */
+static auto Sweep(const volatile std::uint8_t* base, const Array<std::uint32_t, kLoads>& offsets) -> std::uint64_t
+{
+    std::uint64_t sum{0U};
+    for (std::uint32_t const offset : offsets) {
+        sum += base[offset];
+    }
+    return sum;
+}
+
+/*!
+ * \brief  Writes one byte per base page of [base, base + kTouchSize).
+ */
+static auto Touch(volatile std::uint8_t* base) -> void
+{
+    for (std::size_t offset = 0U; offset < kTouchSize; offset += kPage) {
+        base[offset] = static_cast<std::uint8_t>(offset);
+    }
+}
+
+/**********************************************************************************************************************
+ *  MAIN FUNCTION
+ *********************************************************************************************************************/
+int main(int argc, char* argv[])
+{
+    benchmark::Options options;
+    if (!benchmark::ParseOptions(argc, argv, options)) {
+        return 1;
+    }
+
+    // The base-page buffer: transparent huge pages off, every page faulted in
+    void* const mapped = ::mmap(nullptr, kBufferSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (mapped == MAP_FAILED) {
+        std::cerr << "Cannot map the base-page buffer\n";
+        return 1;
+    }
+    static_cast<void>(::madvise(mapped, kBufferSize, MADV_NOHUGEPAGE));
+    ara::core::pmr::PrefaultMemory(mapped, kBufferSize);
+    static std::uint8_t* basePages{static_cast<std::uint8_t*>(mapped)};
+
+    HugePageArenaConfig config{};
+    config.capacity = kBufferSize;
+    static HugePageArena arena{config};
+    if (arena.Map() != HugePageErrorCode::Success) {
+        std::cerr << "Cannot map the arena\n";
+        return 1;
+    }
+    static std::uint8_t* arenaBytes{static_cast<std::uint8_t*>(arena.GetData())};
+
+    std::cerr << "=== ara::core::pmr::HugePageArena vs base pages (" << benchmark::kPlatform << "/"
+              << benchmark::kArchitecture << ", arena on " << (arena.IsHugePageBacked() ? "2 MiB" : "base")
+              << " pages) ===\n";
+
+    // One load per page in a scattered order (a multiplicative permutation of the page numbers)
+    static Array<std::uint32_t, kLoads> offsets{};
+    constexpr std::size_t kPages = kBufferSize / kPage;
+    for (std::size_t i = 0U; i < kLoads; ++i) {
+        std::size_t const page = (i * 2654435761U) % kPages;
+        offsets[i] = static_cast<std::uint32_t>((page * kPage) + ((i * 64U) % kPage));
+    }
+
+    benchmark::Runner runner{"ara_core_huge_page_arena", options};
+
+    runner.Run("sweep_base_pages", "4096 loads / 32 MiB", []() {
+        std::uint64_t sum = Sweep(basePages, offsets);
+        benchmark::DoNotOptimize(sum);
+    });
+    runner.Run("sweep_arena", "4096 loads / 32 MiB", []() {
+        std::uint64_t sum = Sweep(arenaBytes, offsets);
+        benchmark::DoNotOptimize(sum);
+    });
+    runner.Run("first_touch", "2 MiB", []() {
+        void* const fresh = ::mmap(nullptr, kTouchSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (fresh != MAP_FAILED) {
+            Touch(static_cast<std::uint8_t*>(fresh));
+            static_cast<void>(::munmap(fresh, kTouchSize));
+        }
+    });
+    runner.Run("arena_touch", "2 MiB", []() {
+        Touch(arenaBytes);
+        benchmark::DoNotOptimize(arenaBytes);
+    });
+
+    arena.Unmap();
+    static_cast<void>(::munmap(mapped, kBufferSize));
+
+    return runner.Finish();
+}
@@ -0,0 +1,119 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara_core_lookup_benchmark.cpp
+ *  \brief      Microbenchmarks of ara::core::FlatMap and ara::core::PerfectHashMap against the standard maps.
+ *
+ *  \details    A dispatch table of 64 sparse 16-bit service IDs; one operation looks up all 64 IDs in a scrambled
+ *              order (every lookup hits) and sums the mapped values:
+ *              - std::map / std::unordered_map:  node-based, allocated and filled at startup
+ *              - FlatMap:                        constexpr, branchless binary search over the sorted keys
+ *              - PerfectHashMap:                 constexpr, two hashes and one key comparison
+ *********************************************************************************************************************/
+
+#include "benchmark_harness.h"
+#include "ara/core/flat_map.h"       // ara::core::FlatMap
+#include "ara/core/perfect_hash.h"   // ara::core::PerfectHashMap
+
+#include <cstddef>           // For std::size_t
+#include <cstdint>           // For std::uint16_t, std::uint32_t
+#include <map>               // For std::map
+#include <unordered_map>     // For std::unordered_map
+#include <utility>           // For std::pair
+
+/*!
+ * \brief  Number of entries.
+ */
+constexpr std::size_t kEntries = 64U;
+
+/*!
+ * \brief  Service ID -> handler index, in a C array as the table builders expect.
+ */
+struct Table {
+    std::pair<std::uint16_t, std::uint32_t> entries[kEntries];
+};
+
+/*!
+ * \brief  Sparse service IDs ((i * 40503) mod 2^16, all distinct), mapped to i.
+ */
+constexpr auto MakeTable() noexcept -> Table
+{
+    Table table{};
+    for (std::uint32_t i = 0U; i < kEntries; ++i) {
+        table.entries[i].first  = static_cast<std::uint16_t>(i * 40503U);
+        table.entries[i].second = i;
+    }
+    return table;
+}
+
+constexpr Table kTable = MakeTable();
+constexpr ara::core::PerfectHashMap<std::uint16_t, std::uint32_t, kEntries> kPerfect{kTable.entries};
+constexpr ara::core::FlatMap<std::uint16_t, std::uint32_t, kEntries> kFlat =
+    ara::core::MakeFlatMap<std::uint16_t, std::uint32_t>(kTable.entries);
+
+/**********************************************************************************************************************
+ *  MAIN FUNCTION
+ *********************************************************************************************************************/
+int main(int argc, char* argv[])
+{
+    benchmark::Options options;
+    if (!benchmark::ParseOptions(argc, argv, options)) {
+        return 1;
+    }
+
+    std::cerr << "=== ara::core lookup tables vs std::map / std::unordered_map (" << benchmark::kPlatform << "/"
+              << benchmark::kArchitecture << ") ===\n";
+
+    static std::map<std::uint16_t, std::uint32_t> ordered{};
+    static std::unordered_map<std::uint16_t, std::uint32_t> unordered{};
+    static std::uint16_t probes[kEntries]{};
+    for (std::size_t i = 0U; i < kEntries; ++i) {
+        ordered.emplace(kTable.entries[i].first, kTable.entries[i].second);
+        unordered.emplace(kTable.entries[i].first, kTable.entries[i].second);
+        probes[i] = kTable.entries[(i * 37U) % kEntries].first;
+    }
+
+    benchmark::Runner runner{"ara_core_lookup", options};
+    constexpr const char* kSubject = "64 service IDs";
+
+    runner.Run("std_map", kSubject, []() {
+        benchmark::DoNotOptimize(probes);
+        std::uint32_t sum = 0U;
+        for (std::uint16_t const id : probes) {
+            sum += ordered.find(id)->second;
+        }
+        benchmark::DoNotOptimize(sum);
+    });
+    runner.Run("std_unordered_map", kSubject, []() {
+        benchmark::DoNotOptimize(probes);
+        std::uint32_t sum = 0U;
+        for (std::uint16_t const id : probes) {
+            sum += unordered.find(id)->second;
+        }
+        benchmark::DoNotOptimize(sum);
+    });
+    runner.Run("flat_map", kSubject, []() {
+        benchmark::DoNotOptimize(probes);
+        std::uint32_t sum = 0U;
+        for (std::uint16_t const id : probes) {
+            sum += *kFlat.Find(id);
+        }
+        benchmark::DoNotOptimize(sum);
+    });
+    runner.Run("perfect_hash_map", kSubject, []() {
+        benchmark::DoNotOptimize(probes);
+        std::uint32_t sum = 0U;
+        for (std::uint16_t const id : probes) {
+            sum += *kPerfect.Find(id);
+        }
+        benchmark::DoNotOptimize(sum);
+    });
+
+    return runner.Finish();
+}
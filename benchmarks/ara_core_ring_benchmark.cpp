@@ -0,0 +1,129 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara_core_ring_benchmark.cpp
+ *  \brief      Microbenchmarks of ara::core::SpscRing and ara::core::MpmcRing against a mutex-protected queue.
+ *
+ *  \details    Uncontended cost of one push followed by one pop (single thread), and of a batch of 16:
+ *              - push_pop:        TryPush + TryPop of one element
+ *              - push_pop_batch:  PushBatch + PopBatch of 16 elements (reported per element)
+ *              The baseline is std::deque guarded by a std::mutex, i.e. one lock per sample.
+ *********************************************************************************************************************/
+
+#include "benchmark_harness.h"
+#include "ara/core/ring.h"   // ara::core::SpscRing, ara::core::MpmcRing
+
+#include <cstddef>           // For std::size_t
+#include <cstdint>           // For std::uint64_t
+#include <deque>             // For std::deque (baseline)
+#include <mutex>             // For std::mutex (baseline)
+
+/**********************************************************************************************************************
+ *  BASELINE
+ *********************************************************************************************************************/
+/*!
+ * \brief  Mutex-protected queue with the ring interface.
+ */
+class MutexQueue final {
+public:
+    auto TryPush(std::uint64_t value) -> bool
+    {
+        std::lock_guard<std::mutex> const lock{mutex_};
+        queue_.push_back(value);
+        return true;
+    }
+
+    auto TryPop(std::uint64_t& out) -> bool
+    {
+        std::lock_guard<std::mutex> const lock{mutex_};
+        if (queue_.empty()) {
+            return false;
+        }
+        out = queue_.front();
+        queue_.pop_front();
+        return true;
+    }
+
+    auto PushBatch(const std::uint64_t* items, std::size_t count) -> std::size_t
+    {
+        std::lock_guard<std::mutex> const lock{mutex_};
+        queue_.insert(queue_.end(), items, items + count);
+        return count;
+    }
+
+    auto PopBatch(std::uint64_t* out, std::size_t maxCount) -> std::size_t
+    {
+        std::lock_guard<std::mutex> const lock{mutex_};
+        std::size_t count = 0U;
+        for (; (count < maxCount) && !queue_.empty(); ++count) {
+            out[count] = queue_.front();
+            queue_.pop_front();
+        }
+        return count;
+    }
+
+private:
+    std::mutex                mutex_{};
+    std::deque<std::uint64_t> queue_{};
+};
+
+/**********************************************************************************************************************
+ *  BENCHMARKS
+ *********************************************************************************************************************/
+/*!
+ * \brief  Registers the benchmarks of \c queue under \c subject.
+ */
+template <typename Queue>
+static auto RunQueue(benchmark::Runner& runner, Queue& queue, const char* subject) -> void
+{
+    runner.Run("push_pop", subject, [&queue]() {
+        std::uint64_t value = 42U;
+        benchmark::DoNotOptimize(value);
+        bool const pushed = queue.TryPush(value);
+        bool const popped = queue.TryPop(value);
+        bool result = pushed && popped;
+        benchmark::DoNotOptimize(result);
+        benchmark::DoNotOptimize(value);
+    });
+
+    constexpr std::size_t kBatch{16U};
+    static std::uint64_t input[kBatch]{};
+    static std::uint64_t output[kBatch]{};
+    runner.Run("push_pop_batch", subject, [&queue]() {
+        benchmark::DoNotOptimize(input);
+        std::size_t count = queue.PushBatch(input, kBatch);
+        count += queue.PopBatch(output, kBatch);
+        benchmark::DoNotOptimize(count);
+        benchmark::DoNotOptimize(output);
+    });
+}
+
+/**********************************************************************************************************************
+ *  MAIN FUNCTION
+ *********************************************************************************************************************/
+int main(int argc, char* argv[])
+{
+    benchmark::Options options;
+    if (!benchmark::ParseOptions(argc, argv, options)) {
+        return 1;
+    }
+
+    std::cerr << "=== ara::core rings vs mutex queue (" << benchmark::kPlatform << "/" << benchmark::kArchitecture
+              << ") ===\n";
+    static ara::core::SpscRing<std::uint64_t, 1024U> spsc;
+    static ara::core::MpmcRing<std::uint64_t, 1024U> mpmc;
+    static MutexQueue mutexQueue;
+
+    benchmark::Runner runner{"ara_core_ring", options};
+    RunQueue(runner, spsc, "ara::core::SpscRing");
+    RunQueue(runner, mpmc, "ara::core::MpmcRing");
+    RunQueue(runner, mutexQueue, "std::mutex+std::deque");
+
+    return runner.Finish();
+}
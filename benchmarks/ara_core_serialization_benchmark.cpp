@@ -0,0 +1,151 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara_core_serialization_benchmark.cpp
+ *  \brief      Microbenchmarks of ara::core::serialization against a hand-written per-element serializer.
+ *
+ *  \details    Cost of writing and of reading back one payload of Array<Array<T, 16>, 16> (one message):
+ *              - serialize_big / deserialize_big:   big-endian wire (byte-swapping copy on little-endian hosts)
+ *              - serialize_native:                  host byte order (one block copy)
+ *              The baseline shifts every element out byte by byte and checks the remaining space per element, as
+ *              serializers written by hand typically do.
+ *********************************************************************************************************************/
+
+#include "benchmark_harness.h"
+#include "ara/core/serialization.h"   // ara::core::serialization
+
+#include <cstddef>           // For std::size_t
+#include <cstdint>           // For std::uint16_t, std::uint32_t, std::uint64_t
+#include <cstring>           // For std::memcpy
+
+using ara::core::Array;
+using ara::core::Span;
+using ara::core::serialization::ByteOrder;
+using ara::core::serialization::kWireSize;
+
+/**********************************************************************************************************************
+ *  BASELINE
+ *********************************************************************************************************************/
+/*!
+ * \brief  Per-element big-endian serializer with a bounds check per element.
+ */
+template <typename T, std::size_t N, std::size_t M>
+static auto HandSerialize(const Array<Array<T, M>, N>& value, std::uint8_t* out, std::size_t capacity) -> std::size_t
+{
+    std::size_t offset = 0U;
+    for (std::size_t row = 0U; row < N; ++row) {
+        for (std::size_t column = 0U; column < M; ++column) {
+            if ((capacity - offset) < sizeof(T)) {
+                return 0U;
+            }
+            std::uint64_t bits{0U};
+            std::memcpy(&bits, &value[row][column], sizeof(T));
+            for (std::size_t byte = 0U; byte < sizeof(T); ++byte) {
+                out[offset + byte] = static_cast<std::uint8_t>(bits >> (8U * (sizeof(T) - 1U - byte)));
+            }
+            offset += sizeof(T);
+        }
+    }
+    return offset;
+}
+
+/*!
+ * \brief  Per-element big-endian deserializer with a bounds check per element.
+ */
+template <typename T, std::size_t N, std::size_t M>
+static auto HandDeserialize(const std::uint8_t* in, std::size_t size, Array<Array<T, M>, N>& value) -> std::size_t
+{
+    std::size_t offset = 0U;
+    for (std::size_t row = 0U; row < N; ++row) {
+        for (std::size_t column = 0U; column < M; ++column) {
+            if ((size - offset) < sizeof(T)) {
+                return 0U;
+            }
+            std::uint64_t bits{0U};
+            for (std::size_t byte = 0U; byte < sizeof(T); ++byte) {
+                bits = (bits << 8U) | in[offset + byte];
+            }
+            std::memcpy(&value[row][column], &bits, sizeof(T));
+            offset += sizeof(T);
+        }
+    }
+    return offset;
+}
+
+/**********************************************************************************************************************
+ *  BENCHMARKS
+ *********************************************************************************************************************/
+/*!
+ * \brief  Registers the benchmarks of a 16x16 payload of T under \c subject.
+ */
+template <typename T>
+static auto RunPayload(benchmark::Runner& runner, const char* subject) -> void
+{
+    using Payload = Array<Array<T, 16U>, 16U>;
+    static Payload payload{};
+    static Payload decoded{};
+    static Array<std::uint8_t, kWireSize<Payload>> wire{};
+    for (std::size_t i = 0U; i < 256U; ++i) {
+        payload[i / 16U][i % 16U] = static_cast<T>(i * 2654435761U);
+    }
+
+    runner.Run("serialize_big", subject, []() {
+        benchmark::DoNotOptimize(payload);
+        std::size_t written = ara::core::serialization::Serialize(payload, wire);
+        benchmark::DoNotOptimize(written);
+        benchmark::DoNotOptimize(wire);
+    });
+    runner.Run("serialize_big_by_hand", subject, []() {
+        benchmark::DoNotOptimize(payload);
+        std::size_t written = HandSerialize(payload, wire.data(), wire.size());
+        benchmark::DoNotOptimize(written);
+        benchmark::DoNotOptimize(wire);
+    });
+    runner.Run("deserialize_big", subject, []() {
+        benchmark::DoNotOptimize(wire);
+        std::size_t read = ara::core::serialization::Deserialize(wire, decoded);
+        benchmark::DoNotOptimize(read);
+        benchmark::DoNotOptimize(decoded);
+    });
+    runner.Run("deserialize_big_by_hand", subject, []() {
+        benchmark::DoNotOptimize(wire);
+        std::size_t read = HandDeserialize(wire.data(), wire.size(), decoded);
+        benchmark::DoNotOptimize(read);
+        benchmark::DoNotOptimize(decoded);
+    });
+    runner.Run("serialize_native", subject, []() {
+        benchmark::DoNotOptimize(payload);
+        std::size_t written =
+            ara::core::serialization::Serialize<ara::core::serialization::kNativeByteOrder>(payload, wire);
+        benchmark::DoNotOptimize(written);
+        benchmark::DoNotOptimize(wire);
+    });
+}
+
+/**********************************************************************************************************************
+ *  MAIN FUNCTION
+ *********************************************************************************************************************/
+int main(int argc, char* argv[])
+{
+    benchmark::Options options;
+    if (!benchmark::ParseOptions(argc, argv, options)) {
+        return 1;
+    }
+
+    std::cerr << "=== ara::core::serialization vs per-element serializer (" << benchmark::kPlatform << "/"
+              << benchmark::kArchitecture << ", swap backend "
+              << ara::core::serialization::ByteSwapBackendName() << ") ===\n";
+
+    benchmark::Runner runner{"ara_core_serialization", options};
+    RunPayload<std::uint16_t>(runner, "16x16 uint16");
+    RunPayload<std::uint32_t>(runner, "16x16 uint32");
+    RunPayload<double>(runner, "16x16 double");
+
+    return runner.Finish();
+}
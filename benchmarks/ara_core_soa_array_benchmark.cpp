@@ -0,0 +1,123 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara_core_soa_array_benchmark.cpp
+ *  \brief      Microbenchmarks of ara::core::SoaArray against an array of structs.
+ *
+ *  \details    1024 tracks of eight fields (32 bytes per record); each pass touches only two or three of them:
+ *              - predict:  x += vx * dt for every track (two of eight fields read, one written)
+ *              - sum:      sum of one field
+ *              The array-of-structs baseline strides over whole records; the SoaArray streams the columns, either
+ *              through row proxies or with the ara::core::simd kernels on whole columns.
+ *********************************************************************************************************************/
+
+#include "benchmark_harness.h"
+#include "ara/core/soa_array.h"   // ara::core::SoaArray
+#include "ara/core/simd.h"        // ara::core::simd
+
+#include <cstddef>           // For std::size_t
+#include <cstdint>           // For std::uint32_t
+
+using ara::core::Array;
+using ara::core::SoaArray;
+using ara::core::SoaField;
+
+/*!
+ * \brief  Number of tracks per pass.
+ */
+constexpr std::size_t kTracks = 1024U;
+
+/*!
+ * \brief  Field tags.
+ */
+struct X {};
+struct Y {};
+struct Vx {};
+struct Vy {};
+struct Quality {};
+struct Age {};
+struct Id {};
+struct Flags {};
+
+/*!
+ * \brief  The same record as an array-of-structs element.
+ */
+struct Track {
+    float         x;
+    float         y;
+    float         vx;
+    float         vy;
+    float         quality;
+    float         age;
+    std::uint32_t id;
+    std::uint32_t flags;
+};
+
+using TrackTable = SoaArray<kTracks, SoaField<X, float>, SoaField<Y, float>, SoaField<Vx, float>, SoaField<Vy, float>,
+                            SoaField<Quality, float>, SoaField<Age, float>, SoaField<Id, std::uint32_t>,
+                            SoaField<Flags, std::uint32_t>>;
+
+/**********************************************************************************************************************
+ *  MAIN FUNCTION
+ *********************************************************************************************************************/
+int main(int argc, char* argv[])
+{
+    benchmark::Options options;
+    if (!benchmark::ParseOptions(argc, argv, options)) {
+        return 1;
+    }
+
+    std::cerr << "=== ara::core::SoaArray vs array of structs (" << benchmark::kPlatform << "/"
+              << benchmark::kArchitecture << ") ===\n";
+
+    static Array<Track, kTracks> aos{};
+    static TrackTable soa{};
+    static Array<float, kTracks> dt{};
+    for (std::size_t i = 0U; i < kTracks; ++i) {
+        float const value = static_cast<float>(i % 97U) * 0.25F;
+        aos[i] = Track{value, value, 1.0F, -1.0F, 0.5F, 0.0F, static_cast<std::uint32_t>(i), 0U};
+        soa[i].Assign(value, value, 1.0F, -1.0F, 0.5F, 0.0F, static_cast<std::uint32_t>(i), 0U);
+    }
+    dt.fill(1.0e-3F);
+
+    benchmark::Runner runner{"ara_core_soa_array", options};
+    constexpr const char* kSubject = "1024 tracks";
+
+    runner.Run("predict_aos", kSubject, []() {
+        for (std::size_t i = 0U; i < kTracks; ++i) {
+            aos[i].x += aos[i].vx * 1.0e-3F;
+        }
+        benchmark::DoNotOptimize(aos);
+    });
+    runner.Run("predict_soa_rows", kSubject, []() {
+        for (auto track : soa) {
+            track.Get<X>() += track.Get<Vx>() * 1.0e-3F;
+        }
+        benchmark::DoNotOptimize(soa);
+    });
+    runner.Run("predict_soa_simd", kSubject, []() {
+        soa.Column<X>() = ara::core::simd::Fma(soa.Column<Vx>(), dt, soa.Column<X>());
+        benchmark::DoNotOptimize(soa);
+    });
+    runner.Run("sum_aos", kSubject, []() {
+        benchmark::DoNotOptimize(aos);
+        float sum = 0.0F;
+        for (std::size_t i = 0U; i < kTracks; ++i) {
+            sum += aos[i].quality;
+        }
+        benchmark::DoNotOptimize(sum);
+    });
+    runner.Run("sum_soa_simd", kSubject, []() {
+        benchmark::DoNotOptimize(soa);
+        float sum = ara::core::simd::Sum(soa.Column<Quality>());
+        benchmark::DoNotOptimize(sum);
+    });
+
+    return runner.Finish();
+}
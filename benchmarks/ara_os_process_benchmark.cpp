@@ -0,0 +1,102 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara_os_process_benchmark.cpp
+ *  \brief      Microbenchmarks of the process information of the target platform (Linux or QNX).
+ *
+ *  \details    The three ways of reaching the GetProcessName backend are timed:
+ *              - static:   PlatformProcessAccess::GetProcessName (direct call, no allocation)
+ *              - virtual:  ProcessInteraction::GetProcessName through an instance created once
+ *              - factory:  ProcessFactory::CreateInstance() followed by GetProcessName on every call
+ *              and the cost of the process statistics for the sampler and for a reader:
+ *              - GetResourceUsage:    the kernel queries of one sample (getrusage, CPU clock, resident pages)
+ *              - ProcessStats/Sample: a complete sample with one managed thread, published through the SeqLock
+ *              - ProcessStats/Load:   a reader copying the latest snapshot (no system call)
+ *********************************************************************************************************************/
+
+#include "benchmark_harness.h"
+#include "ara/os/interface/process/process_factory.h"
+#include "ara/os/interface/process/process_stats.h"
+
+#include <cstddef>           // For std::size_t
+#include <memory>            // For std::unique_ptr
+
+using ara::os::interface::process::ErrorCode;
+using ara::os::interface::process::PlatformProcessAccess;
+using ara::os::interface::process::ProcessFactory;
+using ara::os::interface::process::ProcessInteraction;
+using ara::os::interface::process::ProcessStats;
+using ara::os::interface::process::ProcessStatsSnapshot;
+using ara::os::interface::process::ResourceUsage;
+
+/**********************************************************************************************************************
+ *  MAIN FUNCTION
+ *********************************************************************************************************************/
+int main(int argc, char* argv[])
+{
+    benchmark::Options options;
+    if (!benchmark::ParseOptions(argc, argv, options)) {
+        return 1;
+    }
+
+    constexpr std::size_t kBufferSize{256U};
+    static char buffer[kBufferSize]{};
+
+    std::unique_ptr<ProcessInteraction> const process = ProcessFactory::CreateInstance();
+    if ((process == nullptr) || (PlatformProcessAccess::GetProcessName(buffer, kBufferSize) != ErrorCode::Success)) {
+        std::cerr << "GetProcessName is not available on this target\n";
+        return 1;
+    }
+
+    std::cerr << "=== GetProcessName (" << benchmark::kPlatform << "/" << benchmark::kArchitecture << ", process \""
+              << buffer << "\") ===\n";
+    benchmark::Runner runner{"ara_os_process", options};
+
+    runner.Run("GetProcessName/static", benchmark::kPlatform, []() {
+        ErrorCode result = PlatformProcessAccess::GetProcessName(buffer, kBufferSize);
+        benchmark::DoNotOptimize(result);
+    });
+
+    runner.Run("GetProcessName/virtual", benchmark::kPlatform, [&process]() {
+        ErrorCode result = process->GetProcessName(buffer, kBufferSize);
+        benchmark::DoNotOptimize(result);
+    });
+
+    runner.Run("GetProcessName/factory", benchmark::kPlatform, []() {
+        std::unique_ptr<ProcessInteraction> const instance = ProcessFactory::CreateInstance();
+        ErrorCode result = instance->GetProcessName(buffer, kBufferSize);
+        benchmark::DoNotOptimize(result);
+    });
+
+    runner.Run("GetResourceUsage/static", benchmark::kPlatform, []() {
+        ResourceUsage usage{};
+        ErrorCode result = PlatformProcessAccess::GetResourceUsage(usage);
+        benchmark::DoNotOptimize(result);
+        benchmark::DoNotOptimize(usage);
+    });
+
+    static ProcessStats stats{};
+    static_cast<void>(stats.RegisterCurrentThread("main"));
+    static_cast<void>(stats.Sample());
+
+    runner.Run("ProcessStats/Sample", "1 managed thread", []() {
+        auto result = stats.Sample();
+        benchmark::DoNotOptimize(result);
+    });
+
+    runner.Run("ProcessStats/Load", "snapshot copy", []() {
+        ProcessStatsSnapshot snapshot{};
+        bool loaded = stats.Load(snapshot);
+        benchmark::DoNotOptimize(loaded);
+        benchmark::DoNotOptimize(snapshot);
+    });
+
+    static_cast<void>(stats.UnregisterThread(::pthread_self()));
+    return runner.Finish();
+}
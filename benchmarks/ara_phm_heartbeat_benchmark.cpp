@@ -0,0 +1,130 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara_phm_heartbeat_benchmark.cpp
+ *  \brief      Microbenchmarks of the ara::phm heartbeat against a heartbeat message and of the supervisor check.
+ *
+ *  \details    Reporting side, one operation reports one heartbeat:
+ *              - pipe_write_heartbeat:  write() of an 8-byte heartbeat message into a pipe (one system call)
+ *              - report_alive_now:      SupervisedEntity::ReportAlive(), one clock read and the stores to the slot
+ *              - report_alive_release:  ReportAlive(release) as called from a rate group task, stores only
+ *              Supervising side, one operation checks a full table of 64 active entities:
+ *              - count_expired:         AliveSupervisor::CountExpired(), two loads per slot
+ *              - check:                 AliveSupervisor::Check(), full status of every slot
+ *********************************************************************************************************************/
+
+#include "benchmark_harness.h"
+#include "ara/os/interface/timer/cyclic_executive.h"  // For PlatformDeadlineTimer::Now
+#include "ara/phm/alive_supervision.h"                // ara::phm::SupervisedEntity, AliveSupervisor
+
+#include <array>             // For std::array
+#include <chrono>            // For std::chrono::milliseconds
+#include <cstddef>           // For std::size_t
+#include <cstdint>           // For std::uint64_t
+#include <string>            // For std::string, std::to_string
+#include <fcntl.h>           // For O_NONBLOCK
+#include <unistd.h>          // For pipe, write, read, getpid
+
+using ara::phm::AliveSupervisor;
+using ara::phm::EntityStatus;
+using ara::phm::ErrorCode;
+using ara::phm::HeartbeatSegment;
+using ara::phm::HeartbeatTable;
+using ara::phm::MonotonicTime;
+using ara::phm::SupervisedEntity;
+using ara::phm::SupervisionConfig;
+
+/*!
+ * \brief  Heartbeats written into the pipe before it is drained (well below the pipe capacity).
+ */
+constexpr std::uint64_t kPipeDrainInterval{1024U};
+
+/**********************************************************************************************************************
+ *  MAIN FUNCTION
+ *********************************************************************************************************************/
+int main(int argc, char* argv[])
+{
+    benchmark::Options options;
+    if (!benchmark::ParseOptions(argc, argv, options)) {
+        return 1;
+    }
+
+    std::cerr << "=== ara::phm heartbeat vs pipe message (" << benchmark::kPlatform << "/"
+              << benchmark::kArchitecture << ") ===\n";
+
+    std::string const name = "/ara_phm_benchmark_" + std::to_string(::getpid());
+    static HeartbeatSegment segment{};
+    if (segment.Create(name.c_str()) != ErrorCode::Success) {
+        std::cerr << "Cannot create the heartbeat segment " << name << "\n";
+        return 1;
+    }
+
+    /* A full table: every slot active and far from its deadline */
+    static std::array<SupervisedEntity, HeartbeatTable::kCapacity> entities{};
+    static std::array<std::string, HeartbeatTable::kCapacity> names{};
+    MonotonicTime const start = ara::os::interface::timer::PlatformDeadlineTimer::Now();
+    for (std::size_t i = 0U; i < entities.size(); ++i) {
+        names[i] = "task_" + std::to_string(i);
+        SupervisionConfig config{};
+        config.name   = names[i].c_str();
+        config.period = std::chrono::hours(1);
+        static_cast<void>(entities[i].Register(segment, config, start));
+    }
+
+    static int pipeFds[2]{-1, -1};
+    if ((::pipe(pipeFds) != 0) || (::fcntl(pipeFds[0], F_SETFL, O_NONBLOCK) != 0)) {
+        std::cerr << "Cannot create the heartbeat pipe\n";
+        return 1;
+    }
+
+    static std::uint64_t beat{0U};
+    static MonotonicTime release{start};
+    static std::array<EntityStatus, HeartbeatTable::kCapacity> statuses{};
+    static AliveSupervisor const supervisor{segment};
+
+    benchmark::Runner runner{"ara_phm_heartbeat", options};
+
+    runner.Run("pipe_write_heartbeat", "1 heartbeat", []() {
+        ++beat;
+        benchmark::DoNotOptimize(beat);
+        ssize_t written = ::write(pipeFds[1], &beat, sizeof(beat));  // A full pipe is drained below, not an error
+        benchmark::DoNotOptimize(written);
+        if ((beat % kPipeDrainInterval) == 0U) {
+            std::uint64_t drained[64];
+            while (::read(pipeFds[0], drained, sizeof(drained)) > 0) {
+            }
+        }
+    });
+    runner.Run("report_alive_now", "1 heartbeat", []() {
+        entities[0U].ReportAlive();
+    });
+    runner.Run("report_alive_release", "1 heartbeat", []() {
+        release += std::chrono::milliseconds(1);
+        benchmark::DoNotOptimize(release);
+        entities[0U].ReportAlive(release);
+    });
+    runner.Run("count_expired", "64 slots", []() {
+        std::size_t expired = supervisor.CountExpired(release);
+        benchmark::DoNotOptimize(expired);
+    });
+    runner.Run("check", "64 slots", []() {
+        std::size_t registered = supervisor.Check(release, statuses);
+        benchmark::DoNotOptimize(registered);
+    });
+
+    for (SupervisedEntity& entity : entities) {
+        entity.Deactivate();
+    }
+    static_cast<void>(::close(pipeFds[0]));
+    static_cast<void>(::close(pipeFds[1]));
+    segment.Close();
+    static_cast<void>(HeartbeatSegment::Unlink(name.c_str()));
+
+    return runner.Finish();
+}
@@ -0,0 +1,328 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       benchmark_harness.h
+ *  \brief      Minimal microbenchmark harness shared by the OpenAA benchmark executables.
+ *
+ *  \details    Every benchmark body is a callable executed once per iteration. The Runner first doubles the iteration
+ *              count until one batch lasts at least the minimum batch time (so the steady_clock resolution and the
+ *              loop overhead become negligible), then times a number of batches and reports the min, median, mean
+ *              and max time per operation. Results are written as CSV or JSON, together with the platform, the
+ *              architecture and the compiler, so that runs on x86_64 / aarch64 Linux and QNX targets can be compared
+ *              by scripts.
+ *
+ *              Command line (all options are optional):
+ *                  --format=csv|json     Output format (default: csv)
+ *                  --output=<file>       Write the results to <file> instead of stdout
+ *                  --filter=<text>       Run only the benchmarks whose name contains <text>
+ *                  --min-time-us=<n>     Minimum duration of one timed batch in microseconds (default: 200)
+ *                  --repetitions=<n>     Number of timed batches per benchmark (default: 15)
+ *
+ *  \note       DoNotOptimize() and ClobberMemory() are compiler barriers (GCC / Clang / QCC inline assembly); they
+ *              emit no instructions but keep the measured work from being removed or hoisted out of the loop.
+ *********************************************************************************************************************/
+
+#ifndef OPEN_AA_BENCHMARKS_BENCHMARK_HARNESS_H_
+#define OPEN_AA_BENCHMARKS_BENCHMARK_HARNESS_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <algorithm>     // For std::sort
+#include <chrono>        // For std::chrono::steady_clock
+#include <cstddef>       // For std::size_t
+#include <cstdint>       // For std::uint64_t
+#include <cstdlib>       // For std::strtoul
+#include <cstring>       // For std::strncmp, std::strcmp
+#include <fstream>       // For std::ofstream
+#include <iostream>      // For std::cout, std::cerr
+#include <ostream>       // For std::ostream
+#include <string>        // For std::string
+#include <utility>       // For std::move
+#include <vector>        // For std::vector
+
+namespace benchmark {
+
+/**********************************************************************************************************************
+ *  SECTION: Compiler barriers
+ *********************************************************************************************************************/
+/*!
+ * \brief  Forces \c value to be materialized in memory and treated as read and modified by unknown code.
+ */
+template <typename T>
+inline auto DoNotOptimize(T& value) noexcept -> void
+{
+    __asm__ __volatile__("" : "+m"(value) : : "memory");
+}
+
+/*!
+ * \brief  Forces all pending writes to memory to be treated as observed.
+ */
+inline auto ClobberMemory() noexcept -> void
+{
+    __asm__ __volatile__("" : : : "memory");
+}
+
+/**********************************************************************************************************************
+ *  SECTION: Target description
+ *********************************************************************************************************************/
+#if defined(__QNXNTO__)
+constexpr const char* kPlatform{"qnx"};
+#elif defined(__linux__)
+constexpr const char* kPlatform{"linux"};
+#else
+constexpr const char* kPlatform{"unknown"};
+#endif
+
+#if defined(__x86_64__)
+constexpr const char* kArchitecture{"x86_64"};
+#elif defined(__aarch64__)
+constexpr const char* kArchitecture{"aarch64"};
+#else
+constexpr const char* kArchitecture{"unknown"};
+#endif
+
+#if defined(NDEBUG)
+constexpr const char* kBuildType{"release"};
+#else
+constexpr const char* kBuildType{"debug"};
+#endif
+
+/**********************************************************************************************************************
+ *  STRUCT: Options
+ *********************************************************************************************************************/
+/*!
+ * \brief  Output format of the results.
+ */
+enum class OutputFormat : std::uint8_t {
+    kCsv = 0,
+    kJson
+};
+
+/*!
+ * \brief  Parsed command line of a benchmark executable.
+ */
+struct Options {
+    OutputFormat              format{OutputFormat::kCsv};
+    const char*               outputPath{nullptr};
+    const char*               filter{nullptr};
+    std::chrono::microseconds minBatchTime{200};
+    std::size_t               repetitions{15U};
+};
+
+/*!
+ * \brief  Prints the command line help to stderr.
+ */
+inline auto PrintUsage(const char* programName) -> void
+{
+    std::cerr << "Usage: " << programName
+              << " [--format=csv|json] [--output=<file>] [--filter=<text>] [--min-time-us=<n>] [--repetitions=<n>]\n";
+}
+
+/*!
+ * \brief  Parses the command line into \c options.
+ *
+ * \return false if an option is unknown or malformed (the usage has been printed).
+ */
+inline auto ParseOptions(int argc, char* argv[], Options& options) -> bool
+{
+    for (int index = 1; index < argc; ++index) {
+        const char* const argument = argv[index];
+        if (std::strcmp(argument, "--format=csv") == 0) {
+            options.format = OutputFormat::kCsv;
+        } else if (std::strcmp(argument, "--format=json") == 0) {
+            options.format = OutputFormat::kJson;
+        } else if (std::strncmp(argument, "--output=", 9U) == 0) {
+            options.outputPath = argument + 9;
+        } else if (std::strncmp(argument, "--filter=", 9U) == 0) {
+            options.filter = argument + 9;
+        } else if (std::strncmp(argument, "--min-time-us=", 14U) == 0) {
+            options.minBatchTime = std::chrono::microseconds{std::strtoul(argument + 14, nullptr, 10)};
+        } else if (std::strncmp(argument, "--repetitions=", 14U) == 0) {
+            options.repetitions = static_cast<std::size_t>(std::strtoul(argument + 14, nullptr, 10));
+        } else {
+            std::cerr << "Unknown option: " << argument << "\n";
+            PrintUsage(argv[0]);
+            return false;
+        }
+    }
+
+    if (options.repetitions == 0U) {
+        std::cerr << "--repetitions must be at least 1\n";
+        PrintUsage(argv[0]);
+        return false;
+    }
+    return true;
+}
+
+/**********************************************************************************************************************
+ *  STRUCT: Result
+ *********************************************************************************************************************/
+/*!
+ * \brief  Timing of one benchmark (nanoseconds per operation).
+ */
+struct Result {
+    std::string   suite;
+    std::string   name;
+    std::string   subject;
+    std::uint64_t iterations{0U};
+    std::size_t   repetitions{0U};
+    double        minNs{0.0};
+    double        medianNs{0.0};
+    double        meanNs{0.0};
+    double        maxNs{0.0};
+};
+
+/**********************************************************************************************************************
+ *  CLASS: Runner
+ *********************************************************************************************************************/
+/*!
+ * \brief  Calibrates, times and collects the benchmarks of one executable.
+ */
+class Runner final {
+public:
+    /*!
+     * \brief  Creates a Runner for the benchmarks of \c suite.
+     */
+    Runner(const char* suite, const Options& options) : suite_{suite}, options_{options}
+    {
+    }
+
+    /*!
+     * \brief  Times \c body, once per iteration, and records the result as \c name on \c subject.
+     *
+     * \details The benchmark is skipped if it does not match the --filter option.
+     */
+    template <typename Body>
+    auto Run(const std::string& name, const char* subject, Body&& body) -> void
+    {
+        if ((options_.filter != nullptr) && (name.find(options_.filter) == std::string::npos)) {
+            return;
+        }
+
+        // Calibration: double the batch until it lasts at least the minimum batch time
+        constexpr std::uint64_t kMaxIterations{std::uint64_t{1U} << 30U};
+        std::uint64_t iterations = 1U;
+        while ((TimeBatch(body, iterations) < options_.minBatchTime) && (iterations < kMaxIterations)) {
+            iterations *= 2U;
+        }
+
+        std::vector<double> samples;
+        samples.reserve(options_.repetitions);
+        for (std::size_t repetition = 0U; repetition < options_.repetitions; ++repetition) {
+            std::chrono::nanoseconds const elapsed = TimeBatch(body, iterations);
+            samples.push_back(static_cast<double>(elapsed.count()) / static_cast<double>(iterations));
+        }
+        std::sort(samples.begin(), samples.end());
+
+        double sum = 0.0;
+        for (double const sample : samples) {
+            sum += sample;
+        }
+
+        Result result;
+        result.suite       = suite_;
+        result.name        = name;
+        result.subject     = subject;
+        result.iterations  = iterations;
+        result.repetitions = samples.size();
+        result.minNs       = samples.front();
+        result.medianNs    = samples[samples.size() / 2U];
+        result.meanNs      = sum / static_cast<double>(samples.size());
+        result.maxNs       = samples.back();
+
+        std::cerr << "  " << result.name << " [" << result.subject << "]: " << result.medianNs << " ns/op\n";
+        results_.push_back(std::move(result));
+    }
+
+    /*!
+     * \brief  Writes the collected results to stdout or to the --output file.
+     *
+     * \return Process exit code: 0 on success, 1 if the output file could not be written.
+     */
+    auto Finish() const -> int
+    {
+        if (options_.outputPath == nullptr) {
+            Write(std::cout);
+            return 0;
+        }
+
+        std::ofstream file(options_.outputPath, std::ios::out | std::ios::trunc);
+        if (!file) {
+            std::cerr << "Cannot open output file: " << options_.outputPath << "\n";
+            return 1;
+        }
+        Write(file);
+        file.flush();
+        return file ? 0 : 1;
+    }
+
+private:
+    /*!
+     * \brief  Duration of \c iterations calls of \c body.
+     */
+    template <typename Body>
+    static auto TimeBatch(Body& body, std::uint64_t iterations) -> std::chrono::nanoseconds
+    {
+        auto const start = std::chrono::steady_clock::now();
+        for (std::uint64_t iteration = 0U; iteration < iterations; ++iteration) {
+            body();
+        }
+        ClobberMemory();
+        auto const stop = std::chrono::steady_clock::now();
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start);
+    }
+
+    /*!
+     * \brief  Writes all results in the configured format.
+     */
+    auto Write(std::ostream& out) const -> void
+    {
+        if (options_.format == OutputFormat::kJson) {
+            WriteJson(out);
+        } else {
+            WriteCsv(out);
+        }
+    }
+
+    auto WriteCsv(std::ostream& out) const -> void
+    {
+        out << "suite,benchmark,subject,platform,arch,compiler,build,iterations,repetitions,"
+               "ns_per_op_min,ns_per_op_median,ns_per_op_mean,ns_per_op_max\n";
+        for (Result const& result : results_) {
+            out << result.suite << ',' << result.name << ',' << result.subject << ',' << kPlatform << ','
+                << kArchitecture << ",\"" << __VERSION__ << "\"," << kBuildType << ',' << result.iterations << ','
+                << result.repetitions << ',' << result.minNs << ',' << result.medianNs << ',' << result.meanNs << ','
+                << result.maxNs << '\n';
+        }
+    }
+
+    auto WriteJson(std::ostream& out) const -> void
+    {
+        out << "{\n  \"context\": {\"suite\": \"" << suite_ << "\", \"platform\": \"" << kPlatform
+            << "\", \"arch\": \"" << kArchitecture << "\", \"compiler\": \"" << __VERSION__ << "\", \"build\": \""
+            << kBuildType << "\"},\n  \"benchmarks\": [";
+        for (std::size_t index = 0U; index < results_.size(); ++index) {
+            Result const& result = results_[index];
+            out << ((index == 0U) ? "\n" : ",\n") << "    {\"name\": \"" << result.name << "\", \"subject\": \""
+                << result.subject << "\", \"iterations\": " << result.iterations << ", \"repetitions\": "
+                << result.repetitions << ", \"ns_per_op\": {\"min\": " << result.minNs << ", \"median\": "
+                << result.medianNs << ", \"mean\": " << result.meanNs << ", \"max\": " << result.maxNs << "}}";
+        }
+        out << "\n  ]\n}\n";
+    }
+
+    std::string         suite_;
+    Options             options_;
+    std::vector<Result> results_{};
+};
+
+} // namespace benchmark
+
+#endif // OPEN_AA_BENCHMARKS_BENCHMARK_HARNESS_H_
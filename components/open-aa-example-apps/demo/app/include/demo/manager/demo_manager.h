@@ -23,12 +23,16 @@
 /**********************************************************************************************************************
  *  INCLUDES
  *********************************************************************************************************************/
-#include <atomic>                           // For the std::atomic_bool
-#include <condition_variable>               // For the std::conditional_variable
-#include <thread>                           // For the std::thread
 #include <mutex>                            // For std::mutex
 #include <optional>                         // For std::optional
 #include <functional>                       // For std::reference_wrapper
+#include <cstdint>                          // For std::uint32_t
+#include <chrono>                           // For std::chrono::nanoseconds
+
+#include "ara/os/interface/event/event_loop.h"       // For the single-threaded signal / timer EventLoop
+#include "ara/os/interface/timer/cyclic_executive.h" // For the drift-free CyclicExecutive
+#include "ara/core/internal/metrics.h"               // For the cycle latency and jitter histograms
+#include "ara/phm/alive_supervision.h"               // For the heartbeat of the manager cycle
 
 namespace demo {
 namespace manager {
@@ -55,14 +59,38 @@ public:
      */
     static auto StartManager() noexcept -> std::optional<std::reference_wrapper<DemoManager>>;
 
+    /** -------------------------------------------------------------------------------------------------------------------
+     *  @brief      Default running cycle of the manager in milliseconds.
+     */
+    static constexpr std::uint32_t kDefaultRunningCycle{5000U};
+
+    /** -------------------------------------------------------------------------------------------------------------------
+     *  @brief      Number of manager cycles between two cycle metrics reports.
+     */
+    static constexpr std::uint32_t kMetricsReportCycles{10U};
+
+    /** -------------------------------------------------------------------------------------------------------------------
+     *  @brief      Name of the manager cycle in the heartbeat table (and of its rate group).
+     */
+    static constexpr const char* kCycleName{"demo_cycle"};
+
     /** -------------------------------------------------------------------------------------------------------------------
      *  @brief      Runs the manager and returns an exit code.
      *
-     *  Executes the primary functionality of the manager and returns a success exit code.
+     *  Executes the primary functionality of the manager as a rate group of a CyclicExecutive released every
+     *  running_cycle_ms on absolute deadlines, while the calling thread runs the event loop dispatching the shutdown
+     *  signals and the periodic metrics report, until a shutdown signal is received. Every cycle reports alive to
+     *  the heartbeat segment ara::phm::HeartbeatSegment::kDefaultName, so that a supervisor process detects a stalled
+     *  cycle within one running cycle (plus half a cycle of tolerance); without the segment the manager runs
+     *  unsupervised.
      *
-     *  @return     std::uint8_t Exit code indicating success.
+     *  @param[in]  running_cycle_ms  Period of the manager cycle in milliseconds (must be greater than zero).
+     *  @param[in]  cycle_affinity    CPUs the manager cycle thread is pinned to (empty: not pinned).
+     *
+     *  @return     std::uint8_t Exit code indicating success, or EXIT_FAILURE if the executive cannot be started.
      */
-    auto RunManager() noexcept -> std::uint8_t;
+    auto RunManager(std::uint32_t running_cycle_ms = kDefaultRunningCycle,
+                    const ara::os::interface::thread::CpuSet& cycle_affinity = {}) noexcept -> std::uint8_t;
 
     /** -------------------------------------------------------------------------------------------------------------------
      *  @brief      Deleted copy constructor.
@@ -125,9 +153,45 @@ private:
     /** -------------------------------------------------------------------------------------------------------------------
      *  @brief      Private GracefulShutdownHandler.
      *
-     *  To handle the shutdown request and wait for the specific signals for it.
+     *  Event loop handler of SIGTERM and SIGINT: logs the signal and stops the event loop.
+     */
+    static auto GracefulShutdownHandler(void* context, const ara::os::interface::event::Event& event) noexcept -> void;
+
+    /** -------------------------------------------------------------------------------------------------------------------
+     *  @brief      Private MetricsReportHandler.
+     *
+     *  Event loop handler of the metrics report timer.
+     */
+    static auto MetricsReportHandler(void* context, const ara::os::interface::event::Event& event) noexcept -> void;
+
+    /** -------------------------------------------------------------------------------------------------------------------
+     *  @brief      Private ManagerCycle.
+     *
+     *  The periodic work of the manager, executed by the CyclicExecutive on every release.
+     */
+    static auto ManagerCycle(void* context, const ara::os::interface::timer::CycleInfo& info) noexcept -> void;
+
+    /** -------------------------------------------------------------------------------------------------------------------
+     *  @brief      Private ReportOverrun.
+     *
+     *  Called by the CyclicExecutive when a manager cycle took longer than the configured running cycle.
+     */
+    static auto ReportOverrun(void* context, const ara::os::interface::timer::OverrunInfo& info) noexcept -> void;
+
+    /** -------------------------------------------------------------------------------------------------------------------
+     *  @brief      Private StartSupervision.
+     *
+     *  Registers the manager cycle with the given period in the heartbeat segment, or logs why it runs unsupervised.
+     */
+    auto StartSupervision(std::chrono::nanoseconds period) noexcept -> void;
+
+    /** -------------------------------------------------------------------------------------------------------------------
+     *  @brief      Private ReportCycleMetrics.
+     *
+     *  Prints the wake-up latency and execution time percentiles of the manager cycle. Called from the event loop
+     *  on the thread running RunManager while the cycle keeps running.
      */
-    auto GracefulShutdownHandler() noexcept -> void;
+    auto ReportCycleMetrics() const noexcept -> void;
     
     /** -------------------------------------------------------------------------------------------------------------------
      *  @brief      Flag indicating whether an instance has been created.
@@ -142,19 +206,34 @@ private:
     static std::mutex mutex_;
 
     /** -------------------------------------------------------------------------------------------------------------------
-     *  @brief      thread to wait for either SIGTERM, OR SIGINT.
+     *  @brief      event loop dispatching SIGTERM, SIGINT and the metrics report timer on the RunManager thread.
+     */
+    ara::os::interface::event::EventLoop event_loop_;
+
+    /** -------------------------------------------------------------------------------------------------------------------
+     *  @brief      cyclic executive releasing the manager cycle on absolute deadlines.
+     */
+    ara::os::interface::timer::CyclicExecutive executive_;
+
+    /** -------------------------------------------------------------------------------------------------------------------
+     *  @brief      wake-up latency / execution time histograms and overrun count of the manager cycle.
+     */
+    ara::core::internal::metrics::CycleMetrics cycle_metrics_;
+
+    /** -------------------------------------------------------------------------------------------------------------------
+     *  @brief      shared-memory heartbeat table the manager cycle reports to.
      */
-    std::thread graceful_shutdown_handler_thread_;
+    ara::phm::HeartbeatSegment heartbeat_segment_;
 
     /** -------------------------------------------------------------------------------------------------------------------
-     *  @brief      condition variable to notify wating threads.
+     *  @brief      heartbeat slot of the manager cycle (unregistered if the segment is unavailable).
      */
-    std::condition_variable shutdown_notifier_;
+    ara::phm::SupervisedEntity supervised_cycle_;
 
     /** -------------------------------------------------------------------------------------------------------------------
-     *  @brief      flag of Application turn off request.
+     *  @brief      configured running cycle in milliseconds (for the overrun report).
      */
-    std::atomic_bool turn_off_requested_;
+    std::uint32_t running_cycle_ms_;
 };
 
 } // namespace manager
@@ -17,23 +17,49 @@
 /**********************************************************************************************************************
  *  INCLUDES
  *********************************************************************************************************************/
-#include <algorithm>                        // For std::all_of
 #include <cstdint>                          // For the std types
-#include <iostream>                         // For the std::cout and cerr
-#include <csignal>                          // For signal Block to handle shutdown
+#include <csignal>                          // For the SIGTERM and SIGINT shutdown signals
 
 #include "ara/core/array.h"                 // For platform core Array class
+#include "ara/core/flight_recorder.h"       // For the cycle records dumped on a violation or crash
+#include "ara/log/logger.h"                 // For the asynchronous ara::log Logger
+#include "ara/os/interface/thread/thread.h" // For the scheduling of the rate group thread
+#include "ara/os/interface/trace/trace.h"   // For the cycle and shutdown trace probes
+#include "ara/phm/alive_supervision.h"      // For the heartbeat of the manager cycle
 #include "demo/manager/demo_manager.h"      // For the manager class
 
 namespace demo {
 namespace manager {
 
+namespace {
+
+/*!
+ * \brief Logger of the demo manager.
+ */
+constexpr ara::log::Logger kLogger{"demo mngr"};
+
+/*!
+ * \brief Signals requesting the shutdown of the manager.
+ */
+constexpr ara::core::Array<int,2> kShutdownSigs{SIGTERM, SIGINT};
+
+/*!
+ * \brief Trace group of the manager cycle in the cycle_begin / cycle_end probes.
+ */
+constexpr std::uint32_t kManagerCycleTraceGroup{0U};
+
+/*!
+ * \brief Probe backend selected with ARA_OS_TRACE_BACKEND (compiled out by default).
+ */
+using Trace = ara::os::interface::trace::PlatformTraceAccess;
+
+} // namespace
+
 /** -------------------------------------------------------------------------------------------------------------------
  *  @brief      Static member initialization.
  *
- *  Initializes The Running cycle, the static flag and mutex.
+ *  Initializes the static flag and mutex.
  */
-constexpr std::uint32_t kRunningCycle{5000U};
 bool DemoManager::instanceCreated_{false};
 std::mutex DemoManager::mutex_{};
 
@@ -63,16 +89,19 @@ auto DemoManager::StartManager() noexcept -> std::optional<std::reference_wrappe
  *  Initializes the DemoManager instance. Any required initialization code can be placed here.
  */
 DemoManager::DemoManager() noexcept
-    : graceful_shutdown_handler_thread_{},
-      shutdown_notifier_{},
-      turn_off_requested_{false}
+    : event_loop_{},
+      executive_{},
+      cycle_metrics_{},
+      heartbeat_segment_{},
+      supervised_cycle_{},
+      running_cycle_ms_{kDefaultRunningCycle}
 {
     InitializeDemoManager();
 }
 
 DemoManager::~DemoManager() noexcept {
 
-    std::cout << "[demo mngr][INFO] Demo Manager demolished."<< std::endl;
+    kLogger.LogInfo("Demo Manager demolished.");
 }
 
 /** -------------------------------------------------------------------------------------------------------------------
@@ -82,166 +111,221 @@ DemoManager::~DemoManager() noexcept {
  */
 auto DemoManager::InitializeDemoManager() noexcept -> void {
 
-    /*Start the signal handler thread and check for errors in thread creation*/
-    graceful_shutdown_handler_thread_ = std::thread(&DemoManager::GracefulShutdownHandler, this);
-    if (!graceful_shutdown_handler_thread_.joinable()) {
+    /*Register SIGTERM and SIGINT on the event loop; they are blocked process-wide by main before any thread starts*/
+    for (int const sig : kShutdownSigs) {
 
-        std::cerr << "[demo mngr][FATAL] Graceful shutdown handler thread creation failed."<< std::endl;
-        std::abort();
-    }
+        if (event_loop_.AddSignal(sig, &DemoManager::GracefulShutdownHandler, this) !=
+            ara::os::interface::event::ErrorCode::Success) {
 
+            kLogger.LogFatal("Initialize shutdown signal handling failed.");
+            std::abort();
+        }
+    }
 
-    std::cout << "[demo mngr][INFO] Demo Manager initialized successfuly."<< std::endl;
+    kLogger.LogInfo("Demo Manager initialized successfuly.");
 }
 
 /** -------------------------------------------------------------------------------------------------------------------
- *  @brief      Private init method implementation.
+ *  @brief      Handles a shutdown signal dispatched by the event loop.
  *
- *   the instance init sequence.
+ *  Runs on the thread of RunManager; stopping the loop makes RunManager proceed with the shutdown sequence.
  */
-auto DemoManager::GracefulShutdownHandler() noexcept -> void {
-    
-    /*Set shutdown thread name for debugging*/
-    pthread_setname_np(pthread_self(), "demo_sig");
+auto DemoManager::GracefulShutdownHandler(void* context, const ara::os::interface::event::Event& event) noexcept
+    -> void {
 
-    bool success{false};
+    DemoManager& manager = *static_cast<DemoManager*>(context);
 
-    sigset_t singals{};
+    Trace::ShutdownSignal(static_cast<std::int32_t>(event.value));
 
-    int def_sig{-1};
+    switch (static_cast<int>(event.value)) {
 
-    constexpr const ara::core::Array<int,2> kShutdownSigs{SIGTERM, SIGINT};
+        case kShutdownSigs[0]:
+            kLogger.LogInfo("Demo Manager caught a SIGTERM.");
+            break;
 
-    auto const add_sig_status = [&singals](int const& sig)  noexcept -> bool {
+        case kShutdownSigs[1]:
+            kLogger.LogInfo("Demo Manager caught a SIGINT.");
+            break;
 
-        return (sigaddset(&singals, sig) == 0);
-    };
+        default:
+            break;
+    }
 
-    /*Empty the unitialized signal set*/
-    if(sigemptyset(&singals) == 0) {
-        
-        /*add the SIGTERM, and SIGINT to the singal set*/
-        if(std::all_of(kShutdownSigs.cbegin(), kShutdownSigs.cend(), add_sig_status)) {
+    manager.event_loop_.Stop();
+}
 
-            /*Block these signals in this thread so they can be caught by sigwait*/
-            if (pthread_sigmask(SIG_BLOCK, &singals, nullptr) == 0) {
+/** -------------------------------------------------------------------------------------------------------------------
+ *  @brief      Reports the cycle metrics on every expiry of the report timer.
+ */
+auto DemoManager::MetricsReportHandler(void* context, const ara::os::interface::event::Event& event) noexcept
+    -> void {
 
-                /*The thread is blocked and Wait for a signal to be received*/
-                if(sigwait(&singals, &def_sig) == 0) {
-                    
-                    std::lock_guard<std::mutex> lock(mutex_);
+    static_cast<void>(event);
 
-                    switch(def_sig) {
+    static_cast<DemoManager const*>(context)->ReportCycleMetrics();
+}
 
-                        case kShutdownSigs[0]:
+/** -------------------------------------------------------------------------------------------------------------------
+ *  @brief      The periodic work of the manager.
+ *
+ *  Prints the scheduling policy and priority of the rate group thread (inherited from the thread calling RunManager).
+ *  The work is bracketed by the cycle_begin / cycle_end trace probes, and each cycle is kept (with its lateness) in
+ *  the flight recorder, so that a crash dump shows the last cycles of the manager. The heartbeat is reported first,
+ *  against the release time of the cycle, so it costs two stores and no clock read.
+ */
+auto DemoManager::ManagerCycle(void* context, const ara::os::interface::timer::CycleInfo& info) noexcept -> void {
 
-                            std::cout << "[demo mngr][INFO] Demo Manager caught a SIGTERM." << std::endl;
-                            break;
-                        
-                        case kShutdownSigs[1]:
-                            std::cout << "[demo mngr][INFO] Demo Manager caught a SIGINT." << std::endl;
-                            break;
+    DemoManager& manager = *static_cast<DemoManager*>(context);
 
-                    }
+    manager.supervised_cycle_.ReportAlive(info.release);
 
-                    turn_off_requested_.store(true);
-                    shutdown_notifier_.notify_all();
-                    success = true;
+    Trace::CycleBegin(kManagerCycleTraceGroup, info.cycle);
+    ara::core::FlightRecorder::Record("manager cycle", info.cycle, static_cast<std::uint64_t>(info.lateness.count()));
 
-                }
-            }
-        }
-    }
+    using ara::os::interface::thread::SchedulingPolicy;
+    using ara::os::interface::thread::Thread;
 
-    if(!success) {
+    /* Get current scheduling of the rate group thread */
+    ara::os::interface::thread::SchedulingInfo const scheduling = Thread::GetCurrentScheduling();
 
-        std::cerr << "[demo mngr][FATAL] Initialize shutdown signal handling failed." << std::endl;
-        std::abort();
+    const char* policy_name{"SCHED_OTHER"};
+    switch (scheduling.policy) {
+        case SchedulingPolicy::Fifo:
+            policy_name = "SCHED_FIFO";
+            break;
+        case SchedulingPolicy::RoundRobin:
+            policy_name = "SCHED_RR";
+            break;
+        default:
+            break;
     }
 
+    /* Only the format ID and the arguments are queued; the formatting happens on the log backend thread */
+    kLogger.LogInfo("Current Scheduling Policy: {}, Priority: {}", policy_name, scheduling.priority);
+
+    Trace::CycleEnd(kManagerCycleTraceGroup, info.cycle);
+}
+
+/** -------------------------------------------------------------------------------------------------------------------
+ *  @brief      Reports a manager cycle that took longer than the configured running cycle.
+ *
+ *  The executive then resumes at the next future release, keeping the cycle grid.
+ */
+auto DemoManager::ReportOverrun(void* context, const ara::os::interface::timer::OverrunInfo& info) noexcept -> void {
+
+    DemoManager const& manager = *static_cast<DemoManager const*>(context);
+
+    kLogger.LogWarn("Manager took more than the configured time: {} ms and the execution, time taken is: {} ms, "
+                    "skipped releases: {}.",
+                    manager.running_cycle_ms_,
+                    std::chrono::duration_cast<std::chrono::milliseconds>(info.executionTime).count(),
+                    info.missedReleases);
+}
+
+/** -------------------------------------------------------------------------------------------------------------------
+ *  @brief      Prints the cycle metrics of the manager.
+ *
+ *  Takes lock-free snapshots of the histograms; the manager cycle is not paused.
+ */
+auto DemoManager::ReportCycleMetrics() const noexcept -> void {
 
+    ara::core::internal::metrics::CycleMetricsSummary const summary = cycle_metrics_.GetSummary();
 
+    auto const print = [](const char* name, const ara::core::internal::metrics::HistogramSummary& histogram) noexcept {
+        kLogger.LogInfo("  {}: count {}, p50 {} ns, p99 {} ns, p99.9 {} ns, max {} ns",
+                        name, histogram.count, histogram.p50, histogram.p99, histogram.p999, histogram.max);
+    };
 
+    kLogger.LogInfo("Cycle metrics (overruns: {})", summary.overruns);
+    print("wake-up latency", summary.wakeUpLatency);
+    print("execution time ", summary.executionTime);
+}
+
+/** -------------------------------------------------------------------------------------------------------------------
+ *  @brief      Registers the manager cycle for alive supervision.
+ *
+ *  Opens (or creates) the heartbeat segment and registers the cycle with half a period of tolerance. A failure is
+ *  logged and leaves the manager unsupervised: ReportAlive() on an unregistered entity does nothing.
+ */
+auto DemoManager::StartSupervision(std::chrono::nanoseconds period) noexcept -> void {
+
+    ara::phm::SupervisionConfig config{};
+    config.name      = kCycleName;
+    config.period    = period;
+    config.tolerance = period / 2;
+
+    ara::phm::ErrorCode result = heartbeat_segment_.OpenOrCreate();
+    if (result == ara::phm::ErrorCode::Success) {
+        result = supervised_cycle_.Register(heartbeat_segment_, config,
+                                            ara::os::interface::timer::PlatformDeadlineTimer::Now());
+    }
+
+    if (result == ara::phm::ErrorCode::Success) {
+        kLogger.LogInfo("Manager cycle supervised in {}.", ara::phm::HeartbeatSegment::kDefaultName);
+    } else {
+        kLogger.LogWarn("Alive supervision unavailable (error {}), the manager cycle runs unsupervised.",
+                        static_cast<std::uint32_t>(result));
+        heartbeat_segment_.Close();
+    }
 }
 
 /** -------------------------------------------------------------------------------------------------------------------
  *  @brief      Runs the manager and returns an exit code.
  *
- *  Executes the primary functionality of the manager and returns a success exit code.
+ *  Registers the manager cycle as a rate group, starts the executive and blocks until a shutdown is requested.
+ *
+ *  @param[in]  running_cycle_ms  Period of the manager cycle in milliseconds.
+ *  @param[in]  cycle_affinity    CPUs the manager cycle thread is pinned to before its first release.
  *
  *  @return     std::uint8_t Exit code indicating success.
  */
-auto DemoManager::RunManager() noexcept -> std::uint8_t {
-    
+auto DemoManager::RunManager(std::uint32_t running_cycle_ms,
+                             const ara::os::interface::thread::CpuSet& cycle_affinity) noexcept -> std::uint8_t {
+
+    using ara::os::interface::timer::ErrorCode;
+
     std::uint8_t exit_code{EXIT_SUCCESS};
 
-    bool thread_running{true};
+    running_cycle_ms_ = running_cycle_ms;
 
-    /* Retrieve the native pthread handle */
-    pthread_t native_handle = pthread_self();
+    ara::os::interface::timer::RateGroupConfig config{};
+    config.name           = kCycleName;
+    config.period         = std::chrono::milliseconds(running_cycle_ms);
+    config.policy         = ara::os::interface::timer::OverrunPolicy::Report;
+    config.affinity       = cycle_affinity;
+    config.task           = &DemoManager::ManagerCycle;
+    config.overrunHandler = &DemoManager::ReportOverrun;
+    config.context        = this;
+    config.metrics        = &cycle_metrics_;
 
-    /* Define scheduling parameters */
-    sched_param param{};
+    StartSupervision(config.period);
 
-    int current_policy{-1};
+    if ((executive_.AddRateGroup(config) != ErrorCode::Success) || (executive_.Start() != ErrorCode::Success)) {
 
-    /* Use unique_lock for compatibility with condition_variable */
-    std::unique_lock<std::mutex> lock(mutex_);
+        kLogger.LogError("Failed to start the manager cycle of {} ms.", running_cycle_ms);
+        exit_code = EXIT_FAILURE;
 
-    /* Get current scheduling parameters to preserve existing priority */ 
-    if (pthread_getschedparam(native_handle, &current_policy, &param) != 0) {
-        std::cerr << "[demo mngr][FATAL] Failed to get current scheduling parameters: " 
-                  << std::strerror(errno) << std::endl;
-        std::abort();
-    }
+    } else {
+
+        kLogger.LogInfo("Manager Is on Running State (cycle: {} ms)", running_cycle_ms);
 
-    std::cout << "[demo mngr][INFO] Manager Is on Running State" << std::endl;
-
-    do {
-        auto start_time = std::chrono::steady_clock::now();
-
-            std::cout << "[demo mngr][INFO] Current Scheduling Policy: ";
-            switch (current_policy) {
-                case SCHED_FIFO:
-                    std::cout << "SCHED_FIFO";
-                    break;
-                case SCHED_RR:
-                    std::cout << "SCHED_RR";
-                    break;
-                case SCHED_OTHER:
-                    std::cout << "SCHED_OTHER";
-                    break;
-                default:
-                    std::cout << "UNKNOWN";
-            }
-            std::cout << ", Priority: " << param.sched_priority << std::endl;
-
-        /* Calculate the time taken and adjust the sleep duration accordingly */
-        auto elapsed_time   = std::chrono::steady_clock::now() - start_time;
-        auto remaining_time = std::chrono::milliseconds(kRunningCycle) - elapsed_time;
-
-        if (remaining_time > std::chrono::milliseconds(0)) {
-
-            thread_running = !shutdown_notifier_.wait_for(lock, remaining_time, [this]() { 
-                return turn_off_requested_.load(); 
-            });
-
-        } else {
-
-            std::cout << "[demo mngr][WARN] Manager took more than the configured time: "
-                            << kRunningCycle
-                            << " ms"
-                            << " and the execution,"
-                            << " time taken is: "
-                            << std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(elapsed_time).count())
-                            << " ms.";
-
-            thread_running = !turn_off_requested_.load();
+        /* Dispatch the cycle metrics reports until the graceful shutdown handler stops the loop */
+        auto const report_interval = std::chrono::milliseconds(running_cycle_ms) * kMetricsReportCycles;
+        if ((event_loop_.AddTimer(report_interval, &DemoManager::MetricsReportHandler, this) !=
+             ara::os::interface::event::ErrorCode::Success) ||
+            (event_loop_.Run() != ara::os::interface::event::ErrorCode::Success)) {
 
+            kLogger.LogError("Manager event loop failed, shutting down.");
+            exit_code = EXIT_FAILURE;
         }
 
-        
-    } while (thread_running);
+        executive_.Stop();
+        ReportCycleMetrics();
+    }
+
+    /* Orderly shutdown: the supervisor shows the cycle as deactivated instead of expired */
+    supervised_cycle_.Deactivate();
+    heartbeat_segment_.Close();
 
     TerminateDemoManager();
     
@@ -256,11 +340,7 @@ auto DemoManager::RunManager() noexcept -> std::uint8_t {
  */
 auto DemoManager::TerminateDemoManager() noexcept -> void {
 
-    if (graceful_shutdown_handler_thread_.joinable()) {
-
-        graceful_shutdown_handler_thread_.join();
-    }
-
+    event_loop_.Close();
 }
 
 } // namespace manager
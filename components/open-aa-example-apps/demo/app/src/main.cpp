@@ -19,16 +19,27 @@
  *  INCLUDES
  *********************************************************************************************************************/
 
-#include <iostream>                     // For std::cout and std::cerr
 #include <csignal>                      // For signal mask
 #include <algorithm>                    // For std::all_of
 #include <optional>                     // For std::optional
 #include <functional>                   // For std::reference_wrapper
+#include <cstdlib>                      // For std::strtoul
+
 
 #include "ara/core/array.h"             // For platform core Array class
+#include "ara/core/initialization.h"    // For ara::core::Initialize / Deinitialize
+#include "ara/log/logger.h"             // For the ara::log Logger
+#include "ara/log/log_backend.h"        // For the asynchronous ara::log LogBackend
+#include "ara/os/interface/thread/thread.h" // For the thread name and the CPU affinity of the manager cycle
 #include "demo/manager/demo_manager.h"  // For manager class
 
 namespace demo {
+
+/*!
+ * \brief Logger of the demo main thread.
+ */
+constexpr ara::log::Logger kLogger{"demo main"};
+
 namespace sighandle {
 
 /*!
@@ -112,26 +123,119 @@ static auto InitilizeSigHandlerMask() noexcept -> void {
     
     if(!success) {
 
-        std::cerr << "[demo main][FATAL] Initialize signal handling failed." << std::endl;
+        kLogger.LogFatal("Initialize signal handling failed.");
         std::abort();
     }
 
 }
 
 } // namespace sighandle
+
+namespace config {
+
+/*!
+ * \brief Reads the running cycle in milliseconds from the first command line argument.
+ *
+ * \return The configured cycle, or DemoManager::kDefaultRunningCycle if no valid (non-zero) value is given.
+ */
+static auto ReadRunningCycle(int argc, char** argv) noexcept -> std::uint32_t {
+
+    std::uint32_t running_cycle_ms{demo::manager::DemoManager::kDefaultRunningCycle};
+
+    if (argc > 1) {
+
+        char* end{nullptr};
+        unsigned long const value = std::strtoul(argv[1], &end, 10);
+
+        if ((end != argv[1]) && (*end == '\0') && (value > 0UL) && (value <= 0xFFFFFFFFUL)) {
+
+            running_cycle_ms = static_cast<std::uint32_t>(value);
+
+        } else {
+
+            kLogger.LogWarn("Invalid running cycle '{}', using {} ms.", argv[1], running_cycle_ms);
+        }
+    }
+
+    return running_cycle_ms;
+}
+
+/*!
+ * \brief Reads the CPU the manager cycle is pinned to from the second command line argument.
+ *
+ * \return A set with that CPU, or an empty set (not pinned) if no valid CPU index is given.
+ */
+static auto ReadCycleAffinity(int argc, char** argv) noexcept -> ara::os::interface::thread::CpuSet {
+
+    ara::os::interface::thread::CpuSet affinity{};
+
+    if (argc > 2) {
+
+        char* end{nullptr};
+        unsigned long const value = std::strtoul(argv[2], &end, 10);
+        std::size_t const cpu_count = ara::os::interface::thread::Thread::GetCpuCount();
+
+        if ((end != argv[2]) && (*end == '\0') && (value < cpu_count) && affinity.Add(value)) {
+
+            kLogger.LogInfo("Manager cycle pinned to CPU {}.", static_cast<std::uint32_t>(value));
+
+        } else {
+
+            kLogger.LogWarn("Invalid CPU '{}' (CPUs: {}), the manager cycle is not pinned.", argv[2], cpu_count);
+        }
+    }
+
+    return affinity;
+}
+
+} // namespace config
 } // namespace demo
 
 
-int main() {
+int main(int argc, char** argv) {
 
     /*Set main thread name for debugging*/
-    pthread_setname_np(pthread_self(), "demo_main");
+    static_cast<void>(ara::os::interface::thread::Thread::SetCurrentName("demo_main"));
 
     demo::sighandle::InitilizeSigHandlerMask();
 
-    // ara::core::Initialize
+    /*Initialize after the signal mask is set: the log backend thread inherits the mask*/
+    ara::log::BackendConfig log_config{};
+    log_config.mode  = ara::log::LogMode::kConsole;
+    log_config.level = ara::log::LogLevel::kInfo;
+
+    /*One pinned worker per CPU but the first, which stays with the main thread*/
+    ara::core::ExecutorConfig executor_config{};
+
+    /*Flight recorder dumps to stderr, also on SIGSEGV, SIGBUS, SIGFPE, SIGILL and SIGABRT*/
+    ara::core::FlightRecorderConfig flight_recorder_config{};
+
+    ara::core::InitConfig init_config{};
+    init_config.logBackend     = &log_config;
+    init_config.executor       = &executor_config;
+    init_config.flightRecorder = &flight_recorder_config;
+    ara::core::InitErrorCode const init_result = ara::core::Initialize(init_config);
+    if (init_result == ara::core::InitErrorCode::LogBackendFailed) {
+
+        demo::kLogger.LogWarn("Asynchronous log backend not started, logging synchronously.");
+    }
+    else if (init_result == ara::core::InitErrorCode::ExecutorFailed) {
+
+        demo::kLogger.LogWarn("Executor workers not started, parallel algorithms run serially.");
+    }
+    else if (init_result == ara::core::InitErrorCode::FlightRecorderFailed) {
+
+        demo::kLogger.LogWarn("Flight recorder crash handlers not installed, only violations are dumped.");
+    }
+    else if (init_result != ara::core::InitErrorCode::Success) {
+
+        demo::kLogger.LogWarn("ara::core::Initialize failed with code: {}", static_cast<std::uint8_t>(init_result));
+    }
+
+    demo::kLogger.LogInfo("main thread started.");
 
-    std::cout << "[demo main][INFO] main thread started." << std::endl;
+    std::uint32_t const running_cycle_ms = demo::config::ReadRunningCycle(argc, argv);
+    ara::os::interface::thread::CpuSet const cycle_affinity = demo::config::ReadCycleAffinity(argc, argv);
 
     std::uint8_t exit_code{EXIT_FAILURE};
     {
@@ -141,18 +245,19 @@ int main() {
         if (managerOpt.has_value()) {
             demo::manager::DemoManager& manager = managerOpt.value().get();
 
-            exit_code = manager.RunManager();
+            exit_code = manager.RunManager(running_cycle_ms, cycle_affinity);
 
-            std::cout << "[demo main][INFO] Manager exited with code: " << static_cast<int>(exit_code) << std::endl;
+            demo::kLogger.LogInfo("Manager exited with code: {}", exit_code);
         }
         else {
-            std::cerr << "[demo main][ERROR] Failed to start DemoManager: Instance already created and exclusively owned." << std::endl;
+            demo::kLogger.LogError("Failed to start DemoManager: Instance already created and exclusively owned.");
         }
     }
 
-    // ara::core::Deinitialize
+    demo::kLogger.LogInfo("main thread finished.");
 
-    std::cout << "[demo main][INFO] main thread finished." << std::endl;
+    /*Join the executor workers, write the pending messages, stop the backend thread and unlock the memory*/
+    static_cast<void>(ara::core::Deinitialize());
 
     return exit_code;
 }
\ No newline at end of file
@@ -0,0 +1,268 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project (CXX_STANDARD 17)
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara/os/interface/event/event_loop.h
+ *  \brief      Declaration of the ara::os::interface::event::EventLoop.
+ *
+ *  \details    An EventLoop dispatches shutdown signals, periodic timers and descriptor readiness from the single
+ *              thread calling Run(). Each source is registered with a handler and a context; the handlers run one
+ *              after the other on that thread, so they need no locking among themselves. One loop thread replaces a
+ *              thread per blocking wait (sigwait, sleep, read) and the hand-over between them.
+ *
+ *              Other threads hand work to the loop thread with Post(): the task is queued in a fixed array and the
+ *              wait is woken, so the task runs on the loop thread after the handlers of that wake-up.
+ *
+ *  \note       Sources are registered while the loop is not running; no heap allocation happens at any point.
+ ***********************************************************************************************************************/
+
+#ifndef OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_OS_INTERFACE_EVENT_EVENT_LOOP_H_
+#define OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_OS_INTERFACE_EVENT_EVENT_LOOP_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+/*!
+ * \brief  Includes the Reactor interface header.
+ */
+#include "ara/os/interface/event/reactor.h"
+
+// Include platform-specific headers for the static Reactor backends
+#if defined(__linux__)
+    #include "ara/os/linux/event/reactor.h" // Linux-specific ReactorImpl
+#elif defined(__QNXNTO__)
+    #include "ara/os/qnx/event/reactor.h"   // QNX-specific ReactorImpl
+#else
+    /* Unsupported platform: Generate a compile-time error */
+    #error "Unsupported platform. No Reactor backend is available."
+#endif
+
+#include <atomic>       // For std::atomic
+#include <chrono>       // For std::chrono::nanoseconds
+#include <cstddef>      // For std::size_t
+#include <cstdint>      // For fixed-width integer types
+
+namespace ara {
+namespace os {
+namespace interface {
+namespace event {
+
+/**********************************************************************************************************************
+ *  TYPE ALIAS: PlatformReactor
+ *********************************************************************************************************************/
+/*!
+ * \brief  The static Reactor backend of the target platform, selected at compile time.
+ */
+#if defined(__linux__)
+using PlatformReactor = ara::os::linux::event::ReactorImpl;
+#elif defined(__QNXNTO__)
+using PlatformReactor = ara::os::qnx::event::ReactorImpl;
+#endif
+
+/**********************************************************************************************************************
+ *  ENUM: SourceKind
+ *********************************************************************************************************************/
+/*!
+ * \brief  Kind of an event source.
+ */
+enum class SourceKind : uint8_t {
+    Signal = 0,     /*!< Delivery of a signal to the process */
+    Timer,          /*!< Expiry of a periodic monotonic timer */
+    Descriptor      /*!< Readiness of a file descriptor */
+};
+
+/**********************************************************************************************************************
+ *  STRUCT: Event
+ *********************************************************************************************************************/
+/*!
+ * \brief  Information passed to the handler of a source.
+ *
+ * \details The value depends on the kind: the signal number, the number of timer expirations since the last
+ *          dispatch (more than 1 if the loop was late), or the Readiness flags of the descriptor.
+ */
+struct Event {
+    std::size_t   source{0U};               /*!< Index of the source, in registration order */
+    SourceKind    kind{SourceKind::Signal}; /*!< Kind of the source */
+    std::uint64_t value{0U};                /*!< Kind-specific value (see above) */
+};
+
+/**********************************************************************************************************************
+ *  TYPE ALIAS: EventHandler
+ *********************************************************************************************************************/
+/*!
+ * \brief  Handler of a source. Invoked on the thread running the loop with the configured context.
+ */
+using EventHandler = void (*)(void* context, const Event& event) noexcept;
+
+/**********************************************************************************************************************
+ *  TYPE ALIAS: PostedTask
+ *********************************************************************************************************************/
+/*!
+ * \brief  Task handed to the loop thread with EventLoop::Post(). Invoked once with the given context.
+ */
+using PostedTask = void (*)(void* context) noexcept;
+
+/**********************************************************************************************************************
+ *  CLASS: EventLoop
+ *********************************************************************************************************************/
+/*!
+ * \brief  Single-threaded dispatcher of signals, timers and descriptor readiness.
+ *
+ * \details
+ * - Add*() is only allowed while the loop is not running; the first call opens the platform reactor.
+ * - Run() dispatches until Stop() is called (from a handler, another thread or a signal handler). A Stop() issued
+ *   before Run() makes the next Run() return at once, so a stop request is never lost.
+ * - Signals must be blocked in every thread of the process, e.g. by setting the mask in main() before any thread is
+ *   created; AddSignal() blocks them in the calling thread.
+ * - Not copyable or movable: the platform reactor owns OS resources.
+ */
+class EventLoop final {
+public:
+    /*!
+     * \brief  Maximum number of sources per loop.
+     */
+    static constexpr std::size_t kMaxSources{ara::os::interface::event::kMaxSources};
+
+    /*!
+     * \brief  Maximum number of posted tasks waiting for the loop thread.
+     */
+    static constexpr std::size_t kMaxPostedTasks{64U};
+
+    EventLoop() noexcept = default;
+
+    /*!
+     * \brief  Releases the OS resources (see Close()).
+     */
+    ~EventLoop() noexcept;
+
+    EventLoop(const EventLoop&) = delete;
+    EventLoop(EventLoop&&) = delete;
+    auto operator=(const EventLoop&) -> EventLoop& = delete;
+    auto operator=(EventLoop&&) -> EventLoop& = delete;
+
+    /*!
+     * \brief  Dispatches \c signalNumber to \c handler (Event::value: the signal number).
+     *
+     * \return ErrorCode::Success, InvalidArgument, CapacityExceeded, AlreadyRunning or ResourceFailure.
+     */
+    auto AddSignal(int signalNumber, EventHandler handler, void* context) noexcept -> ErrorCode;
+
+    /*!
+     * \brief  Dispatches the expiries of a periodic timer to \c handler, the first one \c period after the call.
+     *
+     * \return ErrorCode::Success, InvalidArgument, CapacityExceeded, AlreadyRunning or ResourceFailure.
+     */
+    auto AddTimer(std::chrono::nanoseconds period, EventHandler handler, void* context) noexcept -> ErrorCode;
+
+    /*!
+     * \brief  Dispatches the readiness of \c descriptor for \c interest (Readiness::kReadable / kWritable) to
+     *         \c handler. Level-triggered: the handler is called again while the condition is not consumed.
+     *
+     * \return ErrorCode::Success, InvalidArgument, CapacityExceeded, AlreadyRunning or ResourceFailure.
+     */
+    auto AddDescriptor(int descriptor, std::uint32_t interest, EventHandler handler, void* context) noexcept
+        -> ErrorCode;
+
+    /*!
+     * \brief  Waits for and dispatches events on the calling thread until Stop() is called.
+     *
+     * \return ErrorCode::Success after Stop(), InvalidArgument (no source), AlreadyRunning, or WaitFailure.
+     */
+    auto Run() noexcept -> ErrorCode;
+
+    /*!
+     * \brief  Waits at most \c timeout for events and dispatches them once (a negative timeout waits without limit).
+     *
+     * \return ErrorCode::Success (also when nothing was ready), InvalidArgument (no source), AlreadyRunning, or
+     *         WaitFailure.
+     */
+    auto RunOnce(std::chrono::nanoseconds timeout) noexcept -> ErrorCode;
+
+    /*!
+     * \brief  Makes Run() return after the handler being dispatched. Async-signal-safe, callable from any thread.
+     */
+    auto Stop() noexcept -> void;
+
+    /*!
+     * \brief  Queues task(context) for the loop thread and wakes its wait. Callable from any thread (not from a
+     *         signal handler); tasks posted before Run() run after its first wait.
+     *
+     * \return \c false if \c task is nullptr or kMaxPostedTasks tasks are already waiting.
+     */
+    auto Post(PostedTask task, void* context) noexcept -> bool;
+
+    /*!
+     * \brief  Whether a thread is in Run() or RunOnce().
+     */
+    auto IsRunning() const noexcept -> bool;
+
+    /*!
+     * \brief  Number of registered sources.
+     */
+    auto GetSourceCount() const noexcept -> std::size_t;
+
+    /*!
+     * \brief  Releases the OS resources and forgets all sources and posted tasks. Must not be called while running.
+     */
+    auto Close() noexcept -> void;
+
+private:
+    /*!
+     * \brief  A registered source.
+     */
+    struct Source {
+        SourceKind   kind{SourceKind::Signal};
+        EventHandler handler{nullptr};
+        void*        context{nullptr};
+    };
+
+    /*!
+     * \brief  Checks the common preconditions of Add*() and opens the reactor on first use.
+     */
+    auto PrepareAdd(EventHandler handler) noexcept -> ErrorCode;
+
+    /*!
+     * \brief  Stores the source registered by the reactor as the next index.
+     */
+    auto CommitSource(SourceKind kind, EventHandler handler, void* context) noexcept -> void;
+
+    /*!
+     * \brief  A task queued by Post().
+     */
+    struct Posted {
+        PostedTask task{nullptr};
+        void*      context{nullptr};
+    };
+
+    /*!
+     * \brief  One wait and the dispatch of its events.
+     */
+    auto WaitAndDispatch(std::chrono::nanoseconds timeout) noexcept -> ErrorCode;
+
+    /*!
+     * \brief  Runs the tasks posted so far, in posting order.
+     */
+    auto RunPosted() noexcept -> void;
+
+    PlatformReactor            reactor_{};
+    Source                     sources_[kMaxSources]{};
+    std::size_t                sourceCount_{0U};
+    bool                       open_{false};
+    std::atomic<bool>          running_{false};
+    std::atomic<bool>          stopRequested_{false};
+    Posted                     posted_[kMaxPostedTasks]{};
+    std::size_t                postedCount_{0U};
+    std::atomic_flag           postLock_ = ATOMIC_FLAG_INIT;
+};
+
+} // namespace event
+} // namespace interface
+} // namespace os
+} // namespace ara
+
+#endif // OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_OS_INTERFACE_EVENT_EVENT_LOOP_H_
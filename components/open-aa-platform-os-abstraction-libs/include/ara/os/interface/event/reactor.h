@@ -0,0 +1,205 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project (CXX_STANDARD 17)
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara/os/interface/event/reactor.h
+ *  \brief      Definition of the ara::os::interface::event::Reactor static (CRTP) interface.
+ *
+ *  \details    A Reactor demultiplexes several event sources (signals, periodic timers and descriptor readiness) onto
+ *              one waiting thread. Each source is identified by the index it was registered with; a wait returns the
+ *              ready sources as ReadyEvent records, and the caller dispatches them.
+ *
+ *  \note       Platform backends derive from Reactor<Backend> (Linux: epoll with signalfd, timerfd and eventfd, QNX:
+ *              pulses on a private channel received with MsgReceivePulse). No virtual dispatch and no heap allocation
+ *              is involved.
+ ***********************************************************************************************************************/
+
+#ifndef OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_OS_INTERFACE_EVENT_REACTOR_H_
+#define OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_OS_INTERFACE_EVENT_REACTOR_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <chrono>       // For std::chrono::nanoseconds
+#include <cstddef>      // For std::size_t
+#include <cstdint>      // For fixed-width integer types
+
+namespace ara {
+namespace os {
+namespace interface {
+namespace event {
+
+/**********************************************************************************************************************
+ *  ENUM: ErrorCode
+ *********************************************************************************************************************/
+/*!
+ * \brief  Enumeration of possible error codes for the reactor and event loop operations.
+ */
+enum class ErrorCode : uint8_t {
+    Success = 0,                   /*!< Operation completed successfully */
+    InvalidArgument,               /*!< A value is out of range (e.g., period <= 0, no handler, invalid signal) */
+    CapacityExceeded,              /*!< No free source slot is left */
+    AlreadyRunning,                /*!< The operation is not allowed while the event loop is running */
+    ResourceFailure,               /*!< Creating or registering an OS object (descriptor, channel, timer) failed */
+    WaitFailure,                   /*!< Waiting for or reading the ready sources failed */
+    UnknownError                   /*!< An unknown error occurred */
+};
+
+/**********************************************************************************************************************
+ *  CONSTANTS
+ *********************************************************************************************************************/
+/*!
+ * \brief  Maximum number of sources per reactor.
+ */
+constexpr std::size_t kMaxSources{16U};
+
+/*!
+ * \brief  Readiness flags of a descriptor source: requested interest and reported readiness.
+ */
+struct Readiness {
+    static constexpr std::uint32_t kReadable{0x1U};  /*!< Data can be read without blocking */
+    static constexpr std::uint32_t kWritable{0x2U};  /*!< Data can be written without blocking */
+    static constexpr std::uint32_t kHangUp{0x4U};    /*!< The peer closed its end (reported only) */
+    static constexpr std::uint32_t kError{0x8U};     /*!< An error is pending on the descriptor (reported only) */
+};
+
+/**********************************************************************************************************************
+ *  STRUCT: ReadyEvent
+ *********************************************************************************************************************/
+/*!
+ * \brief  One ready source, as returned by Reactor::Wait().
+ *
+ * \details The value depends on the kind of the source:
+ * - signal:     the signal number;
+ * - timer:      the number of expirations since the last report (at least 1);
+ * - descriptor: the Readiness flags.
+ */
+struct ReadyEvent {
+    std::uint32_t source{0U};   /*!< Index the source was registered with */
+    std::uint64_t value{0U};    /*!< Kind-specific value (see above) */
+};
+
+/**********************************************************************************************************************
+ *  CLASS: Reactor
+ *********************************************************************************************************************/
+/*!
+ * \brief  Static (CRTP) interface of an event demultiplexer.
+ *
+ * \tparam Backend  The platform backend deriving from Reactor<Backend>.
+ *
+ * \details
+ * - Backend must provide:
+ *   - auto OpenImpl() noexcept -> ErrorCode;
+ *   - auto WatchSignalImpl(std::uint32_t source, int signalNumber) noexcept -> ErrorCode;
+ *   - auto WatchTimerImpl(std::uint32_t source, std::chrono::nanoseconds period) noexcept -> ErrorCode;
+ *   - auto WatchDescriptorImpl(std::uint32_t source, int descriptor, std::uint32_t interest) noexcept -> ErrorCode;
+ *   - auto WaitImpl(ReadyEvent* events, std::size_t capacity, std::chrono::nanoseconds timeout,
+ *                   std::size_t& count) noexcept -> ErrorCode;
+ *   - auto WakeImpl() noexcept -> void;
+ *   - auto CloseImpl() noexcept -> void;
+ * - Sources are numbered by the caller in [0, kMaxSources); each number is registered once.
+ * - One thread waits on a reactor at a time. Wake() may be called from any thread and from a signal handler while
+ *   the reactor is open; all other calls must not race with Wait().
+ */
+template <typename Backend>
+class Reactor {
+public:
+    /*!
+     * \brief  Acquires the OS resources of the reactor.
+     *
+     * \return ErrorCode::Success, or ErrorCode::ResourceFailure.
+     */
+    auto Open() noexcept -> ErrorCode
+    {
+        return static_cast<Backend&>(*this).OpenImpl();
+    }
+
+    /*!
+     * \brief  Reports the delivery of \c signalNumber to the process as source \c source.
+     *
+     * \return ErrorCode::Success, InvalidArgument or ResourceFailure.
+     *
+     * \note   The signal must be blocked in every thread of the process (inherit the mask from main()); otherwise
+     *         it may be delivered to another thread with its default action.
+     */
+    auto WatchSignal(std::uint32_t source, int signalNumber) noexcept -> ErrorCode
+    {
+        return static_cast<Backend&>(*this).WatchSignalImpl(source, signalNumber);
+    }
+
+    /*!
+     * \brief  Reports the expirations of a periodic monotonic timer as source \c source (first expiry after one
+     *         period).
+     *
+     * \return ErrorCode::Success, InvalidArgument or ResourceFailure.
+     */
+    auto WatchTimer(std::uint32_t source, std::chrono::nanoseconds period) noexcept -> ErrorCode
+    {
+        return static_cast<Backend&>(*this).WatchTimerImpl(source, period);
+    }
+
+    /*!
+     * \brief  Reports the readiness of \c descriptor for \c interest (Readiness::kReadable / kWritable) as source
+     *         \c source. The descriptor stays owned by the caller and must outlive the registration.
+     *
+     * \return ErrorCode::Success, InvalidArgument or ResourceFailure.
+     *
+     * \note   Readiness is level-triggered: it is reported by every Wait() until the condition is consumed.
+     */
+    auto WatchDescriptor(std::uint32_t source, int descriptor, std::uint32_t interest) noexcept -> ErrorCode
+    {
+        return static_cast<Backend&>(*this).WatchDescriptorImpl(source, descriptor, interest);
+    }
+
+    /*!
+     * \brief  Blocks until at least one source is ready, Wake() is called or \c timeout elapses.
+     *
+     * \param[out] events    Receives up to \c capacity ready sources.
+     * \param[in]  capacity  Size of \c events.
+     * \param[in]  timeout   Maximum time to block; a negative value blocks without limit, zero only polls.
+     * \param[out] count     Number of entries written to \c events (0 after a timeout, a wake-up or a signal
+     *                       interruption).
+     *
+     * \return ErrorCode::Success, ErrorCode::ResourceFailure (reactor not open), or ErrorCode::WaitFailure.
+     */
+    auto Wait(ReadyEvent* events, std::size_t capacity, std::chrono::nanoseconds timeout, std::size_t& count) noexcept
+        -> ErrorCode
+    {
+        return static_cast<Backend&>(*this).WaitImpl(events, capacity, timeout, count);
+    }
+
+    /*!
+     * \brief  Makes the current (or the next) Wait() return. Async-signal-safe.
+     */
+    auto Wake() noexcept -> void
+    {
+        static_cast<Backend&>(*this).WakeImpl();
+    }
+
+    /*!
+     * \brief  Releases the OS resources of the reactor and forgets all sources. Safe to call on a closed reactor.
+     */
+    auto Close() noexcept -> void
+    {
+        static_cast<Backend&>(*this).CloseImpl();
+    }
+
+protected:
+    /*!
+     * \brief  Protected constructor and destructor: Reactor is only used as a CRTP base.
+     */
+    constexpr Reactor() noexcept = default;
+    ~Reactor() = default;
+};
+
+} // namespace event
+} // namespace interface
+} // namespace os
+} // namespace ara
+
+#endif // OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_OS_INTERFACE_EVENT_REACTOR_H_
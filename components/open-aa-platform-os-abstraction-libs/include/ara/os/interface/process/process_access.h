@@ -0,0 +1,120 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project (CXX_STANDARD 17)
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara/os/interface/process/process_access.h
+ *  \brief      Definition of the ara::os::interface::process::ProcessAccess static (CRTP) interface.
+ *
+ *  \details    This file defines the compile-time counterpart of the ProcessInteraction interface. Platform backends
+ *              derive from ProcessAccess<Backend> and provide static *Impl functions; callers reach the backend
+ *              through ProcessAccess<Backend> without a heap allocation or a virtual call.
+ *
+ *              GetResourceUsage() (RSS, context switches, page faults, CPU time) is only offered on this static
+ *              path: it is polled periodically by ProcessStats and has no virtual counterpart.
+ *
+ *  \note       The virtual ProcessInteraction interface remains available for code that needs run-time polymorphism
+ *              (e.g., mocking in tests). Both paths share the same platform implementation.
+ ***********************************************************************************************************************/
+
+#ifndef OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_OS_INTERFACE_PROCESS_PROCESS_ACCESS_H_
+#define OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_OS_INTERFACE_PROCESS_PROCESS_ACCESS_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+/*!
+ * \brief  Includes the ProcessInteraction interface header for the shared ErrorCode definition.
+ */
+#include "ara/os/interface/process/process_interaction.h"
+
+#include <cstddef>      // For std::size_t
+#include <cstdint>      // For std::uint64_t
+
+namespace ara {
+namespace os {
+namespace interface {
+namespace process {
+
+/**********************************************************************************************************************
+ *  STRUCT: ResourceUsage
+ *********************************************************************************************************************/
+/*!
+ * \brief  Resource usage of the current process, as accumulated by the kernel since the process started.
+ *
+ * \details
+ * Counters the platform does not maintain are reported as 0 (e.g., the context switches on QNX).
+ */
+struct ResourceUsage {
+    std::uint64_t residentBytes{0U};               /*!< Resident set size (memory currently backed by RAM) */
+    std::uint64_t voluntaryContextSwitches{0U};    /*!< The process blocked or yielded */
+    std::uint64_t involuntaryContextSwitches{0U};  /*!< The process was preempted */
+    std::uint64_t minorPageFaults{0U};             /*!< Faults served without I/O (first touch, copy on write) */
+    std::uint64_t majorPageFaults{0U};             /*!< Faults that needed I/O */
+    std::uint64_t cpuTimeNs{0U};                   /*!< CPU time of all threads (user and system) */
+};
+
+/**********************************************************************************************************************
+ *  CLASS: ProcessAccess
+ *********************************************************************************************************************/
+/*!
+ * \brief  Static (CRTP) interface for process-related functionalities.
+ *
+ * \tparam Backend  The platform backend deriving from ProcessAccess<Backend>.
+ *
+ * \details
+ * - Backend must provide: static auto GetProcessNameImpl(char*, std::size_t) noexcept -> ErrorCode and
+ *                         static auto GetResourceUsageImpl(ResourceUsage&) noexcept -> ErrorCode.
+ * - All functions are static: there is no object to allocate and no vtable to dispatch through.
+ * - Implementations must ensure thread safety, as for ProcessInteraction.
+ */
+template <typename Backend>
+class ProcessAccess {
+public:
+    /*!
+     * \brief  Retrieves the name of the current process.
+     *
+     * \param[out] buffer      Pointer to the buffer where the process name will be stored.
+     * \param[in]  bufferSize  Size of the provided buffer in bytes.
+     *
+     * \return An ara::os::interface::process::ErrorCode indicating the result of the operation.
+     *
+     * \note   The process name is null-terminated if successfully retrieved.
+     */
+    static auto GetProcessName(char* buffer, std::size_t bufferSize) noexcept -> ErrorCode
+    {
+        return Backend::GetProcessNameImpl(buffer, bufferSize);
+    }
+
+    /*!
+     * \brief  Reads the resource usage of the current process.
+     *
+     * \param[out] usage  Receives the counters; unchanged on a failure.
+     *
+     * \return ErrorCode::Success, or RetrievalFailed if the kernel could not be queried.
+     *
+     * \note   No heap allocation; reads kernel counters (and, on Linux, /proc/self/statm) with raw system calls.
+     */
+    static auto GetResourceUsage(ResourceUsage& usage) noexcept -> ErrorCode
+    {
+        return Backend::GetResourceUsageImpl(usage);
+    }
+
+protected:
+    /*!
+     * \brief  Protected constructor and destructor: ProcessAccess is only used as a CRTP base.
+     */
+    constexpr ProcessAccess() noexcept = default;
+    ~ProcessAccess() = default;
+};
+
+} // namespace process
+} // namespace interface
+} // namespace os
+} // namespace ara
+
+#endif // OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_OS_INTERFACE_PROCESS_PROCESS_ACCESS_H_
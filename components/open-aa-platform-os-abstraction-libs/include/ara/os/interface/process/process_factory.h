@@ -11,7 +11,8 @@
  *  \brief      Declaration of the ara::os::interface::process::ProcessFactory.
  *
  *  \details    This file declares the ara::os::interface::process::ProcessFactory class responsible for creating
- *              platform-specific instances of the ProcessInteraction interface.
+ *              platform-specific instances of the ProcessInteraction interface, and the PlatformProcessAccess alias
+ *              that resolves the static (CRTP) backend for the target platform at compile time.
  *
  *  \note       This facilitates the OS abstraction by hiding platform-specific details from the client.
  ***********************************************************************************************************************/
@@ -27,6 +28,16 @@
  */
 #include "ara/os/interface/process/process_interaction.h"
 
+// Include platform-specific headers for the static ProcessAccess backends
+#if defined(__linux__)
+    #include "ara/os/linux/process/process.h" // Linux-specific ProcessAccessImpl
+#elif defined(__QNXNTO__)
+    #include "ara/os/qnx/process/process.h"   // QNX-specific ProcessAccessImpl
+#else
+    /* Unsupported platform: Generate a compile-time error */
+    #error "Unsupported platform. No ProcessAccess backend is available."
+#endif
+
 #include <memory> // For std::unique_ptr
 
 namespace ara {
@@ -34,6 +45,23 @@ namespace os {
 namespace interface {
 namespace process {
 
+/**********************************************************************************************************************
+ *  TYPE ALIAS: PlatformProcessAccess
+ *********************************************************************************************************************/
+/*!
+ * \brief  The static ProcessAccess backend of the target platform, selected at compile time.
+ *
+ * \details
+ * - Use PlatformProcessAccess::GetProcessName(...) on hot or allocation-sensitive paths: it compiles to a direct
+ *   call into the Linux or QNX implementation, without heap allocation and without virtual dispatch.
+ * - Use ProcessFactory::CreateInstance() where a ProcessInteraction object is needed (e.g., to inject a mock).
+ */
+#if defined(__linux__)
+using PlatformProcessAccess = ara::os::linux::process::ProcessAccessImpl;
+#elif defined(__QNXNTO__)
+using PlatformProcessAccess = ara::os::qnx::process::ProcessAccessImpl;
+#endif
+
 /**********************************************************************************************************************
  *  CLASS: ProcessFactory
  *********************************************************************************************************************/
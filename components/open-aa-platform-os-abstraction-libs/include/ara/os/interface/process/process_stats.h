@@ -0,0 +1,340 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project (CXX_STANDARD 17)
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara/os/interface/process/process_stats.h
+ *  \brief      Definition of the ara::os::interface::process::ProcessStats snapshot service.
+ *
+ *  \details    ProcessStats keeps the vital statistics of the process in one ProcessStatsSnapshot:
+ *              - pid and name,
+ *              - resident memory, context switches, page faults and CPU time (ProcessAccess::GetResourceUsage),
+ *              - the CPU time of every managed thread registered with RegisterThread(),
+ *              - the near-miss counters: operations that were refused without a Violation (a try_push_back() on a
+ *                full InplaceVector, a memory resource returning nullptr), which ara::core records with
+ *                RecordNearMiss(). Violations themselves abort the process and cannot be counted afterwards.
+ *
+ *              Sample() gathers the statistics and publishes them through a SeqLock; Start() runs Sample()
+ *              periodically on a SCHED_OTHER sampler thread, so the real-time threads never pay for it. Load()
+ *              copies the latest snapshot without a lock, a system call or a kernel query; readers never block the
+ *              sampler. The SeqLock may live in a SharedMemory segment, so that a monitor process reads the
+ *              statistics of every process without /proc, top or pidin.
+ *
+ *  \note       [SWS_CORE_00040] (No exceptions used – failures are reported by ProcessStatsErrorCode).
+ ***********************************************************************************************************************/
+
+#ifndef OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_OS_INTERFACE_PROCESS_PROCESS_STATS_H_
+#define OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_OS_INTERFACE_PROCESS_PROCESS_STATS_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include "ara/os/interface/process/process_access.h"  // For ResourceUsage
+#include "ara/os/interface/shm/seqlock.h"             // For SeqLock
+#include "ara/os/interface/thread/thread.h"           // For Thread, CpuSet
+#include "ara/os/interface/timer/cyclic_executive.h"  // For PlatformDeadlineTimer
+
+#include <atomic>       // For std::atomic
+#include <chrono>       // For std::chrono::milliseconds
+#include <cstddef>      // For std::size_t
+#include <cstdint>      // For std::int32_t, std::uint64_t
+#include <mutex>        // For std::mutex
+#include <pthread.h>    // For pthread_t
+#include <time.h>       // For clockid_t
+
+namespace ara {
+namespace os {
+namespace interface {
+namespace process {
+
+/**********************************************************************************************************************
+ *  CONSTANTS
+ *********************************************************************************************************************/
+/*!
+ * \brief  Managed threads a ProcessStats reports.
+ */
+constexpr std::size_t kMaxManagedThreads{16U};
+
+/*!
+ * \brief  Capacity of the process name in a snapshot, including the null terminator.
+ */
+constexpr std::size_t kProcessNameCapacity{32U};
+
+/*!
+ * \brief  Capacity of a thread name in a snapshot, including the null terminator (the Linux limit).
+ */
+constexpr std::size_t kThreadNameCapacity{16U};
+
+/*!
+ * \brief  Number of near-miss counters; indexed by the value of ara::core::internal::ViolationKind.
+ */
+constexpr std::size_t kNearMissKinds{8U};
+
+/**********************************************************************************************************************
+ *  ENUM: ProcessStatsErrorCode
+ *********************************************************************************************************************/
+/*!
+ * \brief  Result of the ProcessStats operations.
+ */
+enum class ProcessStatsErrorCode : std::uint8_t {
+    Success = 0,        /*!< Operation completed successfully */
+    InvalidArgument,    /*!< nullptr name, zero period or unknown thread handle */
+    TableFull,          /*!< kMaxManagedThreads threads are registered already */
+    AlreadyRegistered,  /*!< The thread is registered already */
+    NotRegistered,      /*!< The thread is not registered */
+    AlreadyRunning,     /*!< Start() was called while the sampler runs */
+    RetrievalFailed,    /*!< The platform could not report the resource usage */
+    ThreadFailure       /*!< The sampler thread or its deadline timer could not be started */
+};
+
+/**********************************************************************************************************************
+ *  STRUCT: ThreadStats
+ *********************************************************************************************************************/
+/*!
+ * \brief  Statistics of one managed thread.
+ *
+ * \details
+ * - cpuTimeNs: CPU time (user and system) the thread has consumed.
+ * - alive:     false once a thread registered with RegisterCurrentThread() has exited; cpuTimeNs then holds the CPU
+ *              time it had consumed when it exited.
+ */
+struct ThreadStats {
+    char          name[kThreadNameCapacity]{};
+    std::uint64_t cpuTimeNs{0U};
+    bool          alive{false};
+};
+
+/**********************************************************************************************************************
+ *  STRUCT: ProcessStatsSnapshot
+ *********************************************************************************************************************/
+/*!
+ * \brief  Statistics of the process at one sample (trivially copyable, published through a SeqLock).
+ *
+ * \details
+ * - sampleIndex:   Number of the sample (1 for the first one).
+ * - sampleTimeNs:  CLOCK_MONOTONIC time of the sample.
+ * - usage:         Counters of the whole process since it started.
+ * - threads:       The first threadCount entries are the registered threads, in registration order.
+ * - nearMisses:    Refused operations since the process started, indexed by ara::core::internal::ViolationKind
+ *                  (CapacityExceeded: full InplaceVector, OutOfMemory: exhausted memory resource).
+ */
+struct ProcessStatsSnapshot {
+    std::uint64_t sampleIndex{0U};
+    std::uint64_t sampleTimeNs{0U};
+    std::int32_t  pid{0};
+    char          name[kProcessNameCapacity]{};
+    ResourceUsage usage{};
+    std::uint32_t threadCount{0U};
+    ThreadStats   threads[kMaxManagedThreads]{};
+    std::uint64_t nearMisses[kNearMissKinds]{};
+};
+
+/**********************************************************************************************************************
+ *  STRUCT: ProcessStatsConfig
+ *********************************************************************************************************************/
+/*!
+ * \brief  Configuration of the sampler thread started by ProcessStats::Start().
+ *
+ * \details
+ * - period:    Interval between two samples (> 0).
+ * - affinity:  CPUs the sampler may run on; empty keeps the affinity of the caller. Pin it to a housekeeping CPU to
+ *              keep it off the cores of the real-time threads.
+ * - name:      Name of the sampler thread.
+ * The sampler always runs with SCHED_OTHER at the lowest priority of that policy.
+ */
+struct ProcessStatsConfig {
+    std::chrono::milliseconds          period{1000};
+    ara::os::interface::thread::CpuSet affinity{};
+    const char*                        name{"ara_stats"};
+};
+
+/**********************************************************************************************************************
+ *  FUNCTION: RecordNearMiss / GetNearMissCount
+ *********************************************************************************************************************/
+/*!
+ * \brief  Counts one refused operation of \c kind (a value of ara::core::internal::ViolationKind).
+ *
+ * \note   Wait-free (one relaxed atomic increment) and async-signal-safe; kinds >= kNearMissKinds are ignored.
+ */
+auto RecordNearMiss(std::uint8_t kind) noexcept -> void;
+
+/*!
+ * \brief  Refused operations of \c kind since the process started (0 for kinds >= kNearMissKinds).
+ */
+auto GetNearMissCount(std::uint8_t kind) noexcept -> std::uint64_t;
+
+/**********************************************************************************************************************
+ *  CLASS: ProcessStats
+ *********************************************************************************************************************/
+/*!
+ * \brief  Publishes ProcessStatsSnapshots of the current process, sampled on demand or by a low-priority thread.
+ *
+ * \details
+ * - Writers: Sample(), the sampler thread and the registration functions serialize on an internal mutex. Register
+ *   and unregister threads during setup and shutdown, not from a real-time cycle.
+ * - Readers: Load() and GetVersion() are lock-free and may run on any thread, at any priority.
+ * - The CPU clock of a thread is resolved at registration and names the thread by its kernel ID, which the kernel
+ *   reuses once the thread is gone. A failing clock therefore cannot tell that a thread exited:
+ *   - RegisterCurrentThread() installs an exit hook (a pthread key destructor) that takes the final CPU time of the
+ *     thread and reports it as not alive from then on, until it is unregistered.
+ *   - A thread registered by another thread with RegisterThread() must be unregistered before it is joined;
+ *     otherwise the snapshots may report the CPU time of an unrelated thread that reuses its ID.
+ * - Not copyable or movable: the sampler thread references the object.
+ */
+class ProcessStats final {
+public:
+    /*!
+     * \brief  The SeqLock the snapshots are published through.
+     */
+    using Publication = ara::os::interface::shm::SeqLock<ProcessStatsSnapshot>;
+
+    /*!
+     * \brief  Publishes into a SeqLock owned by this object.
+     */
+    ProcessStats() noexcept;
+
+    /*!
+     * \brief  Publishes into \c publication (e.g., placed in a SharedMemory segment with Emplace()), which must
+     *         outlive this object.
+     */
+    explicit ProcessStats(Publication& publication) noexcept;
+
+    /*!
+     * \brief  Stops the sampler thread.
+     */
+    ~ProcessStats() noexcept;
+
+    ProcessStats(const ProcessStats&) = delete;
+    ProcessStats(ProcessStats&&) = delete;
+    auto operator=(const ProcessStats&) -> ProcessStats& = delete;
+    auto operator=(ProcessStats&&) -> ProcessStats& = delete;
+
+    /*!
+     * \brief  Adds \c thread (running) as a managed thread named \c name (truncated to kThreadNameCapacity - 1).
+     *
+     * \return ProcessStatsErrorCode::Success, InvalidArgument, AlreadyRegistered (\c thread runs and is registered)
+     *         or TableFull.
+     *
+     * \note   Unregister \c thread before it is joined (see the class description).
+     */
+    auto RegisterThread(pthread_t thread, const char* name) noexcept -> ProcessStatsErrorCode;
+
+    /*!
+     * \brief  RegisterThread() for the calling thread, which is reported as not alive once it exits.
+     */
+    auto RegisterCurrentThread(const char* name) noexcept -> ProcessStatsErrorCode;
+
+    /*!
+     * \brief  Removes \c thread from the managed threads; the following snapshots no longer report it.
+     *
+     * \details If an exited thread and a running one registered later share the handle, the exited one is removed
+     *          first.
+     *
+     * \return ProcessStatsErrorCode::Success or NotRegistered.
+     */
+    auto UnregisterThread(pthread_t thread) noexcept -> ProcessStatsErrorCode;
+
+    /*!
+     * \brief  Gathers the statistics now and publishes them.
+     *
+     * \return ProcessStatsErrorCode::Success, or RetrievalFailed (nothing is published).
+     *
+     * \note   Queries the kernel; call it from a background thread, or let Start() do it.
+     */
+    auto Sample() noexcept -> ProcessStatsErrorCode;
+
+    /*!
+     * \brief  Starts the sampler thread, which publishes a first sample immediately and then one per period.
+     *
+     * \return ProcessStatsErrorCode::Success, InvalidArgument, AlreadyRunning or ThreadFailure.
+     */
+    auto Start(const ProcessStatsConfig& config) noexcept -> ProcessStatsErrorCode;
+
+    /*!
+     * \brief  Stops and joins the sampler thread (no effect if it does not run). The last snapshot stays readable.
+     *
+     * \note   Interrupts the sleep of the sampler: returns after at most one Sample(), whatever the period.
+     */
+    auto Stop() noexcept -> void;
+
+    /*!
+     * \brief  Whether the sampler thread runs.
+     */
+    auto IsRunning() const noexcept -> bool;
+
+    /*!
+     * \brief  Copies the latest snapshot into \c snapshot (lock-free).
+     *
+     * \return false if nothing was published yet, or if every attempt overlapped a sample.
+     */
+    auto Load(ProcessStatsSnapshot& snapshot) const noexcept -> bool
+    {
+        return publication_.Load(snapshot);
+    }
+
+    /*!
+     * \brief  Number of snapshots published so far.
+     */
+    auto GetVersion() const noexcept -> std::uint64_t
+    {
+        return publication_.GetVersion();
+    }
+
+private:
+    /*!
+     * \brief  A registered thread.
+     */
+    struct ManagedThread {
+        pthread_t     thread{};
+        clockid_t     clock{};
+        char          name[kThreadNameCapacity]{};
+        std::uint64_t cpuTimeNs{0U};
+        bool          alive{false};
+    };
+
+    /*!
+     * \brief  Destructor of exitKey_, run by an exiting thread registered with RegisterCurrentThread(); \c context
+     *         is the ProcessStats.
+     */
+    static auto ThreadExitHook(void* context) noexcept -> void;
+
+    /*!
+     * \brief  Takes the final CPU time of the calling (exiting) thread and marks it as not alive.
+     */
+    auto MarkCurrentThreadExited() noexcept -> void;
+
+    /*!
+     * \brief  Entry of the sampler thread; \c context is the ProcessStats.
+     */
+    static auto SamplerEntry(void* context) noexcept -> void;
+
+    /*!
+     * \brief  Sampler loop: Sample() at absolute deadlines until Stop(), sleeping on timer_ in between.
+     */
+    auto RunSampler() noexcept -> void;
+
+    Publication                                       ownPublication_{};
+    Publication&                                      publication_;
+    std::mutex                                        mutex_{};
+    ManagedThread                                     threads_[kMaxManagedThreads]{};
+    std::size_t                                       threadCount_{0U};
+    std::uint64_t                                     sampleIndex_{0U};
+    pthread_key_t                                     exitKey_{};
+    bool                                              exitKeyCreated_{false};
+    std::mutex                                        control_{};
+    ara::os::interface::thread::Thread                sampler_{};
+    ara::os::interface::timer::PlatformDeadlineTimer  timer_{};
+    std::chrono::milliseconds                         period_{0};
+    std::atomic<bool>                                 running_{false};
+};
+
+} // namespace process
+} // namespace interface
+} // namespace os
+} // namespace ara
+
+#endif // OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_OS_INTERFACE_PROCESS_PROCESS_STATS_H_
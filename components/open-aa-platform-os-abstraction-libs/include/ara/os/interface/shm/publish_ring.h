@@ -0,0 +1,173 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project (CXX_STANDARD 17)
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara/os/interface/shm/publish_ring.h
+ *  \brief      Definition of the ara::os::interface::shm::PublishRing template class.
+ *
+ *  \details    A PublishRing hands large trivially copyable samples (e.g., sensor frames) from one writer to any
+ *              number of readers without copying them. It holds Slots samples in place; publication k is written
+ *              directly into slot k % Slots and readers access it there:
+ *
+ *              - Writer: BeginPublish() returns the slot of the next publication, the writer fills it in place and
+ *                EndPublish() makes it visible. The writer never waits for readers.
+ *              - Reader: GetLatest() (or Get() for a given publication) returns a view of a published slot. Because
+ *                the writer reuses the slot Slots publications later, the reader checks IsValid() after it has
+ *                consumed the data, and discards its result if the slot was overwritten meanwhile.
+ *
+ *              Every slot carries a sequence number (2k + 1 while publication k is written, 2k + 2 once it is
+ *              published), the same protocol as SeqLock applied per slot, so overwrites are always detected.
+ *
+ *  \note       With Slots slots a reader has Slots - 1 publication periods to consume a sample before it is reused.
+ ***********************************************************************************************************************/
+
+#ifndef OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_OS_INTERFACE_SHM_PUBLISH_RING_H_
+#define OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_OS_INTERFACE_SHM_PUBLISH_RING_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include "ara/os/interface/shm/seqlock.h"   // For kCacheLineSize
+
+#include <atomic>       // For std::atomic, std::atomic_thread_fence
+#include <cstddef>      // For std::size_t
+#include <cstdint>      // For std::uint64_t
+#include <type_traits>  // For std::is_trivially_copyable_v
+
+namespace ara {
+namespace os {
+namespace interface {
+namespace shm {
+
+/**********************************************************************************************************************
+ *  CLASS: PublishRing
+ *********************************************************************************************************************/
+/*!
+ * \brief  Single-writer, multi-reader ring of Slots in-place samples of type T.
+ *
+ * \tparam T      Trivially copyable sample type.
+ * \tparam Slots  Number of slots (at least 2).
+ *
+ * \details
+ * - BeginPublish() / EndPublish() may only be called by one writer at a time (in one process), always in pairs.
+ * - The data a reader sees through a View is unsynchronized until IsValid() confirms it: copy out or compute from it
+ *   first, then validate.
+ * - Standard layout and trivially destructible: place it in shared memory with SharedMemory::Emplace().
+ */
+template <typename T, std::size_t Slots>
+class alignas(kCacheLineSize) PublishRing final {
+    static_assert(std::is_trivially_copyable_v<T>, "ara::os::shm::PublishRing: T must be trivially copyable");
+    static_assert(Slots >= 2U, "ara::os::shm::PublishRing: at least two slots are required");
+    static_assert(std::atomic<std::uint64_t>::is_always_lock_free,
+                  "ara::os::shm::PublishRing: 64-bit atomics must be lock-free to be shared between processes");
+
+public:
+    /*!
+     * \brief  A reader's view of one publication.
+     */
+    struct View {
+        const T*      data{nullptr};        /*!< The sample in its slot */
+        std::uint64_t publication{0U};      /*!< Index of the publication (0 for the first one) */
+    };
+
+    /*!
+     * \brief  Starts publication GetPublicationCount() and returns its slot to be filled in place (writer side).
+     *
+     * \note   The slot still holds the sample published Slots publications earlier.
+     */
+    auto BeginPublish() noexcept -> T&
+    {
+        std::uint64_t const publication = published_.load(std::memory_order_relaxed);
+        Slot& slot = slots_[publication % Slots];
+        slot.sequence.store((2U * publication) + 1U, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        return slot.sample;
+    }
+
+    /*!
+     * \brief  Publishes the slot returned by the preceding BeginPublish() (writer side).
+     */
+    auto EndPublish() noexcept -> void
+    {
+        std::uint64_t const publication = published_.load(std::memory_order_relaxed);
+        slots_[publication % Slots].sequence.store((2U * publication) + 2U, std::memory_order_release);
+        published_.store(publication + 1U, std::memory_order_release);
+    }
+
+    /*!
+     * \brief  Views publication \c publication if it is still held in its slot.
+     *
+     * \return \c false if it was not published yet or its slot is already being reused.
+     */
+    auto Get(std::uint64_t publication, View& view) const noexcept -> bool
+    {
+        const Slot& slot = slots_[publication % Slots];
+        if (slot.sequence.load(std::memory_order_acquire) != ((2U * publication) + 2U)) {
+            return false;
+        }
+        view.data        = &slot.sample;
+        view.publication = publication;
+        return true;
+    }
+
+    /*!
+     * \brief  Views the latest publication.
+     *
+     * \return \c false if nothing was published yet, or if the writer overtook every attempt (one per slot).
+     */
+    auto GetLatest(View& view) const noexcept -> bool
+    {
+        for (std::size_t attempt = 0U; attempt < Slots; ++attempt) {
+            std::uint64_t const count = published_.load(std::memory_order_acquire);
+            if (count == 0U) {
+                return false;
+            }
+            if (Get(count - 1U, view)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /*!
+     * \brief  Whether the slot of \c view still holds its publication, i.e. everything read through it is consistent.
+     */
+    auto IsValid(const View& view) const noexcept -> bool
+    {
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return slots_[view.publication % Slots].sequence.load(std::memory_order_relaxed) ==
+               ((2U * view.publication) + 2U);
+    }
+
+    /*!
+     * \brief  Number of completed publications.
+     */
+    auto GetPublicationCount() const noexcept -> std::uint64_t
+    {
+        return published_.load(std::memory_order_acquire);
+    }
+
+private:
+    /*!
+     * \brief  One sample with its sequence number, starting on its own cache line.
+     */
+    struct alignas(kCacheLineSize) Slot {
+        std::atomic<std::uint64_t> sequence{0U};
+        T                          sample{};
+    };
+
+    alignas(kCacheLineSize) std::atomic<std::uint64_t> published_{0U};
+    Slot slots_[Slots]{};
+};
+
+} // namespace shm
+} // namespace interface
+} // namespace os
+} // namespace ara
+
+#endif // OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_OS_INTERFACE_SHM_PUBLISH_RING_H_
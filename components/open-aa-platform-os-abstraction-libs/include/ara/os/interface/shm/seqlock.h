@@ -0,0 +1,158 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project (CXX_STANDARD 17)
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara/os/interface/shm/seqlock.h
+ *  \brief      Definition of the ara::os::interface::shm::SeqLock template class.
+ *
+ *  \details    A SeqLock publishes the latest value of a small trivially copyable T from one writer to any number of
+ *              readers, typically across processes through a SharedMemory segment. The writer never waits: it bumps a
+ *              sequence number to odd, stores the value and bumps it to even again. Readers copy the value and retry
+ *              if the sequence number was odd or changed meanwhile, so readers never block the writer and a reader
+ *              never sees a torn value.
+ *
+ *              The value is stored as 64-bit atomic words (relaxed loads and stores, ordered by fences), which keeps
+ *              the concurrent copy free of data races. Readers may map the segment read-only.
+ *
+ *  \note       For large values (e.g., sensor frames) whose copy would dominate, use PublishRing, which lets the
+ *              writer fill the data in place and readers access it without a copy.
+ ***********************************************************************************************************************/
+
+#ifndef OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_OS_INTERFACE_SHM_SEQLOCK_H_
+#define OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_OS_INTERFACE_SHM_SEQLOCK_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <atomic>       // For std::atomic, std::atomic_thread_fence
+#include <cstddef>      // For std::size_t
+#include <cstdint>      // For std::uint64_t
+#include <cstring>      // For std::memcpy
+#include <type_traits>  // For std::is_trivially_copyable_v
+
+#include "ara/core/interference_size.h"  // For ara::core::kDestructiveInterferenceSize
+
+namespace ara {
+namespace os {
+namespace interface {
+namespace shm {
+
+/*!
+ * \brief  Distance that keeps shared state on its own cache lines.
+ */
+constexpr std::size_t kCacheLineSize{ara::core::kDestructiveInterferenceSize};
+
+/**********************************************************************************************************************
+ *  CLASS: SeqLock
+ *********************************************************************************************************************/
+/*!
+ * \brief  Single-writer, multi-reader sequence lock around a value of type T.
+ *
+ * \tparam T  Trivially copyable value type.
+ *
+ * \details
+ * - Store() may only be called by one writer at a time (in one process); Load() and TryLoad() by any readers.
+ * - GetVersion() counts the completed stores, so readers can tell whether the value changed since they last read it.
+ * - Standard layout and trivially destructible: place it in shared memory with SharedMemory::Emplace().
+ */
+template <typename T>
+class alignas(kCacheLineSize) SeqLock final {
+    static_assert(std::is_trivially_copyable_v<T>, "ara::os::shm::SeqLock: T must be trivially copyable");
+    static_assert(std::atomic<std::uint64_t>::is_always_lock_free,
+                  "ara::os::shm::SeqLock: 64-bit atomics must be lock-free to be shared between processes");
+
+public:
+    /*!
+     * \brief  Number of 64-bit words holding the value.
+     */
+    static constexpr std::size_t kWordCount{(sizeof(T) + sizeof(std::uint64_t) - 1U) / sizeof(std::uint64_t)};
+
+    /*!
+     * \brief  Default number of attempts of Load() before it gives up.
+     */
+    static constexpr std::size_t kDefaultAttempts{64U};
+
+    /*!
+     * \brief  Publishes \c value (writer side, wait-free).
+     */
+    auto Store(const T& value) noexcept -> void
+    {
+        std::uint64_t words[kWordCount]{};
+        std::memcpy(words, &value, sizeof(T));
+
+        std::uint64_t const sequence = sequence_.load(std::memory_order_relaxed);
+        sequence_.store(sequence + 1U, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        for (std::size_t i = 0U; i < kWordCount; ++i) {
+            words_[i].store(words[i], std::memory_order_relaxed);
+        }
+        sequence_.store(sequence + 2U, std::memory_order_release);
+    }
+
+    /*!
+     * \brief  Copies the value into \c value if no store overlapped the copy.
+     *
+     * \return \c false (and \c value is unchanged) if a store was in progress or completed meanwhile, or if no value
+     *         was stored yet.
+     */
+    auto TryLoad(T& value) const noexcept -> bool
+    {
+        std::uint64_t const before = sequence_.load(std::memory_order_acquire);
+        if ((before == 0U) || ((before & 1U) != 0U)) {
+            return false;
+        }
+        std::uint64_t words[kWordCount];
+        for (std::size_t i = 0U; i < kWordCount; ++i) {
+            words[i] = words_[i].load(std::memory_order_relaxed);
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (sequence_.load(std::memory_order_relaxed) != before) {
+            return false;
+        }
+        std::memcpy(&value, words, sizeof(T));
+        return true;
+    }
+
+    /*!
+     * \brief  TryLoad() repeated up to \c attempts times.
+     *
+     * \return \c false if every attempt overlapped a store (the writer keeps storing faster than the copy), or if no
+     *         value was stored yet.
+     */
+    auto Load(T& value, std::size_t attempts = kDefaultAttempts) const noexcept -> bool
+    {
+        for (std::size_t attempt = 0U; attempt < attempts; ++attempt) {
+            if (TryLoad(value)) {
+                return true;
+            }
+            if (GetVersion() == 0U) {
+                return false;
+            }
+        }
+        return false;
+    }
+
+    /*!
+     * \brief  Number of completed stores.
+     */
+    auto GetVersion() const noexcept -> std::uint64_t
+    {
+        return sequence_.load(std::memory_order_acquire) / 2U;
+    }
+
+private:
+    std::atomic<std::uint64_t> sequence_{0U};
+    std::atomic<std::uint64_t> words_[kWordCount]{};
+};
+
+} // namespace shm
+} // namespace interface
+} // namespace os
+} // namespace ara
+
+#endif // OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_OS_INTERFACE_SHM_SEQLOCK_H_
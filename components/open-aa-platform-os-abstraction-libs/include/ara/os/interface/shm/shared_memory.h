@@ -0,0 +1,255 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project (CXX_STANDARD 17)
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara/os/interface/shm/shared_memory.h
+ *  \brief      Declaration of the ara::os::interface::shm::SharedMemory.
+ *
+ *  \details    A SharedMemory maps a named shared-memory segment into the process. One process creates the segment,
+ *              any number of processes open it by name, and all of them access the same physical pages: data placed
+ *              in the segment is exchanged without any copy through the kernel.
+ *
+ *              The mapped bytes are viewed as typed objects in place:
+ *              - AsSpan<T>():  an ara::core::Span<T> over trivially copyable elements (e.g., sample buffers).
+ *              - As<T>():      a single trivially copyable object, such as an ara::core::Array<T, N>.
+ *              - Emplace<T>(): constructs a shared control structure (e.g., a SeqLock or a PublishRing) in place;
+ *                              Attach<T>() returns it in the other processes.
+ *
+ *  \note       Plain data in a segment is not synchronized; publish it through ara/os/interface/shm/seqlock.h or
+ *              ara/os/interface/shm/publish_ring.h. No heap allocation happens at any point.
+ ***********************************************************************************************************************/
+
+#ifndef OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_OS_INTERFACE_SHM_SHARED_MEMORY_H_
+#define OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_OS_INTERFACE_SHM_SHARED_MEMORY_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+/*!
+ * \brief  Includes the SharedMemoryControl interface header.
+ */
+#include "ara/os/interface/shm/shared_memory_control.h"
+
+// Include platform-specific headers for the static SharedMemoryControl backends
+#if defined(__linux__)
+    #include "ara/os/linux/shm/shared_memory_control.h" // Linux-specific SharedMemoryControlImpl
+#elif defined(__QNXNTO__)
+    #include "ara/os/qnx/shm/shared_memory_control.h"   // QNX-specific SharedMemoryControlImpl
+#else
+    /* Unsupported platform: Generate a compile-time error */
+    #error "Unsupported platform. No SharedMemoryControl backend is available."
+#endif
+
+#include "ara/core/span.h"  // For ara::core::Span
+#include <cstddef>          // For std::size_t
+#include <cstdint>          // For fixed-width integer types
+#include <new>              // For placement new
+#include <type_traits>      // For the type requirements of the views
+
+namespace ara {
+namespace os {
+namespace interface {
+namespace shm {
+
+/**********************************************************************************************************************
+ *  TYPE ALIAS: PlatformSharedMemoryControl
+ *********************************************************************************************************************/
+/*!
+ * \brief  The static SharedMemoryControl backend of the target platform, selected at compile time.
+ */
+#if defined(__linux__)
+using PlatformSharedMemoryControl = ara::os::linux::shm::SharedMemoryControlImpl;
+#elif defined(__QNXNTO__)
+using PlatformSharedMemoryControl = ara::os::qnx::shm::SharedMemoryControlImpl;
+#endif
+
+/**********************************************************************************************************************
+ *  CLASS: SharedMemory
+ *********************************************************************************************************************/
+/*!
+ * \brief  Mapping of a named shared-memory segment.
+ *
+ * \details
+ * - A SharedMemory maps one segment at a time; Close() unmaps it and the object can be reused.
+ * - Closing (or destroying) the object never removes the segment: its name stays until Unlink(), usually called by
+ *   the creator once no further process needs to open it. Processes that still map it are not affected.
+ * - The views check bounds, alignment and, for writable views, the access mode of the mapping, and return an empty
+ *   span or nullptr when a check fails. The mapping is page aligned, so offsets that are multiples of alignof(T)
+ *   are aligned in every process.
+ * - Not copyable or movable: views handed out point into the mapping this object owns.
+ */
+class SharedMemory final {
+public:
+    /*!
+     * \brief  Maximum length of a segment name, including the leading slash.
+     */
+    static constexpr std::size_t kMaxNameLength{255U};
+
+    SharedMemory() noexcept = default;
+
+    /*!
+     * \brief  Unmaps the segment if one is mapped (the segment itself is kept).
+     */
+    ~SharedMemory() noexcept;
+
+    SharedMemory(const SharedMemory&) = delete;
+    SharedMemory(SharedMemory&&) = delete;
+    auto operator=(const SharedMemory&) -> SharedMemory& = delete;
+    auto operator=(SharedMemory&&) -> SharedMemory& = delete;
+
+    /*!
+     * \brief  Whether \c name is a valid segment name ("/name", no further slash, at most kMaxNameLength).
+     */
+    static auto IsValidName(const char* name) noexcept -> bool;
+
+    /*!
+     * \brief  Creates the segment \c config.name (which must not exist), zero-filled, and maps it read-write.
+     *
+     * \return ErrorCode::Success, InvalidArgument, AlreadyExists, PermissionDenied, AlreadyOpen,
+     *         HugePagesUnavailable or ResourceFailure. On a failure no segment is left behind.
+     */
+    auto Create(const SegmentConfig& config) noexcept -> ErrorCode;
+
+    /*!
+     * \brief  Opens and maps the existing segment \c config.name.
+     *
+     * \return ErrorCode::Success, InvalidArgument, NotFound, PermissionDenied, AlreadyOpen, SizeMismatch,
+     *         HugePagesUnavailable or ResourceFailure.
+     */
+    auto Open(const SegmentConfig& config) noexcept -> ErrorCode;
+
+    /*!
+     * \brief  Unmaps the segment. Safe to call if none is mapped.
+     */
+    auto Close() noexcept -> void;
+
+    /*!
+     * \brief  Removes the name of segment \c name (\c hugePages as given to Create()).
+     *
+     * \return ErrorCode::Success, InvalidArgument, NotFound or PermissionDenied.
+     */
+    static auto Unlink(const char* name, bool hugePages = false) noexcept -> ErrorCode;
+
+    /*!
+     * \brief  Whether a segment is mapped.
+     */
+    auto IsOpen() const noexcept -> bool;
+
+    /*!
+     * \brief  Whether the mapping is writable.
+     */
+    auto IsWritable() const noexcept -> bool;
+
+    /*!
+     * \brief  Size of the mapping in bytes (0 if not open).
+     */
+    auto GetSize() const noexcept -> std::size_t;
+
+    /*!
+     * \brief  Start of the mapping (nullptr if not open).
+     */
+    auto GetData() const noexcept -> void*;
+
+    /*!
+     * \brief  Views \c count elements of type T at byte \c offset; dynamic_extent views all elements that fit.
+     *
+     * \tparam T  Trivially copyable element type; must be const-qualified for a read-only mapping.
+     *
+     * \return The span, or an empty span if the elements do not fit, \c offset is misaligned or T is writable but the
+     *         mapping is not.
+     */
+    template <typename T>
+    auto AsSpan(std::size_t offset = 0U, std::size_t count = ara::core::dynamic_extent) const noexcept
+        -> ara::core::Span<T>
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "ara::os::shm::SharedMemory: T must be trivially copyable");
+        std::size_t const available = (offset < size_) ? ((size_ - offset) / sizeof(T)) : 0U;
+        std::size_t const elements  = (count == ara::core::dynamic_extent) ? available : count;
+        if ((elements == 0U) || (elements > available)) {
+            return ara::core::Span<T>{};
+        }
+        void* const first = Locate(offset, elements * sizeof(T), alignof(T), !std::is_const_v<T>);
+        return (first != nullptr) ? ara::core::Span<T>{static_cast<T*>(first), elements} : ara::core::Span<T>{};
+    }
+
+    /*!
+     * \brief  Views the trivially copyable object of type T (e.g., an ara::core::Array<U, N>) at byte \c offset.
+     *
+     * \tparam T  Trivially copyable type; must be const-qualified for a read-only mapping.
+     *
+     * \return The object, or nullptr if it does not fit, \c offset is misaligned or T is writable but the mapping is
+     *         not.
+     */
+    template <typename T>
+    auto As(std::size_t offset = 0U) const noexcept -> T*
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "ara::os::shm::SharedMemory: T must be trivially copyable");
+        return static_cast<T*>(Locate(offset, sizeof(T), alignof(T), !std::is_const_v<T>));
+    }
+
+    /*!
+     * \brief  Constructs a value-initialized T at byte \c offset (creator side, before other processes attach).
+     *
+     * \tparam T  Standard-layout, trivially destructible type whose atomics are lock-free (address-free), such as
+     *            SeqLock or PublishRing. Its destructor is never run.
+     *
+     * \return The object, or nullptr if it does not fit, \c offset is misaligned or the mapping is read-only.
+     */
+    template <typename T>
+    auto Emplace(std::size_t offset = 0U) const noexcept -> T*
+    {
+        static_assert(std::is_standard_layout_v<T>, "ara::os::shm::SharedMemory: T must be standard layout");
+        static_assert(std::is_trivially_destructible_v<T>, "ara::os::shm::SharedMemory: T must be trivially destructible");
+        void* const location = Locate(offset, sizeof(T), alignof(T), true);
+        return (location != nullptr) ? ::new (location) T{} : nullptr;
+    }
+
+    /*!
+     * \brief  Returns the T that the creator constructed with Emplace<T>() at byte \c offset.
+     *
+     * \tparam T  The type passed to Emplace(); must be const-qualified for a read-only mapping.
+     *
+     * \return The object, or nullptr if it does not fit, \c offset is misaligned or T is writable but the mapping is
+     *         not.
+     */
+    template <typename T>
+    auto Attach(std::size_t offset = 0U) const noexcept -> T*
+    {
+        static_assert(std::is_standard_layout_v<T>, "ara::os::shm::SharedMemory: T must be standard layout");
+        return static_cast<T*>(Locate(offset, sizeof(T), alignof(T), !std::is_const_v<T>));
+    }
+
+private:
+    /*!
+     * \brief  Maps \c size bytes of \c fd and closes \c fd.
+     */
+    auto Map(int fd, std::size_t size, bool writable, bool hugePages) noexcept -> ErrorCode;
+
+    /*!
+     * \brief  Touches every page of the mapping: writes the zero-filled pages of a new segment (\c initialize),
+     *         reads them otherwise so that data other processes are writing is left alone.
+     */
+    auto Prefault(bool initialize) const noexcept -> void;
+
+    /*!
+     * \brief  Address of \c bytes at \c offset, or nullptr if they do not fit, are misaligned for \c alignment or
+     *         need write access the mapping does not have.
+     */
+    auto Locate(std::size_t offset, std::size_t bytes, std::size_t alignment, bool write) const noexcept -> void*;
+
+    void*       data_{nullptr};
+    std::size_t size_{0U};
+    bool        writable_{false};
+};
+
+} // namespace shm
+} // namespace interface
+} // namespace os
+} // namespace ara
+
+#endif // OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_OS_INTERFACE_SHM_SHARED_MEMORY_H_
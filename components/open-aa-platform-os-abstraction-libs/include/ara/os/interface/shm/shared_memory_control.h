@@ -0,0 +1,154 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project (CXX_STANDARD 17)
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara/os/interface/shm/shared_memory_control.h
+ *  \brief      Definition of the ara::os::interface::shm::SharedMemoryControl static (CRTP) interface.
+ *
+ *  \details    SharedMemoryControl covers the part of a named shared-memory segment that each OS does differently:
+ *              creating and sizing its memory object (POSIX shm or hugetlbfs on Linux, shm_ctl() with physically
+ *              contiguous or typed memory on QNX), opening it and removing its name. Mapping the object is plain
+ *              POSIX and handled by ara::os::interface::shm::SharedMemory itself.
+ *
+ *  \note       Platform backends derive from SharedMemoryControl<Backend>. No virtual dispatch and no heap allocation
+ *              is involved.
+ ***********************************************************************************************************************/
+
+#ifndef OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_OS_INTERFACE_SHM_SHARED_MEMORY_CONTROL_H_
+#define OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_OS_INTERFACE_SHM_SHARED_MEMORY_CONTROL_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <cstddef>      // For std::size_t
+#include <cstdint>      // For fixed-width integer types
+
+namespace ara {
+namespace os {
+namespace interface {
+namespace shm {
+
+/**********************************************************************************************************************
+ *  ENUM: ErrorCode
+ *********************************************************************************************************************/
+/*!
+ * \brief  Enumeration of possible error codes for the shared-memory operations.
+ */
+enum class ErrorCode : uint8_t {
+    Success = 0,                   /*!< Operation completed successfully */
+    InvalidArgument,               /*!< Invalid name or size, or an option the platform does not support */
+    AlreadyExists,                 /*!< Create(): a segment with this name exists */
+    NotFound,                      /*!< Open(): no segment with this name exists */
+    PermissionDenied,              /*!< The segment exists but may not be opened with the requested access */
+    AlreadyOpen,                   /*!< The SharedMemory object already maps a segment */
+    SizeMismatch,                  /*!< Open(): the segment is smaller than the size the opener expects */
+    HugePagesUnavailable,          /*!< Huge (large) pages were requested but none are available */
+    ResourceFailure,               /*!< Sizing or mapping the segment failed (e.g., out of memory) */
+    UnknownError                   /*!< An unknown error occurred */
+};
+
+/**********************************************************************************************************************
+ *  STRUCT: SegmentConfig
+ *********************************************************************************************************************/
+/*!
+ * \brief  Configuration of a shared-memory segment, for both its creator and the processes opening it.
+ *
+ * \details
+ * - name:        "/name": one leading slash, no other slash, at most SharedMemory::kMaxNameLength characters.
+ * - size:        Create(): bytes requested, rounded up to the page size of the backing memory (must be > 0).
+ *                Open(): the minimum size the opener expects (0: any size).
+ * - hugePages:   Back the segment with huge pages (Linux: a file on the hugetlbfs mount, which must have free
+ *                huge pages; QNX: physically contiguous memory so large pages can be used). Openers must pass the
+ *                same value as the creator.
+ * - writable:    Open() only: map the segment read-write (true) or read-only (false). The creator always maps it
+ *                read-write.
+ * - prefault:    Touch every page once while mapping, so the first accesses of the real-time path do not fault
+ *                (together with mlockall(MCL_FUTURE) the pages then stay resident).
+ * - typedMemory: QNX only: typed memory pool to allocate the segment from (e.g., "/memory/ram/sysram"); must be
+ *                nullptr on other platforms.
+ */
+struct SegmentConfig {
+    const char* name{nullptr};
+    std::size_t size{0U};
+    bool        hugePages{false};
+    bool        writable{true};
+    bool        prefault{false};
+    const char* typedMemory{nullptr};
+};
+
+/**********************************************************************************************************************
+ *  CLASS: SharedMemoryControl
+ *********************************************************************************************************************/
+/*!
+ * \brief  Static (CRTP) interface of the platform-specific shared-memory object handling.
+ *
+ * \tparam Backend  The platform backend deriving from SharedMemoryControl<Backend>.
+ *
+ * \details
+ * - Backend must provide:
+ *   - static auto CreateImpl(const SegmentConfig& config, std::size_t& size, int& fd) noexcept -> ErrorCode;
+ *   - static auto OpenImpl(const SegmentConfig& config, std::size_t& size, int& fd) noexcept -> ErrorCode;
+ *   - static auto UnlinkImpl(const char* name, bool hugePages) noexcept -> ErrorCode;
+ * - The names handed to the backend are already validated by SharedMemory.
+ */
+template <typename Backend>
+class SharedMemoryControl {
+public:
+    /*!
+     * \brief  Creates the memory object \c config.name exclusively and sizes it.
+     *
+     * \param[in]  config  Segment configuration (name, size, hugePages, typedMemory).
+     * \param[out] size    Size of the object: config.size rounded up to the page size of the backing memory.
+     * \param[out] fd      Read-write descriptor of the object (only valid on success).
+     *
+     * \return ErrorCode::Success, InvalidArgument, AlreadyExists, PermissionDenied, HugePagesUnavailable or
+     *         ResourceFailure. On a failure no object is left behind.
+     */
+    static auto Create(const SegmentConfig& config, std::size_t& size, int& fd) noexcept -> ErrorCode
+    {
+        return Backend::CreateImpl(config, size, fd);
+    }
+
+    /*!
+     * \brief  Opens the existing memory object \c config.name with the access of \c config.writable.
+     *
+     * \param[in]  config  Segment configuration (name, hugePages, writable).
+     * \param[out] size    Size of the object.
+     * \param[out] fd      Descriptor of the object (only valid on success).
+     *
+     * \return ErrorCode::Success, InvalidArgument, NotFound, PermissionDenied or ResourceFailure.
+     */
+    static auto Open(const SegmentConfig& config, std::size_t& size, int& fd) noexcept -> ErrorCode
+    {
+        return Backend::OpenImpl(config, size, fd);
+    }
+
+    /*!
+     * \brief  Removes the name \c name. Existing mappings stay valid until they are unmapped.
+     *
+     * \return ErrorCode::Success, NotFound or PermissionDenied.
+     */
+    static auto Unlink(const char* name, bool hugePages) noexcept -> ErrorCode
+    {
+        return Backend::UnlinkImpl(name, hugePages);
+    }
+
+protected:
+    /*!
+     * \brief  Protected constructor and destructor: SharedMemoryControl is only used as a CRTP base.
+     */
+    constexpr SharedMemoryControl() noexcept = default;
+    ~SharedMemoryControl() = default;
+};
+
+} // namespace shm
+} // namespace interface
+} // namespace os
+} // namespace ara
+
+#endif // OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_OS_INTERFACE_SHM_SHARED_MEMORY_CONTROL_H_
@@ -0,0 +1,327 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project (CXX_STANDARD 17)
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara/os/interface/system/cpu_topology.h
+ *  \brief      Definition of the CPU topology and cache geometry reported by ara::os::interface::system.
+ *
+ *  \details    CpuTopology describes every CPU of the system: its package, cluster, core and NUMA node, its relative
+ *              compute capacity (big.LITTLE) and its caches, plus the sets of online, allowed and isolated CPUs. The
+ *              queries select CPUs for pinning (the performance cores, the CPUs sharing an L2, a NUMA node) and the
+ *              result plugs directly into ThreadConfig::affinity.
+ *
+ *              Everything is fixed-size (CpuSet::kMaxCpus CPUs, kMaxCacheCount caches each), so a topology can be
+ *              read without heap allocation. It is about 10 KiB: keep it static or in a long-lived object.
+ *
+ *  \note       While not specified by AUTOSAR requirements, this interface is essential for creating a generic
+ *              platform solution to abstract OS-specific functionalities.
+ ***********************************************************************************************************************/
+
+#ifndef OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_OS_INTERFACE_SYSTEM_CPU_TOPOLOGY_H_
+#define OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_OS_INTERFACE_SYSTEM_CPU_TOPOLOGY_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <cstddef>      // For std::size_t
+#include <cstdint>      // For fixed-width integer types
+
+#include "ara/core/interference_size.h"              // For ara::core::kDestructiveInterferenceSize
+#include "ara/os/interface/thread/thread_control.h"  // For ara::os::interface::thread::CpuSet
+
+namespace ara {
+namespace os {
+namespace interface {
+namespace system {
+
+using CpuSet = ara::os::interface::thread::CpuSet;
+
+/**********************************************************************************************************************
+ *  ENUM: ErrorCode
+ *********************************************************************************************************************/
+/*!
+ * \brief  Enumeration of possible error codes for the system queries.
+ */
+enum class ErrorCode : uint8_t {
+    Success = 0,                   /*!< Operation completed successfully */
+    RetrievalFailed,               /*!< The OS did not report the information (e.g., sysfs not mounted) */
+    Truncated,                     /*!< More CPUs than CpuSet::kMaxCpus; the first kMaxCpus are reported */
+    InterferenceSizeTooSmall,      /*!< A cache line is larger than ara::core::kDestructiveInterferenceSize */
+    UnknownError                   /*!< An unknown error occurred */
+};
+
+/**********************************************************************************************************************
+ *  ENUM: CacheType
+ *********************************************************************************************************************/
+/*!
+ * \brief  Kind of data a cache holds.
+ */
+enum class CacheType : uint8_t {
+    Data = 0,                      /*!< Data only (e.g., L1d) */
+    Instruction,                   /*!< Instructions only (e.g., L1i) */
+    Unified                        /*!< Data and instructions (e.g., L2, L3) */
+};
+
+/**********************************************************************************************************************
+ *  STRUCT: CacheInfo
+ *********************************************************************************************************************/
+/*!
+ * \brief  One cache seen by a CPU.
+ *
+ * \details firstSharedCpu identifies the cache instance: two CPUs with the same level, type and firstSharedCpu use
+ *          the same physical cache.
+ */
+struct CacheInfo {
+    std::uint8_t  level{0U};                       /*!< 1 for L1, 2 for L2, ... */
+    CacheType     type{CacheType::Unified};        /*!< Data, Instruction or Unified */
+    std::uint16_t lineSize{0U};                    /*!< Coherency line size in bytes (0 if unknown) */
+    std::uint32_t size{0U};                        /*!< Capacity in bytes (0 if unknown) */
+    std::uint16_t sharedCpuCount{1U};              /*!< Number of CPUs sharing this cache */
+    std::uint16_t firstSharedCpu{0U};              /*!< Lowest CPU sharing this cache */
+};
+
+/**********************************************************************************************************************
+ *  STRUCT: CpuInfo
+ *********************************************************************************************************************/
+/*!
+ * \brief  Placement, capacity and caches of one CPU.
+ *
+ * \details
+ * - coreId is unique within the package; SMT siblings share it.
+ * - clusterId groups cores within the package (cores sharing an L2, or an Arm cluster); it equals packageId where
+ *   the OS does not report clusters.
+ * - capacity is the compute capacity relative to the fastest CPU of the system (kMaxCapacity). On big.LITTLE parts
+ *   the little cores report less; on homogeneous systems all CPUs report kMaxCapacity.
+ */
+struct CpuInfo {
+    /*!
+     * \brief  Maximum number of caches recorded per CPU (L1d, L1i, L2, L3, one spare level).
+     */
+    static constexpr std::size_t kMaxCacheCount{5U};
+
+    /*!
+     * \brief  Capacity of the fastest CPUs (the Linux SCHED_CAPACITY_SCALE).
+     */
+    static constexpr std::uint16_t kMaxCapacity{1024U};
+
+    std::uint16_t packageId{0U};                   /*!< Physical package (socket) */
+    std::uint16_t clusterId{0U};                   /*!< Cluster within the package */
+    std::uint16_t coreId{0U};                      /*!< Core within the package */
+    std::uint16_t numaNode{0U};                    /*!< NUMA node (0 without NUMA) */
+    std::uint16_t capacity{kMaxCapacity};          /*!< Relative compute capacity, 1 .. kMaxCapacity */
+    std::uint32_t maxFrequencyKhz{0U};             /*!< Maximum frequency (0 if unknown) */
+    std::uint8_t  cacheCount{0U};                  /*!< Valid entries of caches */
+    CacheInfo     caches[kMaxCacheCount]{};        /*!< Caches, in the order the OS reports them */
+
+    /*!
+     * \brief  The data or unified cache of \c level, or nullptr.
+     */
+    constexpr auto FindDataCache(std::uint8_t level) const noexcept -> const CacheInfo*
+    {
+        for (std::size_t i = 0U; i < cacheCount; ++i) {
+            if ((caches[i].level == level) && (caches[i].type != CacheType::Instruction)) {
+                return &caches[i];
+            }
+        }
+        return nullptr;
+    }
+};
+
+/**********************************************************************************************************************
+ *  STRUCT: CpuTopology
+ *********************************************************************************************************************/
+/*!
+ * \brief  Topology of all CPUs of the system.
+ *
+ * \details
+ * - cpus[i] describes CPU i for i < cpuCount; CPUs that are offline keep default entries.
+ * - online:   CPUs currently running.
+ * - allowed:  CPUs the calling thread may run on (its affinity when the topology was read).
+ * - isolated: CPUs removed from the general scheduler (Linux isolcpus=; empty on QNX). Pin dedicated real-time
+ *             threads there; they are not in the default affinity of other threads.
+ * - cacheLineSize is the largest coherency line size of any data or unified cache, over all CPUs.
+ */
+struct CpuTopology {
+    std::size_t cpuCount{0U};                      /*!< Number of CPU entries (highest possible CPU + 1) */
+    CpuSet      online{};                          /*!< CPUs currently online */
+    CpuSet      allowed{};                         /*!< Affinity of the reading thread */
+    CpuSet      isolated{};                        /*!< CPUs isolated from the general scheduler */
+    std::size_t cacheLineSize{0U};                 /*!< Largest coherency line size (0 if unknown) */
+    CpuInfo     cpus[CpuSet::kMaxCpus]{};          /*!< Per-CPU information */
+
+    /*!
+     * \brief  Whether the online CPUs differ in capacity (big.LITTLE or a hybrid x86 part).
+     */
+    constexpr auto IsHeterogeneous() const noexcept -> bool
+    {
+        return GetCapacityCpus(true).Count() != online.Count();
+    }
+
+    /*!
+     * \brief  The online CPUs of the highest capacity (the big cores; all CPUs on homogeneous systems).
+     */
+    constexpr auto GetPerformanceCpus() const noexcept -> CpuSet { return GetCapacityCpus(true); }
+
+    /*!
+     * \brief  The online CPUs of the lowest capacity (the little cores; all CPUs on homogeneous systems).
+     */
+    constexpr auto GetEfficiencyCpus() const noexcept -> CpuSet { return GetCapacityCpus(false); }
+
+    /*!
+     * \brief  The online CPUs in the same package and cluster as \c cpu.
+     */
+    constexpr auto GetClusterCpus(std::size_t cpu) const noexcept -> CpuSet
+    {
+        CpuSet result{};
+        if (online.Contains(cpu)) {
+            for (std::size_t other = 0U; other < cpuCount; ++other) {
+                if (online.Contains(other) && (cpus[other].packageId == cpus[cpu].packageId) &&
+                    (cpus[other].clusterId == cpus[cpu].clusterId)) {
+                    static_cast<void>(result.Add(other));
+                }
+            }
+        }
+        return result;
+    }
+
+    /*!
+     * \brief  The online SMT siblings of \c cpu, including \c cpu itself.
+     */
+    constexpr auto GetCoreCpus(std::size_t cpu) const noexcept -> CpuSet
+    {
+        CpuSet result{};
+        if (online.Contains(cpu)) {
+            for (std::size_t other = 0U; other < cpuCount; ++other) {
+                if (online.Contains(other) && (cpus[other].packageId == cpus[cpu].packageId) &&
+                    (cpus[other].coreId == cpus[cpu].coreId)) {
+                    static_cast<void>(result.Add(other));
+                }
+            }
+        }
+        return result;
+    }
+
+    /*!
+     * \brief  The online CPUs of NUMA node \c node.
+     */
+    constexpr auto GetNodeCpus(std::uint16_t node) const noexcept -> CpuSet
+    {
+        CpuSet result{};
+        for (std::size_t cpu = 0U; cpu < cpuCount; ++cpu) {
+            if (online.Contains(cpu) && (cpus[cpu].numaNode == node)) {
+                static_cast<void>(result.Add(cpu));
+            }
+        }
+        return result;
+    }
+
+    /*!
+     * \brief  The online CPUs sharing the data or unified cache of \c level with \c cpu (empty if \c cpu has none).
+     */
+    constexpr auto GetCacheSharingCpus(std::size_t cpu, std::uint8_t level) const noexcept -> CpuSet
+    {
+        CpuSet result{};
+        const CacheInfo* const cache = online.Contains(cpu) ? cpus[cpu].FindDataCache(level) : nullptr;
+        if (cache != nullptr) {
+            for (std::size_t other = 0U; other < cpuCount; ++other) {
+                const CacheInfo* const candidate = online.Contains(other) ? cpus[other].FindDataCache(level) : nullptr;
+                if ((candidate != nullptr) && (candidate->firstSharedCpu == cache->firstSharedCpu)) {
+                    static_cast<void>(result.Add(other));
+                }
+            }
+        }
+        return result;
+    }
+
+    /*!
+     * \brief  Number of NUMA nodes with online CPUs.
+     */
+    constexpr auto GetNodeCount() const noexcept -> std::size_t
+    {
+        return CountDistinct([](const CpuInfo& lhs, const CpuInfo& rhs) { return lhs.numaNode == rhs.numaNode; });
+    }
+
+    /*!
+     * \brief  Number of physical cores with online CPUs (SMT siblings count once).
+     */
+    constexpr auto GetCoreCount() const noexcept -> std::size_t
+    {
+        return CountDistinct([](const CpuInfo& lhs, const CpuInfo& rhs) {
+            return (lhs.packageId == rhs.packageId) && (lhs.coreId == rhs.coreId);
+        });
+    }
+
+private:
+    /*!
+     * \brief  The online CPUs of the highest (\c highest) or lowest capacity.
+     */
+    constexpr auto GetCapacityCpus(bool highest) const noexcept -> CpuSet
+    {
+        std::uint16_t selected{highest ? std::uint16_t{0U} : CpuInfo::kMaxCapacity};
+        for (std::size_t cpu = 0U; cpu < cpuCount; ++cpu) {
+            if (online.Contains(cpu)) {
+                std::uint16_t const capacity = cpus[cpu].capacity;
+                if (highest ? (capacity > selected) : (capacity < selected)) {
+                    selected = capacity;
+                }
+            }
+        }
+        CpuSet result{};
+        for (std::size_t cpu = 0U; cpu < cpuCount; ++cpu) {
+            if (online.Contains(cpu) && (cpus[cpu].capacity == selected)) {
+                static_cast<void>(result.Add(cpu));
+            }
+        }
+        return result;
+    }
+
+    /*!
+     * \brief  Number of online CPUs not equivalent (per \c same) to a lower online CPU.
+     */
+    template <typename Same>
+    constexpr auto CountDistinct(Same same) const noexcept -> std::size_t
+    {
+        std::size_t count{0U};
+        for (std::size_t cpu = 0U; cpu < cpuCount; ++cpu) {
+            bool seen = !online.Contains(cpu);
+            for (std::size_t lower = 0U; (lower < cpu) && !seen; ++lower) {
+                seen = online.Contains(lower) && same(cpus[lower], cpus[cpu]);
+            }
+            count += seen ? 0U : 1U;
+        }
+        return count;
+    }
+};
+
+/**********************************************************************************************************************
+ *  FUNCTION: CheckDestructiveInterferenceSize
+ *********************************************************************************************************************/
+/*!
+ * \brief  Cross-checks the compile-time ara::core::kDestructiveInterferenceSize against a detected line size.
+ *
+ * \param[in] lineSize  Cache line size reported by the running system (0 if unknown).
+ *
+ * \return ErrorCode::Success if the padding of the build covers \c lineSize, RetrievalFailed if \c lineSize is
+ *         unknown, InterferenceSizeTooSmall if the build pads less than one line: objects assumed to be apart share
+ *         lines on this system (rebuild with ARA_CORE_DESTRUCTIVE_INTERFERENCE_SIZE set to at least \c lineSize).
+ */
+constexpr auto CheckDestructiveInterferenceSize(std::size_t lineSize) noexcept -> ErrorCode
+{
+    if (lineSize == 0U) {
+        return ErrorCode::RetrievalFailed;
+    }
+    return (lineSize <= ara::core::kDestructiveInterferenceSize) ? ErrorCode::Success
+                                                                 : ErrorCode::InterferenceSizeTooSmall;
+}
+
+} // namespace system
+} // namespace interface
+} // namespace os
+} // namespace ara
+
+#endif // OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_OS_INTERFACE_SYSTEM_CPU_TOPOLOGY_H_
@@ -0,0 +1,98 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project (CXX_STANDARD 17)
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara/os/interface/system/system_access.h
+ *  \brief      Definition of the ara::os::interface::system::SystemAccess static (CRTP) interface.
+ *
+ *  \details    This file defines the compile-time counterpart of the SystemInteraction interface. Platform backends
+ *              derive from SystemAccess<Backend> and provide static *Impl functions; callers reach the backend
+ *              through SystemAccess<Backend> without a heap allocation or a virtual call.
+ *
+ *  \note       The virtual SystemInteraction interface remains available for code that needs run-time polymorphism
+ *              (e.g., mocking in tests). Both paths share the same platform implementation.
+ ***********************************************************************************************************************/
+
+#ifndef OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_OS_INTERFACE_SYSTEM_SYSTEM_ACCESS_H_
+#define OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_OS_INTERFACE_SYSTEM_SYSTEM_ACCESS_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+/*!
+ * \brief  Includes the CpuTopology definition and the shared ErrorCode.
+ */
+#include "ara/os/interface/system/cpu_topology.h"
+
+#include <cstddef>      // For std::size_t
+
+namespace ara {
+namespace os {
+namespace interface {
+namespace system {
+
+/**********************************************************************************************************************
+ *  CLASS: SystemAccess
+ *********************************************************************************************************************/
+/*!
+ * \brief  Static (CRTP) interface for system-related functionalities.
+ *
+ * \tparam Backend  The platform backend deriving from SystemAccess<Backend>.
+ *
+ * \details
+ * - Backend must provide:
+ *   - static auto GetCpuTopologyImpl(CpuTopology& topology) noexcept -> ErrorCode;
+ *   - static auto GetCacheLineSizeImpl() noexcept -> std::size_t;
+ * - All functions are static: there is no object to allocate and no vtable to dispatch through.
+ */
+template <typename Backend>
+class SystemAccess {
+public:
+    /*!
+     * \brief  Reads the topology of all CPUs.
+     *
+     * \return ErrorCode::Success, Truncated (more CPUs than CpuSet::kMaxCpus) or RetrievalFailed.
+     */
+    static auto GetCpuTopology(CpuTopology& topology) noexcept -> ErrorCode
+    {
+        return Backend::GetCpuTopologyImpl(topology);
+    }
+
+    /*!
+     * \brief  Coherency line size of the data caches of CPU 0 in bytes, or 0 if unknown.
+     */
+    static auto GetCacheLineSize() noexcept -> std::size_t
+    {
+        return Backend::GetCacheLineSizeImpl();
+    }
+
+    /*!
+     * \brief  Cross-checks ara::core::kDestructiveInterferenceSize against the line size of the running system.
+     *
+     * \return See CheckDestructiveInterferenceSize(). Call it once at startup; a mismatch means the padding of
+     *         the build does not prevent false sharing on this SoC.
+     */
+    static auto CheckDestructiveInterferenceSize() noexcept -> ErrorCode
+    {
+        return ara::os::interface::system::CheckDestructiveInterferenceSize(Backend::GetCacheLineSizeImpl());
+    }
+
+protected:
+    /*!
+     * \brief  Protected constructor and destructor: SystemAccess is only used as a CRTP base.
+     */
+    constexpr SystemAccess() noexcept = default;
+    ~SystemAccess() = default;
+};
+
+} // namespace system
+} // namespace interface
+} // namespace os
+} // namespace ara
+
+#endif // OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_OS_INTERFACE_SYSTEM_SYSTEM_ACCESS_H_
@@ -0,0 +1,94 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project (CXX_STANDARD 17)
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara/os/interface/system/system_factory.h
+ *  \brief      Declaration of the ara::os::interface::system::SystemFactory.
+ *
+ *  \details    This file declares the ara::os::interface::system::SystemFactory class responsible for creating
+ *              platform-specific instances of the SystemInteraction interface, and the PlatformSystemAccess alias
+ *              that resolves the static (CRTP) backend for the target platform at compile time.
+ *
+ *  \note       This facilitates the OS abstraction by hiding platform-specific details from the client.
+ ***********************************************************************************************************************/
+
+#ifndef OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_OS_INTERFACE_SYSTEM_SYSTEM_FACTORY_H_
+#define OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_OS_INTERFACE_SYSTEM_SYSTEM_FACTORY_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+/*!
+ * \brief  Includes the SystemInteraction interface header.
+ */
+#include "ara/os/interface/system/system_interaction.h"
+
+// Include platform-specific headers for the static SystemAccess backends
+#if defined(__linux__)
+    #include "ara/os/linux/system/system.h" // Linux-specific SystemAccessImpl
+#elif defined(__QNXNTO__)
+    #include "ara/os/qnx/system/system.h"   // QNX-specific SystemAccessImpl
+#else
+    /* Unsupported platform: Generate a compile-time error */
+    #error "Unsupported platform. No SystemAccess backend is available."
+#endif
+
+#include <memory> // For std::unique_ptr
+
+namespace ara {
+namespace os {
+namespace interface {
+namespace system {
+
+/**********************************************************************************************************************
+ *  TYPE ALIAS: PlatformSystemAccess
+ *********************************************************************************************************************/
+/*!
+ * \brief  The static SystemAccess backend of the target platform, selected at compile time.
+ *
+ * \details
+ * - Use PlatformSystemAccess::GetCpuTopology(...) where no SystemInteraction object is needed: it compiles to a
+ *   direct call into the Linux or QNX implementation, without heap allocation and without virtual dispatch.
+ * - Use SystemFactory::CreateInstance() where a SystemInteraction object is needed (e.g., to inject a mock
+ *   topology in tests).
+ */
+#if defined(__linux__)
+using PlatformSystemAccess = ara::os::linux::system::SystemAccessImpl;
+#elif defined(__QNXNTO__)
+using PlatformSystemAccess = ara::os::qnx::system::SystemAccessImpl;
+#endif
+
+/**********************************************************************************************************************
+ *  CLASS: SystemFactory
+ *********************************************************************************************************************/
+/*!
+ * \brief  Factory class for creating ara::os::interface::system::SystemInteraction instances.
+ *
+ * \details
+ * - Determines the target platform at compile-time and instantiates the corresponding SystemInteraction implementation.
+ * - Thread-safe and stateless, allowing concurrent access in multi-threaded environments.
+ */
+class SystemFactory {
+public:
+    /*!
+     * \brief  Creates a platform-specific SystemInteraction instance.
+     *
+     * \return A std::unique_ptr to an ara::os::interface::system::SystemInteraction object.
+     *         Compilation fails if the platform is unsupported.
+     *
+     * \note   This method is thread-safe and can be called concurrently from multiple threads.
+     */
+    static auto CreateInstance() noexcept -> std::unique_ptr<SystemInteraction>;
+};
+
+} // namespace system
+} // namespace interface
+} // namespace os
+} // namespace ara
+
+#endif // OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_OS_INTERFACE_SYSTEM_SYSTEM_FACTORY_H_
@@ -0,0 +1,79 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project (CXX_STANDARD 17)
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara/os/interface/system/system_interaction.h
+ *  \brief      Definition of the ara::os::interface::system::SystemInteraction interface.
+ *
+ *  \details    This file defines the ara::os::interface::system::SystemInteraction interface for retrieving the
+ *              CPU topology and cache geometry of the system.
+ *
+ *  \note       While not specified by AUTOSAR requirements, this interface is essential for creating a generic
+ *              platform solution to abstract OS-specific functionalities.
+ ***********************************************************************************************************************/
+
+#ifndef OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_OS_INTERFACE_SYSTEM_SYSTEM_INTERACTION_H_
+#define OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_OS_INTERFACE_SYSTEM_SYSTEM_INTERACTION_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+/*!
+ * \brief  Includes the CpuTopology definition and the shared ErrorCode.
+ */
+#include "ara/os/interface/system/cpu_topology.h"
+
+#include <cstddef>      // For std::size_t
+
+namespace ara {
+namespace os {
+namespace interface {
+namespace system {
+
+/**********************************************************************************************************************
+ *  CLASS: SystemInteraction
+ *********************************************************************************************************************/
+/*!
+ * \brief  Abstract interface for system-related functionalities.
+ *
+ * \details
+ * - Provides methods to retrieve the CPU topology and cache geometry in a platform-agnostic manner.
+ * - Implementations must ensure thread safety and handle any platform-specific nuances.
+ *
+ * \note   This interface serves as an abstraction layer to interact with different operating systems seamlessly.
+ */
+class SystemInteraction {
+public:
+    /*!
+     * \brief  Virtual destructor for proper cleanup of derived classes.
+     */
+    virtual ~SystemInteraction() = default;
+
+    /*!
+     * \brief  Reads the topology of all CPUs.
+     *
+     * \param[out] topology  Receives the topology; it is reset first.
+     *
+     * \return ErrorCode::Success, Truncated (more CPUs than CpuSet::kMaxCpus) or RetrievalFailed.
+     *
+     * \note   Reads a few files per CPU on Linux: call it at startup, not on a hot path.
+     */
+    virtual auto GetCpuTopology(CpuTopology& topology) const noexcept -> ErrorCode = 0;
+
+    /*!
+     * \brief  Coherency line size of the data caches of CPU 0 in bytes, or 0 if unknown.
+     */
+    virtual auto GetCacheLineSize() const noexcept -> std::size_t = 0;
+};
+
+} // namespace system
+} // namespace interface
+} // namespace os
+} // namespace ara
+
+#endif // OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_OS_INTERFACE_SYSTEM_SYSTEM_INTERACTION_H_
@@ -0,0 +1,229 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project (CXX_STANDARD 17)
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara/os/interface/thread/thread.h
+ *  \brief      Declaration of the ara::os::interface::thread::Thread.
+ *
+ *  \details    A Thread is created with its complete real-time setup: CPU affinity, scheduling policy and priority,
+ *              stack size, stack prefaulting and name. All of it is applied before the entry function runs, and a
+ *              setting that cannot be applied makes Start() fail instead of leaving a thread running with the wrong
+ *              scheduling. Pinning periodic work to isolated cores and prefaulting its stack removes migrations and
+ *              page faults from its first cycles.
+ *
+ *  \note       No heap allocation happens at any point; the Thread object must outlive its thread (the destructor
+ *              joins it).
+ ***********************************************************************************************************************/
+
+#ifndef OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_OS_INTERFACE_THREAD_THREAD_H_
+#define OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_OS_INTERFACE_THREAD_THREAD_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+/*!
+ * \brief  Includes the ThreadControl interface header.
+ */
+#include "ara/os/interface/thread/thread_control.h"
+
+// Include platform-specific headers for the static ThreadControl backends
+#if defined(__linux__)
+    #include "ara/os/linux/thread/thread_control.h" // Linux-specific ThreadControlImpl
+#elif defined(__QNXNTO__)
+    #include "ara/os/qnx/thread/thread_control.h"   // QNX-specific ThreadControlImpl
+#else
+    /* Unsupported platform: Generate a compile-time error */
+    #error "Unsupported platform. No ThreadControl backend is available."
+#endif
+
+#include <pthread.h>    // For pthread_t
+#include <semaphore.h>  // For sem_t
+#include <cstddef>      // For std::size_t
+#include <cstdint>      // For fixed-width integer types
+
+namespace ara {
+namespace os {
+namespace interface {
+namespace thread {
+
+/**********************************************************************************************************************
+ *  TYPE ALIAS: PlatformThreadControl
+ *********************************************************************************************************************/
+/*!
+ * \brief  The static ThreadControl backend of the target platform, selected at compile time.
+ */
+#if defined(__linux__)
+using PlatformThreadControl = ara::os::linux::thread::ThreadControlImpl;
+#elif defined(__QNXNTO__)
+using PlatformThreadControl = ara::os::qnx::thread::ThreadControlImpl;
+#endif
+
+/**********************************************************************************************************************
+ *  ENUM: SchedulingPolicy
+ *********************************************************************************************************************/
+/*!
+ * \brief  Scheduling policy of a thread.
+ */
+enum class SchedulingPolicy : uint8_t {
+    Inherit = 0,    /*!< Keep the policy and priority of the creating thread */
+    Other,          /*!< SCHED_OTHER (time-sharing) */
+    Fifo,           /*!< SCHED_FIFO (real-time, run to completion within a priority) */
+    RoundRobin      /*!< SCHED_RR (real-time, time-sliced within a priority) */
+};
+
+/**********************************************************************************************************************
+ *  STRUCT: SchedulingInfo
+ *********************************************************************************************************************/
+/*!
+ * \brief  Scheduling of a running thread. Policies other than FIFO and RR (e.g., SCHED_BATCH) are reported as Other.
+ */
+struct SchedulingInfo {
+    SchedulingPolicy policy{SchedulingPolicy::Other};   /*!< Current policy (never Inherit) */
+    std::int32_t     priority{0};                       /*!< Current priority */
+};
+
+/**********************************************************************************************************************
+ *  TYPE ALIAS: ThreadFunction
+ *********************************************************************************************************************/
+/*!
+ * \brief  Entry function of a thread. Invoked on the new thread with the configured context.
+ */
+using ThreadFunction = void (*)(void* context) noexcept;
+
+/**********************************************************************************************************************
+ *  STRUCT: ThreadConfig
+ *********************************************************************************************************************/
+/*!
+ * \brief  Configuration of a thread.
+ *
+ * \details
+ * - policy / priority: Inherit requires priority 0; the others require a priority within the range of the policy
+ *                      (FIFO and RR usually need privileges: Start() then reports PermissionDenied).
+ * - affinity:          CPUs the thread may run on; empty keeps the affinity of the creating thread.
+ * - stackSize:         0 keeps the default stack size; otherwise at least PTHREAD_STACK_MIN.
+ * - stackPrefault:     Bytes of stack touched before the entry runs (0: none). Together with mlockall(MCL_FUTURE)
+ *                      the pages stay resident; it must leave kPrefaultReserve bytes of the stack untouched.
+ * - name:              Thread name (truncated to the platform limit); nullptr keeps the inherited name.
+ */
+struct ThreadConfig {
+    const char*      name{nullptr};
+    ThreadFunction   entry{nullptr};
+    void*            context{nullptr};
+    SchedulingPolicy policy{SchedulingPolicy::Inherit};
+    std::int32_t     priority{0};
+    CpuSet           affinity{};
+    std::size_t      stackSize{0U};
+    std::size_t      stackPrefault{0U};
+};
+
+/**********************************************************************************************************************
+ *  CLASS: Thread
+ *********************************************************************************************************************/
+/*!
+ * \brief  Thread created with an explicit real-time setup.
+ *
+ * \details
+ * - Start() returns only after the new thread has applied its setup, with the outcome of that setup; on a failure
+ *   the entry is not run and the thread is already joined.
+ * - A Thread runs one thread at a time; after Join() it can be started again.
+ * - Not copyable or movable: the running thread references the object.
+ */
+class Thread final {
+public:
+    /*!
+     * \brief  Stack bytes that stackPrefault must leave untouched (frames of the entry and of the setup itself).
+     */
+    static constexpr std::size_t kPrefaultReserve{16384U};
+
+    Thread() noexcept = default;
+
+    /*!
+     * \brief  Joins the thread if it was started and not yet joined.
+     */
+    ~Thread() noexcept;
+
+    Thread(const Thread&) = delete;
+    Thread(Thread&&) = delete;
+    auto operator=(const Thread&) -> Thread& = delete;
+    auto operator=(Thread&&) -> Thread& = delete;
+
+    /*!
+     * \brief  Checks \c config without creating a thread.
+     *
+     * \return ErrorCode::Success or InvalidArgument.
+     */
+    static auto ValidateConfig(const ThreadConfig& config) noexcept -> ErrorCode;
+
+    /*!
+     * \brief  Creates the thread, applies the setup of \c config in it and then runs the entry.
+     *
+     * \return ErrorCode::Success, InvalidArgument, AlreadyStarted, PermissionDenied, CreationFailed or SetupFailed.
+     */
+    auto Start(const ThreadConfig& config) noexcept -> ErrorCode;
+
+    /*!
+     * \brief  Waits for the entry to return.
+     *
+     * \return ErrorCode::Success, or NotStarted if there is no thread to join.
+     */
+    auto Join() noexcept -> ErrorCode;
+
+    /*!
+     * \brief  Whether a thread was started and not yet joined.
+     */
+    auto IsStarted() const noexcept -> bool;
+
+    /*!
+     * \brief  pthread handle of the started thread (unspecified if not started).
+     */
+    auto GetNativeHandle() const noexcept -> pthread_t;
+
+    /*!
+     * \brief  Names the calling thread (truncated to the platform limit).
+     */
+    static auto SetCurrentName(const char* name) noexcept -> ErrorCode;
+
+    /*!
+     * \brief  Restricts the calling thread to \c cpus.
+     */
+    static auto SetCurrentAffinity(const CpuSet& cpus) noexcept -> ErrorCode;
+
+    /*!
+     * \brief  Reads the affinity of the calling thread.
+     */
+    static auto GetCurrentAffinity(CpuSet& cpus) noexcept -> ErrorCode;
+
+    /*!
+     * \brief  Scheduling policy and priority of the calling thread.
+     */
+    static auto GetCurrentScheduling() noexcept -> SchedulingInfo;
+
+    /*!
+     * \brief  Number of CPUs configured in the system.
+     */
+    static auto GetCpuCount() noexcept -> std::size_t;
+
+private:
+    /*!
+     * \brief  pthread entry point; \c argument is the Thread.
+     */
+    static auto Entry(void* argument) noexcept -> void*;
+
+    ThreadConfig config_{};
+    pthread_t    handle_{};
+    bool         started_{false};
+    sem_t        ready_{};
+    ErrorCode    setupResult_{ErrorCode::Success};
+};
+
+} // namespace thread
+} // namespace interface
+} // namespace os
+} // namespace ara
+
+#endif // OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_OS_INTERFACE_THREAD_THREAD_H_
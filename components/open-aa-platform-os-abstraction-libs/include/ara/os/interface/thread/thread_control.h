@@ -0,0 +1,238 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project (CXX_STANDARD 17)
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara/os/interface/thread/thread_control.h
+ *  \brief      Definition of the ara::os::interface::thread::ThreadControl static (CRTP) interface.
+ *
+ *  \details    ThreadControl covers the thread settings that POSIX leaves to each OS: the CPU affinity (cpu_set_t on
+ *              Linux, runmasks on QNX), the thread name and the number of CPUs. Scheduling policy, priority and stack
+ *              size are plain POSIX and handled by ara::os::interface::thread::Thread itself.
+ *
+ *  \note       Platform backends derive from ThreadControl<Backend>. No virtual dispatch and no heap allocation is
+ *              involved.
+ ***********************************************************************************************************************/
+
+#ifndef OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_OS_INTERFACE_THREAD_THREAD_CONTROL_H_
+#define OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_OS_INTERFACE_THREAD_THREAD_CONTROL_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <pthread.h>    // For pthread_attr_t
+#include <cstddef>      // For std::size_t
+#include <cstdint>      // For fixed-width integer types
+
+namespace ara {
+namespace os {
+namespace interface {
+namespace thread {
+
+/**********************************************************************************************************************
+ *  ENUM: ErrorCode
+ *********************************************************************************************************************/
+/*!
+ * \brief  Enumeration of possible error codes for the thread operations.
+ */
+enum class ErrorCode : uint8_t {
+    Success = 0,                   /*!< Operation completed successfully */
+    InvalidArgument,               /*!< A configuration value is out of range (e.g., no entry, priority, stack) */
+    AlreadyStarted,                /*!< The thread object already runs (or ran and was not joined) a thread */
+    NotStarted,                    /*!< The thread object has no thread to join */
+    PermissionDenied,              /*!< The requested policy, priority or affinity needs privileges */
+    CreationFailed,                /*!< The OS refused to create the thread (resources, attributes) */
+    SetupFailed,                   /*!< Applying the affinity or name in the new thread failed; it was not run */
+    UnknownError                   /*!< An unknown error occurred */
+};
+
+/**********************************************************************************************************************
+ *  CLASS: CpuSet
+ *********************************************************************************************************************/
+/*!
+ * \brief  Fixed-size set of CPU indices, used as affinity mask.
+ *
+ * \details An empty set means "no affinity requested": the thread keeps the affinity of its creator.
+ */
+class CpuSet final {
+public:
+    /*!
+     * \brief  Number of CPUs a set can hold (indices 0 .. kMaxCpus - 1).
+     */
+    static constexpr std::size_t kMaxCpus{128U};
+
+    /*!
+     * \brief  Number of 64-bit words of the mask.
+     */
+    static constexpr std::size_t kWordCount{kMaxCpus / 64U};
+
+    constexpr CpuSet() noexcept = default;
+
+    /*!
+     * \brief  Adds \c cpu to the set.
+     *
+     * \return \c false (and the set is unchanged) if \c cpu >= kMaxCpus.
+     */
+    constexpr auto Add(std::size_t cpu) noexcept -> bool
+    {
+        if (cpu >= kMaxCpus) {
+            return false;
+        }
+        words_[cpu / 64U] |= (std::uint64_t{1U} << (cpu % 64U));
+        return true;
+    }
+
+    /*!
+     * \brief  Removes \c cpu from the set (no-op if absent or out of range).
+     */
+    constexpr auto Remove(std::size_t cpu) noexcept -> void
+    {
+        if (cpu < kMaxCpus) {
+            words_[cpu / 64U] &= ~(std::uint64_t{1U} << (cpu % 64U));
+        }
+    }
+
+    /*!
+     * \brief  Whether \c cpu is in the set.
+     */
+    constexpr auto Contains(std::size_t cpu) const noexcept -> bool
+    {
+        return (cpu < kMaxCpus) && ((words_[cpu / 64U] & (std::uint64_t{1U} << (cpu % 64U))) != 0U);
+    }
+
+    /*!
+     * \brief  Number of CPUs in the set.
+     */
+    constexpr auto Count() const noexcept -> std::size_t
+    {
+        std::size_t count{0U};
+        for (std::uint64_t word : words_) {
+            while (word != 0U) {
+                word &= (word - 1U);
+                ++count;
+            }
+        }
+        return count;
+    }
+
+    /*!
+     * \brief  Whether the set is empty (no affinity requested).
+     */
+    constexpr auto IsEmpty() const noexcept -> bool
+    {
+        for (std::uint64_t const word : words_) {
+            if (word != 0U) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /*!
+     * \brief  Word \c index of the mask (bit i of word w is CPU 64 * w + i); 0 for an invalid index.
+     */
+    constexpr auto GetWord(std::size_t index) const noexcept -> std::uint64_t
+    {
+        return (index < kWordCount) ? words_[index] : 0U;
+    }
+
+private:
+    std::uint64_t words_[kWordCount]{};
+};
+
+/**********************************************************************************************************************
+ *  CLASS: ThreadControl
+ *********************************************************************************************************************/
+/*!
+ * \brief  Static (CRTP) interface of the platform-specific thread settings.
+ *
+ * \tparam Backend  The platform backend deriving from ThreadControl<Backend>.
+ *
+ * \details
+ * - Backend must provide:
+ *   - static constexpr bool kHasAttributeAffinity;
+ *   - static auto SetAttributeAffinityImpl(pthread_attr_t& attributes, const CpuSet& cpus) noexcept -> ErrorCode;
+ *   - static auto SetCurrentAffinityImpl(const CpuSet& cpus) noexcept -> ErrorCode;
+ *   - static auto GetCurrentAffinityImpl(CpuSet& cpus) noexcept -> ErrorCode;
+ *   - static auto SetCurrentNameImpl(const char* name) noexcept -> ErrorCode;
+ *   - static auto GetCpuCountImpl() noexcept -> std::size_t;
+ * - Where the affinity can be carried by the creation attributes (kHasAttributeAffinity), the kernel applies it
+ *   before the thread runs at all; otherwise Thread sets it first thing in the new thread, before the entry.
+ */
+template <typename Backend>
+class ThreadControl {
+public:
+    /*!
+     * \brief  Whether SetAttributeAffinity() is supported by the platform.
+     */
+    static constexpr auto HasAttributeAffinity() noexcept -> bool
+    {
+        return Backend::kHasAttributeAffinity;
+    }
+
+    /*!
+     * \brief  Stores \c cpus in the creation attributes (only if HasAttributeAffinity()).
+     *
+     * \return ErrorCode::Success, InvalidArgument (empty set, or not supported) or CreationFailed.
+     */
+    static auto SetAttributeAffinity(pthread_attr_t& attributes, const CpuSet& cpus) noexcept -> ErrorCode
+    {
+        return Backend::SetAttributeAffinityImpl(attributes, cpus);
+    }
+
+    /*!
+     * \brief  Restricts the calling thread to \c cpus.
+     *
+     * \return ErrorCode::Success, InvalidArgument (empty or no online CPU), PermissionDenied or SetupFailed.
+     */
+    static auto SetCurrentAffinity(const CpuSet& cpus) noexcept -> ErrorCode
+    {
+        return Backend::SetCurrentAffinityImpl(cpus);
+    }
+
+    /*!
+     * \brief  Reads the affinity of the calling thread into \c cpus.
+     *
+     * \return ErrorCode::Success or SetupFailed.
+     */
+    static auto GetCurrentAffinity(CpuSet& cpus) noexcept -> ErrorCode
+    {
+        return Backend::GetCurrentAffinityImpl(cpus);
+    }
+
+    /*!
+     * \brief  Names the calling thread (truncated to the platform limit).
+     *
+     * \return ErrorCode::Success, InvalidArgument (nullptr) or SetupFailed.
+     */
+    static auto SetCurrentName(const char* name) noexcept -> ErrorCode
+    {
+        return Backend::SetCurrentNameImpl(name);
+    }
+
+    /*!
+     * \brief  Number of CPUs configured in the system (at least 1).
+     */
+    static auto GetCpuCount() noexcept -> std::size_t
+    {
+        return Backend::GetCpuCountImpl();
+    }
+
+protected:
+    /*!
+     * \brief  Protected constructor and destructor: ThreadControl is only used as a CRTP base.
+     */
+    constexpr ThreadControl() noexcept = default;
+    ~ThreadControl() = default;
+};
+
+} // namespace thread
+} // namespace interface
+} // namespace os
+} // namespace ara
+
+#endif // OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_OS_INTERFACE_THREAD_THREAD_CONTROL_H_
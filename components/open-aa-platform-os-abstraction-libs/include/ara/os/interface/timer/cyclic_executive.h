@@ -0,0 +1,289 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project (CXX_STANDARD 17)
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara/os/interface/timer/cyclic_executive.h
+ *  \brief      Declaration of the ara::os::interface::timer::CyclicExecutive.
+ *
+ *  \details    A CyclicExecutive runs up to kMaxRateGroups periodic tasks ("rate groups") per process, each on its
+ *              own thread. Release k of a rate group is scheduled at the absolute time
+ *
+ *                  epoch + offset + k * period
+ *
+ *              and the thread sleeps with the platform DeadlineTimer until that instant. Release times are computed
+ *              from the shared epoch, never from the previous wake-up, so wake-up jitter and execution time do not
+ *              accumulate into drift. Releases that could not be served in time are handled per rate group by an
+ *              OverrunPolicy.
+ *
+ *  \note       Configuration is done before Start(); no heap allocation happens at any point.
+ ***********************************************************************************************************************/
+
+#ifndef OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_OS_INTERFACE_TIMER_CYCLIC_EXECUTIVE_H_
+#define OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_OS_INTERFACE_TIMER_CYCLIC_EXECUTIVE_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+/*!
+ * \brief  Includes the DeadlineTimer interface header.
+ */
+#include "ara/os/interface/timer/deadline_timer.h"
+
+// Include platform-specific headers for the static DeadlineTimer backends
+#if defined(__linux__)
+    #include "ara/os/linux/timer/deadline_timer.h" // Linux-specific DeadlineTimerImpl
+#elif defined(__QNXNTO__)
+    #include "ara/os/qnx/timer/deadline_timer.h"   // QNX-specific DeadlineTimerImpl
+#else
+    /* Unsupported platform: Generate a compile-time error */
+    #error "Unsupported platform. No DeadlineTimer backend is available."
+#endif
+
+#include "ara/core/internal/metrics.h"     // For the optional per rate group CycleMetrics
+#include "ara/os/interface/thread/thread.h" // For the rate group threads and their CpuSet affinity
+
+#include <atomic>       // For std::atomic
+#include <chrono>       // For std::chrono::nanoseconds
+#include <cstddef>      // For std::size_t
+#include <cstdint>      // For fixed-width integer types
+
+namespace ara {
+namespace os {
+namespace interface {
+namespace timer {
+
+/**********************************************************************************************************************
+ *  TYPE ALIAS: PlatformDeadlineTimer
+ *********************************************************************************************************************/
+/*!
+ * \brief  The static DeadlineTimer backend of the target platform, selected at compile time.
+ */
+#if defined(__linux__)
+using PlatformDeadlineTimer = ara::os::linux::timer::DeadlineTimerImpl;
+#elif defined(__QNXNTO__)
+using PlatformDeadlineTimer = ara::os::qnx::timer::DeadlineTimerImpl;
+#endif
+
+/**********************************************************************************************************************
+ *  ENUM: OverrunPolicy
+ *********************************************************************************************************************/
+/*!
+ * \brief  What a rate group does when a cycle finishes after the release time of the next cycle.
+ */
+enum class OverrunPolicy : uint8_t {
+    Skip = 0,   /*!< Drop the releases that have already passed and resume at the next future release */
+    CatchUp,    /*!< Run the releases that have already passed back-to-back, without sleeping */
+    Report      /*!< Call the rate group's OverrunHandler, then behave like Skip */
+};
+
+/**********************************************************************************************************************
+ *  STRUCT: CycleInfo
+ *********************************************************************************************************************/
+/*!
+ * \brief  Information passed to the task on every release.
+ */
+struct CycleInfo {
+    std::uint64_t            cycle{0U};         /*!< Release index k (skipped releases are not executed) */
+    MonotonicTime            release{0};        /*!< Scheduled release time: epoch + offset + k * period */
+    std::chrono::nanoseconds lateness{0};       /*!< Actual start time minus the scheduled release time */
+};
+
+/**********************************************************************************************************************
+ *  STRUCT: OverrunInfo
+ *********************************************************************************************************************/
+/*!
+ * \brief  Information passed to the OverrunHandler of a rate group using OverrunPolicy::Report.
+ */
+struct OverrunInfo {
+    std::uint64_t            cycle{0U};         /*!< Release index of the cycle that overran */
+    std::chrono::nanoseconds executionTime{0};  /*!< Execution time of the cycle that overran */
+    std::uint64_t            missedReleases{0U};/*!< Number of releases that passed while it was running */
+};
+
+/**********************************************************************************************************************
+ *  TYPE ALIASES: TaskFunction, OverrunHandler
+ *********************************************************************************************************************/
+/*!
+ * \brief  Periodic task. Invoked on the rate group thread with the configured context.
+ */
+using TaskFunction = void (*)(void* context, const CycleInfo& info) noexcept;
+
+/*!
+ * \brief  Overrun notification. Invoked on the rate group thread with the configured context.
+ */
+using OverrunHandler = void (*)(void* context, const OverrunInfo& info) noexcept;
+
+/**********************************************************************************************************************
+ *  STRUCT: RateGroupConfig
+ *********************************************************************************************************************/
+/*!
+ * \brief  Configuration of a single rate group.
+ *
+ * \details
+ * - period:   Release period; must be greater than zero.
+ * - offset:   Phase of release 0 relative to the executive's epoch; must be in [0, period).
+ * - priority: 0 keeps the scheduling of the thread calling Start(); a value > 0 requests SCHED_FIFO with that
+ *             priority (which may require privileges; Start() then reports ThreadCreationFailed).
+ * - affinity: CPUs the rate group thread is pinned to before its first release; empty keeps the affinity of the
+ *             thread calling Start().
+ * - name:     Thread name (truncated to 15 characters); nullptr keeps the inherited name.
+ * - metrics:  Optional CycleMetrics receiving the wake-up latency and execution time of every cycle and every
+ *             overrun. It must outlive the run; it can be read from any thread while the executive is running.
+ */
+struct RateGroupConfig {
+    const char*              name{nullptr};
+    std::chrono::nanoseconds period{0};
+    std::chrono::nanoseconds offset{0};
+    OverrunPolicy            policy{OverrunPolicy::Skip};
+    std::int32_t             priority{0};
+    ara::os::interface::thread::CpuSet affinity{};
+    TaskFunction             task{nullptr};
+    OverrunHandler           overrunHandler{nullptr};
+    void*                    context{nullptr};
+    ara::core::internal::metrics::CycleMetrics* metrics{nullptr};
+};
+
+/**********************************************************************************************************************
+ *  STRUCT: RateGroupStatistics
+ *********************************************************************************************************************/
+/*!
+ * \brief  Snapshot of the run-time statistics of a rate group.
+ */
+struct RateGroupStatistics {
+    std::uint64_t            cycles{0U};            /*!< Number of executed cycles */
+    std::uint64_t            overruns{0U};          /*!< Number of cycles that finished after the next release */
+    std::uint64_t            skippedReleases{0U};   /*!< Number of releases dropped by Skip/Report */
+    std::chrono::nanoseconds maxLateness{0};        /*!< Largest start time minus scheduled release time */
+    std::chrono::nanoseconds maxExecutionTime{0};   /*!< Largest execution time of a single cycle */
+    ErrorCode                lastError{ErrorCode::Success}; /*!< Error that terminated the thread, if any */
+};
+
+/**********************************************************************************************************************
+ *  CLASS: CyclicExecutive
+ *********************************************************************************************************************/
+/*!
+ * \brief  Drift-free periodic scheduler running several rate groups on absolute deadlines.
+ *
+ * \details
+ * - AddRateGroup() is only allowed while the executive is stopped.
+ * - Start() takes a common epoch (now + kStartMargin) so that all rate groups are phase-aligned.
+ * - Stop() interrupts the deadline sleep of every rate group and returns once their threads have been joined, so
+ *   its latency is bounded by one execution of the longest-running task.
+ * - Not copyable or movable: the rate group threads reference the executive.
+ */
+class CyclicExecutive final {
+public:
+    /*!
+     * \brief  Maximum number of rate groups per executive.
+     */
+    static constexpr std::size_t kMaxRateGroups{8U};
+
+    /*!
+     * \brief  Delay between Start() and the common epoch, covering thread creation.
+     */
+    static constexpr std::chrono::nanoseconds kStartMargin{2000000};
+
+    CyclicExecutive() noexcept = default;
+
+    /*!
+     * \brief  Stops all rate groups (see Stop()).
+     */
+    ~CyclicExecutive() noexcept;
+
+    CyclicExecutive(const CyclicExecutive&) = delete;
+    CyclicExecutive(CyclicExecutive&&) = delete;
+    auto operator=(const CyclicExecutive&) -> CyclicExecutive& = delete;
+    auto operator=(CyclicExecutive&&) -> CyclicExecutive& = delete;
+
+    /*!
+     * \brief  Registers a rate group.
+     *
+     * \param[in] config  Rate group configuration (copied).
+     *
+     * \return ErrorCode::Success, InvalidArgument, CapacityExceeded or AlreadyRunning.
+     */
+    auto AddRateGroup(const RateGroupConfig& config) noexcept -> ErrorCode;
+
+    /*!
+     * \brief  Creates one thread per rate group and releases them on a common epoch.
+     *
+     * \return ErrorCode::Success, InvalidArgument (no rate group), AlreadyRunning, ResourceFailure (a timer could not
+     *         be opened) or ThreadCreationFailed. No thread is left running on a failure.
+     */
+    auto Start() noexcept -> ErrorCode;
+
+    /*!
+     * \brief  Requests all rate groups to stop and joins their threads. Safe to call when stopped.
+     */
+    auto Stop() noexcept -> void;
+
+    /*!
+     * \brief  Whether the rate group threads are running.
+     */
+    auto IsRunning() const noexcept -> bool;
+
+    /*!
+     * \brief  Number of registered rate groups.
+     */
+    auto GetRateGroupCount() const noexcept -> std::size_t;
+
+    /*!
+     * \brief  Common epoch of the current (or last) run; 0 before the first Start().
+     */
+    auto GetEpoch() const noexcept -> MonotonicTime;
+
+    /*!
+     * \brief  Returns a snapshot of the statistics of rate group \c index (all zero for an invalid index).
+     */
+    auto GetStatistics(std::size_t index) const noexcept -> RateGroupStatistics;
+
+private:
+    /*!
+     * \brief  Per rate group state. Statistics are written by the rate group thread only.
+     */
+    struct RateGroup {
+        RateGroupConfig               config{};
+        PlatformDeadlineTimer         timer{};
+        ara::os::interface::thread::Thread thread{};
+        CyclicExecutive*              owner{nullptr};
+        std::atomic<std::uint64_t>    cycles{0U};
+        std::atomic<std::uint64_t>    overruns{0U};
+        std::atomic<std::uint64_t>    skippedReleases{0U};
+        std::atomic<std::int64_t>     maxLateness{0};
+        std::atomic<std::int64_t>     maxExecutionTime{0};
+        std::atomic<ErrorCode>        lastError{ErrorCode::Success};
+    };
+
+    /*!
+     * \brief  Thread entry point; \c context is the RateGroup.
+     */
+    static auto ThreadEntry(void* context) noexcept -> void;
+
+    /*!
+     * \brief  Release loop of one rate group.
+     */
+    auto RunRateGroup(RateGroup& group) noexcept -> void;
+
+    /*!
+     * \brief  Wakes, joins and closes the timers of all started rate groups.
+     */
+    auto JoinRateGroups() noexcept -> void;
+
+    RateGroup                  groups_[kMaxRateGroups]{};
+    std::size_t                groupCount_{0U};
+    MonotonicTime              epoch_{0};
+    std::atomic<bool>          running_{false};
+    std::atomic<bool>          stopRequested_{false};
+};
+
+} // namespace timer
+} // namespace interface
+} // namespace os
+} // namespace ara
+
+#endif // OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_OS_INTERFACE_TIMER_CYCLIC_EXECUTIVE_H_
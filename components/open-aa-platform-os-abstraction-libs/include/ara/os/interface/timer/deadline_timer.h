@@ -0,0 +1,149 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project (CXX_STANDARD 17)
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara/os/interface/timer/deadline_timer.h
+ *  \brief      Definition of the ara::os::interface::timer::DeadlineTimer static (CRTP) interface.
+ *
+ *  \details    A DeadlineTimer reads the monotonic clock and sleeps until an absolute monotonic deadline. Sleeping
+ *              to absolute deadlines (instead of for a relative duration) keeps periodic activities free of drift:
+ *              the wake-up jitter of one cycle is not carried into the next one.
+ *
+ *  \note       Platform backends derive from DeadlineTimer<Backend> (Linux: timerfd with TFD_TIMER_ABSTIME, QNX:
+ *              timer pulses). No virtual dispatch and no heap allocation is involved.
+ ***********************************************************************************************************************/
+
+#ifndef OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_OS_INTERFACE_TIMER_DEADLINE_TIMER_H_
+#define OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_OS_INTERFACE_TIMER_DEADLINE_TIMER_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <chrono>       // For std::chrono::nanoseconds
+#include <cstdint>      // For fixed-width integer types
+
+namespace ara {
+namespace os {
+namespace interface {
+namespace timer {
+
+/**********************************************************************************************************************
+ *  ENUM: ErrorCode
+ *********************************************************************************************************************/
+/*!
+ * \brief  Enumeration of possible error codes for the timer and cyclic executive operations.
+ */
+enum class ErrorCode : uint8_t {
+    Success = 0,                   /*!< Operation completed successfully */
+    InvalidArgument,               /*!< A configuration value is out of range (e.g., period <= 0, no task) */
+    CapacityExceeded,              /*!< No free rate group slot is left */
+    AlreadyRunning,                /*!< The operation is not allowed while the executive is running */
+    ResourceFailure,               /*!< Creating an OS timer, channel or connection failed */
+    ThreadCreationFailed,          /*!< Creating a rate group thread (with the requested scheduling) failed */
+    ClockFailure,                  /*!< Reading the clock or sleeping until a deadline failed */
+    Interrupted,                   /*!< SleepUntil() was woken by Interrupt() before the deadline */
+    UnknownError                   /*!< An unknown error occurred */
+};
+
+/**********************************************************************************************************************
+ *  TYPE ALIAS: MonotonicTime
+ *********************************************************************************************************************/
+/*!
+ * \brief  Point in time on the monotonic clock (CLOCK_MONOTONIC), as the duration since the clock's epoch.
+ */
+using MonotonicTime = std::chrono::nanoseconds;
+
+/**********************************************************************************************************************
+ *  CLASS: DeadlineTimer
+ *********************************************************************************************************************/
+/*!
+ * \brief  Static (CRTP) interface of an absolute-deadline timer.
+ *
+ * \tparam Backend  The platform backend deriving from DeadlineTimer<Backend>.
+ *
+ * \details
+ * - Backend must provide:
+ *   - static auto NowImpl() noexcept -> MonotonicTime;
+ *   - auto OpenImpl() noexcept -> ErrorCode;
+ *   - auto SleepUntilImpl(MonotonicTime deadline) noexcept -> ErrorCode;
+ *   - auto InterruptImpl() noexcept -> void;
+ *   - auto CloseImpl() noexcept -> void;
+ * - One thread sleeps on a timer at a time. Interrupt() may be called from any thread while the timer is open;
+ *   Open() and Close() must not race with SleepUntil() or Interrupt().
+ */
+template <typename Backend>
+class DeadlineTimer {
+public:
+    /*!
+     * \brief  Reads the monotonic clock.
+     *
+     * \return The current monotonic time.
+     */
+    static auto Now() noexcept -> MonotonicTime
+    {
+        return Backend::NowImpl();
+    }
+
+    /*!
+     * \brief  Acquires the OS resources of the timer (no-op where none are needed).
+     *
+     * \return ErrorCode::Success, or ErrorCode::ResourceFailure.
+     */
+    auto Open() noexcept -> ErrorCode
+    {
+        return static_cast<Backend&>(*this).OpenImpl();
+    }
+
+    /*!
+     * \brief  Blocks the calling thread until the monotonic clock reaches \c deadline.
+     *
+     * \param[in] deadline  Absolute monotonic deadline. A deadline in the past returns immediately.
+     *
+     * \return ErrorCode::Success, ErrorCode::Interrupted, ErrorCode::ResourceFailure (timer not open), or
+     *         ErrorCode::ClockFailure.
+     *
+     * \note   Interruptions by signals are resumed internally; only Interrupt() makes the call return early.
+     */
+    auto SleepUntil(MonotonicTime deadline) noexcept -> ErrorCode
+    {
+        return static_cast<Backend&>(*this).SleepUntilImpl(deadline);
+    }
+
+    /*!
+     * \brief  Wakes the thread sleeping in SleepUntil() (which returns ErrorCode::Interrupted).
+     *
+     * \note   If no thread is sleeping, the next SleepUntil() returns ErrorCode::Interrupted immediately, so a wake-up
+     *         issued just before the sleep is never lost.
+     */
+    auto Interrupt() noexcept -> void
+    {
+        static_cast<Backend&>(*this).InterruptImpl();
+    }
+
+    /*!
+     * \brief  Releases the OS resources of the timer. Safe to call on a timer that is not open.
+     */
+    auto Close() noexcept -> void
+    {
+        static_cast<Backend&>(*this).CloseImpl();
+    }
+
+protected:
+    /*!
+     * \brief  Protected constructor and destructor: DeadlineTimer is only used as a CRTP base.
+     */
+    constexpr DeadlineTimer() noexcept = default;
+    ~DeadlineTimer() = default;
+};
+
+} // namespace timer
+} // namespace interface
+} // namespace os
+} // namespace ara
+
+#endif // OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_OS_INTERFACE_TIMER_DEADLINE_TIMER_H_
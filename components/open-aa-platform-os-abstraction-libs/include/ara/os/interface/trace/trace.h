@@ -0,0 +1,75 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project (CXX_STANDARD 17)
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara/os/interface/trace/trace.h
+ *  \brief      Selection of the ara::os::interface::trace::PlatformTraceAccess probe backend.
+ *
+ *  \details    The backend is chosen at configure time with the CMake cache variable ARA_OS_TRACE_BACKEND, which
+ *              ara::os::trace turns into one of the following compile definitions:
+ *              - (none)                          NONE:        NullTraceAccess, probes compile to nothing (default)
+ *              - ARA_OS_TRACE_BACKEND_USDT       USDT:        Linux, <sys/sdt.h> probes (bpftrace, perf, SystemTap)
+ *              - ARA_OS_TRACE_BACKEND_LTTNG      LTTNG:       Linux, LTTng-UST tracepoints (provider "ara_os")
+ *              - ARA_OS_TRACE_BACKEND_TRACELOGGER TRACELOGGER: QNX, user events of the instrumented kernel
+ *
+ *  \note       Include this header, not the platform headers; call the probes through PlatformTraceAccess.
+ ***********************************************************************************************************************/
+
+#ifndef OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_OS_INTERFACE_TRACE_TRACE_H_
+#define OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_OS_INTERFACE_TRACE_TRACE_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+/*!
+ * \brief  Includes the TraceAccess interface, the ProbeId and the NullTraceAccess backend.
+ */
+#include "ara/os/interface/trace/trace_access.h"
+
+// Include the platform-specific header of the selected probe backend
+#if defined(ARA_OS_TRACE_BACKEND_USDT) || defined(ARA_OS_TRACE_BACKEND_LTTNG)
+    #if !defined(__linux__)
+        #error "The USDT and LTTNG trace backends are only available on Linux."
+    #endif
+    #include "ara/os/linux/trace/trace.h"   // Linux-specific TraceAccessImpl
+#elif defined(ARA_OS_TRACE_BACKEND_TRACELOGGER)
+    #if !defined(__QNXNTO__)
+        #error "The TRACELOGGER trace backend is only available on QNX."
+    #endif
+    #include "ara/os/qnx/trace/trace.h"     // QNX-specific TraceAccessImpl
+#endif
+
+namespace ara {
+namespace os {
+namespace interface {
+namespace trace {
+
+/**********************************************************************************************************************
+ *  TYPE ALIAS: PlatformTraceAccess
+ *********************************************************************************************************************/
+/*!
+ * \brief  The probe backend selected at configure time.
+ *
+ * \details
+ * - PlatformTraceAccess::CycleBegin(...) compiles to a direct, inlined probe of the selected tracer.
+ * - PlatformTraceAccess::kEnabled tells whether probes are compiled in, e.g. to skip computing their arguments.
+ */
+#if defined(ARA_OS_TRACE_BACKEND_USDT) || defined(ARA_OS_TRACE_BACKEND_LTTNG)
+using PlatformTraceAccess = ara::os::linux::trace::TraceAccessImpl;
+#elif defined(ARA_OS_TRACE_BACKEND_TRACELOGGER)
+using PlatformTraceAccess = ara::os::qnx::trace::TraceAccessImpl;
+#else
+using PlatformTraceAccess = NullTraceAccess;
+#endif
+
+} // namespace trace
+} // namespace interface
+} // namespace os
+} // namespace ara
+
+#endif // OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_OS_INTERFACE_TRACE_TRACE_H_
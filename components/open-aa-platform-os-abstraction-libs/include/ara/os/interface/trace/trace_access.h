@@ -0,0 +1,152 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project (CXX_STANDARD 17)
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara/os/interface/trace/trace_access.h
+ *  \brief      Definition of the ara::os::interface::trace::TraceAccess static (CRTP) probe interface.
+ *
+ *  \details    This file defines the probes the platform emits to the system tracer (LTTng-UST or USDT on Linux,
+ *              the instrumented kernel's trace logger on QNX) and the NullTraceAccess backend used when tracing is
+ *              compiled out. Probes are static inline functions: an enabled probe costs a single nop (USDT), a
+ *              predicted branch (LTTng-UST) or a kernel call (QNX); a disabled probe compiles to nothing.
+ *
+ *  \note       There is deliberately no virtual TraceInteraction: a probe behind a vtable could not be compiled out.
+ ***********************************************************************************************************************/
+
+#ifndef OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_OS_INTERFACE_TRACE_TRACE_ACCESS_H_
+#define OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_OS_INTERFACE_TRACE_TRACE_ACCESS_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <cstdint>      // For std::uint32_t, std::uint64_t, std::int32_t
+
+namespace ara {
+namespace os {
+namespace interface {
+namespace trace {
+
+/**********************************************************************************************************************
+ *  ENUM: ProbeId
+ *********************************************************************************************************************/
+/*!
+ * \brief  Identifier of a probe.
+ *
+ * \details
+ * - LTTng-UST / USDT: the probe name is the snake_case form of the identifier (provider "ara_os").
+ * - QNX: the user event code is _NTO_TRACE_USERFIRST + ProbeId.
+ *
+ * \note   The values are part of the trace format; append new probes, do not renumber.
+ */
+enum class ProbeId : std::uint32_t {
+    CycleBegin     = 0U, /*!< cycle_begin(group, cycle):  a periodic task starts release \c cycle */
+    CycleEnd       = 1U, /*!< cycle_end(group, cycle):    a periodic task finished release \c cycle */
+    ShutdownSignal = 2U, /*!< shutdown_signal(signo):     a shutdown signal was received */
+    Violation      = 3U, /*!< violation(kind):            the ViolationHandler is about to abort the process */
+    UserEvent      = 4U  /*!< user_event(id, value):      application-defined event */
+};
+
+/**********************************************************************************************************************
+ *  CLASS: TraceAccess
+ *********************************************************************************************************************/
+/*!
+ * \brief  Static (CRTP) interface for the trace probes.
+ *
+ * \tparam Backend  The platform backend deriving from TraceAccess<Backend>.
+ *
+ * \details
+ * - Backend must provide:
+ *   - static constexpr bool kEnabled;
+ *   - static auto CycleBeginImpl(std::uint32_t group, std::uint64_t cycle) noexcept -> void;
+ *   - static auto CycleEndImpl(std::uint32_t group, std::uint64_t cycle) noexcept -> void;
+ *   - static auto ShutdownSignalImpl(std::int32_t signo) noexcept -> void;
+ *   - static auto ViolationImpl(std::uint32_t kind) noexcept -> void;
+ *   - static auto UserEventImpl(std::uint32_t id, std::uint64_t value) noexcept -> void;
+ * - Probes are async-signal-safe, lock-free and never allocate, so they may be called from a signal handler or on
+ *   the abort path. They do not report errors: a probe nobody listens to is not a failure.
+ */
+template <typename Backend>
+class TraceAccess {
+public:
+    /*!
+     * \brief  Start of release \c cycle of the periodic task \c group.
+     */
+    static auto CycleBegin(std::uint32_t group, std::uint64_t cycle) noexcept -> void
+    {
+        Backend::CycleBeginImpl(group, cycle);
+    }
+
+    /*!
+     * \brief  End of release \c cycle of the periodic task \c group.
+     */
+    static auto CycleEnd(std::uint32_t group, std::uint64_t cycle) noexcept -> void
+    {
+        Backend::CycleEndImpl(group, cycle);
+    }
+
+    /*!
+     * \brief  Receipt of the shutdown signal \c signo.
+     */
+    static auto ShutdownSignal(std::int32_t signo) noexcept -> void
+    {
+        Backend::ShutdownSignalImpl(signo);
+    }
+
+    /*!
+     * \brief  A violation of kind \c kind (ara::core::internal::ViolationKind) is about to abort the process.
+     */
+    static auto Violation(std::uint32_t kind) noexcept -> void
+    {
+        Backend::ViolationImpl(kind);
+    }
+
+    /*!
+     * \brief  Application-defined event \c id carrying \c value.
+     *
+     * \note   On QNX only the lower 32 bits of \c value are recorded.
+     */
+    static auto UserEvent(std::uint32_t id, std::uint64_t value) noexcept -> void
+    {
+        Backend::UserEventImpl(id, value);
+    }
+
+protected:
+    /*!
+     * \brief  Protected constructor and destructor: TraceAccess is only used as a CRTP base.
+     */
+    constexpr TraceAccess() noexcept = default;
+    ~TraceAccess() = default;
+};
+
+/**********************************************************************************************************************
+ *  CLASS: NullTraceAccess
+ *********************************************************************************************************************/
+/*!
+ * \brief  Backend of a build without tracing (ARA_OS_TRACE_BACKEND=NONE): every probe is an empty inline function.
+ *
+ * \details
+ * Once inlined (any optimization level above -O0) a probe call leaves no instruction behind; arguments without
+ * side effects are not even computed.
+ */
+class NullTraceAccess final : public TraceAccess<NullTraceAccess> {
+public:
+    static constexpr bool kEnabled{false};
+
+    static auto CycleBeginImpl(std::uint32_t /*group*/, std::uint64_t /*cycle*/) noexcept -> void {}
+    static auto CycleEndImpl(std::uint32_t /*group*/, std::uint64_t /*cycle*/) noexcept -> void {}
+    static auto ShutdownSignalImpl(std::int32_t /*signo*/) noexcept -> void {}
+    static auto ViolationImpl(std::uint32_t /*kind*/) noexcept -> void {}
+    static auto UserEventImpl(std::uint32_t /*id*/, std::uint64_t /*value*/) noexcept -> void {}
+};
+
+} // namespace trace
+} // namespace interface
+} // namespace os
+} // namespace ara
+
+#endif // OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_OS_INTERFACE_TRACE_TRACE_ACCESS_H_
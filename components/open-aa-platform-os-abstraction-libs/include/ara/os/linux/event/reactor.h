@@ -0,0 +1,138 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project (CXX_STANDARD 17)
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara/os/linux/event/reactor.h
+ *  \brief      Linux-specific backend of the ara::os::interface::event::Reactor interface.
+ *
+ *  \details    Declares ReactorImpl, which waits on one epoll instance watching a signalfd (all watched signals), one
+ *              CLOCK_MONOTONIC timerfd per timer source, the registered descriptors and an eventfd used by Wake().
+ *
+ *  \note       The epoll instance, the signalfd, the eventfd and the timerfds are owned by the reactor; they are
+ *              created by OpenImpl() / WatchTimerImpl() and released by CloseImpl() (or the destructor).
+ ***********************************************************************************************************************/
+
+#ifndef ARA_OS_LINUX_EVENT_REACTOR_H
+#define ARA_OS_LINUX_EVENT_REACTOR_H
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+/*!
+ * \brief  Includes the Reactor interface header.
+ */
+#include "ara/os/interface/event/reactor.h"
+
+#include <signal.h>     // For sigset_t, NSIG
+
+namespace ara {
+namespace os {
+namespace linux {
+namespace event {
+
+/**********************************************************************************************************************
+ *  CLASS: ReactorImpl
+ *********************************************************************************************************************/
+/*!
+ * \brief  Linux-specific backend of the ara::os::interface::event::Reactor interface.
+ *
+ * \details
+ * - WatchSignal():     adds the signal to the mask of the single signalfd and blocks it in the calling thread.
+ * - WatchTimer():      creates a periodic CLOCK_MONOTONIC timerfd; its read returns the expiration count.
+ * - WatchDescriptor(): adds the descriptor to the epoll set (level-triggered).
+ * - Wait():            one epoll_wait() for all sources; EINTR returns with no event.
+ * - Wake():            increments the eventfd counter (async-signal-safe, callable from any thread).
+ */
+class ReactorImpl final : public ara::os::interface::event::Reactor<ReactorImpl> {
+public:
+    /*!
+     * \brief  Constructs a closed reactor.
+     */
+    ReactorImpl() noexcept = default;
+
+    /*!
+     * \brief  Closes the file descriptors if still open.
+     */
+    ~ReactorImpl() noexcept;
+
+    ReactorImpl(const ReactorImpl&) = delete;
+    ReactorImpl(ReactorImpl&&) = delete;
+    auto operator=(const ReactorImpl&) -> ReactorImpl& = delete;
+    auto operator=(ReactorImpl&&) -> ReactorImpl& = delete;
+
+    /*!
+     * \brief  Creates the epoll instance and the wake eventfd.
+     */
+    auto OpenImpl() noexcept -> ara::os::interface::event::ErrorCode;
+
+    /*!
+     * \brief  Adds \c signalNumber to the signalfd mask.
+     */
+    auto WatchSignalImpl(std::uint32_t source, int signalNumber) noexcept -> ara::os::interface::event::ErrorCode;
+
+    /*!
+     * \brief  Creates and arms a periodic timerfd.
+     */
+    auto WatchTimerImpl(std::uint32_t source, std::chrono::nanoseconds period) noexcept
+        -> ara::os::interface::event::ErrorCode;
+
+    /*!
+     * \brief  Adds \c descriptor to the epoll set.
+     */
+    auto WatchDescriptorImpl(std::uint32_t source, int descriptor, std::uint32_t interest) noexcept
+        -> ara::os::interface::event::ErrorCode;
+
+    /*!
+     * \brief  Waits on the epoll instance and translates the ready descriptors into ReadyEvent records.
+     */
+    auto WaitImpl(ara::os::interface::event::ReadyEvent* events, std::size_t capacity,
+                  std::chrono::nanoseconds timeout, std::size_t& count) noexcept
+        -> ara::os::interface::event::ErrorCode;
+
+    /*!
+     * \brief  Wakes the waiting thread through the eventfd.
+     */
+    auto WakeImpl() noexcept -> void;
+
+    /*!
+     * \brief  Closes all descriptors owned by the reactor.
+     */
+    auto CloseImpl() noexcept -> void;
+
+private:
+    /*! \brief Whether \c source is a valid, not yet registered source number. */
+    auto IsFreeSource(std::uint32_t source) const noexcept -> bool;
+
+    /*! \brief epoll instance (-1 when closed). */
+    int epollFd_{-1};
+
+    /*! \brief eventfd signalled by Wake() (-1 when closed). */
+    int wakeFd_{-1};
+
+    /*! \brief signalfd receiving all watched signals (-1 until the first WatchSignal()). */
+    int signalFd_{-1};
+
+    /*! \brief Signals watched by the signalfd. */
+    sigset_t signals_{};
+
+    /*! \brief Source number + 1 of each watched signal (0: not watched). */
+    std::uint32_t signalSources_[NSIG]{};
+
+    /*! \brief Kind of each source number (0: not registered, see reactor.cpp). */
+    std::uint8_t kinds_[ara::os::interface::event::kMaxSources]{};
+
+    /*! \brief timerfd of each timer source (valid only for timer sources). */
+    int timerFds_[ara::os::interface::event::kMaxSources]{};
+};
+
+} // namespace event
+} // namespace linux
+} // namespace os
+} // namespace ara
+
+#endif // ARA_OS_LINUX_EVENT_REACTOR_H
@@ -10,7 +10,8 @@
  *  \file       ara/os/linux/process/process.h
  *  \brief      Linux-specific implementation of the ara::os::interface::process::ProcessInteraction interface.
  *
- *  \details    Declares the Linux-specific ProcessInteraction implementation and the factory function.
+ *  \details    Declares the Linux-specific ProcessInteraction implementation, the factory function and the
+ *              static (CRTP) backend ProcessAccessImpl used for allocation-free, devirtualized access.
  *
  *  \note       This class ensures that process-related functionalities are implemented using Linux system calls.
  ***********************************************************************************************************************/
@@ -25,6 +26,7 @@
  * \brief  Includes the ProcessInteraction interface header.
  */
 #include "ara/os/interface/process/process_interaction.h"
+#include "ara/os/interface/process/process_access.h"
 
 #include <memory> // For std::unique_ptr
 
@@ -33,6 +35,42 @@ namespace os {
 namespace linux {
 namespace process {
 
+/**********************************************************************************************************************
+ *  CLASS: ProcessAccessImpl
+ *********************************************************************************************************************/
+/*!
+ * \brief  Linux-specific static backend of the ara::os::interface::process::ProcessAccess interface.
+ *
+ * \details
+ * - Reads /proc/self/comm with a single raw read(2).
+ * - Reads the resource usage with getrusage() and the resident set size from /proc/self/statm.
+ * - No heap allocation, no virtual dispatch; reached via ProcessAccess<ProcessAccessImpl>::GetProcessName().
+ * - ProcessInteractionImpl::GetProcessName delegates to this backend, so both paths behave identically.
+ */
+class ProcessAccessImpl final : public ara::os::interface::process::ProcessAccess<ProcessAccessImpl> {
+public:
+    /*!
+     * \brief  Retrieves the name of the current process.
+     *
+     * \param[out] buffer      Pointer to the buffer where the process name will be stored.
+     * \param[in]  bufferSize  Size of the provided buffer in bytes.
+     *
+     * \return An ara::os::interface::process::ErrorCode indicating the result of the operation.
+     */
+    static auto GetProcessNameImpl(char* buffer, std::size_t bufferSize) noexcept
+        -> ara::os::interface::process::ErrorCode;
+
+    /*!
+     * \brief  Reads the resource usage of the current process.
+     *
+     * \param[out] usage  Receives the counters; unchanged on a failure.
+     *
+     * \return ara::os::interface::process::ErrorCode::Success or RetrievalFailed.
+     */
+    static auto GetResourceUsageImpl(ara::os::interface::process::ResourceUsage& usage) noexcept
+        -> ara::os::interface::process::ErrorCode;
+};
+
 /**********************************************************************************************************************
  *  CLASS: ProcessInteractionImpl
  *********************************************************************************************************************/
@@ -0,0 +1,78 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project (CXX_STANDARD 17)
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara/os/linux/shm/shared_memory_control.h
+ *  \brief      Linux-specific backend of the ara::os::interface::shm::SharedMemoryControl interface.
+ *
+ *  \details    Declares SharedMemoryControlImpl. Regular segments are POSIX shared-memory objects (tmpfs under
+ *              /dev/shm); huge-page segments are files of the same name on the hugetlbfs mount kHugePageMount, whose
+ *              block size is the huge page size.
+ ***********************************************************************************************************************/
+
+#ifndef ARA_OS_LINUX_SHM_SHARED_MEMORY_CONTROL_H
+#define ARA_OS_LINUX_SHM_SHARED_MEMORY_CONTROL_H
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+/*!
+ * \brief  Includes the SharedMemoryControl interface header.
+ */
+#include "ara/os/interface/shm/shared_memory_control.h"
+
+namespace ara {
+namespace os {
+namespace linux {
+namespace shm {
+
+/**********************************************************************************************************************
+ *  CLASS: SharedMemoryControlImpl
+ *********************************************************************************************************************/
+/*!
+ * \brief  Linux-specific backend of the ara::os::interface::shm::SharedMemoryControl interface.
+ *
+ * \details
+ * - Create(): shm_open(O_CREAT | O_EXCL) and ftruncate() to a multiple of the page size; with hugePages, open()
+ *             of kHugePageMount + name and ftruncate() to a multiple of the huge page size (statfs() block size).
+ * - Open():   shm_open() / open() with O_RDWR or O_RDONLY, and fstat() for the size.
+ * - Unlink(): shm_unlink() / unlink().
+ * - typedMemory is not supported (InvalidArgument).
+ */
+class SharedMemoryControlImpl final
+    : public ara::os::interface::shm::SharedMemoryControl<SharedMemoryControlImpl> {
+public:
+    /*!
+     * \brief  Mount point of the hugetlbfs file system holding the huge-page segments.
+     */
+    static constexpr const char* kHugePageMount{"/dev/hugepages"};
+
+    /*!
+     * \brief  Creates and sizes the memory object.
+     */
+    static auto CreateImpl(const ara::os::interface::shm::SegmentConfig& config, std::size_t& size, int& fd) noexcept
+        -> ara::os::interface::shm::ErrorCode;
+
+    /*!
+     * \brief  Opens the memory object and reads its size.
+     */
+    static auto OpenImpl(const ara::os::interface::shm::SegmentConfig& config, std::size_t& size, int& fd) noexcept
+        -> ara::os::interface::shm::ErrorCode;
+
+    /*!
+     * \brief  Removes the name of the memory object.
+     */
+    static auto UnlinkImpl(const char* name, bool hugePages) noexcept -> ara::os::interface::shm::ErrorCode;
+};
+
+} // namespace shm
+} // namespace linux
+} // namespace os
+} // namespace ara
+
+#endif // ARA_OS_LINUX_SHM_SHARED_MEMORY_CONTROL_H
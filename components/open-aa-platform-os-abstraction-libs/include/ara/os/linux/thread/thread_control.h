@@ -0,0 +1,88 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project (CXX_STANDARD 17)
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara/os/linux/thread/thread_control.h
+ *  \brief      Linux-specific backend of the ara::os::interface::thread::ThreadControl interface.
+ *
+ *  \details    Declares ThreadControlImpl, which maps a CpuSet onto a cpu_set_t. The affinity travels in the
+ *              creation attributes (pthread_attr_setaffinity_np), so the kernel places the new thread on an allowed
+ *              CPU before it executes a single instruction.
+ ***********************************************************************************************************************/
+
+#ifndef ARA_OS_LINUX_THREAD_THREAD_CONTROL_H
+#define ARA_OS_LINUX_THREAD_THREAD_CONTROL_H
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+/*!
+ * \brief  Includes the ThreadControl interface header.
+ */
+#include "ara/os/interface/thread/thread_control.h"
+
+namespace ara {
+namespace os {
+namespace linux {
+namespace thread {
+
+/**********************************************************************************************************************
+ *  CLASS: ThreadControlImpl
+ *********************************************************************************************************************/
+/*!
+ * \brief  Linux-specific backend of the ara::os::interface::thread::ThreadControl interface.
+ *
+ * \details
+ * - SetAttributeAffinity(): pthread_attr_setaffinity_np().
+ * - SetCurrentAffinity():   pthread_setaffinity_np() on the calling thread.
+ * - SetCurrentName():       pthread_setname_np(), truncated to 15 characters.
+ * - GetCpuCount():          sysconf(_SC_NPROCESSORS_CONF).
+ */
+class ThreadControlImpl final : public ara::os::interface::thread::ThreadControl<ThreadControlImpl> {
+public:
+    /*!
+     * \brief  The affinity is part of the creation attributes.
+     */
+    static constexpr bool kHasAttributeAffinity{true};
+
+    /*!
+     * \brief  Stores the affinity in the creation attributes.
+     */
+    static auto SetAttributeAffinityImpl(pthread_attr_t& attributes,
+                                         const ara::os::interface::thread::CpuSet& cpus) noexcept
+        -> ara::os::interface::thread::ErrorCode;
+
+    /*!
+     * \brief  Sets the affinity of the calling thread.
+     */
+    static auto SetCurrentAffinityImpl(const ara::os::interface::thread::CpuSet& cpus) noexcept
+        -> ara::os::interface::thread::ErrorCode;
+
+    /*!
+     * \brief  Reads the affinity of the calling thread.
+     */
+    static auto GetCurrentAffinityImpl(ara::os::interface::thread::CpuSet& cpus) noexcept
+        -> ara::os::interface::thread::ErrorCode;
+
+    /*!
+     * \brief  Names the calling thread.
+     */
+    static auto SetCurrentNameImpl(const char* name) noexcept -> ara::os::interface::thread::ErrorCode;
+
+    /*!
+     * \brief  Number of configured CPUs.
+     */
+    static auto GetCpuCountImpl() noexcept -> std::size_t;
+};
+
+} // namespace thread
+} // namespace linux
+} // namespace os
+} // namespace ara
+
+#endif // ARA_OS_LINUX_THREAD_THREAD_CONTROL_H
@@ -0,0 +1,105 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project (CXX_STANDARD 17)
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara/os/linux/timer/deadline_timer.h
+ *  \brief      Linux-specific backend of the ara::os::interface::timer::DeadlineTimer interface.
+ *
+ *  \details    Declares DeadlineTimerImpl, which reads CLOCK_MONOTONIC and sleeps on a CLOCK_MONOTONIC timerfd armed
+ *              with an absolute expiry (TFD_TIMER_ABSTIME), next to an eventfd used to wake the sleeper early.
+ *
+ *  \note       Each DeadlineTimerImpl owns one timerfd and one eventfd, created by OpenImpl() and released by
+ *              CloseImpl() (or the destructor).
+ ***********************************************************************************************************************/
+
+#ifndef ARA_OS_LINUX_TIMER_DEADLINE_TIMER_H
+#define ARA_OS_LINUX_TIMER_DEADLINE_TIMER_H
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+/*!
+ * \brief  Includes the DeadlineTimer interface header.
+ */
+#include "ara/os/interface/timer/deadline_timer.h"
+
+namespace ara {
+namespace os {
+namespace linux {
+namespace timer {
+
+/**********************************************************************************************************************
+ *  CLASS: DeadlineTimerImpl
+ *********************************************************************************************************************/
+/*!
+ * \brief  Linux-specific backend of the ara::os::interface::timer::DeadlineTimer interface.
+ *
+ * \details
+ * - Now():        clock_gettime(CLOCK_MONOTONIC).
+ * - SleepUntil(): timerfd_settime(TFD_TIMER_ABSTIME), then poll() on the timerfd and the eventfd; resumed after
+ *                 EINTR with the same deadline. The kernel compares the deadline against the clock itself, exactly
+ *                 as clock_nanosleep(TIMER_ABSTIME) does, while the eventfd keeps the sleep interruptible.
+ * - Interrupt():  increments the eventfd counter (async-signal-safe, callable from any thread).
+ */
+class DeadlineTimerImpl final : public ara::os::interface::timer::DeadlineTimer<DeadlineTimerImpl> {
+public:
+    /*!
+     * \brief  Constructs a closed timer.
+     */
+    DeadlineTimerImpl() noexcept = default;
+
+    /*!
+     * \brief  Closes the file descriptors if still open.
+     */
+    ~DeadlineTimerImpl() noexcept;
+
+    DeadlineTimerImpl(const DeadlineTimerImpl&) = delete;
+    DeadlineTimerImpl(DeadlineTimerImpl&&) = delete;
+    auto operator=(const DeadlineTimerImpl&) -> DeadlineTimerImpl& = delete;
+    auto operator=(DeadlineTimerImpl&&) -> DeadlineTimerImpl& = delete;
+
+    /*!
+     * \brief  Reads CLOCK_MONOTONIC.
+     */
+    static auto NowImpl() noexcept -> ara::os::interface::timer::MonotonicTime;
+
+    /*!
+     * \brief  Creates the timerfd and the eventfd.
+     */
+    auto OpenImpl() noexcept -> ara::os::interface::timer::ErrorCode;
+
+    /*!
+     * \brief  Arms the timerfd for \c deadline (absolute) and waits for its expiry or an interruption.
+     */
+    auto SleepUntilImpl(ara::os::interface::timer::MonotonicTime deadline) noexcept
+        -> ara::os::interface::timer::ErrorCode;
+
+    /*!
+     * \brief  Wakes the sleeping thread through the eventfd.
+     */
+    auto InterruptImpl() noexcept -> void;
+
+    /*!
+     * \brief  Closes the timerfd and the eventfd.
+     */
+    auto CloseImpl() noexcept -> void;
+
+private:
+    /*! \brief CLOCK_MONOTONIC timerfd (-1 when closed). */
+    int timerFd_{-1};
+
+    /*! \brief eventfd signalled by Interrupt() (-1 when closed). */
+    int wakeFd_{-1};
+};
+
+} // namespace timer
+} // namespace linux
+} // namespace os
+} // namespace ara
+
+#endif // ARA_OS_LINUX_TIMER_DEADLINE_TIMER_H
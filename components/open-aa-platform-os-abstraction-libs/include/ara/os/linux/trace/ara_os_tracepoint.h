@@ -0,0 +1,77 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project (CXX_STANDARD 17)
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara/os/linux/trace/ara_os_tracepoint.h
+ *  \brief      LTTng-UST tracepoint provider "ara_os".
+ *
+ *  \details    Describes the events of ara::os::interface::trace::ProbeId to LTTng-UST. The header is read several
+ *              times by lttng/tracepoint-event.h, hence the guard accepting TRACEPOINT_HEADER_MULTI_READ. The probes
+ *              are created once, in src/ara/os/linux/trace/tracepoint_provider.cpp, which is only part of
+ *              ara::os::trace when ARA_OS_TRACE_BACKEND=LTTNG.
+ *
+ *  \note       Only used by ARA_OS_TRACE_BACKEND_LTTNG builds; include ara/os/interface/trace/trace.h instead.
+ ***********************************************************************************************************************/
+
+#undef TRACEPOINT_PROVIDER
+#define TRACEPOINT_PROVIDER ara_os
+
+#undef TRACEPOINT_INCLUDE
+#define TRACEPOINT_INCLUDE "ara/os/linux/trace/ara_os_tracepoint.h"
+
+#if !defined(ARA_OS_LINUX_TRACE_ARA_OS_TRACEPOINT_H) || defined(TRACEPOINT_HEADER_MULTI_READ)
+#define ARA_OS_LINUX_TRACE_ARA_OS_TRACEPOINT_H
+
+#include <lttng/tracepoint.h>   // For TRACEPOINT_EVENT, TP_ARGS, TP_FIELDS, ctf_integer
+
+/* ProbeId::CycleBegin */
+TRACEPOINT_EVENT(ara_os, cycle_begin,
+    TP_ARGS(uint32_t, group, uint64_t, cycle),
+    TP_FIELDS(
+        ctf_integer(uint32_t, group, group)
+        ctf_integer(uint64_t, cycle, cycle)
+    )
+)
+
+/* ProbeId::CycleEnd */
+TRACEPOINT_EVENT(ara_os, cycle_end,
+    TP_ARGS(uint32_t, group, uint64_t, cycle),
+    TP_FIELDS(
+        ctf_integer(uint32_t, group, group)
+        ctf_integer(uint64_t, cycle, cycle)
+    )
+)
+
+/* ProbeId::ShutdownSignal */
+TRACEPOINT_EVENT(ara_os, shutdown_signal,
+    TP_ARGS(int32_t, signo),
+    TP_FIELDS(
+        ctf_integer(int32_t, signo, signo)
+    )
+)
+
+/* ProbeId::Violation */
+TRACEPOINT_EVENT(ara_os, violation,
+    TP_ARGS(uint32_t, kind),
+    TP_FIELDS(
+        ctf_integer(uint32_t, kind, kind)
+    )
+)
+
+/* ProbeId::UserEvent */
+TRACEPOINT_EVENT(ara_os, user_event,
+    TP_ARGS(uint32_t, id, uint64_t, value),
+    TP_FIELDS(
+        ctf_integer(uint32_t, id, id)
+        ctf_integer(uint64_t, value, value)
+    )
+)
+
+#endif // ARA_OS_LINUX_TRACE_ARA_OS_TRACEPOINT_H
+
+#include <lttng/tracepoint-event.h>
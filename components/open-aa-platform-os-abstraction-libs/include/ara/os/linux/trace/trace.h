@@ -0,0 +1,122 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project (CXX_STANDARD 17)
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara/os/linux/trace/trace.h
+ *  \brief      Linux-specific backend of the ara::os::interface::trace::TraceAccess probe interface.
+ *
+ *  \details    Declares the static (CRTP) backend TraceAccessImpl for one of two tracers, selected by ara::os::trace:
+ *              - ARA_OS_TRACE_BACKEND_USDT:  statically defined tracepoints of <sys/sdt.h>. A disarmed probe is a
+ *                single nop plus a note in .note.stapsdt; list them with `bpftrace -l 'usdt:<binary>:ara_os:*'`.
+ *              - ARA_OS_TRACE_BACKEND_LTTNG: LTTng-UST tracepoints of the provider "ara_os" (see
+ *                ara_os_tracepoint.h). A disabled tracepoint is a load and a predicted branch; enable them with
+ *                `lttng enable-event -u 'ara_os:*'`.
+ *
+ *  \note       Include ara/os/interface/trace/trace.h instead of this header.
+ ***********************************************************************************************************************/
+
+#ifndef ARA_OS_LINUX_TRACE_TRACE_H
+#define ARA_OS_LINUX_TRACE_TRACE_H
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+/*!
+ * \brief  Includes the TraceAccess interface header.
+ */
+#include "ara/os/interface/trace/trace_access.h"
+
+#if defined(ARA_OS_TRACE_BACKEND_USDT)
+    #include <sys/sdt.h>                            // For DTRACE_PROBE1, DTRACE_PROBE2 (systemtap-sdt-dev)
+#elif defined(ARA_OS_TRACE_BACKEND_LTTNG)
+    #include "ara/os/linux/trace/ara_os_tracepoint.h" // For the tracepoints of the "ara_os" provider
+#else
+    #error "ara/os/linux/trace/trace.h requires ARA_OS_TRACE_BACKEND_USDT or ARA_OS_TRACE_BACKEND_LTTNG."
+#endif
+
+#include <cstdint>      // For std::uint32_t, std::uint64_t, std::int32_t
+
+namespace ara {
+namespace os {
+namespace linux {
+namespace trace {
+
+/**********************************************************************************************************************
+ *  CLASS: TraceAccessImpl
+ *********************************************************************************************************************/
+/*!
+ * \brief  Linux-specific static backend of the ara::os::interface::trace::TraceAccess interface.
+ *
+ * \details
+ * - The probe names follow ara::os::interface::trace::ProbeId (cycle_begin, cycle_end, shutdown_signal, violation,
+ *   user_event); the arguments keep their width.
+ * - No system call while no tracer is attached; no heap allocation, no lock, no virtual dispatch.
+ */
+class TraceAccessImpl final : public ara::os::interface::trace::TraceAccess<TraceAccessImpl> {
+public:
+    static constexpr bool kEnabled{true};
+
+#if defined(ARA_OS_TRACE_BACKEND_USDT)
+    static auto CycleBeginImpl(std::uint32_t group, std::uint64_t cycle) noexcept -> void
+    {
+        DTRACE_PROBE2(ara_os, cycle_begin, group, cycle);
+    }
+
+    static auto CycleEndImpl(std::uint32_t group, std::uint64_t cycle) noexcept -> void
+    {
+        DTRACE_PROBE2(ara_os, cycle_end, group, cycle);
+    }
+
+    static auto ShutdownSignalImpl(std::int32_t signo) noexcept -> void
+    {
+        DTRACE_PROBE1(ara_os, shutdown_signal, signo);
+    }
+
+    static auto ViolationImpl(std::uint32_t kind) noexcept -> void
+    {
+        DTRACE_PROBE1(ara_os, violation, kind);
+    }
+
+    static auto UserEventImpl(std::uint32_t id, std::uint64_t value) noexcept -> void
+    {
+        DTRACE_PROBE2(ara_os, user_event, id, value);
+    }
+#else
+    static auto CycleBeginImpl(std::uint32_t group, std::uint64_t cycle) noexcept -> void
+    {
+        tracepoint(ara_os, cycle_begin, group, cycle);
+    }
+
+    static auto CycleEndImpl(std::uint32_t group, std::uint64_t cycle) noexcept -> void
+    {
+        tracepoint(ara_os, cycle_end, group, cycle);
+    }
+
+    static auto ShutdownSignalImpl(std::int32_t signo) noexcept -> void
+    {
+        tracepoint(ara_os, shutdown_signal, signo);
+    }
+
+    static auto ViolationImpl(std::uint32_t kind) noexcept -> void
+    {
+        tracepoint(ara_os, violation, kind);
+    }
+
+    static auto UserEventImpl(std::uint32_t id, std::uint64_t value) noexcept -> void
+    {
+        tracepoint(ara_os, user_event, id, value);
+    }
+#endif
+};
+
+} // namespace trace
+} // namespace linux
+} // namespace os
+} // namespace ara
+
+#endif // ARA_OS_LINUX_TRACE_TRACE_H
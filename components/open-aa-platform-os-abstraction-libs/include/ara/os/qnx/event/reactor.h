@@ -0,0 +1,151 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project (CXX_STANDARD 17)
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara/os/qnx/event/reactor.h
+ *  \brief      QNX-specific backend of the ara::os::interface::event::Reactor interface.
+ *
+ *  \details    Declares ReactorImpl, which receives every source as a pulse on one private channel: timer expiries
+ *              (pulse timers), descriptor readiness (ionotify) and signals (a handler forwarding them as pulses),
+ *              next to a wake pulse sent by Wake().
+ *
+ *  \note       Each ReactorImpl owns one channel, one side-channel connection and one timer per timer source,
+ *              created by OpenImpl() / WatchTimerImpl() and released by CloseImpl() (or the destructor). Signals can be
+ *              watched by one reactor per process at a time.
+ ***********************************************************************************************************************/
+
+#ifndef ARA_OS_QNX_EVENT_REACTOR_H
+#define ARA_OS_QNX_EVENT_REACTOR_H
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+/*!
+ * \brief  Includes the Reactor interface header.
+ */
+#include "ara/os/interface/event/reactor.h"
+
+#include <signal.h>     // For sigset_t, NSIG
+#include <time.h>       // For timer_t
+
+namespace ara {
+namespace os {
+namespace qnx {
+namespace event {
+
+/**********************************************************************************************************************
+ *  CLASS: ReactorImpl
+ *********************************************************************************************************************/
+/*!
+ * \brief  QNX-specific backend of the ara::os::interface::event::Reactor interface.
+ *
+ * \details
+ * - WatchSignal():     installs a handler sending a signal pulse (MsgSendPulse is usable in signal handlers). The
+ *                      watched signals are unblocked only in the thread waiting in Wait(), so they are delivered
+ *                      there and nowhere else.
+ * - WatchTimer():      creates a periodic CLOCK_MONOTONIC pulse timer (SIGEV_PULSE_PRIO_INHERIT).
+ * - WatchDescriptor(): arms ionotify(_NOTIFY_ACTION_POLLARM) with a descriptor pulse; it is re-armed by every Wait()
+ *                      after the reported readiness, which makes it level-triggered like on Linux.
+ * - Wait():            MsgReceivePulse() bounded by TimerTimeout().
+ * - Wake():            MsgSendPulse() of a wake pulse; pulses are queued, so a wake-up is never lost.
+ */
+class ReactorImpl final : public ara::os::interface::event::Reactor<ReactorImpl> {
+public:
+    /*!
+     * \brief  Constructs a closed reactor.
+     */
+    ReactorImpl() noexcept = default;
+
+    /*!
+     * \brief  Releases the timers, connection and channel if still open.
+     */
+    ~ReactorImpl() noexcept;
+
+    ReactorImpl(const ReactorImpl&) = delete;
+    ReactorImpl(ReactorImpl&&) = delete;
+    auto operator=(const ReactorImpl&) -> ReactorImpl& = delete;
+    auto operator=(ReactorImpl&&) -> ReactorImpl& = delete;
+
+    /*!
+     * \brief  Creates the private channel and the side-channel connection.
+     */
+    auto OpenImpl() noexcept -> ara::os::interface::event::ErrorCode;
+
+    /*!
+     * \brief  Installs the pulse-forwarding handler for \c signalNumber.
+     */
+    auto WatchSignalImpl(std::uint32_t source, int signalNumber) noexcept -> ara::os::interface::event::ErrorCode;
+
+    /*!
+     * \brief  Creates and arms a periodic pulse timer.
+     */
+    auto WatchTimerImpl(std::uint32_t source, std::chrono::nanoseconds period) noexcept
+        -> ara::os::interface::event::ErrorCode;
+
+    /*!
+     * \brief  Registers \c descriptor for readiness pulses.
+     */
+    auto WatchDescriptorImpl(std::uint32_t source, int descriptor, std::uint32_t interest) noexcept
+        -> ara::os::interface::event::ErrorCode;
+
+    /*!
+     * \brief  Re-arms the descriptors, then receives pulses and translates them into ReadyEvent records.
+     */
+    auto WaitImpl(ara::os::interface::event::ReadyEvent* events, std::size_t capacity,
+                  std::chrono::nanoseconds timeout, std::size_t& count) noexcept
+        -> ara::os::interface::event::ErrorCode;
+
+    /*!
+     * \brief  Sends the wake pulse to the private channel.
+     */
+    auto WakeImpl() noexcept -> void;
+
+    /*!
+     * \brief  Deletes the timers, restores the signal actions, detaches the connection and destroys the channel.
+     */
+    auto CloseImpl() noexcept -> void;
+
+private:
+    /*! \brief Whether \c source is a valid, not yet registered source number. */
+    auto IsFreeSource(std::uint32_t source) const noexcept -> bool;
+
+    /*! \brief Arms the ionotify of descriptor source \c source; returns the readiness already met (0: armed). */
+    auto ArmDescriptor(std::uint32_t source) noexcept -> std::uint64_t;
+
+    /*! \brief Private channel receiving all pulses (-1 when closed). */
+    int channelId_{-1};
+
+    /*! \brief Side-channel connection the pulses are sent through (-1 when closed). */
+    int connectionId_{-1};
+
+    /*! \brief Signals watched by this reactor. */
+    sigset_t signals_{};
+
+    /*! \brief Source number + 1 of each watched signal (0: not watched). */
+    std::uint32_t signalSources_[NSIG]{};
+
+    /*! \brief Kind of each source number (0: not registered, see reactor.cpp). */
+    std::uint8_t kinds_[ara::os::interface::event::kMaxSources]{};
+
+    /*! \brief Pulse timer of each timer source (valid only for timer sources). */
+    timer_t timers_[ara::os::interface::event::kMaxSources]{};
+
+    /*! \brief Descriptor and ionotify conditions of each descriptor source. */
+    int descriptors_[ara::os::interface::event::kMaxSources]{};
+    std::int32_t conditions_[ara::os::interface::event::kMaxSources]{};
+
+    /*! \brief Whether the ionotify of each descriptor source is armed (a pulse will report the next readiness). */
+    bool armed_[ara::os::interface::event::kMaxSources]{};
+};
+
+} // namespace event
+} // namespace qnx
+} // namespace os
+} // namespace ara
+
+#endif // ARA_OS_QNX_EVENT_REACTOR_H
@@ -0,0 +1,78 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project (CXX_STANDARD 17)
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara/os/qnx/shm/shared_memory_control.h
+ *  \brief      QNX-specific backend of the ara::os::interface::shm::SharedMemoryControl interface.
+ *
+ *  \details    Declares SharedMemoryControlImpl. Segments are shared-memory objects under /dev/shmem whose memory is
+ *              allocated by shm_ctl(): anonymous memory, physically contiguous memory for huge-page segments (which
+ *              lets the memory manager map them with large pages), or memory of a typed memory pool.
+ ***********************************************************************************************************************/
+
+#ifndef ARA_OS_QNX_SHM_SHARED_MEMORY_CONTROL_H
+#define ARA_OS_QNX_SHM_SHARED_MEMORY_CONTROL_H
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+/*!
+ * \brief  Includes the SharedMemoryControl interface header.
+ */
+#include "ara/os/interface/shm/shared_memory_control.h"
+
+namespace ara {
+namespace os {
+namespace qnx {
+namespace shm {
+
+/**********************************************************************************************************************
+ *  CLASS: SharedMemoryControlImpl
+ *********************************************************************************************************************/
+/*!
+ * \brief  QNX-specific backend of the ara::os::interface::shm::SharedMemoryControl interface.
+ *
+ * \details
+ * - Create(): shm_open(O_CREAT | O_EXCL), then shm_ctl() with SHMCTL_ANON, SHMCTL_ANON | SHMCTL_PHYS (hugePages,
+ *             size rounded up to kLargePageSize) or SHMCTL_ANON | SHMCTL_TYMEM (typedMemory, opened with
+ *             posix_typed_mem_open(POSIX_TYPED_MEM_ALLOCATE_CONTIG)).
+ * - Open():   shm_open() with O_RDWR or O_RDONLY, and fstat() for the size.
+ * - Unlink(): shm_unlink().
+ */
+class SharedMemoryControlImpl final
+    : public ara::os::interface::shm::SharedMemoryControl<SharedMemoryControlImpl> {
+public:
+    /*!
+     * \brief  Granule of huge-page segments: the large page size of the x86_64 and aarch64 memory managers.
+     */
+    static constexpr std::size_t kLargePageSize{2U * 1024U * 1024U};
+
+    /*!
+     * \brief  Creates the memory object and allocates its memory.
+     */
+    static auto CreateImpl(const ara::os::interface::shm::SegmentConfig& config, std::size_t& size, int& fd) noexcept
+        -> ara::os::interface::shm::ErrorCode;
+
+    /*!
+     * \brief  Opens the memory object and reads its size.
+     */
+    static auto OpenImpl(const ara::os::interface::shm::SegmentConfig& config, std::size_t& size, int& fd) noexcept
+        -> ara::os::interface::shm::ErrorCode;
+
+    /*!
+     * \brief  Removes the name of the memory object.
+     */
+    static auto UnlinkImpl(const char* name, bool hugePages) noexcept -> ara::os::interface::shm::ErrorCode;
+};
+
+} // namespace shm
+} // namespace qnx
+} // namespace os
+} // namespace ara
+
+#endif // ARA_OS_QNX_SHM_SHARED_MEMORY_CONTROL_H
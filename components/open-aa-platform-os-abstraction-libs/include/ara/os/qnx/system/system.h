@@ -0,0 +1,111 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project (CXX_STANDARD 17)
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara/os/qnx/system/system.h
+ *  \brief      QNX-specific implementation of the ara::os::interface::system::SystemInteraction interface.
+ *
+ *  \details    Declares the QNX-specific SystemInteraction implementation, the factory function and the
+ *              static (CRTP) backend SystemAccessImpl used for allocation-free, devirtualized access.
+ *
+ *  \note       This class ensures that the CPU topology is retrieved using the QNX system page.
+ ***********************************************************************************************************************/
+
+#ifndef ARA_OS_QNX_SYSTEM_SYSTEM_H
+#define ARA_OS_QNX_SYSTEM_SYSTEM_H
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+/*!
+ * \brief  Includes the SystemInteraction interface header.
+ */
+#include "ara/os/interface/system/system_interaction.h"
+#include "ara/os/interface/system/system_access.h"
+
+#include <memory> // For std::unique_ptr
+
+namespace ara {
+namespace os {
+namespace qnx {
+namespace system {
+
+/**********************************************************************************************************************
+ *  CLASS: SystemAccessImpl
+ *********************************************************************************************************************/
+/*!
+ * \brief  QNX-specific static backend of the ara::os::interface::system::SystemAccess interface.
+ *
+ * \details
+ * - Reads the cpuinfo and cacheattr sections of the system page and the runmask of the calling thread.
+ * - No heap allocation, no virtual dispatch; reached via SystemAccess<SystemAccessImpl>.
+ * - SystemInteractionImpl delegates to this backend, so both paths behave identically.
+ */
+class SystemAccessImpl final : public ara::os::interface::system::SystemAccess<SystemAccessImpl> {
+public:
+    /*!
+     * \brief  Reads the topology of all CPUs.
+     *
+     * \param[out] topology  Receives the topology; it is reset first.
+     *
+     * \return An ara::os::interface::system::ErrorCode indicating the result of the operation.
+     */
+    static auto GetCpuTopologyImpl(ara::os::interface::system::CpuTopology& topology) noexcept
+        -> ara::os::interface::system::ErrorCode;
+
+    /*!
+     * \brief  Coherency line size of the data caches of CPU 0 in bytes, or 0 if unknown.
+     */
+    static auto GetCacheLineSizeImpl() noexcept -> std::size_t;
+};
+
+/**********************************************************************************************************************
+ *  CLASS: SystemInteractionImpl
+ *********************************************************************************************************************/
+/*!
+ * \brief  QNX-specific implementation of the ara::os::interface::system::SystemInteraction interface.
+ */
+class SystemInteractionImpl final : public ara::os::interface::system::SystemInteraction {
+public:
+    /*!
+     * \brief  Reads the topology of all CPUs.
+     *
+     * \param[out] topology  Receives the topology; it is reset first.
+     *
+     * \return An ara::os::interface::system::ErrorCode indicating the result of the operation.
+     */
+    auto GetCpuTopology(ara::os::interface::system::CpuTopology& topology) const noexcept
+        -> ara::os::interface::system::ErrorCode override;
+
+    /*!
+     * \brief  Coherency line size of the data caches of CPU 0 in bytes, or 0 if unknown.
+     */
+    auto GetCacheLineSize() const noexcept -> std::size_t override;
+
+    /*!
+     * \brief  Destructor for SystemInteractionImpl.
+     */
+    ~SystemInteractionImpl() override = default;
+};
+
+/**********************************************************************************************************************
+ *  FUNCTION: CreateSystemInteractionInstance
+ *********************************************************************************************************************/
+/*!
+ * \brief  Factory function to create a QNX-specific SystemInteraction instance.
+ *
+ * \return A std::unique_ptr to an ara::os::interface::system::SystemInteraction object.
+ */
+std::unique_ptr<ara::os::interface::system::SystemInteraction> CreateSystemInteractionInstance();
+
+} // namespace system
+} // namespace qnx
+} // namespace os
+} // namespace ara
+
+#endif // ARA_OS_QNX_SYSTEM_SYSTEM_H
@@ -0,0 +1,88 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project (CXX_STANDARD 17)
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara/os/qnx/thread/thread_control.h
+ *  \brief      QNX-specific backend of the ara::os::interface::thread::ThreadControl interface.
+ *
+ *  \details    Declares ThreadControlImpl, which maps a CpuSet onto a QNX runmask. QNX has no affinity in the
+ *              creation attributes; the runmask (and the inherit mask of threads created by this one) are set with
+ *              ThreadCtl(_NTO_TCTL_RUNMASK_GET_AND_SET_INHERIT) as the first action of the new thread.
+ ***********************************************************************************************************************/
+
+#ifndef ARA_OS_QNX_THREAD_THREAD_CONTROL_H
+#define ARA_OS_QNX_THREAD_THREAD_CONTROL_H
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+/*!
+ * \brief  Includes the ThreadControl interface header.
+ */
+#include "ara/os/interface/thread/thread_control.h"
+
+namespace ara {
+namespace os {
+namespace qnx {
+namespace thread {
+
+/**********************************************************************************************************************
+ *  CLASS: ThreadControlImpl
+ *********************************************************************************************************************/
+/*!
+ * \brief  QNX-specific backend of the ara::os::interface::thread::ThreadControl interface.
+ *
+ * \details
+ * - SetAttributeAffinity(): not supported (kHasAttributeAffinity is false).
+ * - SetCurrentAffinity():   ThreadCtl(_NTO_TCTL_RUNMASK_GET_AND_SET_INHERIT), runmask and inherit mask.
+ * - SetCurrentName():       pthread_setname_np(), truncated to _NTO_THREAD_NAME_MAX characters.
+ * - GetCpuCount():          _syspage_ptr->num_cpu.
+ */
+class ThreadControlImpl final : public ara::os::interface::thread::ThreadControl<ThreadControlImpl> {
+public:
+    /*!
+     * \brief  The affinity is not part of the creation attributes; it is set in the new thread.
+     */
+    static constexpr bool kHasAttributeAffinity{false};
+
+    /*!
+     * \brief  Not supported: returns ErrorCode::InvalidArgument.
+     */
+    static auto SetAttributeAffinityImpl(pthread_attr_t& attributes,
+                                         const ara::os::interface::thread::CpuSet& cpus) noexcept
+        -> ara::os::interface::thread::ErrorCode;
+
+    /*!
+     * \brief  Sets the runmask and inherit mask of the calling thread.
+     */
+    static auto SetCurrentAffinityImpl(const ara::os::interface::thread::CpuSet& cpus) noexcept
+        -> ara::os::interface::thread::ErrorCode;
+
+    /*!
+     * \brief  Reads the affinity of the calling thread.
+     */
+    static auto GetCurrentAffinityImpl(ara::os::interface::thread::CpuSet& cpus) noexcept
+        -> ara::os::interface::thread::ErrorCode;
+
+    /*!
+     * \brief  Names the calling thread.
+     */
+    static auto SetCurrentNameImpl(const char* name) noexcept -> ara::os::interface::thread::ErrorCode;
+
+    /*!
+     * \brief  Number of configured CPUs.
+     */
+    static auto GetCpuCountImpl() noexcept -> std::size_t;
+};
+
+} // namespace thread
+} // namespace qnx
+} // namespace os
+} // namespace ara
+
+#endif // ARA_OS_QNX_THREAD_THREAD_CONTROL_H
@@ -0,0 +1,113 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project (CXX_STANDARD 17)
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara/os/qnx/timer/deadline_timer.h
+ *  \brief      QNX-specific backend of the ara::os::interface::timer::DeadlineTimer interface.
+ *
+ *  \details    Declares DeadlineTimerImpl, which arms a CLOCK_MONOTONIC timer with an absolute expiry and waits for
+ *              its pulse on a private channel.
+ *
+ *  \note       Each DeadlineTimerImpl owns one channel, one side-channel connection and one timer, created by
+ *              OpenImpl() and released by CloseImpl() (or the destructor).
+ ***********************************************************************************************************************/
+
+#ifndef ARA_OS_QNX_TIMER_DEADLINE_TIMER_H
+#define ARA_OS_QNX_TIMER_DEADLINE_TIMER_H
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+/*!
+ * \brief  Includes the DeadlineTimer interface header.
+ */
+#include "ara/os/interface/timer/deadline_timer.h"
+
+#include <time.h>       // For timer_t
+
+namespace ara {
+namespace os {
+namespace qnx {
+namespace timer {
+
+/**********************************************************************************************************************
+ *  CLASS: DeadlineTimerImpl
+ *********************************************************************************************************************/
+/*!
+ * \brief  QNX-specific backend of the ara::os::interface::timer::DeadlineTimer interface.
+ *
+ * \details
+ * - Now():        clock_gettime(CLOCK_MONOTONIC).
+ * - SleepUntil(): timer_settime(TIMER_ABSTIME) on a pulse timer, then MsgReceivePulse() on the private channel.
+ * - Interrupt():  MsgSendPulse() of a wake pulse on the same channel; pulses are queued, so a wake-up sent before
+ *                 the sleep is not lost.
+ * - The expiry pulse is delivered at the priority of the waiting thread (SIGEV_PULSE_PRIO_INHERIT).
+ */
+class DeadlineTimerImpl final : public ara::os::interface::timer::DeadlineTimer<DeadlineTimerImpl> {
+public:
+    /*!
+     * \brief  Constructs a closed timer.
+     */
+    DeadlineTimerImpl() noexcept = default;
+
+    /*!
+     * \brief  Releases the timer, connection and channel if still open.
+     */
+    ~DeadlineTimerImpl() noexcept;
+
+    DeadlineTimerImpl(const DeadlineTimerImpl&) = delete;
+    DeadlineTimerImpl(DeadlineTimerImpl&&) = delete;
+    auto operator=(const DeadlineTimerImpl&) -> DeadlineTimerImpl& = delete;
+    auto operator=(DeadlineTimerImpl&&) -> DeadlineTimerImpl& = delete;
+
+    /*!
+     * \brief  Reads CLOCK_MONOTONIC.
+     */
+    static auto NowImpl() noexcept -> ara::os::interface::timer::MonotonicTime;
+
+    /*!
+     * \brief  Creates the private channel, the side-channel connection and the pulse timer.
+     */
+    auto OpenImpl() noexcept -> ara::os::interface::timer::ErrorCode;
+
+    /*!
+     * \brief  Arms the timer for \c deadline (absolute) and waits for its pulse.
+     */
+    auto SleepUntilImpl(ara::os::interface::timer::MonotonicTime deadline) noexcept
+        -> ara::os::interface::timer::ErrorCode;
+
+    /*!
+     * \brief  Sends the wake pulse to the private channel.
+     */
+    auto InterruptImpl() noexcept -> void;
+
+    /*!
+     * \brief  Deletes the timer, detaches the connection and destroys the channel.
+     */
+    auto CloseImpl() noexcept -> void;
+
+private:
+    /*! \brief Private channel receiving the timer pulses (-1 when closed). */
+    int channelId_{-1};
+
+    /*! \brief Side-channel connection the pulses are sent through (-1 when closed). */
+    int connectionId_{-1};
+
+    /*! \brief The CLOCK_MONOTONIC pulse timer. */
+    timer_t timerId_{};
+
+    /*! \brief Whether timerId_ refers to a created timer. */
+    bool timerCreated_{false};
+};
+
+} // namespace timer
+} // namespace qnx
+} // namespace os
+} // namespace ara
+
+#endif // ARA_OS_QNX_TIMER_DEADLINE_TIMER_H
@@ -0,0 +1,98 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project (CXX_STANDARD 17)
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara/os/qnx/trace/trace.h
+ *  \brief      QNX-specific backend of the ara::os::interface::trace::TraceAccess probe interface.
+ *
+ *  \details    Declares the static (CRTP) backend TraceAccessImpl emitting user events to the trace logger of the
+ *              instrumented kernel (procnto-*-instr) with TraceEvent(_NTO_TRACE_INSERTSUSEREVENT, ...). The event
+ *              code is _NTO_TRACE_USERFIRST + ProbeId; the two 32-bit payload words are listed per probe below.
+ *              Capture with `tracelogger` and view with `traceprinter` or the Momentics System Profiler.
+ *
+ *  \note       With a non-instrumented kernel TraceEvent() fails immediately; the result is ignored.
+ ***********************************************************************************************************************/
+
+#ifndef ARA_OS_QNX_TRACE_TRACE_H
+#define ARA_OS_QNX_TRACE_TRACE_H
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+/*!
+ * \brief  Includes the TraceAccess interface header.
+ */
+#include "ara/os/interface/trace/trace_access.h"
+
+#include <sys/neutrino.h>   // For TraceEvent
+#include <sys/trace.h>      // For _NTO_TRACE_INSERTSUSEREVENT, _NTO_TRACE_USERFIRST
+#include <cstdint>          // For std::uint32_t, std::uint64_t, std::int32_t
+
+namespace ara {
+namespace os {
+namespace qnx {
+namespace trace {
+
+/**********************************************************************************************************************
+ *  CLASS: TraceAccessImpl
+ *********************************************************************************************************************/
+/*!
+ * \brief  QNX-specific static backend of the ara::os::interface::trace::TraceAccess interface.
+ *
+ * \details
+ * - Payload (d0, d1): cycle_begin / cycle_end (group, low 32 bits of cycle), shutdown_signal (signo, 0),
+ *   violation (kind, 0), user_event (id, low 32 bits of value).
+ * - One kernel call per probe; no heap allocation, no lock, no virtual dispatch.
+ */
+class TraceAccessImpl final : public ara::os::interface::trace::TraceAccess<TraceAccessImpl> {
+public:
+    static constexpr bool kEnabled{true};
+
+    static auto CycleBeginImpl(std::uint32_t group, std::uint64_t cycle) noexcept -> void
+    {
+        Emit(ara::os::interface::trace::ProbeId::CycleBegin, group, static_cast<std::uint32_t>(cycle));
+    }
+
+    static auto CycleEndImpl(std::uint32_t group, std::uint64_t cycle) noexcept -> void
+    {
+        Emit(ara::os::interface::trace::ProbeId::CycleEnd, group, static_cast<std::uint32_t>(cycle));
+    }
+
+    static auto ShutdownSignalImpl(std::int32_t signo) noexcept -> void
+    {
+        Emit(ara::os::interface::trace::ProbeId::ShutdownSignal, static_cast<std::uint32_t>(signo), 0U);
+    }
+
+    static auto ViolationImpl(std::uint32_t kind) noexcept -> void
+    {
+        Emit(ara::os::interface::trace::ProbeId::Violation, kind, 0U);
+    }
+
+    static auto UserEventImpl(std::uint32_t id, std::uint64_t value) noexcept -> void
+    {
+        Emit(ara::os::interface::trace::ProbeId::UserEvent, id, static_cast<std::uint32_t>(value));
+    }
+
+private:
+    /*!
+     * \brief  Inserts the user event of \c probe with the payload words \c d0 and \c d1.
+     */
+    static auto Emit(ara::os::interface::trace::ProbeId probe, std::uint32_t d0, std::uint32_t d1) noexcept -> void
+    {
+        static_cast<void>(::TraceEvent(_NTO_TRACE_INSERTSUSEREVENT,
+                                       _NTO_TRACE_USERFIRST + static_cast<int>(probe),
+                                       static_cast<unsigned>(d0), static_cast<unsigned>(d1)));
+    }
+};
+
+} // namespace trace
+} // namespace qnx
+} // namespace os
+} // namespace ara
+
+#endif // ARA_OS_QNX_TRACE_TRACE_H
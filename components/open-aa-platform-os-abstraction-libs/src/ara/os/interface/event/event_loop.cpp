@@ -0,0 +1,290 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project (CXX_STANDARD 17)
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara/os/interface/event/event_loop.cpp
+ *  \brief      Implementation of the ara::os::interface::event::EventLoop.
+ *
+ *  \details    The loop keeps the handlers; the platform reactor knows the sources only by their index. A wait
+ *              returns up to kMaxSources ready sources into a stack buffer, which are then dispatched in order.
+ ***********************************************************************************************************************/
+
+#include "ara/os/interface/event/event_loop.h"
+
+namespace ara {
+namespace os {
+namespace interface {
+namespace event {
+
+/**********************************************************************************************************************
+ *  FUNCTION: EventLoop::~EventLoop
+ *********************************************************************************************************************/
+EventLoop::~EventLoop() noexcept
+{
+    Close();
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: EventLoop::PrepareAdd
+ *********************************************************************************************************************/
+/*!
+ * \brief  Checks the common preconditions of Add*() and opens the reactor on first use.
+ *
+ * \return ErrorCode::Success, AlreadyRunning, InvalidArgument (no handler), CapacityExceeded or ResourceFailure.
+ */
+auto EventLoop::PrepareAdd(EventHandler handler) noexcept -> ErrorCode
+{
+    if (running_.load(std::memory_order_acquire)) {
+        return ErrorCode::AlreadyRunning;
+    }
+    if (handler == nullptr) {
+        return ErrorCode::InvalidArgument;
+    }
+    if (sourceCount_ >= kMaxSources) {
+        return ErrorCode::CapacityExceeded;
+    }
+    if (!open_) {
+        ErrorCode const opened = reactor_.Open();
+        if (opened != ErrorCode::Success) {
+            return opened;
+        }
+        open_ = true;
+    }
+    return ErrorCode::Success;
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: EventLoop::CommitSource
+ *********************************************************************************************************************/
+auto EventLoop::CommitSource(SourceKind kind, EventHandler handler, void* context) noexcept -> void
+{
+    sources_[sourceCount_] = Source{kind, handler, context};
+    ++sourceCount_;
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: EventLoop::AddSignal
+ *********************************************************************************************************************/
+auto EventLoop::AddSignal(int signalNumber, EventHandler handler, void* context) noexcept -> ErrorCode
+{
+    ErrorCode result = PrepareAdd(handler);
+    if (result == ErrorCode::Success) {
+        result = reactor_.WatchSignal(static_cast<std::uint32_t>(sourceCount_), signalNumber);
+    }
+    if (result == ErrorCode::Success) {
+        CommitSource(SourceKind::Signal, handler, context);
+    }
+    return result;
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: EventLoop::AddTimer
+ *********************************************************************************************************************/
+auto EventLoop::AddTimer(std::chrono::nanoseconds period, EventHandler handler, void* context) noexcept -> ErrorCode
+{
+    ErrorCode result = PrepareAdd(handler);
+    if (result == ErrorCode::Success) {
+        result = reactor_.WatchTimer(static_cast<std::uint32_t>(sourceCount_), period);
+    }
+    if (result == ErrorCode::Success) {
+        CommitSource(SourceKind::Timer, handler, context);
+    }
+    return result;
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: EventLoop::AddDescriptor
+ *********************************************************************************************************************/
+auto EventLoop::AddDescriptor(int descriptor, std::uint32_t interest, EventHandler handler, void* context) noexcept
+    -> ErrorCode
+{
+    ErrorCode result = PrepareAdd(handler);
+    if (result == ErrorCode::Success) {
+        result = reactor_.WatchDescriptor(static_cast<std::uint32_t>(sourceCount_), descriptor, interest);
+    }
+    if (result == ErrorCode::Success) {
+        CommitSource(SourceKind::Descriptor, handler, context);
+    }
+    return result;
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: EventLoop::WaitAndDispatch
+ *********************************************************************************************************************/
+/*!
+ * \brief  Waits once and calls the handler of every reported source, stopping early if Stop() was requested.
+ */
+auto EventLoop::WaitAndDispatch(std::chrono::nanoseconds timeout) noexcept -> ErrorCode
+{
+    ReadyEvent ready[kMaxSources]{};
+    std::size_t count{0U};
+    ErrorCode const result = reactor_.Wait(ready, kMaxSources, timeout, count);
+    if (result != ErrorCode::Success) {
+        return result;
+    }
+
+    for (std::size_t i = 0U; (i < count) && !stopRequested_.load(std::memory_order_acquire); ++i) {
+        std::size_t const index = ready[i].source;
+        if (index < sourceCount_) {
+            const Source& source = sources_[index];
+            source.handler(source.context, Event{index, source.kind, ready[i].value});
+        }
+    }
+    RunPosted();
+    return ErrorCode::Success;
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: EventLoop::RunPosted
+ *********************************************************************************************************************/
+/*!
+ * \brief  Takes the queued tasks under the lock and runs them outside of it, so that a task may post again (it then
+ *         runs after the next wait).
+ */
+auto EventLoop::RunPosted() noexcept -> void
+{
+    Posted tasks[kMaxPostedTasks]{};
+    while (postLock_.test_and_set(std::memory_order_acquire)) {
+    }
+    std::size_t const count = postedCount_;
+    for (std::size_t i = 0U; i < count; ++i) {
+        tasks[i] = posted_[i];
+    }
+    postedCount_ = 0U;
+    postLock_.clear(std::memory_order_release);
+
+    for (std::size_t i = 0U; i < count; ++i) {
+        tasks[i].task(tasks[i].context);
+    }
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: EventLoop::Run
+ *********************************************************************************************************************/
+/*!
+ * \brief  Waits for and dispatches events until Stop() is called.
+ *
+ * \return ErrorCode indicating the result of the operation:
+ *         - Success:         Stop() was called.
+ *         - InvalidArgument: No source is registered (the loop would block forever).
+ *         - AlreadyRunning:  Another thread is running the loop.
+ *         - WaitFailure:     The platform wait failed; the loop is left.
+ */
+auto EventLoop::Run() noexcept -> ErrorCode
+{
+    if (sourceCount_ == 0U) {
+        return ErrorCode::InvalidArgument;
+    }
+    bool expected{false};
+    if (!running_.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
+        return ErrorCode::AlreadyRunning;
+    }
+
+    ErrorCode result{ErrorCode::Success};
+    while ((result == ErrorCode::Success) && !stopRequested_.load(std::memory_order_acquire)) {
+        result = WaitAndDispatch(std::chrono::nanoseconds{-1});
+    }
+
+    stopRequested_.store(false, std::memory_order_release);
+    running_.store(false, std::memory_order_release);
+    return result;
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: EventLoop::RunOnce
+ *********************************************************************************************************************/
+auto EventLoop::RunOnce(std::chrono::nanoseconds timeout) noexcept -> ErrorCode
+{
+    if (sourceCount_ == 0U) {
+        return ErrorCode::InvalidArgument;
+    }
+    bool expected{false};
+    if (!running_.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
+        return ErrorCode::AlreadyRunning;
+    }
+
+    ErrorCode const result = WaitAndDispatch(timeout);
+
+    running_.store(false, std::memory_order_release);
+    return result;
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: EventLoop::Stop
+ *********************************************************************************************************************/
+/*!
+ * \brief  Requests Run() to return and wakes the wait. Only an atomic store and the reactor wake-up (a write or a
+ *         pulse), so it can be called from a signal handler.
+ */
+auto EventLoop::Stop() noexcept -> void
+{
+    stopRequested_.store(true, std::memory_order_release);
+    reactor_.Wake();
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: EventLoop::Post
+ *********************************************************************************************************************/
+/*!
+ * \brief  Appends the task under a spin lock held for a few stores, then wakes the wait.
+ */
+auto EventLoop::Post(PostedTask task, void* context) noexcept -> bool
+{
+    if (task == nullptr) {
+        return false;
+    }
+    while (postLock_.test_and_set(std::memory_order_acquire)) {
+    }
+    bool const queued = (postedCount_ < kMaxPostedTasks);
+    if (queued) {
+        posted_[postedCount_] = Posted{task, context};
+        ++postedCount_;
+    }
+    postLock_.clear(std::memory_order_release);
+
+    if (queued) {
+        reactor_.Wake();
+    }
+    return queued;
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: EventLoop::IsRunning
+ *********************************************************************************************************************/
+auto EventLoop::IsRunning() const noexcept -> bool
+{
+    return running_.load(std::memory_order_acquire);
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: EventLoop::GetSourceCount
+ *********************************************************************************************************************/
+auto EventLoop::GetSourceCount() const noexcept -> std::size_t
+{
+    return sourceCount_;
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: EventLoop::Close
+ *********************************************************************************************************************/
+auto EventLoop::Close() noexcept -> void
+{
+    reactor_.Close();
+    sourceCount_ = 0U;
+    open_ = false;
+    while (postLock_.test_and_set(std::memory_order_acquire)) {
+    }
+    postedCount_ = 0U;
+    postLock_.clear(std::memory_order_release);
+    stopRequested_.store(false, std::memory_order_release);
+}
+
+} // namespace event
+} // namespace interface
+} // namespace os
+} // namespace ara
@@ -0,0 +1,317 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project (CXX_STANDARD 17)
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara/os/interface/process/process_stats.cpp
+ *  \brief      Implementation of the ara::os::interface::process::ProcessStats snapshot service.
+ *
+ *  \details    Platform independent: the process counters come from PlatformProcessAccess::GetResourceUsage(), the
+ *              thread CPU times from the POSIX per-thread CPU clocks (pthread_getcpuclockid). A snapshot is built on
+ *              the stack of the sampling thread and published with a single SeqLock::Store().
+ ***********************************************************************************************************************/
+
+#include "ara/os/interface/process/process_stats.h"
+#include "ara/os/interface/process/process_factory.h"   // For PlatformProcessAccess
+
+#include <sched.h>      // For sched_get_priority_min, SCHED_OTHER
+#include <unistd.h>     // For getpid
+#include <cstring>      // For std::memcpy, std::strlen
+
+namespace ara {
+namespace os {
+namespace interface {
+namespace process {
+
+namespace {
+
+/*!
+ * \brief  Size of the buffer the process name is read into before it is truncated to kProcessNameCapacity.
+ */
+constexpr std::size_t kNameBufferSize{256U};
+
+/*!
+ * \brief  Process-wide near-miss counters, indexed by ara::core::internal::ViolationKind.
+ */
+std::atomic<std::uint64_t> gNearMisses[kNearMissKinds]{};
+
+/*!
+ * \brief  \c time in nanoseconds.
+ */
+auto ToNanoseconds(const timespec& time) noexcept -> std::uint64_t
+{
+    return (static_cast<std::uint64_t>(time.tv_sec) * 1000000000U) + static_cast<std::uint64_t>(time.tv_nsec);
+}
+
+/*!
+ * \brief  Current CLOCK_MONOTONIC time in nanoseconds.
+ */
+auto MonotonicNs() noexcept -> std::uint64_t
+{
+    timespec now{};
+    static_cast<void>(::clock_gettime(CLOCK_MONOTONIC, &now));
+    return ToNanoseconds(now);
+}
+
+/*!
+ * \brief  Copies the null-terminated \c source into \c target, truncated to \c capacity - 1 characters.
+ */
+auto CopyTruncated(char* target, const char* source, std::size_t capacity) noexcept -> void
+{
+    std::size_t length = std::strlen(source);
+    if (length >= capacity) {
+        length = capacity - 1U;
+    }
+    std::memcpy(target, source, length);
+    target[length] = '\0';
+}
+
+} // namespace
+
+/**********************************************************************************************************************
+ *  FUNCTION: RecordNearMiss / GetNearMissCount
+ *********************************************************************************************************************/
+auto RecordNearMiss(std::uint8_t kind) noexcept -> void
+{
+    if (kind < kNearMissKinds) {
+        static_cast<void>(gNearMisses[kind].fetch_add(1U, std::memory_order_relaxed));
+    }
+}
+
+auto GetNearMissCount(std::uint8_t kind) noexcept -> std::uint64_t
+{
+    return (kind < kNearMissKinds) ? gNearMisses[kind].load(std::memory_order_relaxed) : 0U;
+}
+
+/**********************************************************************************************************************
+ *  CLASS: ProcessStats
+ *********************************************************************************************************************/
+ProcessStats::ProcessStats() noexcept
+    : ProcessStats(ownPublication_)
+{
+}
+
+ProcessStats::ProcessStats(Publication& publication) noexcept
+    : publication_{publication}
+{
+    exitKeyCreated_ = (::pthread_key_create(&exitKey_, &ProcessStats::ThreadExitHook) == 0);
+}
+
+ProcessStats::~ProcessStats() noexcept
+{
+    Stop();
+    if (exitKeyCreated_) {
+        // No exit hook runs after this: threads still registered no longer reference the object
+        static_cast<void>(::pthread_key_delete(exitKey_));
+    }
+}
+
+auto ProcessStats::RegisterThread(pthread_t thread, const char* name) noexcept -> ProcessStatsErrorCode
+{
+    clockid_t clock{};
+    if ((name == nullptr) || (::pthread_getcpuclockid(thread, &clock) != 0)) {
+        return ProcessStatsErrorCode::InvalidArgument;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (std::size_t index = 0U; index < threadCount_; ++index) {
+        // The handle of an exited thread may name a new thread by now: only running threads are duplicates
+        if (threads_[index].alive && (::pthread_equal(threads_[index].thread, thread) != 0)) {
+            return ProcessStatsErrorCode::AlreadyRegistered;
+        }
+    }
+    if (threadCount_ == kMaxManagedThreads) {
+        return ProcessStatsErrorCode::TableFull;
+    }
+
+    ManagedThread& managed = threads_[threadCount_];
+    managed.thread    = thread;
+    managed.clock     = clock;
+    managed.cpuTimeNs = 0U;
+    managed.alive     = true;
+    CopyTruncated(managed.name, name, kThreadNameCapacity);
+    ++threadCount_;
+    return ProcessStatsErrorCode::Success;
+}
+
+auto ProcessStats::RegisterCurrentThread(const char* name) noexcept -> ProcessStatsErrorCode
+{
+    ProcessStatsErrorCode const result = RegisterThread(::pthread_self(), name);
+    if ((result == ProcessStatsErrorCode::Success) && exitKeyCreated_) {
+        static_cast<void>(::pthread_setspecific(exitKey_, this));
+    }
+    return result;
+}
+
+auto ProcessStats::UnregisterThread(pthread_t thread) noexcept -> ProcessStatsErrorCode
+{
+    if (exitKeyCreated_ && (::pthread_equal(thread, ::pthread_self()) != 0)) {
+        static_cast<void>(::pthread_setspecific(exitKey_, nullptr));
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (std::size_t index = 0U; index < threadCount_; ++index) {
+        if (::pthread_equal(threads_[index].thread, thread) != 0) {
+            // Keep the registration order of the remaining threads
+            for (std::size_t next = index + 1U; next < threadCount_; ++next) {
+                threads_[next - 1U] = threads_[next];
+            }
+            --threadCount_;
+            threads_[threadCount_] = ManagedThread{};
+            return ProcessStatsErrorCode::Success;
+        }
+    }
+    return ProcessStatsErrorCode::NotRegistered;
+}
+
+auto ProcessStats::Sample() noexcept -> ProcessStatsErrorCode
+{
+    ResourceUsage usage{};
+    if (PlatformProcessAccess::GetResourceUsage(usage) != ErrorCode::Success) {
+        return ProcessStatsErrorCode::RetrievalFailed;
+    }
+
+    ProcessStatsSnapshot snapshot{};
+    snapshot.sampleTimeNs = MonotonicNs();
+    snapshot.pid          = static_cast<std::int32_t>(::getpid());
+    snapshot.usage        = usage;
+
+    char name[kNameBufferSize]{};
+    if (PlatformProcessAccess::GetProcessName(name, kNameBufferSize) == ErrorCode::Success) {
+        CopyTruncated(snapshot.name, name, kProcessNameCapacity);
+    }
+    for (std::size_t kind = 0U; kind < kNearMissKinds; ++kind) {
+        snapshot.nearMisses[kind] = gNearMisses[kind].load(std::memory_order_relaxed);
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (std::size_t index = 0U; index < threadCount_; ++index) {
+        ManagedThread& managed = threads_[index];
+        timespec cpuTime{};
+        // The clock of an exited thread may name a new thread by now: it is only read while the thread is alive
+        if (managed.alive && (::clock_gettime(managed.clock, &cpuTime) == 0)) {
+            managed.cpuTimeNs = ToNanoseconds(cpuTime);
+        }
+        ThreadStats& stats = snapshot.threads[index];
+        std::memcpy(stats.name, managed.name, kThreadNameCapacity);
+        stats.cpuTimeNs = managed.cpuTimeNs;
+        stats.alive     = managed.alive;
+    }
+    snapshot.threadCount = static_cast<std::uint32_t>(threadCount_);
+    snapshot.sampleIndex = ++sampleIndex_;
+
+    publication_.Store(snapshot);
+    return ProcessStatsErrorCode::Success;
+}
+
+auto ProcessStats::ThreadExitHook(void* context) noexcept -> void
+{
+    static_cast<ProcessStats*>(context)->MarkCurrentThreadExited();
+}
+
+auto ProcessStats::MarkCurrentThreadExited() noexcept -> void
+{
+    pthread_t const self = ::pthread_self();
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (std::size_t index = 0U; index < threadCount_; ++index) {
+        ManagedThread& managed = threads_[index];
+        if (managed.alive && (::pthread_equal(managed.thread, self) != 0)) {
+            // Key destructors run on the exiting thread: its own clock is still valid here
+            timespec cpuTime{};
+            if (::clock_gettime(CLOCK_THREAD_CPUTIME_ID, &cpuTime) == 0) {
+                managed.cpuTimeNs = ToNanoseconds(cpuTime);
+            }
+            managed.alive = false;
+            return;
+        }
+    }
+}
+
+auto ProcessStats::Start(const ProcessStatsConfig& config) noexcept -> ProcessStatsErrorCode
+{
+    std::lock_guard<std::mutex> lock(control_);
+
+    if (sampler_.IsStarted()) {
+        return ProcessStatsErrorCode::AlreadyRunning;
+    }
+    if ((config.period.count() <= 0) || (config.name == nullptr)) {
+        return ProcessStatsErrorCode::InvalidArgument;
+    }
+
+    // The sampler must never compete with real-time threads: SCHED_OTHER regardless of the caller
+    ara::os::interface::thread::ThreadConfig threadConfig{};
+    threadConfig.name     = config.name;
+    threadConfig.entry    = &ProcessStats::SamplerEntry;
+    threadConfig.context  = this;
+    threadConfig.policy   = ara::os::interface::thread::SchedulingPolicy::Other;
+    threadConfig.priority = ::sched_get_priority_min(SCHED_OTHER);
+    threadConfig.affinity = config.affinity;
+
+    // Opened before the thread exists, so that Stop() can always interrupt its sleep
+    if (timer_.Open() != ara::os::interface::timer::ErrorCode::Success) {
+        return ProcessStatsErrorCode::ThreadFailure;
+    }
+    period_ = config.period;
+    running_.store(true, std::memory_order_release);
+    if (sampler_.Start(threadConfig) != ara::os::interface::thread::ErrorCode::Success) {
+        running_.store(false, std::memory_order_release);
+        timer_.Close();
+        return ProcessStatsErrorCode::ThreadFailure;
+    }
+    return ProcessStatsErrorCode::Success;
+}
+
+auto ProcessStats::Stop() noexcept -> void
+{
+    std::lock_guard<std::mutex> lock(control_);
+
+    if (!sampler_.IsStarted()) {
+        return;
+    }
+    running_.store(false, std::memory_order_release);
+    // An interrupt issued before the sampler sleeps is kept: its next SleepUntil() returns at once
+    timer_.Interrupt();
+    static_cast<void>(sampler_.Join());
+    timer_.Close();
+}
+
+auto ProcessStats::IsRunning() const noexcept -> bool
+{
+    return running_.load(std::memory_order_acquire);
+}
+
+auto ProcessStats::SamplerEntry(void* context) noexcept -> void
+{
+    static_cast<ProcessStats*>(context)->RunSampler();
+}
+
+auto ProcessStats::RunSampler() noexcept -> void
+{
+    using ara::os::interface::timer::MonotonicTime;
+    using ara::os::interface::timer::PlatformDeadlineTimer;
+
+    MonotonicTime const period = std::chrono::duration_cast<MonotonicTime>(period_);
+    MonotonicTime deadline = PlatformDeadlineTimer::Now();
+
+    while (running_.load(std::memory_order_acquire)) {
+        static_cast<void>(Sample());
+
+        // Absolute deadlines keep the period free of drift; periods missed while starved are skipped
+        deadline += period;
+        MonotonicTime const now = PlatformDeadlineTimer::Now();
+        if (deadline < now) {
+            deadline = now;
+        }
+        // Returns early (Interrupted) once Stop() cleared running_
+        static_cast<void>(timer_.SleepUntil(deadline));
+    }
+}
+
+} // namespace process
+} // namespace interface
+} // namespace os
+} // namespace ara
@@ -0,0 +1,216 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project (CXX_STANDARD 17)
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara/os/interface/shm/shared_memory.cpp
+ *  \brief      Implementation of the ara::os::interface::shm::SharedMemory.
+ *
+ *  \details    The platform backend creates or opens the memory object; the mapping itself is a MAP_SHARED mmap() of
+ *              the whole object. The descriptor is closed right after mapping, since the mapping keeps the object
+ *              alive on its own.
+ ***********************************************************************************************************************/
+
+#include "ara/os/interface/shm/shared_memory.h"
+
+#include <sys/mman.h>   // For mmap, munmap, PROT_*, MAP_SHARED, MAP_FAILED
+#include <unistd.h>     // For close, sysconf
+#include <cerrno>       // For errno, ENOMEM
+#include <cstring>      // For std::strlen, std::strchr
+
+namespace ara {
+namespace os {
+namespace interface {
+namespace shm {
+
+/**********************************************************************************************************************
+ *  FUNCTION: SharedMemory::~SharedMemory
+ *********************************************************************************************************************/
+SharedMemory::~SharedMemory() noexcept
+{
+    Close();
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: SharedMemory::IsValidName
+ *********************************************************************************************************************/
+auto SharedMemory::IsValidName(const char* name) noexcept -> bool
+{
+    if ((name == nullptr) || (name[0] != '/')) {
+        return false;
+    }
+    std::size_t const length = std::strlen(name);
+    return (length > 1U) && (length <= kMaxNameLength) && (std::strchr(name + 1, '/') == nullptr);
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: SharedMemory::Create
+ *********************************************************************************************************************/
+auto SharedMemory::Create(const SegmentConfig& config) noexcept -> ErrorCode
+{
+    if (IsOpen()) {
+        return ErrorCode::AlreadyOpen;
+    }
+    if (!IsValidName(config.name) || (config.size == 0U)) {
+        return ErrorCode::InvalidArgument;
+    }
+
+    std::size_t size{0U};
+    int fd{-1};
+    ErrorCode const created = PlatformSharedMemoryControl::Create(config, size, fd);
+    if (created != ErrorCode::Success) {
+        return created;
+    }
+    ErrorCode const mapped = Map(fd, size, true, config.hugePages);
+    if (mapped != ErrorCode::Success) {
+        static_cast<void>(PlatformSharedMemoryControl::Unlink(config.name, config.hugePages));
+        return mapped;
+    }
+    if (config.prefault) {
+        Prefault(true);
+    }
+    return ErrorCode::Success;
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: SharedMemory::Open
+ *********************************************************************************************************************/
+auto SharedMemory::Open(const SegmentConfig& config) noexcept -> ErrorCode
+{
+    if (IsOpen()) {
+        return ErrorCode::AlreadyOpen;
+    }
+    if (!IsValidName(config.name)) {
+        return ErrorCode::InvalidArgument;
+    }
+
+    std::size_t size{0U};
+    int fd{-1};
+    ErrorCode const opened = PlatformSharedMemoryControl::Open(config, size, fd);
+    if (opened != ErrorCode::Success) {
+        return opened;
+    }
+    // A creator that has not sized the object yet looks like a segment of 0 bytes
+    if ((size == 0U) || (size < config.size)) {
+        static_cast<void>(::close(fd));
+        return ErrorCode::SizeMismatch;
+    }
+    ErrorCode const mapped = Map(fd, size, config.writable, config.hugePages);
+    if (mapped != ErrorCode::Success) {
+        return mapped;
+    }
+    if (config.prefault) {
+        Prefault(false);
+    }
+    return ErrorCode::Success;
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: SharedMemory::Close
+ *********************************************************************************************************************/
+auto SharedMemory::Close() noexcept -> void
+{
+    if (data_ != nullptr) {
+        static_cast<void>(::munmap(data_, size_));
+    }
+    data_     = nullptr;
+    size_     = 0U;
+    writable_ = false;
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: SharedMemory::Unlink
+ *********************************************************************************************************************/
+auto SharedMemory::Unlink(const char* name, bool hugePages) noexcept -> ErrorCode
+{
+    if (!IsValidName(name)) {
+        return ErrorCode::InvalidArgument;
+    }
+    return PlatformSharedMemoryControl::Unlink(name, hugePages);
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: SharedMemory::IsOpen / IsWritable / GetSize / GetData
+ *********************************************************************************************************************/
+auto SharedMemory::IsOpen() const noexcept -> bool
+{
+    return data_ != nullptr;
+}
+
+auto SharedMemory::IsWritable() const noexcept -> bool
+{
+    return writable_;
+}
+
+auto SharedMemory::GetSize() const noexcept -> std::size_t
+{
+    return size_;
+}
+
+auto SharedMemory::GetData() const noexcept -> void*
+{
+    return data_;
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: SharedMemory::Map
+ *********************************************************************************************************************/
+/*!
+ * \brief  Huge pages are reserved when a hugetlbfs file is mapped, so missing huge pages show up as ENOMEM here.
+ */
+auto SharedMemory::Map(int fd, std::size_t size, bool writable, bool hugePages) noexcept -> ErrorCode
+{
+    int const protection = writable ? (PROT_READ | PROT_WRITE) : PROT_READ;
+    void* const address  = ::mmap(nullptr, size, protection, MAP_SHARED, fd, 0);
+    int const error      = errno;
+    static_cast<void>(::close(fd));
+    if (address == MAP_FAILED) {
+        return (hugePages && (error == ENOMEM)) ? ErrorCode::HugePagesUnavailable : ErrorCode::ResourceFailure;
+    }
+
+    data_     = address;
+    size_     = size;
+    writable_ = writable;
+    return ErrorCode::Success;
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: SharedMemory::Prefault
+ *********************************************************************************************************************/
+auto SharedMemory::Prefault(bool initialize) const noexcept -> void
+{
+    long const basePage = ::sysconf(_SC_PAGESIZE);
+    std::size_t const pageSize = (basePage > 0) ? static_cast<std::size_t>(basePage) : 4096U;
+    volatile unsigned char* const bytes = static_cast<volatile unsigned char*>(data_);
+    for (std::size_t offset = 0U; offset < size_; offset += pageSize) {
+        if (initialize) {
+            bytes[offset] = 0U;
+        } else {
+            static_cast<void>(bytes[offset]);
+        }
+    }
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: SharedMemory::Locate
+ *********************************************************************************************************************/
+auto SharedMemory::Locate(std::size_t offset, std::size_t bytes, std::size_t alignment, bool write) const noexcept
+    -> void*
+{
+    if ((data_ == nullptr) || (write && !writable_)) {
+        return nullptr;
+    }
+    if ((offset > size_) || (bytes > (size_ - offset)) || ((offset % alignment) != 0U)) {
+        return nullptr;
+    }
+    return static_cast<unsigned char*>(data_) + offset;
+}
+
+} // namespace shm
+} // namespace interface
+} // namespace os
+} // namespace ara
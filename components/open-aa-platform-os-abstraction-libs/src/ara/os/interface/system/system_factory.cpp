@@ -0,0 +1,62 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project (CXX_STANDARD 17)
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara/os/interface/system/system_factory.cpp
+ *  \brief      Implementation of the ara::os::interface::system::SystemFactory.
+ *
+ *  \details    Provides a method to create platform-specific instances of the SystemInteraction interface.
+ *
+ *  \note       This facilitates the OS abstraction by hiding platform-specific details from the client.
+ ***********************************************************************************************************************/
+
+#include "ara/os/interface/system/system_factory.h"
+
+// Include platform-specific headers for SystemInteraction implementations
+#if defined(__linux__)
+    #include "ara/os/linux/system/system.h" // Linux-specific SystemInteraction implementation
+#elif defined(__QNXNTO__)
+    #include "ara/os/qnx/system/system.h"   // QNX-specific SystemInteraction implementation
+#else
+    /* Unsupported platform: Generate a compile-time error */
+    #error "Unsupported platform. The SystemFactory cannot create a SystemInteraction instance."
+#endif
+
+namespace ara {
+namespace os {
+namespace interface {
+namespace system {
+
+/**********************************************************************************************************************
+ *  FUNCTION: SystemFactory::CreateInstance
+ *********************************************************************************************************************/
+/*!
+ * \brief  Factory method to create a platform-specific SystemInteraction instance.
+ *
+ * \return A std::unique_ptr to an ara::os::interface::system::SystemInteraction object.
+ *         Compilation fails if the platform is unsupported.
+ *
+ * \note   This method is thread-safe and stateless, making it safe for concurrent access.
+ */
+auto SystemFactory::CreateInstance() noexcept -> std::unique_ptr<SystemInteraction> {
+#if defined(__linux__)
+    /* Create and return a Linux-specific SystemInteraction instance */
+    return linux::system::CreateSystemInteractionInstance();
+#elif defined(__QNXNTO__)
+    /* Create and return a QNX-specific SystemInteraction instance */
+    return qnx::system::CreateSystemInteractionInstance();
+#else
+    /* Unsupported platform: This should never be reached due to the #error directive above */
+    return nullptr;
+#endif
+}
+
+} // namespace system
+} // namespace interface
+} // namespace os
+} // namespace ara
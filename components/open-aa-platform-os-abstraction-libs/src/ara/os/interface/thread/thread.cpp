@@ -0,0 +1,342 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project (CXX_STANDARD 17)
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara/os/interface/thread/thread.cpp
+ *  \brief      Implementation of the ara::os::interface::thread::Thread.
+ *
+ *  \details    Policy, priority, stack size and (where supported) affinity are set in the creation attributes, so
+ *              the kernel applies them before the thread runs. The rest of the setup (name, affinity on platforms
+ *              without attribute support, stack prefaulting) runs first thing in the new thread, which reports its
+ *              outcome through a semaphore before it calls the entry.
+ ***********************************************************************************************************************/
+
+#include "ara/os/interface/thread/thread.h"
+
+#include <limits.h>     // For PTHREAD_STACK_MIN
+#include <sched.h>      // For SCHED_OTHER, SCHED_FIFO, SCHED_RR, sched_param, sched_get_priority_min/max
+#include <cerrno>       // For errno, EINTR, EINVAL, EPERM
+
+namespace ara {
+namespace os {
+namespace interface {
+namespace thread {
+
+namespace {
+
+/*!
+ * \brief  Size of the stack frame touched per recursion step of TouchStack() (one page or more).
+ */
+constexpr std::size_t kStackChunkSize{4096U};
+
+/*!
+ * \brief  Touches one kStackChunkSize frame and recurses until \c remaining bytes of stack have been touched.
+ *
+ * \details The read after the recursive call keeps the frame alive, so the call cannot become a tail call that
+ *          reuses the same stack page.
+ */
+[[gnu::noinline]] auto TouchStack(std::size_t remaining) noexcept -> void
+{
+    volatile char frame[kStackChunkSize];
+    frame[0U] = 0;
+    frame[kStackChunkSize - 1U] = 0;
+    if (remaining > kStackChunkSize) {
+        TouchStack(remaining - kStackChunkSize);
+    }
+    static_cast<void>(frame[0U]);
+}
+
+/*!
+ * \brief  Native policy of \c policy (SCHED_OTHER for Inherit, which is not passed to the OS).
+ */
+auto ToNativePolicy(SchedulingPolicy policy) noexcept -> int
+{
+    switch (policy) {
+        case SchedulingPolicy::Fifo:
+            return SCHED_FIFO;
+        case SchedulingPolicy::RoundRobin:
+            return SCHED_RR;
+        case SchedulingPolicy::Inherit:
+        case SchedulingPolicy::Other:
+        default:
+            return SCHED_OTHER;
+    }
+}
+
+/*!
+ * \brief  Maps the result of pthread_create() onto an ErrorCode.
+ */
+auto ToCreateError(int result) noexcept -> ErrorCode
+{
+    switch (result) {
+        case EPERM:
+            return ErrorCode::PermissionDenied;
+        case EINVAL:
+            return ErrorCode::InvalidArgument;
+        default:
+            return ErrorCode::CreationFailed;
+    }
+}
+
+} // namespace
+
+/**********************************************************************************************************************
+ *  FUNCTION: Thread::~Thread
+ *********************************************************************************************************************/
+Thread::~Thread() noexcept
+{
+    static_cast<void>(Join());
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: Thread::ValidateConfig
+ *********************************************************************************************************************/
+/*!
+ * \brief  Checks the entry, the priority range of the policy and the stack settings.
+ *
+ * \return ErrorCode::Success, or InvalidArgument for no entry, a priority outside the range of the policy (or
+ *         non-zero with Inherit), a stack smaller than PTHREAD_STACK_MIN, or a stackPrefault not leaving
+ *         kPrefaultReserve bytes of an explicit stack size.
+ */
+auto Thread::ValidateConfig(const ThreadConfig& config) noexcept -> ErrorCode
+{
+    if (config.entry == nullptr) {
+        return ErrorCode::InvalidArgument;
+    }
+
+    if (config.policy == SchedulingPolicy::Inherit) {
+        if (config.priority != 0) {
+            return ErrorCode::InvalidArgument;
+        }
+    } else {
+        int const policy = ToNativePolicy(config.policy);
+        if ((config.priority < ::sched_get_priority_min(policy)) || (config.priority > ::sched_get_priority_max(policy))) {
+            return ErrorCode::InvalidArgument;
+        }
+    }
+
+    // PTHREAD_STACK_MIN is a call to sysconf() (of type long) since glibc 2.34
+    std::size_t const minimum = static_cast<std::size_t>(PTHREAD_STACK_MIN);
+    if ((config.stackSize != 0U) &&
+        ((config.stackSize < minimum) || (config.stackSize < kPrefaultReserve) ||
+         (config.stackPrefault > (config.stackSize - kPrefaultReserve)))) {
+        return ErrorCode::InvalidArgument;
+    }
+    return ErrorCode::Success;
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: Thread::Start
+ *********************************************************************************************************************/
+/*!
+ * \brief  Builds the creation attributes, creates the thread and waits for the outcome of its setup.
+ *
+ * \return ErrorCode indicating the result of the operation:
+ *         - Success:          The thread runs the entry.
+ *         - AlreadyStarted:   A thread was started and not joined.
+ *         - InvalidArgument:  See ValidateConfig(); also a stackPrefault larger than the default stack allows, or
+ *                             an affinity without an online CPU.
+ *         - PermissionDenied: The policy, priority or affinity needs privileges.
+ *         - CreationFailed:   Any other failure of the attributes or of pthread_create().
+ *         - SetupFailed:      The name or affinity could not be applied in the new thread (it was joined).
+ */
+auto Thread::Start(const ThreadConfig& config) noexcept -> ErrorCode
+{
+    if (started_) {
+        return ErrorCode::AlreadyStarted;
+    }
+    ErrorCode const valid = ValidateConfig(config);
+    if (valid != ErrorCode::Success) {
+        return valid;
+    }
+
+    /* 1. Creation attributes: scheduling, stack and (where supported) affinity */
+    pthread_attr_t attributes;
+    if (::pthread_attr_init(&attributes) != 0) {
+        return ErrorCode::CreationFailed;
+    }
+
+    ErrorCode result{ErrorCode::Success};
+    if (config.policy == SchedulingPolicy::Inherit) {
+        if (::pthread_attr_setinheritsched(&attributes, PTHREAD_INHERIT_SCHED) != 0) {
+            result = ErrorCode::CreationFailed;
+        }
+    } else {
+        sched_param parameters{};
+        parameters.sched_priority = config.priority;
+        if ((::pthread_attr_setinheritsched(&attributes, PTHREAD_EXPLICIT_SCHED) != 0) ||
+            (::pthread_attr_setschedpolicy(&attributes, ToNativePolicy(config.policy)) != 0) ||
+            (::pthread_attr_setschedparam(&attributes, &parameters) != 0)) {
+            result = ErrorCode::CreationFailed;
+        }
+    }
+
+    if ((result == ErrorCode::Success) && (config.stackSize != 0U) &&
+        (::pthread_attr_setstacksize(&attributes, config.stackSize) != 0)) {
+        result = ErrorCode::CreationFailed;
+    }
+
+    if ((result == ErrorCode::Success) && (config.stackSize == 0U) && (config.stackPrefault != 0U)) {
+        std::size_t stackSize{0U};
+        if ((::pthread_attr_getstacksize(&attributes, &stackSize) != 0) ||
+            (stackSize < kPrefaultReserve) || (config.stackPrefault > (stackSize - kPrefaultReserve))) {
+            result = ErrorCode::InvalidArgument;
+        }
+    }
+
+    if ((result == ErrorCode::Success) && !config.affinity.IsEmpty() && PlatformThreadControl::HasAttributeAffinity()) {
+        result = PlatformThreadControl::SetAttributeAffinity(attributes, config.affinity);
+    }
+
+    /* 2. Create the thread and wait until it has applied the rest of its setup */
+    if (result == ErrorCode::Success) {
+        config_      = config;
+        setupResult_ = ErrorCode::Success;
+        if (::sem_init(&ready_, 0, 0U) != 0) {
+            result = ErrorCode::CreationFailed;
+        } else {
+            int const created = ::pthread_create(&handle_, &attributes, &Thread::Entry, this);
+            if (created != 0) {
+                result = ToCreateError(created);
+            } else {
+                while ((::sem_wait(&ready_) != 0) && (errno == EINTR)) {
+                }
+                result = setupResult_;
+                if (result != ErrorCode::Success) {
+                    static_cast<void>(::pthread_join(handle_, nullptr));
+                }
+            }
+            static_cast<void>(::sem_destroy(&ready_));
+        }
+    }
+    static_cast<void>(::pthread_attr_destroy(&attributes));
+
+    started_ = (result == ErrorCode::Success);
+    return result;
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: Thread::Join
+ *********************************************************************************************************************/
+auto Thread::Join() noexcept -> ErrorCode
+{
+    if (!started_) {
+        return ErrorCode::NotStarted;
+    }
+    static_cast<void>(::pthread_join(handle_, nullptr));
+    started_ = false;
+    return ErrorCode::Success;
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: Thread::IsStarted
+ *********************************************************************************************************************/
+auto Thread::IsStarted() const noexcept -> bool
+{
+    return started_;
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: Thread::GetNativeHandle
+ *********************************************************************************************************************/
+auto Thread::GetNativeHandle() const noexcept -> pthread_t
+{
+    return handle_;
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: Thread::SetCurrentName
+ *********************************************************************************************************************/
+auto Thread::SetCurrentName(const char* name) noexcept -> ErrorCode
+{
+    return PlatformThreadControl::SetCurrentName(name);
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: Thread::SetCurrentAffinity
+ *********************************************************************************************************************/
+auto Thread::SetCurrentAffinity(const CpuSet& cpus) noexcept -> ErrorCode
+{
+    return PlatformThreadControl::SetCurrentAffinity(cpus);
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: Thread::GetCurrentAffinity
+ *********************************************************************************************************************/
+auto Thread::GetCurrentAffinity(CpuSet& cpus) noexcept -> ErrorCode
+{
+    return PlatformThreadControl::GetCurrentAffinity(cpus);
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: Thread::GetCurrentScheduling
+ *********************************************************************************************************************/
+auto Thread::GetCurrentScheduling() noexcept -> SchedulingInfo
+{
+    SchedulingInfo info{};
+    sched_param parameters{};
+    int policy{SCHED_OTHER};
+    if (::pthread_getschedparam(::pthread_self(), &policy, &parameters) == 0) {
+        info.priority = parameters.sched_priority;
+        if (policy == SCHED_FIFO) {
+            info.policy = SchedulingPolicy::Fifo;
+        } else if (policy == SCHED_RR) {
+            info.policy = SchedulingPolicy::RoundRobin;
+        } else {
+            info.policy = SchedulingPolicy::Other;
+        }
+    }
+    return info;
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: Thread::GetCpuCount
+ *********************************************************************************************************************/
+auto Thread::GetCpuCount() noexcept -> std::size_t
+{
+    return PlatformThreadControl::GetCpuCount();
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: Thread::Entry
+ *********************************************************************************************************************/
+/*!
+ * \brief  Applies the in-thread part of the setup, reports it to Start() and runs the entry on success.
+ *
+ * \note   After the post, Start() may destroy the semaphore; only config_ is read afterwards, which stays valid
+ *         until the thread is joined.
+ */
+auto Thread::Entry(void* argument) noexcept -> void*
+{
+    Thread& self = *static_cast<Thread*>(argument);
+    const ThreadConfig& config = self.config_;
+
+    ErrorCode result{ErrorCode::Success};
+    if (!config.affinity.IsEmpty() && !PlatformThreadControl::HasAttributeAffinity()) {
+        result = PlatformThreadControl::SetCurrentAffinity(config.affinity);
+    }
+    if ((result == ErrorCode::Success) && (config.name != nullptr)) {
+        result = PlatformThreadControl::SetCurrentName(config.name);
+    }
+    if ((result == ErrorCode::Success) && (config.stackPrefault != 0U)) {
+        TouchStack(config.stackPrefault);
+    }
+
+    self.setupResult_ = result;
+    static_cast<void>(::sem_post(&self.ready_));
+
+    if (result == ErrorCode::Success) {
+        config.entry(config.context);
+    }
+    return nullptr;
+}
+
+} // namespace thread
+} // namespace interface
+} // namespace os
+} // namespace ara
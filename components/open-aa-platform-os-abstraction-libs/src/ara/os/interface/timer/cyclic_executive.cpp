@@ -0,0 +1,327 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project (CXX_STANDARD 17)
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara/os/interface/timer/cyclic_executive.cpp
+ *  \brief      Implementation of the ara::os::interface::timer::CyclicExecutive.
+ *
+ *  \details    Each rate group runs on an ara::os::interface::thread::Thread, so that a requested SCHED_FIFO
+ *              priority, the CPU affinity and the name are applied before the first release and a failure is
+ *              reported as an ErrorCode instead of an exception.
+ ***********************************************************************************************************************/
+
+#include "ara/os/interface/timer/cyclic_executive.h"
+
+#include <sched.h>      // For SCHED_FIFO, sched_get_priority_min/max
+
+namespace ara {
+namespace os {
+namespace interface {
+namespace timer {
+
+namespace {
+
+/*!
+ * \brief  Raises \c target to \c value if \c value is larger. \c target has a single writer.
+ */
+auto StoreMax(std::atomic<std::int64_t>& target, std::int64_t value) noexcept -> void
+{
+    if (value > target.load(std::memory_order_relaxed)) {
+        target.store(value, std::memory_order_relaxed);
+    }
+}
+
+/*!
+ * \brief  Increments a single-writer counter by \c amount.
+ */
+auto Increment(std::atomic<std::uint64_t>& counter, std::uint64_t amount) noexcept -> void
+{
+    counter.store(counter.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+}
+
+} // namespace
+
+/**********************************************************************************************************************
+ *  FUNCTION: CyclicExecutive::~CyclicExecutive
+ *********************************************************************************************************************/
+CyclicExecutive::~CyclicExecutive() noexcept
+{
+    Stop();
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: CyclicExecutive::AddRateGroup
+ *********************************************************************************************************************/
+/*!
+ * \brief  Validates and registers a rate group.
+ *
+ * \param[in] config  Rate group configuration.
+ *
+ * \return ErrorCode indicating the result of the operation:
+ *         - Success:          The rate group was registered.
+ *         - AlreadyRunning:   The executive is running.
+ *         - CapacityExceeded: kMaxRateGroups rate groups are already registered.
+ *         - InvalidArgument:  No task, period <= 0, offset outside [0, period), Report without a handler, or a
+ *                             priority outside the SCHED_FIFO range.
+ */
+auto CyclicExecutive::AddRateGroup(const RateGroupConfig& config) noexcept -> ErrorCode
+{
+    if (running_.load(std::memory_order_acquire)) {
+        return ErrorCode::AlreadyRunning;
+    }
+    if (groupCount_ >= kMaxRateGroups) {
+        return ErrorCode::CapacityExceeded;
+    }
+    if ((config.task == nullptr) || (config.period.count() <= 0) || (config.offset.count() < 0) ||
+        (config.offset >= config.period)) {
+        return ErrorCode::InvalidArgument;
+    }
+    if ((config.policy == OverrunPolicy::Report) && (config.overrunHandler == nullptr)) {
+        return ErrorCode::InvalidArgument;
+    }
+    if ((config.priority < 0) ||
+        ((config.priority > 0) && ((config.priority < ::sched_get_priority_min(SCHED_FIFO)) ||
+                                   (config.priority > ::sched_get_priority_max(SCHED_FIFO))))) {
+        return ErrorCode::InvalidArgument;
+    }
+
+    RateGroup& group = groups_[groupCount_];
+    group.config = config;
+    group.owner  = this;
+    ++groupCount_;
+
+    return ErrorCode::Success;
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: CyclicExecutive::Start
+ *********************************************************************************************************************/
+/*!
+ * \brief  Resets the statistics, opens the timers, takes the common epoch and creates one thread per rate group.
+ *
+ * \return ErrorCode::Success, InvalidArgument, AlreadyRunning, ResourceFailure or ThreadCreationFailed.
+ *
+ * \note   The timers are opened here, before any thread exists, so that Stop() can always interrupt them.
+ */
+auto CyclicExecutive::Start() noexcept -> ErrorCode
+{
+    if (running_.load(std::memory_order_acquire)) {
+        return ErrorCode::AlreadyRunning;
+    }
+    if (groupCount_ == 0U) {
+        return ErrorCode::InvalidArgument;
+    }
+
+    for (std::size_t index = 0U; index < groupCount_; ++index) {
+        if (groups_[index].timer.Open() != ErrorCode::Success) {
+            for (std::size_t opened = 0U; opened < index; ++opened) {
+                groups_[opened].timer.Close();
+            }
+            return ErrorCode::ResourceFailure;
+        }
+    }
+
+    stopRequested_.store(false, std::memory_order_relaxed);
+    epoch_ = PlatformDeadlineTimer::Now() + kStartMargin;
+
+    ErrorCode result{ErrorCode::Success};
+    for (std::size_t index = 0U; index < groupCount_; ++index) {
+        RateGroup& group = groups_[index];
+        group.cycles.store(0U, std::memory_order_relaxed);
+        group.overruns.store(0U, std::memory_order_relaxed);
+        group.skippedReleases.store(0U, std::memory_order_relaxed);
+        group.maxLateness.store(0, std::memory_order_relaxed);
+        group.maxExecutionTime.store(0, std::memory_order_relaxed);
+        group.lastError.store(ErrorCode::Success, std::memory_order_relaxed);
+
+        /* 1. Thread setup: inherit the caller's scheduling, or request SCHED_FIFO explicitly; pin and name it */
+        ara::os::interface::thread::ThreadConfig thread{};
+        thread.name     = group.config.name;
+        thread.entry    = &CyclicExecutive::ThreadEntry;
+        thread.context  = &group;
+        thread.affinity = group.config.affinity;
+        if (group.config.priority > 0) {
+            thread.policy   = ara::os::interface::thread::SchedulingPolicy::Fifo;
+            thread.priority = group.config.priority;
+        }
+
+        /* 2. Create the thread; it sleeps until its first release */
+        if (group.thread.Start(thread) != ara::os::interface::thread::ErrorCode::Success) {
+            group.lastError.store(ErrorCode::ThreadCreationFailed, std::memory_order_relaxed);
+            result = ErrorCode::ThreadCreationFailed;
+            break;
+        }
+    }
+
+    /* 3. All or nothing: on a failure, stop the rate groups that were already created */
+    running_.store(true, std::memory_order_release);
+    if (result != ErrorCode::Success) {
+        Stop();
+    }
+
+    return result;
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: CyclicExecutive::Stop
+ *********************************************************************************************************************/
+auto CyclicExecutive::Stop() noexcept -> void
+{
+    if (!running_.load(std::memory_order_acquire)) {
+        return;
+    }
+    stopRequested_.store(true, std::memory_order_release);
+    JoinRateGroups();
+    running_.store(false, std::memory_order_release);
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: CyclicExecutive::IsRunning
+ *********************************************************************************************************************/
+auto CyclicExecutive::IsRunning() const noexcept -> bool
+{
+    return running_.load(std::memory_order_acquire);
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: CyclicExecutive::GetRateGroupCount
+ *********************************************************************************************************************/
+auto CyclicExecutive::GetRateGroupCount() const noexcept -> std::size_t
+{
+    return groupCount_;
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: CyclicExecutive::GetEpoch
+ *********************************************************************************************************************/
+auto CyclicExecutive::GetEpoch() const noexcept -> MonotonicTime
+{
+    return epoch_;
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: CyclicExecutive::GetStatistics
+ *********************************************************************************************************************/
+auto CyclicExecutive::GetStatistics(std::size_t index) const noexcept -> RateGroupStatistics
+{
+    RateGroupStatistics statistics{};
+    if (index >= groupCount_) {
+        return statistics;
+    }
+
+    const RateGroup& group = groups_[index];
+    statistics.cycles           = group.cycles.load(std::memory_order_relaxed);
+    statistics.overruns         = group.overruns.load(std::memory_order_relaxed);
+    statistics.skippedReleases  = group.skippedReleases.load(std::memory_order_relaxed);
+    statistics.maxLateness      = std::chrono::nanoseconds{group.maxLateness.load(std::memory_order_relaxed)};
+    statistics.maxExecutionTime = std::chrono::nanoseconds{group.maxExecutionTime.load(std::memory_order_relaxed)};
+    statistics.lastError        = group.lastError.load(std::memory_order_relaxed);
+    return statistics;
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: CyclicExecutive::ThreadEntry
+ *********************************************************************************************************************/
+auto CyclicExecutive::ThreadEntry(void* context) noexcept -> void
+{
+    RateGroup& group = *static_cast<RateGroup*>(context);
+    group.owner->RunRateGroup(group);
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: CyclicExecutive::RunRateGroup
+ *********************************************************************************************************************/
+/*!
+ * \brief  Release loop of one rate group.
+ *
+ * \details
+ * - Release k is at epoch + offset + k * period; the next release is derived from the grid, not from "now".
+ * - A cycle overruns when it finishes at or after the next release. The overrun policy then decides:
+ *   - Skip:    advance k past every release that has already passed (counted in skippedReleases).
+ *   - CatchUp: keep k; the passed releases are executed immediately, since SleepUntil() returns at once.
+ *   - Report:  call the OverrunHandler, then proceed as Skip.
+ */
+auto CyclicExecutive::RunRateGroup(RateGroup& group) noexcept -> void
+{
+    const RateGroupConfig& config = group.config;
+    const std::int64_t     period = config.period.count();
+
+    std::uint64_t cycle{0U};
+    MonotonicTime release = epoch_ + config.offset;
+
+    while (!stopRequested_.load(std::memory_order_acquire)) {
+        /* 1. Sleep until the absolute release time (Stop() interrupts the sleep) */
+        ErrorCode const slept = group.timer.SleepUntil(release);
+        if (slept == ErrorCode::Interrupted) {
+            continue;
+        }
+        if (slept != ErrorCode::Success) {
+            group.lastError.store(slept, std::memory_order_relaxed);
+            break;
+        }
+        if (stopRequested_.load(std::memory_order_acquire)) {
+            break;
+        }
+
+        /* 2. Run the task */
+        MonotonicTime const started = PlatformDeadlineTimer::Now();
+        CycleInfo const info{cycle, release, started - release};
+        config.task(config.context, info);
+        MonotonicTime const finished = PlatformDeadlineTimer::Now();
+
+        Increment(group.cycles, 1U);
+        StoreMax(group.maxLateness, info.lateness.count());
+        StoreMax(group.maxExecutionTime, (finished - started).count());
+        if (config.metrics != nullptr) {
+            config.metrics->RecordCycle(info.lateness.count(), (finished - started).count());
+        }
+
+        /* 3. Advance on the grid */
+        ++cycle;
+        release += config.period;
+
+        /* 4. Overrun handling: the next release has already passed */
+        if (finished >= release) {
+            Increment(group.overruns, 1U);
+            if (config.metrics != nullptr) {
+                config.metrics->RecordOverrun();
+            }
+            std::uint64_t const missed = static_cast<std::uint64_t>((finished - release).count() / period) + 1U;
+
+            if (config.policy == OverrunPolicy::Report) {
+                OverrunInfo const overrun{info.cycle, finished - started, missed};
+                config.overrunHandler(config.context, overrun);
+            }
+            if (config.policy != OverrunPolicy::CatchUp) {
+                cycle += missed;
+                release += std::chrono::nanoseconds{static_cast<std::int64_t>(missed) * period};
+                Increment(group.skippedReleases, missed);
+            }
+        }
+    }
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: CyclicExecutive::JoinRateGroups
+ *********************************************************************************************************************/
+auto CyclicExecutive::JoinRateGroups() noexcept -> void
+{
+    for (std::size_t index = 0U; index < groupCount_; ++index) {
+        RateGroup& group = groups_[index];
+        if (group.thread.IsStarted()) {
+            group.timer.Interrupt();
+            static_cast<void>(group.thread.Join());
+        }
+        group.timer.Close();
+    }
+}
+
+} // namespace timer
+} // namespace interface
+} // namespace os
+} // namespace ara
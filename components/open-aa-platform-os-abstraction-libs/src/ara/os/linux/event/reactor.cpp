@@ -0,0 +1,383 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project (CXX_STANDARD 17)
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara/os/linux/event/reactor.cpp
+ *  \brief      Linux-specific implementation of the ara::os::interface::event::Reactor interface.
+ *
+ *  \details    All sources are descriptors in one epoll set: the signals arrive through a single signalfd, each timer
+ *              is a periodic timerfd and Wake() writes an eventfd. The epoll data of a source descriptor carries the
+ *              source number; the signalfd and the eventfd carry reserved tags. One epoll_wait() therefore serves
+ *              every source, and all descriptors owned by the reactor are non-blocking so that draining them never
+ *              stalls the waiting thread.
+ ***********************************************************************************************************************/
+
+#include "ara/os/linux/event/reactor.h"
+
+#include <pthread.h>        // For pthread_sigmask
+#include <sys/epoll.h>      // For epoll_create1, epoll_ctl, epoll_wait
+#include <sys/eventfd.h>    // For eventfd, EFD_CLOEXEC, EFD_NONBLOCK
+#include <sys/signalfd.h>   // For signalfd, signalfd_siginfo
+#include <sys/timerfd.h>    // For timerfd_create, timerfd_settime
+#include <unistd.h>         // For read, write, close
+#include <cerrno>           // For errno, EINTR, EAGAIN
+#include <climits>          // For INT_MAX
+#include <initializer_list> // For the range-for over the owned descriptors
+
+namespace ara {
+namespace os {
+namespace linux {
+namespace event {
+
+namespace {
+
+using ara::os::interface::event::ErrorCode;
+using ara::os::interface::event::ReadyEvent;
+using ara::os::interface::event::Readiness;
+using ara::os::interface::event::kMaxSources;
+
+/*!
+ * \brief  Kinds of a source number (ReactorImpl::kinds_).
+ */
+constexpr std::uint8_t kKindNone{0U};
+constexpr std::uint8_t kKindSignal{1U};
+constexpr std::uint8_t kKindTimer{2U};
+constexpr std::uint8_t kKindDescriptor{3U};
+
+/*!
+ * \brief  Reserved epoll tags of the eventfd and the signalfd (source numbers are below kMaxSources).
+ */
+constexpr std::uint64_t kWakeTag{~std::uint64_t{0U}};
+constexpr std::uint64_t kSignalTag{~std::uint64_t{0U} - 1U};
+
+/*!
+ * \brief  Nanoseconds per second and per millisecond.
+ */
+constexpr std::int64_t kNanosecondsPerSecond{1000000000};
+constexpr std::int64_t kNanosecondsPerMillisecond{1000000};
+
+/*!
+ * \brief  Adds \c descriptor with \c events and \c tag to the epoll set.
+ */
+auto AddToEpoll(int epollFd, int descriptor, std::uint32_t events, std::uint64_t tag) noexcept -> bool
+{
+    epoll_event entry{};
+    entry.events   = events;
+    entry.data.u64 = tag;
+    return ::epoll_ctl(epollFd, EPOLL_CTL_ADD, descriptor, &entry) == 0;
+}
+
+/*!
+ * \brief  Converts a timeout to the milliseconds of epoll_wait(), rounding up so that it never returns early.
+ */
+auto ToEpollTimeout(std::chrono::nanoseconds timeout) noexcept -> int
+{
+    if (timeout.count() < 0) {
+        return -1;
+    }
+    std::uint64_t const nanoseconds  = static_cast<std::uint64_t>(timeout.count());
+    std::uint64_t const perMillisecond = static_cast<std::uint64_t>(kNanosecondsPerMillisecond);
+    std::uint64_t const milliseconds = (nanoseconds / perMillisecond) + (((nanoseconds % perMillisecond) != 0U) ? 1U : 0U);
+    return (milliseconds > static_cast<std::uint64_t>(INT_MAX)) ? INT_MAX : static_cast<int>(milliseconds);
+}
+
+/*!
+ * \brief  Translates epoll flags into Readiness flags.
+ */
+auto ToReadiness(std::uint32_t events) noexcept -> std::uint64_t
+{
+    std::uint64_t readiness{0U};
+    if ((events & (EPOLLIN | EPOLLPRI)) != 0U) {
+        readiness |= Readiness::kReadable;
+    }
+    if ((events & EPOLLOUT) != 0U) {
+        readiness |= Readiness::kWritable;
+    }
+    if ((events & (EPOLLHUP | EPOLLRDHUP)) != 0U) {
+        readiness |= Readiness::kHangUp;
+    }
+    if ((events & EPOLLERR) != 0U) {
+        readiness |= Readiness::kError;
+    }
+    return readiness;
+}
+
+} // namespace
+
+/**********************************************************************************************************************
+ *  FUNCTION: ReactorImpl::~ReactorImpl
+ *********************************************************************************************************************/
+/*!
+ * \brief  Closes the file descriptors if still open.
+ */
+ReactorImpl::~ReactorImpl() noexcept
+{
+    CloseImpl();
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: ReactorImpl::OpenImpl
+ *********************************************************************************************************************/
+/*!
+ * \brief  Creates the epoll instance and the non-blocking wake eventfd.
+ *
+ * \return ErrorCode::Success, or ErrorCode::ResourceFailure (all partially created resources are released).
+ */
+auto ReactorImpl::OpenImpl() noexcept -> ErrorCode
+{
+    if (epollFd_ != -1) {
+        return ErrorCode::Success;
+    }
+
+    epollFd_ = ::epoll_create1(EPOLL_CLOEXEC);
+    wakeFd_  = ::eventfd(0U, EFD_CLOEXEC | EFD_NONBLOCK);
+    if ((epollFd_ == -1) || (wakeFd_ == -1) || !AddToEpoll(epollFd_, wakeFd_, EPOLLIN, kWakeTag)) {
+        CloseImpl();
+        return ErrorCode::ResourceFailure;
+    }
+    static_cast<void>(::sigemptyset(&signals_));
+
+    return ErrorCode::Success;
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: ReactorImpl::IsFreeSource
+ *********************************************************************************************************************/
+auto ReactorImpl::IsFreeSource(std::uint32_t source) const noexcept -> bool
+{
+    return (source < kMaxSources) && (kinds_[source] == kKindNone);
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: ReactorImpl::WatchSignalImpl
+ *********************************************************************************************************************/
+/*!
+ * \brief  Blocks \c signalNumber in the calling thread and adds it to the signalfd mask (creating the signalfd on
+ *         the first call).
+ *
+ * \return ErrorCode indicating the result of the operation:
+ *         - Success:         The signal is watched.
+ *         - InvalidArgument: Invalid or used source number, signal out of range or already watched.
+ *         - ResourceFailure: The reactor is not open, or blocking the signal / updating the signalfd failed.
+ */
+auto ReactorImpl::WatchSignalImpl(std::uint32_t source, int signalNumber) noexcept -> ErrorCode
+{
+    if (!IsFreeSource(source) || (signalNumber <= 0) || (signalNumber >= NSIG) ||
+        (signalSources_[signalNumber] != 0U)) {
+        return ErrorCode::InvalidArgument;
+    }
+    if (epollFd_ == -1) {
+        return ErrorCode::ResourceFailure;
+    }
+
+    /* 1. Block the signal so that it stays pending for the signalfd instead of running its default action */
+    sigset_t single{};
+    static_cast<void>(::sigemptyset(&single));
+    if ((::sigaddset(&single, signalNumber) != 0) || (::pthread_sigmask(SIG_BLOCK, &single, nullptr) != 0)) {
+        return ErrorCode::ResourceFailure;
+    }
+
+    /* 2. Extend the mask of the signalfd (signalfd() on an existing descriptor replaces its mask) */
+    sigset_t mask = signals_;
+    static_cast<void>(::sigaddset(&mask, signalNumber));
+    int const descriptor = ::signalfd(signalFd_, &mask, SFD_CLOEXEC | SFD_NONBLOCK);
+    if (descriptor == -1) {
+        return ErrorCode::ResourceFailure;
+    }
+    if (signalFd_ == -1) {
+        if (!AddToEpoll(epollFd_, descriptor, EPOLLIN, kSignalTag)) {
+            static_cast<void>(::close(descriptor));
+            return ErrorCode::ResourceFailure;
+        }
+        signalFd_ = descriptor;
+    }
+
+    signals_                      = mask;
+    signalSources_[signalNumber]  = source + 1U;
+    kinds_[source]                = kKindSignal;
+    return ErrorCode::Success;
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: ReactorImpl::WatchTimerImpl
+ *********************************************************************************************************************/
+/*!
+ * \brief  Creates a non-blocking CLOCK_MONOTONIC timerfd with \c period as first expiry and interval.
+ *
+ * \return ErrorCode::Success, InvalidArgument (source or period), or ResourceFailure.
+ */
+auto ReactorImpl::WatchTimerImpl(std::uint32_t source, std::chrono::nanoseconds period) noexcept -> ErrorCode
+{
+    if (!IsFreeSource(source) || (period.count() <= 0)) {
+        return ErrorCode::InvalidArgument;
+    }
+    if (epollFd_ == -1) {
+        return ErrorCode::ResourceFailure;
+    }
+
+    int const descriptor = ::timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC | TFD_NONBLOCK);
+    if (descriptor == -1) {
+        return ErrorCode::ResourceFailure;
+    }
+
+    // Split as unsigned: the period is known to be positive here
+    std::uint64_t const ticks = static_cast<std::uint64_t>(period.count());
+    itimerspec expiry{};
+    expiry.it_interval.tv_sec  = static_cast<time_t>(ticks / static_cast<std::uint64_t>(kNanosecondsPerSecond));
+    expiry.it_interval.tv_nsec = static_cast<long>(ticks % static_cast<std::uint64_t>(kNanosecondsPerSecond));
+    expiry.it_value            = expiry.it_interval;
+    if ((::timerfd_settime(descriptor, 0, &expiry, nullptr) == -1) ||
+        !AddToEpoll(epollFd_, descriptor, EPOLLIN, source)) {
+        static_cast<void>(::close(descriptor));
+        return ErrorCode::ResourceFailure;
+    }
+
+    timerFds_[source] = descriptor;
+    kinds_[source]    = kKindTimer;
+    return ErrorCode::Success;
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: ReactorImpl::WatchDescriptorImpl
+ *********************************************************************************************************************/
+/*!
+ * \brief  Adds \c descriptor to the epoll set, level-triggered, for the requested Readiness flags.
+ *
+ * \return ErrorCode::Success, InvalidArgument (source, descriptor or empty interest), or ResourceFailure (e.g., a
+ *         regular file, which epoll does not support).
+ */
+auto ReactorImpl::WatchDescriptorImpl(std::uint32_t source, int descriptor, std::uint32_t interest) noexcept
+    -> ErrorCode
+{
+    std::uint32_t events{0U};
+    if ((interest & Readiness::kReadable) != 0U) {
+        events |= EPOLLIN | EPOLLRDHUP;
+    }
+    if ((interest & Readiness::kWritable) != 0U) {
+        events |= EPOLLOUT;
+    }
+    if (!IsFreeSource(source) || (descriptor < 0) || (events == 0U)) {
+        return ErrorCode::InvalidArgument;
+    }
+    if ((epollFd_ == -1) || !AddToEpoll(epollFd_, descriptor, events, source)) {
+        return ErrorCode::ResourceFailure;
+    }
+
+    kinds_[source] = kKindDescriptor;
+    return ErrorCode::Success;
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: ReactorImpl::WaitImpl
+ *********************************************************************************************************************/
+/*!
+ * \brief  Waits on the epoll instance and translates the ready descriptors into ReadyEvent records.
+ *
+ * \return ErrorCode indicating the result of the operation:
+ *         - Success:         \c count events were written (0 after a timeout, a wake-up or EINTR).
+ *         - ResourceFailure: The reactor is not open.
+ *         - WaitFailure:     epoll_wait() failed.
+ *
+ * \note   Signals that do not fit into \c events stay pending in the signalfd and are reported by the next call.
+ */
+auto ReactorImpl::WaitImpl(ReadyEvent* events, std::size_t capacity, std::chrono::nanoseconds timeout,
+                           std::size_t& count) noexcept -> ErrorCode
+{
+    count = 0U;
+    if (epollFd_ == -1) {
+        return ErrorCode::ResourceFailure;
+    }
+
+    epoll_event ready[kMaxSources + 2U]{};
+    int const readyCount = ::epoll_wait(epollFd_, ready, static_cast<int>(kMaxSources + 2U), ToEpollTimeout(timeout));
+    if (readyCount == -1) {
+        return (errno == EINTR) ? ErrorCode::Success : ErrorCode::WaitFailure;
+    }
+
+    std::size_t const readyTotal = static_cast<std::size_t>(readyCount);
+    for (std::size_t i = 0U; (i < readyTotal) && (count < capacity); ++i) {
+        std::uint64_t const tag = ready[i].data.u64;
+
+        if (tag == kWakeTag) {
+            std::uint64_t counter{0U};
+            ssize_t const drained = ::read(wakeFd_, &counter, sizeof(counter)); // Resets the eventfd counter
+            static_cast<void>(drained);
+
+        } else if (tag == kSignalTag) {
+            signalfd_siginfo info{};
+            while ((count < capacity) && (::read(signalFd_, &info, sizeof(info)) == static_cast<ssize_t>(sizeof(info)))) {
+                int const signalNumber = static_cast<int>(info.ssi_signo);
+                if ((signalNumber > 0) && (signalNumber < NSIG) && (signalSources_[signalNumber] != 0U)) {
+                    events[count] = ReadyEvent{signalSources_[signalNumber] - 1U, info.ssi_signo};
+                    ++count;
+                }
+            }
+
+        } else if ((tag < kMaxSources) && (kinds_[tag] == kKindTimer)) {
+            std::uint64_t expirations{0U};
+            if (::read(timerFds_[tag], &expirations, sizeof(expirations)) == static_cast<ssize_t>(sizeof(expirations))) {
+                events[count] = ReadyEvent{static_cast<std::uint32_t>(tag), expirations};
+                ++count;
+            }
+
+        } else if ((tag < kMaxSources) && (kinds_[tag] == kKindDescriptor)) {
+            events[count] = ReadyEvent{static_cast<std::uint32_t>(tag), ToReadiness(ready[i].events)};
+            ++count;
+        }
+    }
+
+    return ErrorCode::Success;
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: ReactorImpl::WakeImpl
+ *********************************************************************************************************************/
+/*!
+ * \brief  Wakes the waiting thread by incrementing the eventfd counter. No-op on a closed reactor.
+ */
+auto ReactorImpl::WakeImpl() noexcept -> void
+{
+    if (wakeFd_ != -1) {
+        std::uint64_t const one{1U};
+        ssize_t const written = ::write(wakeFd_, &one, sizeof(one)); // Fails only if the counter would overflow
+        static_cast<void>(written);
+    }
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: ReactorImpl::CloseImpl
+ *********************************************************************************************************************/
+/*!
+ * \brief  Closes the timerfds, the signalfd, the eventfd and the epoll instance, and forgets all sources.
+ *
+ * \note   The watched signals stay blocked in the thread that registered them, so that a late signal is not
+ *         delivered with its default action.
+ */
+auto ReactorImpl::CloseImpl() noexcept -> void
+{
+    for (std::size_t source = 0U; source < kMaxSources; ++source) {
+        if (kinds_[source] == kKindTimer) {
+            static_cast<void>(::close(timerFds_[source]));
+        }
+        kinds_[source] = kKindNone;
+    }
+    for (std::uint32_t& signalSource : signalSources_) {
+        signalSource = 0U;
+    }
+    for (int* descriptor : {&signalFd_, &wakeFd_, &epollFd_}) {
+        if (*descriptor != -1) {
+            static_cast<void>(::close(*descriptor));
+            *descriptor = -1;
+        }
+    }
+}
+
+} // namespace event
+} // namespace linux
+} // namespace os
+} // namespace ara
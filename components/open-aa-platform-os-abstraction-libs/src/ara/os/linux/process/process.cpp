@@ -10,32 +10,109 @@
  *  \file       ara/os/linux/process/process.cpp
  *  \brief      Linux-specific implementation of the ara::os::interface::process::ProcessInteraction interface.
  *
- *  \details    Implements the GetProcessName method using /proc/<pid>/comm to retrieve the short process name.
+ *  \details    Implements the GetProcessName method using /proc/self/comm to retrieve the short process name.
  *              On Linux, /proc/<pid>/comm typically returns the "comm name," which is often truncated (15 or 16 bytes).
+ *              The file is read with one raw open/read/close sequence into a stack buffer: no iostreams and no heap.
+ *              GetResourceUsageImpl combines getrusage(RUSAGE_SELF), CLOCK_PROCESS_CPUTIME_ID and the resident page
+ *              count of /proc/self/statm, read the same way.
  *
  *  \note       This implementation is thread-safe, uses safe string operations, and handles potential errors gracefully.
  *              It does NOT retrieve the full executable path. For that, you'd typically use /proc/<pid>/exe (via readlink).
  ***********************************************************************************************************************/
 
 #include "ara/os/linux/process/process.h"
-#include "ara/core/array.h" // Include the ara::core::Array template
 
-#include <unistd.h>     // For getpid()
-#include <sys/types.h>  // For pid_t
-#include <fstream>      // For std::ifstream
-#include <cstring>      // For std::strncpy
-#include <cstdio>       // For std::snprintf
+#include <fcntl.h>          // For open, O_RDONLY, O_CLOEXEC
+#include <sys/resource.h>   // For getrusage, RUSAGE_SELF
+#include <time.h>           // For clock_gettime, CLOCK_PROCESS_CPUTIME_ID
+#include <unistd.h>         // For read, close, sysconf
+#include <cerrno>           // For errno, EINTR
+#include <cstdint>          // For std::uint64_t
+#include <cstring>          // For std::memcpy
 
 namespace ara {
 namespace os {
 namespace linux {
 namespace process {
 
+namespace {
+
+/*!
+ * \brief  Size of the stack buffer for /proc/self/comm. The kernel limits comm to TASK_COMM_LEN (16) bytes,
+ *         the extra room detects a larger-than-expected name instead of silently truncating it.
+ */
+constexpr std::size_t kCommBufferSize{64U};
+
+/*!
+ * \brief  Size of the stack buffer for /proc/self/statm (seven decimal page counts).
+ */
+constexpr std::size_t kStatmBufferSize{128U};
+
+/*!
+ * \brief  Reads the whole (small) procfs file \c path into \c buffer with one raw read.
+ *
+ * \return Bytes read, or -1 on a failure.
+ */
+auto ReadProcFile(const char* path, char* buffer, std::size_t bufferSize) noexcept -> ssize_t
+{
+    int fd{-1};
+    do {
+        fd = ::open(path, O_RDONLY | O_CLOEXEC);
+    } while ((fd < 0) && (errno == EINTR));
+    if (fd < 0) {
+        return -1;
+    }
+
+    ssize_t bytesRead{-1};
+    do {
+        bytesRead = ::read(fd, buffer, bufferSize);
+    } while ((bytesRead < 0) && (errno == EINTR));
+    static_cast<void>(::close(fd));
+    return bytesRead;
+}
+
+/*!
+ * \brief  Resident set size in bytes from /proc/self/statm ("size resident shared ..." in pages).
+ *
+ * \return false if the file could not be read or parsed.
+ */
+auto ReadResidentBytes(std::uint64_t& residentBytes) noexcept -> bool
+{
+    char statm[kStatmBufferSize];
+    ssize_t const bytesRead = ReadProcFile("/proc/self/statm", statm, kStatmBufferSize);
+    if (bytesRead <= 0) {
+        return false;
+    }
+
+    // Skip the first field (total program size), then parse the second one
+    std::size_t const length = static_cast<std::size_t>(bytesRead);
+    std::size_t position{0U};
+    while ((position < length) && (statm[position] != ' ')) {
+        ++position;
+    }
+    ++position;
+    std::uint64_t pages{0U};
+    std::size_t digits{0U};
+    while ((position < length) && (statm[position] >= '0') && (statm[position] <= '9')) {
+        pages = (pages * 10U) + static_cast<std::uint64_t>(statm[position] - '0');
+        ++position;
+        ++digits;
+    }
+    long const pageSize = ::sysconf(_SC_PAGESIZE);
+    if ((digits == 0U) || (pageSize <= 0)) {
+        return false;
+    }
+    residentBytes = pages * static_cast<std::uint64_t>(pageSize);
+    return true;
+}
+
+} // namespace
+
 /**********************************************************************************************************************
- *  FUNCTION: ProcessInteractionImpl::GetProcessName
+ *  FUNCTION: ProcessAccessImpl::GetProcessNameImpl
  *********************************************************************************************************************/
 /*!
- * \brief  Retrieves the short name of the current process in Linux (as shown in /proc/<pid>/comm).
+ * \brief  Retrieves the short name of the current process in Linux (as shown in /proc/self/comm).
  *
  * \param[out] buffer      Pointer to the buffer where the process name will be stored.
  * \param[in]  bufferSize  Size of the provided buffer in bytes.
@@ -49,11 +126,12 @@ namespace process {
  * \warning /proc/<pid>/comm can be truncated at 15 or 16 characters by the kernel. If the real process name is longer,
  *          only the first 15 or 16 characters may be retrieved.
  *
- * \note   - This method avoids throwing exceptions.
- *         - Ensures no buffer overflow by using safe string copy operations.
+ * \note   - This method avoids throwing exceptions and never allocates.
+ *         - /proc/self/comm reports the process (thread group leader) name, unlike prctl(PR_GET_NAME), which reports
+ *           the name of the calling thread.
  *         - The returned name is typically the short command name (no path, no args).
  */
-auto ProcessInteractionImpl::GetProcessName(char* buffer, std::size_t bufferSize) const noexcept
+auto ProcessAccessImpl::GetProcessNameImpl(char* buffer, std::size_t bufferSize) noexcept
     -> ara::os::interface::process::ErrorCode
 {
     using ErrorCode = ara::os::interface::process::ErrorCode;
@@ -66,50 +144,95 @@ auto ProcessInteractionImpl::GetProcessName(char* buffer, std::size_t bufferSize
         return ErrorCode::BufferTooSmall; // No space to store anything.
     }
 
-    /* 2. Construct the path to /proc/<pid>/comm */
-    pid_t pid = getpid();
-    constexpr std::size_t maxPathLength = 256;
-    ara::core::Array<char, maxPathLength> procPath{};
-    int snprintfResult = std::snprintf(procPath.data(), maxPathLength, "/proc/%d/comm", pid);
-    if (snprintfResult < 0 || static_cast<std::size_t>(snprintfResult) >= maxPathLength) {
-        // snprintf failed or truncated
-        return ErrorCode::RetrievalFailed;
-    }
+    /* 2. Read the process name (short name) with a single read */
+    char comm[kCommBufferSize];
+    ssize_t const bytesRead = ReadProcFile("/proc/self/comm", comm, kCommBufferSize);
 
-    /* 3. Open the /proc/<pid>/comm file to read the process name */
-    std::ifstream commFile(procPath.data(), std::ios::in);
-    if (!commFile.is_open()) {
-        // Could not open /proc/<pid>/comm
+    if (bytesRead <= 0) {
+        // Could not open or read /proc/self/comm, or the name is empty
         return ErrorCode::RetrievalFailed;
     }
 
-    /* 4. Read the process name (short name) from the comm file */
-    std::string processName;
-    std::getline(commFile, processName);
-    commFile.close();
-
-    /* 5. Validate the retrieved process name */
-    if (processName.empty()) {
-        // Possibly an unexpected read error or empty name
+    /* 3. Strip the trailing newline written by the kernel */
+    std::size_t nameLength = static_cast<std::size_t>(bytesRead);
+    if (comm[nameLength - 1U] == '\n') {
+        --nameLength;
+    }
+    if (nameLength == 0U) {
         return ErrorCode::RetrievalFailed;
     }
 
     /*
-     * 6. Ensure the caller's buffer is large enough.
-     *    We must account for the null terminator, so if processName.length() == 5,
+     * 4. Ensure the caller's buffer is large enough.
+     *    We must account for the null terminator, so if nameLength == 5,
      *    we need at least 6 bytes in bufferSize.
      */
-    if (processName.length() + 1 > bufferSize) {
+    if (nameLength + 1U > bufferSize) {
         return ErrorCode::BufferTooSmall;
     }
 
-    /* 7. Safely copy the short process name into the output buffer */
-    std::strncpy(buffer, processName.c_str(), bufferSize - 1);
-    buffer[bufferSize - 1] = '\0'; // Ensure null-termination
+    /* 5. Copy the short process name into the output buffer */
+    std::memcpy(buffer, comm, nameLength);
+    buffer[nameLength] = '\0'; // Ensure null-termination
 
     return ErrorCode::Success;
 }
 
+/**********************************************************************************************************************
+ *  FUNCTION: ProcessAccessImpl::GetResourceUsageImpl
+ *********************************************************************************************************************/
+/*!
+ * \brief  Reads the resource usage of the current process in Linux.
+ *
+ * \param[out] usage  Receives the counters; unchanged on a failure.
+ *
+ * \return ErrorCode::Success, or RetrievalFailed if getrusage(), clock_gettime() or /proc/self/statm failed.
+ *
+ * \note   The context switches and page faults are the sums over all threads of the process, including threads that
+ *         have already exited.
+ */
+auto ProcessAccessImpl::GetResourceUsageImpl(ara::os::interface::process::ResourceUsage& usage) noexcept
+    -> ara::os::interface::process::ErrorCode
+{
+    using ErrorCode = ara::os::interface::process::ErrorCode;
+
+    struct rusage counters{};
+    timespec cpuTime{};
+    std::uint64_t residentBytes{0U};
+    if ((::getrusage(RUSAGE_SELF, &counters) != 0) || (::clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &cpuTime) != 0) ||
+        !ReadResidentBytes(residentBytes)) {
+        return ErrorCode::RetrievalFailed;
+    }
+
+    usage.residentBytes              = residentBytes;
+    usage.voluntaryContextSwitches   = static_cast<std::uint64_t>(counters.ru_nvcsw);
+    usage.involuntaryContextSwitches = static_cast<std::uint64_t>(counters.ru_nivcsw);
+    usage.minorPageFaults            = static_cast<std::uint64_t>(counters.ru_minflt);
+    usage.majorPageFaults            = static_cast<std::uint64_t>(counters.ru_majflt);
+    usage.cpuTimeNs = (static_cast<std::uint64_t>(cpuTime.tv_sec) * 1000000000U) +
+                      static_cast<std::uint64_t>(cpuTime.tv_nsec);
+    return ErrorCode::Success;
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: ProcessInteractionImpl::GetProcessName
+ *********************************************************************************************************************/
+/*!
+ * \brief  Retrieves the short name of the current process in Linux (as shown in /proc/self/comm).
+ *
+ * \param[out] buffer      Pointer to the buffer where the process name will be stored.
+ * \param[in]  bufferSize  Size of the provided buffer in bytes.
+ *
+ * \return An ara::os::interface::process::ErrorCode indicating the result of the operation.
+ *
+ * \note   Delegates to the static backend ProcessAccessImpl.
+ */
+auto ProcessInteractionImpl::GetProcessName(char* buffer, std::size_t bufferSize) const noexcept
+    -> ara::os::interface::process::ErrorCode
+{
+    return ProcessAccessImpl::GetProcessName(buffer, bufferSize);
+}
+
 /**********************************************************************************************************************
  *  FUNCTION: CreateProcessInteractionInstance
  *********************************************************************************************************************/
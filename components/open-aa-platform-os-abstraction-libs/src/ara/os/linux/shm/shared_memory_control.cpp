@@ -0,0 +1,202 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project (CXX_STANDARD 17)
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara/os/linux/shm/shared_memory_control.cpp
+ *  \brief      Linux-specific implementation of the ara::os::interface::shm::SharedMemoryControl interface.
+ *
+ *  \details    POSIX shared-memory objects, or files on hugetlbfs for huge-page segments. A huge-page file can be
+ *              sized beyond the free huge pages; the missing pages only show when the segment is mapped, which
+ *              SharedMemory then reports as HugePagesUnavailable.
+ ***********************************************************************************************************************/
+
+#include "ara/os/linux/shm/shared_memory_control.h"
+
+#include <fcntl.h>          // For O_CREAT, O_EXCL, O_RDWR, O_RDONLY, O_CLOEXEC, open
+#include <linux/magic.h>    // For HUGETLBFS_MAGIC
+#include <sys/mman.h>       // For shm_open, shm_unlink
+#include <sys/stat.h>       // For fstat, mode constants
+#include <sys/vfs.h>        // For statfs
+#include <unistd.h>         // For ftruncate, close, unlink, sysconf
+#include <cerrno>           // For errno and its values
+#include <climits>          // For PATH_MAX
+#include <cstdio>           // For std::snprintf
+#include <limits>           // For std::numeric_limits
+
+namespace ara {
+namespace os {
+namespace linux {
+namespace shm {
+
+using ara::os::interface::shm::ErrorCode;
+using ara::os::interface::shm::SegmentConfig;
+
+namespace {
+
+/*!
+ * \brief  Access rights of a created segment (owner and group read-write).
+ */
+constexpr mode_t kSegmentMode{S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP};
+
+/*!
+ * \brief  Largest size ftruncate() accepts.
+ */
+constexpr std::size_t kMaxSegmentSize{static_cast<std::size_t>(std::numeric_limits<off_t>::max())};
+
+/*!
+ * \brief  Maps the errno of a failed open/create/unlink onto an ErrorCode.
+ */
+auto ToErrorCode(int error) noexcept -> ErrorCode
+{
+    switch (error) {
+        case EEXIST:
+            return ErrorCode::AlreadyExists;
+        case ENOENT:
+            return ErrorCode::NotFound;
+        case EACCES:
+        case EPERM:
+            return ErrorCode::PermissionDenied;
+        case EINVAL:
+        case ENAMETOOLONG:
+            return ErrorCode::InvalidArgument;
+        default:
+            return ErrorCode::ResourceFailure;
+    }
+}
+
+/*!
+ * \brief  Writes the hugetlbfs path of segment \c name into \c path.
+ *
+ * \return \c false if the path does not fit.
+ */
+auto ToHugePagePath(const char* name, char (&path)[PATH_MAX]) noexcept -> bool
+{
+    int const length = std::snprintf(path, sizeof(path), "%s%s", SharedMemoryControlImpl::kHugePageMount, name);
+    return (length > 0) && (static_cast<std::size_t>(length) < sizeof(path));
+}
+
+/*!
+ * \brief  Page size of the backing memory: the hugetlbfs block size for huge pages, the base page size otherwise.
+ *
+ * \return 0 if huge pages were requested and kHugePageMount is not a hugetlbfs mount.
+ */
+auto GetPageSize(bool hugePages) noexcept -> std::size_t
+{
+    if (!hugePages) {
+        long const pageSize = ::sysconf(_SC_PAGESIZE);
+        return (pageSize > 0) ? static_cast<std::size_t>(pageSize) : 4096U;
+    }
+    struct statfs mount{};
+    if ((::statfs(SharedMemoryControlImpl::kHugePageMount, &mount) != 0) ||
+        (static_cast<unsigned long>(mount.f_type) != static_cast<unsigned long>(HUGETLBFS_MAGIC)) ||
+        (mount.f_bsize <= 0)) {
+        return 0U;
+    }
+    return static_cast<std::size_t>(mount.f_bsize);
+}
+
+/*!
+ * \brief  Opens (or with O_CREAT creates) the memory object of \c name.
+ *
+ * \return The descriptor, or -1 with errno set.
+ */
+auto OpenObject(const char* name, bool hugePages, int flags) noexcept -> int
+{
+    if (!hugePages) {
+        return ::shm_open(name, flags, kSegmentMode);
+    }
+    char path[PATH_MAX];
+    if (!ToHugePagePath(name, path)) {
+        errno = ENAMETOOLONG;
+        return -1;
+    }
+    return ::open(path, flags | O_CLOEXEC, kSegmentMode);
+}
+
+} // namespace
+
+/**********************************************************************************************************************
+ *  FUNCTION: SharedMemoryControlImpl::CreateImpl
+ *********************************************************************************************************************/
+auto SharedMemoryControlImpl::CreateImpl(const SegmentConfig& config, std::size_t& size, int& fd) noexcept
+    -> ErrorCode
+{
+    if (config.typedMemory != nullptr) {
+        return ErrorCode::InvalidArgument;
+    }
+    std::size_t const pageSize = GetPageSize(config.hugePages);
+    if (pageSize == 0U) {
+        return ErrorCode::HugePagesUnavailable;
+    }
+    if (config.size > (kMaxSegmentSize - pageSize)) {
+        return ErrorCode::InvalidArgument;
+    }
+    std::size_t const rounded = ((config.size + pageSize - 1U) / pageSize) * pageSize;
+
+    int const created = OpenObject(config.name, config.hugePages, O_RDWR | O_CREAT | O_EXCL);
+    if (created == -1) {
+        return ToErrorCode(errno);
+    }
+    if (::ftruncate(created, static_cast<off_t>(rounded)) != 0) {
+        int const error = errno;
+        static_cast<void>(::close(created));
+        static_cast<void>(UnlinkImpl(config.name, config.hugePages));
+        return ((error == ENOMEM) && config.hugePages) ? ErrorCode::HugePagesUnavailable
+                                                       : ErrorCode::ResourceFailure;
+    }
+
+    size = rounded;
+    fd   = created;
+    return ErrorCode::Success;
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: SharedMemoryControlImpl::OpenImpl
+ *********************************************************************************************************************/
+auto SharedMemoryControlImpl::OpenImpl(const SegmentConfig& config, std::size_t& size, int& fd) noexcept -> ErrorCode
+{
+    if (config.typedMemory != nullptr) {
+        return ErrorCode::InvalidArgument;
+    }
+    int const opened = OpenObject(config.name, config.hugePages, config.writable ? O_RDWR : O_RDONLY);
+    if (opened == -1) {
+        return ToErrorCode(errno);
+    }
+    struct stat status{};
+    if (::fstat(opened, &status) != 0) {
+        static_cast<void>(::close(opened));
+        return ErrorCode::ResourceFailure;
+    }
+
+    size = static_cast<std::size_t>(status.st_size);
+    fd   = opened;
+    return ErrorCode::Success;
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: SharedMemoryControlImpl::UnlinkImpl
+ *********************************************************************************************************************/
+auto SharedMemoryControlImpl::UnlinkImpl(const char* name, bool hugePages) noexcept -> ErrorCode
+{
+    int result{0};
+    if (!hugePages) {
+        result = ::shm_unlink(name);
+    } else {
+        char path[PATH_MAX];
+        if (!ToHugePagePath(name, path)) {
+            return ErrorCode::InvalidArgument;
+        }
+        result = ::unlink(path);
+    }
+    return (result == 0) ? ErrorCode::Success : ToErrorCode(errno);
+}
+
+} // namespace shm
+} // namespace linux
+} // namespace os
+} // namespace ara
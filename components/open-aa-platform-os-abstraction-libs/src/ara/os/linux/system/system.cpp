@@ -0,0 +1,454 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project (CXX_STANDARD 17)
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara/os/linux/system/system.cpp
+ *  \brief      Linux-specific implementation of the ara::os::interface::system::SystemInteraction interface.
+ *
+ *  \details    The topology is read from sysfs:
+ *              - /sys/devices/system/cpu/{possible,online,isolated}          CPU lists
+ *              - /sys/devices/system/cpu/cpuN/topology/<id>                  physical_package_id, cluster_id, core_id
+ *              - /sys/devices/system/cpu/cpuN/cpu_capacity                   big.LITTLE capacity (arm64, riscv)
+ *              - /sys/devices/system/cpu/cpuN/cpufreq/cpuinfo_max_freq       maximum frequency
+ *              - /sys/devices/system/cpu/cpuN/cache/indexK/<attr>            cache geometry and sharing
+ *              - /sys/devices/system/node/{possible,nodeK/cpulist}           NUMA nodes
+ *              and the affinity from sched_getaffinity(2). Each file is read with one raw open/read/close into a
+ *              stack buffer: no iostreams and no heap.
+ *
+ *  \note       Files missing on older kernels or other architectures (cluster_id, cpu_capacity, cpufreq, the node
+ *              directory) leave the defaults of CpuInfo in place.
+ ***********************************************************************************************************************/
+
+#include "ara/os/linux/system/system.h"
+
+#include <fcntl.h>      // For open, O_RDONLY, O_CLOEXEC
+#include <sched.h>      // For sched_getaffinity, cpu_set_t, CPU_ISSET
+#include <unistd.h>     // For read, close, sysconf
+#include <cerrno>       // For errno, EINTR
+#include <cstdint>      // For std::uint64_t
+#include <cstdio>       // For std::snprintf
+#include <cstring>      // For std::strncmp
+
+namespace ara {
+namespace os {
+namespace linux {
+namespace system {
+
+using ara::os::interface::system::CacheInfo;
+using ara::os::interface::system::CacheType;
+using ara::os::interface::system::CpuInfo;
+using ara::os::interface::system::CpuSet;
+using ara::os::interface::system::CpuTopology;
+using ara::os::interface::system::ErrorCode;
+
+namespace {
+
+/*!
+ * \brief  Size of the stack buffer for one sysfs file. CPU lists of fragmented masks are the longest contents.
+ */
+constexpr std::size_t kFileBufferSize{512U};
+
+/*!
+ * \brief  Size of the stack buffer for one sysfs path.
+ */
+constexpr std::size_t kPathBufferSize{96U};
+
+/*!
+ * \brief  Reads the file at \c path into \c buffer (null-terminated).
+ *
+ * \return The number of bytes read; 0 if the file is missing, unreadable or empty.
+ */
+auto ReadFile(const char* path, char (&buffer)[kFileBufferSize]) noexcept -> std::size_t
+{
+    int fd{-1};
+    do {
+        fd = ::open(path, O_RDONLY | O_CLOEXEC);
+    } while ((fd < 0) && (errno == EINTR));
+    if (fd < 0) {
+        buffer[0] = '\0';
+        return 0U;
+    }
+
+    ssize_t bytesRead{-1};
+    do {
+        bytesRead = ::read(fd, buffer, kFileBufferSize - 1U);
+    } while ((bytesRead < 0) && (errno == EINTR));
+    static_cast<void>(::close(fd));
+
+    std::size_t const length = (bytesRead > 0) ? static_cast<std::size_t>(bytesRead) : 0U;
+    buffer[length] = '\0';
+    return length;
+}
+
+/*!
+ * \brief  Parses a decimal number at \c cursor and advances \c cursor past it.
+ *
+ * \return \c false (and \c cursor is unchanged) if \c cursor does not point to a digit.
+ */
+auto ParseUnsigned(const char*& cursor, std::uint64_t& value) noexcept -> bool
+{
+    if ((*cursor < '0') || (*cursor > '9')) {
+        return false;
+    }
+    value = 0U;
+    while ((*cursor >= '0') && (*cursor <= '9')) {
+        value = (value * 10U) + static_cast<std::uint64_t>(*cursor - '0');
+        ++cursor;
+    }
+    return true;
+}
+
+/*!
+ * \brief  Reads a file holding one decimal number.
+ */
+auto ReadUnsigned(const char* path, std::uint64_t& value) noexcept -> bool
+{
+    char buffer[kFileBufferSize];
+    const char* cursor = buffer;
+    return (ReadFile(path, buffer) > 0U) && ParseUnsigned(cursor, value);
+}
+
+/*!
+ * \brief  Parses a CPU list ("0-3,8,10-11", possibly empty) into \c cpus.
+ *
+ * \param[out] highest  Highest CPU of the list (unchanged for an empty list).
+ *
+ * \return \c false if the list is malformed. CPUs >= CpuSet::kMaxCpus are reported through \c highest only.
+ */
+auto ParseCpuList(const char* text, CpuSet& cpus, std::uint64_t& highest) noexcept -> bool
+{
+    const char* cursor = text;
+    while ((*cursor != '\0') && (*cursor != '\n')) {
+        std::uint64_t first{0U};
+        if (!ParseUnsigned(cursor, first)) {
+            return false;
+        }
+        std::uint64_t last{first};
+        if (*cursor == '-') {
+            ++cursor;
+            if (!ParseUnsigned(cursor, last) || (last < first)) {
+                return false;
+            }
+        }
+        for (std::uint64_t cpu = first; (cpu <= last) && (cpu < CpuSet::kMaxCpus); ++cpu) {
+            static_cast<void>(cpus.Add(static_cast<std::size_t>(cpu)));
+        }
+        highest = (last > highest) ? last : highest;
+        if (*cursor == ',') {
+            ++cursor;
+        }
+    }
+    return true;
+}
+
+/*!
+ * \brief  Parses a cache size ("48K", "1024K", "32M") into bytes.
+ */
+auto ParseSize(const char* text) noexcept -> std::uint32_t
+{
+    const char* cursor = text;
+    std::uint64_t value{0U};
+    if (!ParseUnsigned(cursor, value)) {
+        return 0U;
+    }
+    if (*cursor == 'K') {
+        value *= 1024U;
+    } else if (*cursor == 'M') {
+        value *= 1024U * 1024U;
+    } else if (*cursor == 'G') {
+        value *= 1024U * 1024U * 1024U;
+    }
+    return (value <= UINT32_MAX) ? static_cast<std::uint32_t>(value) : UINT32_MAX;
+}
+
+/*!
+ * \brief  Reads /sys/devices/system/cpu/cpu<cpu>/<file> as a decimal number.
+ */
+auto ReadCpuUnsigned(std::size_t cpu, const char* file, std::uint64_t& value) noexcept -> bool
+{
+    char path[kPathBufferSize];
+    static_cast<void>(std::snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%zu/%s", cpu, file));
+    return ReadUnsigned(path, value);
+}
+
+/*!
+ * \brief  Reads cache \c index of \c cpu.
+ *
+ * \return \c false if the cache does not exist.
+ */
+auto ReadCache(std::size_t cpu, std::size_t index, CacheInfo& cache) noexcept -> bool
+{
+    char path[kPathBufferSize];
+    char buffer[kFileBufferSize];
+    auto const readEntry = [cpu, index, &path, &buffer](const char* file) noexcept -> std::size_t {
+        static_cast<void>(std::snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%zu/cache/index%zu/%s",
+                                        cpu, index, file));
+        return ReadFile(path, buffer);
+    };
+
+    std::uint64_t value{0U};
+    const char* cursor = buffer;
+    if ((readEntry("level") == 0U) || !ParseUnsigned(cursor, value)) {
+        return false;
+    }
+    cache = CacheInfo{};
+    cache.level = static_cast<std::uint8_t>(value);
+
+    static_cast<void>(readEntry("type"));
+    if (std::strncmp(buffer, "Data", 4U) == 0) {
+        cache.type = CacheType::Data;
+    } else if (std::strncmp(buffer, "Instruction", 11U) == 0) {
+        cache.type = CacheType::Instruction;
+    } else {
+        cache.type = CacheType::Unified;
+    }
+
+    cursor = buffer;
+    if ((readEntry("coherency_line_size") > 0U) && ParseUnsigned(cursor, value)) {
+        cache.lineSize = static_cast<std::uint16_t>(value);
+    }
+    if (readEntry("size") > 0U) {
+        cache.size = ParseSize(buffer);
+    }
+
+    CpuSet sharing{};
+    std::uint64_t highest{0U};
+    if ((readEntry("shared_cpu_list") > 0U) && ParseCpuList(buffer, sharing, highest) && !sharing.IsEmpty()) {
+        std::size_t first{0U};
+        while (!sharing.Contains(first)) {
+            ++first;
+        }
+        cache.firstSharedCpu = static_cast<std::uint16_t>(first);
+        cache.sharedCpuCount = static_cast<std::uint16_t>(sharing.Count());
+    } else {
+        cache.firstSharedCpu = static_cast<std::uint16_t>(cpu);
+    }
+    return true;
+}
+
+/*!
+ * \brief  Reads the placement, capacity, frequency and caches of the online \c cpu.
+ *
+ * \return Whether a cpu_capacity file was found.
+ */
+auto ReadCpu(std::size_t cpu, CpuInfo& info) noexcept -> bool
+{
+    std::uint64_t value{0U};
+    if (ReadCpuUnsigned(cpu, "topology/physical_package_id", value)) {
+        info.packageId = static_cast<std::uint16_t>(value);
+    }
+    info.clusterId = ReadCpuUnsigned(cpu, "topology/cluster_id", value) ? static_cast<std::uint16_t>(value)
+                                                                          : info.packageId;
+    if (ReadCpuUnsigned(cpu, "topology/core_id", value)) {
+        info.coreId = static_cast<std::uint16_t>(value);
+    }
+    if (ReadCpuUnsigned(cpu, "cpufreq/cpuinfo_max_freq", value)) {
+        info.maxFrequencyKhz = static_cast<std::uint32_t>(value);
+    }
+
+    while ((info.cacheCount < CpuInfo::kMaxCacheCount) &&
+           ReadCache(cpu, info.cacheCount, info.caches[info.cacheCount])) {
+        ++info.cacheCount;
+    }
+
+    bool const hasCapacity = ReadCpuUnsigned(cpu, "cpu_capacity", value) && (value > 0U);
+    if (hasCapacity) {
+        info.capacity = static_cast<std::uint16_t>((value < CpuInfo::kMaxCapacity) ? value : CpuInfo::kMaxCapacity);
+    }
+    return hasCapacity;
+}
+
+/*!
+ * \brief  Without cpu_capacity (x86 hybrid parts, older kernels), derives the capacity from the maximum frequency.
+ *
+ * \details CPUs within 10 % of the fastest keep kMaxCapacity, so the favored cores of Turbo Boost Max do not make a
+ *          homogeneous part look heterogeneous.
+ */
+auto DeriveCapacityFromFrequency(CpuTopology& topology) noexcept -> void
+{
+    std::uint64_t fastest{0U};
+    for (std::size_t cpu = 0U; cpu < topology.cpuCount; ++cpu) {
+        std::uint64_t const frequency = topology.cpus[cpu].maxFrequencyKhz;
+        fastest = (frequency > fastest) ? frequency : fastest;
+    }
+    if (fastest == 0U) {
+        return;
+    }
+    for (std::size_t cpu = 0U; cpu < topology.cpuCount; ++cpu) {
+        std::uint64_t const frequency = topology.cpus[cpu].maxFrequencyKhz;
+        if ((frequency != 0U) && ((frequency * 10U) < (fastest * 9U))) {
+            std::uint64_t const capacity = (frequency * CpuInfo::kMaxCapacity) / fastest;
+            topology.cpus[cpu].capacity = static_cast<std::uint16_t>((capacity > 0U) ? capacity : 1U);
+        }
+    }
+}
+
+/*!
+ * \brief  Assigns the NUMA node of every CPU from /sys/devices/system/node (all CPUs stay on node 0 without it).
+ */
+auto ReadNumaNodes(CpuTopology& topology) noexcept -> void
+{
+    char buffer[kFileBufferSize];
+    CpuSet nodes{};
+    std::uint64_t highestNode{0U};
+    if ((ReadFile("/sys/devices/system/node/possible", buffer) == 0U) ||
+        !ParseCpuList(buffer, nodes, highestNode)) {
+        return;
+    }
+    for (std::size_t node = 0U; node < CpuSet::kMaxCpus; ++node) {
+        if (!nodes.Contains(node)) {
+            continue;
+        }
+        char path[kPathBufferSize];
+        static_cast<void>(std::snprintf(path, sizeof(path), "/sys/devices/system/node/node%zu/cpulist", node));
+        CpuSet cpus{};
+        std::uint64_t highest{0U};
+        if ((ReadFile(path, buffer) == 0U) || !ParseCpuList(buffer, cpus, highest)) {
+            continue;
+        }
+        for (std::size_t cpu = 0U; cpu < topology.cpuCount; ++cpu) {
+            if (cpus.Contains(cpu)) {
+                topology.cpus[cpu].numaNode = static_cast<std::uint16_t>(node);
+            }
+        }
+    }
+}
+
+} // namespace
+
+/**********************************************************************************************************************
+ *  FUNCTION: SystemAccessImpl::GetCpuTopologyImpl
+ *********************************************************************************************************************/
+/*!
+ * \brief  Reads the topology of all CPUs from sysfs and the affinity of the calling thread.
+ *
+ * \return An ara::os::interface::system::ErrorCode indicating the result of the operation:
+ *         - Success:         The topology was read.
+ *         - Truncated:       The system has more than CpuSet::kMaxCpus CPUs; the first kMaxCpus are described.
+ *         - RetrievalFailed: The possible or online CPU list could not be read (sysfs not mounted).
+ */
+auto SystemAccessImpl::GetCpuTopologyImpl(CpuTopology& topology) noexcept -> ErrorCode
+{
+    topology = CpuTopology{};
+
+    /* 1. CPU lists: possible CPUs size the table, online CPUs are described, isolated CPUs are optional */
+    char buffer[kFileBufferSize];
+    CpuSet possible{};
+    std::uint64_t highest{0U};
+    if ((ReadFile("/sys/devices/system/cpu/possible", buffer) == 0U) || !ParseCpuList(buffer, possible, highest)) {
+        return ErrorCode::RetrievalFailed;
+    }
+    bool const truncated = (highest >= CpuSet::kMaxCpus);
+    topology.cpuCount = truncated ? CpuSet::kMaxCpus : static_cast<std::size_t>(highest + 1U);
+
+    std::uint64_t ignored{0U};
+    if ((ReadFile("/sys/devices/system/cpu/online", buffer) == 0U) ||
+        !ParseCpuList(buffer, topology.online, ignored)) {
+        return ErrorCode::RetrievalFailed;
+    }
+    if (ReadFile("/sys/devices/system/cpu/isolated", buffer) > 0U) {
+        static_cast<void>(ParseCpuList(buffer, topology.isolated, ignored));
+    }
+
+    /* 2. Affinity of the calling thread */
+    cpu_set_t affinity;
+    CPU_ZERO(&affinity);
+    if (::sched_getaffinity(0, sizeof(affinity), &affinity) == 0) {
+        for (std::size_t cpu = 0U; cpu < topology.cpuCount; ++cpu) {
+            if (CPU_ISSET(cpu, &affinity)) {
+                static_cast<void>(topology.allowed.Add(cpu));
+            }
+        }
+    }
+
+    /* 3. Per-CPU placement, capacity and caches (offline CPUs have no topology directory) */
+    bool anyCapacity{false};
+    for (std::size_t cpu = 0U; cpu < topology.cpuCount; ++cpu) {
+        if (topology.online.Contains(cpu)) {
+            anyCapacity = ReadCpu(cpu, topology.cpus[cpu]) || anyCapacity;
+            for (std::size_t i = 0U; i < topology.cpus[cpu].cacheCount; ++i) {
+                const CacheInfo& cache = topology.cpus[cpu].caches[i];
+                if ((cache.type != CacheType::Instruction) && (cache.lineSize > topology.cacheLineSize)) {
+                    topology.cacheLineSize = cache.lineSize;
+                }
+            }
+        }
+    }
+    if (!anyCapacity) {
+        DeriveCapacityFromFrequency(topology);
+    }
+
+    /* 4. NUMA nodes */
+    ReadNumaNodes(topology);
+
+    return truncated ? ErrorCode::Truncated : ErrorCode::Success;
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: SystemAccessImpl::GetCacheLineSizeImpl
+ *********************************************************************************************************************/
+/*!
+ * \brief  Largest coherency line size of the data and unified caches of CPU 0.
+ *
+ * \return The line size in bytes; sysconf(_SC_LEVEL1_DCACHE_LINESIZE) if sysfs has no cache entries; 0 if unknown.
+ */
+auto SystemAccessImpl::GetCacheLineSizeImpl() noexcept -> std::size_t
+{
+    std::size_t lineSize{0U};
+    CacheInfo cache{};
+    for (std::size_t index = 0U; (index < CpuInfo::kMaxCacheCount) && ReadCache(0U, index, cache); ++index) {
+        if ((cache.type != CacheType::Instruction) && (cache.lineSize > lineSize)) {
+            lineSize = cache.lineSize;
+        }
+    }
+    if (lineSize == 0U) {
+        long const configured = ::sysconf(_SC_LEVEL1_DCACHE_LINESIZE);
+        lineSize = (configured > 0) ? static_cast<std::size_t>(configured) : 0U;
+    }
+    return lineSize;
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: SystemInteractionImpl::GetCpuTopology
+ *********************************************************************************************************************/
+/*!
+ * \note   Delegates to the static backend SystemAccessImpl.
+ */
+auto SystemInteractionImpl::GetCpuTopology(CpuTopology& topology) const noexcept -> ErrorCode
+{
+    return SystemAccessImpl::GetCpuTopology(topology);
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: SystemInteractionImpl::GetCacheLineSize
+ *********************************************************************************************************************/
+/*!
+ * \note   Delegates to the static backend SystemAccessImpl.
+ */
+auto SystemInteractionImpl::GetCacheLineSize() const noexcept -> std::size_t
+{
+    return SystemAccessImpl::GetCacheLineSize();
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: CreateSystemInteractionInstance
+ *********************************************************************************************************************/
+/*!
+ * \brief  Factory function to create a Linux-specific SystemInteraction instance.
+ *
+ * \return A std::unique_ptr to an ara::os::interface::system::SystemInteraction object.
+ */
+auto CreateSystemInteractionInstance() -> std::unique_ptr<ara::os::interface::system::SystemInteraction>
+{
+    return std::make_unique<SystemInteractionImpl>();
+}
+
+} // namespace system
+} // namespace linux
+} // namespace os
+} // namespace ara
@@ -0,0 +1,155 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project (CXX_STANDARD 17)
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara/os/linux/thread/thread_control.cpp
+ *  \brief      Linux-specific implementation of the ara::os::interface::thread::ThreadControl interface.
+ *
+ *  \details    CPU affinity through cpu_set_t (sched_setaffinity semantics: at least one allowed CPU must be online),
+ *              thread names through pthread_setname_np.
+ ***********************************************************************************************************************/
+
+#include "ara/os/linux/thread/thread_control.h"
+
+#include <sched.h>      // For cpu_set_t, CPU_ZERO, CPU_SET, CPU_ISSET, CPU_SETSIZE
+#include <unistd.h>     // For sysconf, _SC_NPROCESSORS_CONF
+#include <cerrno>       // For EINVAL, EPERM
+#include <cstring>      // For std::strncpy
+
+namespace ara {
+namespace os {
+namespace linux {
+namespace thread {
+
+using ara::os::interface::thread::CpuSet;
+using ara::os::interface::thread::ErrorCode;
+
+namespace {
+
+/*!
+ * \brief  Size of a Linux thread name including the terminating null character.
+ */
+constexpr std::size_t kThreadNameSize{16U};
+
+/*!
+ * \brief  Number of CPUs representable in both a CpuSet and a cpu_set_t.
+ */
+constexpr std::size_t kCpuLimit{(CpuSet::kMaxCpus < static_cast<std::size_t>(CPU_SETSIZE))
+                                    ? CpuSet::kMaxCpus
+                                    : static_cast<std::size_t>(CPU_SETSIZE)};
+
+/*!
+ * \brief  Converts a CpuSet into a cpu_set_t.
+ */
+auto ToCpuSet(const CpuSet& cpus) noexcept -> cpu_set_t
+{
+    cpu_set_t native;
+    CPU_ZERO(&native);
+    for (std::size_t cpu = 0U; cpu < kCpuLimit; ++cpu) {
+        if (cpus.Contains(cpu)) {
+            CPU_SET(cpu, &native);
+        }
+    }
+    return native;
+}
+
+/*!
+ * \brief  Maps the errno-style result of the affinity calls onto an ErrorCode.
+ */
+auto ToErrorCode(int result, ErrorCode otherwise) noexcept -> ErrorCode
+{
+    switch (result) {
+        case 0:
+            return ErrorCode::Success;
+        case EINVAL:
+            return ErrorCode::InvalidArgument;
+        case EPERM:
+            return ErrorCode::PermissionDenied;
+        default:
+            return otherwise;
+    }
+}
+
+} // namespace
+
+/**********************************************************************************************************************
+ *  FUNCTION: ThreadControlImpl::SetAttributeAffinityImpl
+ *********************************************************************************************************************/
+/*!
+ * \brief  Stores \c cpus in \c attributes; pthread_create() then fails with EINVAL if none of them is online.
+ *
+ * \return ErrorCode::Success, InvalidArgument (empty set) or CreationFailed.
+ */
+auto ThreadControlImpl::SetAttributeAffinityImpl(pthread_attr_t& attributes, const CpuSet& cpus) noexcept -> ErrorCode
+{
+    if (cpus.IsEmpty()) {
+        return ErrorCode::InvalidArgument;
+    }
+    cpu_set_t const native = ToCpuSet(cpus);
+    return (::pthread_attr_setaffinity_np(&attributes, sizeof(native), &native) == 0) ? ErrorCode::Success
+                                                                                       : ErrorCode::CreationFailed;
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: ThreadControlImpl::SetCurrentAffinityImpl
+ *********************************************************************************************************************/
+auto ThreadControlImpl::SetCurrentAffinityImpl(const CpuSet& cpus) noexcept -> ErrorCode
+{
+    if (cpus.IsEmpty()) {
+        return ErrorCode::InvalidArgument;
+    }
+    cpu_set_t const native = ToCpuSet(cpus);
+    return ToErrorCode(::pthread_setaffinity_np(::pthread_self(), sizeof(native), &native), ErrorCode::SetupFailed);
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: ThreadControlImpl::GetCurrentAffinityImpl
+ *********************************************************************************************************************/
+auto ThreadControlImpl::GetCurrentAffinityImpl(CpuSet& cpus) noexcept -> ErrorCode
+{
+    cpu_set_t native;
+    CPU_ZERO(&native);
+    if (::pthread_getaffinity_np(::pthread_self(), sizeof(native), &native) != 0) {
+        return ErrorCode::SetupFailed;
+    }
+
+    cpus = CpuSet{};
+    for (std::size_t cpu = 0U; cpu < kCpuLimit; ++cpu) {
+        if (CPU_ISSET(cpu, &native)) {
+            static_cast<void>(cpus.Add(cpu));
+        }
+    }
+    return ErrorCode::Success;
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: ThreadControlImpl::SetCurrentNameImpl
+ *********************************************************************************************************************/
+auto ThreadControlImpl::SetCurrentNameImpl(const char* name) noexcept -> ErrorCode
+{
+    if (name == nullptr) {
+        return ErrorCode::InvalidArgument;
+    }
+    char truncated[kThreadNameSize]{};
+    std::strncpy(truncated, name, kThreadNameSize - 1U);
+    return (::pthread_setname_np(::pthread_self(), truncated) == 0) ? ErrorCode::Success : ErrorCode::SetupFailed;
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: ThreadControlImpl::GetCpuCountImpl
+ *********************************************************************************************************************/
+auto ThreadControlImpl::GetCpuCountImpl() noexcept -> std::size_t
+{
+    long const configured = ::sysconf(_SC_NPROCESSORS_CONF);
+    return (configured > 0) ? static_cast<std::size_t>(configured) : 1U;
+}
+
+} // namespace thread
+} // namespace linux
+} // namespace os
+} // namespace ara
@@ -0,0 +1,192 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project (CXX_STANDARD 17)
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara/os/linux/timer/deadline_timer.cpp
+ *  \brief      Linux-specific implementation of the ara::os::interface::timer::DeadlineTimer interface.
+ *
+ *  \details    Absolute-deadline sleeping on a CLOCK_MONOTONIC timerfd armed with TFD_TIMER_ABSTIME. The kernel
+ *              compares the deadline against the clock itself, so the time spent between computing the deadline and
+ *              entering the sleep does not shift the wake-up. An eventfd polled next to the timerfd allows another
+ *              thread to end the sleep early.
+ ***********************************************************************************************************************/
+
+#include "ara/os/linux/timer/deadline_timer.h"
+
+#include <poll.h>           // For poll, pollfd, POLLIN
+#include <sys/eventfd.h>    // For eventfd, EFD_CLOEXEC, EFD_NONBLOCK
+#include <sys/timerfd.h>    // For timerfd_create, timerfd_settime, TFD_TIMER_ABSTIME
+#include <time.h>           // For clock_gettime, CLOCK_MONOTONIC
+#include <unistd.h>         // For read, write, close
+#include <cerrno>           // For errno, EINTR
+
+namespace ara {
+namespace os {
+namespace linux {
+namespace timer {
+
+namespace {
+
+/*!
+ * \brief  Nanoseconds per second.
+ */
+constexpr std::int64_t kNanosecondsPerSecond{1000000000};
+
+} // namespace
+
+/**********************************************************************************************************************
+ *  FUNCTION: DeadlineTimerImpl::~DeadlineTimerImpl
+ *********************************************************************************************************************/
+/*!
+ * \brief  Closes the file descriptors if still open.
+ */
+DeadlineTimerImpl::~DeadlineTimerImpl() noexcept
+{
+    CloseImpl();
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: DeadlineTimerImpl::NowImpl
+ *********************************************************************************************************************/
+/*!
+ * \brief  Reads CLOCK_MONOTONIC.
+ *
+ * \return The current monotonic time. CLOCK_MONOTONIC is always available on Linux; a failing read returns 0.
+ */
+auto DeadlineTimerImpl::NowImpl() noexcept -> ara::os::interface::timer::MonotonicTime
+{
+    timespec now{};
+    if (::clock_gettime(CLOCK_MONOTONIC, &now) != 0) {
+        return ara::os::interface::timer::MonotonicTime{0};
+    }
+    return ara::os::interface::timer::MonotonicTime{
+        (static_cast<std::int64_t>(now.tv_sec) * kNanosecondsPerSecond) + static_cast<std::int64_t>(now.tv_nsec)};
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: DeadlineTimerImpl::OpenImpl
+ *********************************************************************************************************************/
+/*!
+ * \brief  Creates the CLOCK_MONOTONIC timerfd and the non-blocking eventfd.
+ *
+ * \return ErrorCode::Success, or ErrorCode::ResourceFailure (all partially created resources are released).
+ */
+auto DeadlineTimerImpl::OpenImpl() noexcept -> ara::os::interface::timer::ErrorCode
+{
+    using ErrorCode = ara::os::interface::timer::ErrorCode;
+
+    if (timerFd_ != -1) {
+        return ErrorCode::Success;
+    }
+
+    timerFd_ = ::timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC);
+    wakeFd_  = ::eventfd(0U, EFD_CLOEXEC | EFD_NONBLOCK);
+    if ((timerFd_ == -1) || (wakeFd_ == -1)) {
+        CloseImpl();
+        return ErrorCode::ResourceFailure;
+    }
+
+    return ErrorCode::Success;
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: DeadlineTimerImpl::SleepUntilImpl
+ *********************************************************************************************************************/
+/*!
+ * \brief  Arms the timerfd for \c deadline (TFD_TIMER_ABSTIME) and waits for its expiry or an interruption.
+ *
+ * \param[in] deadline  Absolute monotonic deadline.
+ *
+ * \return ErrorCode indicating the result of the operation:
+ *         - Success:         The deadline was reached.
+ *         - Interrupted:     Interrupt() was called (before or during the sleep).
+ *         - ResourceFailure: The timer is not open.
+ *         - ClockFailure:    Arming, polling or reading the timerfd failed.
+ *
+ * \note   After EINTR the poll is repeated; the timer stays armed for the same absolute deadline.
+ */
+auto DeadlineTimerImpl::SleepUntilImpl(ara::os::interface::timer::MonotonicTime deadline) noexcept
+    -> ara::os::interface::timer::ErrorCode
+{
+    using ErrorCode = ara::os::interface::timer::ErrorCode;
+
+    if (timerFd_ == -1) {
+        return ErrorCode::ResourceFailure;
+    }
+
+    /* 1. Arm one-shot at the absolute deadline (a zero it_value would disarm: clamp to 1 ns) */
+    std::int64_t const ticks = (deadline.count() > 0) ? deadline.count() : 1;
+
+    itimerspec expiry{};
+    expiry.it_value.tv_sec  = static_cast<time_t>(ticks / kNanosecondsPerSecond);
+    expiry.it_value.tv_nsec = static_cast<long>(ticks % kNanosecondsPerSecond);
+    if (::timerfd_settime(timerFd_, TFD_TIMER_ABSTIME, &expiry, nullptr) == -1) {
+        return ErrorCode::ClockFailure;
+    }
+
+    /* 2. Wait for the expiry or a wake-up */
+    pollfd descriptors[2]{{timerFd_, POLLIN, 0}, {wakeFd_, POLLIN, 0}};
+    for (;;) {
+        if (::poll(descriptors, 2U, -1) == -1) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return ErrorCode::ClockFailure;
+        }
+
+        std::uint64_t count{0U};
+        if ((descriptors[1].revents & POLLIN) != 0) {
+            ssize_t const drained = ::read(wakeFd_, &count, sizeof(count)); // Resets the eventfd counter
+            static_cast<void>(drained);
+            return ErrorCode::Interrupted;
+        }
+        if ((descriptors[0].revents & POLLIN) != 0) {
+            return (::read(timerFd_, &count, sizeof(count)) == static_cast<ssize_t>(sizeof(count)))
+                       ? ErrorCode::Success
+                       : ErrorCode::ClockFailure;
+        }
+    }
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: DeadlineTimerImpl::InterruptImpl
+ *********************************************************************************************************************/
+/*!
+ * \brief  Wakes the sleeping thread by incrementing the eventfd counter. No-op on a closed timer.
+ */
+auto DeadlineTimerImpl::InterruptImpl() noexcept -> void
+{
+    if (wakeFd_ != -1) {
+        std::uint64_t const one{1U};
+        ssize_t const written = ::write(wakeFd_, &one, sizeof(one)); // Fails only if the counter would overflow
+        static_cast<void>(written);
+    }
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: DeadlineTimerImpl::CloseImpl
+ *********************************************************************************************************************/
+/*!
+ * \brief  Closes the timerfd and the eventfd.
+ */
+auto DeadlineTimerImpl::CloseImpl() noexcept -> void
+{
+    if (timerFd_ != -1) {
+        static_cast<void>(::close(timerFd_));
+        timerFd_ = -1;
+    }
+    if (wakeFd_ != -1) {
+        static_cast<void>(::close(wakeFd_));
+        wakeFd_ = -1;
+    }
+}
+
+} // namespace timer
+} // namespace linux
+} // namespace os
+} // namespace ara
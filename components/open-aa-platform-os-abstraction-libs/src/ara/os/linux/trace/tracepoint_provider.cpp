@@ -0,0 +1,24 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project (CXX_STANDARD 17)
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara/os/linux/trace/tracepoint_provider.cpp
+ *  \brief      Probe definitions of the LTTng-UST tracepoint provider "ara_os".
+ *
+ *  \details    Expands ara_os_tracepoint.h once with TRACEPOINT_CREATE_PROBES (the probe callbacks and the event
+ *              descriptions) and TRACEPOINT_DEFINE (the tracepoint state and its registration constructor). The
+ *              provider is linked statically into ara::os::trace, so every application using the probes registers
+ *              it at startup; lttng-ust is loaded with dlopen only once a session is active.
+ *
+ *  \note       Only compiled when ARA_OS_TRACE_BACKEND=LTTNG.
+ ***********************************************************************************************************************/
+
+#define TRACEPOINT_CREATE_PROBES
+#define TRACEPOINT_DEFINE
+
+#include "ara/os/linux/trace/ara_os_tracepoint.h"
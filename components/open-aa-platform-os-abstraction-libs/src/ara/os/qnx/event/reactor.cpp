@@ -0,0 +1,414 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project (CXX_STANDARD 17)
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara/os/qnx/event/reactor.cpp
+ *  \brief      QNX-specific implementation of the ara::os::interface::event::Reactor interface.
+ *
+ *  \details    Every source is turned into a pulse on one private channel, so a single MsgReceivePulse() serves all
+ *              of them. The pulse code identifies the kind of source and the pulse value carries the source number
+ *              (or the signal number). Pulses are delivered at the priority of the receiving thread.
+ ***********************************************************************************************************************/
+
+#include "ara/os/qnx/event/reactor.h"
+
+#include <pthread.h>        // For pthread_sigmask
+#include <sys/iomsg.h>      // For _NOTIFY_ACTION_POLLARM, _NOTIFY_COND_INPUT, _NOTIFY_COND_OUTPUT
+#include <sys/neutrino.h>   // For ChannelCreate, ConnectAttach, MsgReceivePulse, MsgSendPulse, TimerTimeout
+#include <sys/siginfo.h>    // For SIGEV_PULSE_INIT, SIGEV_PULSE_PRIO_INHERIT
+#include <unistd.h>         // For ionotify
+#include <atomic>           // For std::atomic
+#include <cerrno>           // For errno, EINTR, ETIMEDOUT
+
+namespace ara {
+namespace os {
+namespace qnx {
+namespace event {
+
+namespace {
+
+using ara::os::interface::event::ErrorCode;
+using ara::os::interface::event::ReadyEvent;
+using ara::os::interface::event::Readiness;
+using ara::os::interface::event::kMaxSources;
+
+/*!
+ * \brief  Kinds of a source number (ReactorImpl::kinds_).
+ */
+constexpr std::uint8_t kKindNone{0U};
+constexpr std::uint8_t kKindSignal{1U};
+constexpr std::uint8_t kKindTimer{2U};
+constexpr std::uint8_t kKindDescriptor{3U};
+
+/*!
+ * \brief  Pulse codes of the private channel.
+ */
+constexpr int kWakePulseCode{_PULSE_CODE_MINAVAIL};
+constexpr int kTimerPulseCode{_PULSE_CODE_MINAVAIL + 1};
+constexpr int kSignalPulseCode{_PULSE_CODE_MINAVAIL + 2};
+constexpr int kDescriptorPulseCode{_PULSE_CODE_MINAVAIL + 3};
+
+/*!
+ * \brief  Nanoseconds per second.
+ */
+constexpr std::int64_t kNanosecondsPerSecond{1000000000};
+
+/*!
+ * \brief  Connection the signal handler sends its pulses through (-1: no reactor watches signals), and its owner.
+ */
+std::atomic<int>  gSignalConnection{-1};
+std::atomic<void*> gSignalOwner{nullptr};
+
+/*!
+ * \brief  Signal handler forwarding the signal number as a pulse to the reactor watching the signals.
+ */
+auto ForwardSignal(int signalNumber) noexcept -> void
+{
+    int const connection = gSignalConnection.load(std::memory_order_relaxed);
+    if (connection != -1) {
+        static_cast<void>(::MsgSendPulse(connection, -1, kSignalPulseCode, signalNumber));
+    }
+}
+
+/*!
+ * \brief  Translates ionotify conditions into Readiness flags.
+ */
+auto ToReadiness(int conditions) noexcept -> std::uint64_t
+{
+    std::uint64_t readiness{0U};
+    if ((conditions & _NOTIFY_COND_INPUT) != 0) {
+        readiness |= Readiness::kReadable;
+    }
+    if ((conditions & _NOTIFY_COND_OUTPUT) != 0) {
+        readiness |= Readiness::kWritable;
+    }
+    return readiness;
+}
+
+} // namespace
+
+/**********************************************************************************************************************
+ *  FUNCTION: ReactorImpl::~ReactorImpl
+ *********************************************************************************************************************/
+/*!
+ * \brief  Releases the timers, connection and channel if still open.
+ */
+ReactorImpl::~ReactorImpl() noexcept
+{
+    CloseImpl();
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: ReactorImpl::OpenImpl
+ *********************************************************************************************************************/
+/*!
+ * \brief  Creates the private channel and the side-channel connection.
+ *
+ * \return ErrorCode::Success, or ErrorCode::ResourceFailure (all partially created resources are released).
+ */
+auto ReactorImpl::OpenImpl() noexcept -> ErrorCode
+{
+    if (channelId_ != -1) {
+        return ErrorCode::Success;
+    }
+
+    /* 1. Private channel: only pulses of our own sources are received on it */
+    channelId_ = ::ChannelCreate(_NTO_CHF_PRIVATE);
+    if (channelId_ == -1) {
+        return ErrorCode::ResourceFailure;
+    }
+
+    /* 2. Side-channel connection the kernel, the handler and Wake() send the pulses through */
+    connectionId_ = ::ConnectAttach(0, 0, channelId_, _NTO_SIDE_CHANNEL, 0);
+    if (connectionId_ == -1) {
+        CloseImpl();
+        return ErrorCode::ResourceFailure;
+    }
+    static_cast<void>(::sigemptyset(&signals_));
+
+    return ErrorCode::Success;
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: ReactorImpl::IsFreeSource
+ *********************************************************************************************************************/
+auto ReactorImpl::IsFreeSource(std::uint32_t source) const noexcept -> bool
+{
+    return (source < kMaxSources) && (kinds_[source] == kKindNone);
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: ReactorImpl::WatchSignalImpl
+ *********************************************************************************************************************/
+/*!
+ * \brief  Blocks \c signalNumber in the calling thread and installs the pulse-forwarding handler.
+ *
+ * \return ErrorCode indicating the result of the operation:
+ *         - Success:         The signal is watched.
+ *         - InvalidArgument: Invalid or used source number, signal out of range or already watched.
+ *         - ResourceFailure: The reactor is not open, another reactor watches signals, or sigaction failed.
+ */
+auto ReactorImpl::WatchSignalImpl(std::uint32_t source, int signalNumber) noexcept -> ErrorCode
+{
+    if (!IsFreeSource(source) || (signalNumber <= 0) || (signalNumber >= NSIG) ||
+        (signalSources_[signalNumber] != 0U)) {
+        return ErrorCode::InvalidArgument;
+    }
+    if (channelId_ == -1) {
+        return ErrorCode::ResourceFailure;
+    }
+
+    /* 1. Become the (single) reactor receiving the signals of the process */
+    void* expected{nullptr};
+    if (!gSignalOwner.compare_exchange_strong(expected, this) && (expected != this)) {
+        return ErrorCode::ResourceFailure;
+    }
+    gSignalConnection.store(connectionId_, std::memory_order_relaxed);
+
+    /* 2. Block the signal here; Wait() unblocks the watched signals while it receives */
+    sigset_t single{};
+    static_cast<void>(::sigemptyset(&single));
+    static_cast<void>(::sigaddset(&single, signalNumber));
+    if (::pthread_sigmask(SIG_BLOCK, &single, nullptr) != 0) {
+        return ErrorCode::ResourceFailure;
+    }
+
+    struct sigaction action{};
+    action.sa_handler = &ForwardSignal;
+    static_cast<void>(::sigfillset(&action.sa_mask));
+    if (::sigaction(signalNumber, &action, nullptr) == -1) {
+        return ErrorCode::ResourceFailure;
+    }
+
+    static_cast<void>(::sigaddset(&signals_, signalNumber));
+    signalSources_[signalNumber] = source + 1U;
+    kinds_[source]               = kKindSignal;
+    return ErrorCode::Success;
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: ReactorImpl::WatchTimerImpl
+ *********************************************************************************************************************/
+/*!
+ * \brief  Creates a CLOCK_MONOTONIC pulse timer with \c period as first expiry and interval.
+ *
+ * \return ErrorCode::Success, InvalidArgument (source or period), or ResourceFailure.
+ */
+auto ReactorImpl::WatchTimerImpl(std::uint32_t source, std::chrono::nanoseconds period) noexcept -> ErrorCode
+{
+    if (!IsFreeSource(source) || (period.count() <= 0)) {
+        return ErrorCode::InvalidArgument;
+    }
+    if (channelId_ == -1) {
+        return ErrorCode::ResourceFailure;
+    }
+
+    sigevent event{};
+    SIGEV_PULSE_INIT(&event, connectionId_, SIGEV_PULSE_PRIO_INHERIT, kTimerPulseCode, static_cast<int>(source));
+    if (::timer_create(CLOCK_MONOTONIC, &event, &timers_[source]) == -1) {
+        return ErrorCode::ResourceFailure;
+    }
+
+    itimerspec expiry{};
+    // Split as unsigned: the period is known to be positive here
+    std::uint64_t const ticks = static_cast<std::uint64_t>(period.count());
+    expiry.it_interval.tv_sec  = static_cast<time_t>(ticks / static_cast<std::uint64_t>(kNanosecondsPerSecond));
+    expiry.it_interval.tv_nsec = static_cast<long>(ticks % static_cast<std::uint64_t>(kNanosecondsPerSecond));
+    expiry.it_value            = expiry.it_interval;
+    if (::timer_settime(timers_[source], 0, &expiry, nullptr) == -1) {
+        static_cast<void>(::timer_delete(timers_[source]));
+        return ErrorCode::ResourceFailure;
+    }
+
+    kinds_[source] = kKindTimer;
+    return ErrorCode::Success;
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: ReactorImpl::WatchDescriptorImpl
+ *********************************************************************************************************************/
+/*!
+ * \brief  Registers \c descriptor; the ionotify is armed by the next Wait().
+ *
+ * \return ErrorCode::Success, InvalidArgument (source, descriptor or empty interest), or ResourceFailure.
+ */
+auto ReactorImpl::WatchDescriptorImpl(std::uint32_t source, int descriptor, std::uint32_t interest) noexcept
+    -> ErrorCode
+{
+    std::int32_t conditions{0};
+    if ((interest & Readiness::kReadable) != 0U) {
+        conditions |= _NOTIFY_COND_INPUT;
+    }
+    if ((interest & Readiness::kWritable) != 0U) {
+        conditions |= _NOTIFY_COND_OUTPUT;
+    }
+    if (!IsFreeSource(source) || (descriptor < 0) || (conditions == 0)) {
+        return ErrorCode::InvalidArgument;
+    }
+    if (channelId_ == -1) {
+        return ErrorCode::ResourceFailure;
+    }
+
+    descriptors_[source] = descriptor;
+    conditions_[source]  = conditions;
+    armed_[source]       = false;
+    kinds_[source]       = kKindDescriptor;
+    return ErrorCode::Success;
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: ReactorImpl::ArmDescriptor
+ *********************************************************************************************************************/
+/*!
+ * \brief  Arms the ionotify of descriptor source \c source.
+ *
+ * \return The readiness that is already met (the notification is then not armed), or 0 once it is armed. A failing
+ *         ionotify is reported once as Readiness::kError.
+ */
+auto ReactorImpl::ArmDescriptor(std::uint32_t source) noexcept -> std::uint64_t
+{
+    sigevent event{};
+    SIGEV_PULSE_INIT(&event, connectionId_, SIGEV_PULSE_PRIO_INHERIT, kDescriptorPulseCode, static_cast<int>(source));
+
+    int const met = ::ionotify(descriptors_[source], _NOTIFY_ACTION_POLLARM, conditions_[source], &event);
+    if (met == -1) {
+        armed_[source] = true;  // Do not report the failure on every Wait()
+        return Readiness::kError;
+    }
+
+    std::uint64_t const readiness = ToReadiness(met & conditions_[source]);
+    armed_[source] = (readiness == 0U);
+    return readiness;
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: ReactorImpl::WaitImpl
+ *********************************************************************************************************************/
+/*!
+ * \brief  Re-arms the descriptors, then receives one pulse and translates it into a ReadyEvent record.
+ *
+ * \return ErrorCode indicating the result of the operation:
+ *         - Success:         \c count events were written (0 after a timeout, a wake-up or a signal interruption).
+ *         - ResourceFailure: The reactor is not open.
+ *         - WaitFailure:     MsgReceivePulse() failed.
+ *
+ * \note   Descriptors whose readiness is already met are reported without blocking.
+ */
+auto ReactorImpl::WaitImpl(ReadyEvent* events, std::size_t capacity, std::chrono::nanoseconds timeout,
+                           std::size_t& count) noexcept -> ErrorCode
+{
+    count = 0U;
+    if (channelId_ == -1) {
+        return ErrorCode::ResourceFailure;
+    }
+
+    /* 1. Level-triggered descriptors: report the ones that are still (or already) ready */
+    for (std::uint32_t source = 0U; (source < kMaxSources) && (count < capacity); ++source) {
+        if ((kinds_[source] == kKindDescriptor) && !armed_[source]) {
+            std::uint64_t const readiness = ArmDescriptor(source);
+            if (readiness != 0U) {
+                events[count] = ReadyEvent{source, readiness};
+                ++count;
+            }
+        }
+    }
+    if (count > 0U) {
+        return ErrorCode::Success;
+    }
+
+    /* 2. Receive one pulse, with the watched signals unblocked in this thread only */
+    if (timeout.count() >= 0) {
+        std::uint64_t limit = static_cast<std::uint64_t>(timeout.count());
+        static_cast<void>(::TimerTimeout(CLOCK_MONOTONIC, _NTO_TIMEOUT_RECEIVE, nullptr, &limit, nullptr));
+    }
+    sigset_t previous{};
+    static_cast<void>(::pthread_sigmask(SIG_UNBLOCK, &signals_, &previous));
+    _pulse pulse{};
+    int const received = ::MsgReceivePulse(channelId_, &pulse, sizeof(pulse), nullptr);
+    int const error = errno;
+    static_cast<void>(::pthread_sigmask(SIG_SETMASK, &previous, nullptr));
+    if (received == -1) {
+        return ((error == EINTR) || (error == ETIMEDOUT)) ? ErrorCode::Success : ErrorCode::WaitFailure;
+    }
+
+    /* 3. Translate the pulse */
+    std::int32_t const value = pulse.value.sival_int;
+    std::uint32_t const source = static_cast<std::uint32_t>(value);
+    if ((pulse.code == kTimerPulseCode) && (source < kMaxSources) && (kinds_[source] == kKindTimer)) {
+        events[count] = ReadyEvent{source, 1U};
+        ++count;
+    } else if ((pulse.code == kSignalPulseCode) && (value > 0) && (value < NSIG) && (signalSources_[value] != 0U)) {
+        events[count] = ReadyEvent{signalSources_[value] - 1U, static_cast<std::uint64_t>(value)};
+        ++count;
+    } else if ((pulse.code == kDescriptorPulseCode) && (source < kMaxSources) &&
+               (kinds_[source] == kKindDescriptor)) {
+        std::uint64_t const readiness = ArmDescriptor(source);
+        if (readiness != 0U) {
+            events[count] = ReadyEvent{source, readiness};
+            ++count;
+        }
+    }
+
+    return ErrorCode::Success;
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: ReactorImpl::WakeImpl
+ *********************************************************************************************************************/
+/*!
+ * \brief  Sends the wake pulse (at the priority of the calling thread). No-op on a closed reactor.
+ */
+auto ReactorImpl::WakeImpl() noexcept -> void
+{
+    if (connectionId_ != -1) {
+        static_cast<void>(::MsgSendPulse(connectionId_, -1, kWakePulseCode, 0));
+    }
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: ReactorImpl::CloseImpl
+ *********************************************************************************************************************/
+/*!
+ * \brief  Deletes the timers, restores the default action of the watched signals (they stay blocked), detaches the
+ *         connection and destroys the channel.
+ */
+auto ReactorImpl::CloseImpl() noexcept -> void
+{
+    for (std::size_t source = 0U; source < kMaxSources; ++source) {
+        if (kinds_[source] == kKindTimer) {
+            static_cast<void>(::timer_delete(timers_[source]));
+        }
+        kinds_[source] = kKindNone;
+        armed_[source] = false;
+    }
+    for (int signalNumber = 1; signalNumber < NSIG; ++signalNumber) {
+        if (signalSources_[signalNumber] != 0U) {
+            struct sigaction action{};
+            action.sa_handler = SIG_DFL;
+            static_cast<void>(::sigaction(signalNumber, &action, nullptr));
+            signalSources_[signalNumber] = 0U;
+        }
+    }
+    void* expected{this};
+    if (gSignalOwner.compare_exchange_strong(expected, nullptr)) {
+        gSignalConnection.store(-1, std::memory_order_relaxed);
+    }
+    if (connectionId_ != -1) {
+        static_cast<void>(::ConnectDetach(connectionId_));
+        connectionId_ = -1;
+    }
+    if (channelId_ != -1) {
+        static_cast<void>(::ChannelDestroy(channelId_));
+        channelId_ = -1;
+    }
+}
+
+} // namespace event
+} // namespace qnx
+} // namespace os
+} // namespace ara
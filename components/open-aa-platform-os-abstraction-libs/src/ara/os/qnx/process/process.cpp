@@ -10,22 +10,162 @@
  *  \file       ara/os/qnx/process/process.cpp
  *  \brief      QNX-specific implementation of the ara::os::interface::process::ProcessInteraction interface.
  *
- *  \details    Implements the GetProcessName method using QNX system calls and standard libraries.
+ *  \details    Implements the GetProcessName method from the program name held by libc (getprogname()). libc
+ *              initializes it from argv[0] at process start, so retrieving it needs no kernel call.
+ *              GetResourceUsageImpl combines getrusage(RUSAGE_SELF), CLOCK_PROCESS_CPUTIME_ID and the resident page
+ *              runs of the address space reported by DCMD_PROC_PAGEDATA on /proc/self/as.
  *
  *  \note       This implementation ensures thread safety and handles potential errors gracefully.
  ***********************************************************************************************************************/
 
 #include "ara/os/qnx/process/process.h"
-#include "ara/core/array.h" // Include the ara::core::Array template
 
-#include <unistd.h>         // For getpid
-#include <cstring>          // For std::strncpy
+#include <devctl.h>         // For devctl
+#include <fcntl.h>          // For open, O_RDONLY, O_CLOEXEC
+#include <stdlib.h>         // For getprogname
+#include <sys/mman.h>       // For PG_HWMAPPED
+#include <sys/procfs.h>     // For DCMD_PROC_PAGEDATA, procfs_mapinfo
+#include <sys/resource.h>   // For getrusage, RUSAGE_SELF
+#include <time.h>           // For clock_gettime, CLOCK_PROCESS_CPUTIME_ID
+#include <unistd.h>         // For close
+#include <cerrno>           // For errno, EINTR
+#include <cstdint>          // For std::uint64_t
+#include <cstring>          // For std::strlen, std::memcpy
 
 namespace ara {
 namespace os {
 namespace qnx {
 namespace process {
 
+namespace {
+
+/*!
+ * \brief  Page runs read per DCMD_PROC_PAGEDATA call (on the stack of the caller, about 10 KiB).
+ */
+constexpr int kPageRunCapacity{256};
+
+/*!
+ * \brief  Resident bytes of the current process: the sum of its page runs mapped in hardware.
+ *
+ * \return false if /proc/self/as could not be queried. A process with more than kPageRunCapacity page runs is
+ *         reported with its first kPageRunCapacity runs.
+ */
+auto ReadResidentBytes(std::uint64_t& residentBytes) noexcept -> bool
+{
+    int fd{-1};
+    do {
+        fd = ::open("/proc/self/as", O_RDONLY | O_CLOEXEC);
+    } while ((fd < 0) && (errno == EINTR));
+    if (fd < 0) {
+        return false;
+    }
+
+    procfs_mapinfo runs[kPageRunCapacity];
+    int runCount{0};
+    int const result = ::devctl(fd, DCMD_PROC_PAGEDATA, runs, sizeof(runs), &runCount);
+    static_cast<void>(::close(fd));
+    if (result != EOK) {
+        return false;
+    }
+
+    std::uint64_t bytes{0U};
+    int const available = (runCount < kPageRunCapacity) ? runCount : kPageRunCapacity;
+    for (int index = 0; index < available; ++index) {
+        if ((runs[index].flags & PG_HWMAPPED) != 0U) {
+            bytes += static_cast<std::uint64_t>(runs[index].size);
+        }
+    }
+    residentBytes = bytes;
+    return true;
+}
+
+} // namespace
+
+/**********************************************************************************************************************
+ *  FUNCTION: ProcessAccessImpl::GetProcessNameImpl
+ *********************************************************************************************************************/
+/*!
+ * \brief  Retrieves the name of the current process.
+ *
+ * \param[out] buffer      Pointer to the buffer where the process name will be stored.
+ * \param[in]  bufferSize  Size of the provided buffer in bytes.
+ *
+ * \return An ara::os::interface::process::ErrorCode indicating the result of the operation:
+ *         - Success:        The process name was retrieved successfully.
+ *         - NullBuffer:     The output buffer pointer was null.
+ *         - BufferTooSmall: The provided buffer is too small to hold the process name.
+ *         - RetrievalFailed:libc holds no program name.
+ *
+ * \note   getprogname() returns the basename of argv[0] stored by libc; no syscall and no allocation is involved.
+ */
+auto ProcessAccessImpl::GetProcessNameImpl(char* buffer, std::size_t bufferSize) noexcept
+    -> ara::os::interface::process::ErrorCode
+{
+    using ErrorCode = ara::os::interface::process::ErrorCode;
+
+    /* 1. Validate input parameters */
+    if (buffer == nullptr) {
+        return ErrorCode::NullBuffer;
+    }
+    if (bufferSize == 0) {
+        return ErrorCode::BufferTooSmall;
+    }
+
+    /* 2. Fetch the program name kept by libc */
+    const char* programName = getprogname();
+    if ((programName == nullptr) || (programName[0] == '\0')) {
+        return ErrorCode::RetrievalFailed;
+    }
+
+    /* 3. Ensure the caller's buffer is large enough (including the null terminator) */
+    std::size_t const nameLength = std::strlen(programName);
+    if (nameLength + 1U > bufferSize) {
+        return ErrorCode::BufferTooSmall;
+    }
+
+    /* 4. Copy the name into the output buffer */
+    std::memcpy(buffer, programName, nameLength);
+    buffer[nameLength] = '\0';
+
+    return ErrorCode::Success;
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: ProcessAccessImpl::GetResourceUsageImpl
+ *********************************************************************************************************************/
+/*!
+ * \brief  Reads the resource usage of the current process on QNX.
+ *
+ * \param[out] usage  Receives the counters; unchanged on a failure.
+ *
+ * \return ErrorCode::Success, or RetrievalFailed if getrusage(), clock_gettime() or /proc/self/as failed.
+ *
+ * \note   The kernel does not maintain every rusage counter; those it leaves at 0 (typically the context switches)
+ *         are reported as 0.
+ */
+auto ProcessAccessImpl::GetResourceUsageImpl(ara::os::interface::process::ResourceUsage& usage) noexcept
+    -> ara::os::interface::process::ErrorCode
+{
+    using ErrorCode = ara::os::interface::process::ErrorCode;
+
+    struct rusage counters{};
+    timespec cpuTime{};
+    std::uint64_t residentBytes{0U};
+    if ((::getrusage(RUSAGE_SELF, &counters) != 0) || (::clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &cpuTime) != 0) ||
+        !ReadResidentBytes(residentBytes)) {
+        return ErrorCode::RetrievalFailed;
+    }
+
+    usage.residentBytes              = residentBytes;
+    usage.voluntaryContextSwitches   = static_cast<std::uint64_t>(counters.ru_nvcsw);
+    usage.involuntaryContextSwitches = static_cast<std::uint64_t>(counters.ru_nivcsw);
+    usage.minorPageFaults            = static_cast<std::uint64_t>(counters.ru_minflt);
+    usage.majorPageFaults            = static_cast<std::uint64_t>(counters.ru_majflt);
+    usage.cpuTimeNs = (static_cast<std::uint64_t>(cpuTime.tv_sec) * 1000000000U) +
+                      static_cast<std::uint64_t>(cpuTime.tv_nsec);
+    return ErrorCode::Success;
+}
+
 /**********************************************************************************************************************
  *  FUNCTION: ProcessInteractionImpl::GetProcessName
  *********************************************************************************************************************/
@@ -37,11 +177,12 @@ namespace process {
  *
  * \return An ara::os::interface::process::ErrorCode indicating the result of the operation.
  *
- * \note   This method avoids exceptions and uses safe string operations to prevent buffer overflows.
+ * \note   Delegates to the static backend ProcessAccessImpl.
  */
-auto ProcessInteractionImpl::GetProcessName(char* buffer, std::size_t bufferSize) const noexcept -> ara::os::interface::process::ErrorCode {
-
-    return ara::os::interface::process::ErrorCode::NullBuffer;
+auto ProcessInteractionImpl::GetProcessName(char* buffer, std::size_t bufferSize) const noexcept
+    -> ara::os::interface::process::ErrorCode
+{
+    return ProcessAccessImpl::GetProcessName(buffer, bufferSize);
 }
 
 /**********************************************************************************************************************
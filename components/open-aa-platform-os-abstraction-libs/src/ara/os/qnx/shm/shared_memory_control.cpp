@@ -0,0 +1,153 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project (CXX_STANDARD 17)
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara/os/qnx/shm/shared_memory_control.cpp
+ *  \brief      QNX-specific implementation of the ara::os::interface::shm::SharedMemoryControl interface.
+ *
+ *  \details    The memory of a segment is allocated once by shm_ctl(); a shared-memory object cannot be resized
+ *              afterwards, which matches the fixed layout the segments are used with.
+ ***********************************************************************************************************************/
+
+#include "ara/os/qnx/shm/shared_memory_control.h"
+
+#include <fcntl.h>          // For O_CREAT, O_EXCL, O_RDWR, O_RDONLY
+#include <sys/mman.h>       // For shm_open, shm_ctl, shm_unlink, posix_typed_mem_open, SHMCTL_*
+#include <sys/stat.h>       // For fstat, mode constants
+#include <unistd.h>         // For close, sysconf
+#include <cerrno>           // For errno and its values
+#include <cstdint>          // For std::uint64_t
+
+namespace ara {
+namespace os {
+namespace qnx {
+namespace shm {
+
+using ara::os::interface::shm::ErrorCode;
+using ara::os::interface::shm::SegmentConfig;
+
+namespace {
+
+/*!
+ * \brief  Access rights of a created segment (owner and group read-write).
+ */
+constexpr mode_t kSegmentMode{S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP};
+
+/*!
+ * \brief  Maps the errno of a failed open/create/unlink onto an ErrorCode.
+ */
+auto ToErrorCode(int error) noexcept -> ErrorCode
+{
+    switch (error) {
+        case EEXIST:
+            return ErrorCode::AlreadyExists;
+        case ENOENT:
+            return ErrorCode::NotFound;
+        case EACCES:
+        case EPERM:
+            return ErrorCode::PermissionDenied;
+        case EINVAL:
+        case ENAMETOOLONG:
+            return ErrorCode::InvalidArgument;
+        default:
+            return ErrorCode::ResourceFailure;
+    }
+}
+
+/*!
+ * \brief  Allocates the memory of the object \c fd with shm_ctl().
+ */
+auto AllocateMemory(int fd, const SegmentConfig& config, std::size_t size) noexcept -> ErrorCode
+{
+    if (config.typedMemory != nullptr) {
+        int const pool = ::posix_typed_mem_open(config.typedMemory, O_RDWR, POSIX_TYPED_MEM_ALLOCATE_CONTIG);
+        if (pool == -1) {
+            return ToErrorCode(errno);
+        }
+        int const result = ::shm_ctl(fd, SHMCTL_ANON | SHMCTL_TYMEM, static_cast<std::uint64_t>(pool), size);
+        int const error  = errno;
+        static_cast<void>(::close(pool));
+        return (result == -1) ? ToErrorCode(error) : ErrorCode::Success;
+    }
+    if (config.hugePages) {
+        if (::shm_ctl(fd, SHMCTL_ANON | SHMCTL_PHYS, 0U, size) == -1) {
+            return (errno == ENOMEM) ? ErrorCode::HugePagesUnavailable : ToErrorCode(errno);
+        }
+        return ErrorCode::Success;
+    }
+    return (::shm_ctl(fd, SHMCTL_ANON, 0U, size) == -1) ? ErrorCode::ResourceFailure : ErrorCode::Success;
+}
+
+} // namespace
+
+/**********************************************************************************************************************
+ *  FUNCTION: SharedMemoryControlImpl::CreateImpl
+ *********************************************************************************************************************/
+auto SharedMemoryControlImpl::CreateImpl(const SegmentConfig& config, std::size_t& size, int& fd) noexcept
+    -> ErrorCode
+{
+    long const basePage = ::sysconf(_SC_PAGESIZE);
+    std::size_t const pageSize = config.hugePages ? kLargePageSize
+                                                  : ((basePage > 0) ? static_cast<std::size_t>(basePage) : 4096U);
+    if (config.size > (~std::size_t{0U} - pageSize)) {
+        return ErrorCode::InvalidArgument;
+    }
+    std::size_t const rounded = ((config.size + pageSize - 1U) / pageSize) * pageSize;
+
+    int const created = ::shm_open(config.name, O_RDWR | O_CREAT | O_EXCL, kSegmentMode);
+    if (created == -1) {
+        return ToErrorCode(errno);
+    }
+    ErrorCode const allocated = AllocateMemory(created, config, rounded);
+    if (allocated != ErrorCode::Success) {
+        static_cast<void>(::close(created));
+        static_cast<void>(::shm_unlink(config.name));
+        return allocated;
+    }
+
+    size = rounded;
+    fd   = created;
+    return ErrorCode::Success;
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: SharedMemoryControlImpl::OpenImpl
+ *********************************************************************************************************************/
+auto SharedMemoryControlImpl::OpenImpl(const SegmentConfig& config, std::size_t& size, int& fd) noexcept -> ErrorCode
+{
+    int const opened = ::shm_open(config.name, config.writable ? O_RDWR : O_RDONLY, 0);
+    if (opened == -1) {
+        return ToErrorCode(errno);
+    }
+    struct stat status{};
+    if (::fstat(opened, &status) != 0) {
+        static_cast<void>(::close(opened));
+        return ErrorCode::ResourceFailure;
+    }
+
+    size = static_cast<std::size_t>(status.st_size);
+    fd   = opened;
+    return ErrorCode::Success;
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: SharedMemoryControlImpl::UnlinkImpl
+ *********************************************************************************************************************/
+/*!
+ * \brief  Huge-page segments share the /dev/shmem namespace on QNX; \c hugePages does not change the name.
+ */
+auto SharedMemoryControlImpl::UnlinkImpl(const char* name, bool hugePages) noexcept -> ErrorCode
+{
+    static_cast<void>(hugePages);
+    return (::shm_unlink(name) == 0) ? ErrorCode::Success : ToErrorCode(errno);
+}
+
+} // namespace shm
+} // namespace qnx
+} // namespace os
+} // namespace ara
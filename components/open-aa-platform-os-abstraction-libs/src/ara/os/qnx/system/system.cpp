@@ -0,0 +1,216 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project (CXX_STANDARD 17)
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara/os/qnx/system/system.cpp
+ *  \brief      QNX-specific implementation of the ara::os::interface::system::SystemInteraction interface.
+ *
+ *  \details    The topology is read from the system page, which the startup code fills once at boot:
+ *              - SYSPAGE_ENTRY(cpuinfo)[i]      speed and the first instruction / data cache of CPU i
+ *              - SYSPAGE_ENTRY(cacheattr)       cache levels, chained through next, shared entries for shared caches
+ *              and the affinity from the runmask of the calling thread.
+ *
+ *  \note       - All CPUs of the system page are online; QNX has no isolcpus, so the isolated set stays empty (use
+ *                adaptive partitioning or runmasks to reserve CPUs).
+ *              - The system page reports neither packages, clusters nor NUMA nodes. CPUs of the same speed form one
+ *                cluster, which groups the cores of a big.LITTLE SoC; the package and NUMA node are 0.
+ ***********************************************************************************************************************/
+
+#include "ara/os/qnx/system/system.h"
+#include "ara/os/qnx/thread/thread_control.h"  // For ThreadControlImpl::GetCurrentAffinityImpl
+
+#include <sys/syspage.h>    // For _syspage_ptr, SYSPAGE_ENTRY, cpuinfo_entry, cacheattr_entry, CACHE_*
+#include <cstdint>          // For std::uint16_t, std::uint32_t
+
+namespace ara {
+namespace os {
+namespace qnx {
+namespace system {
+
+using ara::os::interface::system::CacheInfo;
+using ara::os::interface::system::CacheType;
+using ara::os::interface::system::CpuInfo;
+using ara::os::interface::system::CpuSet;
+using ara::os::interface::system::CpuTopology;
+using ara::os::interface::system::ErrorCode;
+
+namespace {
+
+/*!
+ * \brief  Reads the cacheattr entry \c index as a cache of \c level into \c cache.
+ */
+auto ReadCacheEntry(std::uint16_t index, std::uint8_t level, CacheInfo& cache) noexcept -> void
+{
+    const struct cacheattr_entry& entry = SYSPAGE_ENTRY(cacheattr)[index];
+    cache = CacheInfo{};
+    cache.level    = level;
+    cache.lineSize = static_cast<std::uint16_t>(entry.line_size);
+    cache.size     = static_cast<std::uint32_t>(entry.line_size) * static_cast<std::uint32_t>(entry.num_lines);
+    if ((entry.flags & CACHE_FLAG_UNIFIED) == CACHE_FLAG_UNIFIED) {
+        cache.type = CacheType::Unified;
+    } else if ((entry.flags & CACHE_FLAG_INSTR) != 0U) {
+        cache.type = CacheType::Instruction;
+    } else {
+        cache.type = CacheType::Data;
+    }
+}
+
+/*!
+ * \brief  Reads the caches of \c cpu: the L1 instruction cache, then the data chain (L1d, L2, ...).
+ *
+ * \param[out] entries  The cacheattr index of each recorded cache, to find the CPUs sharing it.
+ */
+auto ReadCaches(std::size_t cpu, CpuInfo& info, std::uint16_t (&entries)[CpuInfo::kMaxCacheCount]) noexcept -> void
+{
+    const struct cpuinfo_entry& entry = SYSPAGE_ENTRY(cpuinfo)[cpu];
+    if ((entry.ins_cache != CACHE_LIST_END) && (entry.ins_cache != entry.data_cache)) {
+        entries[info.cacheCount] = entry.ins_cache;
+        ReadCacheEntry(entry.ins_cache, 1U, info.caches[info.cacheCount]);
+        ++info.cacheCount;
+    }
+    std::uint8_t level{1U};
+    std::uint16_t index = entry.data_cache;
+    for (; (index != CACHE_LIST_END) && (info.cacheCount < CpuInfo::kMaxCacheCount);
+         index = SYSPAGE_ENTRY(cacheattr)[index].next) {
+        entries[info.cacheCount] = index;
+        ReadCacheEntry(index, level, info.caches[info.cacheCount]);
+        ++info.cacheCount;
+        ++level;
+    }
+}
+
+} // namespace
+
+/**********************************************************************************************************************
+ *  FUNCTION: SystemAccessImpl::GetCpuTopologyImpl
+ *********************************************************************************************************************/
+/*!
+ * \brief  Reads the topology of all CPUs from the system page and the runmask of the calling thread.
+ *
+ * \return An ara::os::interface::system::ErrorCode indicating the result of the operation:
+ *         - Success:         The topology was read.
+ *         - Truncated:       The system has more than CpuSet::kMaxCpus CPUs; the first kMaxCpus are described.
+ *         - RetrievalFailed: The system page reports no CPU.
+ */
+auto SystemAccessImpl::GetCpuTopologyImpl(CpuTopology& topology) noexcept -> ErrorCode
+{
+    topology = CpuTopology{};
+
+    std::size_t const cpuCount = static_cast<std::size_t>(_syspage_ptr->num_cpu);
+    if (cpuCount == 0U) {
+        return ErrorCode::RetrievalFailed;
+    }
+    bool const truncated = (cpuCount > CpuSet::kMaxCpus);
+    topology.cpuCount = truncated ? CpuSet::kMaxCpus : cpuCount;
+
+    /* 1. Placement, frequency and caches per CPU */
+    std::uint16_t entries[CpuSet::kMaxCpus][CpuInfo::kMaxCacheCount]{};
+    std::uint32_t fastest{0U};
+    for (std::size_t cpu = 0U; cpu < topology.cpuCount; ++cpu) {
+        static_cast<void>(topology.online.Add(cpu));
+        CpuInfo& info = topology.cpus[cpu];
+        info.coreId = static_cast<std::uint16_t>(cpu);
+        info.maxFrequencyKhz = static_cast<std::uint32_t>(SYSPAGE_ENTRY(cpuinfo)[cpu].speed) * 1000U;
+        fastest = (info.maxFrequencyKhz > fastest) ? info.maxFrequencyKhz : fastest;
+        ReadCaches(cpu, info, entries[cpu]);
+    }
+
+    /* 2. Cache sharing (same cacheattr entry), clusters (same speed), capacity (relative speed) and line size.
+     *    CPUs within 10 % of the fastest keep kMaxCapacity, as on Linux without cpu_capacity. */
+    for (std::size_t cpu = 0U; cpu < topology.cpuCount; ++cpu) {
+        CpuInfo& info = topology.cpus[cpu];
+        for (std::size_t i = 0U; i < info.cacheCount; ++i) {
+            CacheInfo& cache = info.caches[i];
+            cache.sharedCpuCount = 0U;
+            for (std::size_t other = topology.cpuCount; other > 0U; --other) {
+                for (std::size_t j = 0U; j < topology.cpus[other - 1U].cacheCount; ++j) {
+                    if (entries[other - 1U][j] == entries[cpu][i]) {
+                        cache.firstSharedCpu = static_cast<std::uint16_t>(other - 1U);
+                        ++cache.sharedCpuCount;
+                    }
+                }
+            }
+            if ((cache.type != CacheType::Instruction) && (cache.lineSize > topology.cacheLineSize)) {
+                topology.cacheLineSize = cache.lineSize;
+            }
+        }
+
+        std::size_t cluster{0U};
+        while (topology.cpus[cluster].maxFrequencyKhz != info.maxFrequencyKhz) {
+            ++cluster;
+        }
+        info.clusterId = static_cast<std::uint16_t>(cluster);
+        std::uint64_t const frequency = info.maxFrequencyKhz;
+        if ((fastest != 0U) && ((frequency * 10U) < (static_cast<std::uint64_t>(fastest) * 9U))) {
+            std::uint64_t const capacity = (frequency * CpuInfo::kMaxCapacity) / fastest;
+            info.capacity = static_cast<std::uint16_t>((capacity > 0U) ? capacity : 1U);
+        }
+    }
+
+    /* 3. Runmask of the calling thread */
+    static_cast<void>(ara::os::qnx::thread::ThreadControlImpl::GetCurrentAffinityImpl(topology.allowed));
+
+    return truncated ? ErrorCode::Truncated : ErrorCode::Success;
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: SystemAccessImpl::GetCacheLineSizeImpl
+ *********************************************************************************************************************/
+/*!
+ * \brief  Largest line size of the data chain of CPU 0 in the system page (0 if it lists no cache).
+ */
+auto SystemAccessImpl::GetCacheLineSizeImpl() noexcept -> std::size_t
+{
+    std::size_t lineSize{0U};
+    for (std::uint16_t index = SYSPAGE_ENTRY(cpuinfo)[0].data_cache; index != CACHE_LIST_END;
+         index = SYSPAGE_ENTRY(cacheattr)[index].next) {
+        std::size_t const size = static_cast<std::size_t>(SYSPAGE_ENTRY(cacheattr)[index].line_size);
+        lineSize = (size > lineSize) ? size : lineSize;
+    }
+    return lineSize;
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: SystemInteractionImpl::GetCpuTopology
+ *********************************************************************************************************************/
+/*!
+ * \note   Delegates to the static backend SystemAccessImpl.
+ */
+auto SystemInteractionImpl::GetCpuTopology(CpuTopology& topology) const noexcept -> ErrorCode
+{
+    return SystemAccessImpl::GetCpuTopology(topology);
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: SystemInteractionImpl::GetCacheLineSize
+ *********************************************************************************************************************/
+/*!
+ * \note   Delegates to the static backend SystemAccessImpl.
+ */
+auto SystemInteractionImpl::GetCacheLineSize() const noexcept -> std::size_t
+{
+    return SystemAccessImpl::GetCacheLineSize();
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: CreateSystemInteractionInstance
+ *********************************************************************************************************************/
+/*!
+ * \brief  Factory function to create a QNX-specific SystemInteraction instance.
+ *
+ * \return A std::unique_ptr to an ara::os::interface::system::SystemInteraction object.
+ */
+auto CreateSystemInteractionInstance() -> std::unique_ptr<ara::os::interface::system::SystemInteraction>
+{
+    return std::make_unique<SystemInteractionImpl>();
+}
+
+} // namespace system
+} // namespace qnx
+} // namespace os
+} // namespace ara
@@ -0,0 +1,164 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project (CXX_STANDARD 17)
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara/os/qnx/thread/thread_control.cpp
+ *  \brief      QNX-specific implementation of the ara::os::interface::thread::ThreadControl interface.
+ *
+ *  \details    CPU affinity through runmasks. The _thread_runmask layout (size, runmask, inherit mask) is built in a
+ *              fixed buffer sized for CpuSet::kMaxCpus; setting the inherit mask too keeps threads created by a
+ *              pinned thread on the same CPUs.
+ ***********************************************************************************************************************/
+
+#include "ara/os/qnx/thread/thread_control.h"
+
+#include <sys/neutrino.h>   // For ThreadCtl, _NTO_TCTL_RUNMASK_GET_AND_SET_INHERIT, RMSK_SIZE, RMSK_SET, RMSK_ISSET
+#include <sys/syspage.h>    // For _syspage_ptr
+#include <cerrno>           // For errno, EINVAL, EPERM
+#include <cstring>          // For std::strncpy
+
+namespace ara {
+namespace os {
+namespace qnx {
+namespace thread {
+
+using ara::os::interface::thread::CpuSet;
+using ara::os::interface::thread::ErrorCode;
+
+namespace {
+
+/*!
+ * \brief  Size of a QNX thread name including the terminating null character.
+ */
+constexpr std::size_t kThreadNameSize{_NTO_THREAD_NAME_MAX + 1U};
+
+/*!
+ * \brief  Number of unsigned words of a runmask covering CpuSet::kMaxCpus.
+ */
+constexpr std::size_t kMaskWords{static_cast<std::size_t>(RMSK_SIZE(CpuSet::kMaxCpus))};
+
+/*!
+ * \brief  Buffer in the _thread_runmask layout: size, runmask[size], inherit_mask[size].
+ */
+struct RunmaskBuffer {
+    int      size{0};
+    unsigned runmask[kMaskWords]{};
+    unsigned inheritMask[kMaskWords]{};
+};
+
+/*!
+ * \brief  Number of CPUs covered by both the system and a CpuSet.
+ */
+auto GetCpuLimit() noexcept -> std::size_t
+{
+    std::size_t const cpus = static_cast<std::size_t>(_syspage_ptr->num_cpu);
+    return (cpus < CpuSet::kMaxCpus) ? cpus : CpuSet::kMaxCpus;
+}
+
+} // namespace
+
+/**********************************************************************************************************************
+ *  FUNCTION: ThreadControlImpl::SetAttributeAffinityImpl
+ *********************************************************************************************************************/
+auto ThreadControlImpl::SetAttributeAffinityImpl(pthread_attr_t& attributes, const CpuSet& cpus) noexcept -> ErrorCode
+{
+    static_cast<void>(attributes);
+    static_cast<void>(cpus);
+    return ErrorCode::InvalidArgument;
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: ThreadControlImpl::SetCurrentAffinityImpl
+ *********************************************************************************************************************/
+/*!
+ * \brief  Sets the runmask and the inherit mask of the calling thread to \c cpus.
+ *
+ * \return ErrorCode::Success, InvalidArgument (empty set, or no CPU of the system in it), PermissionDenied or
+ *         SetupFailed.
+ */
+auto ThreadControlImpl::SetCurrentAffinityImpl(const CpuSet& cpus) noexcept -> ErrorCode
+{
+    std::size_t const limit = GetCpuLimit();
+    RunmaskBuffer buffer{};
+    buffer.size = static_cast<int>(RMSK_SIZE(limit));
+
+    bool any{false};
+    for (std::size_t cpu = 0U; cpu < limit; ++cpu) {
+        if (cpus.Contains(cpu)) {
+            RMSK_SET(cpu, buffer.runmask);
+            RMSK_SET(cpu, buffer.inheritMask);
+            any = true;
+        }
+    }
+    if (!any) {
+        return ErrorCode::InvalidArgument;
+    }
+
+    // The kernel reads size, then size words of runmask followed directly by size words of inherit mask
+    if (static_cast<std::size_t>(buffer.size) < kMaskWords) {
+        for (std::size_t word = 0U; word < static_cast<std::size_t>(buffer.size); ++word) {
+            buffer.runmask[static_cast<std::size_t>(buffer.size) + word] = buffer.inheritMask[word];
+        }
+    }
+
+    if (::ThreadCtl(_NTO_TCTL_RUNMASK_GET_AND_SET_INHERIT, &buffer) == -1) {
+        return (errno == EPERM) ? ErrorCode::PermissionDenied : ErrorCode::SetupFailed;
+    }
+    return ErrorCode::Success;
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: ThreadControlImpl::GetCurrentAffinityImpl
+ *********************************************************************************************************************/
+/*!
+ * \brief  Reads the runmask of the calling thread (all-zero masks leave the current masks unchanged).
+ */
+auto ThreadControlImpl::GetCurrentAffinityImpl(CpuSet& cpus) noexcept -> ErrorCode
+{
+    std::size_t const limit = GetCpuLimit();
+    RunmaskBuffer buffer{};
+    buffer.size = static_cast<int>(RMSK_SIZE(limit));
+    if (::ThreadCtl(_NTO_TCTL_RUNMASK_GET_AND_SET_INHERIT, &buffer) == -1) {
+        return ErrorCode::SetupFailed;
+    }
+
+    cpus = CpuSet{};
+    for (std::size_t cpu = 0U; cpu < limit; ++cpu) {
+        if (RMSK_ISSET(cpu, buffer.runmask)) {
+            static_cast<void>(cpus.Add(cpu));
+        }
+    }
+    return ErrorCode::Success;
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: ThreadControlImpl::SetCurrentNameImpl
+ *********************************************************************************************************************/
+auto ThreadControlImpl::SetCurrentNameImpl(const char* name) noexcept -> ErrorCode
+{
+    if (name == nullptr) {
+        return ErrorCode::InvalidArgument;
+    }
+    char truncated[kThreadNameSize]{};
+    std::strncpy(truncated, name, kThreadNameSize - 1U);
+    return (::pthread_setname_np(::pthread_self(), truncated) == 0) ? ErrorCode::Success : ErrorCode::SetupFailed;
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: ThreadControlImpl::GetCpuCountImpl
+ *********************************************************************************************************************/
+auto ThreadControlImpl::GetCpuCountImpl() noexcept -> std::size_t
+{
+    std::size_t const cpus = static_cast<std::size_t>(_syspage_ptr->num_cpu);
+    return (cpus > 0U) ? cpus : 1U;
+}
+
+} // namespace thread
+} // namespace qnx
+} // namespace os
+} // namespace ara
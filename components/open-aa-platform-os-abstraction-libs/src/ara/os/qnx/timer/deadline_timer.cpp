@@ -0,0 +1,210 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project (CXX_STANDARD 17)
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara/os/qnx/timer/deadline_timer.cpp
+ *  \brief      QNX-specific implementation of the ara::os::interface::timer::DeadlineTimer interface.
+ *
+ *  \details    Absolute-deadline sleeping with a CLOCK_MONOTONIC timer that delivers a pulse to a private channel.
+ *              The timer is armed with TIMER_ABSTIME, so the kernel releases the waiting thread at the deadline
+ *              itself rather than after a relative delay measured from the arming call.
+ ***********************************************************************************************************************/
+
+#include "ara/os/qnx/timer/deadline_timer.h"
+
+#include <sys/neutrino.h>   // For ChannelCreate, ConnectAttach, MsgReceivePulse, _NTO_CHF_PRIVATE
+#include <sys/siginfo.h>    // For SIGEV_PULSE_INIT, SIGEV_PULSE_PRIO_INHERIT
+#include <time.h>           // For clock_gettime, timer_create, timer_settime, TIMER_ABSTIME
+#include <cerrno>           // For EINTR
+
+namespace ara {
+namespace os {
+namespace qnx {
+namespace timer {
+
+namespace {
+
+/*!
+ * \brief  Nanoseconds per second.
+ */
+constexpr std::int64_t kNanosecondsPerSecond{1000000000};
+
+/*!
+ * \brief  Pulse code identifying a timer expiry on the private channel.
+ */
+constexpr int kTimerPulseCode{_PULSE_CODE_MINAVAIL};
+
+/*!
+ * \brief  Pulse code identifying an Interrupt() on the private channel.
+ */
+constexpr int kWakePulseCode{_PULSE_CODE_MINAVAIL + 1};
+
+} // namespace
+
+/**********************************************************************************************************************
+ *  FUNCTION: DeadlineTimerImpl::~DeadlineTimerImpl
+ *********************************************************************************************************************/
+/*!
+ * \brief  Releases the timer, connection and channel if still open.
+ */
+DeadlineTimerImpl::~DeadlineTimerImpl() noexcept
+{
+    CloseImpl();
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: DeadlineTimerImpl::NowImpl
+ *********************************************************************************************************************/
+/*!
+ * \brief  Reads CLOCK_MONOTONIC.
+ *
+ * \return The current monotonic time, or 0 if the clock cannot be read.
+ */
+auto DeadlineTimerImpl::NowImpl() noexcept -> ara::os::interface::timer::MonotonicTime
+{
+    timespec now{};
+    if (::clock_gettime(CLOCK_MONOTONIC, &now) != 0) {
+        return ara::os::interface::timer::MonotonicTime{0};
+    }
+    return ara::os::interface::timer::MonotonicTime{
+        (static_cast<std::int64_t>(now.tv_sec) * kNanosecondsPerSecond) + static_cast<std::int64_t>(now.tv_nsec)};
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: DeadlineTimerImpl::OpenImpl
+ *********************************************************************************************************************/
+/*!
+ * \brief  Creates the private channel, the side-channel connection and the pulse timer.
+ *
+ * \return ErrorCode::Success, or ErrorCode::ResourceFailure (all partially created resources are released).
+ */
+auto DeadlineTimerImpl::OpenImpl() noexcept -> ara::os::interface::timer::ErrorCode
+{
+    using ErrorCode = ara::os::interface::timer::ErrorCode;
+
+    if (timerCreated_) {
+        return ErrorCode::Success;
+    }
+
+    /* 1. Private channel: only pulses from our own timer are received on it */
+    channelId_ = ::ChannelCreate(_NTO_CHF_PRIVATE);
+    if (channelId_ == -1) {
+        return ErrorCode::ResourceFailure;
+    }
+
+    /* 2. Side-channel connection the kernel sends the pulse through */
+    connectionId_ = ::ConnectAttach(0, 0, channelId_, _NTO_SIDE_CHANNEL, 0);
+    if (connectionId_ == -1) {
+        CloseImpl();
+        return ErrorCode::ResourceFailure;
+    }
+
+    /* 3. CLOCK_MONOTONIC timer delivering a pulse at the priority of the receiving thread */
+    sigevent event{};
+    SIGEV_PULSE_INIT(&event, connectionId_, SIGEV_PULSE_PRIO_INHERIT, kTimerPulseCode, 0);
+    if (::timer_create(CLOCK_MONOTONIC, &event, &timerId_) == -1) {
+        CloseImpl();
+        return ErrorCode::ResourceFailure;
+    }
+    timerCreated_ = true;
+
+    return ErrorCode::Success;
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: DeadlineTimerImpl::SleepUntilImpl
+ *********************************************************************************************************************/
+/*!
+ * \brief  Arms the timer for \c deadline (TIMER_ABSTIME) and waits for its pulse.
+ *
+ * \param[in] deadline  Absolute monotonic deadline.
+ *
+ * \return ErrorCode::Success, ErrorCode::Interrupted, ErrorCode::ResourceFailure if the timer is not open, or
+ *         ErrorCode::ClockFailure.
+ *
+ * \note   A deadline that has already passed makes the timer fire immediately. On an interruption the timer is
+ *         disarmed, so that no stale expiry pulse is left for the next sleep once the wait returns.
+ */
+auto DeadlineTimerImpl::SleepUntilImpl(ara::os::interface::timer::MonotonicTime deadline) noexcept
+    -> ara::os::interface::timer::ErrorCode
+{
+    using ErrorCode = ara::os::interface::timer::ErrorCode;
+
+    if (!timerCreated_) {
+        return ErrorCode::ResourceFailure;
+    }
+
+    /* 1. Arm one-shot at the absolute deadline (a zero it_value would disarm: clamp to 1 ns) */
+    std::int64_t const ticks = (deadline.count() > 0) ? deadline.count() : 1;
+
+    itimerspec expiry{};
+    expiry.it_value.tv_sec  = static_cast<time_t>(ticks / kNanosecondsPerSecond);
+    expiry.it_value.tv_nsec = static_cast<long>(ticks % kNanosecondsPerSecond);
+    if (::timer_settime(timerId_, TIMER_ABSTIME, &expiry, nullptr) == -1) {
+        return ErrorCode::ClockFailure;
+    }
+
+    /* 2. Wait for the expiry pulse, ignoring unrelated pulses and signal interruptions */
+    for (;;) {
+        _pulse pulse{};
+        if (::MsgReceivePulse(channelId_, &pulse, sizeof(pulse), nullptr) == -1) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return ErrorCode::ClockFailure;
+        }
+        if (pulse.code == kTimerPulseCode) {
+            return ErrorCode::Success;
+        }
+        if (pulse.code == kWakePulseCode) {
+            itimerspec const disarm{};
+            static_cast<void>(::timer_settime(timerId_, 0, &disarm, nullptr));
+            return ErrorCode::Interrupted;
+        }
+    }
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: DeadlineTimerImpl::InterruptImpl
+ *********************************************************************************************************************/
+/*!
+ * \brief  Sends the wake pulse (at the priority of the calling thread). No-op on a closed timer.
+ */
+auto DeadlineTimerImpl::InterruptImpl() noexcept -> void
+{
+    if (connectionId_ != -1) {
+        static_cast<void>(::MsgSendPulse(connectionId_, -1, kWakePulseCode, 0));
+    }
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: DeadlineTimerImpl::CloseImpl
+ *********************************************************************************************************************/
+/*!
+ * \brief  Deletes the timer, detaches the connection and destroys the channel.
+ */
+auto DeadlineTimerImpl::CloseImpl() noexcept -> void
+{
+    if (timerCreated_) {
+        static_cast<void>(::timer_delete(timerId_));
+        timerCreated_ = false;
+    }
+    if (connectionId_ != -1) {
+        static_cast<void>(::ConnectDetach(connectionId_));
+        connectionId_ = -1;
+    }
+    if (channelId_ != -1) {
+        static_cast<void>(::ChannelDestroy(channelId_));
+        channelId_ = -1;
+    }
+}
+
+} // namespace timer
+} // namespace qnx
+} // namespace os
+} // namespace ara
@@ -23,6 +23,13 @@
  *              - [SWS_CORE_00040] (No exceptions used – custom violation handling)
  *              - [SWS_CORE_13017] (Out-of-range message format)
  *              - [SWS_CORE_01290..01295] (comparison operators)
+ *
+ *  \note       This file also defines ara::core::InplaceVector<T, N>, a fixed-capacity vector whose uninitialized
+ *              in-place storage (InplaceVectorStorage) sits beside ArrayStorage.
+ *
+ *  \note       swap(), fill() and the comparison operators dispatch through ara/core/internal/trivial_ops.h, which
+ *              routes trivially copyable element types to memcpy/memset/memcmp at run time and keeps the generic
+ *              element-wise path during constant evaluation.
  *********************************************************************************************************************/
  
 #ifndef OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_CORE_ARRAY_H_
@@ -41,16 +48,21 @@
  * [SWS_CORE_00040]: we do not throw exceptions – we do custom violation handling
  */
 #include <cstddef>       // For std::size_t, std::ptrdiff_t
+#include <cstdint>       // For std::uint8_t (BoundsCheckPolicy)
 #include <iterator>      // For std::reverse_iterator
 #include <algorithm>     // For std::lexicographical_compare, std::swap_ranges, std::fill_n
 #include <type_traits>   // For std::is_nothrow_move_constructible, std::is_nothrow_move_assignable, etc.
 #include <utility>       // For std::declval, std::move, std::forward
 #include <iostream>      // For demonstration logging (std::cerr)
 #include <cstdlib>       // For std::terminate (to handle violations/fatal errors)
-#include <cstring>       // For std::strncpy
+#include <cstring>       // For std::strncpy, std::memcpy
+#include <initializer_list>  // For std::initializer_list (InplaceVector)
+#include <limits>        // For std::numeric_limits
+#include <new>           // For placement new (InplaceVector)
 
 #include "ara/core/internal/location_utils.h" // For capturing file/line details
 #include "ara/core/internal/violation_handler.h" // To Trigger the violation
+#include "ara/core/internal/trivial_ops.h"       // Block-memory fast paths for trivially copyable types
 
 /**********************************************************************************************************************
  *  NAMESPACE: ara::core
@@ -71,6 +83,53 @@ namespace core {
 template <typename T, std::size_t N>
 class Array;
 
+/**********************************************************************************************************************
+ *  SECTION: Bounds-Check Policy
+ *********************************************************************************************************************/
+/*!
+ * \brief  How Array::at() checks its index.
+ *
+ * \details
+ * - kAlways:         Always checked; an out-of-range index triggers the ArrayAccessOutOfRangeViolation
+ *                    ([SWS_CORE_01273], default).
+ * - kDebugOnly:      Checked in debug builds (NDEBUG not defined); unchecked like operator[] otherwise.
+ * - kAssumeInRange:  Checked in debug builds; otherwise the index is assumed to be in range (the compiler may use
+ *                    idx < N as a fact, e.g. to drop loop guards). For verified hot loops only: an out-of-range index
+ *                    is undefined behavior.
+ *
+ * The check itself is a compare and a branch to the cold, out-of-line internal::ReportArrayAccessOutOfRange(), so
+ * kAlways keeps only a few instructions on the access path.
+ */
+enum class BoundsCheckPolicy : std::uint8_t {
+    kAlways = 0,
+    kDebugOnly,
+    kAssumeInRange
+};
+
+/*!
+ * \brief  Target-wide default policy, selected with -DARA_CORE_ARRAY_BOUNDS_CHECK_POLICY=<enumerator>
+ *         (CMake: ARA_CORE_ARRAY_BOUNDS_CHECK = ALWAYS | DEBUG_ONLY | ASSUME_IN_RANGE).
+ */
+#ifndef ARA_CORE_ARRAY_BOUNDS_CHECK_POLICY
+#define ARA_CORE_ARRAY_BOUNDS_CHECK_POLICY kAlways
+#endif
+
+/*!
+ * \brief  Policy of Array<T, N>::at(); specialize it to select a policy for one instantiation:
+ *
+ *              template <>
+ *              struct ara::core::ArrayBoundsCheck<float, 1024U> {
+ *                  static constexpr BoundsCheckPolicy value{BoundsCheckPolicy::kAssumeInRange};
+ *              };
+ *
+ * \note   The specialization must be visible before the first use of Array<T, N>::at(), and the target-wide
+ *         default must be the same in all translation units of a program (one definition rule).
+ */
+template <typename T, std::size_t N>
+struct ArrayBoundsCheck {
+    static constexpr BoundsCheckPolicy value{BoundsCheckPolicy::ARA_CORE_ARRAY_BOUNDS_CHECK_POLICY};
+};
+
 /**********************************************************************************************************************
  *  SECTION: Violation Handling
  *********************************************************************************************************************/
@@ -208,6 +267,85 @@ protected:
     }
 };
 
+/**********************************************************************************************************************
+ *  SECTION: InplaceVector Storage Base Classes
+ *********************************************************************************************************************/
+/*!
+ * \brief  Base class for InplaceVector storage.
+ * \tparam T  The type of elements.
+ * \tparam N  The capacity.
+ * \tparam B  A boolean indicating whether N > 0.
+ * \tparam D  A boolean indicating whether T is trivially destructible.
+ *
+ * \details
+ * - The elements live in an anonymous union, so unused slots are never default-constructed.
+ * - A trivially destructible T keeps the storage (and thus InplaceVector) trivially destructible.
+ */
+template <typename T, std::size_t N, bool B = (N > 0), bool D = std::is_trivially_destructible_v<T>>
+struct InplaceVectorStorage;
+
+/*!
+ * \brief  InplaceVector storage when N > 0 and T is trivially destructible.
+ */
+template <typename T, std::size_t N>
+struct InplaceVectorStorage<T, N, true, true>
+{
+protected:
+    /*! \brief Constructs empty storage; no element is constructed. */
+    constexpr InplaceVectorStorage() noexcept : unused_{}, size_{0U} {}
+
+    union {
+        char unused_;   /*!< Active member until the first element is constructed. */
+        T    data_[N];  /*!< Uninitialized room for N elements of type T.          */
+    };
+
+    /*! \brief Number of constructed elements. */
+    std::size_t size_;
+};
+
+/*!
+ * \brief  InplaceVector storage when N > 0 and T is not trivially destructible.
+ */
+template <typename T, std::size_t N>
+struct InplaceVectorStorage<T, N, true, false>
+{
+protected:
+    /*! \brief Constructs empty storage; no element is constructed. */
+    constexpr InplaceVectorStorage() noexcept : unused_{}, size_{0U} {}
+
+    /*! \brief Destroys the constructed elements. */
+    ~InplaceVectorStorage()
+    {
+        for (std::size_t i = 0U; i < size_; ++i) {
+            data_[i].~T();
+        }
+    }
+
+    union {
+        char unused_;   /*!< Active member until the first element is constructed. */
+        T    data_[N];  /*!< Uninitialized room for N elements of type T.          */
+    };
+
+    /*! \brief Number of constructed elements. */
+    std::size_t size_;
+};
+
+/*!
+ * \brief  Partial specialization for InplaceVector storage when N = 0 => no element storage at all.
+ */
+template <typename T, std::size_t N, bool D>
+struct InplaceVectorStorage<T, N, false, D>
+{
+protected:
+    constexpr InplaceVectorStorage() noexcept = default;
+
+    /*! \brief There is no storage; data() returns nullptr. */
+    static constexpr T* data_ = nullptr;
+
+    /*! \brief Always 0. */
+    std::size_t size_{0U};
+};
+
 /**********************************************************************************************************************
  *  CLASS: ara::core::Array
  *********************************************************************************************************************/
@@ -390,17 +528,11 @@ public:
      * \return     Reference to the element at index \c idx.
      *
      * \note   [SWS_CORE_01273], [SWS_CORE_01274]
-     * \note   If idx >= N => logs & terminates. No exceptions.
+     * \note   If idx >= N => logs & terminates. No exceptions. The check follows ArrayBoundsCheck<T, N>.
      */
     constexpr auto at(size_type idx) noexcept -> T&
     {
-        if (idx >= N) {
-            TriggerOutOfRangeViolation(
-                ARA_CORE_INTERNAL_FILELINE,
-                idx,
-                N
-            );
-        }
+        CheckIndex(idx);
         return this->data_[idx];
     }
 
@@ -411,18 +543,11 @@ public:
      * \return     Const reference to the element at index \c idx.
      *
      * \note   [SWS_CORE_01273], [SWS_CORE_01274]
-     * \note   If idx >= N => logs & terminates. No exceptions.
+     * \note   If idx >= N => logs & terminates. No exceptions. The check follows ArrayBoundsCheck<T, N>.
      */
     constexpr auto at(size_type idx) const noexcept -> const T&
     {
-        if (idx >= N) {
-            TriggerOutOfRangeViolation(
-                ARA_CORE_INTERNAL_FILELINE,
-                idx,
-                N
-            );
-        }
-
+        CheckIndex(idx);
         return this->data_[idx];
     }
 
@@ -744,7 +869,7 @@ public:
 #endif
 
         if constexpr (N > 0) {
-            std::fill_n(this->data_, N, val);
+            ara::core::internal::FillRange(this->data_, N, val);
         }
     }
 
@@ -773,8 +898,9 @@ public:
             "\n[ERROR] ara::core::Array: The type T's swap operation must be noexcept when exceptions are disabled.\n");
 #endif
 
-        for (std::size_t i = 0; i < N; ++i) {
-            std::swap(this->data_[i], other.data_[i]);
+        if constexpr (N > 0) {
+            // Trivially copyable T => chunked block swap; otherwise element-wise std::swap
+            ara::core::internal::SwapRanges(this->data_, other.data_, N);
         }
         // No operation needed if N == 0
     }
@@ -782,23 +908,35 @@ public:
 private:
 
     /*!
-     * \brief Logs + terminates upon array-access-out-of-range for ara::core::Array.
-     * \param location     The stripped file/line location (e.g., "file.cpp:123").
-     * \param invalidIndex The invalid index that was requested.
-     * \param arraySize    The total number of elements in the array.
+     * \brief Applies the bounds-check policy of this instantiation to \c idx (see BoundsCheckPolicy).
      *
      * \details
-     * - Logs the violation and terminates the process.
-     * - [[noreturn]] ensures that the compiler knows this function will not return.
+     * - Out-of-range index under a checking policy => logs & terminates through the cold trampoline
+     *   internal::ReportArrayAccessOutOfRange(); the location is a string literal passed as constant operands.
+     * - During constant evaluation an out-of-range index is a compile-time error in every policy.
      *
      * \note  [SWS_CORE_13017], [SWS_CORE_00090], [SWS_CORE_00091]
      */
-    [[noreturn]] inline auto TriggerOutOfRangeViolation(std::string_view location,
-                                                        std::size_t invalidIndex,
-                                                        std::size_t arraySize) const noexcept -> void
-    {   
-        auto& violation_trigger = ara::core::internal::ViolationHandler::Instance();
-        violation_trigger.TriggerArrayAccessOutOfRangeViolation(location, invalidIndex, arraySize);
+    static constexpr auto CheckIndex(size_type idx) noexcept -> void
+    {
+#if defined(NDEBUG)
+        constexpr bool kDebugBuild{false};
+#else
+        constexpr bool kDebugBuild{true};
+#endif
+        constexpr BoundsCheckPolicy kPolicy{ArrayBoundsCheck<T, N>::value};
+
+        if constexpr ((kPolicy == BoundsCheckPolicy::kAlways) || kDebugBuild) {
+            if (__builtin_expect(idx >= N, 0)) {
+                ara::core::internal::ReportArrayAccessOutOfRange(ARA_CORE_INTERNAL_FILELINE, idx, N);
+            }
+        } else if constexpr (kPolicy == BoundsCheckPolicy::kAssumeInRange) {
+            if (idx >= N) {
+                __builtin_unreachable();
+            }
+        } else {
+            static_cast<void>(idx);
+        }
     }
 
 };
@@ -904,12 +1042,8 @@ constexpr auto operator==(const Array<T, N>& lhs, const Array<T, N>& rhs)
         "\n[ERROR] in ara::core::Array: The type T's operator== must be marked 'noexcept' when exceptions are disabled.\n");
 #endif
 
-    for (std::size_t i = 0; i < N; ++i) {
-        if (!(lhs[i] == rhs[i])) {
-            return false;
-        }
-    }
-    return true;
+    // Bitwise-comparable T => single memcmp; otherwise element-wise operator==
+    return ara::core::internal::EqualRanges(lhs.data(), rhs.data(), N);
 }
 
 /*!
@@ -965,8 +1099,8 @@ constexpr auto operator<(const Array<T, N>& lhs, const Array<T, N>& rhs)
         "\n[ERROR] in ara::core::Array: The type T's operator< must be marked 'noexcept' when exceptions are disabled.\n");
 #endif
 
-    return std::lexicographical_compare(lhs.begin(), lhs.end(),
-                                        rhs.begin(), rhs.end());
+    // Unsigned byte-like T => single memcmp; otherwise first mismatch decides via operator<
+    return ara::core::internal::LessRanges(lhs.data(), rhs.data(), N);
 }
 
 /*!
@@ -1115,6 +1249,666 @@ constexpr auto swap(Array<T, N>& /*lhs*/, Array<U, M>& /*rhs*/) noexcept
         "        (swap(Array<T,N>&, Array<U,M>&)) in ara::core::Array.\n");
 }
 
+/**********************************************************************************************************************
+ *  CLASS: ara::core::InplaceVector
+ *********************************************************************************************************************/
+/*!
+ * \brief  A variable-size container with a fixed capacity N and in-place (non-heap) storage.
+ *
+ * \tparam T  Type of elements stored in the vector.
+ * \tparam N  Maximum number of elements (the capacity).
+ *
+ * \details
+ * - static_vector semantics: the interface of std::vector, contiguous storage inside the object, no allocator.
+ * - Unused slots are never constructed; the object costs sizeof(T) * N plus one size counter.
+ * - Exceeding the capacity triggers a CapacityExceededViolation; at() with index >= size() triggers a
+ *   VectorAccessOutOfRangeViolation. try_push_back()/try_emplace_back() report a full vector by returning nullptr.
+ * - Trivially copyable T: copy, move and assignment copy only the size() used elements with memcpy; clear() and
+ *   destruction are O(1); the whole InplaceVector stays trivially destructible.
+ * - Observers and element access are constexpr. Modifiers construct elements in place, which C++17 does not allow
+ *   during constant evaluation.
+ *
+ * \note Unless ARA_CORE_ARRAY_ENABLE_CONDITIONAL_EXCEPTIONS is defined, T must be no-throw move/copy constructible
+ *       and assignable, aligning with [SWS_CORE_00040].
+ *
+ * \note  [SWS_CORE_00040], [SWS_CORE_00090]
+ */
+template <typename T, std::size_t N>
+class InplaceVector final : private InplaceVectorStorage<T, N>
+{
+public:
+#ifdef ARA_CORE_ARRAY_ENABLE_CONDITIONAL_EXCEPTIONS
+    // In Conditional Safe Mode, allow potentially-throwing types
+#else
+    /*!
+     * \brief Enforce that T cannot throw exceptions during move or copy operations.
+     *
+     * \note  [SWS_CORE_00040]
+     */
+    static_assert(std::is_nothrow_move_constructible_v<T> &&
+                  std::is_nothrow_move_assignable_v<T> &&
+                  std::is_nothrow_copy_constructible_v<T> &&
+                  std::is_nothrow_copy_assignable_v<T>,
+                "\n[ERROR] in ara::core::InplaceVector: The type T must be move and copy constructible\n"
+                "        and assignable without throwing exceptions. Please ensure that T's constructors and\n"
+                "        assignment operators are marked 'noexcept'.\n");
+#endif
+
+    // -----------------------------------------------------------------------------------
+    // TYPE ALIASES (public)
+    // -----------------------------------------------------------------------------------
+    using value_type             = T;
+    using size_type              = std::size_t;
+    using difference_type        = std::ptrdiff_t;
+    using reference              = T&;
+    using const_reference        = const T&;
+    using pointer                = T*;
+    using const_pointer          = const T*;
+    using iterator               = T*;
+    using const_iterator         = const T*;
+    using reverse_iterator       = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+private:
+    /*! \brief Copy operations are no-throw (always true in Safe Mode). */
+    static constexpr bool kNothrowCopy = std::is_nothrow_copy_constructible_v<T> &&
+                                         std::is_nothrow_copy_assignable_v<T>;
+
+    /*! \brief Move operations are no-throw (always true in Safe Mode). */
+    static constexpr bool kNothrowMove = std::is_nothrow_move_constructible_v<T> &&
+                                         std::is_nothrow_move_assignable_v<T>;
+
+    /*! \brief Trait: It is at least a forward iterator (the range size can be computed up front). */
+    template <typename It>
+    using EnableIfForwardIterator = std::enable_if_t<
+        std::is_base_of_v<std::forward_iterator_tag, typename std::iterator_traits<It>::iterator_category>>;
+
+public:
+    // -----------------------------------------------------------------------------------
+    // 1) CONSTRUCTORS
+    // -----------------------------------------------------------------------------------
+    /*! \brief Constructs an empty vector; no element is constructed. */
+    constexpr InplaceVector() noexcept = default;
+
+    /*! \brief Constructs \c count value-initialized elements. \c count > N => Violation. */
+    explicit InplaceVector(size_type count) noexcept(std::is_nothrow_default_constructible_v<T>)
+    {
+        resize(count);
+    }
+
+    /*! \brief Constructs \c count copies of \c value. \c count > N => Violation. */
+    InplaceVector(size_type count, const T& value) noexcept(kNothrowCopy)
+    {
+        EnsureRoom(count);
+        AppendFill(count, value);
+    }
+
+    /*! \brief Constructs from the forward range [first, last). */
+    template <typename ForwardIt, typename = EnableIfForwardIterator<ForwardIt>>
+    InplaceVector(ForwardIt first, ForwardIt last) noexcept(kNothrowCopy)
+    {
+        AssignFrom(first, static_cast<size_type>(std::distance(first, last)));
+    }
+
+    /*! \brief Constructs from an initializer list. */
+    InplaceVector(std::initializer_list<T> init) noexcept(kNothrowCopy)
+    {
+        AssignFrom(init.begin(), init.size());
+    }
+
+    /*! \brief Copy constructor; copies only the used elements (memcpy for trivially copyable T). */
+    InplaceVector(const InplaceVector& other) noexcept(kNothrowCopy)
+        : InplaceVectorStorage<T, N>()
+    {
+        AssignFrom(other.data(), other.size());
+    }
+
+    /*! \brief Move constructor; moves the used elements (\c other keeps its moved-from elements). */
+    InplaceVector(InplaceVector&& other) noexcept(kNothrowMove)
+        : InplaceVectorStorage<T, N>()
+    {
+        MoveAssignFrom(other);
+    }
+
+    /*! \brief Destroys the elements (trivial for trivially destructible T). */
+    ~InplaceVector() = default;
+
+    // -----------------------------------------------------------------------------------
+    // 2) ASSIGNMENT
+    // -----------------------------------------------------------------------------------
+    /*! \brief Copy assignment; copies only the used elements (memcpy for trivially copyable T). */
+    auto operator=(const InplaceVector& other) noexcept(kNothrowCopy) -> InplaceVector&
+    {
+        if (this != &other) {
+            AssignFrom(other.data(), other.size());
+        }
+        return *this;
+    }
+
+    /*! \brief Move assignment. */
+    auto operator=(InplaceVector&& other) noexcept(kNothrowMove) -> InplaceVector&
+    {
+        if (this != &other) {
+            MoveAssignFrom(other);
+        }
+        return *this;
+    }
+
+    /*! \brief Replaces the contents with the initializer list. */
+    auto operator=(std::initializer_list<T> init) noexcept(kNothrowCopy) -> InplaceVector&
+    {
+        AssignFrom(init.begin(), init.size());
+        return *this;
+    }
+
+    /*! \brief Replaces the contents with \c count copies of \c value. */
+    auto assign(size_type count, const T& value) noexcept(kNothrowCopy) -> void
+    {
+        if (count > N) {
+            TriggerCapacityViolation(ARA_CORE_INTERNAL_FILELINE, 0U, count);
+        }
+        size_type const common = (count < this->size_) ? count : this->size_;
+        ara::core::internal::FillRange(data(), common, value);
+        if (count > this->size_) {
+            AppendFill(count - this->size_, value);
+        } else {
+            DestroyTail(count);
+        }
+    }
+
+    /*! \brief Replaces the contents with the forward range [first, last). */
+    template <typename ForwardIt, typename = EnableIfForwardIterator<ForwardIt>>
+    auto assign(ForwardIt first, ForwardIt last) noexcept(kNothrowCopy) -> void
+    {
+        AssignFrom(first, static_cast<size_type>(std::distance(first, last)));
+    }
+
+    /*! \brief Replaces the contents with the initializer list. */
+    auto assign(std::initializer_list<T> init) noexcept(kNothrowCopy) -> void
+    {
+        AssignFrom(init.begin(), init.size());
+    }
+
+    // -----------------------------------------------------------------------------------
+    // 3) ELEMENT ACCESS
+    // -----------------------------------------------------------------------------------
+    /*!
+     * \brief  Checked element access => triggers Violation if out-of-range.
+     *
+     * \note   If idx >= size() => logs & terminates. No exceptions.
+     */
+    constexpr auto at(size_type idx) noexcept -> T&
+    {
+        if (idx >= this->size_) {
+            TriggerOutOfRangeViolation(ARA_CORE_INTERNAL_FILELINE, idx, this->size_);
+        }
+        return data()[idx];
+    }
+
+    /*!
+     * \brief  Checked element access (const) => triggers Violation if out-of-range.
+     *
+     * \note   If idx >= size() => logs & terminates. No exceptions.
+     */
+    constexpr auto at(size_type idx) const noexcept -> const T&
+    {
+        if (idx >= this->size_) {
+            TriggerOutOfRangeViolation(ARA_CORE_INTERNAL_FILELINE, idx, this->size_);
+        }
+        return data()[idx];
+    }
+
+    /*! \brief Unchecked element access. \pre idx < size(). */
+    constexpr auto operator[](size_type idx) noexcept -> T& { return data()[idx]; }
+
+    /*! \brief Unchecked element access (const). \pre idx < size(). */
+    constexpr auto operator[](size_type idx) const noexcept -> const T& { return data()[idx]; }
+
+    /*! \brief First element. \pre !empty(). */
+    constexpr auto front() noexcept -> T& { return data()[0]; }
+
+    /*! \brief First element (const). \pre !empty(). */
+    constexpr auto front() const noexcept -> const T& { return data()[0]; }
+
+    /*! \brief Last element. \pre !empty(). */
+    constexpr auto back() noexcept -> T& { return data()[this->size_ - 1U]; }
+
+    /*! \brief Last element (const). \pre !empty(). */
+    constexpr auto back() const noexcept -> const T& { return data()[this->size_ - 1U]; }
+
+    /*! \brief Pointer to the in-place storage (nullptr if N == 0). */
+    constexpr auto data() noexcept -> T* { return this->data_; }
+
+    /*! \brief Pointer to the in-place storage (const). */
+    constexpr auto data() const noexcept -> const T* { return this->data_; }
+
+    // -----------------------------------------------------------------------------------
+    // 4) ITERATORS
+    // -----------------------------------------------------------------------------------
+    constexpr auto begin() noexcept -> iterator { return data(); }
+    constexpr auto begin() const noexcept -> const_iterator { return data(); }
+    constexpr auto cbegin() const noexcept -> const_iterator { return data(); }
+    constexpr auto end() noexcept -> iterator { return data() + this->size_; }
+    constexpr auto end() const noexcept -> const_iterator { return data() + this->size_; }
+    constexpr auto cend() const noexcept -> const_iterator { return data() + this->size_; }
+    constexpr auto rbegin() noexcept -> reverse_iterator { return reverse_iterator(end()); }
+    constexpr auto rbegin() const noexcept -> const_reverse_iterator { return const_reverse_iterator(end()); }
+    constexpr auto crbegin() const noexcept -> const_reverse_iterator { return const_reverse_iterator(end()); }
+    constexpr auto rend() noexcept -> reverse_iterator { return reverse_iterator(begin()); }
+    constexpr auto rend() const noexcept -> const_reverse_iterator { return const_reverse_iterator(begin()); }
+    constexpr auto crend() const noexcept -> const_reverse_iterator { return const_reverse_iterator(begin()); }
+
+    // -----------------------------------------------------------------------------------
+    // 5) CAPACITY
+    // -----------------------------------------------------------------------------------
+    /*! \brief Returns whether the vector holds no element. */
+    [[nodiscard]] constexpr auto empty() const noexcept -> bool { return this->size_ == 0U; }
+
+    /*! \brief Returns whether the vector holds N elements. */
+    constexpr auto full() const noexcept -> bool { return this->size_ == N; }
+
+    /*! \brief Returns the number of elements. */
+    constexpr auto size() const noexcept -> size_type { return this->size_; }
+
+    /*! \brief Returns the capacity N. */
+    static constexpr auto capacity() noexcept -> size_type { return N; }
+
+    /*! \brief Returns the capacity N. */
+    static constexpr auto max_size() noexcept -> size_type { return N; }
+
+    /*! \brief No-op if \c newCapacity <= N; otherwise CapacityExceededViolation. */
+    static auto reserve(size_type newCapacity) noexcept -> void
+    {
+        if (newCapacity > N) {
+            TriggerCapacityViolation(ARA_CORE_INTERNAL_FILELINE, 0U, newCapacity);
+        }
+    }
+
+    /*! \brief No-op: the storage is in place. */
+    static constexpr auto shrink_to_fit() noexcept -> void {}
+
+    // -----------------------------------------------------------------------------------
+    // 6) MODIFIERS
+    // -----------------------------------------------------------------------------------
+    /*! \brief Destroys all elements (O(1) for trivially destructible T). */
+    auto clear() noexcept -> void
+    {
+        DestroyTail(0U);
+    }
+
+    /*! \brief Appends a copy of \c value; full => Violation. */
+    auto push_back(const T& value) noexcept(kNothrowCopy) -> void
+    {
+        emplace_back(value);
+    }
+
+    /*! \brief Appends \c value (moved); full => Violation. */
+    auto push_back(T&& value) noexcept(kNothrowMove) -> void
+    {
+        emplace_back(std::move(value));
+    }
+
+    /*!
+     * \brief  Constructs an element in place at the end; full => Violation.
+     *
+     * \return Reference to the new element.
+     */
+    template <typename... Args>
+    auto emplace_back(Args&&... args) noexcept(std::is_nothrow_constructible_v<T, Args&&...>) -> T&
+    {
+        EnsureRoom(1U);
+        ConstructAt(this->size_, std::forward<Args>(args)...);
+        ++this->size_;
+        return back();
+    }
+
+    /*!
+     * \brief  Constructs an element in place at the end if there is room.
+     *
+     * \return Pointer to the new element, or nullptr if the vector is full (no Violation; counted as a near miss).
+     */
+    template <typename... Args>
+    auto try_emplace_back(Args&&... args) noexcept(std::is_nothrow_constructible_v<T, Args&&...>) -> T*
+    {
+        if (this->size_ == N) {
+            ara::core::internal::RecordNearMiss(ara::core::internal::ViolationKind::CapacityExceeded);
+            return nullptr;
+        }
+        ConstructAt(this->size_, std::forward<Args>(args)...);
+        ++this->size_;
+        return &back();
+    }
+
+    /*! \brief Appends a copy of \c value if there is room; returns nullptr if full. */
+    auto try_push_back(const T& value) noexcept(kNothrowCopy) -> T*
+    {
+        return try_emplace_back(value);
+    }
+
+    /*! \brief Appends \c value (moved) if there is room; returns nullptr if full. */
+    auto try_push_back(T&& value) noexcept(kNothrowMove) -> T*
+    {
+        return try_emplace_back(std::move(value));
+    }
+
+    /*! \brief Removes the last element. \pre !empty(). */
+    auto pop_back() noexcept -> void
+    {
+        DestroyTail(this->size_ - 1U);
+    }
+
+    /*! \brief Inserts a copy of \c value before \c pos; full => Violation. */
+    auto insert(const_iterator pos, const T& value) noexcept(kNothrowCopy && kNothrowMove) -> iterator
+    {
+        return emplace(pos, value);
+    }
+
+    /*! \brief Inserts \c value (moved) before \c pos; full => Violation. */
+    auto insert(const_iterator pos, T&& value) noexcept(kNothrowMove) -> iterator
+    {
+        return emplace(pos, std::move(value));
+    }
+
+    /*! \brief Inserts \c count copies of \c value before \c pos; overflow => Violation. */
+    auto insert(const_iterator pos, size_type count, const T& value) noexcept(kNothrowCopy && kNothrowMove) -> iterator
+    {
+        size_type const index   = static_cast<size_type>(pos - data());
+        size_type const oldSize = this->size_;
+        EnsureRoom(count);
+        AppendFill(count, value);
+        ara::core::internal::RotateRange(data(), index, oldSize, this->size_);
+        return data() + index;
+    }
+
+    /*!
+     * \brief  Inserts the forward range [first, last) before \c pos; overflow => Violation.
+     *
+     * \pre    [first, last) does not refer to elements of \c *this.
+     */
+    template <typename ForwardIt, typename = EnableIfForwardIterator<ForwardIt>>
+    auto insert(const_iterator pos, ForwardIt first, ForwardIt last) noexcept(kNothrowCopy && kNothrowMove) -> iterator
+    {
+        size_type const index   = static_cast<size_type>(pos - data());
+        size_type const oldSize = this->size_;
+        EnsureRoom(static_cast<size_type>(std::distance(first, last)));
+        for (; first != last; ++first) {
+            ConstructAt(this->size_, *first);
+            ++this->size_;
+        }
+        ara::core::internal::RotateRange(data(), index, oldSize, this->size_);
+        return data() + index;
+    }
+
+    /*! \brief Inserts the initializer list before \c pos; overflow => Violation. */
+    auto insert(const_iterator pos, std::initializer_list<T> init) noexcept(kNothrowCopy && kNothrowMove) -> iterator
+    {
+        return insert(pos, init.begin(), init.end());
+    }
+
+    /*!
+     * \brief  Constructs an element in place before \c pos; full => Violation.
+     *
+     * \details
+     * - Appends the new element, then rotates it into position. \c args may refer to elements of \c *this.
+     */
+    template <typename... Args>
+    auto emplace(const_iterator pos, Args&&... args)
+        noexcept(std::is_nothrow_constructible_v<T, Args&&...> && kNothrowMove) -> iterator
+    {
+        size_type const index = static_cast<size_type>(pos - data());
+        emplace_back(std::forward<Args>(args)...);
+        ara::core::internal::RotateRange(data(), index, this->size_ - 1U, this->size_);
+        return data() + index;
+    }
+
+    /*! \brief Erases the element at \c pos. */
+    auto erase(const_iterator pos) noexcept(kNothrowMove) -> iterator
+    {
+        return erase(pos, pos + 1);
+    }
+
+    /*! \brief Erases the elements in [first, last). */
+    auto erase(const_iterator first, const_iterator last) noexcept(kNothrowMove) -> iterator
+    {
+        size_type const index   = static_cast<size_type>(first - data());
+        size_type const removed = static_cast<size_type>(last - first);
+        if (removed > 0U) {
+            T* const elements = data();
+            for (size_type i = index + removed; i < this->size_; ++i) {
+                elements[i - removed] = std::move(elements[i]);
+            }
+            DestroyTail(this->size_ - removed);
+        }
+        return data() + index;
+    }
+
+    /*! \brief Resizes to \c count elements; new elements are value-initialized. \c count > N => Violation. */
+    auto resize(size_type count) noexcept(std::is_nothrow_default_constructible_v<T>) -> void
+    {
+        if (count > N) {
+            TriggerCapacityViolation(ARA_CORE_INTERNAL_FILELINE, 0U, count);
+        }
+        if (count < this->size_) {
+            DestroyTail(count);
+            return;
+        }
+        for (; this->size_ < count; ++this->size_) {
+            ConstructAt(this->size_);
+        }
+    }
+
+    /*! \brief Resizes to \c count elements; new elements are copies of \c value. \c count > N => Violation. */
+    auto resize(size_type count, const T& value) noexcept(kNothrowCopy) -> void
+    {
+        if (count > N) {
+            TriggerCapacityViolation(ARA_CORE_INTERNAL_FILELINE, 0U, count);
+        }
+        if (count < this->size_) {
+            DestroyTail(count);
+            return;
+        }
+        AppendFill(count - this->size_, value);
+    }
+
+    /*!
+     * \brief  Exchanges the contents with \c other.
+     *
+     * \details
+     * - The common prefix is swapped (SwapRanges fast path), the excess elements are moved across.
+     */
+    auto swap(InplaceVector& other) noexcept(std::is_nothrow_swappable_v<T> && kNothrowMove) -> void
+    {
+        InplaceVector& shorter = (this->size_ <= other.size_) ? *this : other;
+        InplaceVector& longer  = (this->size_ <= other.size_) ? other : *this;
+        size_type const common = shorter.size_;
+
+        if constexpr (N > 0) {
+            ara::core::internal::SwapRanges(shorter.data(), longer.data(), common);
+        }
+        for (size_type i = common; i < longer.size_; ++i) {
+            shorter.ConstructAt(i, std::move(longer.data()[i]));
+        }
+        shorter.size_ = longer.size_;
+        longer.DestroyTail(common);
+    }
+
+private:
+    // -----------------------------------------------------------------------------------
+    // ELEMENT MANAGEMENT (private)
+    // -----------------------------------------------------------------------------------
+    /*! \brief Constructs an element at slot \c index from \c args. */
+    template <typename... Args>
+    auto ConstructAt(size_type index, Args&&... args) noexcept(std::is_nothrow_constructible_v<T, Args&&...>) -> void
+    {
+        ::new (static_cast<void*>(data() + index)) T(std::forward<Args>(args)...);
+    }
+
+    /*! \brief Destroys the elements with indices [newSize, size()) and shrinks to \c newSize. */
+    auto DestroyTail(size_type newSize) noexcept -> void
+    {
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            T* const elements = data();
+            for (size_type i = newSize; i < this->size_; ++i) {
+                elements[i].~T();
+            }
+        }
+        this->size_ = newSize;
+    }
+
+    /*! \brief \c additional more elements must fit; otherwise CapacityExceededViolation. */
+    auto EnsureRoom(size_type additional) const noexcept -> void
+    {
+        if (additional > (N - this->size_)) {
+            TriggerCapacityViolation(ARA_CORE_INTERNAL_FILELINE, this->size_, additional);
+        }
+    }
+
+    /*! \brief Appends \c count copies of \c value. \pre They fit. */
+    auto AppendFill(size_type count, const T& value) noexcept(kNothrowCopy) -> void
+    {
+        for (size_type const newSize = this->size_ + count; this->size_ < newSize; ++this->size_) {
+            ConstructAt(this->size_, value);
+        }
+    }
+
+    /*!
+     * \brief  Replaces the contents with \c count elements read from \c first; \c count > N => Violation.
+     *
+     * \details
+     * - Trivially copyable T read through a T pointer => one memcpy of the used elements.
+     * - Otherwise existing elements are assigned, the rest constructed or destroyed.
+     */
+    template <typename InputIt>
+    auto AssignFrom(InputIt first, size_type count) noexcept(kNothrowCopy && kNothrowMove) -> void
+    {
+        if (count > N) {
+            TriggerCapacityViolation(ARA_CORE_INTERNAL_FILELINE, 0U, count);
+        }
+
+        if constexpr (ara::core::internal::is_block_copyable_v<T> &&
+                      (std::is_same_v<InputIt, const T*> || std::is_same_v<InputIt, T*>)) {
+            if (count > 0U) {
+                std::memcpy(static_cast<void*>(data()), static_cast<const void*>(first), count * sizeof(T));
+            }
+            this->size_ = count;
+        } else {
+            size_type const common = (count < this->size_) ? count : this->size_;
+            T* const elements = data();
+            for (size_type i = 0U; i < common; ++i, ++first) {
+                elements[i] = *first;
+            }
+            if (count > this->size_) {
+                for (; this->size_ < count; ++this->size_, ++first) {
+                    ConstructAt(this->size_, *first);
+                }
+            } else {
+                DestroyTail(count);
+            }
+        }
+    }
+
+    /*! \brief Replaces the contents by moving the elements of \c other. */
+    auto MoveAssignFrom(InplaceVector& other) noexcept(kNothrowMove) -> void
+    {
+        if constexpr (ara::core::internal::is_block_copyable_v<T>) {
+            AssignFrom(other.data(), other.size_);
+        } else {
+            AssignFrom(std::make_move_iterator(other.begin()), other.size_);
+        }
+    }
+
+    // -----------------------------------------------------------------------------------
+    // VIOLATIONS (private)
+    // -----------------------------------------------------------------------------------
+    /*!
+     * \brief Logs + terminates upon access-out-of-range.
+     *
+     * \note  [SWS_CORE_00090]
+     */
+    [[noreturn]] static auto TriggerOutOfRangeViolation(std::string_view location,
+                                                        size_type invalidIndex,
+                                                        size_type currentSize) noexcept -> void
+    {
+        auto& violation_trigger = ara::core::internal::ViolationHandler::Instance();
+        violation_trigger.TriggerVectorAccessOutOfRangeViolation(location, invalidIndex, currentSize);
+    }
+
+    /*!
+     * \brief Logs + terminates when \c currentSize + \c additional elements exceed the capacity N.
+     *
+     * \note  [SWS_CORE_00090]
+     */
+    [[noreturn]] static auto TriggerCapacityViolation(std::string_view location,
+                                                      size_type currentSize,
+                                                      size_type additional) noexcept -> void
+    {
+        constexpr size_type kMaximum = std::numeric_limits<size_type>::max();
+        size_type const requested = (additional > (kMaximum - currentSize)) ? kMaximum : (currentSize + additional);
+        auto& violation_trigger = ara::core::internal::ViolationHandler::Instance();
+        violation_trigger.TriggerCapacityExceededViolation(location, requested, N);
+    }
+};
+
+/**********************************************************************************************************************
+ *  NON-MEMBER FUNCTIONS (InplaceVector)
+ *********************************************************************************************************************/
+/*!
+ * \brief  Equality: same size and element-wise equal (memcmp for bitwise-comparable T).
+ */
+template <typename T, std::size_t N>
+inline auto operator==(const InplaceVector<T, N>& lhs, const InplaceVector<T, N>& rhs)
+    noexcept(noexcept(std::declval<const T&>() == std::declval<const T&>())) -> bool
+{
+    return (lhs.size() == rhs.size()) && ara::core::internal::EqualRanges(lhs.data(), rhs.data(), lhs.size());
+}
+
+template <typename T, std::size_t N>
+inline auto operator!=(const InplaceVector<T, N>& lhs, const InplaceVector<T, N>& rhs)
+    noexcept(noexcept(lhs == rhs)) -> bool
+{
+    return !(lhs == rhs);
+}
+
+/*!
+ * \brief  Lexicographical ordering using only T's operator<.
+ */
+template <typename T, std::size_t N>
+inline auto operator<(const InplaceVector<T, N>& lhs, const InplaceVector<T, N>& rhs)
+    noexcept(noexcept(std::declval<const T&>() < std::declval<const T&>())) -> bool
+{
+    return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template <typename T, std::size_t N>
+inline auto operator>(const InplaceVector<T, N>& lhs, const InplaceVector<T, N>& rhs)
+    noexcept(noexcept(rhs < lhs)) -> bool
+{
+    return rhs < lhs;
+}
+
+template <typename T, std::size_t N>
+inline auto operator<=(const InplaceVector<T, N>& lhs, const InplaceVector<T, N>& rhs)
+    noexcept(noexcept(rhs < lhs)) -> bool
+{
+    return !(rhs < lhs);
+}
+
+template <typename T, std::size_t N>
+inline auto operator>=(const InplaceVector<T, N>& lhs, const InplaceVector<T, N>& rhs)
+    noexcept(noexcept(lhs < rhs)) -> bool
+{
+    return !(lhs < rhs);
+}
+
+/*!
+ * \brief  Exchanges the contents of two InplaceVectors.
+ */
+template <typename T, std::size_t N>
+inline auto swap(InplaceVector<T, N>& lhs, InplaceVector<T, N>& rhs) noexcept(noexcept(lhs.swap(rhs))) -> void
+{
+    lhs.swap(rhs);
+}
+
 } // namespace core
 } // namespace ara
 
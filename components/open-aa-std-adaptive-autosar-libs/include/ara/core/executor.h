@@ -0,0 +1,400 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project (CXX_STANDARD 17)
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara/core/executor.h
+ *  \brief      Declaration of the work-stealing ara::core::Executor.
+ *
+ *  \details    The Executor runs range tasks on a fixed set of worker threads, created once (usually by
+ *              ara::core::Initialize()) and pinned one per CPU through ara::os::interface::thread::Thread.
+ *
+ *              - Every worker owns a bounded work-stealing deque: it pushes and pops at the bottom, idle workers
+ *                steal the oldest (largest) tasks from the top. Threads that are not workers submit through a shared
+ *                MpmcRing.
+ *              - A range task [begin, end) larger than its grain is split lazily: the executing thread pushes the upper
+ *                half for others to steal and continues with the lower half, so a range spreads over the idle
+ *                workers in O(log n) steps while a busy system runs it with few splits.
+ *              - ParallelFor() blocks until the whole range has run; the calling thread executes tasks meanwhile,
+ *                which also makes nested ParallelFor() calls from inside a task safe.
+ *
+ *              Idle workers sleep on a semaphore and are woken only when tasks are pushed while some of them sleep.
+ *
+ *  \note       No heap allocation: the deques, the submission ring and the workers are held in place.
+ *********************************************************************************************************************/
+
+#ifndef OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_CORE_EXECUTOR_H_
+#define OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_CORE_EXECUTOR_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <semaphore.h>   // For sem_t
+#include <atomic>        // For std::atomic
+#include <cstddef>       // For std::size_t
+#include <cstdint>       // For std::int64_t, std::uint8_t
+#include <mutex>         // For std::mutex
+
+#include "ara/core/ring.h"                    // For ara::core::MpmcRing
+#include "ara/os/interface/thread/thread.h"   // For the pinned worker threads
+
+namespace ara {
+namespace core {
+
+/**********************************************************************************************************************
+ *  ENUM: ExecutorErrorCode
+ *********************************************************************************************************************/
+/*!
+ * \brief  Result of Executor::Start().
+ */
+enum class ExecutorErrorCode : std::uint8_t {
+    Success = 0,            /*!< All workers are running */
+    AlreadyRunning,         /*!< Start() was called twice */
+    InvalidArgument,        /*!< More than kMaxWorkers workers, or a policy, priority or stack size out of range */
+    ThreadCreationFailed    /*!< A worker could not be created or pinned; no worker is left running */
+};
+
+/**********************************************************************************************************************
+ *  TYPE ALIAS: TaskFunction
+ *********************************************************************************************************************/
+/*!
+ * \brief  Body of a range task: processes the indices [begin, end) of the range with the given context.
+ */
+using TaskFunction = void (*)(void* context, std::size_t begin, std::size_t end) noexcept;
+
+/**********************************************************************************************************************
+ *  STRUCT: ExecutorConfig
+ *********************************************************************************************************************/
+/*!
+ * \brief  Configuration of the Executor workers.
+ *
+ * \details
+ * - workerCount: Number of workers (0: one less than the CPUs in \c cpus, at least one).
+ * - cpus:        CPUs the workers run on (empty: the affinity of the thread calling Start()). Worker i is pinned to
+ *                CPU (i + 1) mod n of the n CPUs in the set, so with n - 1 workers the first CPU stays with the
+ *                thread that calls the parallel algorithms.
+ * - pinWorkers:  Pin each worker to its one CPU (false: every worker may run on all of \c cpus).
+ * - policy / priority / stackSize / stackPrefault: applied to every worker (see ara::os ThreadConfig).
+ */
+struct ExecutorConfig {
+    std::size_t                                   workerCount{0U};
+    ara::os::interface::thread::CpuSet            cpus{};
+    bool                                          pinWorkers{true};
+    ara::os::interface::thread::SchedulingPolicy  policy{ara::os::interface::thread::SchedulingPolicy::Inherit};
+    std::int32_t                                  priority{0};
+    std::size_t                                   stackSize{0U};
+    std::size_t                                   stackPrefault{0U};
+};
+
+namespace internal {
+
+/**********************************************************************************************************************
+ *  STRUCT: Task
+ *********************************************************************************************************************/
+/*!
+ * \brief  A range task as it is queued: the body, the remaining range, its grain and the completion counter of the
+ *         ParallelFor() it belongs to (nullptr for Submit()).
+ */
+struct Task {
+    TaskFunction               function{nullptr};
+    void*                      context{nullptr};
+    std::size_t                begin{0U};
+    std::size_t                end{0U};
+    std::size_t                grain{1U};
+    std::atomic<std::size_t>*  remaining{nullptr};
+};
+
+/**********************************************************************************************************************
+ *  CLASS: WorkStealingDeque
+ *********************************************************************************************************************/
+/*!
+ * \brief  Bounded Chase-Lev deque of N tasks (N a power of two).
+ *
+ * \details
+ * - Push() and Pop() may only be called by the owning worker, Steal() by any thread.
+ * - The task fields are stored as relaxed atomics, so a thief reading a slot the owner is reusing is not a data
+ *   race; the thief then loses the compare-and-swap on \c top_ and discards what it read.
+ */
+template <std::size_t N>
+class alignas(kCacheLineSize) WorkStealingDeque final {
+    static_assert(IsPowerOfTwo(N), "ara::core::internal::WorkStealingDeque: N must be a power of two");
+
+public:
+    /*!
+     * \brief  Pushes \c task at the bottom (owner only).
+     *
+     * \return \c false if the deque is full.
+     */
+    auto Push(const Task& task) noexcept -> bool
+    {
+        std::int64_t const bottom = bottom_.load(std::memory_order_relaxed);
+        std::int64_t const top    = top_.load(std::memory_order_acquire);
+        if ((bottom - top) >= static_cast<std::int64_t>(N)) {
+            return false;
+        }
+        slots_[static_cast<std::size_t>(bottom) & kMask].Store(task);
+        std::atomic_thread_fence(std::memory_order_release);
+        bottom_.store(bottom + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    /*!
+     * \brief  Pops the newest task from the bottom (owner only).
+     *
+     * \return \c false if the deque is empty (or a thief took the last task).
+     */
+    auto Pop(Task& task) noexcept -> bool
+    {
+        std::int64_t const bottom = bottom_.load(std::memory_order_relaxed) - 1;
+        bottom_.store(bottom, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        std::int64_t top = top_.load(std::memory_order_relaxed);
+        if (top > bottom) {
+            bottom_.store(bottom + 1, std::memory_order_relaxed);
+            return false;
+        }
+        slots_[static_cast<std::size_t>(bottom) & kMask].Load(task);
+        bool taken{true};
+        if (top == bottom) {
+            // Last task: race the thieves for it
+            taken = top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+            bottom_.store(bottom + 1, std::memory_order_relaxed);
+        }
+        return taken;
+    }
+
+    /*!
+     * \brief  Steals the oldest task from the top (any thread).
+     *
+     * \return \c false if the deque is empty or another thread took the task first.
+     */
+    auto Steal(Task& task) noexcept -> bool
+    {
+        std::int64_t top = top_.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        std::int64_t const bottom = bottom_.load(std::memory_order_acquire);
+        if (top >= bottom) {
+            return false;
+        }
+        slots_[static_cast<std::size_t>(top) & kMask].Load(task);
+        return top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+    }
+
+    /*!
+     * \brief  Whether the deque holds no task (a snapshot).
+     */
+    auto IsEmpty() const noexcept -> bool
+    {
+        return top_.load(std::memory_order_acquire) >= bottom_.load(std::memory_order_acquire);
+    }
+
+private:
+    /*!
+     * \brief  One task stored field by field.
+     */
+    struct Slot {
+        std::atomic<TaskFunction>               function{nullptr};
+        std::atomic<void*>                      context{nullptr};
+        std::atomic<std::size_t>                begin{0U};
+        std::atomic<std::size_t>                end{0U};
+        std::atomic<std::size_t>                grain{1U};
+        std::atomic<std::atomic<std::size_t>*>  remaining{nullptr};
+
+        auto Store(const Task& task) noexcept -> void
+        {
+            function.store(task.function, std::memory_order_relaxed);
+            context.store(task.context, std::memory_order_relaxed);
+            begin.store(task.begin, std::memory_order_relaxed);
+            end.store(task.end, std::memory_order_relaxed);
+            grain.store(task.grain, std::memory_order_relaxed);
+            remaining.store(task.remaining, std::memory_order_relaxed);
+        }
+
+        auto Load(Task& task) const noexcept -> void
+        {
+            task.function  = function.load(std::memory_order_relaxed);
+            task.context   = context.load(std::memory_order_relaxed);
+            task.begin     = begin.load(std::memory_order_relaxed);
+            task.end       = end.load(std::memory_order_relaxed);
+            task.grain     = grain.load(std::memory_order_relaxed);
+            task.remaining = remaining.load(std::memory_order_relaxed);
+        }
+    };
+
+    static constexpr std::size_t kMask{N - 1U};
+
+    alignas(kCacheLineSize) std::atomic<std::int64_t> top_{0};
+    alignas(kCacheLineSize) std::atomic<std::int64_t> bottom_{0};
+    Slot slots_[N]{};
+};
+
+} // namespace internal
+
+/**********************************************************************************************************************
+ *  CLASS: Executor
+ *********************************************************************************************************************/
+/*!
+ * \brief  Work-stealing executor with a fixed set of pinned worker threads.
+ *
+ * \details
+ * - Start() creates the workers, Stop() runs the tasks already queued and joins them. While the executor is stopped,
+ *   ParallelFor() runs the whole range on the calling thread and Submit() refuses tasks.
+ * - Instance() is the executor started by ara::core::Initialize() and used by the ara::core::parallel algorithms.
+ * - Not copyable or movable: the workers reference the object.
+ */
+class Executor final {
+public:
+    /*!
+     * \brief  Maximum number of workers.
+     */
+    static constexpr std::size_t kMaxWorkers{32U};
+
+    /*!
+     * \brief  Capacity of each worker deque (pending split halves and submitted tasks).
+     */
+    static constexpr std::size_t kDequeCapacity{256U};
+
+    /*!
+     * \brief  Capacity of the ring receiving the tasks of threads that are not workers.
+     */
+    static constexpr std::size_t kSubmissionCapacity{1024U};
+
+    /*!
+     * \brief  Number of task searches an idle worker spins through before it sleeps.
+     */
+    static constexpr std::size_t kSpinCount{64U};
+
+    Executor() noexcept;
+
+    /*!
+     * \brief  Stops the workers (see Stop()).
+     */
+    ~Executor() noexcept;
+
+    Executor(const Executor&) = delete;
+    Executor(Executor&&) = delete;
+    auto operator=(const Executor&) -> Executor& = delete;
+    auto operator=(Executor&&) -> Executor& = delete;
+
+    /*!
+     * \brief  Returns the process-wide executor.
+     */
+    static auto Instance() noexcept -> Executor&;
+
+    /*!
+     * \brief  Creates the workers of \c config, each already pinned and named ("ara_worker_<i>") when it starts.
+     *
+     * \return ExecutorErrorCode::Success, AlreadyRunning, InvalidArgument or ThreadCreationFailed.
+     */
+    auto Start(const ExecutorConfig& config = ExecutorConfig{}) noexcept -> ExecutorErrorCode;
+
+    /*!
+     * \brief  Runs the queued tasks, then stops and joins the workers. Safe to call when stopped; must not be called
+     *         while a ParallelFor() is in progress or from a worker.
+     */
+    auto Stop() noexcept -> void;
+
+    /*!
+     * \brief  Whether the workers are running.
+     */
+    auto IsRunning() const noexcept -> bool;
+
+    /*!
+     * \brief  Number of running workers (0 when stopped).
+     */
+    auto GetWorkerCount() const noexcept -> std::size_t;
+
+    /*!
+     * \brief  Index of the calling thread among the workers of this executor, or kMaxWorkers for other threads.
+     */
+    auto GetCurrentWorkerIndex() const noexcept -> std::size_t;
+
+    /*!
+     * \brief  Grain used for \c count indices when the caller passes 0: about eight tasks per thread.
+     */
+    auto GetDefaultGrain(std::size_t count) const noexcept -> std::size_t;
+
+    /*!
+     * \brief  Runs \c function over [0, count) in tasks of at most \c grain indices (0: GetDefaultGrain()) and
+     *         returns once all of them ran. The calling thread runs tasks while it waits.
+     */
+    auto ParallelFor(std::size_t count, std::size_t grain, TaskFunction function, void* context) noexcept -> void;
+
+    /*!
+     * \brief  Queues function(context, 0, 1) to run on a worker without waiting for it.
+     *
+     * \return \c false if the executor is stopped or the queue is full. A task accepted before Stop() runs before
+     *         Stop() returns.
+     */
+    auto Submit(TaskFunction function, void* context) noexcept -> bool;
+
+private:
+    /*!
+     * \brief  A worker thread with its deque.
+     */
+    struct Worker {
+        Executor*                                        owner{nullptr};
+        std::size_t                                      index{0U};
+        char                                             name[16]{};
+        internal::WorkStealingDeque<kDequeCapacity>      deque{};
+        ara::os::interface::thread::Thread               thread{};
+    };
+
+    /*!
+     * \brief  Entry of the worker threads; \c context is the Worker.
+     */
+    static auto WorkerEntry(void* context) noexcept -> void;
+
+    /*!
+     * \brief  Task loop of worker \c worker until Stop() and no task is left.
+     */
+    auto RunWorker(Worker& worker) noexcept -> void;
+
+    /*!
+     * \brief  Queues \c task on the deque of worker \c self, or on the submission ring for other threads, and wakes a
+     *         sleeping worker.
+     *
+     * \return \c false if the queue is full.
+     */
+    auto Push(const internal::Task& task, std::size_t self) noexcept -> bool;
+
+    /*!
+     * \brief  Takes a task: from the own deque of worker \c self first, then the submission ring, then by stealing
+     *         from the other workers.
+     */
+    auto FindTask(std::size_t self, internal::Task& task) noexcept -> bool;
+
+    /*!
+     * \brief  Whether any queue holds a task (a snapshot).
+     */
+    auto HasQueuedTask() const noexcept -> bool;
+
+    /*!
+     * \brief  Splits \c task down to its grain, queueing the upper halves, and runs the remaining lower part.
+     */
+    auto Execute(internal::Task task, std::size_t self) noexcept -> void;
+
+    /*!
+     * \brief  Stops and joins the first \c count workers.
+     */
+    auto JoinWorkers(std::size_t count) noexcept -> void;
+
+    Worker                                          workers_[kMaxWorkers]{};
+    MpmcRing<internal::Task, kSubmissionCapacity>   submissions_{};
+    std::size_t                                     workerCount_{0U};
+    std::mutex                                      control_{};
+    std::atomic<bool>                               running_{false};
+    std::atomic<bool>                               stopping_{false};
+    std::atomic<std::size_t>                        submitting_{0U};   /*!< Submit() calls in progress */
+    alignas(internal::kCacheLineSize) std::atomic<std::size_t> sleeping_{0U};
+    sem_t                                           wake_{};
+};
+
+} // namespace core
+} // namespace ara
+
+#endif // OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_CORE_EXECUTOR_H_
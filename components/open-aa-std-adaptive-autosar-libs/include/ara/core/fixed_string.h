@@ -0,0 +1,339 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project (CXX_STANDARD 17)
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara/core/fixed_string.h
+ *  \brief      Definition and implementation of the ara::core::BasicFixedString template class.
+ *
+ *  \details    BasicFixedString<N> holds up to N characters plus a null terminator in an ara::core::Array<char, N + 1>
+ *              member, so it never allocates. It is intended for component names, log tags, identifiers and
+ *              diagnostic text on paths that must not touch the allocator (e.g., the ViolationHandler).
+ *
+ *              - Concatenation of fixed strings and string literals is constexpr; the capacity of the result is the
+ *                sum of the capacities, so it never truncates.
+ *              - ToFixedString(value) formats an integer into a BasicFixedString sized for its type, at compile time
+ *                or at run time.
+ *              - append() at run time keeps as many characters as fit and records the truncation (truncated()).
+ *
+ *  \note       This header is an OpenAA extension; ara::core::StringView is defined as std::string_view.
+ *********************************************************************************************************************/
+
+#ifndef OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_CORE_FIXED_STRING_H_
+#define OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_CORE_FIXED_STRING_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <cstddef>       // For std::size_t
+#include <cstring>       // For std::memcpy
+#include <limits>        // For std::numeric_limits
+#include <string_view>   // For std::string_view
+#include <type_traits>   // For std::is_integral, std::make_unsigned
+
+#include "ara/core/array.h"                 // For ara::core::Array (storage)
+#include "ara/core/internal/trivial_ops.h"  // For internal::IsConstantEvaluated
+
+namespace ara {
+namespace core {
+
+/**********************************************************************************************************************
+ *  TYPE ALIASES
+ *********************************************************************************************************************/
+/*!
+ * \brief  Non-owning, read-only view of a character sequence.
+ */
+using StringView = std::string_view;
+
+/**********************************************************************************************************************
+ *  CLASS: BasicFixedString
+ *********************************************************************************************************************/
+/*!
+ * \brief  A string of at most \c N characters with in-place storage.
+ *
+ * \tparam N  The capacity in characters (without the null terminator).
+ *
+ * \details
+ * - The content is always null-terminated, so c_str() can be passed to C APIs.
+ * - Converts implicitly to StringView; a view stays valid until the string is modified or destroyed.
+ * - Trivially copyable; copying copies the whole storage (N + 1 bytes) and never allocates.
+ */
+template <std::size_t N>
+class BasicFixedString final
+{
+public:
+    using value_type      = char;           /*!< Type of the characters    */
+    using size_type       = std::size_t;    /*!< Used for sizes and indices */
+    using const_iterator  = const char*;    /*!< Const iterator type        */
+
+    // -----------------------------------------------------------------------------------
+    // 1) CONSTRUCTORS
+    // -----------------------------------------------------------------------------------
+    /*!
+     * \brief  Constructs an empty string.
+     */
+    constexpr BasicFixedString() noexcept = default;
+
+    /*!
+     * \brief  Constructs the string from a string literal; a literal longer than N is a compile-time error.
+     */
+    template <std::size_t M>
+    constexpr BasicFixedString(const char (&literal)[M]) noexcept
+    {
+        static_assert((M > 0U) && ((M - 1U) <= N),
+            "\n[ERROR] ara::core::BasicFixedString: The string literal does not fit the capacity.\n");
+        append(StringView(literal, M - 1U));
+    }
+
+    /*!
+     * \brief  Constructs the string from a view; as many characters as fit are kept (see truncated()).
+     */
+    constexpr explicit BasicFixedString(StringView text) noexcept
+    {
+        append(text);
+    }
+
+    // -----------------------------------------------------------------------------------
+    // 2) MODIFIERS
+    // -----------------------------------------------------------------------------------
+    /*!
+     * \brief  Appends \c text; characters beyond the capacity are dropped and truncated() becomes \c true.
+     *
+     * \return *this, to chain appends.
+     */
+    constexpr auto append(StringView text) noexcept -> BasicFixedString&
+    {
+        size_type count = text.size();
+        if (count > (N - size_)) {
+            count = N - size_;
+            truncated_ = true;
+        }
+        if (internal::IsConstantEvaluated()) {
+            for (size_type i = 0U; i < count; ++i) {
+                data_[size_ + i] = text[i];
+            }
+        } else if (count > 0U) {
+            std::memcpy(data_.data() + size_, text.data(), count);
+        }
+        size_ += count;
+        data_[size_] = '\0';
+        return *this;
+    }
+
+    /*!
+     * \brief  Appends one character (dropped, with truncated() == true, if the string is full).
+     */
+    constexpr auto push_back(char character) noexcept -> void
+    {
+        append(StringView(&character, 1U));
+    }
+
+    /*!
+     * \brief  Appends \c text (same as append()).
+     */
+    constexpr auto operator+=(StringView text) noexcept -> BasicFixedString&
+    {
+        return append(text);
+    }
+
+    /*!
+     * \brief  Replaces the content with \c text; truncated() reflects only the new content.
+     */
+    constexpr auto assign(StringView text) noexcept -> BasicFixedString&
+    {
+        clear();
+        return append(text);
+    }
+
+    /*!
+     * \brief  Empties the string and resets truncated().
+     */
+    constexpr auto clear() noexcept -> void
+    {
+        size_ = 0U;
+        truncated_ = false;
+        data_[0U] = '\0';
+    }
+
+    // -----------------------------------------------------------------------------------
+    // 3) OBSERVERS
+    // -----------------------------------------------------------------------------------
+    constexpr auto size() const noexcept -> size_type { return size_; }
+    constexpr auto length() const noexcept -> size_type { return size_; }
+    static constexpr auto capacity() noexcept -> size_type { return N; }
+    [[nodiscard]] constexpr auto empty() const noexcept -> bool { return size_ == 0U; }
+
+    /*!
+     * \brief  Returns whether an append() had to drop characters since construction or the last clear() / assign().
+     */
+    constexpr auto truncated() const noexcept -> bool { return truncated_; }
+
+    /*!
+     * \brief  Returns the null-terminated content.
+     */
+    constexpr auto c_str() const noexcept -> const char* { return data_.data(); }
+    constexpr auto data() const noexcept -> const char* { return data_.data(); }
+
+    /*!
+     * \brief  Unchecked access to the character at \c idx (idx < size()).
+     */
+    constexpr auto operator[](size_type idx) const noexcept -> char { return data_[idx]; }
+
+    constexpr auto begin() const noexcept -> const_iterator { return data_.data(); }
+    constexpr auto end() const noexcept -> const_iterator { return data_.data() + size_; }
+
+    /*!
+     * \brief  Returns a view of the content.
+     */
+    constexpr auto view() const noexcept -> StringView { return StringView(data_.data(), size_); }
+    constexpr operator StringView() const noexcept { return view(); }
+
+private:
+    /*!
+     * \brief  The characters and the null terminator.
+     */
+    Array<char, N + 1U> data_{};
+
+    /*!
+     * \brief  Number of characters (without the null terminator).
+     */
+    size_type size_{0U};
+
+    /*!
+     * \brief  Whether characters were dropped by append().
+     */
+    bool truncated_{false};
+};
+
+/**********************************************************************************************************************
+ *  DEDUCTION GUIDES
+ *********************************************************************************************************************/
+/*!
+ * \brief  BasicFixedString{"literal"} deduces the capacity from the literal's length.
+ */
+template <std::size_t M>
+BasicFixedString(const char (&)[M]) -> BasicFixedString<M - 1U>;
+
+/**********************************************************************************************************************
+ *  NON-MEMBER FUNCTIONS
+ *********************************************************************************************************************/
+/*!
+ * \brief  Concatenates two fixed strings; the capacity of the result is N + M, so nothing is dropped.
+ */
+template <std::size_t N, std::size_t M>
+constexpr auto operator+(const BasicFixedString<N>& lhs, const BasicFixedString<M>& rhs) noexcept
+    -> BasicFixedString<N + M>
+{
+    BasicFixedString<N + M> result{};
+    result.append(lhs).append(rhs);
+    return result;
+}
+
+/*!
+ * \brief  Concatenates a fixed string and a string literal.
+ */
+template <std::size_t N, std::size_t M>
+constexpr auto operator+(const BasicFixedString<N>& lhs, const char (&rhs)[M]) noexcept
+    -> BasicFixedString<N + M - 1U>
+{
+    return lhs + BasicFixedString<M - 1U>{rhs};
+}
+
+/*!
+ * \brief  Concatenates a string literal and a fixed string.
+ */
+template <std::size_t M, std::size_t N>
+constexpr auto operator+(const char (&lhs)[M], const BasicFixedString<N>& rhs) noexcept
+    -> BasicFixedString<M - 1U + N>
+{
+    return BasicFixedString<M - 1U>{lhs} + rhs;
+}
+
+/*!
+ * \brief  Compares the content of two fixed strings (independent of their capacities).
+ */
+template <std::size_t N, std::size_t M>
+constexpr auto operator==(const BasicFixedString<N>& lhs, const BasicFixedString<M>& rhs) noexcept -> bool
+{
+    return lhs.view() == rhs.view();
+}
+
+template <std::size_t N, std::size_t M>
+constexpr auto operator!=(const BasicFixedString<N>& lhs, const BasicFixedString<M>& rhs) noexcept -> bool
+{
+    return !(lhs == rhs);
+}
+
+/*!
+ * \brief  Compares the content of a fixed string with a view.
+ */
+template <std::size_t N>
+constexpr auto operator==(const BasicFixedString<N>& lhs, StringView rhs) noexcept -> bool
+{
+    return lhs.view() == rhs;
+}
+
+template <std::size_t N>
+constexpr auto operator==(StringView lhs, const BasicFixedString<N>& rhs) noexcept -> bool
+{
+    return lhs == rhs.view();
+}
+
+template <std::size_t N>
+constexpr auto operator!=(const BasicFixedString<N>& lhs, StringView rhs) noexcept -> bool
+{
+    return !(lhs == rhs);
+}
+
+template <std::size_t N>
+constexpr auto operator!=(StringView lhs, const BasicFixedString<N>& rhs) noexcept -> bool
+{
+    return !(lhs == rhs);
+}
+
+/*!
+ * \brief  Number of characters of the decimal representation of any value of the integer type T (with sign).
+ */
+template <typename T>
+constexpr std::size_t kMaxDecimalDigits = static_cast<std::size_t>(std::numeric_limits<T>::digits10) + 1U +
+                                          (std::is_signed_v<T> ? 1U : 0U);
+
+/*!
+ * \brief  Formats \c value in decimal (with a leading '-' if negative).
+ *
+ * \tparam T  An integer type other than bool and the character types.
+ */
+template <typename T>
+constexpr auto ToFixedString(T value) noexcept -> BasicFixedString<kMaxDecimalDigits<T>>
+{
+    static_assert(std::is_integral_v<T> && !std::is_same_v<T, bool> && !std::is_same_v<T, char>,
+        "\n[ERROR] ara::core::ToFixedString: T must be an integer type (not bool or char).\n");
+
+    using Unsigned = std::make_unsigned_t<T>;
+    bool const negative = (value < static_cast<T>(0));
+    Unsigned magnitude = negative ? static_cast<Unsigned>(static_cast<Unsigned>(0U) - static_cast<Unsigned>(value))
+                                  : static_cast<Unsigned>(value);
+
+    char digits[kMaxDecimalDigits<T>]{};
+    std::size_t pos = kMaxDecimalDigits<T>;
+    do {
+        digits[--pos] = static_cast<char>('0' + static_cast<int>(magnitude % 10U));
+        magnitude = static_cast<Unsigned>(magnitude / 10U);
+    } while (magnitude != 0U);
+    if (negative) {
+        digits[--pos] = '-';
+    }
+
+    BasicFixedString<kMaxDecimalDigits<T>> result{};
+    result.append(StringView(digits + pos, kMaxDecimalDigits<T> - pos));
+    return result;
+}
+
+} // namespace core
+} // namespace ara
+
+#endif // OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_CORE_FIXED_STRING_H_
@@ -0,0 +1,273 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project (CXX_STANDARD 17)
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara/core/flat_map.h
+ *  \brief      Definition of the ara::core::FlatMap sorted, fixed-capacity associative container.
+ *
+ *  \details    FlatMap<Key, T, N> holds up to N entries in two ara::core::Array members: the keys in ascending order
+ *              and the mapped values at the same positions. A lookup is a branchless binary search over the dense
+ *              key array (the comparison result selects the next base, so the loop compiles to conditional moves),
+ *              followed by one access to the value array. Nothing is allocated.
+ *
+ *              - All members are constexpr, so a table built from an initializer list can be a constexpr variable:
+ *                it is sorted at compile time and costs nothing at startup.
+ *              - Insert() keeps the order by shifting the tail, O(N); tables are meant to be filled once and then
+ *                read.
+ *              - Exceeding the capacity, a duplicate key in the initializer list and at() of a missing key are
+ *                violations (during constant evaluation they fail the compilation instead).
+ *
+ *  \note       This header is an OpenAA extension; it is not part of the AUTOSAR SWS.
+ *********************************************************************************************************************/
+
+#ifndef OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_CORE_FLAT_MAP_H_
+#define OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_CORE_FLAT_MAP_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <cstddef>           // For std::size_t
+#include <functional>        // For std::less
+#include <initializer_list>  // For std::initializer_list
+#include <utility>           // For std::pair
+
+#include "ara/core/array.h"                       // For ara::core::Array
+#include "ara/core/span.h"                        // For ara::core::Span
+#include "ara/core/internal/location_utils.h"     // For capturing file/line details
+#include "ara/core/internal/violation_handler.h"  // To trigger the violation
+
+namespace ara {
+namespace core {
+
+/**********************************************************************************************************************
+ *  CLASS: FlatMap
+ *********************************************************************************************************************/
+/*!
+ * \brief  Sorted map of at most N entries stored in contiguous arrays.
+ *
+ * \tparam Key      Key type (default constructible, nothrow copyable, as for ara::core::Array).
+ * \tparam T        Mapped type (default constructible, nothrow copyable, as for ara::core::Array).
+ * \tparam N        Capacity.
+ * \tparam Compare  Strict weak ordering of the keys (default constructible, e.g. std::less<Key>).
+ */
+template <typename Key, typename T, std::size_t N, typename Compare = std::less<Key>>
+class FlatMap final {
+public:
+    using key_type    = Key;
+    using mapped_type = T;
+    using value_type  = std::pair<Key, T>;
+    using size_type   = std::size_t;
+    using key_compare = Compare;
+
+    /*!
+     * \brief  Empty map.
+     */
+    constexpr FlatMap() noexcept = default;
+
+    /*!
+     * \brief  Map of the given entries, in any order; a duplicate key is a violation.
+     */
+    constexpr FlatMap(std::initializer_list<value_type> entries) noexcept
+    {
+        for (const value_type& entry : entries) {
+            if (!Insert(entry.first, entry.second)) {
+                ara::core::internal::ReportInvalidState(ARA_CORE_INTERNAL_FILELINE,
+                                                        "ara::core::FlatMap: duplicate key in the initializer list");
+            }
+        }
+    }
+
+    // -----------------------------------------------------------------------------------
+    // Capacity
+    // -----------------------------------------------------------------------------------
+    [[nodiscard]] constexpr auto empty() const noexcept -> bool { return size_ == 0U; }
+    constexpr auto size() const noexcept -> size_type { return size_; }
+    static constexpr auto capacity() noexcept -> size_type { return N; }
+
+    // -----------------------------------------------------------------------------------
+    // Lookup
+    // -----------------------------------------------------------------------------------
+    /*!
+     * \brief  The value mapped to \c key, or nullptr.
+     */
+    constexpr auto Find(const Key& key) noexcept -> T*
+    {
+        size_type const index = IndexOf(key);
+        return (index != N) ? &values_[index] : nullptr;
+    }
+
+    constexpr auto Find(const Key& key) const noexcept -> const T*
+    {
+        size_type const index = IndexOf(key);
+        return (index != N) ? &values_[index] : nullptr;
+    }
+
+    /*!
+     * \brief  Whether \c key is in the map.
+     */
+    constexpr auto Contains(const Key& key) const noexcept -> bool { return IndexOf(key) != N; }
+
+    /*!
+     * \brief  The value mapped to \c key; a missing key is a violation.
+     */
+    constexpr auto at(const Key& key) noexcept -> T& { return values_[CheckedIndexOf(key)]; }
+    constexpr auto at(const Key& key) const noexcept -> const T& { return values_[CheckedIndexOf(key)]; }
+
+    /*!
+     * \brief  Position of the first key not ordered before \c key (size() if there is none).
+     */
+    constexpr auto LowerBound(const Key& key) const noexcept -> size_type
+    {
+        if (size_ == 0U) {
+            return 0U;
+        }
+        Compare const less{};
+        size_type base   = 0U;
+        size_type length = size_;
+        while (length > 1U) {
+            size_type const half = length / 2U;
+            base = less(keys_[base + half], key) ? (base + half) : base;
+            length -= half;
+        }
+        return base + (less(keys_[base], key) ? 1U : 0U);
+    }
+
+    /*!
+     * \brief  The keys in ascending order.
+     */
+    constexpr auto GetKeys() const noexcept -> Span<const Key> { return Span<const Key>{keys_.data(), size_}; }
+
+    /*!
+     * \brief  The mapped values, at the positions of their keys in GetKeys().
+     */
+    constexpr auto GetValues() noexcept -> Span<T> { return Span<T>{values_.data(), size_}; }
+    constexpr auto GetValues() const noexcept -> Span<const T> { return Span<const T>{values_.data(), size_}; }
+
+    // -----------------------------------------------------------------------------------
+    // Modifiers
+    // -----------------------------------------------------------------------------------
+    /*!
+     * \brief  Inserts \c key mapped to \c value unless the key is present.
+     *
+     * \return true if inserted, false if the key was already present (its value is left unchanged).
+     * \note   Inserting a new key into a full map is a violation.
+     */
+    constexpr auto Insert(const Key& key, const T& value) noexcept -> bool
+    {
+        size_type const position = LowerBound(key);
+        if (IsAt(position, key)) {
+            return false;
+        }
+        if (size_ == N) {
+            ara::core::internal::ReportCapacityExceeded(ARA_CORE_INTERNAL_FILELINE, size_ + 1U, N);
+        }
+        for (size_type i = size_; i > position; --i) {
+            keys_[i]   = keys_[i - 1U];
+            values_[i] = values_[i - 1U];
+        }
+        keys_[position]   = key;
+        values_[position] = value;
+        ++size_;
+        return true;
+    }
+
+    /*!
+     * \brief  Maps \c key to \c value, inserting the key if it is not present.
+     *
+     * \return true if inserted, false if an existing value was replaced.
+     */
+    constexpr auto InsertOrAssign(const Key& key, const T& value) noexcept -> bool
+    {
+        size_type const position = LowerBound(key);
+        if (IsAt(position, key)) {
+            values_[position] = value;
+            return false;
+        }
+        return Insert(key, value);
+    }
+
+    /*!
+     * \brief  Removes \c key; returns whether it was present.
+     */
+    constexpr auto Erase(const Key& key) noexcept -> bool
+    {
+        size_type const position = LowerBound(key);
+        if (!IsAt(position, key)) {
+            return false;
+        }
+        for (size_type i = position + 1U; i < size_; ++i) {
+            keys_[i - 1U]   = keys_[i];
+            values_[i - 1U] = values_[i];
+        }
+        --size_;
+        return true;
+    }
+
+    /*!
+     * \brief  Removes all entries (the storage keeps the former elements).
+     */
+    constexpr auto clear() noexcept -> void { size_ = 0U; }
+
+private:
+    /*!
+     * \brief  Whether the key at \c position equals \c key (neither is ordered before the other).
+     */
+    constexpr auto IsAt(size_type position, const Key& key) const noexcept -> bool
+    {
+        return (position < size_) && !Compare{}(key, keys_[position]);
+    }
+
+    /*!
+     * \brief  Position of \c key, or N if it is not present.
+     */
+    constexpr auto IndexOf(const Key& key) const noexcept -> size_type
+    {
+        size_type const position = LowerBound(key);
+        return IsAt(position, key) ? position : N;
+    }
+
+    constexpr auto CheckedIndexOf(const Key& key) const noexcept -> size_type
+    {
+        size_type const index = IndexOf(key);
+        if (index == N) {
+            ara::core::internal::ReportInvalidState(ARA_CORE_INTERNAL_FILELINE,
+                                                    "ara::core::FlatMap::at: key not found");
+        }
+        return index;
+    }
+
+    Array<Key, N> keys_{};
+    Array<T, N>   values_{};
+    size_type     size_{0U};
+};
+
+/*!
+ * \brief  FlatMap of exactly the given entries, with the capacity deduced from their number.
+ *
+ * \details Usable for constexpr tables:
+ *
+ *              constexpr auto kHandlers =
+ *                  ara::core::MakeFlatMap<int, Handler>({{SIGTERM, &OnTerm}, {SIGINT, &OnInt}});
+ */
+template <typename Key, typename T, typename Compare = std::less<Key>, std::size_t N>
+constexpr auto MakeFlatMap(const std::pair<Key, T> (&entries)[N]) noexcept -> FlatMap<Key, T, N, Compare>
+{
+    FlatMap<Key, T, N, Compare> map{};
+    for (std::size_t i = 0U; i < N; ++i) {
+        if (!map.Insert(entries[i].first, entries[i].second)) {
+            ara::core::internal::ReportInvalidState(ARA_CORE_INTERNAL_FILELINE,
+                                                    "ara::core::MakeFlatMap: duplicate key in the entries");
+        }
+    }
+    return map;
+}
+
+} // namespace core
+} // namespace ara
+
+#endif // OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_CORE_FLAT_MAP_H_
@@ -0,0 +1,263 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project (CXX_STANDARD 17)
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara/core/flight_recorder.h
+ *  \brief      Definition of the ara::core::FlightRecorder, an always-on per-thread binary event ring.
+ *
+ *  \details    Every thread records into its own ring of the last kRecordCapacity events: a timestamp of the cheapest
+ *              monotonic counter (TSC, CNTVCT_EL0 or ClockCycles()), a tag and two integer arguments. Recording is
+ *              inline and takes a few nanoseconds: no formatting, no system call, no lock, no heap. The rings live
+ *              in static storage and are claimed by a thread on its first record.
+ *
+ *              The rings are only read when the process is about to die: the ViolationHandler dumps them before it
+ *              aborts, and the optional crash handlers before a critical signal (SIGSEGV, SIGBUS, SIGFPE, SIGILL,
+ *              SIGABRT) takes its default action. The dump is formatted into stack buffers and written with write(2)
+ *              to stderr or to a dump file opened and preallocated by Configure(), so it is async-signal-safe.
+ *
+ *  \note       Tags must be string literals (or other strings with static storage duration): only the pointer is
+ *              recorded and it is dereferenced when dumping.
+ *********************************************************************************************************************/
+
+#ifndef OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_CORE_FLIGHT_RECORDER_H_
+#define OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_CORE_FLIGHT_RECORDER_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <atomic>        // For std::atomic
+#include <cstddef>       // For std::size_t
+#include <cstdint>       // For std::uint64_t, std::uint8_t
+
+#include "ara/core/interference_size.h"  // For ara::core::kDestructiveInterferenceSize
+
+#if defined(__QNXNTO__)
+    #include <sys/neutrino.h>   // For ClockCycles
+#elif defined(__x86_64__) || defined(__i386__)
+    #include <x86intrin.h>      // For __rdtsc
+#elif !defined(__aarch64__)
+    #include <time.h>           // For clock_gettime, CLOCK_MONOTONIC
+#endif
+
+namespace ara {
+namespace core {
+
+/**********************************************************************************************************************
+ *  ENUM: FlightRecorderErrorCode
+ *********************************************************************************************************************/
+/*!
+ * \brief  Result of FlightRecorder::Configure().
+ */
+enum class FlightRecorderErrorCode : std::uint8_t {
+    Success = 0,            /*!< The configuration is applied */
+    DumpFileFailed,         /*!< The dump file could not be opened or preallocated; dumps go to stderr */
+    SignalHandlerFailed     /*!< A crash handler could not be installed */
+};
+
+/**********************************************************************************************************************
+ *  STRUCT: FlightRecorderConfig
+ *********************************************************************************************************************/
+/*!
+ * \brief  Configuration of FlightRecorder::Configure().
+ *
+ * \details
+ * - dumpPath:             File the dumps are written to, opened (truncated) and preallocated to kMaxDumpSize bytes by
+ *                         Configure(); nullptr writes the dumps to stderr.
+ * - installCrashHandlers: Dump before SIGSEGV, SIGBUS, SIGFPE, SIGILL and SIGABRT take their default action. The
+ *                         handlers run on the faulting thread's stack; a stack overflow is not dumped.
+ */
+struct FlightRecorderConfig {
+    const char* dumpPath{nullptr};
+    bool        installCrashHandlers{true};
+};
+
+namespace internal {
+
+/**********************************************************************************************************************
+ *  STRUCT: FlightRecord / FlightRing
+ *********************************************************************************************************************/
+/*!
+ * \brief  One event of a FlightRing (32 bytes).
+ *
+ * \details The fields are relaxed atomics, so that a dump racing with the owner reads a torn record instead of
+ *          causing a data race; a relaxed store is a plain store on x86_64 and aarch64.
+ */
+struct FlightRecord {
+    std::atomic<std::uint64_t> timestamp{0U};   /*!< FlightRecorder::Now() when recorded */
+    std::atomic<const char*>   tag{nullptr};    /*!< Static string describing the event */
+    std::atomic<std::uint64_t> arg0{0U};        /*!< First event argument */
+    std::atomic<std::uint64_t> arg1{0U};        /*!< Second event argument */
+};
+
+/*!
+ * \brief  Ownership state of a FlightRing.
+ */
+enum class FlightRingState : std::uint8_t {
+    kFree = 0,   /*!< Never claimed */
+    kActive,     /*!< Owned by a running thread */
+    kExited      /*!< The owner exited; kept for the dump until another thread claims it */
+};
+
+/*!
+ * \brief  Ring of one thread: overwritten in place, the newest kRecordCapacity records survive.
+ */
+struct alignas(kDestructiveInterferenceSize) FlightRing {
+    static constexpr std::size_t kRecordCapacity{256U};
+
+    std::atomic<std::uint64_t>   written{0U};                   /*!< Records written since claimed (owner) */
+    std::atomic<std::uint64_t>   threadId{0U};                  /*!< OS thread ID of the owner */
+    std::atomic<FlightRingState> state{FlightRingState::kFree};
+    FlightRecord                 records[kRecordCapacity]{};
+};
+
+static_assert((FlightRing::kRecordCapacity & (FlightRing::kRecordCapacity - 1U)) == 0U,
+              "kRecordCapacity must be a power of two");
+
+/*!
+ * \brief  Ring of the calling thread, or nullptr before its first record.
+ */
+inline thread_local FlightRing* tFlightRing{nullptr};
+
+/*!
+ * \brief  Claims a ring for the calling thread (first record of the thread).
+ *
+ * \return The ring, or the shared overflow ring (never dumped) if all FlightRecorder::kMaxThreads rings are owned by
+ *         running threads, so that the caller does not retry on every record.
+ */
+[[gnu::cold]] [[gnu::noinline]] auto ClaimFlightRing() noexcept -> FlightRing*;
+
+} // namespace internal
+
+/**********************************************************************************************************************
+ *  CLASS: FlightRecorder
+ *********************************************************************************************************************/
+/*!
+ * \brief  Always-on per-thread event recorder dumped on violations and crashes.
+ *
+ * \details
+ * - Record() is wait-free and allocation-free; threads never share a ring, so records of one thread are in order.
+ * - A thread beyond kMaxThreads running threads records into a shared overflow ring that is not dumped (counted in
+ *   GetUnassignedRecords()).
+ * - The ring of an exited thread is kept, and dumped as such, until a new thread reuses it.
+ * - Dump() prints the records of every ring oldest first with their age relative to the dump in nanoseconds: the
+ *   counter is calibrated against CLOCK_MONOTONIC between the start of the process (or Configure()) and the dump.
+ *
+ * \code
+ *   ara::core::FlightRecorder::Record("cycle begin", info.cycle, lateness_ns);
+ * \endcode
+ */
+class FlightRecorder final {
+public:
+    /*!
+     * \brief  Records kept per thread.
+     */
+    static constexpr std::size_t kRecordCapacity{internal::FlightRing::kRecordCapacity};
+
+    /*!
+     * \brief  Threads that can record at the same time.
+     */
+    static constexpr std::size_t kMaxThreads{32U};
+
+    /*!
+     * \brief  Longest line of a dump, a tag is cut to fit.
+     */
+    static constexpr std::size_t kMaxLineLength{160U};
+
+    /*!
+     * \brief  Size a dump file is preallocated to: one header line per ring plus one line per record.
+     */
+    static constexpr std::size_t kMaxDumpSize{(kMaxThreads * (kRecordCapacity + 1U) + 1U) * kMaxLineLength};
+
+    /*!
+     * \brief  Records the event \c tag with two arguments in the ring of the calling thread.
+     *
+     * \param  tag   String literal describing the event (see the file note).
+     * \param  arg0  First argument (e.g., a cycle or an ID).
+     * \param  arg1  Second argument (e.g., a duration or a value).
+     *
+     * \note   Async-signal-safe once the thread has a ring; the first call of a thread claims one.
+     */
+    static auto Record(const char* tag, std::uint64_t arg0 = 0U, std::uint64_t arg1 = 0U) noexcept -> void
+    {
+        internal::FlightRing* ring = internal::tFlightRing;
+        if (ring == nullptr) {
+            ring = internal::ClaimFlightRing();
+        }
+        std::uint64_t const index = ring->written.load(std::memory_order_relaxed);
+        internal::FlightRecord& record = ring->records[index & (kRecordCapacity - 1U)];
+        record.timestamp.store(Now(), std::memory_order_relaxed);
+        record.tag.store(tag, std::memory_order_relaxed);
+        record.arg0.store(arg0, std::memory_order_relaxed);
+        record.arg1.store(arg1, std::memory_order_relaxed);
+        ring->written.store(index + 1U, std::memory_order_release);
+    }
+
+    /*!
+     * \brief  Reads the cheapest monotonic counter of the target (not nanoseconds).
+     */
+    static auto Now() noexcept -> std::uint64_t
+    {
+#if defined(__QNXNTO__)
+        return static_cast<std::uint64_t>(ClockCycles());
+#elif defined(__x86_64__) || defined(__i386__)
+        return static_cast<std::uint64_t>(__rdtsc());
+#elif defined(__aarch64__)
+        std::uint64_t ticks{0U};
+        __asm__ __volatile__("mrs %0, cntvct_el0" : "=r"(ticks));
+        return ticks;
+#else
+        struct timespec now{};
+        static_cast<void>(::clock_gettime(CLOCK_MONOTONIC, &now));
+        return (static_cast<std::uint64_t>(now.tv_sec) * 1000000000U) + static_cast<std::uint64_t>(now.tv_nsec);
+#endif
+    }
+
+    /*!
+     * \brief  Opens and preallocates the dump file, installs the crash handlers and claims the ring of the calling
+     *         thread. Call once from main() (ara::core::Initialize() does when InitConfig::flightRecorder is set).
+     *
+     * \return FlightRecorderErrorCode::Success, DumpFileFailed (dumps go to stderr) or SignalHandlerFailed.
+     */
+    static auto Configure(const FlightRecorderConfig& config) noexcept -> FlightRecorderErrorCode;
+
+    /*!
+     * \brief  Writes the records of all rings to the dump destination.
+     *
+     * \return The number of records written.
+     *
+     * \note   Async-signal-safe. Records written while dumping may appear torn.
+     */
+    static auto Dump() noexcept -> std::size_t;
+
+    /*!
+     * \brief  Writes the records of all rings to the descriptor \c fd (e.g., for a diagnostic request).
+     *
+     * \return The number of records written.
+     *
+     * \note   Async-signal-safe.
+     */
+    static auto DumpTo(int fd) noexcept -> std::size_t;
+
+    /*!
+     * \brief  Dump() on the first call of the process, nothing afterwards. Used on the abort paths, so that a
+     *         violation followed by SIGABRT is dumped once.
+     *
+     * \note   Async-signal-safe.
+     */
+    static auto DumpOnce() noexcept -> void;
+
+    /*!
+     * \brief  Records dropped because the recording thread had no ring.
+     */
+    static auto GetUnassignedRecords() noexcept -> std::uint64_t;
+};
+
+} // namespace core
+} // namespace ara
+
+#endif // OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_CORE_FLIGHT_RECORDER_H_
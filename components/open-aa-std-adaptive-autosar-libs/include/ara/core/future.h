@@ -0,0 +1,837 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project (CXX_STANDARD 17)
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara/core/future.h
+ *  \brief      Definition of the ara::core::Future and ara::core::Promise template classes.
+ *
+ *  \details    A Promise<T, E> and its Future<T, E> share a state that holds the Result<T, E> once the Promise is
+ *              satisfied. Unlike std::promise, the shared states are not allocated: each <T, E> pair has a fixed pool
+ *              of FutureStateCapacity<T, E>::value states, taken by the Promise constructor and returned when both
+ *              sides are gone.
+ *
+ *              Future::then() registers a continuation in the state itself (up to kContinuationCapacity bytes of
+ *              callable and captures) and returns the Future of its result. The continuation runs once the state is
+ *              ready, on an execution context instead of a new thread:
+ *              - an ara::core::Executor (Submit(); the default is Executor::Instance()),
+ *              - an ara::os EventLoop (Post(); runs on the loop thread),
+ *              - or, if the context refuses the task (stopped, queue full), inline on the thread that completed the
+ *                state (or that called then(), if the state was already ready).
+ *              A continuation returning Result<U, E> completes the next Future with that result; one returning
+ *              Future<U, E> is unwrapped.
+ *
+ *  \note       Based on the Adaptive AUTOSAR SWS (e.g., R24-11) requirements, especially:
+ *              - [SWS_CORE_00321] (Definition of ara::core::Future), [SWS_CORE_00341] (ara::core::Promise)
+ *              - [SWS_CORE_00400] (future_errc), [SWS_CORE_00361] (future_status)
+ *              ara::core has no ErrorCode class yet, so E defaults to future_errc. Misuse (get() on an invalid
+ *              Future, satisfying a Promise twice, a second get_future()) is reported through the ViolationHandler.
+ *********************************************************************************************************************/
+
+#ifndef OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_CORE_FUTURE_H_
+#define OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_CORE_FUTURE_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <atomic>              // For std::atomic
+#include <chrono>              // For std::chrono::duration, std::chrono::time_point
+#include <condition_variable>  // For std::condition_variable
+#include <cstddef>             // For std::size_t, std::max_align_t
+#include <cstdint>             // For std::int32_t, std::uint32_t, std::uint64_t
+#include <mutex>               // For std::mutex, std::lock_guard, std::unique_lock
+#include <new>                 // For placement new, std::launder
+#include <optional>            // For std::optional
+#include <type_traits>         // For std::invoke_result_t, std::decay_t, std::enable_if_t
+#include <utility>             // For std::move, std::forward, std::exchange
+
+#include "ara/core/executor.h"                    // For ara::core::Executor, TaskFunction
+#include "ara/core/result.h"                      // For ara::core::Result
+#include "ara/core/internal/location_utils.h"     // For capturing file/line details
+#include "ara/core/internal/violation_handler.h"  // To trigger the violation
+
+namespace ara {
+namespace core {
+
+/**********************************************************************************************************************
+ *  ENUM: future_errc / future_status
+ *********************************************************************************************************************/
+/*!
+ * \brief  Errors of the Future / Promise state machine.
+ *
+ * \note   [SWS_CORE_00400]. Only broken_promise is stored in a Future (when E is constructible from it); the other
+ *         conditions are violations.
+ */
+enum class future_errc : std::int32_t {
+    broken_promise = 101,            /*!< The Promise was destroyed without being satisfied */
+    future_already_retrieved = 102,  /*!< get_future() was called twice */
+    promise_already_satisfied = 103, /*!< The Promise was satisfied twice */
+    no_state = 104                   /*!< The Future or Promise has no shared state */
+};
+
+/*!
+ * \brief  Result of Future::wait_for() and Future::wait_until().
+ *
+ * \note   [SWS_CORE_00361]
+ */
+enum class future_status : std::uint8_t {
+    ready = 1,  /*!< The shared state is ready */
+    timeout     /*!< The timeout elapsed first */
+};
+
+/**********************************************************************************************************************
+ *  STRUCT: FutureStateCapacity
+ *********************************************************************************************************************/
+/*!
+ * \brief  Number of shared states in the pool of Future<T, E> / Promise<T, E>; specialize it to size one pool:
+ *
+ *              template <>
+ *              struct ara::core::FutureStateCapacity<Response, ara::core::future_errc> {
+ *                  static constexpr std::size_t value{256U};
+ *              };
+ *
+ * \note   A Promise constructed while all states are in use is a violation. The specialization must be visible
+ *         before the first use of the pair.
+ */
+template <typename T, typename E>
+struct FutureStateCapacity {
+    static constexpr std::size_t value{64U};
+};
+
+template <typename T, typename E = future_errc>
+class Future;
+
+template <typename T, typename E = future_errc>
+class Promise;
+
+namespace internal {
+
+/*!
+ * \brief  Size of the in-place storage of a continuation (callable with captures, plus the next Promise).
+ */
+constexpr std::size_t kContinuationCapacity{64U};
+
+/*!
+ * \brief  Task type of an EventLoop::Post() compatible context.
+ */
+using PostedTask = void (*)(void* context) noexcept;
+
+/**********************************************************************************************************************
+ *  SECTION: Execution context traits
+ *********************************************************************************************************************/
+/*!
+ * \brief  Trait: Context has Submit(TaskFunction, void*) returning bool (ara::core::Executor).
+ */
+template <typename Context, typename = void>
+struct HasSubmit : std::false_type {};
+
+template <typename Context>
+struct HasSubmit<Context, std::enable_if_t<std::is_same_v<
+                              decltype(std::declval<Context&>().Submit(std::declval<TaskFunction>(),
+                                                                       std::declval<void*>())),
+                              bool>>> : std::true_type {};
+
+/*!
+ * \brief  Trait: Context has Post(void (*)(void*) noexcept, void*) returning bool (ara::os EventLoop).
+ */
+template <typename Context, typename = void>
+struct HasPost : std::false_type {};
+
+template <typename Context>
+struct HasPost<Context, std::enable_if_t<std::is_same_v<
+                            decltype(std::declval<Context&>().Post(std::declval<PostedTask>(),
+                                                                   std::declval<void*>())),
+                            bool>>> : std::true_type {};
+
+/**********************************************************************************************************************
+ *  CLASS: FutureState
+ *********************************************************************************************************************/
+/*!
+ * \brief  Shared state of a Promise<T, E> and its Future, taken from FutureStatePool<T, E>.
+ *
+ * \details
+ * - References: the Promise, the Future and a registered continuation each hold one; the last Release() resets the
+ *   state and returns it to the pool.
+ * - The mutex orders the completion against the registration of the continuation, so exactly one of the two
+ *   schedules it; IsReady() is a lock-free load.
+ */
+template <typename T, typename E>
+class FutureState final {
+public:
+    using ResultType = Result<T, E>;
+
+    /*!
+     * \brief  Runs the stored continuation of \c state (moves it out of the storage first).
+     */
+    using Invoker = void (*)(FutureState* state) noexcept;
+
+    /*!
+     * \brief  Hands the continuation of \c state to \c context; \c false if the context refused it.
+     */
+    using Scheduler = bool (*)(void* context, FutureState* state) noexcept;
+
+    auto AddReference() noexcept -> void { static_cast<void>(references_.fetch_add(1U, std::memory_order_relaxed)); }
+
+    /*!
+     * \brief  Drops one reference; the last one returns the state to its pool.
+     */
+    auto Release() noexcept -> void;
+
+    /*!
+     * \brief  Marks the Future as handed out; \c false if it already was.
+     */
+    auto MarkRetrieved() noexcept -> bool { return !retrieved_.exchange(true, std::memory_order_relaxed); }
+
+    auto IsReady() const noexcept -> bool { return ready_.load(std::memory_order_acquire); }
+
+    /*!
+     * \brief  Stores \c result, wakes the waiters and schedules the continuation.
+     *
+     * \return \c false if the state was already ready.
+     */
+    auto SetResult(ResultType&& result) noexcept -> bool
+    {
+        bool continuation{false};
+        {
+            std::lock_guard<std::mutex> lock{mutex_};
+            if (ready_.load(std::memory_order_relaxed)) {
+                return false;
+            }
+            result_.emplace(std::move(result));
+            ready_.store(true, std::memory_order_release);
+            continuation = (invoker_ != nullptr);
+        }
+        readyCondition_.notify_all();
+        if (continuation) {
+            Schedule();
+        }
+        return true;
+    }
+
+    /*!
+     * \brief  Completes the state of a Promise destroyed unsatisfied: with future_errc::broken_promise if E can hold
+     *         it, otherwise without a result (reading it is then a violation).
+     */
+    auto SetBroken() noexcept -> void
+    {
+        if constexpr (std::is_constructible_v<E, future_errc>) {
+            static_cast<void>(SetResult(ResultType::FromError(future_errc::broken_promise)));
+        } else {
+            bool continuation{false};
+            {
+                std::lock_guard<std::mutex> lock{mutex_};
+                if (ready_.load(std::memory_order_relaxed)) {
+                    return;
+                }
+                broken_ = true;
+                ready_.store(true, std::memory_order_release);
+                continuation = (invoker_ != nullptr);
+            }
+            readyCondition_.notify_all();
+            if (continuation) {
+                Schedule();
+            }
+        }
+    }
+
+    auto Wait() noexcept -> void
+    {
+        if (!IsReady()) {
+            std::unique_lock<std::mutex> lock{mutex_};
+            readyCondition_.wait(lock, [this]() noexcept { return ready_.load(std::memory_order_relaxed); });
+        }
+    }
+
+    /*!
+     * \return \c true if the state became ready before \c deadline.
+     */
+    template <typename Clock, typename Duration>
+    auto WaitUntil(const std::chrono::time_point<Clock, Duration>& deadline) noexcept -> bool
+    {
+        if (IsReady()) {
+            return true;
+        }
+        std::unique_lock<std::mutex> lock{mutex_};
+        return readyCondition_.wait_until(lock, deadline,
+                                          [this]() noexcept { return ready_.load(std::memory_order_relaxed); });
+    }
+
+    /*!
+     * \brief  Waits for the result and moves it out.
+     */
+    auto TakeResult() noexcept -> ResultType
+    {
+        Wait();
+        if (broken_ || !result_.has_value()) {
+            ara::core::internal::ReportInvalidState(ARA_CORE_INTERNAL_FILELINE, "Future of a broken Promise");
+        }
+        ResultType result{std::move(*result_)};
+        result_.reset();
+        return result;
+    }
+
+    /*!
+     * \brief  Stores \c continuation (a callable taking FutureState*) and schedules it on \c context with
+     *         \c scheduler (nullptr: inline) once the state is ready.
+     */
+    template <typename Callable>
+    auto SetContinuation(Callable&& continuation, Scheduler scheduler, void* context) noexcept -> void
+    {
+        using Stored = std::decay_t<Callable>;
+        static_assert(sizeof(Stored) <= kContinuationCapacity,
+                      "ara::core::Future::then(): the continuation exceeds kContinuationCapacity bytes; capture "
+                      "less or capture by pointer");
+        static_assert(alignof(Stored) <= alignof(std::max_align_t),
+                      "ara::core::Future::then(): over-aligned continuation");
+
+        bool ready{false};
+        {
+            std::lock_guard<std::mutex> lock{mutex_};
+            ::new (static_cast<void*>(continuation_)) Stored(std::forward<Callable>(continuation));
+            invoker_   = &InvokeStored<Stored>;
+            scheduler_ = scheduler;
+            context_   = context;
+            ready = ready_.load(std::memory_order_relaxed);
+        }
+        if (ready) {
+            Schedule();
+        }
+    }
+
+    /*!
+     * \brief  Scheduler for Context: Submit() on an Executor, Post() on an EventLoop.
+     */
+    template <typename Context>
+    static auto ScheduleOn(void* context, FutureState* state) noexcept -> bool
+    {
+        Context& target = *static_cast<Context*>(context);
+        if constexpr (HasSubmit<Context>::value) {
+            return target.Submit(&RunSubmitted, state);
+        } else {
+            static_assert(HasPost<Context>::value,
+                          "ara::core::Future::then(): the context needs Submit(TaskFunction, void*) or "
+                          "Post(void (*)(void*) noexcept, void*)");
+            return target.Post(&RunPosted, state);
+        }
+    }
+
+private:
+    template <typename Stored>
+    static auto InvokeStored(FutureState* state) noexcept -> void
+    {
+        Stored* const stored = std::launder(reinterpret_cast<Stored*>(state->continuation_));
+        Stored continuation{std::move(*stored)};
+        stored->~Stored();
+        continuation(state);  // May release the state
+    }
+
+    static auto RunSubmitted(void* state, std::size_t, std::size_t) noexcept -> void
+    {
+        static_cast<FutureState*>(state)->RunContinuation();
+    }
+
+    static auto RunPosted(void* state) noexcept -> void
+    {
+        static_cast<FutureState*>(state)->RunContinuation();
+    }
+
+    auto Schedule() noexcept -> void
+    {
+        if ((scheduler_ == nullptr) || !scheduler_(context_, this)) {
+            RunContinuation();
+        }
+    }
+
+    auto RunContinuation() noexcept -> void
+    {
+        Invoker const invoker = std::exchange(invoker_, nullptr);
+        invoker(this);
+    }
+
+    template <typename, typename>
+    friend class FutureStatePool;
+
+    std::mutex                  mutex_{};
+    std::condition_variable     readyCondition_{};
+    std::atomic<bool>           ready_{false};
+    std::atomic<bool>           retrieved_{false};
+    bool                        broken_{false};
+    std::optional<ResultType>   result_{};
+    std::atomic<std::uint32_t>  references_{0U};
+    std::atomic<std::uint32_t>  nextFree_{0U};
+    Invoker                     invoker_{nullptr};
+    Scheduler                   scheduler_{nullptr};
+    void*                       context_{nullptr};
+    alignas(std::max_align_t) unsigned char continuation_[kContinuationCapacity]{};
+};
+
+/**********************************************************************************************************************
+ *  CLASS: FutureStatePool
+ *********************************************************************************************************************/
+/*!
+ * \brief  Fixed pool of the shared states of Future<T, E>, with a lock-free free list.
+ *
+ * \details The free list is a stack of indices (1-based, 0 ends it) whose head carries a generation counter in its
+ *          upper 32 bits, so a state taken and returned between a load and the compare-and-swap cannot be mistaken
+ *          for the same head (ABA).
+ */
+template <typename T, typename E>
+class FutureStatePool final {
+public:
+    static constexpr std::size_t kCapacity{FutureStateCapacity<T, E>::value};
+    static_assert((kCapacity > 0U) && (kCapacity < 0xFFFFFFFFU), "ara::core::FutureStateCapacity out of range");
+
+    static auto Instance() noexcept -> FutureStatePool&
+    {
+        static FutureStatePool pool{};
+        return pool;
+    }
+
+    /*!
+     * \brief  Takes a state with one reference, or nullptr if all are in use.
+     */
+    auto Allocate() noexcept -> FutureState<T, E>*
+    {
+        std::uint64_t head = head_.load(std::memory_order_acquire);
+        for (;;) {
+            std::uint32_t const index = static_cast<std::uint32_t>(head);
+            if (index == 0U) {
+                return nullptr;
+            }
+            FutureState<T, E>& state = states_[index - 1U];
+            std::uint64_t const next = NextGeneration(head) | state.nextFree_.load(std::memory_order_relaxed);
+            if (head_.compare_exchange_weak(head, next, std::memory_order_acquire, std::memory_order_acquire)) {
+                static_cast<void>(available_.fetch_sub(1U, std::memory_order_relaxed));
+                state.references_.store(1U, std::memory_order_relaxed);
+                return &state;
+            }
+        }
+    }
+
+    /*!
+     * \brief  Returns \c state (reset by its last Release()) to the free list.
+     */
+    auto Free(FutureState<T, E>* state) noexcept -> void
+    {
+        std::uint32_t const index = static_cast<std::uint32_t>(state - states_) + 1U;
+        std::uint64_t head = head_.load(std::memory_order_relaxed);
+        do {
+            state->nextFree_.store(static_cast<std::uint32_t>(head), std::memory_order_relaxed);
+        } while (!head_.compare_exchange_weak(head, NextGeneration(head) | index, std::memory_order_release,
+                                              std::memory_order_relaxed));
+        static_cast<void>(available_.fetch_add(1U, std::memory_order_relaxed));
+    }
+
+    /*!
+     * \brief  Number of free states (a snapshot).
+     */
+    auto GetAvailable() const noexcept -> std::size_t { return available_.load(std::memory_order_relaxed); }
+
+private:
+    FutureStatePool() noexcept
+    {
+        for (std::size_t i = 0U; i < kCapacity; ++i) {
+            states_[i].nextFree_.store((i + 1U < kCapacity) ? static_cast<std::uint32_t>(i + 2U) : 0U,
+                                       std::memory_order_relaxed);
+        }
+        head_.store(1U, std::memory_order_release);
+    }
+
+    static constexpr auto NextGeneration(std::uint64_t head) noexcept -> std::uint64_t
+    {
+        return ((head >> 32U) + 1U) << 32U;
+    }
+
+    FutureState<T, E>           states_[kCapacity]{};
+    alignas(kCacheLineSize) std::atomic<std::uint64_t> head_{0U};
+    std::atomic<std::size_t>    available_{kCapacity};
+};
+
+template <typename T, typename E>
+auto FutureState<T, E>::Release() noexcept -> void
+{
+    if (references_.fetch_sub(1U, std::memory_order_acq_rel) == 1U) {
+        result_.reset();
+        broken_ = false;
+        invoker_ = nullptr;
+        scheduler_ = nullptr;
+        context_ = nullptr;
+        retrieved_.store(false, std::memory_order_relaxed);
+        ready_.store(false, std::memory_order_relaxed);
+        FutureStatePool<T, E>::Instance().Free(this);
+    }
+}
+
+/**********************************************************************************************************************
+ *  SECTION: Continuation helpers
+ *********************************************************************************************************************/
+/*!
+ * \brief  Value type of the Future returned by then() for a continuation returning R.
+ */
+template <typename R, typename E>
+struct ContinuationValue {
+    using type = R;
+};
+
+template <typename U, typename E>
+struct ContinuationValue<Result<U, E>, E> {
+    using type = U;
+};
+
+template <typename U, typename E>
+struct ContinuationValue<Future<U, E>, E> {
+    using type = U;
+};
+
+template <typename R>
+struct IsFuture : std::false_type {};
+
+template <typename U, typename E>
+struct IsFuture<Future<U, E>> : std::true_type {};
+
+template <typename R>
+struct IsResult : std::false_type {};
+
+template <typename U, typename E>
+struct IsResult<Result<U, E>> : std::true_type {};
+
+/*!
+ * \brief  Access to the private state of Future and Promise for the continuations.
+ */
+struct FutureAccess {
+    template <typename T, typename E>
+    static auto Adopt(FutureState<T, E>* state) noexcept -> Future<T, E>
+    {
+        return Future<T, E>{state};
+    }
+
+    template <typename T, typename E, typename Callable>
+    static auto Attach(Future<T, E>&& future, Callable&& continuation,
+                       typename FutureState<T, E>::Scheduler scheduler, void* context) noexcept -> void
+    {
+        FutureState<T, E>* const state = future.Detach();
+        state->SetContinuation(std::forward<Callable>(continuation), scheduler, context);
+    }
+};
+
+/*!
+ * \brief  Forwards the result of an inner Future to the Promise of the unwrapped one.
+ */
+template <typename U, typename E>
+struct ForwardResult {
+    Promise<U, E> promise;
+
+    auto operator()(FutureState<U, E>* state) noexcept -> void
+    {
+        Future<U, E> inner = FutureAccess::Adopt(state);
+        promise.SetResult(inner.GetResult());
+    }
+};
+
+/*!
+ * \brief  Continuation of then(): invokes \c function with the ready Future and completes \c promise with what it
+ *         returns.
+ */
+template <typename T, typename E, typename F>
+struct Continuation {
+    using ReturnType = std::invoke_result_t<F&, Future<T, E>>;
+    using ValueType  = typename ContinuationValue<ReturnType, E>::type;
+
+    F                   function;
+    Promise<ValueType, E> promise;
+
+    auto operator()(FutureState<T, E>* state) noexcept -> void
+    {
+        Future<T, E> source = FutureAccess::Adopt(state);
+        if constexpr (std::is_void_v<ReturnType>) {
+            function(std::move(source));
+            promise.set_value();
+        } else if constexpr (IsResult<ReturnType>::value) {
+            promise.SetResult(function(std::move(source)));
+        } else if constexpr (IsFuture<ReturnType>::value) {
+            ReturnType inner = function(std::move(source));
+            FutureAccess::Attach(std::move(inner), ForwardResult<ValueType, E>{std::move(promise)}, nullptr, nullptr);
+        } else {
+            promise.set_value(function(std::move(source)));
+        }
+    }
+};
+
+} // namespace internal
+
+/**********************************************************************************************************************
+ *  CLASS: Future
+ *********************************************************************************************************************/
+/*!
+ * \brief  Receiving side of an asynchronous Result<T, E>.
+ *
+ * \details Move-only. GetResult(), get() and then() consume the Future: valid() is \c false afterwards.
+ *
+ * \note   [SWS_CORE_00321]
+ */
+template <typename T, typename E>
+class Future final {
+public:
+    using ValueType = T;
+    using ErrorType = E;
+
+    /*!
+     * \brief  A Future without shared state (valid() is false).
+     */
+    Future() noexcept = default;
+
+    Future(const Future&) = delete;
+    auto operator=(const Future&) -> Future& = delete;
+
+    Future(Future&& other) noexcept : state_{std::exchange(other.state_, nullptr)} {}
+
+    auto operator=(Future&& other) noexcept -> Future&
+    {
+        if (this != &other) {
+            Reset();
+            state_ = std::exchange(other.state_, nullptr);
+        }
+        return *this;
+    }
+
+    ~Future() noexcept { Reset(); }
+
+    /*!
+     * \brief  Whether the Future has a shared state.
+     */
+    auto valid() const noexcept -> bool { return state_ != nullptr; }
+
+    /*!
+     * \brief  Whether the result is available (get() would not block).
+     */
+    auto is_ready() const noexcept -> bool { return (state_ != nullptr) && state_->IsReady(); }
+
+    /*!
+     * \brief  Blocks until the result is available.
+     */
+    auto wait() const noexcept -> void
+    {
+        CheckState();
+        state_->Wait();
+    }
+
+    /*!
+     * \brief  Blocks until the result is available or \c timeout elapsed.
+     */
+    template <typename Rep, typename Period>
+    auto wait_for(const std::chrono::duration<Rep, Period>& timeout) const noexcept -> future_status
+    {
+        return wait_until(std::chrono::steady_clock::now() + timeout);
+    }
+
+    /*!
+     * \brief  Blocks until the result is available or \c deadline is reached.
+     */
+    template <typename Clock, typename Duration>
+    auto wait_until(const std::chrono::time_point<Clock, Duration>& deadline) const noexcept -> future_status
+    {
+        CheckState();
+        return state_->WaitUntil(deadline) ? future_status::ready : future_status::timeout;
+    }
+
+    /*!
+     * \brief  Waits for and returns the result; the Future is invalid afterwards.
+     *
+     * \note   [SWS_CORE_00336]
+     */
+    auto GetResult() noexcept -> Result<T, E>
+    {
+        CheckState();
+        Result<T, E> result = state_->TakeResult();
+        Reset();
+        return result;
+    }
+
+    /*!
+     * \brief  Waits for and returns the value; an error result is a violation (no exceptions).
+     */
+    auto get() noexcept -> T
+    {
+        if constexpr (std::is_void_v<T>) {
+            GetResult().Value();
+        } else {
+            return GetResult().Value();
+        }
+    }
+
+    /*!
+     * \brief  Runs \c function(Future<T, E>) on Executor::Instance() once the result is available.
+     *
+     * \return The Future of what \c function returns (Result<U, E> and Future<U, E> are unwrapped to U).
+     */
+    template <typename F>
+    auto then(F&& function) noexcept
+    {
+        return then(std::forward<F>(function), Executor::Instance());
+    }
+
+    /*!
+     * \brief  Runs \c function(Future<T, E>) on \c context (an Executor or an EventLoop) once the result is
+     *         available; inline if the context refuses the task.
+     */
+    template <typename F, typename Context>
+    auto then(F&& function, Context& context) noexcept
+    {
+        using Stored = internal::Continuation<T, E, std::decay_t<F>>;
+        CheckState();
+
+        Promise<typename Stored::ValueType, E> promise{};
+        auto next = promise.get_future();
+        internal::FutureAccess::Attach(std::move(*this), Stored{std::forward<F>(function), std::move(promise)},
+                                       &internal::FutureState<T, E>::template ScheduleOn<Context>, &context);
+        return next;
+    }
+
+private:
+    explicit Future(internal::FutureState<T, E>* state) noexcept : state_{state} {}
+
+    auto Detach() noexcept -> internal::FutureState<T, E>* { return std::exchange(state_, nullptr); }
+
+    auto CheckState() const noexcept -> void
+    {
+        if (state_ == nullptr) {
+            ara::core::internal::ReportInvalidState(ARA_CORE_INTERNAL_FILELINE, "Future without shared state");
+        }
+    }
+
+    auto Reset() noexcept -> void
+    {
+        if (state_ != nullptr) {
+            std::exchange(state_, nullptr)->Release();
+        }
+    }
+
+    friend struct internal::FutureAccess;
+
+    internal::FutureState<T, E>* state_{nullptr};
+};
+
+/**********************************************************************************************************************
+ *  CLASS: Promise
+ *********************************************************************************************************************/
+/*!
+ * \brief  Producing side of an asynchronous Result<T, E>.
+ *
+ * \details Move-only. The constructor takes a shared state from the pool of <T, E> (a violation if none is free);
+ *          destroying an unsatisfied Promise completes its Future with future_errc::broken_promise.
+ *
+ * \note   [SWS_CORE_00341]
+ */
+template <typename T, typename E>
+class Promise final {
+public:
+    using Pool = internal::FutureStatePool<T, E>;
+
+    Promise() noexcept : state_{Pool::Instance().Allocate()}
+    {
+        if (state_ == nullptr) {
+            ara::core::internal::ReportCapacityExceeded(ARA_CORE_INTERNAL_FILELINE, Pool::kCapacity + 1U,
+                                                        Pool::kCapacity);
+        }
+    }
+
+    Promise(const Promise&) = delete;
+    auto operator=(const Promise&) -> Promise& = delete;
+
+    Promise(Promise&& other) noexcept : state_{std::exchange(other.state_, nullptr)} {}
+
+    auto operator=(Promise&& other) noexcept -> Promise&
+    {
+        if (this != &other) {
+            Abandon();
+            state_ = std::exchange(other.state_, nullptr);
+        }
+        return *this;
+    }
+
+    ~Promise() noexcept { Abandon(); }
+
+    /*!
+     * \brief  Returns the Future of this Promise; a second call is a violation.
+     */
+    auto get_future() noexcept -> Future<T, E>
+    {
+        CheckState();
+        if (!state_->MarkRetrieved()) {
+            ara::core::internal::ReportInvalidState(ARA_CORE_INTERNAL_FILELINE, "Promise::get_future() called twice");
+        }
+        state_->AddReference();
+        return internal::FutureAccess::Adopt(state_);
+    }
+
+    /*!
+     * \brief  Satisfies the Promise with a value (set_value() without argument for T = void).
+     */
+    template <typename U = T>
+    auto set_value(const std::enable_if_t<!std::is_void_v<U>, U>& value) noexcept -> void
+    {
+        Complete(Result<T, E>{value});
+    }
+
+    template <typename U = T>
+    auto set_value(std::enable_if_t<!std::is_void_v<U>, U>&& value) noexcept -> void
+    {
+        Complete(Result<T, E>{std::move(value)});
+    }
+
+    template <typename U = T, typename = std::enable_if_t<std::is_void_v<U>>>
+    auto set_value() noexcept -> void
+    {
+        Complete(Result<T, E>{});
+    }
+
+    /*!
+     * \brief  Satisfies the Promise with an error.
+     */
+    auto SetError(const E& error) noexcept -> void { Complete(Result<T, E>{error}); }
+    auto SetError(E&& error) noexcept -> void { Complete(Result<T, E>{std::move(error)}); }
+
+    /*!
+     * \brief  Satisfies the Promise with \c result.
+     */
+    auto SetResult(Result<T, E>&& result) noexcept -> void { Complete(std::move(result)); }
+    auto SetResult(const Result<T, E>& result) noexcept -> void { Complete(Result<T, E>{result}); }
+
+private:
+    auto CheckState() const noexcept -> void
+    {
+        if (state_ == nullptr) {
+            ara::core::internal::ReportInvalidState(ARA_CORE_INTERNAL_FILELINE, "Promise without shared state");
+        }
+    }
+
+    auto Complete(Result<T, E>&& result) noexcept -> void
+    {
+        CheckState();
+        if (!state_->SetResult(std::move(result))) {
+            ara::core::internal::ReportInvalidState(ARA_CORE_INTERNAL_FILELINE, "Promise already satisfied");
+        }
+    }
+
+    auto Abandon() noexcept -> void
+    {
+        if (state_ != nullptr) {
+            internal::FutureState<T, E>* const state = std::exchange(state_, nullptr);
+            if (!state->IsReady()) {
+                state->SetBroken();
+            }
+            state->Release();
+        }
+    }
+
+    internal::FutureState<T, E>* state_{nullptr};
+};
+
+} // namespace core
+} // namespace ara
+
+#endif // OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_CORE_FUTURE_H_
@@ -0,0 +1,233 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project (CXX_STANDARD 17)
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara/core/huge_page_arena.h
+ *  \brief      Huge-page backed, NUMA-aware bump arena for the large fixed buffers of a process.
+ *
+ *  \details    A HugePageArena maps one region of 2 MiB or 1 GiB pages at startup, bound to a selected NUMA node and
+ *              pre-faulted, and hands out aligned storage from it:
+ *              - to ara::core::Vector through PolymorphicAllocator (it is a MemoryResource),
+ *              - to fixed containers (ara::core::Array, InplaceVector, MdArray) through New<T>().
+ *              Large sweeps over these buffers then need one TLB entry per huge page instead of one per 4 KiB page,
+ *              and the first cycles take no page fault.
+ *
+ *              Platforms:
+ *              - Linux: anonymous MAP_HUGETLB mapping of the requested page size (the pages must be reserved, e.g.
+ *                       vm.nr_hugepages); the node is applied with set_mempolicy() while the pages are faulted and
+ *                       with mbind() for the region. Without free huge pages the arena can fall back to base pages,
+ *                       2 MiB aligned and advised for transparent huge pages.
+ *              - QNX:   physically contiguous memory (MAP_PHYS), or the typed memory pool named in the configuration,
+ *                       which the kernel maps with large pages; the memory (and thus the node) is selected by the
+ *                       typed memory name.
+ *
+ *              ara::core::Initialize() maps the arenas listed in InitConfig::hugePageArenas.
+ *
+ *  \note       [SWS_CORE_00040] (No exceptions used – failures are reported by HugePageErrorCode, exhaustion by a
+ *              nullptr from allocate() / New()).
+ *********************************************************************************************************************/
+
+#ifndef OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_CORE_HUGE_PAGE_ARENA_H_
+#define OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_CORE_HUGE_PAGE_ARENA_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <cstddef>       // For std::size_t
+#include <cstdint>       // For std::int32_t, std::uint8_t
+#include <new>           // For placement new
+#include <type_traits>   // For std::is_nothrow_constructible_v, std::is_trivially_destructible_v
+#include <utility>       // For std::forward
+
+#include "ara/core/interference_size.h"  // For ara::core::kDestructiveInterferenceSize
+#include "ara/core/memory_resource.h"    // For ara::core::pmr::MemoryResource
+
+namespace ara {
+namespace core {
+namespace pmr {
+
+/**********************************************************************************************************************
+ *  CONSTANTS
+ *********************************************************************************************************************/
+/*!
+ * \brief  HugePageArenaConfig::numaNode value that leaves the placement to the memory policy of the calling thread.
+ */
+constexpr std::int32_t kAnyNumaNode{-1};
+
+/**********************************************************************************************************************
+ *  ENUM: HugePageSize
+ *********************************************************************************************************************/
+/*!
+ * \brief  Size of the huge pages backing a HugePageArena.
+ */
+enum class HugePageSize : std::uint8_t {
+    Huge2MiB = 0,   /*!< 2 MiB pages (x86_64 and aarch64 with 4 KiB base pages) */
+    Huge1GiB        /*!< 1 GiB pages */
+};
+
+/*!
+ * \brief  Returns the size of a \c size page in bytes.
+ */
+constexpr auto GetHugePageBytes(HugePageSize size) noexcept -> std::size_t
+{
+    return (size == HugePageSize::Huge1GiB) ? (std::size_t{1U} << 30U) : (std::size_t{1U} << 21U);
+}
+
+/**********************************************************************************************************************
+ *  ENUM: HugePageErrorCode
+ *********************************************************************************************************************/
+/*!
+ * \brief  Result of HugePageArena::Map().
+ */
+enum class HugePageErrorCode : std::uint8_t {
+    Success = 0,            /*!< The region is mapped (see IsHugePageBacked() for the page size) */
+    InvalidArgument,        /*!< Capacity 0 or too large, or an option the platform does not support */
+    AlreadyMapped,          /*!< Map() was called on a mapped arena */
+    HugePagesUnavailable,   /*!< Not enough free huge pages of the requested size and allowSmallPages is not set */
+    NodeUnavailable,        /*!< The NUMA node does not exist or has no memory */
+    ResourceFailure         /*!< The region could not be mapped at all */
+};
+
+/**********************************************************************************************************************
+ *  STRUCT: HugePageArenaConfig
+ *********************************************************************************************************************/
+/*!
+ * \brief  Configuration of a HugePageArena.
+ *
+ * \details
+ * - capacity:         Bytes requested; rounded up to a whole number of huge pages.
+ * - pageSize:         Size of the huge pages.
+ * - numaNode:         Node the pages are placed on (kAnyNumaNode: no binding). Linux only; on QNX select the memory
+ *                     with typedMemory.
+ * - allowSmallPages:  Map base pages (advised for transparent huge pages on Linux) when no huge page is free, instead
+ *                     of failing with HugePagesUnavailable.
+ * - prefault:         Touch every page while mapping, so that the first cycles take no page fault.
+ * - typedMemory:      QNX only: typed memory pool to allocate from (e.g., "/memory/ram/sysram"); must be nullptr on
+ *                     other platforms.
+ */
+struct HugePageArenaConfig {
+    std::size_t  capacity{0U};
+    HugePageSize pageSize{HugePageSize::Huge2MiB};
+    std::int32_t numaNode{kAnyNumaNode};
+    bool         allowSmallPages{true};
+    bool         prefault{true};
+    const char*  typedMemory{nullptr};
+};
+
+/**********************************************************************************************************************
+ *  CLASS: HugePageArena
+ *********************************************************************************************************************/
+/*!
+ * \brief  Fixed-capacity bump arena over a huge-page mapping created by Map().
+ *
+ * \details
+ * - Construction only stores the configuration; Map() (usually called by ara::core::Initialize()) creates the
+ *   mapping, Unmap() or the destructor removes it. Before Map() every allocation fails.
+ * - deallocate() is a no-op; reset() makes the whole capacity available again. The arena never runs destructors,
+ *   so New() only places trivially destructible objects.
+ * - Not thread-safe: fill it during initialization, or from one thread.
+ */
+class HugePageArena final : public MemoryResource {
+public:
+    /*!
+     * \brief  Stores \c config; nothing is mapped yet.
+     */
+    explicit HugePageArena(const HugePageArenaConfig& config) noexcept
+        : config_{config}
+    {
+    }
+
+    HugePageArena(const HugePageArena&) = delete;
+    auto operator=(const HugePageArena&) -> HugePageArena& = delete;
+
+    /*!
+     * \brief  Unmaps the region. All storage handed out becomes invalid.
+     */
+    ~HugePageArena() override;
+
+    /*!
+     * \brief  Maps the region described by the configuration, binds it to its node and pre-faults it.
+     *
+     * \return HugePageErrorCode::Success, InvalidArgument, AlreadyMapped, HugePagesUnavailable, NodeUnavailable or
+     *         ResourceFailure. On a failure nothing is mapped.
+     */
+    auto Map() noexcept -> HugePageErrorCode;
+
+    /*!
+     * \brief  Unmaps the region (no effect if nothing is mapped). All storage handed out becomes invalid.
+     */
+    auto Unmap() noexcept -> void;
+
+    /*!
+     * \brief  Constructs a T from \c args in the arena, aligned to at least kDestructiveInterferenceSize.
+     *
+     * \return The object, or nullptr if the arena is not mapped or exhausted.
+     */
+    template <typename T, typename... Args>
+    auto New(Args&&... args) noexcept -> T*
+    {
+        static_assert(std::is_nothrow_constructible_v<T, Args...>,
+                      "ara::core::pmr::HugePageArena::New requires a noexcept constructor");
+        static_assert(std::is_trivially_destructible_v<T>,
+                      "ara::core::pmr::HugePageArena::New requires a trivially destructible T (the arena never runs "
+                      "destructors)");
+        constexpr std::size_t kAlignment =
+            (alignof(T) > kDestructiveInterferenceSize) ? alignof(T) : kDestructiveInterferenceSize;
+        void* const storage = allocate(sizeof(T), kAlignment);
+        return (storage != nullptr) ? ::new (storage) T(std::forward<Args>(args)...) : nullptr;
+    }
+
+    /*! \brief Makes the whole capacity available again. All previously returned storage becomes invalid. */
+    auto reset() noexcept -> void
+    {
+        used_ = 0U;
+    }
+
+    /*! \brief The configuration given at construction. */
+    auto GetConfig() const noexcept -> const HugePageArenaConfig& { return config_; }
+
+    /*! \brief Whether Map() succeeded and Unmap() was not called since. */
+    auto IsMapped() const noexcept -> bool { return buffer_ != nullptr; }
+
+    /*! \brief Whether the region is backed by huge pages of the configured size (false: base pages). */
+    auto IsHugePageBacked() const noexcept -> bool { return hugePages_; }
+
+    /*! \brief Size of the pages backing the region (0 if not mapped). */
+    auto GetPageSize() const noexcept -> std::size_t { return pageSize_; }
+
+    /*! \brief Start of the region (nullptr if not mapped). */
+    auto GetData() const noexcept -> void* { return buffer_; }
+
+    /*! \brief Size of the region in bytes (0 if not mapped). */
+    auto capacity() const noexcept -> std::size_t { return capacity_; }
+
+    /*! \brief Bytes currently handed out. */
+    auto used() const noexcept -> std::size_t { return used_; }
+
+    /*! \brief Highest value used() has reached since Map(). */
+    auto highWaterMark() const noexcept -> std::size_t { return highWaterMark_; }
+
+private:
+    auto do_allocate(std::size_t bytes, std::size_t alignment) noexcept -> void* override;
+    auto do_deallocate(void* p, std::size_t bytes, std::size_t alignment) noexcept -> void override;
+    auto do_is_equal(const MemoryResource& other) const noexcept -> bool override;
+
+    HugePageArenaConfig config_;
+    char*               buffer_{nullptr};
+    std::size_t         capacity_{0U};
+    std::size_t         used_{0U};
+    std::size_t         highWaterMark_{0U};
+    std::size_t         pageSize_{0U};
+    bool                hugePages_{false};
+};
+
+} // namespace pmr
+} // namespace core
+} // namespace ara
+
+#endif // OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_CORE_HUGE_PAGE_ARENA_H_
@@ -0,0 +1,170 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project (CXX_STANDARD 17)
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara/core/initialization.h
+ *  \brief      Declaration of ara::core::Initialize() and ara::core::Deinitialize().
+ *
+ *  \details    Initialize() moves the one-time costs of the process to a single, measured point at startup, before the
+ *              first cycle runs:
+ *              1. Memory lock:       mlockall(MCL_CURRENT | MCL_FUTURE). Mappings created later (heap growth, the
+ *                                    stacks of threads created afterwards) are populated when they are mapped.
+ *              2. Stacks:            bounds the default stack size of threads created afterwards (so that locking
+ *                                    their stacks stays affordable) and touches the stack of the calling thread.
+ *              3. Singletons:        constructs the ViolationHandler (with the cached process identifier), the
+ *                                    LogBackend and the global memory resources, and configures the
+ *                                    FlightRecorder (optional).
+ *              4. Memory resources:  installs the default resource, maps the huge-page arenas (on their NUMA
+ *                                    nodes) and pre-faults the given arenas.
+ *              5. Log backend:       starts the LogBackend thread (optional).
+ *              6. Executor:          starts the pinned workers of Executor::Instance() (optional), after the memory
+ *                                    lock and the default stack size apply to them.
+ *              The duration of each phase is kept in an InitializationReport and logged once.
+ *
+ *  \note       Based on [SWS_CORE_10001] (Initialize) and [SWS_CORE_10002] (Deinitialize). ara::core has no Result
+ *              type yet, so both report an InitErrorCode; the configuration parameter is an OpenAA extension.
+ *********************************************************************************************************************/
+
+#ifndef OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_CORE_INITIALIZATION_H_
+#define OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_CORE_INITIALIZATION_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <chrono>        // For std::chrono::nanoseconds
+#include <cstddef>       // For std::size_t
+#include <cstdint>       // For std::uint8_t
+
+#include "ara/core/executor.h"         // For ara::core::ExecutorConfig
+#include "ara/core/flight_recorder.h"  // For ara::core::FlightRecorderConfig
+#include "ara/core/huge_page_arena.h"  // For ara::core::pmr::HugePageArena
+#include "ara/core/memory_resource.h"  // For ara::core::pmr::MemoryResource, ArenaResource
+#include "ara/core/span.h"             // For ara::core::Span
+#include "ara/log/log_backend.h"       // For ara::log::BackendConfig
+
+namespace ara {
+namespace core {
+
+/**********************************************************************************************************************
+ *  ENUM: InitErrorCode
+ *********************************************************************************************************************/
+/*!
+ * \brief  Result of Initialize() and Deinitialize().
+ */
+enum class InitErrorCode : std::uint8_t {
+    Success = 0,            /*!< All requested phases completed */
+    AlreadyInitialized,     /*!< Initialize() was called twice */
+    NotInitialized,         /*!< Deinitialize() without a successful Initialize() */
+    MemoryLockFailed,       /*!< mlockall failed and InitConfig::requireMemoryLock is set; nothing was initialized */
+    LogBackendFailed,       /*!< The LogBackend did not start; everything else is initialized, logging is synchronous */
+    ExecutorFailed,         /*!< The Executor did not start; everything else is initialized, parallel algorithms run
+                                 serially */
+    FlightRecorderFailed,   /*!< The flight recorder dump file or a crash handler could not be set up; everything
+                                 else is initialized, dumps go to stderr */
+    HugePageArenaFailed     /*!< At least one huge-page arena could not be mapped; everything else is initialized,
+                                 that arena hands out no storage */
+};
+
+/**********************************************************************************************************************
+ *  STRUCT: InitConfig
+ *********************************************************************************************************************/
+/*!
+ * \brief  Configuration of Initialize().
+ *
+ * \details
+ * - lockMemory:         Lock all current and future pages (needs CAP_IPC_LOCK or a sufficient RLIMIT_MEMLOCK).
+ * - requireMemoryLock:  Fail with MemoryLockFailed instead of continuing unlocked when mlockall fails.
+ * - threadStackSize:    Default stack size of threads created afterwards (0: keep the platform default). With
+ *                       lockMemory, each new thread stack is populated in full when the thread is created.
+ * - stackPrefault:      Bytes of the calling thread's stack to touch (the main thread stack grows on demand).
+ * - defaultResource:    Installed with pmr::SetDefaultResource() (nullptr: keep the current one).
+ * - hugePageArenas:     Huge-page arenas mapped with HugePageArena::Map() (on their node, pre-faulted as configured).
+ *                       They stay mapped after Deinitialize(), since objects placed in them may still be in use; the
+ *                       owner unmaps them.
+ * - arenas:             Arenas whose storage is pre-faulted.
+ * - logBackend:         Starts the LogBackend with this configuration (nullptr: the caller manages it).
+ * - executor:           Starts Executor::Instance() with this configuration (nullptr: the caller manages it).
+ * - flightRecorder:     Configures the FlightRecorder (dump file, crash handlers) with this configuration (nullptr:
+ *                       the caller manages it; the rings record and are dumped to stderr on violations regardless).
+ */
+struct InitConfig {
+    bool                                lockMemory{true};
+    bool                                requireMemoryLock{false};
+    std::size_t                         threadStackSize{256U * 1024U};
+    std::size_t                         stackPrefault{256U * 1024U};
+    pmr::MemoryResource*                defaultResource{nullptr};
+    Span<pmr::HugePageArena* const>     hugePageArenas{};
+    Span<pmr::ArenaResource* const>     arenas{};
+    const ara::log::BackendConfig*      logBackend{nullptr};
+    const ExecutorConfig*               executor{nullptr};
+    const FlightRecorderConfig*         flightRecorder{nullptr};
+};
+
+/**********************************************************************************************************************
+ *  STRUCT: InitializationReport
+ *********************************************************************************************************************/
+/*!
+ * \brief  Duration of each phase of the last Initialize() (steady clock) and what it achieved.
+ */
+struct InitializationReport {
+    std::chrono::nanoseconds memoryLock{0};          /*!< Phase 1 */
+    std::chrono::nanoseconds stacks{0};              /*!< Phase 2 */
+    std::chrono::nanoseconds singletons{0};          /*!< Phase 3 */
+    std::chrono::nanoseconds memoryResources{0};     /*!< Phase 4 */
+    std::chrono::nanoseconds logBackend{0};          /*!< Phase 5 */
+    std::chrono::nanoseconds executor{0};            /*!< Phase 6 */
+    std::chrono::nanoseconds total{0};               /*!< All phases */
+    bool                     memoryLocked{false};        /*!< mlockall succeeded */
+    bool                     threadStackSizeSet{false};  /*!< The default thread stack size was applied */
+    bool                     logBackendStarted{false};   /*!< Initialize() started the LogBackend */
+    bool                     executorStarted{false};     /*!< Initialize() started the Executor */
+    bool                     flightRecorderConfigured{false};  /*!< FlightRecorder::Configure() succeeded */
+    std::size_t              hugePageArenasMapped{0U};       /*!< Huge-page arenas Initialize() mapped */
+    std::size_t              hugePageArenasOnBasePages{0U};  /*!< Of those, arenas that fell back to base pages */
+};
+
+/**********************************************************************************************************************
+ *  FUNCTIONS
+ *********************************************************************************************************************/
+/*!
+ * \brief  Initializes the ara::core runtime of the process; to be called once from main() before any other thread
+ *         is created (after the signal mask is set, so that the LogBackend and executor threads inherit it).
+ *
+ * \return InitErrorCode::Success, AlreadyInitialized, MemoryLockFailed, LogBackendFailed, ExecutorFailed,
+ *         FlightRecorderFailed or HugePageArenaFailed.
+ *
+ * \note   [SWS_CORE_10001]
+ */
+auto Initialize(const InitConfig& config = InitConfig{}) noexcept -> InitErrorCode;
+
+/*!
+ * \brief  Reverses Initialize(): stops the Executor and the LogBackend if Initialize() started them (after running
+ *         the queued tasks and writing the pending messages), restores the previous default memory resource and unlocks the memory.
+ *
+ * \return InitErrorCode::Success or NotInitialized.
+ *
+ * \note   [SWS_CORE_10002]
+ */
+auto Deinitialize() noexcept -> InitErrorCode;
+
+/*!
+ * \brief  Returns the report of the last Initialize() (all zero before the first call).
+ */
+auto GetInitializationReport() noexcept -> const InitializationReport&;
+
+/*!
+ * \brief  Touches \c bytes of the calling thread's stack, so that later calls up to that depth take no page fault.
+ *
+ * \details For threads created before Initialize() or without a memory lock; call it first in the thread entry.
+ */
+auto PrefaultStack(std::size_t bytes) noexcept -> void;
+
+} // namespace core
+} // namespace ara
+
+#endif // OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_CORE_INITIALIZATION_H_
@@ -0,0 +1,71 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project (CXX_STANDARD 17)
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara/core/interference_size.h
+ *  \brief      Compile-time cache geometry of the target: destructive and constructive interference sizes.
+ *
+ *  \details    kDestructiveInterferenceSize is the minimum distance between two objects written by different threads
+ *              for them not to share a cache line (the padding of ring indices, per-worker state, seqlocks).
+ *              kConstructiveInterferenceSize is the largest block that is guaranteed to sit in one line (alignment
+ *              of hot data that is read together).
+ *
+ *              std::hardware_destructive_interference_size would be the standard answer, but its value depends on
+ *              compiler flags (GCC warns whenever it is used in a header), so the values are fixed per architecture:
+ *              - x86_64:               64 (the adjacent-line prefetcher pairs lines, but 64 matches the ABI of
+ *                                      every other component on these targets)
+ *              - aarch64, ppc64:       128 (Apple and some Neoverse/Cortex-X parts have 128-byte lines or pair
+ *                                      lines; 64-byte big.LITTLE cores are covered as well)
+ *              - s390x:                256
+ *              - otherwise:            64
+ *              Define ARA_CORE_DESTRUCTIVE_INTERFERENCE_SIZE to override the value for a specific SoC.
+ *
+ *              ara::os::interface::system cross-checks the value against the line size reported by the running
+ *              system (CheckDestructiveInterferenceSize).
+ *
+ *  \note       This header is an OpenAA extension; it is not part of the AUTOSAR SWS.
+ *********************************************************************************************************************/
+
+#ifndef OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_CORE_INTERFERENCE_SIZE_H_
+#define OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_CORE_INTERFERENCE_SIZE_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <cstddef>      // For std::size_t
+
+namespace ara {
+namespace core {
+
+/*!
+ * \brief  Minimum offset between two objects to avoid false sharing.
+ */
+#if defined(ARA_CORE_DESTRUCTIVE_INTERFERENCE_SIZE)
+constexpr std::size_t kDestructiveInterferenceSize{ARA_CORE_DESTRUCTIVE_INTERFERENCE_SIZE};
+#elif defined(__aarch64__) || defined(__powerpc64__)
+constexpr std::size_t kDestructiveInterferenceSize{128U};
+#elif defined(__s390x__)
+constexpr std::size_t kDestructiveInterferenceSize{256U};
+#else
+constexpr std::size_t kDestructiveInterferenceSize{64U};
+#endif
+
+/*!
+ * \brief  Maximum size of contiguous memory that is guaranteed to share one cache line.
+ */
+constexpr std::size_t kConstructiveInterferenceSize{64U};
+
+static_assert((kDestructiveInterferenceSize & (kDestructiveInterferenceSize - 1U)) == 0U,
+              "ara::core::kDestructiveInterferenceSize must be a power of two");
+static_assert(kDestructiveInterferenceSize >= kConstructiveInterferenceSize,
+              "ara::core::kDestructiveInterferenceSize must cover at least one cache line");
+
+} // namespace core
+} // namespace ara
+
+#endif // OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_CORE_INTERFERENCE_SIZE_H_
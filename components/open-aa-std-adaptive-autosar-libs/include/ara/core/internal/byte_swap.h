@@ -0,0 +1,219 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project (CXX_STANDARD 17)
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara/core/internal/byte_swap.h
+ *  \brief      Internal byte-swapping copy kernels behind ara::core::serialization.
+ *
+ *  \details    SwapCopy<Size, Count>() copies Count elements of Size bytes (2, 4 or 8) and reverses the bytes of each
+ *              one. Whole vector registers are permuted with one byte shuffle, selected at compile time from the
+ *              target macros:
+ *              - x86_64: AVX2 (_mm256_shuffle_epi8, 32 bytes), SSSE3 (_mm_shuffle_epi8, 16 bytes).
+ *              - aarch64: NEON (vrev16q / vrev32q / vrev64q, 16 bytes).
+ *              - Any other target: scalar __builtin_bswap loop.
+ *              The number of vector blocks and the scalar tail are compile-time constants. Source and destination
+ *              may be the same buffer (in-place swap), but must not otherwise overlap.
+ *
+ *  \note       Internal header, not part of the AUTOSAR API.
+ *********************************************************************************************************************/
+
+#ifndef ARA_CORE_INTERNAL_BYTE_SWAP_H_
+#define ARA_CORE_INTERNAL_BYTE_SWAP_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <cstddef>       // For std::size_t
+#include <cstdint>       // For std::uint8_t, std::uint16_t, std::uint32_t, std::uint64_t
+#include <cstring>       // For std::memcpy
+
+#if defined(__AVX2__) || defined(__SSSE3__)
+    #include <immintrin.h>   // x86 SSSE3/AVX2 intrinsics
+#endif
+#if defined(__ARM_NEON)
+    #include <arm_neon.h>    // aarch64 NEON intrinsics
+#endif
+
+namespace ara {
+namespace core {
+namespace internal {
+namespace wire {
+
+/**********************************************************************************************************************
+ *  SECTION: Scalar Swap
+ *********************************************************************************************************************/
+/*!
+ * \brief  Unsigned integer of Size bytes.
+ */
+template <std::size_t Size>
+struct UnsignedOfSize;
+
+template <>
+struct UnsignedOfSize<2U> {
+    using type = std::uint16_t;
+};
+
+template <>
+struct UnsignedOfSize<4U> {
+    using type = std::uint32_t;
+};
+
+template <>
+struct UnsignedOfSize<8U> {
+    using type = std::uint64_t;
+};
+
+/*!
+ * \brief  Copies one element of Size bytes from \c src to \c dst with its bytes reversed (unaligned access).
+ */
+template <std::size_t Size>
+inline auto SwapOne(std::uint8_t* dst, const std::uint8_t* src) noexcept -> void
+{
+    using Word = typename UnsignedOfSize<Size>::type;
+    Word word;
+    std::memcpy(&word, src, Size);
+    if constexpr (Size == 2U) {
+        word = __builtin_bswap16(word);
+    } else if constexpr (Size == 4U) {
+        word = __builtin_bswap32(word);
+    } else {
+        word = __builtin_bswap64(word);
+    }
+    std::memcpy(dst, &word, Size);
+}
+
+/**********************************************************************************************************************
+ *  SECTION: Backends
+ *********************************************************************************************************************/
+/*!
+ * \brief  Byte-shuffle backend (primary template: none, the scalar loop handles everything).
+ *
+ * \details A vector backend provides \c kBlock (bytes per register), \c kName and Swap<Size>(dst, src), which
+ *          reverses the bytes of every Size-byte element of one block.
+ */
+struct ScalarBackend {
+    static constexpr std::size_t kBlock = 0U;
+    static constexpr const char* kName  = "scalar";
+};
+
+#if defined(__AVX2__)
+/*!
+ * \brief  AVX2 backend: one in-lane byte shuffle per 32 bytes (elements never cross a 16-byte lane).
+ */
+struct ShuffleBackend {
+    static constexpr std::size_t kBlock = 32U;
+    static constexpr const char* kName  = "avx2";
+
+    template <std::size_t Size>
+    static auto Swap(std::uint8_t* dst, const std::uint8_t* src) noexcept -> void
+    {
+        __m256i const mask = (Size == 2U) ? _mm256_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14,
+                                                             1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14)
+                           : (Size == 4U) ? _mm256_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+                                                             3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12)
+                                          : _mm256_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8,
+                                                             7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+        __m256i const value = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), _mm256_shuffle_epi8(value, mask));
+    }
+};
+#elif defined(__SSSE3__)
+/*!
+ * \brief  SSSE3 backend: one byte shuffle per 16 bytes.
+ */
+struct ShuffleBackend {
+    static constexpr std::size_t kBlock = 16U;
+    static constexpr const char* kName  = "ssse3";
+
+    template <std::size_t Size>
+    static auto Swap(std::uint8_t* dst, const std::uint8_t* src) noexcept -> void
+    {
+        __m128i const mask = (Size == 2U) ? _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14)
+                           : (Size == 4U) ? _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12)
+                                          : _mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+        __m128i const value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm_shuffle_epi8(value, mask));
+    }
+};
+#elif defined(__ARM_NEON)
+/*!
+ * \brief  NEON backend: one vrev per 16 bytes.
+ */
+struct ShuffleBackend {
+    static constexpr std::size_t kBlock = 16U;
+    static constexpr const char* kName  = "neon";
+
+    template <std::size_t Size>
+    static auto Swap(std::uint8_t* dst, const std::uint8_t* src) noexcept -> void
+    {
+        uint8x16_t const value = vld1q_u8(src);
+        if constexpr (Size == 2U) {
+            vst1q_u8(dst, vrev16q_u8(value));
+        } else if constexpr (Size == 4U) {
+            vst1q_u8(dst, vrev32q_u8(value));
+        } else {
+            vst1q_u8(dst, vrev64q_u8(value));
+        }
+    }
+};
+#else
+using ShuffleBackend = ScalarBackend;
+#endif
+
+/*!
+ * \brief  Backend used for elements of Size bytes (a dependent name, so that the vector path of SwapCopy() is only
+ *         instantiated when the backend has one).
+ */
+template <std::size_t Size>
+struct BackendFor {
+    using type = ShuffleBackend;
+};
+
+/**********************************************************************************************************************
+ *  SECTION: Loop Driver
+ *********************************************************************************************************************/
+/*!
+ * \brief  Copies Count elements of Size bytes from \c src to \c dst, reversing the bytes of each element.
+ *
+ * \details Size 1 is a plain copy. Otherwise (Size * Count) / kBlock vector blocks are followed by a scalar tail of
+ *          constant length; both trip counts are known at compile time.
+ */
+template <std::size_t Size, std::size_t Count>
+inline auto SwapCopy(std::uint8_t* dst, const std::uint8_t* src) noexcept -> void
+{
+    static_assert((Size == 1U) || (Size == 2U) || (Size == 4U) || (Size == 8U),
+                  "ara::core::internal::wire::SwapCopy supports elements of 1, 2, 4 or 8 bytes");
+    constexpr std::size_t kBytes = Size * Count;
+    if constexpr (kBytes == 0U) {
+        static_cast<void>(dst);
+        static_cast<void>(src);
+    } else if constexpr (Size == 1U) {
+        if (dst != src) {
+            std::memcpy(dst, src, kBytes);
+        }
+    } else {
+        using Backend = typename BackendFor<Size>::type;
+        std::size_t offset = 0U;
+        if constexpr (Backend::kBlock != 0U) {
+            constexpr std::size_t kVectorBytes = (kBytes / Backend::kBlock) * Backend::kBlock;
+            for (; offset < kVectorBytes; offset += Backend::kBlock) {
+                Backend::template Swap<Size>(dst + offset, src + offset);
+            }
+        }
+        for (; offset < kBytes; offset += Size) {
+            SwapOne<Size>(dst + offset, src + offset);
+        }
+    }
+}
+
+} // namespace wire
+} // namespace internal
+} // namespace core
+} // namespace ara
+
+#endif // ARA_CORE_INTERNAL_BYTE_SWAP_H_
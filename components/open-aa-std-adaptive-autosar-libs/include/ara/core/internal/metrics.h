@@ -0,0 +1,458 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project (CXX_STANDARD 17)
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara/core/internal/metrics.h
+ *  \brief      Fixed-memory, lock-free latency metrics: log-linear (HDR-style) histograms and cycle metrics.
+ *
+ *  \details    LogLinearHistogram records unsigned 64-bit values (typically nanoseconds) into 2^kSubBucketBits
+ *              linear sub-buckets per power of two. Values below 2^kSubBucketBits are counted exactly. Above that,
+ *              the relative quantization error is at most 2^-kSubBucketBits (about 3 % for the default of 5 bits).
+ *              The memory footprint is fixed at compile time. Record() never allocates, locks or blocks.
+ *
+ *              Snapshots and summaries (count, min, max, mean, p50, p99, p99.9) can be taken from any thread while
+ *              the recording thread keeps running. A snapshot is not an atomic cut across all buckets: samples
+ *              recorded while the copy is being made may or may not be included. Percentiles are always computed
+ *              against the bucket counts actually copied.
+ *
+ *              CycleMetrics groups the histograms a periodic loop needs: wake-up latency (actual start minus
+ *              scheduled release), execution time and the overrun count.
+ *
+ *  \note       This header is an OpenAA extension; it is not part of the AUTOSAR SWS.
+ *********************************************************************************************************************/
+
+#ifndef OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_CORE_INTERNAL_METRICS_H_
+#define OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_CORE_INTERNAL_METRICS_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <atomic>        // For std::atomic
+#include <cstddef>       // For std::size_t
+#include <cstdint>       // For std::uint64_t
+
+namespace ara {
+namespace core {
+namespace internal {
+namespace metrics {
+
+/**********************************************************************************************************************
+ *  STRUCT: HistogramSummary
+ *********************************************************************************************************************/
+/*!
+ * \brief  Compact view of a histogram: the values a jitter dashboard needs.
+ *
+ * \details Percentiles report the highest value equivalent to the bucket that contains the requested rank, capped at
+ *          max. All fields are 0 for an empty histogram.
+ */
+struct HistogramSummary {
+    std::uint64_t count{0U};   /*!< Number of recorded samples */
+    std::uint64_t min{0U};     /*!< Smallest recorded value (exact) */
+    std::uint64_t max{0U};     /*!< Largest recorded value (exact) */
+    std::uint64_t mean{0U};    /*!< Arithmetic mean of the recorded values (truncated) */
+    std::uint64_t p50{0U};     /*!< 50th percentile */
+    std::uint64_t p99{0U};     /*!< 99th percentile */
+    std::uint64_t p999{0U};    /*!< 99.9th percentile */
+};
+
+/**********************************************************************************************************************
+ *  CLASS: LogLinearHistogram
+ *********************************************************************************************************************/
+/*!
+ * \brief  Lock-free, fixed-memory histogram with logarithmic buckets split into linear sub-buckets.
+ *
+ * \tparam kSubBucketBits  log2 of the number of linear sub-buckets per power of two (precision).
+ * \tparam kMaxValueBits   Values of 2^kMaxValueBits or more are clamped into the last bucket (range). The exact
+ *                         maximum is still tracked.
+ *
+ * \details
+ * - Bucket index of v: v itself for v < 2^kSubBucketBits; otherwise, with e = floor(log2(v)) - kSubBucketBits,
+ *   (e + 1) * 2^kSubBucketBits + (v >> e) - 2^kSubBucketBits.
+ * - Record() may be called from several threads concurrently (atomic read-modify-write operations, no locks).
+ * - Reset() is meant for quiescent phases; concurrent samples may survive it partially.
+ */
+template <std::size_t kSubBucketBits = 5U, std::size_t kMaxValueBits = 40U>
+class LogLinearHistogram final {
+    static_assert((kSubBucketBits >= 1U) && (kSubBucketBits <= 16U), "kSubBucketBits must be in [1, 16]");
+    static_assert((kMaxValueBits > kSubBucketBits) && (kMaxValueBits <= 64U),
+                  "kMaxValueBits must be in (kSubBucketBits, 64]");
+
+public:
+    /*!
+     * \brief  Number of linear sub-buckets per power of two.
+     */
+    static constexpr std::size_t kSubBucketCount{std::size_t{1U} << kSubBucketBits};
+
+    /*!
+     * \brief  Total number of buckets (fixed memory: kBucketCount counters).
+     */
+    static constexpr std::size_t kBucketCount{(kMaxValueBits - kSubBucketBits + 1U) * kSubBucketCount};
+
+    /*!
+     * \brief  Plain (non-atomic) copy of the histogram, safe to evaluate at leisure.
+     */
+    class Snapshot final {
+    public:
+        /*!
+         * \brief  Number of samples contained in the copied buckets.
+         */
+        auto Count() const noexcept -> std::uint64_t
+        {
+            return count_;
+        }
+
+        /*!
+         * \brief  Smallest recorded value (0 if empty).
+         */
+        auto Min() const noexcept -> std::uint64_t
+        {
+            return ((count_ == 0U) || (min_ == kNoMinimum)) ? 0U : min_;
+        }
+
+        /*!
+         * \brief  Largest recorded value (0 if empty).
+         */
+        auto Max() const noexcept -> std::uint64_t
+        {
+            return max_;
+        }
+
+        /*!
+         * \brief  Mean of the recorded values, truncated (0 if empty).
+         */
+        auto Mean() const noexcept -> std::uint64_t
+        {
+            return (totalCount_ == 0U) ? 0U : (sum_ / totalCount_);
+        }
+
+        /*!
+         * \brief  Number of samples in bucket \c index (0 for an invalid index).
+         */
+        auto BucketCount(std::size_t index) const noexcept -> std::uint64_t
+        {
+            return (index < kBucketCount) ? counts_[index] : 0U;
+        }
+
+        /*!
+         * \brief  Value at percentile \c percentile (clamped to [0, 100]).
+         *
+         * \details Returns the highest value equivalent to the bucket holding rank ceil(percentile / 100 * count),
+         *          capped at Max(). Rank 0 is treated as rank 1, so percentile 0 returns the lowest bucket.
+         */
+        auto ValueAtPercentile(double percentile) const noexcept -> std::uint64_t
+        {
+            if (count_ == 0U) {
+                return 0U;
+            }
+            double const clamped = (percentile < 0.0) ? 0.0 : ((percentile > 100.0) ? 100.0 : percentile);
+            double const exactRank = (clamped / 100.0) * static_cast<double>(count_);
+            std::uint64_t rank = static_cast<std::uint64_t>(exactRank);
+            if (static_cast<double>(rank) < exactRank) {
+                ++rank;
+            }
+            rank = (rank == 0U) ? 1U : ((rank > count_) ? count_ : rank);
+
+            std::uint64_t cumulative{0U};
+            for (std::size_t index = 0U; index < kBucketCount; ++index) {
+                cumulative += counts_[index];
+                if (cumulative >= rank) {
+                    std::uint64_t const highest = HighestEquivalentValue(index);
+                    return (highest < max_) ? highest : max_;
+                }
+            }
+            return max_;
+        }
+
+        /*!
+         * \brief  Count, min, max, mean, p50, p99 and p99.9 of the snapshot.
+         */
+        auto Summary() const noexcept -> HistogramSummary
+        {
+            HistogramSummary summary{};
+            summary.count = count_;
+            summary.min   = Min();
+            summary.max   = Max();
+            summary.mean  = Mean();
+            summary.p50   = ValueAtPercentile(50.0);
+            summary.p99   = ValueAtPercentile(99.0);
+            summary.p999  = ValueAtPercentile(99.9);
+            return summary;
+        }
+
+    private:
+        friend class LogLinearHistogram;
+
+        std::uint64_t counts_[kBucketCount]{};
+        std::uint64_t count_{0U};
+        std::uint64_t totalCount_{0U};
+        std::uint64_t sum_{0U};
+        std::uint64_t min_{0U};
+        std::uint64_t max_{0U};
+    };
+
+    /*!
+     * \brief  Constructs an empty histogram.
+     */
+    LogLinearHistogram() noexcept = default;
+
+    LogLinearHistogram(const LogLinearHistogram&) = delete;
+    LogLinearHistogram(LogLinearHistogram&&) = delete;
+    auto operator=(const LogLinearHistogram&) -> LogLinearHistogram& = delete;
+    auto operator=(LogLinearHistogram&&) -> LogLinearHistogram& = delete;
+    ~LogLinearHistogram() = default;
+
+    /*!
+     * \brief  Bucket index of \c value (values beyond the range map to the last bucket).
+     */
+    static constexpr auto IndexOf(std::uint64_t value) noexcept -> std::size_t
+    {
+        if (value < kSubBucketCount) {
+            return static_cast<std::size_t>(value);
+        }
+        std::size_t const magnitude = kMostSignificantBit - static_cast<std::size_t>(__builtin_clzll(value));
+        if (magnitude >= kMaxValueBits) {
+            return kBucketCount - 1U;
+        }
+        std::size_t const exponent = magnitude - kSubBucketBits;
+        return ((exponent + 1U) * kSubBucketCount) +
+               (static_cast<std::size_t>(value >> exponent) - kSubBucketCount);
+    }
+
+    /*!
+     * \brief  Smallest value that maps to bucket \c index.
+     */
+    static constexpr auto LowestEquivalentValue(std::size_t index) noexcept -> std::uint64_t
+    {
+        if (index < kSubBucketCount) {
+            return static_cast<std::uint64_t>(index);
+        }
+        std::size_t const exponent = (index / kSubBucketCount) - 1U;
+        std::uint64_t const mantissa = static_cast<std::uint64_t>(kSubBucketCount + (index % kSubBucketCount));
+        return mantissa << exponent;
+    }
+
+    /*!
+     * \brief  Largest value that maps to bucket \c index.
+     */
+    static constexpr auto HighestEquivalentValue(std::size_t index) noexcept -> std::uint64_t
+    {
+        if (index < kSubBucketCount) {
+            return static_cast<std::uint64_t>(index);
+        }
+        std::size_t const exponent = (index / kSubBucketCount) - 1U;
+        return LowestEquivalentValue(index) + ((std::uint64_t{1U} << exponent) - 1U);
+    }
+
+    /*!
+     * \brief  Records one sample. Lock-free and allocation-free.
+     *
+     * \details Min and max are updated before the bucket is incremented (release), so a snapshot never counts a
+     *          sample whose value is not yet covered by its min and max.
+     */
+    auto Record(std::uint64_t value) noexcept -> void
+    {
+        std::uint64_t observed = max_.load(std::memory_order_relaxed);
+        while ((value > observed) &&
+               !max_.compare_exchange_weak(observed, value, std::memory_order_relaxed, std::memory_order_relaxed)) {
+        }
+        observed = min_.load(std::memory_order_relaxed);
+        while ((value < observed) &&
+               !min_.compare_exchange_weak(observed, value, std::memory_order_relaxed, std::memory_order_relaxed)) {
+        }
+
+        sum_.fetch_add(value, std::memory_order_relaxed);
+        count_.fetch_add(1U, std::memory_order_relaxed);
+        buckets_[IndexOf(value)].fetch_add(1U, std::memory_order_release);
+    }
+
+    /*!
+     * \brief  Copies the histogram without stopping the recording threads.
+     *
+     * \details The buckets are read first (acquire), then min and max, which therefore bound every counted sample.
+     *          Count() is the sum of the copied buckets; Mean() uses the sample counter and sum read afterwards.
+     */
+    auto GetSnapshot() const noexcept -> Snapshot
+    {
+        Snapshot snapshot{};
+        for (std::size_t index = 0U; index < kBucketCount; ++index) {
+            snapshot.counts_[index] = buckets_[index].load(std::memory_order_acquire);
+            snapshot.count_ += snapshot.counts_[index];
+        }
+        snapshot.max_        = max_.load(std::memory_order_relaxed);
+        snapshot.min_        = min_.load(std::memory_order_relaxed);
+        snapshot.totalCount_ = count_.load(std::memory_order_relaxed);
+        snapshot.sum_        = sum_.load(std::memory_order_relaxed);
+        return snapshot;
+    }
+
+    /*!
+     * \brief  Count, min, max, mean, p50, p99 and p99.9, taken from a fresh snapshot.
+     */
+    auto GetSummary() const noexcept -> HistogramSummary
+    {
+        return GetSnapshot().Summary();
+    }
+
+    /*!
+     * \brief  Number of recorded samples.
+     */
+    auto GetCount() const noexcept -> std::uint64_t
+    {
+        return count_.load(std::memory_order_relaxed);
+    }
+
+    /*!
+     * \brief  Clears all samples.
+     */
+    auto Reset() noexcept -> void
+    {
+        for (std::size_t index = 0U; index < kBucketCount; ++index) {
+            buckets_[index].store(0U, std::memory_order_relaxed);
+        }
+        count_.store(0U, std::memory_order_relaxed);
+        sum_.store(0U, std::memory_order_relaxed);
+        max_.store(0U, std::memory_order_relaxed);
+        min_.store(kNoMinimum, std::memory_order_relaxed);
+    }
+
+private:
+    /*!
+     * \brief  Index of the most significant bit of a 64-bit value.
+     */
+    static constexpr std::size_t kMostSignificantBit{63U};
+
+    /*!
+     * \brief  Marker of an empty minimum.
+     */
+    static constexpr std::uint64_t kNoMinimum{~std::uint64_t{0U}};
+
+    std::atomic<std::uint64_t> buckets_[kBucketCount]{};
+    std::atomic<std::uint64_t> count_{0U};
+    std::atomic<std::uint64_t> sum_{0U};
+    std::atomic<std::uint64_t> max_{0U};
+    std::atomic<std::uint64_t> min_{kNoMinimum};
+};
+
+/**********************************************************************************************************************
+ *  TYPE ALIAS: LatencyHistogram
+ *********************************************************************************************************************/
+/*!
+ * \brief  Nanosecond latency histogram: about 3 % resolution, exact below 32 ns, range up to 2^40 ns (about 18 min),
+ *         9 KiB of counters.
+ */
+using LatencyHistogram = LogLinearHistogram<5U, 40U>;
+
+/**********************************************************************************************************************
+ *  STRUCT: CycleMetricsSummary
+ *********************************************************************************************************************/
+/*!
+ * \brief  Summary of a CycleMetrics instance.
+ */
+struct CycleMetricsSummary {
+    HistogramSummary wakeUpLatency{};     /*!< Start of the cycle minus its scheduled release, in ns */
+    HistogramSummary executionTime{};     /*!< Duration of the cycle, in ns */
+    std::uint64_t    overruns{0U};        /*!< Cycles that finished after the next release */
+};
+
+/**********************************************************************************************************************
+ *  CLASS: CycleMetrics
+ *********************************************************************************************************************/
+/*!
+ * \brief  Per-loop instrumentation: wake-up latency and execution time histograms plus an overrun counter.
+ *
+ * \details Written by the periodic loop (RecordCycle(), RecordOverrun()); read from any other thread (GetSummary(),
+ *          or the individual histograms for custom percentiles).
+ */
+class CycleMetrics final {
+public:
+    CycleMetrics() noexcept = default;
+
+    CycleMetrics(const CycleMetrics&) = delete;
+    CycleMetrics(CycleMetrics&&) = delete;
+    auto operator=(const CycleMetrics&) -> CycleMetrics& = delete;
+    auto operator=(CycleMetrics&&) -> CycleMetrics& = delete;
+    ~CycleMetrics() = default;
+
+    /*!
+     * \brief  Records one cycle. Negative inputs (clock anomalies) are recorded as 0.
+     *
+     * \param[in] wakeUpLatencyNs  Actual start time minus scheduled release time, in nanoseconds.
+     * \param[in] executionTimeNs  Duration of the cycle, in nanoseconds.
+     */
+    auto RecordCycle(std::int64_t wakeUpLatencyNs, std::int64_t executionTimeNs) noexcept -> void
+    {
+        wakeUpLatency_.Record((wakeUpLatencyNs > 0) ? static_cast<std::uint64_t>(wakeUpLatencyNs) : 0U);
+        executionTime_.Record((executionTimeNs > 0) ? static_cast<std::uint64_t>(executionTimeNs) : 0U);
+    }
+
+    /*!
+     * \brief  Counts one overrun.
+     */
+    auto RecordOverrun() noexcept -> void
+    {
+        overruns_.fetch_add(1U, std::memory_order_relaxed);
+    }
+
+    /*!
+     * \brief  Wake-up latency histogram (ns).
+     */
+    auto WakeUpLatency() const noexcept -> const LatencyHistogram&
+    {
+        return wakeUpLatency_;
+    }
+
+    /*!
+     * \brief  Execution time histogram (ns).
+     */
+    auto ExecutionTime() const noexcept -> const LatencyHistogram&
+    {
+        return executionTime_;
+    }
+
+    /*!
+     * \brief  Number of recorded overruns.
+     */
+    auto GetOverruns() const noexcept -> std::uint64_t
+    {
+        return overruns_.load(std::memory_order_relaxed);
+    }
+
+    /*!
+     * \brief  Summaries of both histograms and the overrun count, without stopping the loop.
+     */
+    auto GetSummary() const noexcept -> CycleMetricsSummary
+    {
+        CycleMetricsSummary summary{};
+        summary.wakeUpLatency = wakeUpLatency_.GetSummary();
+        summary.executionTime = executionTime_.GetSummary();
+        summary.overruns      = GetOverruns();
+        return summary;
+    }
+
+    /*!
+     * \brief  Clears all samples (see LogLinearHistogram::Reset()).
+     */
+    auto Reset() noexcept -> void
+    {
+        wakeUpLatency_.Reset();
+        executionTime_.Reset();
+        overruns_.store(0U, std::memory_order_relaxed);
+    }
+
+private:
+    LatencyHistogram           wakeUpLatency_{};
+    LatencyHistogram           executionTime_{};
+    std::atomic<std::uint64_t> overruns_{0U};
+};
+
+} // namespace metrics
+} // namespace internal
+} // namespace core
+} // namespace ara
+
+#endif // OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_CORE_INTERNAL_METRICS_H_
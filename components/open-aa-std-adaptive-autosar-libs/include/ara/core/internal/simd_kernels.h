@@ -0,0 +1,1039 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project (CXX_STANDARD 17)
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara/core/internal/simd_kernels.h
+ *  \brief      Internal SIMD backends and compile-time loop drivers behind ara::core::simd.
+ *
+ *  \details    This file selects one instruction-set backend per element type at compile time and drives it over
+ *              a fixed element count N:
+ *              - x86_64: AVX-512 (F for float, BW for int16_t), AVX/AVX2 (+FMA when available), SSE2.
+ *              - aarch64: SVE (vector-length agnostic, predicated), NEON.
+ *              - Any other type or target: scalar fallback.
+ *
+ *              The backend is chosen from the compiler's target macros (-march / -mcpu), so no run-time dispatch
+ *              takes place. For fixed-width backends the vector body (N / lanes) and the tail (N % lanes) are
+ *              compile-time constants; AVX-512 handles the tail with a constant mask, the others with a scalar
+ *              loop of constant trip count. SVE covers the tail with while-less-than predicates.
+ *
+ *  \note       Internal header, not part of the AUTOSAR API.
+ *********************************************************************************************************************/
+
+#ifndef ARA_CORE_INTERNAL_SIMD_KERNELS_H_
+#define ARA_CORE_INTERNAL_SIMD_KERNELS_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <cstddef>       // For std::size_t
+#include <cstdint>       // For std::int16_t, std::int32_t, std::uint64_t
+#include <type_traits>   // For std::is_integral, std::make_unsigned, std::conditional
+#include <utility>       // For std::declval
+
+#if defined(__SSE2__) || defined(__AVX__) || defined(__AVX512F__)
+    #include <immintrin.h>   // x86 SSE/AVX/AVX-512 intrinsics
+#endif
+#if defined(__ARM_FEATURE_SVE)
+    #include <arm_sve.h>     // aarch64 SVE intrinsics
+#elif defined(__ARM_NEON)
+    #include <arm_neon.h>    // aarch64 NEON intrinsics
+#endif
+
+namespace ara {
+namespace core {
+namespace internal {
+namespace simd {
+
+/**********************************************************************************************************************
+ *  SECTION: Accumulator Type
+ *********************************************************************************************************************/
+/*!
+ * \brief  Type used by the reductions Sum() and Dot() for elements of type T.
+ *
+ * \details
+ * - Integral types narrower than 32 bits accumulate in (u)int32_t, so that int16_t products do not overflow.
+ * - All other types accumulate in T.
+ */
+template <typename T>
+using AccumulatorType = std::conditional_t<
+    std::is_integral_v<T> && (sizeof(T) < sizeof(std::int32_t)),
+    std::conditional_t<std::is_signed_v<T>, std::int32_t, std::uint32_t>,
+    T>;
+
+/**********************************************************************************************************************
+ *  SECTION: Scalar Operations
+ *********************************************************************************************************************/
+/*!
+ * \brief  Scalar reference operations shared by the fallback and the fixed-width tails.
+ *
+ * \details
+ * - Integral arithmetic wraps (two's complement), matching the SIMD lanes (e.g. _mm_add_epi16, vmulq_s16).
+ * - Min(a, b) returns \c a unless \c b < \c a; Max(a, b) returns \c a unless \c b > \c a.
+ */
+struct ScalarOps
+{
+    template <typename T>
+    using Wide = std::make_unsigned_t<decltype(std::declval<T>() + std::declval<T>())>;
+
+    template <typename T>
+    static constexpr auto Add(T lhs, T rhs) noexcept -> T
+    {
+        if constexpr (std::is_integral_v<T>) {
+            return static_cast<T>(static_cast<Wide<T>>(lhs) + static_cast<Wide<T>>(rhs));
+        } else {
+            return lhs + rhs;
+        }
+    }
+
+    template <typename T>
+    static constexpr auto Sub(T lhs, T rhs) noexcept -> T
+    {
+        if constexpr (std::is_integral_v<T>) {
+            return static_cast<T>(static_cast<Wide<T>>(lhs) - static_cast<Wide<T>>(rhs));
+        } else {
+            return lhs - rhs;
+        }
+    }
+
+    template <typename T>
+    static constexpr auto Mul(T lhs, T rhs) noexcept -> T
+    {
+        if constexpr (std::is_integral_v<T>) {
+            return static_cast<T>(static_cast<Wide<T>>(lhs) * static_cast<Wide<T>>(rhs));
+        } else {
+            return lhs * rhs;
+        }
+    }
+
+    template <typename T>
+    static constexpr auto Fma(T a, T b, T c) noexcept -> T
+    {
+        return Add(Mul(a, b), c);
+    }
+
+    template <typename T>
+    static constexpr auto Min(T lhs, T rhs) noexcept -> T
+    {
+        return (rhs < lhs) ? rhs : lhs;
+    }
+
+    template <typename T>
+    static constexpr auto Max(T lhs, T rhs) noexcept -> T
+    {
+        return (rhs > lhs) ? rhs : lhs;
+    }
+};
+
+/**********************************************************************************************************************
+ *  SECTION: Operation Tags
+ *********************************************************************************************************************/
+/*!
+ * \brief  Operation tags binding one scalar operation to the matching backend operation.
+ *
+ * \details
+ * - Vector<B>() forwards to the fixed-width backend B; Scalable<B>() to a scalable backend with a predicate.
+ * - Register types are named through the backend (typename B::Register) and never deduced as template arguments,
+ *   since the vector types carry attributes that template arguments drop.
+ */
+#define ARA_CORE_INTERNAL_SIMD_BINARY_OP(TagName, Function)                                                         \
+    struct TagName                                                                                                   \
+    {                                                                                                                \
+        template <typename T>                                                                                        \
+        static constexpr auto Scalar(T lhs, T rhs) noexcept -> T { return ScalarOps::Function(lhs, rhs); }           \
+        template <typename B>                                                                                        \
+        static auto Vector(typename B::Register lhs, typename B::Register rhs) noexcept -> typename B::Register       \
+        {                                                                                                            \
+            return B::Function(lhs, rhs);                                                                            \
+        }                                                                                                            \
+        template <typename B>                                                                                        \
+        static auto Scalable(typename B::PredicateRegister pg, typename B::Register lhs,                             \
+                             typename B::Register rhs) noexcept -> typename B::Register                              \
+        {                                                                                                            \
+            return B::Function(pg, lhs, rhs);                                                                        \
+        }                                                                                                            \
+    };
+
+ARA_CORE_INTERNAL_SIMD_BINARY_OP(AddOp, Add)
+ARA_CORE_INTERNAL_SIMD_BINARY_OP(SubOp, Sub)
+ARA_CORE_INTERNAL_SIMD_BINARY_OP(MulOp, Mul)
+ARA_CORE_INTERNAL_SIMD_BINARY_OP(MinOp, Min)
+ARA_CORE_INTERNAL_SIMD_BINARY_OP(MaxOp, Max)
+
+#undef ARA_CORE_INTERNAL_SIMD_BINARY_OP
+
+/*!
+ * \brief  Fused multiply-add tag: a * b + c.
+ */
+struct FmaOp
+{
+    template <typename T>
+    static constexpr auto Scalar(T a, T b, T c) noexcept -> T { return ScalarOps::Fma(a, b, c); }
+
+    template <typename B>
+    static auto Vector(typename B::Register a, typename B::Register b, typename B::Register c) noexcept
+        -> typename B::Register
+    {
+        return B::Fma(a, b, c);
+    }
+
+    template <typename B>
+    static auto Scalable(typename B::PredicateRegister pg, typename B::Register a, typename B::Register b,
+                         typename B::Register c) noexcept -> typename B::Register
+    {
+        return B::Fma(pg, a, b, c);
+    }
+};
+
+/*!
+ * \brief  Folds \c count lanes stored in memory with the scalar operation of \c Op.
+ */
+template <typename Op, typename T>
+inline auto FoldLanes(const T* lanes, std::size_t count) noexcept -> T
+{
+    T result = lanes[0];
+    for (std::size_t i = 1U; i < count; ++i) {
+        result = Op::Scalar(result, lanes[i]);
+    }
+    return result;
+}
+
+/**********************************************************************************************************************
+ *  SECTION: Backends
+ *********************************************************************************************************************/
+/*!
+ * \brief  SIMD backend for element type T (primary template: no backend => scalar fallback).
+ *
+ * \details A fixed-width backend provides:
+ * - \c kLanes, \c kMaskedTail, \c kScalable == false, \c kName.
+ * - \c Register / \c AccRegister, Load(), Store(), Zero(), Add(), Sub(), Mul(), Fma(), Min(), Max().
+ * - AccZero(), AccAdd(), AccumulateSum(), AccumulateDot(), ReduceAcc(), ReduceMin(), ReduceMax().
+ * - If \c kMaskedTail: LoadTail<kCount>(p, fill), StoreTail<kCount>(p, v).
+ *
+ * A scalable backend (\c kScalable == true) implements the whole loops itself (see the SVE backend).
+ */
+template <typename T>
+struct Backend
+{
+    static constexpr std::size_t kLanes      = 0U;
+    static constexpr bool        kMaskedTail = false;
+    static constexpr bool        kScalable   = false;
+    static constexpr const char* kName       = "scalar";
+};
+
+#if defined(__AVX512F__)
+/*!
+ * \brief  AVX-512F backend for float (16 lanes, masked tail).
+ */
+template <>
+struct Backend<float>
+{
+    using Register    = __m512;
+    using AccRegister = __m512;
+    using Mask        = __mmask16;
+
+    static constexpr std::size_t kLanes      = 16U;
+    static constexpr bool        kMaskedTail = true;
+    static constexpr bool        kScalable   = false;
+    static constexpr const char* kName       = "avx512";
+    static constexpr Mask        kAll        = static_cast<Mask>(0xFFFFU);
+
+    static auto Load(const float* p) noexcept -> Register { return _mm512_loadu_ps(p); }
+    static auto Store(float* p, Register v) noexcept -> void { _mm512_storeu_ps(p, v); }
+    static auto Zero() noexcept -> Register { return _mm512_setzero_ps(); }
+
+    template <std::size_t kCount>
+    static auto LoadTail(const float* p, Register fill) noexcept -> Register
+    {
+        return _mm512_mask_loadu_ps(fill, static_cast<Mask>((1U << kCount) - 1U), p);
+    }
+
+    template <std::size_t kCount>
+    static auto StoreTail(float* p, Register v) noexcept -> void
+    {
+        _mm512_mask_storeu_ps(p, static_cast<Mask>((1U << kCount) - 1U), v);
+    }
+
+    static auto Add(Register a, Register b) noexcept -> Register { return _mm512_add_ps(a, b); }
+    static auto Sub(Register a, Register b) noexcept -> Register { return _mm512_sub_ps(a, b); }
+    static auto Mul(Register a, Register b) noexcept -> Register { return _mm512_mul_ps(a, b); }
+    static auto Fma(Register a, Register b, Register c) noexcept -> Register { return _mm512_fmadd_ps(a, b, c); }
+    // Masked forms with an explicit pass-through: the unmasked ones read _mm512_undefined_ps(), which GCC 12 reports
+    // as -Wuninitialized once inlined.
+    static auto Min(Register a, Register b) noexcept -> Register { return _mm512_mask_min_ps(a, kAll, b, a); }
+    static auto Max(Register a, Register b) noexcept -> Register { return _mm512_mask_max_ps(a, kAll, b, a); }
+
+    static auto AccZero() noexcept -> AccRegister { return _mm512_setzero_ps(); }
+    static auto AccAdd(AccRegister a, AccRegister b) noexcept -> AccRegister { return _mm512_add_ps(a, b); }
+    static auto AccumulateSum(AccRegister acc, Register v) noexcept -> AccRegister { return _mm512_add_ps(acc, v); }
+    static auto AccumulateDot(AccRegister acc, Register a, Register b) noexcept -> AccRegister
+    {
+        return _mm512_fmadd_ps(a, b, acc);
+    }
+    static auto ReduceAcc(AccRegister acc) noexcept -> float
+    {
+        alignas(64) float lanes[kLanes];
+        _mm512_store_ps(lanes, acc);
+        return FoldLanes<AddOp>(lanes, kLanes);
+    }
+    static auto ReduceMin(Register v) noexcept -> float
+    {
+        alignas(64) float lanes[kLanes];
+        _mm512_store_ps(lanes, v);
+        return FoldLanes<MinOp>(lanes, kLanes);
+    }
+    static auto ReduceMax(Register v) noexcept -> float
+    {
+        alignas(64) float lanes[kLanes];
+        _mm512_store_ps(lanes, v);
+        return FoldLanes<MaxOp>(lanes, kLanes);
+    }
+};
+#elif defined(__AVX__)
+/*!
+ * \brief  AVX backend for float (8 lanes, scalar tail); fused multiply-add when FMA is available.
+ */
+template <>
+struct Backend<float>
+{
+    using Register    = __m256;
+    using AccRegister = __m256;
+
+    static constexpr std::size_t kLanes      = 8U;
+    static constexpr bool        kMaskedTail = false;
+    static constexpr bool        kScalable   = false;
+    static constexpr const char* kName       = "avx2";
+
+    static auto Load(const float* p) noexcept -> Register { return _mm256_loadu_ps(p); }
+    static auto Store(float* p, Register v) noexcept -> void { _mm256_storeu_ps(p, v); }
+    static auto Zero() noexcept -> Register { return _mm256_setzero_ps(); }
+
+    static auto Add(Register a, Register b) noexcept -> Register { return _mm256_add_ps(a, b); }
+    static auto Sub(Register a, Register b) noexcept -> Register { return _mm256_sub_ps(a, b); }
+    static auto Mul(Register a, Register b) noexcept -> Register { return _mm256_mul_ps(a, b); }
+    static auto Fma(Register a, Register b, Register c) noexcept -> Register
+    {
+#if defined(__FMA__)
+        return _mm256_fmadd_ps(a, b, c);
+#else
+        return _mm256_add_ps(_mm256_mul_ps(a, b), c);
+#endif
+    }
+    static auto Min(Register a, Register b) noexcept -> Register { return _mm256_min_ps(b, a); }
+    static auto Max(Register a, Register b) noexcept -> Register { return _mm256_max_ps(b, a); }
+
+    static auto AccZero() noexcept -> AccRegister { return _mm256_setzero_ps(); }
+    static auto AccAdd(AccRegister a, AccRegister b) noexcept -> AccRegister { return _mm256_add_ps(a, b); }
+    static auto AccumulateSum(AccRegister acc, Register v) noexcept -> AccRegister { return _mm256_add_ps(acc, v); }
+    static auto AccumulateDot(AccRegister acc, Register a, Register b) noexcept -> AccRegister
+    {
+        return Fma(a, b, acc);
+    }
+    static auto ReduceAcc(AccRegister acc) noexcept -> float
+    {
+        alignas(32) float lanes[kLanes];
+        _mm256_store_ps(lanes, acc);
+        return FoldLanes<AddOp>(lanes, kLanes);
+    }
+    static auto ReduceMin(Register v) noexcept -> float
+    {
+        alignas(32) float lanes[kLanes];
+        _mm256_store_ps(lanes, v);
+        return FoldLanes<MinOp>(lanes, kLanes);
+    }
+    static auto ReduceMax(Register v) noexcept -> float
+    {
+        alignas(32) float lanes[kLanes];
+        _mm256_store_ps(lanes, v);
+        return FoldLanes<MaxOp>(lanes, kLanes);
+    }
+};
+#elif defined(__SSE2__)
+/*!
+ * \brief  SSE2 backend for float (4 lanes, scalar tail).
+ */
+template <>
+struct Backend<float>
+{
+    using Register    = __m128;
+    using AccRegister = __m128;
+
+    static constexpr std::size_t kLanes      = 4U;
+    static constexpr bool        kMaskedTail = false;
+    static constexpr bool        kScalable   = false;
+    static constexpr const char* kName       = "sse2";
+
+    static auto Load(const float* p) noexcept -> Register { return _mm_loadu_ps(p); }
+    static auto Store(float* p, Register v) noexcept -> void { _mm_storeu_ps(p, v); }
+    static auto Zero() noexcept -> Register { return _mm_setzero_ps(); }
+
+    static auto Add(Register a, Register b) noexcept -> Register { return _mm_add_ps(a, b); }
+    static auto Sub(Register a, Register b) noexcept -> Register { return _mm_sub_ps(a, b); }
+    static auto Mul(Register a, Register b) noexcept -> Register { return _mm_mul_ps(a, b); }
+    static auto Fma(Register a, Register b, Register c) noexcept -> Register
+    {
+        return _mm_add_ps(_mm_mul_ps(a, b), c);
+    }
+    static auto Min(Register a, Register b) noexcept -> Register { return _mm_min_ps(b, a); }
+    static auto Max(Register a, Register b) noexcept -> Register { return _mm_max_ps(b, a); }
+
+    static auto AccZero() noexcept -> AccRegister { return _mm_setzero_ps(); }
+    static auto AccAdd(AccRegister a, AccRegister b) noexcept -> AccRegister { return _mm_add_ps(a, b); }
+    static auto AccumulateSum(AccRegister acc, Register v) noexcept -> AccRegister { return _mm_add_ps(acc, v); }
+    static auto AccumulateDot(AccRegister acc, Register a, Register b) noexcept -> AccRegister
+    {
+        return _mm_add_ps(acc, _mm_mul_ps(a, b));
+    }
+    static auto ReduceAcc(AccRegister acc) noexcept -> float
+    {
+        alignas(16) float lanes[kLanes];
+        _mm_store_ps(lanes, acc);
+        return FoldLanes<AddOp>(lanes, kLanes);
+    }
+    static auto ReduceMin(Register v) noexcept -> float
+    {
+        alignas(16) float lanes[kLanes];
+        _mm_store_ps(lanes, v);
+        return FoldLanes<MinOp>(lanes, kLanes);
+    }
+    static auto ReduceMax(Register v) noexcept -> float
+    {
+        alignas(16) float lanes[kLanes];
+        _mm_store_ps(lanes, v);
+        return FoldLanes<MaxOp>(lanes, kLanes);
+    }
+};
+#elif defined(__ARM_FEATURE_SVE)
+/*!
+ * \brief  SVE backend for float (vector-length agnostic, predicated loops).
+ */
+template <>
+struct Backend<float>
+{
+    static constexpr std::size_t kLanes      = 0U;
+    static constexpr bool        kMaskedTail = false;
+    static constexpr bool        kScalable   = true;
+    static constexpr const char* kName       = "sve";
+
+    using Register          = svfloat32_t;
+    using PredicateRegister = svbool_t;
+
+    static auto Lanes() noexcept -> std::size_t { return static_cast<std::size_t>(svcntw()); }
+    static auto Predicate(std::size_t i, std::size_t n) noexcept -> svbool_t
+    {
+        return svwhilelt_b32_u64(static_cast<std::uint64_t>(i), static_cast<std::uint64_t>(n));
+    }
+    static auto Load(svbool_t pg, const float* p) noexcept -> svfloat32_t { return svld1_f32(pg, p); }
+    static auto Store(svbool_t pg, float* p, svfloat32_t v) noexcept -> void { svst1_f32(pg, p, v); }
+
+    static auto Add(svbool_t pg, svfloat32_t a, svfloat32_t b) noexcept -> svfloat32_t
+    {
+        return svadd_f32_x(pg, a, b);
+    }
+    static auto Sub(svbool_t pg, svfloat32_t a, svfloat32_t b) noexcept -> svfloat32_t
+    {
+        return svsub_f32_x(pg, a, b);
+    }
+    static auto Mul(svbool_t pg, svfloat32_t a, svfloat32_t b) noexcept -> svfloat32_t
+    {
+        return svmul_f32_x(pg, a, b);
+    }
+    static auto Fma(svbool_t pg, svfloat32_t a, svfloat32_t b, svfloat32_t c) noexcept -> svfloat32_t
+    {
+        return svmla_f32_x(pg, c, a, b);
+    }
+    static auto Min(svbool_t pg, svfloat32_t a, svfloat32_t b) noexcept -> svfloat32_t
+    {
+        return svmin_f32_x(pg, a, b);
+    }
+    static auto Max(svbool_t pg, svfloat32_t a, svfloat32_t b) noexcept -> svfloat32_t
+    {
+        return svmax_f32_x(pg, a, b);
+    }
+
+    static auto Sum(const float* a, std::size_t n) noexcept -> float
+    {
+        svfloat32_t acc = svdup_n_f32(0.0F);
+        for (std::size_t i = 0U; i < n; i += Lanes()) {
+            svbool_t const pg = Predicate(i, n);
+            acc = svadd_f32_m(pg, acc, svld1_f32(pg, a + i));
+        }
+        return svaddv_f32(svptrue_b32(), acc);
+    }
+    static auto Dot(const float* a, const float* b, std::size_t n) noexcept -> float
+    {
+        svfloat32_t acc = svdup_n_f32(0.0F);
+        for (std::size_t i = 0U; i < n; i += Lanes()) {
+            svbool_t const pg = Predicate(i, n);
+            acc = svmla_f32_m(pg, acc, svld1_f32(pg, a + i), svld1_f32(pg, b + i));
+        }
+        return svaddv_f32(svptrue_b32(), acc);
+    }
+    static auto ReduceMin(const float* a, std::size_t n) noexcept -> float
+    {
+        svfloat32_t acc = svdup_n_f32(a[0]);
+        for (std::size_t i = 0U; i < n; i += Lanes()) {
+            svbool_t const pg = Predicate(i, n);
+            acc = svmin_f32_m(pg, acc, svld1_f32(pg, a + i));
+        }
+        return svminv_f32(svptrue_b32(), acc);
+    }
+    static auto ReduceMax(const float* a, std::size_t n) noexcept -> float
+    {
+        svfloat32_t acc = svdup_n_f32(a[0]);
+        for (std::size_t i = 0U; i < n; i += Lanes()) {
+            svbool_t const pg = Predicate(i, n);
+            acc = svmax_f32_m(pg, acc, svld1_f32(pg, a + i));
+        }
+        return svmaxv_f32(svptrue_b32(), acc);
+    }
+};
+#elif defined(__ARM_NEON)
+/*!
+ * \brief  NEON backend for float (4 lanes, scalar tail).
+ */
+template <>
+struct Backend<float>
+{
+    using Register    = float32x4_t;
+    using AccRegister = float32x4_t;
+
+    static constexpr std::size_t kLanes      = 4U;
+    static constexpr bool        kMaskedTail = false;
+    static constexpr bool        kScalable   = false;
+    static constexpr const char* kName       = "neon";
+
+    static auto Load(const float* p) noexcept -> Register { return vld1q_f32(p); }
+    static auto Store(float* p, Register v) noexcept -> void { vst1q_f32(p, v); }
+    static auto Zero() noexcept -> Register { return vdupq_n_f32(0.0F); }
+
+    static auto Add(Register a, Register b) noexcept -> Register { return vaddq_f32(a, b); }
+    static auto Sub(Register a, Register b) noexcept -> Register { return vsubq_f32(a, b); }
+    static auto Mul(Register a, Register b) noexcept -> Register { return vmulq_f32(a, b); }
+    static auto Fma(Register a, Register b, Register c) noexcept -> Register { return vfmaq_f32(c, a, b); }
+    static auto Min(Register a, Register b) noexcept -> Register { return vminq_f32(a, b); }
+    static auto Max(Register a, Register b) noexcept -> Register { return vmaxq_f32(a, b); }
+
+    static auto AccZero() noexcept -> AccRegister { return vdupq_n_f32(0.0F); }
+    static auto AccAdd(AccRegister a, AccRegister b) noexcept -> AccRegister { return vaddq_f32(a, b); }
+    static auto AccumulateSum(AccRegister acc, Register v) noexcept -> AccRegister { return vaddq_f32(acc, v); }
+    static auto AccumulateDot(AccRegister acc, Register a, Register b) noexcept -> AccRegister
+    {
+        return vfmaq_f32(acc, a, b);
+    }
+    static auto ReduceAcc(AccRegister acc) noexcept -> float { return vaddvq_f32(acc); }
+    static auto ReduceMin(Register v) noexcept -> float { return vminvq_f32(v); }
+    static auto ReduceMax(Register v) noexcept -> float { return vmaxvq_f32(v); }
+};
+#endif
+
+#if defined(__AVX512BW__)
+/*!
+ * \brief  AVX-512BW backend for int16_t (32 lanes, masked tail, int32 accumulation).
+ */
+template <>
+struct Backend<std::int16_t>
+{
+    using Register    = __m512i;
+    using AccRegister = __m512i;
+    using Mask        = __mmask32;
+
+    static constexpr std::size_t kLanes      = 32U;
+    static constexpr bool        kMaskedTail = true;
+    static constexpr bool        kScalable   = false;
+    static constexpr const char* kName       = "avx512";
+
+    static auto Load(const std::int16_t* p) noexcept -> Register { return _mm512_loadu_si512(p); }
+    static auto Store(std::int16_t* p, Register v) noexcept -> void { _mm512_storeu_si512(p, v); }
+    static auto Zero() noexcept -> Register { return _mm512_setzero_si512(); }
+
+    template <std::size_t kCount>
+    static auto LoadTail(const std::int16_t* p, Register fill) noexcept -> Register
+    {
+        return _mm512_mask_loadu_epi16(fill, static_cast<Mask>((1U << kCount) - 1U), p);
+    }
+
+    template <std::size_t kCount>
+    static auto StoreTail(std::int16_t* p, Register v) noexcept -> void
+    {
+        _mm512_mask_storeu_epi16(p, static_cast<Mask>((1U << kCount) - 1U), v);
+    }
+
+    static auto Add(Register a, Register b) noexcept -> Register { return _mm512_add_epi16(a, b); }
+    static auto Sub(Register a, Register b) noexcept -> Register { return _mm512_sub_epi16(a, b); }
+    static auto Mul(Register a, Register b) noexcept -> Register { return _mm512_mullo_epi16(a, b); }
+    static auto Fma(Register a, Register b, Register c) noexcept -> Register
+    {
+        return _mm512_add_epi16(_mm512_mullo_epi16(a, b), c);
+    }
+    static auto Min(Register a, Register b) noexcept -> Register { return _mm512_min_epi16(a, b); }
+    static auto Max(Register a, Register b) noexcept -> Register { return _mm512_max_epi16(a, b); }
+
+    static auto AccZero() noexcept -> AccRegister { return _mm512_setzero_si512(); }
+    static auto AccAdd(AccRegister a, AccRegister b) noexcept -> AccRegister { return _mm512_add_epi32(a, b); }
+    static auto AccumulateSum(AccRegister acc, Register v) noexcept -> AccRegister
+    {
+        return _mm512_add_epi32(acc, _mm512_madd_epi16(v, _mm512_set1_epi16(1)));
+    }
+    static auto AccumulateDot(AccRegister acc, Register a, Register b) noexcept -> AccRegister
+    {
+        return _mm512_add_epi32(acc, _mm512_madd_epi16(a, b));
+    }
+    static auto ReduceAcc(AccRegister acc) noexcept -> std::int32_t
+    {
+        alignas(64) std::int32_t lanes[16];
+        _mm512_store_si512(lanes, acc);
+        return FoldLanes<AddOp>(lanes, 16U);
+    }
+    static auto ReduceMin(Register v) noexcept -> std::int16_t
+    {
+        alignas(64) std::int16_t lanes[kLanes];
+        _mm512_store_si512(lanes, v);
+        return FoldLanes<MinOp>(lanes, kLanes);
+    }
+    static auto ReduceMax(Register v) noexcept -> std::int16_t
+    {
+        alignas(64) std::int16_t lanes[kLanes];
+        _mm512_store_si512(lanes, v);
+        return FoldLanes<MaxOp>(lanes, kLanes);
+    }
+};
+#elif defined(__AVX2__)
+/*!
+ * \brief  AVX2 backend for int16_t (16 lanes, scalar tail, int32 accumulation).
+ */
+template <>
+struct Backend<std::int16_t>
+{
+    using Register    = __m256i;
+    using AccRegister = __m256i;
+
+    static constexpr std::size_t kLanes      = 16U;
+    static constexpr bool        kMaskedTail = false;
+    static constexpr bool        kScalable   = false;
+    static constexpr const char* kName       = "avx2";
+
+    static auto Load(const std::int16_t* p) noexcept -> Register
+    {
+        return _mm256_loadu_si256(static_cast<const __m256i*>(static_cast<const void*>(p)));
+    }
+    static auto Store(std::int16_t* p, Register v) noexcept -> void
+    {
+        _mm256_storeu_si256(static_cast<__m256i*>(static_cast<void*>(p)), v);
+    }
+    static auto Zero() noexcept -> Register { return _mm256_setzero_si256(); }
+
+    static auto Add(Register a, Register b) noexcept -> Register { return _mm256_add_epi16(a, b); }
+    static auto Sub(Register a, Register b) noexcept -> Register { return _mm256_sub_epi16(a, b); }
+    static auto Mul(Register a, Register b) noexcept -> Register { return _mm256_mullo_epi16(a, b); }
+    static auto Fma(Register a, Register b, Register c) noexcept -> Register
+    {
+        return _mm256_add_epi16(_mm256_mullo_epi16(a, b), c);
+    }
+    static auto Min(Register a, Register b) noexcept -> Register { return _mm256_min_epi16(a, b); }
+    static auto Max(Register a, Register b) noexcept -> Register { return _mm256_max_epi16(a, b); }
+
+    static auto AccZero() noexcept -> AccRegister { return _mm256_setzero_si256(); }
+    static auto AccAdd(AccRegister a, AccRegister b) noexcept -> AccRegister { return _mm256_add_epi32(a, b); }
+    static auto AccumulateSum(AccRegister acc, Register v) noexcept -> AccRegister
+    {
+        return _mm256_add_epi32(acc, _mm256_madd_epi16(v, _mm256_set1_epi16(1)));
+    }
+    static auto AccumulateDot(AccRegister acc, Register a, Register b) noexcept -> AccRegister
+    {
+        return _mm256_add_epi32(acc, _mm256_madd_epi16(a, b));
+    }
+    static auto ReduceAcc(AccRegister acc) noexcept -> std::int32_t
+    {
+        alignas(32) std::int32_t lanes[8];
+        _mm256_store_si256(static_cast<__m256i*>(static_cast<void*>(lanes)), acc);
+        return FoldLanes<AddOp>(lanes, 8U);
+    }
+    static auto ReduceMin(Register v) noexcept -> std::int16_t
+    {
+        alignas(32) std::int16_t lanes[kLanes];
+        _mm256_store_si256(static_cast<__m256i*>(static_cast<void*>(lanes)), v);
+        return FoldLanes<MinOp>(lanes, kLanes);
+    }
+    static auto ReduceMax(Register v) noexcept -> std::int16_t
+    {
+        alignas(32) std::int16_t lanes[kLanes];
+        _mm256_store_si256(static_cast<__m256i*>(static_cast<void*>(lanes)), v);
+        return FoldLanes<MaxOp>(lanes, kLanes);
+    }
+};
+#elif defined(__SSE2__)
+/*!
+ * \brief  SSE2 backend for int16_t (8 lanes, scalar tail, int32 accumulation).
+ */
+template <>
+struct Backend<std::int16_t>
+{
+    using Register    = __m128i;
+    using AccRegister = __m128i;
+
+    static constexpr std::size_t kLanes      = 8U;
+    static constexpr bool        kMaskedTail = false;
+    static constexpr bool        kScalable   = false;
+    static constexpr const char* kName       = "sse2";
+
+    static auto Load(const std::int16_t* p) noexcept -> Register
+    {
+        return _mm_loadu_si128(static_cast<const __m128i*>(static_cast<const void*>(p)));
+    }
+    static auto Store(std::int16_t* p, Register v) noexcept -> void
+    {
+        _mm_storeu_si128(static_cast<__m128i*>(static_cast<void*>(p)), v);
+    }
+    static auto Zero() noexcept -> Register { return _mm_setzero_si128(); }
+
+    static auto Add(Register a, Register b) noexcept -> Register { return _mm_add_epi16(a, b); }
+    static auto Sub(Register a, Register b) noexcept -> Register { return _mm_sub_epi16(a, b); }
+    static auto Mul(Register a, Register b) noexcept -> Register { return _mm_mullo_epi16(a, b); }
+    static auto Fma(Register a, Register b, Register c) noexcept -> Register
+    {
+        return _mm_add_epi16(_mm_mullo_epi16(a, b), c);
+    }
+    static auto Min(Register a, Register b) noexcept -> Register { return _mm_min_epi16(a, b); }
+    static auto Max(Register a, Register b) noexcept -> Register { return _mm_max_epi16(a, b); }
+
+    static auto AccZero() noexcept -> AccRegister { return _mm_setzero_si128(); }
+    static auto AccAdd(AccRegister a, AccRegister b) noexcept -> AccRegister { return _mm_add_epi32(a, b); }
+    static auto AccumulateSum(AccRegister acc, Register v) noexcept -> AccRegister
+    {
+        return _mm_add_epi32(acc, _mm_madd_epi16(v, _mm_set1_epi16(1)));
+    }
+    static auto AccumulateDot(AccRegister acc, Register a, Register b) noexcept -> AccRegister
+    {
+        return _mm_add_epi32(acc, _mm_madd_epi16(a, b));
+    }
+    static auto ReduceAcc(AccRegister acc) noexcept -> std::int32_t
+    {
+        alignas(16) std::int32_t lanes[4];
+        _mm_store_si128(static_cast<__m128i*>(static_cast<void*>(lanes)), acc);
+        return FoldLanes<AddOp>(lanes, 4U);
+    }
+    static auto ReduceMin(Register v) noexcept -> std::int16_t
+    {
+        alignas(16) std::int16_t lanes[kLanes];
+        _mm_store_si128(static_cast<__m128i*>(static_cast<void*>(lanes)), v);
+        return FoldLanes<MinOp>(lanes, kLanes);
+    }
+    static auto ReduceMax(Register v) noexcept -> std::int16_t
+    {
+        alignas(16) std::int16_t lanes[kLanes];
+        _mm_store_si128(static_cast<__m128i*>(static_cast<void*>(lanes)), v);
+        return FoldLanes<MaxOp>(lanes, kLanes);
+    }
+};
+#elif defined(__ARM_FEATURE_SVE)
+/*!
+ * \brief  SVE backend for int16_t (vector-length agnostic, predicated loops, 64-bit dot product lanes).
+ */
+template <>
+struct Backend<std::int16_t>
+{
+    static constexpr std::size_t kLanes      = 0U;
+    static constexpr bool        kMaskedTail = false;
+    static constexpr bool        kScalable   = true;
+    static constexpr const char* kName       = "sve";
+
+    using Register          = svint16_t;
+    using PredicateRegister = svbool_t;
+
+    static auto Lanes() noexcept -> std::size_t { return static_cast<std::size_t>(svcnth()); }
+    static auto Predicate(std::size_t i, std::size_t n) noexcept -> svbool_t
+    {
+        return svwhilelt_b16_u64(static_cast<std::uint64_t>(i), static_cast<std::uint64_t>(n));
+    }
+    static auto Load(svbool_t pg, const std::int16_t* p) noexcept -> svint16_t { return svld1_s16(pg, p); }
+    static auto Store(svbool_t pg, std::int16_t* p, svint16_t v) noexcept -> void { svst1_s16(pg, p, v); }
+
+    static auto Add(svbool_t pg, svint16_t a, svint16_t b) noexcept -> svint16_t { return svadd_s16_x(pg, a, b); }
+    static auto Sub(svbool_t pg, svint16_t a, svint16_t b) noexcept -> svint16_t { return svsub_s16_x(pg, a, b); }
+    static auto Mul(svbool_t pg, svint16_t a, svint16_t b) noexcept -> svint16_t { return svmul_s16_x(pg, a, b); }
+    static auto Fma(svbool_t pg, svint16_t a, svint16_t b, svint16_t c) noexcept -> svint16_t
+    {
+        return svmla_s16_x(pg, c, a, b);
+    }
+    static auto Min(svbool_t pg, svint16_t a, svint16_t b) noexcept -> svint16_t { return svmin_s16_x(pg, a, b); }
+    static auto Max(svbool_t pg, svint16_t a, svint16_t b) noexcept -> svint16_t { return svmax_s16_x(pg, a, b); }
+
+    static auto Sum(const std::int16_t* a, std::size_t n) noexcept -> std::int32_t
+    {
+        std::int64_t acc = 0;
+        for (std::size_t i = 0U; i < n; i += Lanes()) {
+            svbool_t const pg = Predicate(i, n);
+            acc += svaddv_s16(pg, svld1_s16(pg, a + i));
+        }
+        return static_cast<std::int32_t>(acc);
+    }
+    static auto Dot(const std::int16_t* a, const std::int16_t* b, std::size_t n) noexcept -> std::int32_t
+    {
+        svint64_t acc = svdup_n_s64(0);
+        for (std::size_t i = 0U; i < n; i += Lanes()) {
+            svbool_t const pg = Predicate(i, n);
+            acc = svdot_s64(acc, svld1_s16(pg, a + i), svld1_s16(pg, b + i));
+        }
+        return static_cast<std::int32_t>(svaddv_s64(svptrue_b64(), acc));
+    }
+    static auto ReduceMin(const std::int16_t* a, std::size_t n) noexcept -> std::int16_t
+    {
+        svint16_t acc = svdup_n_s16(a[0]);
+        for (std::size_t i = 0U; i < n; i += Lanes()) {
+            svbool_t const pg = Predicate(i, n);
+            acc = svmin_s16_m(pg, acc, svld1_s16(pg, a + i));
+        }
+        return svminv_s16(svptrue_b16(), acc);
+    }
+    static auto ReduceMax(const std::int16_t* a, std::size_t n) noexcept -> std::int16_t
+    {
+        svint16_t acc = svdup_n_s16(a[0]);
+        for (std::size_t i = 0U; i < n; i += Lanes()) {
+            svbool_t const pg = Predicate(i, n);
+            acc = svmax_s16_m(pg, acc, svld1_s16(pg, a + i));
+        }
+        return svmaxv_s16(svptrue_b16(), acc);
+    }
+};
+#elif defined(__ARM_NEON)
+/*!
+ * \brief  NEON backend for int16_t (8 lanes, scalar tail, int32 accumulation).
+ */
+template <>
+struct Backend<std::int16_t>
+{
+    using Register    = int16x8_t;
+    using AccRegister = int32x4_t;
+
+    static constexpr std::size_t kLanes      = 8U;
+    static constexpr bool        kMaskedTail = false;
+    static constexpr bool        kScalable   = false;
+    static constexpr const char* kName       = "neon";
+
+    static auto Load(const std::int16_t* p) noexcept -> Register { return vld1q_s16(p); }
+    static auto Store(std::int16_t* p, Register v) noexcept -> void { vst1q_s16(p, v); }
+    static auto Zero() noexcept -> Register { return vdupq_n_s16(0); }
+
+    static auto Add(Register a, Register b) noexcept -> Register { return vaddq_s16(a, b); }
+    static auto Sub(Register a, Register b) noexcept -> Register { return vsubq_s16(a, b); }
+    static auto Mul(Register a, Register b) noexcept -> Register { return vmulq_s16(a, b); }
+    static auto Fma(Register a, Register b, Register c) noexcept -> Register { return vmlaq_s16(c, a, b); }
+    static auto Min(Register a, Register b) noexcept -> Register { return vminq_s16(a, b); }
+    static auto Max(Register a, Register b) noexcept -> Register { return vmaxq_s16(a, b); }
+
+    static auto AccZero() noexcept -> AccRegister { return vdupq_n_s32(0); }
+    static auto AccAdd(AccRegister a, AccRegister b) noexcept -> AccRegister { return vaddq_s32(a, b); }
+    static auto AccumulateSum(AccRegister acc, Register v) noexcept -> AccRegister { return vpadalq_s16(acc, v); }
+    static auto AccumulateDot(AccRegister acc, Register a, Register b) noexcept -> AccRegister
+    {
+        return vmlal_high_s16(vmlal_s16(acc, vget_low_s16(a), vget_low_s16(b)), a, b);
+    }
+    static auto ReduceAcc(AccRegister acc) noexcept -> std::int32_t { return vaddvq_s32(acc); }
+    static auto ReduceMin(Register v) noexcept -> std::int16_t { return vminvq_s16(v); }
+    static auto ReduceMax(Register v) noexcept -> std::int16_t { return vmaxvq_s16(v); }
+};
+#endif
+
+/**********************************************************************************************************************
+ *  SECTION: Loop Drivers
+ *********************************************************************************************************************/
+/*!
+ * \brief  Number of independent accumulators used by Sum() and Dot() to hide the add/FMA latency.
+ */
+constexpr std::size_t kReductionUnroll = 4U;
+
+/*!
+ * \brief  Element-wise out[i] = Op(in[i]...) for i in [0, N).
+ *
+ * \tparam Op  Operation tag (AddOp, SubOp, MulOp, MinOp, MaxOp, FmaOp).
+ * \tparam N   Element count (compile-time).
+ */
+template <typename Op, std::size_t N, typename T, typename... In>
+inline auto Transform(T* out, const In*... in) noexcept -> void
+{
+    using B = Backend<T>;
+
+    if constexpr (B::kScalable) {
+        for (std::size_t i = 0U; i < N; i += B::Lanes()) {
+            auto const pg = B::Predicate(i, N);
+            B::Store(pg, out + i, Op::template Scalable<B>(pg, B::Load(pg, in + i)...));
+        }
+    } else if constexpr (B::kLanes > 0U) {
+        constexpr std::size_t kBody = N - (N % B::kLanes);
+        constexpr std::size_t kTail = N - kBody;
+
+        for (std::size_t i = 0U; i < kBody; i += B::kLanes) {
+            B::Store(out + i, Op::template Vector<B>(B::Load(in + i)...));
+        }
+        if constexpr (kTail > 0U) {
+            if constexpr (B::kMaskedTail) {
+                B::template StoreTail<kTail>(out + kBody,
+                    Op::template Vector<B>(B::template LoadTail<kTail>(in + kBody, B::Zero())...));
+            } else {
+                for (std::size_t i = kBody; i < N; ++i) {
+                    out[i] = Op::Scalar(in[i]...);
+                }
+            }
+        }
+    } else {
+        for (std::size_t i = 0U; i < N; ++i) {
+            out[i] = Op::Scalar(in[i]...);
+        }
+    }
+}
+
+/*!
+ * \brief  Shared body of Sum() (\c kDot == false) and Dot() (\c kDot == true) for fixed-width backends.
+ */
+template <bool kDot, std::size_t N, typename T>
+inline auto AccumulateFixed(const T* a, const T* b) noexcept -> AccumulatorType<T>
+{
+    using B = Backend<T>;
+    constexpr std::size_t kBody   = N - (N % B::kLanes);
+    constexpr std::size_t kTail   = N - kBody;
+    constexpr std::size_t kStride = kReductionUnroll * B::kLanes;
+
+    auto step = [a, b](typename B::AccRegister acc, std::size_t i) noexcept -> typename B::AccRegister {
+        if constexpr (kDot) {
+            return B::AccumulateDot(acc, B::Load(a + i), B::Load(b + i));
+        } else {
+            static_cast<void>(b);
+            return B::AccumulateSum(acc, B::Load(a + i));
+        }
+    };
+
+    typename B::AccRegister acc0 = B::AccZero();
+    typename B::AccRegister acc1 = B::AccZero();
+    typename B::AccRegister acc2 = B::AccZero();
+    typename B::AccRegister acc3 = B::AccZero();
+
+    std::size_t i = 0U;
+    for (; (i + kStride) <= kBody; i += kStride) {
+        acc0 = step(acc0, i);
+        acc1 = step(acc1, i + B::kLanes);
+        acc2 = step(acc2, i + (2U * B::kLanes));
+        acc3 = step(acc3, i + (3U * B::kLanes));
+    }
+    for (; i < kBody; i += B::kLanes) {
+        acc0 = step(acc0, i);
+    }
+
+    if constexpr ((kTail > 0U) && B::kMaskedTail) {
+        typename B::Register const tailA = B::template LoadTail<kTail>(a + kBody, B::Zero());
+        if constexpr (kDot) {
+            acc1 = B::AccumulateDot(acc1, tailA, B::template LoadTail<kTail>(b + kBody, B::Zero()));
+        } else {
+            acc1 = B::AccumulateSum(acc1, tailA);
+        }
+    }
+
+    AccumulatorType<T> result = B::ReduceAcc(B::AccAdd(B::AccAdd(acc0, acc1), B::AccAdd(acc2, acc3)));
+
+    if constexpr ((kTail > 0U) && !B::kMaskedTail) {
+        for (std::size_t j = kBody; j < N; ++j) {
+            AccumulatorType<T> const x = static_cast<AccumulatorType<T>>(a[j]);
+            if constexpr (kDot) {
+                result = ScalarOps::Fma(x, static_cast<AccumulatorType<T>>(b[j]), result);
+            } else {
+                result = ScalarOps::Add(result, x);
+            }
+        }
+    }
+    return result;
+}
+
+/*!
+ * \brief  Sum of a[0..N) in AccumulatorType<T>.
+ */
+template <std::size_t N, typename T>
+inline auto Sum(const T* a) noexcept -> AccumulatorType<T>
+{
+    using B   = Backend<T>;
+    using Acc = AccumulatorType<T>;
+
+    if constexpr (B::kScalable) {
+        return B::Sum(a, N);
+    } else if constexpr ((B::kLanes > 0U) && ((N >= B::kLanes) || B::kMaskedTail)) {
+        return AccumulateFixed<false, N>(a, a);
+    } else {
+        Acc result{};
+        for (std::size_t i = 0U; i < N; ++i) {
+            result = ScalarOps::Add(result, static_cast<Acc>(a[i]));
+        }
+        return result;
+    }
+}
+
+/*!
+ * \brief  Dot product of a[0..N) and b[0..N) in AccumulatorType<T>.
+ */
+template <std::size_t N, typename T>
+inline auto Dot(const T* a, const T* b) noexcept -> AccumulatorType<T>
+{
+    using B   = Backend<T>;
+    using Acc = AccumulatorType<T>;
+
+    if constexpr (B::kScalable) {
+        return B::Dot(a, b, N);
+    } else if constexpr ((B::kLanes > 0U) && ((N >= B::kLanes) || B::kMaskedTail)) {
+        return AccumulateFixed<true, N>(a, b);
+    } else {
+        Acc result{};
+        for (std::size_t i = 0U; i < N; ++i) {
+            result = ScalarOps::Fma(static_cast<Acc>(a[i]), static_cast<Acc>(b[i]), result);
+        }
+        return result;
+    }
+}
+
+/*!
+ * \brief  Minimum (Op == MinOp) or maximum (Op == MaxOp) of a[0..N). \pre N > 0.
+ */
+template <typename Op, std::size_t N, typename T>
+inline auto Extremum(const T* a) noexcept -> T
+{
+    using B = Backend<T>;
+    constexpr bool kMin = std::is_same_v<Op, MinOp>;
+
+    if constexpr (B::kScalable) {
+        if constexpr (kMin) {
+            return B::ReduceMin(a, N);
+        } else {
+            return B::ReduceMax(a, N);
+        }
+    } else if constexpr ((B::kLanes > 0U) && (N >= B::kLanes)) {
+        constexpr std::size_t kBody = N - (N % B::kLanes);
+        constexpr std::size_t kTail = N - kBody;
+
+        typename B::Register acc = B::Load(a);
+        for (std::size_t i = B::kLanes; i < kBody; i += B::kLanes) {
+            acc = Op::template Vector<B>(acc, B::Load(a + i));
+        }
+        if constexpr ((kTail > 0U) && B::kMaskedTail) {
+            // Lanes past N keep the accumulator's own values, which are neutral for min/max.
+            acc = Op::template Vector<B>(acc, B::template LoadTail<kTail>(a + kBody, acc));
+        }
+
+        T result = kMin ? B::ReduceMin(acc) : B::ReduceMax(acc);
+        if constexpr ((kTail > 0U) && !B::kMaskedTail) {
+            for (std::size_t i = kBody; i < N; ++i) {
+                result = Op::Scalar(result, a[i]);
+            }
+        }
+        return result;
+    } else {
+        return FoldLanes<Op>(a, N);
+    }
+}
+
+} // namespace simd
+} // namespace internal
+} // namespace core
+} // namespace ara
+
+#endif // ARA_CORE_INTERNAL_SIMD_KERNELS_H_
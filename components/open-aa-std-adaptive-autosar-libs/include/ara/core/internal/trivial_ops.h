@@ -0,0 +1,369 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project (CXX_STANDARD 17)
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara/core/internal/trivial_ops.h
+ *  \brief      Internal type traits and block-memory kernels for trivially copyable element types.
+ *
+ *  \details    This file defines the specialization layer used by ara::core containers to route swap, fill, equality,
+ *              rotation and ordering of trivially copyable element types to block memory operations
+ *              (memcpy/memmove/memset/memcmp) instead of element-wise loops. The layer is constexpr-correct: every kernel falls back to the generic
+ *              element-wise path during constant evaluation, so constexpr usage of the containers is unaffected.
+ *
+ *  \note       Internal header, not part of the AUTOSAR API.
+ *********************************************************************************************************************/
+
+#ifndef ARA_CORE_INTERNAL_TRIVIAL_OPS_H_
+#define ARA_CORE_INTERNAL_TRIVIAL_OPS_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <cstddef>       // For std::size_t, std::byte
+#include <cstring>       // For std::memcpy, std::memmove, std::memset, std::memcmp
+#include <functional>    // For std::equal_to
+#include <type_traits>   // For std::is_trivially_copyable, std::has_unique_object_representations, etc.
+#include <utility>       // For std::swap
+
+/*!
+ * \brief  Detects compiler support for telling constant evaluation apart from run-time evaluation.
+ *
+ * \details
+ * - C++17 has no std::is_constant_evaluated(); GCC >= 9 and Clang >= 9 provide the builtin in C++17 mode.
+ * - Without the builtin, the fast paths are disabled and the generic element-wise path is always taken.
+ */
+#if defined(__has_builtin)
+    #if __has_builtin(__builtin_is_constant_evaluated)
+        #define ARA_CORE_INTERNAL_HAS_IS_CONSTANT_EVALUATED 1
+    #endif
+#endif
+#if !defined(ARA_CORE_INTERNAL_HAS_IS_CONSTANT_EVALUATED) && defined(__GNUC__) && (__GNUC__ >= 9)
+    #define ARA_CORE_INTERNAL_HAS_IS_CONSTANT_EVALUATED 1
+#endif
+
+namespace ara {
+namespace core {
+
+/*!
+ * \brief  Forward declaration of the Array class template.
+ */
+template <typename T, std::size_t N>
+class Array;
+
+namespace internal {
+
+/**********************************************************************************************************************
+ *  SECTION: Constant Evaluation Detection
+ *********************************************************************************************************************/
+/*!
+ * \brief   Returns whether the call happens inside a constant-evaluated context.
+ *
+ * \return  \c true during constant evaluation (or when detection is unavailable); \c false at run time.
+ *
+ * \details
+ * - Returning \c true when detection is unavailable keeps every caller on the constexpr-safe generic path.
+ */
+constexpr auto IsConstantEvaluated() noexcept -> bool
+{
+#if defined(ARA_CORE_INTERNAL_HAS_IS_CONSTANT_EVALUATED)
+    return __builtin_is_constant_evaluated();
+#else
+    return true;
+#endif
+}
+
+/**********************************************************************************************************************
+ *  SECTION: Type Traits
+ *********************************************************************************************************************/
+/*!
+ * \brief  Trait: objects of T can be exchanged and copied as raw bytes.
+ *
+ * \tparam T  The element type.
+ *
+ * \details
+ * - Requires T to be trivially copyable and non-const (a const T cannot be overwritten).
+ */
+template <typename T>
+struct is_block_copyable
+    : std::bool_constant<std::is_trivially_copyable_v<T> && !std::is_const_v<T> && !std::is_volatile_v<T>> {};
+
+template <typename T>
+constexpr bool is_block_copyable_v = is_block_copyable<T>::value;
+
+/*!
+ * \brief  Trait: T's operator== has the same result as comparing object representations with memcmp.
+ *
+ * \tparam T  The element type.
+ *
+ * \details
+ * - Holds for integral, enumeration and pointer types that have unique object representations (no padding bits,
+ *   no multiple representations of one value). Floating-point types are excluded (+0.0 == -0.0, NaN != NaN).
+ * - User-defined types are excluded even if they have unique object representations, because a user-provided
+ *   operator== is not required to compare all bytes.
+ * - Nested ara::core::Array<U, M> inherits the property from U (see specialization below).
+ */
+template <typename T>
+struct is_bitwise_equality_comparable
+    : std::bool_constant<(std::is_integral_v<T> || std::is_enum_v<T> || std::is_pointer_v<T>) &&
+                         std::has_unique_object_representations_v<T> &&
+                         !std::is_volatile_v<T>> {};
+
+/*!
+ * \brief  Specialization: an Array of bitwise-comparable elements is itself bitwise-comparable.
+ *
+ * \note   Array<U, M> holds exactly one U[M] member and no padding, so its object representation is the elements'.
+ */
+template <typename U, std::size_t M>
+struct is_bitwise_equality_comparable<Array<U, M>>
+    : std::bool_constant<(M > 0) && is_bitwise_equality_comparable<U>::value &&
+                         (sizeof(Array<U, M>) == sizeof(U) * M)> {};
+
+template <typename T>
+constexpr bool is_bitwise_equality_comparable_v = is_bitwise_equality_comparable<std::remove_const_t<T>>::value;
+
+/*!
+ * \brief  Trait: T's operator< has the same result as memcmp on its object representation.
+ *
+ * \tparam T  The element type.
+ *
+ * \details
+ * - memcmp compares as unsigned char, so only single-byte unsigned types qualify:
+ *   unsigned char, std::byte, and char on targets where char is unsigned.
+ */
+template <typename T>
+struct is_bitwise_lexicographic_comparable
+    : std::bool_constant<std::is_same_v<T, unsigned char> ||
+                         std::is_same_v<T, std::byte> ||
+                         (std::is_same_v<T, char> && !std::is_signed_v<char>)> {};
+
+template <typename T>
+constexpr bool is_bitwise_lexicographic_comparable_v =
+    is_bitwise_lexicographic_comparable<std::remove_const_t<T>>::value;
+
+/**********************************************************************************************************************
+ *  SECTION: Block Memory Kernels (run-time only)
+ *********************************************************************************************************************/
+/*!
+ * \brief  Size of the stack bounce buffer used by SwapBytes.
+ *
+ * \details
+ * - Large enough for the compiler to emit wide vector moves, small enough to stay in L1 and on the stack.
+ */
+constexpr std::size_t kSwapChunkSize{256U};
+
+/*!
+ * \brief   Exchanges two non-overlapping byte ranges of equal length.
+ *
+ * \param   lhs    Pointer to the first range.
+ * \param   rhs    Pointer to the second range.
+ * \param   bytes  Number of bytes in each range.
+ *
+ * \details
+ * - Works in fixed-size chunks through a stack buffer, so it never allocates.
+ * - Must not be called during constant evaluation.
+ */
+inline auto SwapBytes(void* lhs, void* rhs, std::size_t bytes) noexcept -> void
+{
+    unsigned char  chunk[kSwapChunkSize];
+    unsigned char* left  = static_cast<unsigned char*>(lhs);
+    unsigned char* right = static_cast<unsigned char*>(rhs);
+
+    while (bytes >= kSwapChunkSize) {
+        std::memcpy(chunk, left, kSwapChunkSize);
+        std::memcpy(left, right, kSwapChunkSize);
+        std::memcpy(right, chunk, kSwapChunkSize);
+        left  += kSwapChunkSize;
+        right += kSwapChunkSize;
+        bytes -= kSwapChunkSize;
+    }
+
+    if (bytes > 0U) {
+        std::memcpy(chunk, left, bytes);
+        std::memcpy(left, right, bytes);
+        std::memcpy(right, chunk, bytes);
+    }
+}
+
+/**********************************************************************************************************************
+ *  SECTION: Dispatching Algorithms (constexpr-correct)
+ *********************************************************************************************************************/
+/*!
+ * \brief   Swaps \c count elements between two non-overlapping ranges.
+ *
+ * \tparam  T      The element type.
+ * \param   lhs    First range.
+ * \param   rhs    Second range.
+ * \param   count  Number of elements.
+ *
+ * \details
+ * - Block-copyable T at run time => SwapBytes.
+ * - Otherwise (or during constant evaluation) => element-wise swap via ADL-enabled swap.
+ */
+template <typename T>
+constexpr auto SwapRanges(T* lhs, T* rhs, std::size_t count)
+    noexcept(std::is_nothrow_swappable_v<T>) -> void
+{
+    if constexpr (is_block_copyable_v<T>) {
+        if (!IsConstantEvaluated()) {
+            SwapBytes(lhs, rhs, count * sizeof(T));
+            return;
+        }
+    }
+
+    using std::swap;
+    for (std::size_t i = 0; i < count; ++i) {
+        swap(lhs[i], rhs[i]);
+    }
+}
+
+/*!
+ * \brief   Assigns \c value to \c count consecutive elements.
+ *
+ * \tparam  T      The element type.
+ * \param   first  Start of the range.
+ * \param   count  Number of elements.
+ * \param   value  The value to assign.
+ *
+ * \details
+ * - Single-byte block-copyable T at run time => one memset.
+ * - Wider trivially copyable T => a plain store loop, which the optimizer turns into broadcast vector stores.
+ */
+template <typename T>
+constexpr auto FillRange(T* first, std::size_t count, const T& value)
+    noexcept(std::is_nothrow_copy_assignable_v<T>) -> void
+{
+    if constexpr (is_block_copyable_v<T> && (sizeof(T) == 1U)) {
+        if (!IsConstantEvaluated()) {
+            unsigned char byte{};
+            std::memcpy(&byte, &value, 1U);
+            std::memset(first, byte, count);
+            return;
+        }
+    }
+
+    for (std::size_t i = 0; i < count; ++i) {
+        first[i] = value;
+    }
+}
+
+/*!
+ * \brief   Returns whether two ranges of \c count elements are equal.
+ *
+ * \tparam  T      The element type.
+ * \param   lhs    First range.
+ * \param   rhs    Second range.
+ * \param   count  Number of elements.
+ * \return  \c true if all elements compare equal.
+ *
+ * \details
+ * - Bitwise-comparable T at run time => one memcmp.
+ * - Otherwise => element-wise operator== with early exit.
+ */
+template <typename T>
+constexpr auto EqualRanges(const T* lhs, const T* rhs, std::size_t count)
+    noexcept(noexcept(std::declval<const T&>() == std::declval<const T&>())) -> bool
+{
+    if constexpr (is_bitwise_equality_comparable_v<T>) {
+        if (!IsConstantEvaluated()) {
+            return (count == 0U) || (std::memcmp(lhs, rhs, count * sizeof(T)) == 0);
+        }
+    }
+
+    // std::equal_to keeps element-wise equality of floating-point T (intended here) clear of -Wfloat-equal
+    for (std::size_t i = 0; i < count; ++i) {
+        if (!std::equal_to<>{}(lhs[i], rhs[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/*!
+ * \brief   Returns whether range \c lhs is lexicographically less than range \c rhs (both \c count elements).
+ *
+ * \tparam  T      The element type.
+ * \param   lhs    First range.
+ * \param   rhs    Second range.
+ * \param   count  Number of elements.
+ * \return  \c true if \c lhs < \c rhs.
+ *
+ * \details
+ * - Unsigned byte-like T at run time => one memcmp.
+ * - Otherwise => first mismatch decides, using only operator< (same semantics as std::lexicographical_compare).
+ */
+template <typename T>
+constexpr auto LessRanges(const T* lhs, const T* rhs, std::size_t count)
+    noexcept(noexcept(std::declval<const T&>() < std::declval<const T&>())) -> bool
+{
+    if constexpr (is_bitwise_lexicographic_comparable_v<T>) {
+        if (!IsConstantEvaluated()) {
+            return (count != 0U) && (std::memcmp(lhs, rhs, count) < 0);
+        }
+    }
+
+    for (std::size_t i = 0; i < count; ++i) {
+        if (lhs[i] < rhs[i]) {
+            return true;
+        }
+        if (rhs[i] < lhs[i]) {
+            return false;
+        }
+    }
+    return false;
+}
+
+/*!
+ * \brief   Rotates the elements with indices [first, last) so that the element at \c middle becomes the first.
+ *
+ * \tparam  T       The element type.
+ * \param   base    Start of the storage the indices refer to.
+ * \param   first   Index of the first element of the range.
+ * \param   middle  Index of the element that becomes the first.
+ * \param   last    One past the index of the last element of the range.
+ *
+ * \details
+ * - Used by the containers to move freshly appended elements [middle, last) in front of an insert position.
+ * - Block-copyable T with a single appended element at run time => one memmove.
+ * - Otherwise => three index-based reversals (unsigned indices, so the loops stay clear of -Wstrict-overflow).
+ */
+template <typename T>
+constexpr auto RotateRange(T* base, std::size_t first, std::size_t middle, std::size_t last)
+    noexcept(std::is_nothrow_swappable_v<T>) -> void
+{
+    if ((first == middle) || (middle == last)) {
+        return;
+    }
+
+    if constexpr (is_block_copyable_v<T>) {
+        if (!IsConstantEvaluated() && ((last - middle) == 1U)) {
+            T const moved = base[middle];
+            std::memmove(static_cast<void*>(base + first + 1U), static_cast<const void*>(base + first),
+                         (middle - first) * sizeof(T));
+            base[first] = moved;
+            return;
+        }
+    }
+
+    auto reverse = [base](std::size_t from, std::size_t to) {
+        using std::swap;
+        while ((to - from) > 1U) {
+            --to;
+            swap(base[from], base[to]);
+            ++from;
+        }
+    };
+    reverse(first, middle);
+    reverse(middle, last);
+    reverse(first, last);
+}
+
+}  // namespace internal
+}  // namespace core
+}  // namespace ara
+
+#endif // ARA_CORE_INTERNAL_TRIVIAL_OPS_H_
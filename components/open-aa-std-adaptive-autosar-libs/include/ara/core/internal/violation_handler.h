@@ -26,6 +26,13 @@
 #ifndef ARA_CORE_INTERNAL_VIOLATION_HANDLER_H_
 #define ARA_CORE_INTERNAL_VIOLATION_HANDLER_H_
 
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <cstddef>       // For std::size_t
+#include <cstdint>       // For std::uint8_t
+#include <string_view>   // For std::string_view
+
 /**********************************************************************************************************************
  *  NAMESPACE: ara::core::internal
  *********************************************************************************************************************/
@@ -37,13 +44,139 @@ namespace core {
 template <typename T, std::size_t N>
 class Array;
 
+/*!
+ * \brief  Forward declaration of the Vector class template.
+ */
+template <typename T, typename Allocator>
+class Vector;
+
+/*!
+ * \brief  Forward declaration of the InplaceVector class template.
+ */
+template <typename T, std::size_t N>
+class InplaceVector;
+
 namespace internal {
 
+/**********************************************************************************************************************
+ *  ENUM: ViolationKind
+ *********************************************************************************************************************/
+/*!
+ * \brief  Kind of a violation, as reported to the trace probes (ara::os::interface::trace) before aborting.
+ *
+ * \note   The values are part of the trace format; append new kinds, do not renumber.
+ */
+enum class ViolationKind : std::uint8_t {
+    ArrayAccessOutOfRange = 0U, /*!< Array::at() with an index >= N */
+    VectorAccessOutOfRange,     /*!< Vector / InplaceVector::at() with an index >= size() */
+    SpanAccessOutOfRange,       /*!< Span access or sub-view out of range */
+    SpanExtentMismatch,         /*!< Static-extent Span over a sequence of another length */
+    CapacityExceeded,           /*!< Fixed-capacity container or pool exhausted */
+    OutOfMemory,                /*!< Memory resource of a container exhausted */
+    InvalidState                /*!< Precondition on the state of an object does not hold */
+};
+
+/**********************************************************************************************************************
+ *  FUNCTION: ReportArrayAccessOutOfRange
+ *********************************************************************************************************************/
+/*!
+ * \brief  Cold, out-of-line trampoline for the ArrayAccessOutOfRangeViolation of ara::core::Array::at().
+ *
+ * \param  location     Location of the check (a string literal, e.g., "array.h:123").
+ * \param  indexValue   The index that was out of range.
+ * \param  arraySize    The size of the array.
+ *
+ * \details
+ * Every checked access site only keeps a compare and a branch to a single call of this function; the location is
+ * passed as constant operands and the message is formatted here. [[gnu::cold]] moves the call sites out of the hot
+ * code layout and [[gnu::noinline]] keeps the violation path from being duplicated into every caller.
+ *
+ * \note   [SWS_CORE_13017], [SWS_CORE_00090]
+ */
+[[noreturn]] [[gnu::cold]] [[gnu::noinline]] auto ReportArrayAccessOutOfRange(std::string_view location,
+                                                                            std::size_t indexValue,
+                                                                            std::size_t arraySize) noexcept -> void;
+
+/**********************************************************************************************************************
+ *  FUNCTION: ReportSpanAccessOutOfRange / ReportSpanExtentMismatch
+ *********************************************************************************************************************/
+/*!
+ * \brief  Cold, out-of-line trampoline for an out-of-range access or sub-view of ara::core::Span.
+ *
+ * \param  location    Location of the check (a string literal).
+ * \param  indexValue  The index (or requested number of elements) that was out of range.
+ * \param  spanSize    The size of the span (or the number of elements available).
+ *
+ * \note   [SWS_CORE_00090]
+ */
+[[noreturn]] [[gnu::cold]] [[gnu::noinline]] auto ReportSpanAccessOutOfRange(std::string_view location,
+                                                                           std::size_t indexValue,
+                                                                           std::size_t spanSize) noexcept -> void;
+
+/*!
+ * \brief  Cold, out-of-line trampoline for a static-extent ara::core::Span constructed over a sequence of another
+ *         length.
+ *
+ * \param  location   Location of the check (a string literal).
+ * \param  count      The length of the sequence.
+ * \param  extent     The static extent of the span.
+ *
+ * \note   [SWS_CORE_00090]
+ */
+[[noreturn]] [[gnu::cold]] [[gnu::noinline]] auto ReportSpanExtentMismatch(std::string_view location,
+                                                                         std::size_t count,
+                                                                         std::size_t extent) noexcept -> void;
+
+/**********************************************************************************************************************
+ *  FUNCTION: ReportCapacityExceeded / ReportInvalidState
+ *********************************************************************************************************************/
+/*!
+ * \brief  Cold, out-of-line trampoline for a fixed-capacity pool or queue outside the containers that is exhausted.
+ *
+ * \param  location       Location of the check (a string literal).
+ * \param  requestedSize  The number of elements that was requested.
+ * \param  maximumSize    The maximum number of elements the pool can hold.
+ *
+ * \note   [SWS_CORE_00090]
+ */
+[[noreturn]] [[gnu::cold]] [[gnu::noinline]] auto ReportCapacityExceeded(std::string_view location,
+                                                                       std::size_t requestedSize,
+                                                                       std::size_t maximumSize) noexcept -> void;
+
+/*!
+ * \brief  Cold, out-of-line trampoline for an operation whose precondition on the state of an object does not hold
+ *         (e.g., the value of a Result holding an error, or a second value set on a Promise).
+ *
+ * \param  location  Location of the check (a string literal).
+ * \param  reason    What was attempted (a string literal).
+ *
+ * \note   [SWS_CORE_00090]
+ */
+[[noreturn]] [[gnu::cold]] [[gnu::noinline]] auto ReportInvalidState(std::string_view location,
+                                                                   std::string_view reason) noexcept -> void;
+
+/**********************************************************************************************************************
+ *  FUNCTION: RecordNearMiss
+ *********************************************************************************************************************/
+/*!
+ * \brief  Counts an operation that was refused without a violation, e.g., InplaceVector::try_push_back() on a full
+ *         vector (CapacityExceeded) or a memory resource returning nullptr (OutOfMemory).
+ *
+ * \param  kind  The violation the operation would have raised on the checked path.
+ *
+ * \details
+ * Violations abort the process, so they leave no statistics behind; the near misses show how close a process runs to
+ * its limits. The counters are kept by the OS Abstraction Layer and published in the snapshots of
+ * ara::os::interface::process::ProcessStats. Out of line and cold, like the violation trampolines: the refusal path
+ * only gains a call, the success path is unchanged.
+ */
+[[gnu::cold]] [[gnu::noinline]] auto RecordNearMiss(ViolationKind kind) noexcept -> void;
+
 /**********************************************************************************************************************
  *  CLASS: ViolationHandler
  *********************************************************************************************************************/
 /*!
- * \brief  Singleton class responsible for handling violations within the ara::core::Array class.
+ * \brief  Singleton class responsible for handling violations within the ara::core containers (Array, Vector, InplaceVector).
  *
  * \details
  * The ViolationHandler class manages the logging and termination processes when violations occur.
@@ -54,6 +187,10 @@ namespace internal {
  * Instance() method. The class is designed to be thread-safe and noexcept where applicable to meet
  * the stringent safety and reliability standards of automotive systems.
  *
+ * The process identifier is resolved once, when the singleton is constructed during static initialization, and
+ * kept in a fixed-size buffer. The violation path itself formats into a stack buffer and emits the message with
+ * a single write(2) call: no heap allocation, no file I/O and no iostream locking happen while aborting.
+ *
  * \note   [SWS_CORE_00090], [SWS_CORE_13017]
  */
 class ViolationHandler final {
@@ -67,6 +204,15 @@ public:
      */
     static auto Instance() noexcept -> ViolationHandler&;
 
+    /*!
+     * \brief  Capacity of the cached process identifier buffer, including the null terminator.
+     */
+    static constexpr std::size_t kProcessIdentifierCapacity{64U};
+
+    /*!
+     * \brief  Capacity of the stack buffer used to format a violation message.
+     */
+    static constexpr std::size_t kViolationMessageCapacity{512U};
 
 private:
     /*!
@@ -74,9 +220,10 @@ private:
      *
      * \details
      * Prevents external instantiation of the ViolationHandler class. Only the Instance() method
-     * can access this constructor to create the singleton instance.
+     * can access this constructor to create the singleton instance. Resolves and caches the process
+     * identifier, so it is never queried from the OS on the violation path.
      */
-    ViolationHandler() noexcept = default;
+    ViolationHandler() noexcept;
 
     /*!
      * \brief  Deletes the copy constructor.
@@ -127,12 +274,89 @@ private:
     [[noreturn]] auto TriggerArrayAccessOutOfRangeViolation(std::string_view location,
                                                std::size_t indexValue,
                                                std::size_t arraySize) noexcept -> void;
-                                               
+
+    /*!
+     * \brief  Triggers a VectorAccessOutOfRangeViolation.
+     *
+     * \param  location     An implementation-defined identifier of the location where the violation was detected.
+     * \param  indexValue   The index that was out of range.
+     * \param  vectorSize   The current size of the vector.
+     *
+     * \details
+     * Same message layout and termination as TriggerArrayAccessOutOfRangeViolation().
+     *
+     * \note   [SWS_CORE_00090]
+     */
+    [[noreturn]] auto TriggerVectorAccessOutOfRangeViolation(std::string_view location,
+                                                             std::size_t indexValue,
+                                                             std::size_t vectorSize) noexcept -> void;
+
+    /*!
+     * \brief  Triggers a SpanAccessOutOfRangeViolation.
+     *
+     * \param  location    An implementation-defined identifier of the location where the violation was detected.
+     * \param  indexValue  The index (or requested number of elements) that was out of range.
+     * \param  spanSize    The size of the span (or the number of elements available).
+     *
+     * \note   [SWS_CORE_00090]
+     */
+    [[noreturn]] auto TriggerSpanAccessOutOfRangeViolation(std::string_view location,
+                                                           std::size_t indexValue,
+                                                           std::size_t spanSize) noexcept -> void;
+
+    /*!
+     * \brief  Triggers a SpanExtentMismatchViolation.
+     *
+     * \param  location  An implementation-defined identifier of the location where the violation was detected.
+     * \param  count     The length of the viewed sequence.
+     * \param  extent    The static extent of the span.
+     *
+     * \note   [SWS_CORE_00090]
+     */
+    [[noreturn]] auto TriggerSpanExtentMismatchViolation(std::string_view location,
+                                                         std::size_t count,
+                                                         std::size_t extent) noexcept -> void;
+
+    /*!
+     * \brief  Triggers a CapacityExceededViolation.
+     *
+     * \param  location       An implementation-defined identifier of the location where the violation was detected.
+     * \param  requestedSize  The number of elements that was requested.
+     * \param  maximumSize    The maximum number of elements the container can hold.
+     *
+     * \note   [SWS_CORE_00090]
+     */
+    [[noreturn]] auto TriggerCapacityExceededViolation(std::string_view location,
+                                                       std::size_t requestedSize,
+                                                       std::size_t maximumSize) noexcept -> void;
+
+    /*!
+     * \brief  Triggers an OutOfMemoryViolation (the container's memory resource is exhausted).
+     *
+     * \param  location        An implementation-defined identifier of the location where the violation was detected.
+     * \param  requestedBytes  The number of bytes that could not be allocated.
+     *
+     * \note   [SWS_CORE_00090]
+     */
+    [[noreturn]] auto TriggerOutOfMemoryViolation(std::string_view location,
+                                                  std::size_t requestedBytes) noexcept -> void;
+
+    /*!
+     * \brief  Triggers an InvalidStateViolation.
+     *
+     * \param  location  An implementation-defined identifier of the location where the violation was detected.
+     * \param  reason    What was attempted in the wrong state.
+     *
+     * \note   [SWS_CORE_00090]
+     */
+    [[noreturn]] auto TriggerInvalidStateViolation(std::string_view location,
+                                                   std::string_view reason) noexcept -> void;
+
     /*!
      * \brief  Handles the termination of the process upon violation detection.
      *
      * \details
-     * Logs a fatal error message to std::cerr and calls std::terminate() to abort the process.
+     * Writes a fatal error message to stderr with write(2) and calls std::terminate() to abort the process.
      * This method is noexcept and marked as [[noreturn]] to indicate that it does not return.
      *
      * \note   [SWS_CORE_00090]
@@ -142,16 +366,42 @@ private:
     /*!
      * \brief  Retrieves the identifier of the current process.
      *
-     * \return The process identifier as a std::string.
+     * \return The cached process identifier as a std::string_view into a fixed buffer owned by the singleton.
      *
      * \details
-     * Interacts with the OS Abstraction Layer to obtain the name of the current process. If the process name
-     * cannot be retrieved, defaults to "UnknownProcess" or "UnsupportedPlatform" based on the context.
+     * The identifier is resolved once at construction through the OS Abstraction Layer. If the process name
+     * could not be retrieved, it holds "UnknownProcess".
      *
      * \note   [SWS_CORE_00090]
      */
-    auto GetProcessIdentifier() noexcept -> std::string;
-    
+    auto GetProcessIdentifier() const noexcept -> std::string_view;
+
+    /*!
+     * \brief  Resolves the process name through the OS Abstraction Layer into process_identifier_.
+     *
+     * \note   Called once from the constructor.
+     */
+    auto ResolveProcessIdentifier() noexcept -> void;
+
+    /*!
+     * \brief  Writes a complete message to stderr using write(2), retrying on partial writes and EINTR.
+     *
+     * \param  message  The message to write.
+     *
+     * \note   Async-signal-safe; performs no allocation and takes no stream lock.
+     */
+    static auto WriteToStderr(std::string_view message) noexcept -> void;
+
+    /*!
+     * \brief  Cached, null-terminated process identifier.
+     */
+    char process_identifier_[kProcessIdentifierCapacity]{};
+
+    /*!
+     * \brief  Length of the cached process identifier (without the null terminator).
+     */
+    std::size_t process_identifier_length_{0U};
+
     /*!
      * \brief  Grants friendship to the ara::core::Array class to allow exclusive access.
      *
@@ -162,6 +412,50 @@ private:
      */
     template <typename T, std::size_t N>
     friend class ara::core::Array;
+
+    /*!
+     * \brief  Grants friendship to the out-of-line Array::at() trampoline.
+     */
+    friend auto ReportArrayAccessOutOfRange(std::string_view location,
+                                            std::size_t indexValue,
+                                            std::size_t arraySize) noexcept -> void;
+
+    /*!
+     * \brief  Grants friendship to the out-of-line ara::core::Span trampolines.
+     */
+    friend auto ReportSpanAccessOutOfRange(std::string_view location,
+                                           std::size_t indexValue,
+                                           std::size_t spanSize) noexcept -> void;
+    friend auto ReportSpanExtentMismatch(std::string_view location,
+                                         std::size_t count,
+                                         std::size_t extent) noexcept -> void;
+
+    /*!
+     * \brief  Grants friendship to the trampolines of the pools and state machines (ara::core::Future, Result).
+     */
+    friend auto ReportCapacityExceeded(std::string_view location,
+                                       std::size_t requestedSize,
+                                       std::size_t maximumSize) noexcept -> void;
+    friend auto ReportInvalidState(std::string_view location,
+                                   std::string_view reason) noexcept -> void;
+
+    /*!
+     * \brief  Grants friendship to the ara::core::Vector class to allow exclusive access.
+     *
+     * \tparam T          The type of elements in the Vector.
+     * \tparam Allocator  The allocator of the Vector.
+     */
+    template <typename T, typename Allocator>
+    friend class ara::core::Vector;
+
+    /*!
+     * \brief  Grants friendship to the ara::core::InplaceVector class to allow exclusive access.
+     *
+     * \tparam T  The type of elements in the InplaceVector.
+     * \tparam N  The capacity of the InplaceVector.
+     */
+    template <typename T, std::size_t N>
+    friend class ara::core::InplaceVector;
 };
 
 } // namespace internal
@@ -0,0 +1,719 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project (CXX_STANDARD 17)
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara/core/md_array.h
+ *  \brief      Definition of the ara::core::BasicMdArray multi-dimensional array and its MdSpan sub-views.
+ *
+ *  \details    BasicMdArray<T, Layout, Extents...> stores the elements of a fixed R-dimensional box in a single
+ *              ara::core::Array<T, (Extents * ...)>, in the order given by a layout policy that maps an index to an
+ *              offset at compile time:
+ *              - LayoutRight:          row-major, the last index is contiguous (MdArray<T, Extents...>)
+ *              - LayoutLeft:           column-major, the first index is contiguous (ColMajorMdArray<T, Extents...>)
+ *              - LayoutTiled<Tile...>: tiles of Tile... elements stored one after the other (row-major over the
+ *                                      tiles, row-major inside a tile), so that a tile is one contiguous block
+ *
+ *              - Whole-block operations work on the underlying Array (Flat()): fill, swap, comparisons and the
+ *                ara::core::simd kernels, as well as Span / iteration in storage order.
+ *              - GetView() and Subview() return an MdSpan: a zero-copy view of a box of the array with its own
+ *                (relative) indices, in any layout. With LayoutRight, Row() returns the contiguous rows as Spans.
+ *              - ForEachTile<Block...>() hands the blocks of a box to a callback as MdSpans, ForEachBlocked<Block...>()
+ *                visits the elements block by block; the loops are generated at compile time (one plain loop per
+ *                dimension), so cache blocking no longer needs to be written by hand.
+ *              - There is no dynamic allocation; the array is as large as its elements.
+ *
+ *  \note       This header is an OpenAA extension; it is not part of the AUTOSAR SWS. MdSpan follows the ideas of
+ *              std::mdspan (C++23) with the extents of the array fixed at compile time.
+ *********************************************************************************************************************/
+
+#ifndef OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_CORE_MD_ARRAY_H_
+#define OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_CORE_MD_ARRAY_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <cstddef>       // For std::size_t
+#include <type_traits>   // For std::conjunction_v, std::enable_if_t, std::is_convertible_v, std::remove_const_t
+#include <utility>       // For std::forward
+
+#include "ara/core/array.h"                       // For ara::core::Array
+#include "ara/core/span.h"                        // For ara::core::Span
+#include "ara/core/internal/location_utils.h"     // For capturing file/line details
+#include "ara/core/internal/violation_handler.h"  // To trigger the violation
+
+namespace ara {
+namespace core {
+
+/**********************************************************************************************************************
+ *  TYPE ALIAS: MdIndex
+ *********************************************************************************************************************/
+/*!
+ * \brief  Index (or extents, or origin) of an R-dimensional array.
+ */
+template <std::size_t R>
+using MdIndex = Array<std::size_t, R>;
+
+namespace internal {
+
+/**********************************************************************************************************************
+ *  SECTION: Index helpers
+ *********************************************************************************************************************/
+/*!
+ * \brief  Element-wise sum of two indices.
+ */
+template <std::size_t R>
+constexpr auto AddIndex(const MdIndex<R>& lhs, const MdIndex<R>& rhs) noexcept -> MdIndex<R>
+{
+    MdIndex<R> sum{};
+    for (std::size_t d = 0U; d < R; ++d) {
+        sum[d] = lhs[d] + rhs[d];
+    }
+    return sum;
+}
+
+/*!
+ * \brief  Product of all extents.
+ */
+template <std::size_t R>
+constexpr auto IndexProduct(const MdIndex<R>& extents) noexcept -> std::size_t
+{
+    std::size_t product{1U};
+    for (std::size_t d = 0U; d < R; ++d) {
+        product *= extents[d];
+    }
+    return product;
+}
+
+/*!
+ * \brief  Visits the box [origin, origin + extents) in the dimensions Level..Levels-1, one plain loop per dimension.
+ *
+ * \details \c index must hold the origin on entry. \c f receives the index once the Levels outer dimensions are set:
+ *          with Levels == R once per element, with Levels == R - 1 once per row (the last dimension at its origin).
+ *          RowMajor: the last visited dimension varies fastest; otherwise the first one does.
+ */
+template <bool RowMajor, std::size_t Level, std::size_t Levels, std::size_t R, typename Function>
+constexpr auto VisitBox(MdIndex<R>& index, const MdIndex<R>& origin, const MdIndex<R>& extents, Function& f) noexcept
+    -> void
+{
+    if constexpr (Level == Levels) {
+        f(static_cast<const MdIndex<R>&>(index));
+    } else {
+        constexpr std::size_t kDim = RowMajor ? Level : (R - 1U - Level);
+        std::size_t const end = origin[kDim] + extents[kDim];
+        for (std::size_t i = origin[kDim]; i < end; ++i) {
+            index[kDim] = i;
+            VisitBox<RowMajor, Level + 1U, Levels>(index, origin, extents, f);
+        }
+        index[kDim] = origin[kDim];
+    }
+}
+
+/*!
+ * \brief  Calls f(origin, extents) for every block of size \c block of the box [origin, origin + extents), blocks in
+ *         row-major order; the blocks at the upper edges are cut to the box.
+ */
+template <std::size_t R, typename Function>
+constexpr auto VisitBlocks(const MdIndex<R>& origin, const MdIndex<R>& extents, const MdIndex<R>& block,
+                           Function& f) noexcept -> void
+{
+    MdIndex<R> grid{};
+    for (std::size_t d = 0U; d < R; ++d) {
+        grid[d] = (extents[d] + block[d] - 1U) / block[d];
+    }
+    MdIndex<R> const zero{};
+    MdIndex<R> cell{};
+    auto visitCell = [&origin, &extents, &block, &f](const MdIndex<R>& position) noexcept {
+        MdIndex<R> blockOrigin{};
+        MdIndex<R> blockExtents{};
+        for (std::size_t d = 0U; d < R; ++d) {
+            std::size_t const start = position[d] * block[d];
+            blockOrigin[d]  = origin[d] + start;
+            blockExtents[d] = ((extents[d] - start) < block[d]) ? (extents[d] - start) : block[d];
+        }
+        f(static_cast<const MdIndex<R>&>(blockOrigin), static_cast<const MdIndex<R>&>(blockExtents));
+    };
+    VisitBox<true, 0U, R>(cell, zero, grid, visitCell);
+}
+
+} // namespace internal
+
+/**********************************************************************************************************************
+ *  LAYOUT POLICIES
+ *********************************************************************************************************************/
+/*!
+ * \brief  Row-major layout: the last index is contiguous, as in T[E0][E1]...
+ *
+ * \details A layout policy provides Mapping<Extents...> with:
+ *          - kRank, kExtents, kSize
+ *          - kTile / kRowMajorInTile: the storage order (tiles of kTile in row-major order, each tile in row-major
+ *            or column-major order); an untiled layout is a single tile of kExtents
+ *          - kContiguousRows: whether the last dimension of every row is contiguous (stride 1)
+ *          - Offset(index): the position of an element in the storage
+ */
+struct LayoutRight {
+    template <std::size_t... Extents>
+    struct Mapping {
+        static constexpr std::size_t        kRank{sizeof...(Extents)};
+        static constexpr MdIndex<kRank>     kExtents{Extents...};
+        static constexpr std::size_t        kSize{(Extents * ...)};
+        static constexpr MdIndex<kRank>     kTile{Extents...};
+        static constexpr bool               kRowMajorInTile{true};
+        static constexpr bool               kContiguousRows{true};
+
+        static constexpr auto Offset(const MdIndex<kRank>& index) noexcept -> std::size_t
+        {
+            std::size_t offset{0U};
+            for (std::size_t d = 0U; d < kRank; ++d) {
+                offset = (offset * kExtents[d]) + index[d];
+            }
+            return offset;
+        }
+    };
+};
+
+/*!
+ * \brief  Column-major layout: the first index is contiguous (Fortran / BLAS order).
+ */
+struct LayoutLeft {
+    template <std::size_t... Extents>
+    struct Mapping {
+        static constexpr std::size_t        kRank{sizeof...(Extents)};
+        static constexpr MdIndex<kRank>     kExtents{Extents...};
+        static constexpr std::size_t        kSize{(Extents * ...)};
+        static constexpr MdIndex<kRank>     kTile{Extents...};
+        static constexpr bool               kRowMajorInTile{false};
+        static constexpr bool               kContiguousRows{kRank == 1U};
+
+        static constexpr auto Offset(const MdIndex<kRank>& index) noexcept -> std::size_t
+        {
+            std::size_t offset{0U};
+            for (std::size_t d = kRank; d > 0U; --d) {
+                offset = (offset * kExtents[d - 1U]) + index[d - 1U];
+            }
+            return offset;
+        }
+    };
+};
+
+/*!
+ * \brief  Tiled layout: blocks of Tile... elements, each stored contiguously in row-major order, the blocks one after
+ *         the other in row-major order. Every extent must be a multiple of its tile extent.
+ *
+ * \details A tile sized to the working set of a kernel (e.g., 8x8 floats: 4 cache lines) keeps all of its elements
+ *          on as few lines as possible, whatever the width of the array. Tile extents that are powers of two make the
+ *          offset computation shifts and masks.
+ */
+template <std::size_t... Tile>
+struct LayoutTiled {
+    template <std::size_t... Extents>
+    struct Mapping {
+        static_assert(sizeof...(Tile) == sizeof...(Extents),
+                      "ara::core::LayoutTiled needs one tile extent per dimension");
+        static_assert(((Tile > 0U) && ...), "ara::core::LayoutTiled tile extents must be greater than zero");
+        static_assert(((Extents % Tile == 0U) && ...),
+                      "ara::core::LayoutTiled extents must be multiples of the tile extents");
+
+        static constexpr std::size_t        kRank{sizeof...(Extents)};
+        static constexpr MdIndex<kRank>     kExtents{Extents...};
+        static constexpr std::size_t        kSize{(Extents * ...)};
+        static constexpr MdIndex<kRank>     kTile{Tile...};
+        static constexpr std::size_t        kTileSize{(Tile * ...)};
+        static constexpr bool               kRowMajorInTile{true};
+        static constexpr bool               kContiguousRows{false};
+
+        static constexpr auto Offset(const MdIndex<kRank>& index) noexcept -> std::size_t
+        {
+            std::size_t tile{0U};
+            std::size_t inner{0U};
+            for (std::size_t d = 0U; d < kRank; ++d) {
+                tile  = (tile * (kExtents[d] / kTile[d])) + (index[d] / kTile[d]);
+                inner = (inner * kTile[d]) + (index[d] % kTile[d]);
+            }
+            return (tile * kTileSize) + inner;
+        }
+    };
+};
+
+/**********************************************************************************************************************
+ *  CLASS: MdSpan
+ *********************************************************************************************************************/
+/*!
+ * \brief  Zero-copy view of the box [origin, origin + extents) of a BasicMdArray<T, Layout, Extents...>.
+ *
+ * \details The view addresses its elements by indices relative to its origin and maps them with the layout of the
+ *          array, so views of any layout are exact (a sub-view of a tiled array spans its tiles). ElementType is
+ *          T or const T. A view is two indices and a pointer; it is passed by value.
+ */
+template <typename ElementType, typename Layout, std::size_t... Extents>
+class MdSpan final {
+public:
+    using Mapping      = typename Layout::template Mapping<Extents...>;
+    using element_type = ElementType;
+    using value_type   = std::remove_const_t<ElementType>;
+    using size_type    = std::size_t;
+    using Index        = MdIndex<Mapping::kRank>;
+
+    /*!
+     * \brief  View of the box [origin, origin + extents) of the array whose storage starts at \c data (unchecked).
+     */
+    constexpr MdSpan(ElementType* data, const Index& origin, const Index& extents) noexcept
+        : data_{data}, origin_{origin}, extents_{extents}
+    {
+    }
+
+    /*!
+     * \brief  A view of mutable elements converts to a view of const elements.
+     */
+    template <typename Other,
+              typename = std::enable_if_t<std::is_convertible_v<Other (*)[], ElementType (*)[]>>>
+    constexpr MdSpan(const MdSpan<Other, Layout, Extents...>& other) noexcept
+        : data_{other.GetData()}, origin_{other.GetOrigin()}, extents_{other.GetExtents()}
+    {
+    }
+
+    static constexpr auto rank() noexcept -> size_type { return Mapping::kRank; }
+    constexpr auto extent(size_type dimension) const noexcept -> size_type { return extents_[dimension]; }
+    constexpr auto size() const noexcept -> size_type { return internal::IndexProduct(extents_); }
+    constexpr auto empty() const noexcept -> bool { return size() == 0U; }
+
+    /*!
+     * \brief  Origin of the view in the array, and its extents.
+     */
+    constexpr auto GetOrigin() const noexcept -> const Index& { return origin_; }
+    constexpr auto GetExtents() const noexcept -> const Index& { return extents_; }
+
+    /*!
+     * \brief  Start of the storage of the whole array.
+     */
+    constexpr auto GetData() const noexcept -> ElementType* { return data_; }
+
+    // -----------------------------------------------------------------------------------
+    // Element access
+    // -----------------------------------------------------------------------------------
+    /*!
+     * \brief  Element at \c index, relative to the origin (unchecked).
+     */
+    constexpr auto operator()(const Index& index) const noexcept -> ElementType&
+    {
+        return data_[Mapping::Offset(internal::AddIndex(origin_, index))];
+    }
+
+    template <typename... Indices, typename = std::enable_if_t<sizeof...(Indices) == Mapping::kRank>>
+    constexpr auto operator()(Indices... indices) const noexcept -> ElementType&
+    {
+        return (*this)(Index{static_cast<std::size_t>(indices)...});
+    }
+
+    /*!
+     * \brief  Element at \c index; an index outside the extents of the view is a violation.
+     */
+    constexpr auto at(const Index& index) const noexcept -> ElementType&
+    {
+        for (std::size_t d = 0U; d < Mapping::kRank; ++d) {
+            if (index[d] >= extents_[d]) {
+                ara::core::internal::ReportSpanAccessOutOfRange(ARA_CORE_INTERNAL_FILELINE, index[d], extents_[d]);
+            }
+        }
+        return (*this)(index);
+    }
+
+    template <typename... Indices, typename = std::enable_if_t<sizeof...(Indices) == Mapping::kRank>>
+    constexpr auto at(Indices... indices) const noexcept -> ElementType&
+    {
+        return at(Index{static_cast<std::size_t>(indices)...});
+    }
+
+    /*!
+     * \brief  Contiguous row at the leading indices \c leading (LayoutRight only; unchecked).
+     */
+    template <typename... Indices, bool Contiguous = Mapping::kContiguousRows,
+              typename = std::enable_if_t<Contiguous && (sizeof...(Indices) + 1U == Mapping::kRank)>>
+    constexpr auto Row(Indices... leading) const noexcept -> Span<ElementType>
+    {
+        Index const first{static_cast<std::size_t>(leading)..., 0U};
+        return Span<ElementType>{&(*this)(first), extents_[Mapping::kRank - 1U]};
+    }
+
+    // -----------------------------------------------------------------------------------
+    // Sub-views
+    // -----------------------------------------------------------------------------------
+    /*!
+     * \brief  View of the box [origin, origin + extents) of this view; a box outside the view is a violation.
+     */
+    constexpr auto Subview(const Index& origin, const Index& extents) const noexcept -> MdSpan
+    {
+        for (std::size_t d = 0U; d < Mapping::kRank; ++d) {
+            if ((origin[d] > extents_[d]) || (extents[d] > (extents_[d] - origin[d]))) {
+                ara::core::internal::ReportSpanAccessOutOfRange(ARA_CORE_INTERNAL_FILELINE, origin[d] + extents[d],
+                                                                extents_[d]);
+            }
+        }
+        return MdSpan{data_, internal::AddIndex(origin_, origin), extents};
+    }
+
+    // -----------------------------------------------------------------------------------
+    // Iteration
+    // -----------------------------------------------------------------------------------
+    /*!
+     * \brief  Calls f(index, element) for every element in row-major order; \c index is relative to the origin.
+     */
+    template <typename Function>
+    constexpr auto ForEachIndexed(Function f) const noexcept -> void
+    {
+        Index index{};
+        Index const zero{};
+        if constexpr (Mapping::kContiguousRows) {
+            // One offset per row, then a unit-stride inner loop
+            constexpr std::size_t kLast = Mapping::kRank - 1U;
+            auto row = [this, &f](const Index& first) noexcept {
+                ElementType* const elements = &(*this)(first);
+                Index position = first;
+                for (std::size_t i = 0U; i < extents_[kLast]; ++i) {
+                    position[kLast] = i;
+                    f(static_cast<const Index&>(position), elements[i]);
+                }
+            };
+            internal::VisitBox<true, 0U, kLast>(index, zero, extents_, row);
+        } else {
+            auto element = [this, &f](const Index& position) noexcept { f(position, (*this)(position)); };
+            internal::VisitBox<true, 0U, Mapping::kRank>(index, zero, extents_, element);
+        }
+    }
+
+    /*!
+     * \brief  Calls f(element) for every element in row-major order.
+     */
+    template <typename Function>
+    constexpr auto ForEach(Function f) const noexcept -> void
+    {
+        ForEachIndexed([&f](const Index&, ElementType& element) noexcept { f(element); });
+    }
+
+    /*!
+     * \brief  Calls f(block) with a view of every block of Block... elements (row-major order of the blocks); the
+     *         blocks at the upper edges are cut to the view.
+     */
+    template <std::size_t... Block, typename Function>
+    constexpr auto ForEachTile(Function f) const noexcept -> void
+    {
+        static_assert(sizeof...(Block) == Mapping::kRank, "ara::core::MdSpan::ForEachTile needs one block extent "
+                                                          "per dimension");
+        static_assert(((Block > 0U) && ...), "ara::core::MdSpan::ForEachTile block extents must be greater than zero");
+        Index const block{Block...};
+        auto tile = [this, &f](const Index& origin, const Index& extents) noexcept {
+            f(MdSpan{data_, origin, extents});
+        };
+        internal::VisitBlocks(origin_, extents_, block, tile);
+    }
+
+    /*!
+     * \brief  Calls f(index, element) for every element, block by block (see ForEachTile), row-major inside a block;
+     *         \c index is relative to the origin of this view.
+     */
+    template <std::size_t... Block, typename Function>
+    constexpr auto ForEachBlocked(Function f) const noexcept -> void
+    {
+        Index const origin = origin_;
+        ForEachTile<Block...>([&f, &origin](const MdSpan& block) noexcept {
+            Index offset{};
+            for (std::size_t d = 0U; d < Mapping::kRank; ++d) {
+                offset[d] = block.GetOrigin()[d] - origin[d];
+            }
+            block.ForEachIndexed([&f, &offset](const Index& index, ElementType& element) noexcept {
+                f(internal::AddIndex(offset, index), element);
+            });
+        });
+    }
+
+private:
+    ElementType* data_;
+    Index        origin_;
+    Index        extents_;
+};
+
+/**********************************************************************************************************************
+ *  CLASS: BasicMdArray
+ *********************************************************************************************************************/
+/*!
+ * \brief  Fixed-size R-dimensional array of T with the extents Extents... stored in the order of Layout.
+ *
+ * \details Brace initialization lists the elements in storage order (row-major for LayoutRight).
+ */
+template <typename T, typename Layout, std::size_t... Extents>
+class BasicMdArray final {
+public:
+    using Mapping        = typename Layout::template Mapping<Extents...>;
+    using value_type     = T;
+    using size_type      = std::size_t;
+    using Index          = MdIndex<Mapping::kRank>;
+    using Storage        = Array<T, Mapping::kSize>;
+    using View           = MdSpan<T, Layout, Extents...>;
+    using ConstView      = MdSpan<const T, Layout, Extents...>;
+    using iterator       = typename Storage::iterator;
+    using const_iterator = typename Storage::const_iterator;
+
+    static_assert(sizeof...(Extents) > 0U, "ara::core::BasicMdArray needs at least one dimension");
+    static_assert(((Extents > 0U) && ...), "ara::core::BasicMdArray extents must be greater than zero");
+
+    /*!
+     * \brief  Value-initializes every element.
+     */
+    constexpr BasicMdArray() noexcept = default;
+
+    /*!
+     * \brief  Initializes the first elements in storage order, value-initializes the rest (like ara::core::Array).
+     */
+    template <typename... Args,
+              typename = std::enable_if_t<(sizeof...(Args) > 0U) && (sizeof...(Args) <= Mapping::kSize) &&
+                                          std::conjunction_v<std::is_convertible<Args, T>...>>>
+    constexpr BasicMdArray(Args&&... args) noexcept : elements_{std::forward<Args>(args)...}
+    {
+    }
+
+    static constexpr auto rank() noexcept -> size_type { return Mapping::kRank; }
+    static constexpr auto extent(size_type dimension) noexcept -> size_type { return Mapping::kExtents[dimension]; }
+    static constexpr auto size() noexcept -> size_type { return Mapping::kSize; }
+    static constexpr auto extents() noexcept -> const Index& { return Mapping::kExtents; }
+
+    // -----------------------------------------------------------------------------------
+    // Element access
+    // -----------------------------------------------------------------------------------
+    /*!
+     * \brief  Element at \c index (unchecked).
+     */
+    constexpr auto operator()(const Index& index) noexcept -> T& { return elements_[Mapping::Offset(index)]; }
+    constexpr auto operator()(const Index& index) const noexcept -> const T&
+    {
+        return elements_[Mapping::Offset(index)];
+    }
+
+    template <typename... Indices, typename = std::enable_if_t<sizeof...(Indices) == Mapping::kRank>>
+    constexpr auto operator()(Indices... indices) noexcept -> T&
+    {
+        return (*this)(Index{static_cast<std::size_t>(indices)...});
+    }
+
+    template <typename... Indices, typename = std::enable_if_t<sizeof...(Indices) == Mapping::kRank>>
+    constexpr auto operator()(Indices... indices) const noexcept -> const T&
+    {
+        return (*this)(Index{static_cast<std::size_t>(indices)...});
+    }
+
+    /*!
+     * \brief  Element at \c index; an index outside the extents is a violation.
+     */
+    constexpr auto at(const Index& index) noexcept -> T&
+    {
+        CheckIndex(index);
+        return (*this)(index);
+    }
+
+    constexpr auto at(const Index& index) const noexcept -> const T&
+    {
+        CheckIndex(index);
+        return (*this)(index);
+    }
+
+    template <typename... Indices, typename = std::enable_if_t<sizeof...(Indices) == Mapping::kRank>>
+    constexpr auto at(Indices... indices) noexcept -> T&
+    {
+        return at(Index{static_cast<std::size_t>(indices)...});
+    }
+
+    template <typename... Indices, typename = std::enable_if_t<sizeof...(Indices) == Mapping::kRank>>
+    constexpr auto at(Indices... indices) const noexcept -> const T&
+    {
+        return at(Index{static_cast<std::size_t>(indices)...});
+    }
+
+    /*!
+     * \brief  Contiguous row at the leading indices \c leading as a static-extent Span (LayoutRight only; unchecked).
+     */
+    template <typename... Indices, bool Contiguous = Mapping::kContiguousRows,
+              typename = std::enable_if_t<Contiguous && (sizeof...(Indices) + 1U == Mapping::kRank)>>
+    constexpr auto Row(Indices... leading) noexcept -> Span<T, Mapping::kExtents[Mapping::kRank - 1U]>
+    {
+        return Span<T, Mapping::kExtents[Mapping::kRank - 1U]>{&(*this)(static_cast<std::size_t>(leading)..., 0U),
+                                                               Mapping::kExtents[Mapping::kRank - 1U]};
+    }
+
+    template <typename... Indices, bool Contiguous = Mapping::kContiguousRows,
+              typename = std::enable_if_t<Contiguous && (sizeof...(Indices) + 1U == Mapping::kRank)>>
+    constexpr auto Row(Indices... leading) const noexcept -> Span<const T, Mapping::kExtents[Mapping::kRank - 1U]>
+    {
+        return Span<const T, Mapping::kExtents[Mapping::kRank - 1U]>{
+            &(*this)(static_cast<std::size_t>(leading)..., 0U), Mapping::kExtents[Mapping::kRank - 1U]};
+    }
+
+    // -----------------------------------------------------------------------------------
+    // Whole block
+    // -----------------------------------------------------------------------------------
+    /*!
+     * \brief  All elements in storage order, e.g. as an operand of the ara::core::simd kernels.
+     */
+    constexpr auto Flat() noexcept -> Storage& { return elements_; }
+    constexpr auto Flat() const noexcept -> const Storage& { return elements_; }
+
+    constexpr auto data() noexcept -> T* { return elements_.data(); }
+    constexpr auto data() const noexcept -> const T* { return elements_.data(); }
+
+    constexpr auto begin() noexcept -> iterator { return elements_.begin(); }
+    constexpr auto end() noexcept -> iterator { return elements_.end(); }
+    constexpr auto begin() const noexcept -> const_iterator { return elements_.begin(); }
+    constexpr auto end() const noexcept -> const_iterator { return elements_.end(); }
+
+    /*!
+     * \brief  Sets every element to \c value.
+     */
+    constexpr auto fill(const T& value) noexcept -> void { elements_.fill(value); }
+
+    /*!
+     * \brief  Exchanges the elements with \c other.
+     */
+    constexpr auto swap(BasicMdArray& other) noexcept -> void { elements_.swap(other.elements_); }
+
+    friend constexpr auto operator==(const BasicMdArray& lhs, const BasicMdArray& rhs) noexcept -> bool
+    {
+        return lhs.elements_ == rhs.elements_;
+    }
+
+    friend constexpr auto operator!=(const BasicMdArray& lhs, const BasicMdArray& rhs) noexcept -> bool
+    {
+        return !(lhs == rhs);
+    }
+
+    // -----------------------------------------------------------------------------------
+    // Views and iteration
+    // -----------------------------------------------------------------------------------
+    /*!
+     * \brief  View of the whole array.
+     */
+    constexpr auto GetView() noexcept -> View { return View{elements_.data(), Index{}, Mapping::kExtents}; }
+    constexpr auto GetView() const noexcept -> ConstView
+    {
+        return ConstView{elements_.data(), Index{}, Mapping::kExtents};
+    }
+
+    /*!
+     * \brief  View of the box [origin, origin + extents); a box outside the array is a violation.
+     */
+    constexpr auto Subview(const Index& origin, const Index& extents) noexcept -> View
+    {
+        return GetView().Subview(origin, extents);
+    }
+
+    constexpr auto Subview(const Index& origin, const Index& extents) const noexcept -> ConstView
+    {
+        return GetView().Subview(origin, extents);
+    }
+
+    /*!
+     * \brief  Calls f(index, element) for every element in storage order: row-major (LayoutRight), column-major
+     *         (LayoutLeft) or tile by tile (LayoutTiled), so the elements are visited at consecutive addresses.
+     */
+    template <typename Function>
+    constexpr auto ForEachIndexed(Function f) noexcept -> void
+    {
+        VisitStorageOrder(elements_.data(), f);
+    }
+
+    template <typename Function>
+    constexpr auto ForEachIndexed(Function f) const noexcept -> void
+    {
+        VisitStorageOrder(elements_.data(), f);
+    }
+
+    /*!
+     * \brief  See MdSpan::ForEachTile(), over the whole array.
+     */
+    template <std::size_t... Block, typename Function>
+    constexpr auto ForEachTile(Function f) noexcept -> void
+    {
+        GetView().template ForEachTile<Block...>(f);
+    }
+
+    template <std::size_t... Block, typename Function>
+    constexpr auto ForEachTile(Function f) const noexcept -> void
+    {
+        GetView().template ForEachTile<Block...>(f);
+    }
+
+    /*!
+     * \brief  See MdSpan::ForEachBlocked(), over the whole array.
+     */
+    template <std::size_t... Block, typename Function>
+    constexpr auto ForEachBlocked(Function f) noexcept -> void
+    {
+        GetView().template ForEachBlocked<Block...>(f);
+    }
+
+    template <std::size_t... Block, typename Function>
+    constexpr auto ForEachBlocked(Function f) const noexcept -> void
+    {
+        GetView().template ForEachBlocked<Block...>(f);
+    }
+
+private:
+    static constexpr auto CheckIndex(const Index& index) noexcept -> void
+    {
+        for (std::size_t d = 0U; d < Mapping::kRank; ++d) {
+            if (index[d] >= Mapping::kExtents[d]) {
+                ara::core::internal::ReportArrayAccessOutOfRange(ARA_CORE_INTERNAL_FILELINE, index[d],
+                                                                 Mapping::kExtents[d]);
+            }
+        }
+    }
+
+    /*!
+     * \brief  Visits the tiles of the layout in row-major order and each tile in its own order; the offset of the
+     *         elements then just counts up.
+     */
+    template <typename Element, typename Function>
+    static constexpr auto VisitStorageOrder(Element* elements, Function& f) noexcept -> void
+    {
+        std::size_t offset{0U};
+        auto element = [elements, &offset, &f](const Index& index) noexcept { f(index, elements[offset++]); };
+        auto tile = [&element](const Index& origin, const Index& extents) noexcept {
+            Index index = origin;
+            internal::VisitBox<Mapping::kRowMajorInTile, 0U, Mapping::kRank>(index, origin, extents, element);
+        };
+        internal::VisitBlocks(Index{}, Mapping::kExtents, Mapping::kTile, tile);
+    }
+
+    Storage elements_{};
+};
+
+/**********************************************************************************************************************
+ *  TYPE ALIASES
+ *********************************************************************************************************************/
+/*!
+ * \brief  Row-major multi-dimensional array, e.g. MdArray<float, 480, 640> for an image of 480 rows of 640 pixels.
+ */
+template <typename T, std::size_t... Extents>
+using MdArray = BasicMdArray<T, LayoutRight, Extents...>;
+
+/*!
+ * \brief  Column-major multi-dimensional array.
+ */
+template <typename T, std::size_t... Extents>
+using ColMajorMdArray = BasicMdArray<T, LayoutLeft, Extents...>;
+
+/*!
+ * \brief  Swaps the elements of two arrays of the same type.
+ */
+template <typename T, typename Layout, std::size_t... Extents>
+constexpr auto swap(BasicMdArray<T, Layout, Extents...>& lhs, BasicMdArray<T, Layout, Extents...>& rhs) noexcept
+    -> void
+{
+    lhs.swap(rhs);
+}
+
+} // namespace core
+} // namespace ara
+
+#endif // OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_CORE_MD_ARRAY_H_
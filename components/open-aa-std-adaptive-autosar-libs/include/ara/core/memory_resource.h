@@ -0,0 +1,459 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project (CXX_STANDARD 17)
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara/core/memory_resource.h
+ *  \brief      Polymorphic memory resources and allocator for deterministic ara::core containers.
+ *
+ *  \details    This file defines ara::core::pmr, a no-exception counterpart of std::pmr tailored to the OpenAA
+ *              project:
+ *              - MemoryResource:            abstract resource; allocate() returns nullptr instead of throwing.
+ *              - NewDeleteResource():       global heap (startup use only).
+ *              - NullMemoryResource():      always fails; used as upstream to forbid any fallback allocation.
+ *              - MonotonicBufferResource:   bump allocation over a buffer, optionally growing from upstream.
+ *              - PoolResource:              fixed-size blocks carved from one upstream chunk, O(1) free list.
+ *              - ArenaResource:             fixed-capacity, resettable bump arena owning its storage.
+ *              - PolymorphicAllocator<T>:   allocator adaptor used by ara::core::Vector.
+ *
+ *              Resources are sized and (optionally) pre-faulted during initialization, so that the steady-state
+ *              cyclic loop performs no call to malloc and takes no page fault.
+ *
+ *  \note       [SWS_CORE_00040] (No exceptions used – allocation failures are reported by return value and turned
+ *              into Violations by the consuming container).
+ *********************************************************************************************************************/
+
+#ifndef OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_CORE_MEMORY_RESOURCE_H_
+#define OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_CORE_MEMORY_RESOURCE_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <cstddef>       // For std::size_t, std::max_align_t
+#include <cstdint>       // For std::uintptr_t
+#include <limits>        // For std::numeric_limits
+#include <type_traits>   // For std::is_nothrow_constructible_v
+#include <utility>       // For std::forward
+
+#include "ara/core/internal/violation_handler.h"  // For RecordNearMiss
+
+namespace ara {
+namespace core {
+namespace pmr {
+
+/**********************************************************************************************************************
+ *  CLASS: MemoryResource
+ *********************************************************************************************************************/
+/*!
+ * \brief  Abstract interface for polymorphic memory resources.
+ *
+ * \details
+ * - Mirrors std::pmr::memory_resource, except that allocate() reports exhaustion by returning nullptr.
+ * - Implementations are not required to be thread-safe unless documented otherwise.
+ */
+class MemoryResource {
+public:
+    /*!
+     * \brief  Default alignment, matching operator new.
+     */
+    static constexpr std::size_t kMaxAlign{alignof(std::max_align_t)};
+
+    /*!
+     * \brief  Virtual destructor for proper cleanup of derived classes.
+     */
+    virtual ~MemoryResource() = default;
+
+    /*!
+     * \brief  Allocates \c bytes with the requested \c alignment.
+     *
+     * \param  bytes      Number of bytes to allocate.
+     * \param  alignment  Required alignment (power of two).
+     * \return Pointer to the storage, or nullptr if the resource is exhausted. A refusal is counted as an OutOfMemory
+     *         near miss, once per call: resources reach their upstream through allocate_upstream(), which does not
+     *         count.
+     */
+    auto allocate(std::size_t bytes, std::size_t alignment = kMaxAlign) noexcept -> void*
+    {
+        void* const storage = do_allocate(bytes, alignment);
+        if (storage == nullptr) {
+            ara::core::internal::RecordNearMiss(ara::core::internal::ViolationKind::OutOfMemory);
+        }
+        return storage;
+    }
+
+    /*!
+     * \brief  Returns storage obtained from allocate() with the same \c bytes and \c alignment.
+     */
+    auto deallocate(void* p, std::size_t bytes, std::size_t alignment = kMaxAlign) noexcept -> void
+    {
+        do_deallocate(p, bytes, alignment);
+    }
+
+    /*!
+     * \brief  Returns whether memory allocated from \c *this can be deallocated through \c other and vice versa.
+     */
+    auto is_equal(const MemoryResource& other) const noexcept -> bool
+    {
+        return do_is_equal(other);
+    }
+
+protected:
+    MemoryResource() noexcept = default;
+    MemoryResource(const MemoryResource&) noexcept = default;
+    auto operator=(const MemoryResource&) noexcept -> MemoryResource& = default;
+
+    /*!
+     * \brief  Allocates from the \c upstream of a resource without counting a refusal as a near miss.
+     *
+     * \details The refusal reaches the caller of the outermost allocate(), which counts it.
+     */
+    static auto allocate_upstream(MemoryResource& upstream, std::size_t bytes, std::size_t alignment) noexcept
+        -> void*
+    {
+        return upstream.do_allocate(bytes, alignment);
+    }
+
+private:
+    virtual auto do_allocate(std::size_t bytes, std::size_t alignment) noexcept -> void* = 0;
+    virtual auto do_deallocate(void* p, std::size_t bytes, std::size_t alignment) noexcept -> void = 0;
+    virtual auto do_is_equal(const MemoryResource& other) const noexcept -> bool = 0;
+};
+
+/*!
+ * \brief  Two resources are equal if they are the same object or report is_equal().
+ */
+inline auto operator==(const MemoryResource& lhs, const MemoryResource& rhs) noexcept -> bool
+{
+    return (&lhs == &rhs) || lhs.is_equal(rhs);
+}
+
+inline auto operator!=(const MemoryResource& lhs, const MemoryResource& rhs) noexcept -> bool
+{
+    return !(lhs == rhs);
+}
+
+/**********************************************************************************************************************
+ *  SECTION: Global Resources
+ *********************************************************************************************************************/
+/*!
+ * \brief  Returns a resource that uses the global aligned, non-throwing operator new/delete.
+ *
+ * \note   Intended for the initialization phase only.
+ */
+auto NewDeleteResource() noexcept -> MemoryResource*;
+
+/*!
+ * \brief  Returns a resource whose allocate() always fails (returns nullptr).
+ *
+ * \details
+ * - Used as upstream of bounded resources: exhausting them then becomes a reported Violation instead of a silent
+ *   fallback to the heap.
+ */
+auto NullMemoryResource() noexcept -> MemoryResource*;
+
+/*!
+ * \brief  Returns the process-wide default resource (initially NewDeleteResource()).
+ *
+ * \note   Thread-safe.
+ */
+auto GetDefaultResource() noexcept -> MemoryResource*;
+
+/*!
+ * \brief  Replaces the process-wide default resource.
+ *
+ * \param  resource  The new default; nullptr restores NewDeleteResource().
+ * \return The previous default resource.
+ *
+ * \note   Thread-safe. Typically called once at the end of the initialization phase.
+ */
+auto SetDefaultResource(MemoryResource* resource) noexcept -> MemoryResource*;
+
+/*!
+ * \brief  Touches every page of [address, address + bytes) so that later accesses take no page fault.
+ *
+ * \param  address  Start of the region.
+ * \param  bytes    Size of the region.
+ *
+ * \details
+ * - Writes one zero byte per page; the region content is not otherwise modified by the caller's contract
+ *   (storage handed out by a resource has indeterminate content anyway).
+ */
+auto PrefaultMemory(void* address, std::size_t bytes) noexcept -> void;
+
+/**********************************************************************************************************************
+ *  CLASS: MonotonicBufferResource
+ *********************************************************************************************************************/
+/*!
+ * \brief  Bump-pointer resource over an initial buffer; deallocate() is a no-op; release() frees everything.
+ *
+ * \details
+ * - When the current buffer is exhausted, a new chunk (geometrically growing) is requested from upstream.
+ *   Pass NullMemoryResource() as upstream to make the initial buffer a hard limit.
+ * - Not thread-safe.
+ */
+class MonotonicBufferResource final : public MemoryResource {
+public:
+    /*!
+     * \brief  Constructs over \c buffer of \c bufferSize bytes, growing from \c upstream.
+     */
+    MonotonicBufferResource(void* buffer, std::size_t bufferSize,
+                            MemoryResource* upstream = GetDefaultResource()) noexcept;
+
+    /*!
+     * \brief  Constructs without an initial buffer; the first chunk of \c initialSize bytes comes from \c upstream.
+     */
+    explicit MonotonicBufferResource(std::size_t initialSize,
+                                     MemoryResource* upstream = GetDefaultResource()) noexcept;
+
+    MonotonicBufferResource(const MonotonicBufferResource&) = delete;
+    auto operator=(const MonotonicBufferResource&) -> MonotonicBufferResource& = delete;
+
+    /*!
+     * \brief  Releases all upstream chunks.
+     */
+    ~MonotonicBufferResource() override;
+
+    /*!
+     * \brief  Returns all chunks obtained from upstream and rewinds to the initial buffer.
+     */
+    auto release() noexcept -> void;
+
+    /*!
+     * \brief  Returns the upstream resource.
+     */
+    auto upstream_resource() const noexcept -> MemoryResource*
+    {
+        return upstream_;
+    }
+
+private:
+    /*! \brief Header placed at the start of every upstream chunk to chain them for release(). */
+    struct ChunkHeader {
+        ChunkHeader* next;
+        std::size_t  size;
+    };
+
+    auto do_allocate(std::size_t bytes, std::size_t alignment) noexcept -> void* override;
+    auto do_deallocate(void* p, std::size_t bytes, std::size_t alignment) noexcept -> void override;
+    auto do_is_equal(const MemoryResource& other) const noexcept -> bool override;
+
+    auto AllocateFromCurrent(std::size_t bytes, std::size_t alignment) noexcept -> void*;
+
+    MemoryResource* upstream_;
+    void*           initialBuffer_;
+    std::size_t     initialSize_;
+    char*           current_;
+    std::size_t     remaining_;
+    std::size_t     nextChunkSize_;
+    ChunkHeader*    chunks_;
+};
+
+/**********************************************************************************************************************
+ *  CLASS: PoolResource
+ *********************************************************************************************************************/
+/*!
+ * \brief  Fixed-size block pool carved from a single upstream chunk at construction.
+ *
+ * \details
+ * - allocate() and deallocate() are O(1) free-list operations on blocks of blockSize() bytes.
+ * - Requests larger than blockSize() or with stronger alignment than the block alignment fail (nullptr).
+ * - The pool never grows after construction. Not thread-safe.
+ */
+class PoolResource final : public MemoryResource {
+public:
+    /*!
+     * \brief  Creates \c blockCount blocks of at least \c blockSize bytes from \c upstream.
+     *
+     * \param  blockSize   Minimal usable size of one block.
+     * \param  blockCount  Number of blocks.
+     * \param  upstream    Resource providing the backing chunk.
+     * \param  prefault    Touch all pages of the chunk at construction.
+     */
+    PoolResource(std::size_t blockSize, std::size_t blockCount,
+                 MemoryResource* upstream = GetDefaultResource(), bool prefault = false) noexcept;
+
+    PoolResource(const PoolResource&) = delete;
+    auto operator=(const PoolResource&) -> PoolResource& = delete;
+
+    ~PoolResource() override;
+
+    /*! \brief Returns the usable size of one block. */
+    auto blockSize() const noexcept -> std::size_t { return blockSize_; }
+
+    /*! \brief Returns the number of blocks the pool was created with (0 if the upstream chunk was refused). */
+    auto blockCount() const noexcept -> std::size_t { return blockCount_; }
+
+    /*! \brief Returns the number of blocks currently free. */
+    auto freeBlocks() const noexcept -> std::size_t { return freeCount_; }
+
+private:
+    /*! \brief Free-list node stored in unused blocks. */
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+
+    auto do_allocate(std::size_t bytes, std::size_t alignment) noexcept -> void* override;
+    auto do_deallocate(void* p, std::size_t bytes, std::size_t alignment) noexcept -> void override;
+    auto do_is_equal(const MemoryResource& other) const noexcept -> bool override;
+
+    MemoryResource* upstream_;
+    std::size_t     blockSize_;
+    std::size_t     blockCount_;
+    std::size_t     freeCount_;
+    void*           chunk_;
+    std::size_t     chunkSize_;
+    FreeBlock*      freeList_;
+};
+
+/**********************************************************************************************************************
+ *  CLASS: ArenaResource
+ *********************************************************************************************************************/
+/*!
+ * \brief  Fixed-capacity bump arena that owns its storage and can be reset as a whole.
+ *
+ * \details
+ * - The storage is obtained once from upstream at construction (or provided by the caller) and optionally
+ *   pre-faulted; the arena never calls upstream again.
+ * - deallocate() is a no-op; reset() makes the whole capacity available again (e.g., once per cycle).
+ * - Exhaustion => allocate() returns nullptr, which ara::core containers report as a Violation.
+ * - Not thread-safe.
+ */
+class ArenaResource final : public MemoryResource {
+public:
+    /*!
+     * \brief  Creates an arena of \c capacity bytes obtained from \c upstream.
+     *
+     * \param  capacity  Size of the arena in bytes.
+     * \param  upstream  Resource providing the storage.
+     * \param  prefault  Touch all pages at construction.
+     */
+    explicit ArenaResource(std::size_t capacity, MemoryResource* upstream = GetDefaultResource(),
+                           bool prefault = false) noexcept;
+
+    /*!
+     * \brief  Creates an arena over caller-provided storage (e.g., a static buffer).
+     */
+    ArenaResource(void* buffer, std::size_t capacity, bool prefault = false) noexcept;
+
+    ArenaResource(const ArenaResource&) = delete;
+    auto operator=(const ArenaResource&) -> ArenaResource& = delete;
+
+    ~ArenaResource() override;
+
+    /*! \brief Makes the whole capacity available again. All previously returned storage becomes invalid. */
+    auto reset() noexcept -> void
+    {
+        used_ = 0U;
+    }
+
+    /*! \brief Touches every page of the arena storage. */
+    auto prefault() noexcept -> void
+    {
+        PrefaultMemory(buffer_, capacity_);
+    }
+
+    /*! \brief Total capacity in bytes (0 if upstream refused the storage). */
+    auto capacity() const noexcept -> std::size_t { return capacity_; }
+
+    /*! \brief Bytes currently handed out. */
+    auto used() const noexcept -> std::size_t { return used_; }
+
+    /*! \brief Highest value used() has reached since construction. */
+    auto highWaterMark() const noexcept -> std::size_t { return highWaterMark_; }
+
+private:
+    auto do_allocate(std::size_t bytes, std::size_t alignment) noexcept -> void* override;
+    auto do_deallocate(void* p, std::size_t bytes, std::size_t alignment) noexcept -> void override;
+    auto do_is_equal(const MemoryResource& other) const noexcept -> bool override;
+
+    MemoryResource* upstream_;
+    char*           buffer_;
+    std::size_t     capacity_;
+    std::size_t     used_;
+    std::size_t     highWaterMark_;
+};
+
+/**********************************************************************************************************************
+ *  CLASS: PolymorphicAllocator
+ *********************************************************************************************************************/
+/*!
+ * \brief  Allocator that forwards to a MemoryResource, fixed at construction.
+ *
+ * \tparam T  The value type.
+ *
+ * \details
+ * - Mirrors std::pmr::polymorphic_allocator: the resource does not propagate on container copy/move-assignment
+ *   or swap, and copy-construction of a container selects the default resource.
+ * - allocate() returns nullptr on exhaustion or size overflow; the container turns this into a Violation.
+ */
+template <typename T>
+class PolymorphicAllocator {
+public:
+    using value_type = T;
+
+    /*! \brief Uses GetDefaultResource(). */
+    PolymorphicAllocator() noexcept : resource_{GetDefaultResource()} {}
+
+    /*! \brief Uses \c resource (must not be nullptr). */
+    PolymorphicAllocator(MemoryResource* resource) noexcept : resource_{resource} {}
+
+    PolymorphicAllocator(const PolymorphicAllocator& other) noexcept = default;
+
+    template <typename U>
+    PolymorphicAllocator(const PolymorphicAllocator<U>& other) noexcept : resource_{other.resource()} {}
+
+    auto operator=(const PolymorphicAllocator&) -> PolymorphicAllocator& = delete;
+
+    /*!
+     * \brief  Allocates storage for \c n objects of T; nullptr on failure.
+     */
+    auto allocate(std::size_t n) noexcept -> T*
+    {
+        if (n > (std::numeric_limits<std::size_t>::max() / sizeof(T))) {
+            return nullptr;
+        }
+        return static_cast<T*>(resource_->allocate(n * sizeof(T), alignof(T)));
+    }
+
+    /*!
+     * \brief  Returns storage for \c n objects of T obtained from allocate().
+     */
+    auto deallocate(T* p, std::size_t n) noexcept -> void
+    {
+        resource_->deallocate(p, n * sizeof(T), alignof(T));
+    }
+
+    /*! \brief Returns the underlying resource. */
+    auto resource() const noexcept -> MemoryResource* { return resource_; }
+
+    /*! \brief A copy-constructed container uses the default resource, as with std::pmr. */
+    auto select_on_container_copy_construction() const noexcept -> PolymorphicAllocator
+    {
+        return PolymorphicAllocator();
+    }
+
+private:
+    MemoryResource* resource_;
+};
+
+template <typename T, typename U>
+inline auto operator==(const PolymorphicAllocator<T>& lhs, const PolymorphicAllocator<U>& rhs) noexcept -> bool
+{
+    return *lhs.resource() == *rhs.resource();
+}
+
+template <typename T, typename U>
+inline auto operator!=(const PolymorphicAllocator<T>& lhs, const PolymorphicAllocator<U>& rhs) noexcept -> bool
+{
+    return !(lhs == rhs);
+}
+
+} // namespace pmr
+} // namespace core
+} // namespace ara
+
+#endif // OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_CORE_MEMORY_RESOURCE_H_
@@ -0,0 +1,243 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project (CXX_STANDARD 17)
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara/core/parallel.h
+ *  \brief      Parallel for_each / transform / reduce over the contiguous ara::core containers.
+ *
+ *  \details    The algorithms accept any contiguous range with data() and size(): ara::core::Array, Span, Vector and
+ *              InplaceVector. They split the index range into tasks of \c grain elements on an ara::core::Executor
+ *              (Executor::Instance() unless one is passed) and return once every element was processed.
+ *
+ *              - grain 0 picks Executor::GetDefaultGrain(); a larger grain means fewer, longer tasks.
+ *              - While the executor is stopped, or the range fits in one grain, the algorithm runs serially on the
+ *                calling thread.
+ *              - reduce() combines per-chunk partial results in chunk order, so for a given range size, grain and
+ *                worker count the result does not depend on the thread timing (std::reduce semantics otherwise:
+ *                \c op must be associative).
+ *
+ *  \note       The element functions are invoked from noexcept tasks: a function that throws terminates the process.
+ *********************************************************************************************************************/
+
+#ifndef OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_CORE_PARALLEL_H_
+#define OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_CORE_PARALLEL_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <cstddef>       // For std::size_t
+#include <new>           // For placement new, std::launder
+#include <type_traits>   // For std::enable_if_t, std::void_t
+#include <utility>       // For std::declval, std::move
+
+#include "ara/core/executor.h"                    // For ara::core::Executor
+#include "ara/core/internal/location_utils.h"     // For capturing file/line details
+#include "ara/core/internal/violation_handler.h"  // To trigger the violation
+
+namespace ara {
+namespace core {
+namespace parallel {
+
+namespace internal {
+
+/**********************************************************************************************************************
+ *  SECTION: Range traits
+ *********************************************************************************************************************/
+/*!
+ * \brief  Trait: Range is a contiguous range (data() returning a pointer, and size()).
+ */
+template <typename Range, typename = void>
+struct IsContiguousRange : std::false_type {};
+
+template <typename Range>
+struct IsContiguousRange<Range, std::void_t<decltype(std::declval<Range&>().size()),
+                                            std::enable_if_t<std::is_pointer_v<decltype(std::declval<Range&>().data())>>>>
+    : std::true_type {};
+
+template <typename Range>
+using EnableIfRange = std::enable_if_t<IsContiguousRange<Range>::value, int>;
+
+/**********************************************************************************************************************
+ *  SECTION: Task contexts
+ *********************************************************************************************************************/
+template <typename Pointer, typename Function>
+struct ForEachContext {
+    Pointer   data;
+    Function* function;
+
+    static auto Run(void* context, std::size_t begin, std::size_t end) noexcept -> void
+    {
+        ForEachContext& self = *static_cast<ForEachContext*>(context);
+        for (std::size_t i = begin; i < end; ++i) {
+            (*self.function)(self.data[i]);
+        }
+    }
+};
+
+template <typename InputPointer, typename OutputPointer, typename Function>
+struct TransformContext {
+    InputPointer  input;
+    OutputPointer output;
+    Function*     function;
+
+    static auto Run(void* context, std::size_t begin, std::size_t end) noexcept -> void
+    {
+        TransformContext& self = *static_cast<TransformContext*>(context);
+        for (std::size_t i = begin; i < end; ++i) {
+            self.output[i] = (*self.function)(self.input[i]);
+        }
+    }
+};
+
+/*!
+ * \brief  Uninitialized partial result of one reduce() chunk, on its own cache line.
+ */
+template <typename T>
+struct alignas(ara::core::internal::kCacheLineSize) ReducePartial {
+    alignas(T) unsigned char bytes[sizeof(T)];
+
+    auto Get() noexcept -> T& { return *std::launder(reinterpret_cast<T*>(bytes)); }
+};
+
+template <typename Pointer, typename T, typename BinaryOp>
+struct ReduceContext {
+    Pointer              data;
+    std::size_t          count;
+    std::size_t          chunkSize;
+    BinaryOp*            op;
+    ReducePartial<T>*    partials;
+
+    /*!
+     * \brief  Folds the chunks [begin, end) into their partials (each chunk holds at least one element).
+     */
+    static auto Run(void* context, std::size_t begin, std::size_t end) noexcept -> void
+    {
+        ReduceContext& self = *static_cast<ReduceContext*>(context);
+        for (std::size_t chunk = begin; chunk < end; ++chunk) {
+            std::size_t const first = chunk * self.chunkSize;
+            std::size_t const last  = ((first + self.chunkSize) < self.count) ? (first + self.chunkSize) : self.count;
+            T value(self.data[first]);
+            for (std::size_t i = first + 1U; i < last; ++i) {
+                value = (*self.op)(std::move(value), self.data[i]);
+            }
+            ::new (static_cast<void*>(self.partials[chunk].bytes)) T(std::move(value));
+        }
+    }
+};
+
+} // namespace internal
+
+/*!
+ * \brief  Maximum number of chunks reduce() splits a range into (the partials are held on the caller's stack).
+ */
+constexpr std::size_t kMaxReduceChunks{64U};
+
+/**********************************************************************************************************************
+ *  FUNCTION: for_each
+ *********************************************************************************************************************/
+/*!
+ * \brief  Invokes function(element) for every element of \c range on the workers of \c executor.
+ */
+template <typename Range, typename Function, internal::EnableIfRange<Range> = 0>
+auto for_each(Executor& executor, Range& range, Function function, std::size_t grain = 0U) noexcept -> void
+{
+    using Context = internal::ForEachContext<decltype(range.data()), Function>;
+    Context context{range.data(), &function};
+    executor.ParallelFor(range.size(), grain, &Context::Run, &context);
+}
+
+/*!
+ * \brief  for_each() on Executor::Instance().
+ */
+template <typename Range, typename Function, internal::EnableIfRange<Range> = 0>
+auto for_each(Range& range, Function function, std::size_t grain = 0U) noexcept -> void
+{
+    for_each(Executor::Instance(), range, function, grain);
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: transform
+ *********************************************************************************************************************/
+/*!
+ * \brief  Stores function(input[i]) in output[i] for every element of \c input on the workers of \c executor.
+ *
+ * \note   An \c output shorter than \c input is reported through the ViolationHandler (ReportSpanAccessOutOfRange).
+ */
+template <typename InputRange, typename OutputRange, typename Function, internal::EnableIfRange<InputRange> = 0,
+          internal::EnableIfRange<OutputRange> = 0>
+auto transform(Executor& executor, const InputRange& input, OutputRange& output, Function function,
+               std::size_t grain = 0U) noexcept -> void
+{
+    if (output.size() < input.size()) {
+        ara::core::internal::ReportSpanAccessOutOfRange(ARA_CORE_INTERNAL_FILELINE, input.size(), output.size());
+    }
+    using Context = internal::TransformContext<decltype(input.data()), decltype(output.data()), Function>;
+    Context context{input.data(), output.data(), &function};
+    executor.ParallelFor(input.size(), grain, &Context::Run, &context);
+}
+
+/*!
+ * \brief  transform() on Executor::Instance().
+ */
+template <typename InputRange, typename OutputRange, typename Function, internal::EnableIfRange<InputRange> = 0,
+          internal::EnableIfRange<OutputRange> = 0>
+auto transform(const InputRange& input, OutputRange& output, Function function, std::size_t grain = 0U) noexcept
+    -> void
+{
+    transform(Executor::Instance(), input, output, function, grain);
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: reduce
+ *********************************************************************************************************************/
+/*!
+ * \brief  Folds \c range into \c init with \c op on the workers of \c executor.
+ *
+ * \details The range is cut into at most kMaxReduceChunks chunks of about \c grain elements; each chunk is folded
+ *          by one task, then the partials are folded into \c init in chunk order on the calling thread.
+ */
+template <typename Range, typename T, typename BinaryOp, internal::EnableIfRange<Range> = 0>
+auto reduce(Executor& executor, const Range& range, T init, BinaryOp op, std::size_t grain = 0U) noexcept -> T
+{
+    std::size_t const count = range.size();
+    if (count == 0U) {
+        return init;
+    }
+    std::size_t const chunkGrain = (grain == 0U) ? executor.GetDefaultGrain(count) : grain;
+    std::size_t chunks = (count + chunkGrain - 1U) / chunkGrain;
+    chunks = (chunks > kMaxReduceChunks) ? kMaxReduceChunks : chunks;
+    std::size_t const chunkSize = (count + chunks - 1U) / chunks;
+    chunks = (count + chunkSize - 1U) / chunkSize;
+
+    internal::ReducePartial<T> partials[kMaxReduceChunks];
+    using Context = internal::ReduceContext<decltype(range.data()), T, BinaryOp>;
+    Context context{range.data(), count, chunkSize, &op, partials};
+    executor.ParallelFor(chunks, 1U, &Context::Run, &context);
+
+    for (std::size_t chunk = 0U; chunk < chunks; ++chunk) {
+        T& partial = partials[chunk].Get();
+        init = op(std::move(init), std::move(partial));
+        partial.~T();
+    }
+    return init;
+}
+
+/*!
+ * \brief  reduce() on Executor::Instance().
+ */
+template <typename Range, typename T, typename BinaryOp, internal::EnableIfRange<Range> = 0>
+auto reduce(const Range& range, T init, BinaryOp op, std::size_t grain = 0U) noexcept -> T
+{
+    return reduce(Executor::Instance(), range, std::move(init), op, grain);
+}
+
+} // namespace parallel
+} // namespace core
+} // namespace ara
+
+#endif // OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_CORE_PARALLEL_H_
@@ -0,0 +1,344 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project (CXX_STANDARD 17)
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara/core/perfect_hash.h
+ *  \brief      Definition of the ara::core::PerfectHashMap constexpr lookup table for key sets fixed at compile time.
+ *
+ *  \details    PerfectHashMap<Key, T, N> maps N integral or enumeration keys, all known when the table is built, to
+ *              their values without collisions ("hash and displace"):
+ *              - The first hash of a key selects a bucket; every bucket stores a displacement seed.
+ *              - The second hash, seeded with the displacement, selects the slot, which holds key and value together.
+ *              - The constructor finds the displacements for the largest buckets first. It is constexpr, so a
+ *                constexpr table is searched by the compiler and costs nothing at startup.
+ *              A lookup computes two hashes and reads one displacement and one slot (at most two cache lines), with
+ *              a single key comparison. Empty slots hold a key that cannot hash to them, so no occupancy flag is
+ *              needed.
+ *
+ *  \note       This header is an OpenAA extension; it is not part of the AUTOSAR SWS.
+ *********************************************************************************************************************/
+
+#ifndef OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_CORE_PERFECT_HASH_H_
+#define OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_CORE_PERFECT_HASH_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <cstddef>       // For std::size_t
+#include <cstdint>       // For std::uint32_t, std::uint64_t
+#include <type_traits>   // For std::is_enum_v, std::is_integral_v, std::underlying_type_t
+#include <utility>       // For std::pair
+
+#include "ara/core/array.h"                       // For ara::core::Array
+#include "ara/core/internal/location_utils.h"     // For capturing file/line details
+#include "ara/core/internal/violation_handler.h"  // To trigger the violation
+
+namespace ara {
+namespace core {
+namespace internal {
+namespace perfect_hash {
+
+/**********************************************************************************************************************
+ *  SECTION: Hashing
+ *********************************************************************************************************************/
+/*!
+ * \brief  Smallest power of two not less than \c value (1 for 0).
+ */
+constexpr auto NextPowerOfTwo(std::size_t value) noexcept -> std::size_t
+{
+    std::size_t power = 1U;
+    while (power < value) {
+        power *= 2U;
+    }
+    return power;
+}
+
+/*!
+ * \brief  Mixes \c value with \c seed (multiply / xor-shift finalizer); every output bit depends on every input bit.
+ */
+constexpr auto Mix(std::uint64_t value, std::uint64_t seed) noexcept -> std::uint64_t
+{
+    value ^= seed;
+    value *= 0x9E3779B97F4A7C15ULL;
+    value ^= value >> 29U;
+    value *= 0xBF58476D1CE4E5B9ULL;
+    value ^= value >> 32U;
+    return value;
+}
+
+/*!
+ * \brief  The bits of an integral or enumeration key.
+ */
+template <typename Key>
+constexpr auto KeyBits(Key key) noexcept -> std::uint64_t
+{
+    if constexpr (std::is_enum_v<Key>) {
+        return static_cast<std::uint64_t>(static_cast<std::underlying_type_t<Key>>(key));
+    } else {
+        return static_cast<std::uint64_t>(key);
+    }
+}
+
+/*!
+ * \brief  Seed of the first-level (bucket) hash for attempt \c pilot.
+ */
+constexpr auto BucketSeed(std::uint32_t pilot) noexcept -> std::uint64_t
+{
+    return 0x5851F42D4C957F2DULL * (static_cast<std::uint64_t>(pilot) + 1U);
+}
+
+/*!
+ * \brief  Seed of the second-level (slot) hash for displacement \c displacement.
+ */
+constexpr auto SlotSeed(std::uint32_t displacement) noexcept -> std::uint64_t
+{
+    return 0x14057B7EF767814FULL * (static_cast<std::uint64_t>(displacement) + 1U);
+}
+
+/*!
+ * \brief  Number of displacements tried per bucket before the bucket hash is reseeded.
+ */
+constexpr std::uint32_t kMaxDisplacements = 4096U;
+
+/*!
+ * \brief  Number of bucket-hash seeds tried before construction fails.
+ */
+constexpr std::uint32_t kMaxPilots = 16U;
+
+} // namespace perfect_hash
+} // namespace internal
+
+/**********************************************************************************************************************
+ *  CLASS: PerfectHashMap
+ *********************************************************************************************************************/
+/*!
+ * \brief  Collision-free map of N integral or enumeration keys, built from a fixed set of entries.
+ *
+ * \tparam Key  Integral or enumeration key type.
+ * \tparam T    Mapped type (default constructible, nothrow copyable, as for ara::core::Array).
+ * \tparam N    Number of entries (> 0).
+ */
+template <typename Key, typename T, std::size_t N>
+class PerfectHashMap final {
+    static_assert(std::is_integral_v<Key> || std::is_enum_v<Key>,
+                  "ara::core::PerfectHashMap requires an integral or enumeration key");
+    static_assert(N > 0U, "ara::core::PerfectHashMap requires at least one entry");
+
+public:
+    using key_type    = Key;
+    using mapped_type = T;
+    using value_type  = std::pair<Key, T>;
+    using size_type   = std::size_t;
+
+    /*!
+     * \brief  Number of slots (a power of two, load factor between 1/3 and 2/3).
+     */
+    static constexpr std::size_t kSlotCount = internal::perfect_hash::NextPowerOfTwo(N + (N / 2U) + 1U);
+
+    /*!
+     * \brief  Number of buckets (a power of two, two keys per bucket on average).
+     */
+    static constexpr std::size_t kBucketCount = internal::perfect_hash::NextPowerOfTwo((N + 1U) / 2U);
+
+    /*!
+     * \brief  Builds the table; a duplicate key, or a key set for which no displacement is found, is a violation
+     *         (during constant evaluation it fails the compilation instead).
+     */
+    constexpr explicit PerfectHashMap(const value_type (&entries)[N]) noexcept
+    {
+        std::uint32_t pilot = 0U;
+        while (!TryBuild(entries, pilot)) {
+            ++pilot;
+            if (pilot == internal::perfect_hash::kMaxPilots) {
+                ara::core::internal::ReportInvalidState(ARA_CORE_INTERNAL_FILELINE,
+                                                        "ara::core::PerfectHashMap: no perfect hash found");
+            }
+        }
+    }
+
+    static constexpr auto size() noexcept -> size_type { return N; }
+
+    /*!
+     * \brief  The value mapped to \c key, or nullptr.
+     */
+    constexpr auto Find(Key key) const noexcept -> const T*
+    {
+        const Slot& slot = slots_[SlotOf(key)];
+        return (slot.key == key) ? &slot.value : nullptr;
+    }
+
+    /*!
+     * \brief  Whether \c key is in the map.
+     */
+    constexpr auto Contains(Key key) const noexcept -> bool { return slots_[SlotOf(key)].key == key; }
+
+    /*!
+     * \brief  The value mapped to \c key; a missing key is a violation.
+     */
+    constexpr auto at(Key key) const noexcept -> const T&
+    {
+        const Slot& slot = slots_[SlotOf(key)];
+        if (slot.key != key) {
+            ara::core::internal::ReportInvalidState(ARA_CORE_INTERNAL_FILELINE,
+                                                    "ara::core::PerfectHashMap::at: key not found");
+        }
+        return slot.value;
+    }
+
+private:
+    /*!
+     * \brief  Key and value side by side, so that a hit reads one cache line.
+     */
+    struct Slot {
+        Key key{};
+        T   value{};
+    };
+
+    constexpr auto BucketOf(Key key) const noexcept -> std::size_t
+    {
+        return BucketOf(key, pilot_);
+    }
+
+    static constexpr auto BucketOf(Key key, std::uint32_t pilot) noexcept -> std::size_t
+    {
+        std::uint64_t const hash = internal::perfect_hash::Mix(internal::perfect_hash::KeyBits(key),
+                                                               internal::perfect_hash::BucketSeed(pilot));
+        return static_cast<std::size_t>(hash & (kBucketCount - 1U));
+    }
+
+    static constexpr auto SlotOf(Key key, std::uint32_t displacement) noexcept -> std::size_t
+    {
+        std::uint64_t const hash = internal::perfect_hash::Mix(internal::perfect_hash::KeyBits(key),
+                                                               internal::perfect_hash::SlotSeed(displacement));
+        return static_cast<std::size_t>(hash & (kSlotCount - 1U));
+    }
+
+    constexpr auto SlotOf(Key key) const noexcept -> std::size_t
+    {
+        return SlotOf(key, displacements_[BucketOf(key)]);
+    }
+
+    /*!
+     * \brief  Places all entries with the bucket hash seeded by \c pilot; false if some bucket finds no displacement.
+     *
+     * \details The entries are grouped by bucket with a counting sort, so that the work outside the displacement
+     *          search stays linear and large tables remain within the constant-evaluation limits of the compiler.
+     */
+    constexpr auto TryBuild(const value_type (&entries)[N], std::uint32_t pilot) noexcept -> bool
+    {
+        Array<std::size_t, N> bucketOf{};
+        Array<std::size_t, kBucketCount + 1U> bucketStart{};
+        for (std::size_t i = 0U; i < N; ++i) {
+            bucketOf[i] = BucketOf(entries[i].first, pilot);
+            ++bucketStart[bucketOf[i] + 1U];
+        }
+        std::size_t largest = 0U;
+        for (std::size_t bucket = 0U; bucket < kBucketCount; ++bucket) {
+            largest = (bucketStart[bucket + 1U] > largest) ? bucketStart[bucket + 1U] : largest;
+            bucketStart[bucket + 1U] += bucketStart[bucket];
+        }
+        Array<std::size_t, N> members{};
+        Array<std::size_t, kBucketCount> cursor{};
+        for (std::size_t i = 0U; i < N; ++i) {
+            std::size_t const bucket = bucketOf[i];
+            members[bucketStart[bucket] + cursor[bucket]] = i;
+            ++cursor[bucket];
+        }
+
+        Array<bool, kSlotCount> taken{};
+        displacements_.fill(0U);
+
+        // Largest buckets first: they are the hardest to place while the table is still empty
+        for (std::size_t size = largest; size > 0U; --size) {
+            for (std::size_t bucket = 0U; bucket < kBucketCount; ++bucket) {
+                std::size_t const first = bucketStart[bucket];
+                if ((bucketStart[bucket + 1U] - first) != size) {
+                    continue;
+                }
+                if (!PlaceBucket(entries, members, first, size, taken, bucket)) {
+                    return false;
+                }
+            }
+        }
+
+        // Empty slots hold the first key, which hashes to its own (occupied) slot and so never matches there
+        for (Slot& slot : slots_) {
+            slot = Slot{entries[0].first, T{}};
+        }
+        for (std::size_t i = 0U; i < N; ++i) {
+            slots_[SlotOf(entries[i].first, displacements_[bucketOf[i]])] = Slot{entries[i].first, entries[i].second};
+        }
+        pilot_ = pilot;
+        return true;
+    }
+
+    /*!
+     * \brief  Finds a displacement that sends the \c count entries members[first, first + count) of \c bucket to
+     *         distinct free slots.
+     *
+     * \note   Equal keys always share a bucket, so duplicates are detected here.
+     */
+    constexpr auto PlaceBucket(const value_type (&entries)[N], const Array<std::size_t, N>& members,
+                               std::size_t first, std::size_t count, Array<bool, kSlotCount>& taken,
+                               std::size_t bucket) noexcept -> bool
+    {
+        for (std::size_t m = 1U; m < count; ++m) {
+            for (std::size_t previous = 0U; previous < m; ++previous) {
+                if (entries[members[first + m]].first == entries[members[first + previous]].first) {
+                    ara::core::internal::ReportInvalidState(ARA_CORE_INTERNAL_FILELINE,
+                                                            "ara::core::PerfectHashMap: duplicate key");
+                }
+            }
+        }
+
+        Array<std::size_t, N> slots{};
+        for (std::uint32_t displacement = 0U; displacement < internal::perfect_hash::kMaxDisplacements;
+             ++displacement) {
+            bool fits = true;
+            for (std::size_t m = 0U; fits && (m < count); ++m) {
+                std::size_t const slot = SlotOf(entries[members[first + m]].first, displacement);
+                fits = !taken[slot];
+                for (std::size_t previous = 0U; fits && (previous < m); ++previous) {
+                    fits = (slots[previous] != slot);
+                }
+                slots[m] = slot;
+            }
+            if (fits) {
+                for (std::size_t m = 0U; m < count; ++m) {
+                    taken[slots[m]] = true;
+                }
+                displacements_[bucket] = displacement;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    Array<std::uint32_t, kBucketCount> displacements_{};
+    Array<Slot, kSlotCount>            slots_{};
+    std::uint32_t                      pilot_{0U};
+};
+
+/*!
+ * \brief  PerfectHashMap of the given entries, with N deduced from their number.
+ *
+ * \details Usable for constexpr tables:
+ *
+ *              constexpr auto kNames = ara::core::MakePerfectHashMap<int, const char*>({{SIGTERM, "SIGTERM"},
+ *                                                                                       {SIGINT, "SIGINT"}});
+ */
+template <typename Key, typename T, std::size_t N>
+constexpr auto MakePerfectHashMap(const std::pair<Key, T> (&entries)[N]) noexcept -> PerfectHashMap<Key, T, N>
+{
+    return PerfectHashMap<Key, T, N>{entries};
+}
+
+} // namespace core
+} // namespace ara
+
+#endif // OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_CORE_PERFECT_HASH_H_
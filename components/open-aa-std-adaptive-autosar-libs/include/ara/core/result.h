@@ -0,0 +1,270 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project (CXX_STANDARD 17)
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara/core/result.h
+ *  \brief      Definition of the ara::core::Result template class.
+ *
+ *  \details    ara::core::Result<T, E> holds either a value of type T or an error of type E, in place and without
+ *              exceptions. Result<void, E> holds either nothing (success) or an error.
+ *
+ *              Reading the value of a Result that holds an error (or the error of one that holds a value) is reported
+ *              through the ViolationHandler instead of throwing.
+ *
+ *  \note       Based on the Adaptive AUTOSAR SWS (e.g., R24-11) requirements for the "Result" type, especially:
+ *              - [SWS_CORE_00701] (Definition of ara::core::Result)
+ *              - [SWS_CORE_00801] (Result<void, E>)
+ *              ara::core has no ErrorCode class yet, so E has no default and the *OrThrow() members are omitted.
+ *********************************************************************************************************************/
+
+#ifndef OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_CORE_RESULT_H_
+#define OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_CORE_RESULT_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <optional>      // For std::optional (Result<void, E>)
+#include <type_traits>   // For std::is_same_v, std::is_reference_v
+#include <utility>       // For std::move, std::forward, std::in_place_index
+#include <variant>       // For std::variant
+
+#include "ara/core/internal/location_utils.h"     // For capturing file/line details
+#include "ara/core/internal/violation_handler.h"  // To trigger the violation
+
+namespace ara {
+namespace core {
+
+/**********************************************************************************************************************
+ *  CLASS: Result
+ *********************************************************************************************************************/
+/*!
+ * \brief  Value of type T or error of type E.
+ *
+ * \details The value and the error are held in one std::variant (no heap). T and E must differ, so that the
+ *          implicit value and explicit error constructors stay distinct.
+ *
+ * \note   [SWS_CORE_00701]
+ */
+template <typename T, typename E>
+class Result final {
+    static_assert(!std::is_reference_v<T> && !std::is_reference_v<E>, "ara::core::Result: no reference types");
+    static_assert(!std::is_same_v<T, E>, "ara::core::Result: T and E must be different types");
+
+public:
+    using value_type = T;
+    using error_type = E;
+
+    /*!
+     * \brief  Result holding a copy of \c value.
+     */
+    Result(const T& value) noexcept(std::is_nothrow_copy_constructible_v<T>)  // NOLINT: implicit by design
+        : storage_{std::in_place_index<0U>, value}
+    {
+    }
+
+    /*!
+     * \brief  Result holding \c value.
+     */
+    Result(T&& value) noexcept(std::is_nothrow_move_constructible_v<T>)  // NOLINT: implicit by design
+        : storage_{std::in_place_index<0U>, std::move(value)}
+    {
+    }
+
+    /*!
+     * \brief  Result holding a copy of \c error.
+     */
+    explicit Result(const E& error) noexcept(std::is_nothrow_copy_constructible_v<E>)
+        : storage_{std::in_place_index<1U>, error}
+    {
+    }
+
+    /*!
+     * \brief  Result holding \c error.
+     */
+    explicit Result(E&& error) noexcept(std::is_nothrow_move_constructible_v<E>)
+        : storage_{std::in_place_index<1U>, std::move(error)}
+    {
+    }
+
+    /*!
+     * \brief  Builds a Result holding a value constructed from \c args.
+     */
+    template <typename... Args>
+    static auto FromValue(Args&&... args) noexcept -> Result
+    {
+        return Result{std::in_place_index<0U>, std::forward<Args>(args)...};
+    }
+
+    /*!
+     * \brief  Builds a Result holding an error constructed from \c args.
+     */
+    template <typename... Args>
+    static auto FromError(Args&&... args) noexcept -> Result
+    {
+        return Result{std::in_place_index<1U>, std::forward<Args>(args)...};
+    }
+
+    /*!
+     * \brief  Whether the Result holds a value.
+     */
+    auto HasValue() const noexcept -> bool { return storage_.index() == 0U; }
+
+    explicit operator bool() const noexcept { return HasValue(); }
+
+    /*!
+     * \brief  The value; holding an error is a violation.
+     */
+    auto Value() const& noexcept -> const T&
+    {
+        CheckValue();
+        return *std::get_if<0U>(&storage_);
+    }
+
+    auto Value() & noexcept -> T&
+    {
+        CheckValue();
+        return *std::get_if<0U>(&storage_);
+    }
+
+    auto Value() && noexcept -> T&&
+    {
+        CheckValue();
+        return std::move(*std::get_if<0U>(&storage_));
+    }
+
+    auto operator*() const& noexcept -> const T& { return Value(); }
+    auto operator*() & noexcept -> T& { return Value(); }
+    auto operator*() && noexcept -> T&& { return std::move(*this).Value(); }
+    auto operator->() const noexcept -> const T* { return &Value(); }
+    auto operator->() noexcept -> T* { return &Value(); }
+
+    /*!
+     * \brief  The error; holding a value is a violation.
+     */
+    auto Error() const& noexcept -> const E&
+    {
+        CheckError();
+        return *std::get_if<1U>(&storage_);
+    }
+
+    auto Error() && noexcept -> E&&
+    {
+        CheckError();
+        return std::move(*std::get_if<1U>(&storage_));
+    }
+
+    /*!
+     * \brief  The value, or \c defaultValue converted to T if the Result holds an error.
+     */
+    template <typename U>
+    auto ValueOr(U&& defaultValue) const& noexcept -> T
+    {
+        return HasValue() ? *std::get_if<0U>(&storage_) : static_cast<T>(std::forward<U>(defaultValue));
+    }
+
+    template <typename U>
+    auto ValueOr(U&& defaultValue) && noexcept -> T
+    {
+        return HasValue() ? std::move(*std::get_if<0U>(&storage_)) : static_cast<T>(std::forward<U>(defaultValue));
+    }
+
+private:
+    template <std::size_t I, typename... Args>
+    explicit Result(std::in_place_index_t<I> index, Args&&... args) noexcept
+        : storage_{index, std::forward<Args>(args)...}
+    {
+    }
+
+    auto CheckValue() const noexcept -> void
+    {
+        if (!HasValue()) {
+            ara::core::internal::ReportInvalidState(ARA_CORE_INTERNAL_FILELINE, "Result::Value() on an error");
+        }
+    }
+
+    auto CheckError() const noexcept -> void
+    {
+        if (HasValue()) {
+            ara::core::internal::ReportInvalidState(ARA_CORE_INTERNAL_FILELINE, "Result::Error() on a value");
+        }
+    }
+
+    std::variant<T, E> storage_;
+};
+
+/**********************************************************************************************************************
+ *  CLASS: Result<void, E>
+ *********************************************************************************************************************/
+/*!
+ * \brief  Success or error of type E.
+ *
+ * \note   [SWS_CORE_00801]
+ */
+template <typename E>
+class Result<void, E> final {
+public:
+    using value_type = void;
+    using error_type = E;
+
+    /*!
+     * \brief  Successful Result.
+     */
+    Result() noexcept = default;
+
+    explicit Result(const E& error) noexcept(std::is_nothrow_copy_constructible_v<E>) : error_{error} {}
+    explicit Result(E&& error) noexcept(std::is_nothrow_move_constructible_v<E>) : error_{std::move(error)} {}
+
+    static auto FromValue() noexcept -> Result { return Result{}; }
+
+    template <typename... Args>
+    static auto FromError(Args&&... args) noexcept -> Result
+    {
+        return Result{E(std::forward<Args>(args)...)};
+    }
+
+    auto HasValue() const noexcept -> bool { return !error_.has_value(); }
+
+    explicit operator bool() const noexcept { return HasValue(); }
+
+    /*!
+     * \brief  Checks that the Result is successful; holding an error is a violation.
+     */
+    auto Value() const noexcept -> void
+    {
+        if (!HasValue()) {
+            ara::core::internal::ReportInvalidState(ARA_CORE_INTERNAL_FILELINE, "Result::Value() on an error");
+        }
+    }
+
+    auto Error() const& noexcept -> const E&
+    {
+        CheckError();
+        return *error_;
+    }
+
+    auto Error() && noexcept -> E&&
+    {
+        CheckError();
+        return std::move(*error_);
+    }
+
+private:
+    auto CheckError() const noexcept -> void
+    {
+        if (HasValue()) {
+            ara::core::internal::ReportInvalidState(ARA_CORE_INTERNAL_FILELINE, "Result::Error() on a value");
+        }
+    }
+
+    std::optional<E> error_{};
+};
+
+} // namespace core
+} // namespace ara
+
+#endif // OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_CORE_RESULT_H_
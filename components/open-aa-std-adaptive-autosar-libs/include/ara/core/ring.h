@@ -0,0 +1,495 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project (CXX_STANDARD 17)
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara/core/ring.h
+ *  \brief      Definition of the lock-free ring buffers ara::core::SpscRing and ara::core::MpmcRing.
+ *
+ *  \details    Both rings are bounded FIFO queues of N elements (N a power of two) held in place, without heap
+ *              allocation: as in ArrayStorage, the N slots are an in-place array value-initialized with the ring,
+ *              and they are reused by move assignment (move-only element types are supported). No operation blocks: a push on a full ring or a pop on an empty ring returns false (or 0
+ *              for the batch operations) immediately, so the rings can connect real-time threads.
+ *
+ *              - SpscRing<T, N>: exactly one producer thread and one consumer thread. Wait-free; one release store
+ *                per push or pop (per batch for PushBatch / PopBatch).
+ *              - MpmcRing<T, N>: any number of producers and consumers (bounded queue with per-slot sequence
+ *                numbers). Lock-free; one compare-and-swap per push or pop (per batch for PushBatch / PopBatch).
+ *
+ *              The producer and consumer indices sit on separate cache lines (kCacheLineSize) so the two sides do not
+ *              invalidate each other's line on every operation. The indices are free-running 64-bit counters masked
+ *              with N - 1, so wrap-around needs no branch.
+ *
+ *  \note       T must be default constructible and nothrow move assignable (the slots are live objects).
+ *********************************************************************************************************************/
+
+#ifndef OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_CORE_RING_H_
+#define OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_CORE_RING_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <atomic>        // For std::atomic
+#include <cstddef>       // For std::size_t, std::ptrdiff_t
+#include <type_traits>   // For std::is_default_constructible_v, std::is_nothrow_move_assignable_v
+#include <utility>       // For std::move, std::forward
+
+#include "ara/core/interference_size.h"  // For ara::core::kDestructiveInterferenceSize
+
+namespace ara {
+namespace core {
+
+namespace internal {
+
+/*!
+ * \brief  Distance that keeps producer and consumer state off each other's cache lines.
+ */
+constexpr std::size_t kCacheLineSize{kDestructiveInterferenceSize};
+
+/*!
+ * \brief  Whether \c value is a non-zero power of two.
+ */
+constexpr auto IsPowerOfTwo(std::size_t value) noexcept -> bool
+{
+    return (value != 0U) && ((value & (value - 1U)) == 0U);
+}
+
+} // namespace internal
+
+/**********************************************************************************************************************
+ *  CLASS: SpscRing
+ *********************************************************************************************************************/
+/*!
+ * \brief  Wait-free single-producer/single-consumer ring buffer of N elements of type T.
+ *
+ * \tparam T  Element type (default constructible, nothrow move assignable).
+ * \tparam N  Capacity (power of two).
+ *
+ * \details
+ * - Push operations (TryPush, PushBatch) may only be called by one thread at a time, pop operations (TryPop,
+ *   PopBatch) by one other thread at a time.
+ * - Each side caches the last index it read from the other side and only reloads it (one shared cache line
+ *   transfer) when the ring looks full or empty.
+ */
+template <typename T, std::size_t N>
+class alignas(internal::kCacheLineSize) SpscRing final {
+    static_assert(internal::IsPowerOfTwo(N), "ara::core::SpscRing: N must be a power of two");
+    static_assert(std::is_default_constructible_v<T>, "ara::core::SpscRing: T must be default constructible");
+    static_assert(std::is_nothrow_move_assignable_v<T>, "ara::core::SpscRing: T must be nothrow move assignable");
+
+public:
+    using value_type = T;
+    using size_type  = std::size_t;
+
+    constexpr SpscRing() noexcept = default;
+
+    SpscRing(const SpscRing&) = delete;
+    SpscRing(SpscRing&&) = delete;
+    auto operator=(const SpscRing&) -> SpscRing& = delete;
+    auto operator=(SpscRing&&) -> SpscRing& = delete;
+
+    /*!
+     * \brief  Maximum number of elements in the ring.
+     */
+    static constexpr auto Capacity() noexcept -> size_type
+    {
+        return N;
+    }
+
+    /*!
+     * \brief  Appends a copy of \c value (producer).
+     *
+     * \return false if the ring is full.
+     */
+    auto TryPush(const T& value) noexcept(std::is_nothrow_copy_assignable_v<T>) -> bool
+    {
+        return Emplace(value);
+    }
+
+    /*!
+     * \brief  Appends \c value by move (producer).
+     *
+     * \return false if the ring is full (\c value is left untouched).
+     */
+    auto TryPush(T&& value) noexcept -> bool
+    {
+        return Emplace(std::move(value));
+    }
+
+    /*!
+     * \brief  Removes the oldest element into \c out (consumer).
+     *
+     * \return false if the ring is empty (\c out is left untouched).
+     */
+    auto TryPop(T& out) noexcept -> bool
+    {
+        size_type const head = consumer_.index.load(std::memory_order_relaxed);
+        if (head == consumer_.cachedOther) {
+            consumer_.cachedOther = producer_.index.load(std::memory_order_acquire);
+            if (head == consumer_.cachedOther) {
+                return false;
+            }
+        }
+        out = std::move(slots_[head & kMask]);
+        consumer_.index.store(head + 1U, std::memory_order_release);
+        return true;
+    }
+
+    /*!
+     * \brief  Appends copies of up to \c count elements of \c items, in order (producer).
+     *
+     * \return Number of elements appended (less than \c count if the ring became full).
+     */
+    auto PushBatch(const T* items, size_type count) noexcept(std::is_nothrow_copy_assignable_v<T>) -> size_type
+    {
+        size_type const tail = producer_.index.load(std::memory_order_relaxed);
+        size_type available = N - (tail - producer_.cachedOther);
+        if (available < count) {
+            producer_.cachedOther = consumer_.index.load(std::memory_order_acquire);
+            available = N - (tail - producer_.cachedOther);
+        }
+
+        size_type const pushed = (count < available) ? count : available;
+        for (size_type i = 0U; i < pushed; ++i) {
+            slots_[(tail + i) & kMask] = items[i];
+        }
+        if (pushed > 0U) {
+            producer_.index.store(tail + pushed, std::memory_order_release);
+        }
+        return pushed;
+    }
+
+    /*!
+     * \brief  Removes up to \c maxCount of the oldest elements into \c out, in order (consumer).
+     *
+     * \return Number of elements removed.
+     */
+    auto PopBatch(T* out, size_type maxCount) noexcept -> size_type
+    {
+        size_type const head = consumer_.index.load(std::memory_order_relaxed);
+        size_type filled = consumer_.cachedOther - head;
+        if (filled < maxCount) {
+            consumer_.cachedOther = producer_.index.load(std::memory_order_acquire);
+            filled = consumer_.cachedOther - head;
+        }
+
+        size_type const popped = (maxCount < filled) ? maxCount : filled;
+        for (size_type i = 0U; i < popped; ++i) {
+            out[i] = std::move(slots_[(head + i) & kMask]);
+        }
+        if (popped > 0U) {
+            consumer_.index.store(head + popped, std::memory_order_release);
+        }
+        return popped;
+    }
+
+    /*!
+     * \brief  Number of elements in the ring (exact only when neither side is active).
+     */
+    auto Size() const noexcept -> size_type
+    {
+        size_type const head = consumer_.index.load(std::memory_order_acquire);
+        size_type const tail = producer_.index.load(std::memory_order_acquire);
+        return (tail >= head) ? (tail - head) : 0U;
+    }
+
+    /*!
+     * \brief  Whether the ring holds no element (see Size()).
+     */
+    auto IsEmpty() const noexcept -> bool
+    {
+        return Size() == 0U;
+    }
+
+private:
+    static constexpr size_type kMask{N - 1U};
+
+    /*!
+     * \brief  Index owned by one side plus its cached copy of the other side's index, on a cache line of its own.
+     */
+    struct alignas(internal::kCacheLineSize) Side {
+        std::atomic<size_type> index{0U};
+        size_type              cachedOther{0U};
+    };
+
+    template <typename U>
+    auto Emplace(U&& value) noexcept(std::is_nothrow_assignable_v<T&, U&&>) -> bool
+    {
+        size_type const tail = producer_.index.load(std::memory_order_relaxed);
+        if ((tail - producer_.cachedOther) == N) {
+            producer_.cachedOther = consumer_.index.load(std::memory_order_acquire);
+            if ((tail - producer_.cachedOther) == N) {
+                return false;
+            }
+        }
+        slots_[tail & kMask] = std::forward<U>(value);
+        producer_.index.store(tail + 1U, std::memory_order_release);
+        return true;
+    }
+
+    Side           producer_{};    /*!< Tail (next slot to write) and cached head */
+    Side           consumer_{};    /*!< Head (next slot to read) and cached tail */
+    T              slots_[N]{};
+};
+
+/**********************************************************************************************************************
+ *  CLASS: MpmcRing
+ *********************************************************************************************************************/
+/*!
+ * \brief  Lock-free multi-producer/multi-consumer ring buffer of N elements of type T.
+ *
+ * \tparam T  Element type (default constructible, nothrow move assignable).
+ * \tparam N  Capacity (power of two).
+ *
+ * \details
+ * - Every slot carries a sequence number: a slot at position p is free for the producer of p when its sequence is
+ *   p, and holds the element of p for the consumer of p when its sequence is p + 1. Producers and consumers claim
+ *   positions with a compare-and-swap on the shared tail / head and then access their slots exclusively.
+ * - PushBatch / PopBatch claim a run of consecutive positions with a single compare-and-swap.
+ * - A producer or consumer preempted between its claim and its publish delays the elements behind it (they become
+ *   visible in order); no thread ever waits on a lock.
+ */
+template <typename T, std::size_t N>
+class alignas(internal::kCacheLineSize) MpmcRing final {
+    static_assert(internal::IsPowerOfTwo(N), "ara::core::MpmcRing: N must be a power of two");
+    static_assert(std::is_default_constructible_v<T>, "ara::core::MpmcRing: T must be default constructible");
+    static_assert(std::is_nothrow_move_assignable_v<T>, "ara::core::MpmcRing: T must be nothrow move assignable");
+
+public:
+    using value_type = T;
+    using size_type  = std::size_t;
+
+    /*!
+     * \brief  Creates an empty ring (slot i starts with sequence i).
+     */
+    MpmcRing() noexcept
+    {
+        for (size_type i = 0U; i < N; ++i) {
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    MpmcRing(const MpmcRing&) = delete;
+    MpmcRing(MpmcRing&&) = delete;
+    auto operator=(const MpmcRing&) -> MpmcRing& = delete;
+    auto operator=(MpmcRing&&) -> MpmcRing& = delete;
+
+    /*!
+     * \brief  Maximum number of elements in the ring.
+     */
+    static constexpr auto Capacity() noexcept -> size_type
+    {
+        return N;
+    }
+
+    /*!
+     * \brief  Appends a copy of \c value.
+     *
+     * \return false if the ring is full.
+     */
+    auto TryPush(const T& value) noexcept(std::is_nothrow_copy_assignable_v<T>) -> bool
+    {
+        return Emplace(value);
+    }
+
+    /*!
+     * \brief  Appends \c value by move.
+     *
+     * \return false if the ring is full (\c value is left untouched).
+     */
+    auto TryPush(T&& value) noexcept -> bool
+    {
+        return Emplace(std::move(value));
+    }
+
+    /*!
+     * \brief  Removes the oldest element into \c out.
+     *
+     * \return false if the ring is empty (\c out is left untouched).
+     */
+    auto TryPop(T& out) noexcept -> bool
+    {
+        size_type const position = Claim(head_.index, 1U);
+        if (position == kNone) {
+            return false;
+        }
+        Release(position, out);
+        return true;
+    }
+
+    /*!
+     * \brief  Appends copies of up to \c count elements of \c items as one run of consecutive positions.
+     *
+     * \return Number of elements appended (less than \c count if the ring became full).
+     */
+    auto PushBatch(const T* items, size_type count) noexcept(std::is_nothrow_copy_assignable_v<T>) -> size_type
+    {
+        size_type claimed = (count < N) ? count : N;
+        size_type const position = ClaimRun(tail_.index, claimed, 0U);
+        for (size_type i = 0U; i < claimed; ++i) {
+            Cell& cell = cells_[(position + i) & kMask];
+            cell.value = items[i];
+            cell.sequence.store(position + i + 1U, std::memory_order_release);
+        }
+        return claimed;
+    }
+
+    /*!
+     * \brief  Removes up to \c maxCount of the oldest elements into \c out as one run of consecutive positions.
+     *
+     * \return Number of elements removed.
+     */
+    auto PopBatch(T* out, size_type maxCount) noexcept -> size_type
+    {
+        size_type claimed = (maxCount < N) ? maxCount : N;
+        size_type const position = ClaimRun(head_.index, claimed, 1U);
+        for (size_type i = 0U; i < claimed; ++i) {
+            Release(position + i, out[i]);
+        }
+        return claimed;
+    }
+
+    /*!
+     * \brief  Number of elements in the ring (approximate while other threads are active).
+     */
+    auto Size() const noexcept -> size_type
+    {
+        size_type const head = head_.index.load(std::memory_order_acquire);
+        size_type const tail = tail_.index.load(std::memory_order_acquire);
+        return (tail >= head) ? (tail - head) : 0U;
+    }
+
+    /*!
+     * \brief  Whether the ring holds no element (see Size()).
+     */
+    auto IsEmpty() const noexcept -> bool
+    {
+        return Size() == 0U;
+    }
+
+private:
+    static constexpr size_type kMask{N - 1U};
+    static constexpr size_type kNone{~size_type{0U}};
+
+    /*!
+     * \brief  One slot: the element and the sequence number that grants access to it.
+     */
+    struct Cell {
+        std::atomic<size_type> sequence{0U};
+        T                      value{};
+    };
+
+    /*!
+     * \brief  Shared position counter (tail for producers, head for consumers) on a cache line of its own.
+     */
+    struct alignas(internal::kCacheLineSize) Index {
+        std::atomic<size_type> index{0U};
+    };
+
+    /*!
+     * \brief  Signed distance between the sequence of a slot and the sequence expected for \c position.
+     */
+    static auto Distance(size_type sequence, size_type expected) noexcept -> std::ptrdiff_t
+    {
+        return static_cast<std::ptrdiff_t>(sequence - expected);
+    }
+
+    /*!
+     * \brief  Claims one position on \c counter whose slot sequence is position + \c offset.
+     *
+     * \return The claimed position, or kNone if the ring is full (offset 0) or empty (offset 1).
+     */
+    auto Claim(std::atomic<size_type>& counter, size_type offset) noexcept -> size_type
+    {
+        size_type position = counter.load(std::memory_order_relaxed);
+        for (;;) {
+            std::ptrdiff_t const distance =
+                Distance(cells_[position & kMask].sequence.load(std::memory_order_acquire), position + offset);
+            if (distance == 0) {
+                if (counter.compare_exchange_weak(position, position + 1U, std::memory_order_relaxed)) {
+                    return position;
+                }
+            } else if (distance < 0) {
+                return kNone;
+            } else {
+                position = counter.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /*!
+     * \brief  Claims the longest run of up to \c count consecutive ready positions on \c counter.
+     *
+     * \param[in,out] count  Requested length on input, claimed length (possibly 0) on output.
+     * \return The first claimed position (meaningless if \c count is 0).
+     */
+    auto ClaimRun(std::atomic<size_type>& counter, size_type& count, size_type offset) noexcept -> size_type
+    {
+        size_type position = counter.load(std::memory_order_relaxed);
+        for (;;) {
+            size_type ready = 0U;
+            bool stale = false;
+            while (ready < count) {
+                std::ptrdiff_t const distance = Distance(
+                    cells_[(position + ready) & kMask].sequence.load(std::memory_order_acquire),
+                    position + ready + offset);
+                if (distance != 0) {
+                    // Ahead: another thread already claimed this position, so our view of the counter is stale
+                    stale = (distance > 0);
+                    break;
+                }
+                ++ready;
+            }
+
+            if (stale && (ready == 0U)) {
+                position = counter.load(std::memory_order_relaxed);
+                continue;
+            }
+            if (ready == 0U) {
+                count = 0U;
+                return position;
+            }
+            // The checked slots stay ready until claimed: their sequence only advances after a claim through counter
+            if (counter.compare_exchange_weak(position, position + ready, std::memory_order_relaxed)) {
+                count = ready;
+                return position;
+            }
+        }
+    }
+
+    template <typename U>
+    auto Emplace(U&& value) noexcept(std::is_nothrow_assignable_v<T&, U&&>) -> bool
+    {
+        size_type const position = Claim(tail_.index, 0U);
+        if (position == kNone) {
+            return false;
+        }
+        Cell& cell = cells_[position & kMask];
+        cell.value = std::forward<U>(value);
+        cell.sequence.store(position + 1U, std::memory_order_release);
+        return true;
+    }
+
+    /*!
+     * \brief  Moves the element of the claimed \c position into \c out and frees the slot for the next lap.
+     */
+    auto Release(size_type position, T& out) noexcept -> void
+    {
+        Cell& cell = cells_[position & kMask];
+        out = std::move(cell.value);
+        cell.sequence.store(position + N, std::memory_order_release);
+    }
+
+    Index tail_{};      /*!< Next position to write */
+    Index head_{};      /*!< Next position to read */
+    Cell  cells_[N]{};
+};
+
+} // namespace core
+} // namespace ara
+
+#endif // OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_CORE_RING_H_
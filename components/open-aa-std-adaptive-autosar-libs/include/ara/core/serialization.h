@@ -0,0 +1,448 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project (CXX_STANDARD 17)
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara/core/serialization.h
+ *  \brief      Compile-time specialized wire serialization of scalars and (nested) ara::core::Array.
+ *
+ *  \details    The wire format is the SOME/IP one for fixed-length arrays: the elements back to back, without length
+ *              field or padding, each in the wire byte order (big endian by default). WireTraits<T> derives at
+ *              compile time the innermost element type, the flattened element count and the wire size of T, so:
+ *              - An Array<Array<U, M>, N> flattens to one transfer of N * M elements of U.
+ *              - When the wire and host byte orders match (or U has one byte), the transfer is one block copy.
+ *              - Otherwise it is a byte-swapping copy with one vector shuffle per register (see
+ *                ara/core/internal/byte_swap.h), without per-element branches or temporaries.
+ *
+ *              Serialize() / Deserialize() convert a whole value; WireWriter / WireReader append and consume the
+ *              members of a message one after the other. WireView reads the elements of a received buffer in place,
+ *              without deserializing the whole value first.
+ *
+ *  \note       This header is an OpenAA extension; it is not part of the AUTOSAR SWS.
+ *
+ *  \note       Wire types are the arithmetic types except bool, enumerations (as their underlying type) and Array of
+ *              wire types. Received buffers are not trusted: a buffer too short for the value is reported through the
+ *              return value, never as a violation. An enumeration value read from the wire is not range-checked.
+ *********************************************************************************************************************/
+
+#ifndef OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_CORE_SERIALIZATION_H_
+#define OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_CORE_SERIALIZATION_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <cstddef>       // For std::size_t
+#include <cstdint>       // For std::uint8_t
+#include <cstring>       // For std::memcpy
+#include <optional>      // For std::optional
+#include <string_view>   // For std::string_view
+#include <type_traits>   // For std::is_arithmetic, std::is_enum, std::is_trivially_copyable
+
+#include "ara/core/array.h"                       // For ara::core::Array
+#include "ara/core/span.h"                        // For ara::core::Span
+#include "ara/core/internal/byte_swap.h"          // Byte-swapping copy kernels
+#include "ara/core/internal/location_utils.h"     // For capturing file/line details
+#include "ara/core/internal/violation_handler.h"  // To trigger the violation
+
+namespace ara {
+namespace core {
+namespace serialization {
+
+/**********************************************************************************************************************
+ *  ENUM: ByteOrder
+ *********************************************************************************************************************/
+/*!
+ * \brief  Byte order of the multi-byte elements on the wire.
+ */
+enum class ByteOrder : std::uint8_t {
+    kBigEndian,    /*!< Most significant byte first (network / SOME/IP default) */
+    kLittleEndian  /*!< Least significant byte first */
+};
+
+/*!
+ * \brief  Byte order of the host.
+ */
+constexpr ByteOrder kNativeByteOrder =
+    (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__) ? ByteOrder::kLittleEndian : ByteOrder::kBigEndian;
+
+/*!
+ * \brief  Default wire byte order (SOME/IP).
+ */
+constexpr ByteOrder kNetworkByteOrder = ByteOrder::kBigEndian;
+
+/**********************************************************************************************************************
+ *  STRUCT: WireTraits
+ *********************************************************************************************************************/
+/*!
+ * \brief  Compile-time wire layout of T (primary template: T is not a wire type).
+ *
+ * \details A wire type provides:
+ * - \c Element:  the innermost scalar type (T itself for a scalar).
+ * - \c kCount:   the number of Element in T (N * M for Array<Array<U, M>, N>).
+ * - \c kSize:    the wire size in bytes (kCount * sizeof(Element)).
+ * - \c kIsArray: whether T is an Array; an Array also provides \c Value (U) and \c kLength (N) of Array<U, N>.
+ */
+template <typename T, typename = void>
+struct WireTraits {
+    static constexpr bool kIsWireType = false;
+};
+
+template <typename T>
+struct WireTraits<T, std::enable_if_t<(std::is_arithmetic_v<T> && !std::is_same_v<T, bool>) || std::is_enum_v<T>>> {
+    static constexpr bool        kIsWireType = true;
+    static constexpr bool        kIsArray    = false;
+    using Element                            = T;
+    static constexpr std::size_t kCount      = 1U;
+    static constexpr std::size_t kSize       = sizeof(T);
+};
+
+template <typename U, std::size_t N>
+struct WireTraits<Array<U, N>, std::enable_if_t<WireTraits<U>::kIsWireType>> {
+    static constexpr bool        kIsWireType = true;
+    static constexpr bool        kIsArray    = true;
+    using Value                              = U;
+    static constexpr std::size_t kLength     = N;
+    using Element                            = typename WireTraits<U>::Element;
+    static constexpr std::size_t kCount      = N * WireTraits<U>::kCount;
+    static constexpr std::size_t kSize       = N * WireTraits<U>::kSize;
+
+    // The flattened transfer copies the object representation: the elements must be contiguous without padding
+    static_assert((N == 0U) || (sizeof(Array<U, N>) == (N * sizeof(U))),
+                  "ara::core::serialization: Array<U, N> is not laid out as N contiguous U");
+    static_assert(std::is_trivially_copyable_v<Array<U, N>>,
+                  "ara::core::serialization: Array<U, N> must be trivially copyable");
+};
+
+/*!
+ * \brief  Trait: T can be serialized.
+ */
+template <typename T>
+constexpr bool kIsWireType = WireTraits<T>::kIsWireType;
+
+/*!
+ * \brief  Wire size of T in bytes.
+ */
+template <typename T>
+constexpr std::size_t kWireSize = WireTraits<T>::kSize;
+
+/*!
+ * \brief  Returns the name of the byte-swap backend ("avx2", "ssse3", "neon" or "scalar").
+ */
+constexpr auto ByteSwapBackendName() noexcept -> std::string_view
+{
+    return ara::core::internal::wire::ShuffleBackend::kName;
+}
+
+namespace internal {
+
+/*!
+ * \brief  Whether values of T are copied without swapping for Order.
+ */
+template <typename T, ByteOrder Order>
+constexpr bool kIsBlockCopy = (Order == kNativeByteOrder) || (sizeof(typename WireTraits<T>::Element) == 1U);
+
+/*!
+ * \brief  Writes the wire image of \c value to \c out (kWireSize<T> bytes).
+ */
+template <ByteOrder Order, typename T>
+inline auto Encode(std::uint8_t* out, const T& value) noexcept -> void
+{
+    using Traits = WireTraits<T>;
+    if constexpr (Traits::kSize != 0U) {
+        if constexpr (kIsBlockCopy<T, Order>) {
+            std::memcpy(out, &value, Traits::kSize);
+        } else {
+            ara::core::internal::wire::SwapCopy<sizeof(typename Traits::Element), Traits::kCount>(
+                out, reinterpret_cast<const std::uint8_t*>(&value));
+        }
+    }
+}
+
+/*!
+ * \brief  Reads \c value from the wire image at \c in (kWireSize<T> bytes).
+ */
+template <ByteOrder Order, typename T>
+inline auto Decode(const std::uint8_t* in, T& value) noexcept -> void
+{
+    using Traits = WireTraits<T>;
+    if constexpr (Traits::kSize != 0U) {
+        if constexpr (kIsBlockCopy<T, Order>) {
+            std::memcpy(&value, in, Traits::kSize);
+        } else {
+            ara::core::internal::wire::SwapCopy<sizeof(typename Traits::Element), Traits::kCount>(
+                reinterpret_cast<std::uint8_t*>(&value), in);
+        }
+    }
+}
+
+} // namespace internal
+
+/**********************************************************************************************************************
+ *  FUNCTION: Serialize / Deserialize
+ *********************************************************************************************************************/
+/*!
+ * \brief  Writes the wire image of \c value to the front of \c buffer.
+ *
+ * \return kWireSize<T>, or 0 if \c buffer is shorter (nothing is written).
+ */
+template <ByteOrder Order = kNetworkByteOrder, typename T>
+inline auto Serialize(const T& value, Span<std::uint8_t> buffer) noexcept -> std::size_t
+{
+    static_assert(kIsWireType<T>, "ara::core::serialization::Serialize requires a wire type");
+    if (buffer.size() < kWireSize<T>) {
+        return 0U;
+    }
+    internal::Encode<Order>(buffer.data(), value);
+    return kWireSize<T>;
+}
+
+/*!
+ * \brief  Reads \c value from the front of \c buffer.
+ *
+ * \return kWireSize<T>, or 0 if \c buffer is shorter (\c value is left unchanged).
+ */
+template <ByteOrder Order = kNetworkByteOrder, typename T>
+inline auto Deserialize(Span<const std::uint8_t> buffer, T& value) noexcept -> std::size_t
+{
+    static_assert(kIsWireType<T>, "ara::core::serialization::Deserialize requires a wire type");
+    if (buffer.size() < kWireSize<T>) {
+        return 0U;
+    }
+    internal::Decode<Order>(buffer.data(), value);
+    return kWireSize<T>;
+}
+
+/**********************************************************************************************************************
+ *  CLASS: WireView
+ *********************************************************************************************************************/
+template <typename T, ByteOrder Order = kNetworkByteOrder>
+class WireView;
+
+/*!
+ * \brief  View of the T at the front of \c buffer.
+ *
+ * \return The view, or std::nullopt if \c buffer is shorter than kWireSize<T>.
+ */
+template <typename T, ByteOrder Order = kNetworkByteOrder>
+auto MakeWireView(Span<const std::uint8_t> buffer) noexcept -> std::optional<WireView<T, Order>>;
+
+/*!
+ * \brief  Read-only view of the wire image of a T inside a received buffer (no copy, no alignment requirement).
+ *
+ * \details Get() decodes the whole value. For T = Array<U, N>, operator[] decodes element i: a U for a scalar U, or
+ *          the WireView of the nested Array. Views are created by MakeWireView() or WireReader::View(), which check
+ *          the buffer length once; the view does not own the buffer.
+ */
+template <typename T, ByteOrder Order>
+class WireView final {
+    static_assert(kIsWireType<T>, "ara::core::serialization::WireView requires a wire type");
+
+public:
+    using Traits = WireTraits<T>;
+
+    /*!
+     * \brief  Number of bytes viewed (kWireSize<T>).
+     */
+    static constexpr auto size_bytes() noexcept -> std::size_t { return Traits::kSize; }
+
+    /*!
+     * \brief  The viewed bytes.
+     */
+    auto data() const noexcept -> const std::uint8_t* { return data_; }
+
+    /*!
+     * \brief  Decodes the whole value.
+     */
+    auto Get() const noexcept -> T
+    {
+        T value{};
+        internal::Decode<Order>(data_, value);
+        return value;
+    }
+
+    /*!
+     * \brief  Decodes the whole value into \c value.
+     */
+    auto CopyTo(T& value) const noexcept -> void { internal::Decode<Order>(data_, value); }
+
+    /*!
+     * \brief  Number of elements of the viewed Array.
+     */
+    template <typename U = T, std::enable_if_t<WireTraits<U>::kIsArray, int> = 0>
+    static constexpr auto size() noexcept -> std::size_t
+    {
+        return WireTraits<U>::kLength;
+    }
+
+    /*!
+     * \brief  Element \c index of the viewed Array; an index out of range is a violation.
+     */
+    template <typename U = T, std::enable_if_t<WireTraits<U>::kIsArray, int> = 0>
+    auto operator[](std::size_t index) const noexcept
+    {
+        using ElementType = typename WireTraits<U>::Value;
+        constexpr std::size_t kCount = WireTraits<U>::kLength;
+        if (index >= kCount) {
+            ara::core::internal::ReportArrayAccessOutOfRange(ARA_CORE_INTERNAL_FILELINE, index, kCount);
+        }
+        const std::uint8_t* const element = data_ + (index * kWireSize<ElementType>);
+        if constexpr (WireTraits<ElementType>::kIsArray) {
+            return WireView<ElementType, Order>{element};
+        } else {
+            ElementType value{};
+            internal::Decode<Order>(element, value);
+            return value;
+        }
+    }
+
+private:
+    explicit WireView(const std::uint8_t* data) noexcept : data_{data} {}
+
+    template <typename, ByteOrder>
+    friend class WireView;
+
+    template <typename U, ByteOrder O>
+    friend auto MakeWireView(Span<const std::uint8_t> buffer) noexcept -> std::optional<WireView<U, O>>;
+
+    const std::uint8_t* data_;
+};
+
+template <typename T, ByteOrder Order>
+inline auto MakeWireView(Span<const std::uint8_t> buffer) noexcept -> std::optional<WireView<T, Order>>
+{
+    if (buffer.size() < kWireSize<T>) {
+        return std::nullopt;
+    }
+    return WireView<T, Order>{buffer.data()};
+}
+
+/**********************************************************************************************************************
+ *  CLASS: WireWriter
+ *********************************************************************************************************************/
+/*!
+ * \brief  Appends wire images to a buffer, member after member.
+ *
+ * \details A Write() that does not fit returns \c false, writes nothing and leaves the writer failed: later writes
+ *          are refused as well, so a message can be written with the checks folded into one final Ok().
+ */
+template <ByteOrder Order = kNetworkByteOrder>
+class WireWriter final {
+public:
+    explicit WireWriter(Span<std::uint8_t> buffer) noexcept : buffer_{buffer} {}
+
+    /*!
+     * \brief  Appends the wire image of \c value.
+     */
+    template <typename T>
+    auto Write(const T& value) noexcept -> bool
+    {
+        static_assert(kIsWireType<T>, "ara::core::serialization::WireWriter::Write requires a wire type");
+        if (failed_ || ((buffer_.size() - offset_) < kWireSize<T>)) {
+            failed_ = true;
+            return false;
+        }
+        internal::Encode<Order>(buffer_.data() + offset_, value);
+        offset_ += kWireSize<T>;
+        return true;
+    }
+
+    /*!
+     * \brief  Whether every Write() succeeded.
+     */
+    auto Ok() const noexcept -> bool { return !failed_; }
+
+    /*!
+     * \brief  Number of bytes written.
+     */
+    auto GetOffset() const noexcept -> std::size_t { return offset_; }
+
+    /*!
+     * \brief  The bytes written so far.
+     */
+    auto Written() const noexcept -> Span<std::uint8_t> { return buffer_.first(offset_); }
+
+private:
+    Span<std::uint8_t> buffer_;
+    std::size_t        offset_{0U};
+    bool               failed_{false};
+};
+
+/**********************************************************************************************************************
+ *  CLASS: WireReader
+ *********************************************************************************************************************/
+/*!
+ * \brief  Consumes wire images from a received buffer, member after member.
+ *
+ * \details Like WireWriter, a Read() or View() past the end fails and leaves the reader failed.
+ */
+template <ByteOrder Order = kNetworkByteOrder>
+class WireReader final {
+public:
+    explicit WireReader(Span<const std::uint8_t> buffer) noexcept : buffer_{buffer} {}
+
+    /*!
+     * \brief  Decodes the next value into \c value.
+     */
+    template <typename T>
+    auto Read(T& value) noexcept -> bool
+    {
+        static_assert(kIsWireType<T>, "ara::core::serialization::WireReader::Read requires a wire type");
+        if (!Consume(kWireSize<T>)) {
+            return false;
+        }
+        internal::Decode<Order>(buffer_.data() + offset_ - kWireSize<T>, value);
+        return true;
+    }
+
+    /*!
+     * \brief  Skips the next T and returns an in-place view of it.
+     */
+    template <typename T>
+    auto View() noexcept -> std::optional<WireView<T, Order>>
+    {
+        if (!Consume(kWireSize<T>)) {
+            return std::nullopt;
+        }
+        return MakeWireView<T, Order>(buffer_.subspan(offset_ - kWireSize<T>));
+    }
+
+    /*!
+     * \brief  Whether every Read() / View() succeeded.
+     */
+    auto Ok() const noexcept -> bool { return !failed_; }
+
+    /*!
+     * \brief  Number of bytes consumed.
+     */
+    auto GetOffset() const noexcept -> std::size_t { return offset_; }
+
+    /*!
+     * \brief  Number of bytes left.
+     */
+    auto GetRemaining() const noexcept -> std::size_t { return buffer_.size() - offset_; }
+
+private:
+    auto Consume(std::size_t bytes) noexcept -> bool
+    {
+        if (failed_ || ((buffer_.size() - offset_) < bytes)) {
+            failed_ = true;
+            return false;
+        }
+        offset_ += bytes;
+        return true;
+    }
+
+    Span<const std::uint8_t> buffer_;
+    std::size_t              offset_{0U};
+    bool                     failed_{false};
+};
+
+} // namespace serialization
+} // namespace core
+} // namespace ara
+
+#endif // OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_CORE_SERIALIZATION_H_
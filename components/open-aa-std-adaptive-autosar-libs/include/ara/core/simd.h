@@ -0,0 +1,200 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project (CXX_STANDARD 17)
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara/core/simd.h
+ *  \brief      Element-wise and reduction algorithms for numeric ara::core::Array, vectorized per target ISA.
+ *
+ *  \details    The ara::core::simd algorithms operate on ara::core::Array<T, N> and are specialized at compile time
+ *              on T and N:
+ *              - Element-wise: Add, Sub, Mul, Fma (a * b + c), Min, Max.
+ *              - Reductions:   Sum, Dot, ReduceMin, ReduceMax.
+ *
+ *              float and std::int16_t use the widest instruction set enabled for the build (AVX-512, AVX/AVX2, SSE2,
+ *              SVE or NEON; see ara/core/internal/simd_kernels.h). Every other arithmetic type, and any target
+ *              without a backend, uses the scalar fallback. BackendName<T>() reports the selected backend.
+ *
+ *  \note       This header is an OpenAA extension; it is not part of the AUTOSAR SWS.
+ *
+ *  \note       Semantics shared by all backends:
+ *              - Integral arithmetic wraps (two's complement). Sum/Dot of std::int16_t accumulate in std::int32_t.
+ *              - Floating-point Sum/Dot add in a backend-specific order (several partial sums), so the result may
+ *                differ from a sequential loop by rounding. Fma may be fused (a single rounding) or not.
+ *              - Min/Max follow (b < a) ? b : a and (b > a) ? b : a; NaN handling is backend-defined.
+ *********************************************************************************************************************/
+
+#ifndef OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_CORE_SIMD_H_
+#define OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_CORE_SIMD_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <cstddef>       // For std::size_t
+#include <string_view>   // For std::string_view
+#include <type_traits>   // For std::is_arithmetic, std::is_same
+
+#include "ara/core/array.h"                 // For ara::core::Array
+#include "ara/core/internal/simd_kernels.h" // ISA backends and loop drivers
+
+namespace ara {
+namespace core {
+namespace simd {
+
+/**********************************************************************************************************************
+ *  TYPE ALIASES
+ *********************************************************************************************************************/
+/*!
+ * \brief  Result type of Sum() and Dot() for elements of type T (std::int32_t for std::int16_t, otherwise T).
+ */
+template <typename T>
+using Accumulator = ara::core::internal::simd::AccumulatorType<T>;
+
+/*!
+ * \brief  Trait: T is a supported element type (arithmetic, not bool).
+ */
+template <typename T>
+constexpr bool kIsSupportedElement = std::is_arithmetic_v<T> && !std::is_same_v<T, bool>;
+
+/**********************************************************************************************************************
+ *  BACKEND QUERY
+ *********************************************************************************************************************/
+/*!
+ * \brief  Returns the name of the backend selected for T ("avx512", "avx2", "sse2", "sve", "neon" or "scalar").
+ */
+template <typename T>
+constexpr auto BackendName() noexcept -> std::string_view
+{
+    return ara::core::internal::simd::Backend<T>::kName;
+}
+
+/**********************************************************************************************************************
+ *  ELEMENT-WISE ALGORITHMS
+ *********************************************************************************************************************/
+/*!
+ * \brief  Element-wise lhs[i] + rhs[i].
+ */
+template <typename T, std::size_t N>
+inline auto Add(const Array<T, N>& lhs, const Array<T, N>& rhs) noexcept -> Array<T, N>
+{
+    static_assert(kIsSupportedElement<T>, "ara::core::simd::Add requires an arithmetic element type");
+    Array<T, N> result;
+    ara::core::internal::simd::Transform<ara::core::internal::simd::AddOp, N>(result.data(), lhs.data(), rhs.data());
+    return result;
+}
+
+/*!
+ * \brief  Element-wise lhs[i] - rhs[i].
+ */
+template <typename T, std::size_t N>
+inline auto Sub(const Array<T, N>& lhs, const Array<T, N>& rhs) noexcept -> Array<T, N>
+{
+    static_assert(kIsSupportedElement<T>, "ara::core::simd::Sub requires an arithmetic element type");
+    Array<T, N> result;
+    ara::core::internal::simd::Transform<ara::core::internal::simd::SubOp, N>(result.data(), lhs.data(), rhs.data());
+    return result;
+}
+
+/*!
+ * \brief  Element-wise lhs[i] * rhs[i] (low 16 bits for std::int16_t).
+ */
+template <typename T, std::size_t N>
+inline auto Mul(const Array<T, N>& lhs, const Array<T, N>& rhs) noexcept -> Array<T, N>
+{
+    static_assert(kIsSupportedElement<T>, "ara::core::simd::Mul requires an arithmetic element type");
+    Array<T, N> result;
+    ara::core::internal::simd::Transform<ara::core::internal::simd::MulOp, N>(result.data(), lhs.data(), rhs.data());
+    return result;
+}
+
+/*!
+ * \brief  Element-wise a[i] * b[i] + c[i] (fused where the backend provides FMA).
+ */
+template <typename T, std::size_t N>
+inline auto Fma(const Array<T, N>& a, const Array<T, N>& b, const Array<T, N>& c) noexcept -> Array<T, N>
+{
+    static_assert(kIsSupportedElement<T>, "ara::core::simd::Fma requires an arithmetic element type");
+    Array<T, N> result;
+    ara::core::internal::simd::Transform<ara::core::internal::simd::FmaOp, N>(
+        result.data(), a.data(), b.data(), c.data());
+    return result;
+}
+
+/*!
+ * \brief  Element-wise minimum.
+ */
+template <typename T, std::size_t N>
+inline auto Min(const Array<T, N>& lhs, const Array<T, N>& rhs) noexcept -> Array<T, N>
+{
+    static_assert(kIsSupportedElement<T>, "ara::core::simd::Min requires an arithmetic element type");
+    Array<T, N> result;
+    ara::core::internal::simd::Transform<ara::core::internal::simd::MinOp, N>(result.data(), lhs.data(), rhs.data());
+    return result;
+}
+
+/*!
+ * \brief  Element-wise maximum.
+ */
+template <typename T, std::size_t N>
+inline auto Max(const Array<T, N>& lhs, const Array<T, N>& rhs) noexcept -> Array<T, N>
+{
+    static_assert(kIsSupportedElement<T>, "ara::core::simd::Max requires an arithmetic element type");
+    Array<T, N> result;
+    ara::core::internal::simd::Transform<ara::core::internal::simd::MaxOp, N>(result.data(), lhs.data(), rhs.data());
+    return result;
+}
+
+/**********************************************************************************************************************
+ *  REDUCTIONS
+ *********************************************************************************************************************/
+/*!
+ * \brief  Sum of all elements (0 for N == 0).
+ */
+template <typename T, std::size_t N>
+inline auto Sum(const Array<T, N>& values) noexcept -> Accumulator<T>
+{
+    static_assert(kIsSupportedElement<T>, "ara::core::simd::Sum requires an arithmetic element type");
+    return ara::core::internal::simd::Sum<N>(values.data());
+}
+
+/*!
+ * \brief  Dot product sum(lhs[i] * rhs[i]) (0 for N == 0).
+ */
+template <typename T, std::size_t N>
+inline auto Dot(const Array<T, N>& lhs, const Array<T, N>& rhs) noexcept -> Accumulator<T>
+{
+    static_assert(kIsSupportedElement<T>, "ara::core::simd::Dot requires an arithmetic element type");
+    return ara::core::internal::simd::Dot<N>(lhs.data(), rhs.data());
+}
+
+/*!
+ * \brief  Smallest element.
+ */
+template <typename T, std::size_t N>
+inline auto ReduceMin(const Array<T, N>& values) noexcept -> T
+{
+    static_assert(kIsSupportedElement<T>, "ara::core::simd::ReduceMin requires an arithmetic element type");
+    static_assert(N > 0U, "ara::core::simd::ReduceMin requires a non-empty Array");
+    return ara::core::internal::simd::Extremum<ara::core::internal::simd::MinOp, N>(values.data());
+}
+
+/*!
+ * \brief  Largest element.
+ */
+template <typename T, std::size_t N>
+inline auto ReduceMax(const Array<T, N>& values) noexcept -> T
+{
+    static_assert(kIsSupportedElement<T>, "ara::core::simd::ReduceMax requires an arithmetic element type");
+    static_assert(N > 0U, "ara::core::simd::ReduceMax requires a non-empty Array");
+    return ara::core::internal::simd::Extremum<ara::core::internal::simd::MaxOp, N>(values.data());
+}
+
+} // namespace simd
+} // namespace core
+} // namespace ara
+
+#endif // OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_CORE_SIMD_H_
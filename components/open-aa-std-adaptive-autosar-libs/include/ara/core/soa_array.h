@@ -0,0 +1,344 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project (CXX_STANDARD 17)
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara/core/soa_array.h
+ *  \brief      Definition of the ara::core::SoaArray structure-of-arrays container.
+ *
+ *  \details    SoaArray<N, SoaField<Tag, T>...> stores N rows of a record as one ara::core::Array<T, N> per field
+ *              (a "column"), each starting on its own cache line. A pass over two fields of every row then streams
+ *              two dense arrays instead of striding over whole records, and every column can be handed as is to the
+ *              ara::core::simd kernels or as a Span<T, N>.
+ *
+ *              - Fields are looked up at compile time by tag: Column<Tag>(), ColumnSpan<Tag>(), Get<Tag>(row).
+ *              - operator[] / at() return a row proxy whose Get<Tag>() references the element in its column; the
+ *                rows can also be iterated with a range-for.
+ *              - There is no dynamic allocation; the container is as large as its columns plus the alignment.
+ *
+ *  \note       This header is an OpenAA extension; it is not part of the AUTOSAR SWS.
+ *********************************************************************************************************************/
+
+#ifndef OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_CORE_SOA_ARRAY_H_
+#define OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_CORE_SOA_ARRAY_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <cstddef>       // For std::size_t
+#include <tuple>         // For std::tuple, std::get
+#include <type_traits>   // For std::conditional_t, std::enable_if_t, std::is_same_v
+#include <utility>       // For std::index_sequence
+
+#include "ara/core/array.h"                       // For ara::core::Array
+#include "ara/core/interference_size.h"     // For ara::core::kConstructiveInterferenceSize
+#include "ara/core/span.h"                        // For ara::core::Span
+#include "ara/core/internal/location_utils.h"     // For capturing file/line details
+#include "ara/core/internal/violation_handler.h"  // To trigger the violation
+
+namespace ara {
+namespace core {
+
+/**********************************************************************************************************************
+ *  STRUCT: SoaField
+ *********************************************************************************************************************/
+/*!
+ * \brief  Declares one field of a SoaArray: the tag it is looked up by and its element type.
+ *
+ * \details The tag is any type, typically an empty struct declared in place:
+ *
+ *              using Tracks = ara::core::SoaArray<256U, ara::core::SoaField<struct PosX, float>,
+ *                                                       ara::core::SoaField<struct PosY, float>,
+ *                                                       ara::core::SoaField<struct Id, std::uint32_t>>;
+ *              tracks.Column<PosX>();   // ara::core::Array<float, 256>&
+ */
+template <typename Tag, typename T>
+struct SoaField {
+    using tag  = Tag;
+    using type = T;
+};
+
+namespace internal {
+
+/**********************************************************************************************************************
+ *  SECTION: Field lookup
+ *********************************************************************************************************************/
+template <typename Field>
+struct IsSoaField : std::false_type {};
+
+template <typename Tag, typename T>
+struct IsSoaField<SoaField<Tag, T>> : std::true_type {};
+
+/*!
+ * \brief  Number of fields among Fields... whose tag is Tag.
+ */
+template <typename Tag, typename... Fields>
+constexpr std::size_t kSoaTagCount = (std::size_t{0U} + ... + (std::is_same_v<Tag, typename Fields::tag> ? 1U : 0U));
+
+/*!
+ * \brief  Index of the field tagged Tag among Fields... (the tag must occur exactly once).
+ */
+template <typename Tag, typename... Fields>
+constexpr auto SoaTagIndex() noexcept -> std::size_t
+{
+    constexpr bool kMatches[] = {std::is_same_v<Tag, typename Fields::tag>...};
+    std::size_t index = 0U;
+    while (!kMatches[index]) {
+        ++index;
+    }
+    return index;
+}
+
+/*!
+ * \brief  One column: an Array<T, N> starting on its own cache line.
+ */
+template <typename T, std::size_t N>
+struct alignas(kConstructiveInterferenceSize) SoaColumn {
+    Array<T, N> values;
+};
+
+} // namespace internal
+
+/**********************************************************************************************************************
+ *  CLASS: SoaArray
+ *********************************************************************************************************************/
+/*!
+ * \brief  Fixed-size structure-of-arrays container of N rows of the fields Fields... (each a SoaField<Tag, T>).
+ */
+template <std::size_t N, typename... Fields>
+class SoaArray final {
+    static_assert(sizeof...(Fields) > 0U, "ara::core::SoaArray needs at least one field");
+    static_assert((internal::IsSoaField<Fields>::value && ...),
+                  "ara::core::SoaArray fields must be declared as ara::core::SoaField<Tag, T>");
+    static_assert(((internal::kSoaTagCount<typename Fields::tag, Fields...> == 1U) && ...),
+                  "ara::core::SoaArray field tags must be unique");
+
+    template <bool IsConst>
+    class RowProxy;
+
+    template <bool IsConst>
+    class RowIterator;
+
+public:
+    using size_type      = std::size_t;
+    using Row            = RowProxy<false>;
+    using ConstRow       = RowProxy<true>;
+    using iterator       = RowIterator<false>;
+    using const_iterator = RowIterator<true>;
+
+    /*!
+     * \brief  Number of fields.
+     */
+    static constexpr std::size_t kFieldCount = sizeof...(Fields);
+
+    /*!
+     * \brief  Index of the field tagged Tag (a compile-time error if there is none).
+     */
+    template <typename Tag>
+    static constexpr std::size_t kIndexOf = [] {
+        static_assert(internal::kSoaTagCount<Tag, Fields...> == 1U, "ara::core::SoaArray has no field with this tag");
+        return internal::SoaTagIndex<Tag, Fields...>();
+    }();
+
+    /*!
+     * \brief  Element type of the field tagged Tag.
+     */
+    template <typename Tag>
+    using FieldType = typename std::tuple_element_t<kIndexOf<Tag>, std::tuple<Fields...>>::type;
+
+    /*!
+     * \brief  Number of rows.
+     */
+    static constexpr auto size() noexcept -> size_type { return N; }
+
+    // -----------------------------------------------------------------------------------
+    // Columns
+    // -----------------------------------------------------------------------------------
+    /*!
+     * \brief  The column of the field tagged Tag, e.g. as an operand of the ara::core::simd kernels.
+     */
+    template <typename Tag>
+    constexpr auto Column() noexcept -> Array<FieldType<Tag>, N>&
+    {
+        return std::get<kIndexOf<Tag>>(columns_).values;
+    }
+
+    template <typename Tag>
+    constexpr auto Column() const noexcept -> const Array<FieldType<Tag>, N>&
+    {
+        return std::get<kIndexOf<Tag>>(columns_).values;
+    }
+
+    /*!
+     * \brief  The column of the field tagged Tag as a static-extent Span.
+     */
+    template <typename Tag>
+    constexpr auto ColumnSpan() noexcept -> Span<FieldType<Tag>, N>
+    {
+        return Span<FieldType<Tag>, N>{Column<Tag>()};
+    }
+
+    template <typename Tag>
+    constexpr auto ColumnSpan() const noexcept -> Span<const FieldType<Tag>, N>
+    {
+        return Span<const FieldType<Tag>, N>{Column<Tag>()};
+    }
+
+    /*!
+     * \brief  Element \c row of the field tagged Tag (unchecked, like Array::operator[]).
+     */
+    template <typename Tag>
+    constexpr auto Get(size_type row) noexcept -> FieldType<Tag>&
+    {
+        return Column<Tag>()[row];
+    }
+
+    template <typename Tag>
+    constexpr auto Get(size_type row) const noexcept -> const FieldType<Tag>&
+    {
+        return Column<Tag>()[row];
+    }
+
+    /*!
+     * \brief  Sets every element of the field tagged Tag to \c value.
+     */
+    template <typename Tag>
+    auto Fill(const FieldType<Tag>& value) noexcept -> void
+    {
+        Column<Tag>().fill(value);
+    }
+
+    // -----------------------------------------------------------------------------------
+    // Rows
+    // -----------------------------------------------------------------------------------
+    /*!
+     * \brief  Proxy of row \c row (unchecked).
+     */
+    constexpr auto operator[](size_type row) noexcept -> Row { return Row{this, row}; }
+    constexpr auto operator[](size_type row) const noexcept -> ConstRow { return ConstRow{this, row}; }
+
+    /*!
+     * \brief  Proxy of row \c row; an index out of range is a violation.
+     */
+    constexpr auto at(size_type row) noexcept -> Row
+    {
+        CheckRow(row);
+        return Row{this, row};
+    }
+
+    constexpr auto at(size_type row) const noexcept -> ConstRow
+    {
+        CheckRow(row);
+        return ConstRow{this, row};
+    }
+
+    constexpr auto begin() noexcept -> iterator { return iterator{this, 0U}; }
+    constexpr auto end() noexcept -> iterator { return iterator{this, N}; }
+    constexpr auto begin() const noexcept -> const_iterator { return const_iterator{this, 0U}; }
+    constexpr auto end() const noexcept -> const_iterator { return const_iterator{this, N}; }
+
+private:
+    using Owner     = SoaArray;
+    using Columns   = std::tuple<internal::SoaColumn<typename Fields::type, N>...>;
+    using RowValues = std::tuple<typename Fields::type...>;
+
+    constexpr auto CheckRow(size_type row) const noexcept -> void
+    {
+        if (row >= N) {
+            ara::core::internal::ReportArrayAccessOutOfRange(ARA_CORE_INTERNAL_FILELINE, row, N);
+        }
+    }
+
+    /*!
+     * \brief  Reference to one row: Get<Tag>() references the element in the column of Tag.
+     */
+    template <bool IsConst>
+    class RowProxy final {
+    public:
+        using Container = std::conditional_t<IsConst, const Owner, Owner>;
+
+        constexpr RowProxy(Container* owner, size_type row) noexcept : owner_{owner}, row_{row} {}
+
+        /*!
+         * \brief  Index of the row.
+         */
+        constexpr auto GetIndex() const noexcept -> size_type { return row_; }
+
+        /*!
+         * \brief  The element of the field tagged Tag in this row.
+         */
+        template <typename Tag>
+        constexpr auto Get() const noexcept -> std::conditional_t<IsConst, const FieldType<Tag>&, FieldType<Tag>&>
+        {
+            return owner_->template Column<Tag>()[row_];
+        }
+
+        /*!
+         * \brief  Assigns every field of the row, in declaration order.
+         */
+        template <bool C = IsConst, typename = std::enable_if_t<!C>>
+        constexpr auto Assign(const typename Fields::type&... values) const noexcept -> void
+        {
+            AssignFields(std::index_sequence_for<Fields...>{}, values...);
+        }
+
+        /*!
+         * \brief  Copies the fields of the row into a tuple, in declaration order.
+         */
+        constexpr auto Load() const noexcept -> RowValues { return LoadFields(std::index_sequence_for<Fields...>{}); }
+
+    private:
+        template <std::size_t... I>
+        constexpr auto AssignFields(std::index_sequence<I...>, const typename Fields::type&... values) const noexcept
+            -> void
+        {
+            ((std::get<I>(owner_->columns_).values[row_] = values), ...);
+        }
+
+        template <std::size_t... I>
+        constexpr auto LoadFields(std::index_sequence<I...>) const noexcept -> RowValues
+        {
+            return RowValues{std::get<I>(owner_->columns_).values[row_]...};
+        }
+
+        Container* owner_;
+        size_type  row_;
+    };
+
+    /*!
+     * \brief  Iterator over the rows; dereferences to a RowProxy.
+     */
+    template <bool IsConst>
+    class RowIterator final {
+    public:
+        using Container = std::conditional_t<IsConst, const Owner, Owner>;
+
+        constexpr RowIterator(Container* owner, size_type row) noexcept : owner_{owner}, row_{row} {}
+
+        constexpr auto operator*() const noexcept -> RowProxy<IsConst> { return RowProxy<IsConst>{owner_, row_}; }
+
+        constexpr auto operator++() noexcept -> RowIterator&
+        {
+            ++row_;
+            return *this;
+        }
+
+        constexpr auto operator==(const RowIterator& other) const noexcept -> bool { return row_ == other.row_; }
+        constexpr auto operator!=(const RowIterator& other) const noexcept -> bool { return row_ != other.row_; }
+
+    private:
+        Container* owner_;
+        size_type  row_;
+    };
+
+    Columns columns_{};
+};
+
+} // namespace core
+} // namespace ara
+
+#endif // OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_CORE_SOA_ARRAY_H_
@@ -0,0 +1,671 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project (CXX_STANDARD 17)
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara/core/span.h
+ *  \brief      Definition and implementation of the ara::core::Span template class.
+ *
+ *  \details    ara::core::Span<T, Extent> is a non-owning view over a contiguous sequence of objects, similar to
+ *              std::span (C++20). A span with a static extent stores only a pointer: its size is a compile-time
+ *              constant, first<K>(), last<K>() and subspan<O, K>() keep it at compile time, and a function taking
+ *              Span<const T, N> accepts an ara::core::Array<T, N> without being templated on the container.
+ *
+ *              Bounds violations (operator[], front()/back() of an empty span, fixed-size views that do not fit,
+ *              a static-extent span constructed over a sequence of a different length) are reported through the
+ *              ViolationHandler, following the bounds-check policy of ara/core/array.h (see SpanBoundsCheck).
+ *
+ *  \note       Based on the Adaptive AUTOSAR SWS (e.g., R24-11) requirements for the "Span" type, especially:
+ *              - [SWS_CORE_01901] (dynamic_extent)
+ *              - [SWS_CORE_01900] (Definition of ara::core::Span)
+ *              - [SWS_CORE_00040] (No exceptions used – custom violation handling)
+ *********************************************************************************************************************/
+
+#ifndef OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_CORE_SPAN_H_
+#define OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_CORE_SPAN_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <cstddef>       // For std::size_t, std::ptrdiff_t, std::byte
+#include <iterator>      // For std::reverse_iterator
+#include <limits>        // For std::numeric_limits
+#include <type_traits>   // For std::remove_cv_t, std::is_convertible, std::enable_if_t
+#include <utility>       // For std::declval
+
+#include "ara/core/array.h"                       // For ara::core::Array, ara::core::BoundsCheckPolicy
+#include "ara/core/internal/location_utils.h"     // For capturing file/line details
+#include "ara/core/internal/violation_handler.h"  // To trigger the violation
+
+namespace ara {
+namespace core {
+
+/**********************************************************************************************************************
+ *  SECTION: Constants and Forward Declaration
+ *********************************************************************************************************************/
+/*!
+ * \brief  Extent of a span whose number of elements is only known at run time.
+ *
+ * \note   [SWS_CORE_01901]
+ */
+constexpr std::size_t dynamic_extent = std::numeric_limits<std::size_t>::max();
+
+/*!
+ * \brief  Forward declaration of the Span class template.
+ */
+template <typename T, std::size_t Extent = dynamic_extent>
+class Span;
+
+/*!
+ * \brief  Bounds-check policy of Span<T, Extent> (operator[], front(), back(), the run-time sub-views and the
+ *         construction of static-extent spans).
+ *
+ * \details
+ * Defaults to the target-wide ARA_CORE_ARRAY_BOUNDS_CHECK_POLICY, the same default as ArrayBoundsCheck; specialize
+ * it to select another policy for one instantiation (same rules as ArrayBoundsCheck).
+ */
+template <typename T, std::size_t Extent>
+struct SpanBoundsCheck {
+    static constexpr BoundsCheckPolicy value{BoundsCheckPolicy::ARA_CORE_ARRAY_BOUNDS_CHECK_POLICY};
+};
+
+/**********************************************************************************************************************
+ *  SECTION: Span Helpers
+ *********************************************************************************************************************/
+namespace detail {
+
+/*!
+ * \brief  Size of a span: nothing for a static extent (the size is Extent), a member for dynamic_extent.
+ */
+template <std::size_t Extent>
+struct SpanExtentStorage {
+    constexpr SpanExtentStorage() noexcept = default;
+    constexpr explicit SpanExtentStorage(std::size_t) noexcept {}
+
+    static constexpr auto Size() noexcept -> std::size_t
+    {
+        return Extent;
+    }
+};
+
+/*!
+ * \brief  Size of a span with dynamic_extent.
+ */
+template <>
+struct SpanExtentStorage<dynamic_extent> {
+    constexpr SpanExtentStorage() noexcept = default;
+    constexpr explicit SpanExtentStorage(std::size_t count) noexcept : size_{count} {}
+
+    constexpr auto Size() const noexcept -> std::size_t
+    {
+        return size_;
+    }
+
+    std::size_t size_{0U};
+};
+
+/*!
+ * \brief  Trait: T is a specialization of ara::core::Span.
+ */
+template <typename T>
+struct is_span : std::false_type {};
+
+template <typename T, std::size_t Extent>
+struct is_span<Span<T, Extent>> : std::true_type {};
+
+/*!
+ * \brief  Trait: T is a specialization of ara::core::Array.
+ */
+template <typename T>
+struct is_ara_array : std::false_type {};
+
+template <typename T, std::size_t N>
+struct is_ara_array<Array<T, N>> : std::true_type {};
+
+/*!
+ * \brief  Trait: a U* may be viewed as a T* (qualification conversion only, no derived-to-base).
+ */
+template <typename U, typename T>
+constexpr bool kIsSpanConvertible = std::is_convertible_v<U (*)[], T (*)[]>;
+
+/*!
+ * \brief  Trait: Container is a contiguous container (data() and size()) whose elements may be viewed as T.
+ *
+ * \details Arrays, Spans and built-in arrays have their own constructors and are excluded.
+ */
+template <typename Container, typename T, typename = void>
+struct is_span_compatible_container : std::false_type {};
+
+template <typename Container, typename T>
+struct is_span_compatible_container<Container, T,
+                                    std::void_t<decltype(std::declval<Container&>().data()),
+                                                decltype(std::declval<Container&>().size())>>
+    : std::bool_constant<!is_span<std::remove_cv_t<Container>>::value &&
+                         !is_ara_array<std::remove_cv_t<Container>>::value &&
+                         !std::is_array_v<Container> &&
+                         kIsSpanConvertible<std::remove_pointer_t<decltype(std::declval<Container&>().data())>, T>> {};
+
+/*!
+ * \brief  Extent of subspan<Offset, Count>() on a span of extent Extent.
+ */
+template <std::size_t Extent, std::size_t Offset, std::size_t Count>
+constexpr std::size_t kSubspanExtent = (Count != dynamic_extent)  ? Count
+                                     : (Extent != dynamic_extent) ? (Extent - Offset)
+                                                                  : dynamic_extent;
+
+}  // namespace detail
+
+/**********************************************************************************************************************
+ *  CLASS: Span
+ *********************************************************************************************************************/
+/*!
+ * \brief  A view over a contiguous sequence of \c Extent (or, for dynamic_extent, a run-time number of) objects of
+ *         type \c T.
+ *
+ * \tparam T       The element type; const-qualified for a read-only view.
+ * \tparam Extent  The number of elements, or dynamic_extent.
+ *
+ * \details
+ * - A Span is trivially copyable and does not own its elements; the viewed sequence must outlive it.
+ * - Converts implicitly from ara::core::Array<U, N>, built-in arrays and (dynamic extent only) any contiguous
+ *   container with data() and size(), e.g., ara::core::Vector.
+ * - Span<T, N> converts implicitly to Span<const T, N> and to Span<T> (dynamic_extent); the opposite direction
+ *   (dynamic to static) is explicit and checked.
+ * - No exceptions are thrown ([SWS_CORE_00040]); violations terminate the process through the ViolationHandler.
+ *
+ * \note  [SWS_CORE_01900], [SWS_CORE_00040]
+ */
+template <typename T, std::size_t Extent>
+class Span final : private detail::SpanExtentStorage<Extent>
+{
+    using ExtentStorage = detail::SpanExtentStorage<Extent>;
+
+public:
+    // -----------------------------------------------------------------------------------
+    // TYPE ALIASES AND CONSTANTS (public)
+    // -----------------------------------------------------------------------------------
+    using element_type           = T;                                    /*!< Type of the viewed elements      */
+    using value_type             = std::remove_cv_t<T>;                  /*!< Element type without cv          */
+    using size_type              = std::size_t;                          /*!< Used for indexing                */
+    using difference_type        = std::ptrdiff_t;                       /*!< Used for pointer differences     */
+    using pointer                = T*;                                   /*!< Pointer to an element            */
+    using const_pointer          = const T*;                             /*!< Const pointer to an element      */
+    using reference              = T&;                                   /*!< Reference to an element          */
+    using const_reference        = const T&;                             /*!< Const reference to an element    */
+    using iterator               = T*;                                   /*!< Iterator type                    */
+    using const_iterator         = const T*;                             /*!< Const iterator type              */
+    using reverse_iterator       = std::reverse_iterator<iterator>;      /*!< Reverse iterator                 */
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>; /*!< Const reverse iterator          */
+
+    /*!
+     * \brief  The extent of this span type.
+     */
+    static constexpr size_type extent = Extent;
+
+    // -----------------------------------------------------------------------------------
+    // 1) CONSTRUCTORS
+    // -----------------------------------------------------------------------------------
+    /*!
+     * \brief  Constructs an empty span (only for Extent == 0 or dynamic_extent).
+     */
+    template <std::size_t E = Extent, typename = std::enable_if_t<(E == 0U) || (E == dynamic_extent)>>
+    constexpr Span() noexcept : ExtentStorage{0U}, data_{nullptr}
+    {
+    }
+
+    /*!
+     * \brief  Constructs a span over [ptr, ptr + count).
+     *
+     * \note   For a static extent this constructor is explicit; count != Extent is a violation.
+     */
+    template <std::size_t E = Extent, std::enable_if_t<E == dynamic_extent, int> = 0>
+    constexpr Span(pointer ptr, size_type count) noexcept : ExtentStorage{count}, data_{ptr}
+    {
+    }
+
+    template <std::size_t E = Extent, std::enable_if_t<E != dynamic_extent, int> = 0>
+    constexpr explicit Span(pointer ptr, size_type count) noexcept : ExtentStorage{count}, data_{ptr}
+    {
+        CheckExtent(count);
+    }
+
+    /*!
+     * \brief  Constructs a span over [firstElem, lastElem).
+     *
+     * \note   For a static extent this constructor is explicit; (lastElem - firstElem) != Extent is a violation.
+     */
+    template <std::size_t E = Extent, std::enable_if_t<E == dynamic_extent, int> = 0>
+    constexpr Span(pointer firstElem, pointer lastElem) noexcept
+        : ExtentStorage{static_cast<size_type>(lastElem - firstElem)}, data_{firstElem}
+    {
+    }
+
+    template <std::size_t E = Extent, std::enable_if_t<E != dynamic_extent, int> = 0>
+    constexpr explicit Span(pointer firstElem, pointer lastElem) noexcept
+        : ExtentStorage{static_cast<size_type>(lastElem - firstElem)}, data_{firstElem}
+    {
+        CheckExtent(static_cast<size_type>(lastElem - firstElem));
+    }
+
+    /*!
+     * \brief  Constructs a span over a built-in array of N elements (N must equal a static Extent).
+     */
+    template <std::size_t N,
+              typename = std::enable_if_t<(Extent == dynamic_extent) || (Extent == N)>>
+    constexpr Span(element_type (&arr)[N]) noexcept : ExtentStorage{N}, data_{arr}
+    {
+    }
+
+    /*!
+     * \brief  Constructs a span over an ara::core::Array<U, N> (N must equal a static Extent).
+     *
+     * \details The size is taken from the type, so a Span<const T, N> parameter accepts any Array<T, N> without
+     *          a run-time check or a copy.
+     */
+    template <typename U, std::size_t N,
+              typename = std::enable_if_t<((Extent == dynamic_extent) || (Extent == N)) &&
+                                          detail::kIsSpanConvertible<U, element_type>>>
+    constexpr Span(Array<U, N>& arr) noexcept : ExtentStorage{N}, data_{arr.data()}
+    {
+    }
+
+    /*!
+     * \brief  Constructs a span over a const ara::core::Array<U, N> (element_type must be const).
+     */
+    template <typename U, std::size_t N,
+              typename = std::enable_if_t<((Extent == dynamic_extent) || (Extent == N)) &&
+                                          detail::kIsSpanConvertible<const U, element_type>>>
+    constexpr Span(const Array<U, N>& arr) noexcept : ExtentStorage{N}, data_{arr.data()}
+    {
+    }
+
+    /*!
+     * \brief  Constructs a span over a contiguous container with data() and size() (dynamic_extent only).
+     */
+    template <typename Container, std::size_t E = Extent,
+              typename = std::enable_if_t<(E == dynamic_extent) &&
+                                          detail::is_span_compatible_container<Container, element_type>::value>>
+    constexpr Span(Container& cont) noexcept : ExtentStorage{cont.size()}, data_{cont.data()}
+    {
+    }
+
+    template <typename Container, std::size_t E = Extent,
+              typename = std::enable_if_t<(E == dynamic_extent) &&
+                                          detail::is_span_compatible_container<const Container, element_type>::value>>
+    constexpr Span(const Container& cont) noexcept : ExtentStorage{cont.size()}, data_{cont.data()}
+    {
+    }
+
+    /*!
+     * \brief  Converting constructor from Span<U, N>, e.g., Span<T, N> to Span<const T, N> or to Span<T>.
+     *
+     * \note   Explicit (and checked) when a dynamic-extent span is converted to a static extent.
+     */
+    template <typename U, std::size_t N,
+              std::enable_if_t<((Extent == dynamic_extent) || (Extent == N)) &&
+                               detail::kIsSpanConvertible<U, element_type>, int> = 0>
+    constexpr Span(const Span<U, N>& other) noexcept : ExtentStorage{other.size()}, data_{other.data()}
+    {
+    }
+
+    template <typename U, std::size_t N,
+              std::enable_if_t<(Extent != dynamic_extent) && (N == dynamic_extent) &&
+                               detail::kIsSpanConvertible<U, element_type>, int> = 0>
+    constexpr explicit Span(const Span<U, N>& other) noexcept : ExtentStorage{other.size()}, data_{other.data()}
+    {
+        CheckExtent(other.size());
+    }
+
+    constexpr Span(const Span& other) noexcept = default;
+    constexpr auto operator=(const Span& other) noexcept -> Span& = default;
+    ~Span() noexcept = default;
+
+    // -----------------------------------------------------------------------------------
+    // 2) SUB-VIEWS
+    // -----------------------------------------------------------------------------------
+    /*!
+     * \brief  Returns a span over the first Count elements.
+     *
+     * \note   Count > Extent is a compile-time error; for dynamic_extent, Count > size() is a violation.
+     */
+    template <std::size_t Count>
+    constexpr auto first() const noexcept -> Span<element_type, Count>
+    {
+        static_assert((Extent == dynamic_extent) || (Count <= Extent),
+            "\n[ERROR] Span::first<Count>(): Count exceeds the extent of the span.\n");
+        if constexpr (Extent == dynamic_extent) {
+            CheckCount(Count, size());
+        }
+        return Span<element_type, Count>{data_, Count};
+    }
+
+    /*!
+     * \brief  Returns a span over the first \c count elements (count > size() is a violation).
+     */
+    constexpr auto first(size_type count) const noexcept -> Span<element_type, dynamic_extent>
+    {
+        CheckCount(count, size());
+        return Span<element_type, dynamic_extent>{data_, count};
+    }
+
+    /*!
+     * \brief  Returns a span over the last Count elements.
+     *
+     * \note   Count > Extent is a compile-time error; for dynamic_extent, Count > size() is a violation.
+     */
+    template <std::size_t Count>
+    constexpr auto last() const noexcept -> Span<element_type, Count>
+    {
+        static_assert((Extent == dynamic_extent) || (Count <= Extent),
+            "\n[ERROR] Span::last<Count>(): Count exceeds the extent of the span.\n");
+        if constexpr (Extent == dynamic_extent) {
+            CheckCount(Count, size());
+        }
+        return Span<element_type, Count>{data_ + (size() - Count), Count};
+    }
+
+    /*!
+     * \brief  Returns a span over the last \c count elements (count > size() is a violation).
+     */
+    constexpr auto last(size_type count) const noexcept -> Span<element_type, dynamic_extent>
+    {
+        CheckCount(count, size());
+        return Span<element_type, dynamic_extent>{data_ + (size() - count), count};
+    }
+
+    /*!
+     * \brief  Returns a span over Count elements starting at Offset (all remaining elements for dynamic_extent).
+     *
+     * \details The result has a static extent whenever Count is given or this span has a static extent.
+     * \note    Out-of-range Offset / Count against a static Extent is a compile-time error; otherwise a violation.
+     */
+    template <std::size_t Offset, std::size_t Count = dynamic_extent>
+    constexpr auto subspan() const noexcept -> Span<element_type, detail::kSubspanExtent<Extent, Offset, Count>>
+    {
+        static_assert((Extent == dynamic_extent) || (Offset <= Extent),
+            "\n[ERROR] Span::subspan<Offset, Count>(): Offset exceeds the extent of the span.\n");
+        static_assert((Extent == dynamic_extent) || (Count == dynamic_extent) || (Count <= (Extent - Offset)),
+            "\n[ERROR] Span::subspan<Offset, Count>(): Offset + Count exceeds the extent of the span.\n");
+        if constexpr (Extent == dynamic_extent) {
+            CheckCount(Offset, size());
+            if constexpr (Count != dynamic_extent) {
+                CheckCount(Count, size() - Offset);
+            }
+        }
+        constexpr std::size_t kResultExtent{detail::kSubspanExtent<Extent, Offset, Count>};
+        return Span<element_type, kResultExtent>{data_ + Offset, (Count != dynamic_extent) ? Count : (size() - Offset)};
+    }
+
+    /*!
+     * \brief  Returns a span over \c count elements starting at \c offset (all remaining for dynamic_extent).
+     *
+     * \note   offset > size() or offset + count > size() is a violation.
+     */
+    constexpr auto subspan(size_type offset, size_type count = dynamic_extent) const noexcept
+        -> Span<element_type, dynamic_extent>
+    {
+        CheckCount(offset, size());
+        if (count == dynamic_extent) {
+            return Span<element_type, dynamic_extent>{data_ + offset, size() - offset};
+        }
+        CheckCount(count, size() - offset);
+        return Span<element_type, dynamic_extent>{data_ + offset, count};
+    }
+
+    // -----------------------------------------------------------------------------------
+    // 3) OBSERVERS
+    // -----------------------------------------------------------------------------------
+    /*!
+     * \brief  Returns the number of elements (Extent for a static extent).
+     */
+    constexpr auto size() const noexcept -> size_type
+    {
+        return ExtentStorage::Size();
+    }
+
+    /*!
+     * \brief  Returns the size of the viewed sequence in bytes.
+     */
+    constexpr auto size_bytes() const noexcept -> size_type
+    {
+        return size() * sizeof(element_type);
+    }
+
+    /*!
+     * \brief  Returns whether the span is empty.
+     */
+    [[nodiscard]] constexpr auto empty() const noexcept -> bool
+    {
+        return size() == 0U;
+    }
+
+    // -----------------------------------------------------------------------------------
+    // 4) ELEMENT ACCESS
+    // -----------------------------------------------------------------------------------
+    /*!
+     * \brief  Returns a reference to the element at \c idx (idx >= size() is a violation).
+     *
+     * \note   The check follows SpanBoundsCheck<T, Extent>; with a static extent it is a compare against a constant.
+     */
+    constexpr auto operator[](size_type idx) const noexcept -> reference
+    {
+        CheckIndex(idx, size());
+        return data_[idx];
+    }
+
+    /*!
+     * \brief  Returns a reference to the first element (an empty span is a violation).
+     */
+    constexpr auto front() const noexcept -> reference
+    {
+        static_assert(Extent != 0U, "\n[ERROR] front() called on zero-sized Span!\n");
+        CheckIndex(0U, size());
+        return data_[0U];
+    }
+
+    /*!
+     * \brief  Returns a reference to the last element (an empty span is a violation).
+     */
+    constexpr auto back() const noexcept -> reference
+    {
+        static_assert(Extent != 0U, "\n[ERROR] back() called on zero-sized Span!\n");
+        CheckIndex(size() - 1U, size());
+        return data_[size() - 1U];
+    }
+
+    /*!
+     * \brief  Returns a pointer to the first element.
+     */
+    constexpr auto data() const noexcept -> pointer
+    {
+        return data_;
+    }
+
+    // -----------------------------------------------------------------------------------
+    // 5) ITERATORS
+    // -----------------------------------------------------------------------------------
+    constexpr auto begin() const noexcept -> iterator { return data_; }
+    constexpr auto end() const noexcept -> iterator { return data_ + size(); }
+    constexpr auto cbegin() const noexcept -> const_iterator { return data_; }
+    constexpr auto cend() const noexcept -> const_iterator { return data_ + size(); }
+    constexpr auto rbegin() const noexcept -> reverse_iterator { return reverse_iterator(end()); }
+    constexpr auto rend() const noexcept -> reverse_iterator { return reverse_iterator(begin()); }
+    constexpr auto crbegin() const noexcept -> const_reverse_iterator { return const_reverse_iterator(cend()); }
+    constexpr auto crend() const noexcept -> const_reverse_iterator { return const_reverse_iterator(cbegin()); }
+
+private:
+    /*!
+     * \brief  Whether the checks of this instantiation are compiled in (see BoundsCheckPolicy).
+     */
+    static constexpr auto ChecksEnabled() noexcept -> bool
+    {
+#if defined(NDEBUG)
+        return SpanBoundsCheck<T, Extent>::value == BoundsCheckPolicy::kAlways;
+#else
+        return true;
+#endif
+    }
+
+    /*!
+     * \brief  Whether an unchecked out-of-range value may be assumed impossible (kAssumeInRange).
+     */
+    static constexpr auto AssumeInRange() noexcept -> bool
+    {
+        return SpanBoundsCheck<T, Extent>::value == BoundsCheckPolicy::kAssumeInRange;
+    }
+
+    /*!
+     * \brief  Checks idx < count (element access).
+     *
+     * \note   [SWS_CORE_00090], [SWS_CORE_00091]
+     */
+    static constexpr auto CheckIndex(size_type idx, size_type count) noexcept -> void
+    {
+        if constexpr (ChecksEnabled()) {
+            if (__builtin_expect(idx >= count, 0)) {
+                ara::core::internal::ReportSpanAccessOutOfRange(ARA_CORE_INTERNAL_FILELINE, idx, count);
+            }
+        } else if constexpr (AssumeInRange()) {
+            if (idx >= count) {
+                __builtin_unreachable();
+            }
+        } else {
+            static_cast<void>(idx);
+            static_cast<void>(count);
+        }
+    }
+
+    /*!
+     * \brief  Checks requested <= available (sub-views).
+     *
+     * \note   [SWS_CORE_00090], [SWS_CORE_00091]
+     */
+    static constexpr auto CheckCount(size_type requested, size_type available) noexcept -> void
+    {
+        if constexpr (ChecksEnabled()) {
+            if (__builtin_expect(requested > available, 0)) {
+                ara::core::internal::ReportSpanAccessOutOfRange(ARA_CORE_INTERNAL_FILELINE, requested, available);
+            }
+        } else if constexpr (AssumeInRange()) {
+            if (requested > available) {
+                __builtin_unreachable();
+            }
+        } else {
+            static_cast<void>(requested);
+            static_cast<void>(available);
+        }
+    }
+
+    /*!
+     * \brief  Checks count == Extent (construction of a static-extent span).
+     *
+     * \note   [SWS_CORE_00090], [SWS_CORE_00091]
+     */
+    static constexpr auto CheckExtent(size_type count) noexcept -> void
+    {
+        if constexpr (ChecksEnabled()) {
+            if (__builtin_expect(count != Extent, 0)) {
+                ara::core::internal::ReportSpanExtentMismatch(ARA_CORE_INTERNAL_FILELINE, count, Extent);
+            }
+        } else if constexpr (AssumeInRange()) {
+            if (count != Extent) {
+                __builtin_unreachable();
+            }
+        } else {
+            static_cast<void>(count);
+        }
+    }
+
+    /*!
+     * \brief  Pointer to the first viewed element.
+     */
+    pointer data_;
+};
+
+/**********************************************************************************************************************
+ *  DEDUCTION GUIDES
+ *********************************************************************************************************************/
+template <typename T, std::size_t N>
+Span(T (&)[N]) -> Span<T, N>;
+
+template <typename T, std::size_t N>
+Span(Array<T, N>&) -> Span<T, N>;
+
+template <typename T, std::size_t N>
+Span(const Array<T, N>&) -> Span<const T, N>;
+
+template <typename Container>
+Span(Container&) -> Span<std::remove_pointer_t<decltype(std::declval<Container&>().data())>>;
+
+template <typename Container>
+Span(const Container&) -> Span<std::remove_pointer_t<decltype(std::declval<const Container&>().data())>>;
+
+/**********************************************************************************************************************
+ *  NON-MEMBER FUNCTIONS
+ *********************************************************************************************************************/
+/*!
+ * \brief  Returns a read-only view of the object representation of the elements of \c s.
+ */
+template <typename T, std::size_t Extent>
+auto as_bytes(Span<T, Extent> s) noexcept
+    -> Span<const std::byte, (Extent == dynamic_extent) ? dynamic_extent : (Extent * sizeof(T))>
+{
+    constexpr std::size_t kBytes{(Extent == dynamic_extent) ? dynamic_extent : (Extent * sizeof(T))};
+    return Span<const std::byte, kBytes>{reinterpret_cast<const std::byte*>(s.data()), s.size_bytes()};
+}
+
+/*!
+ * \brief  Returns a writable view of the object representation of the elements of \c s (T must not be const).
+ */
+template <typename T, std::size_t Extent, typename = std::enable_if_t<!std::is_const_v<T>>>
+auto as_writable_bytes(Span<T, Extent> s) noexcept
+    -> Span<std::byte, (Extent == dynamic_extent) ? dynamic_extent : (Extent * sizeof(T))>
+{
+    constexpr std::size_t kBytes{(Extent == dynamic_extent) ? dynamic_extent : (Extent * sizeof(T))};
+    return Span<std::byte, kBytes>{reinterpret_cast<std::byte*>(s.data()), s.size_bytes()};
+}
+
+/*!
+ * \brief  Creates a Span<T> over [ptr, ptr + count).
+ */
+template <typename T>
+constexpr auto MakeSpan(T* ptr, std::size_t count) noexcept -> Span<T>
+{
+    return Span<T>{ptr, count};
+}
+
+/*!
+ * \brief  Creates a Span<T, N> over a built-in array.
+ */
+template <typename T, std::size_t N>
+constexpr auto MakeSpan(T (&arr)[N]) noexcept -> Span<T, N>
+{
+    return Span<T, N>{arr};
+}
+
+/*!
+ * \brief  Creates a Span<T, N> over an ara::core::Array<T, N>.
+ */
+template <typename T, std::size_t N>
+constexpr auto MakeSpan(Array<T, N>& arr) noexcept -> Span<T, N>
+{
+    return Span<T, N>{arr};
+}
+
+/*!
+ * \brief  Creates a Span<const T, N> over a const ara::core::Array<T, N>.
+ */
+template <typename T, std::size_t N>
+constexpr auto MakeSpan(const Array<T, N>& arr) noexcept -> Span<const T, N>
+{
+    return Span<const T, N>{arr};
+}
+
+} // namespace core
+} // namespace ara
+
+#endif // OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_CORE_SPAN_H_
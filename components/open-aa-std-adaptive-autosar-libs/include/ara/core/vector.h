@@ -0,0 +1,983 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project (CXX_STANDARD 17)
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara/core/vector.h
+ *  \brief      Definition and implementation of the ara::core::Vector template class.
+ *
+ *  \details    This file defines and implements ara::core::Vector, a dynamically sized, contiguous container with the
+ *              interface of std::vector, designed for the OpenAA project:
+ *              - Storage comes from a pluggable allocator; by default ara::core::pmr::PolymorphicAllocator<T>, so the
+ *                memory_resource (arena, pool, monotonic buffer) can be chosen per instance or process-wide.
+ *              - Out-of-range at(), exceeding max_size() and exhaustion of the memory resource are reported through
+ *                ara::core::internal::ViolationHandler instead of exceptions.
+ *              - Trivially copyable element types are relocated with memcpy and compared with memcmp.
+ *
+ *  \note       Based on the Adaptive AUTOSAR SWS (e.g., R24-11) requirements for the "Vector" type, especially:
+ *              - [SWS_CORE_01301] (Definition of ara::core::Vector)
+ *              - [SWS_CORE_00040] (No exceptions used – custom violation handling)
+ *              - [SWS_CORE_00090] (Handling of Standardized Violations)
+ *
+ *  \note       Deviation from [SWS_CORE_01301]: Vector is a class (not an alias of std::vector) and the default
+ *              allocator is PolymorphicAllocator<T> instead of std::allocator<T>, so that every Vector can be served
+ *              from pre-sized resources. Any standard-conforming allocator can still be supplied.
+ *********************************************************************************************************************/
+
+#ifndef OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_CORE_VECTOR_H_
+#define OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_CORE_VECTOR_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <algorithm>         // For std::lexicographical_compare
+#include <cstddef>           // For std::size_t, std::ptrdiff_t
+#include <cstring>           // For std::memcpy
+#include <initializer_list>  // For std::initializer_list
+#include <iterator>          // For std::reverse_iterator, std::distance, std::make_move_iterator
+#include <limits>            // For std::numeric_limits
+#include <memory>            // For std::allocator_traits
+#include <type_traits>       // For std::is_trivially_copyable_v, std::is_nothrow_*_v
+#include <utility>           // For std::move, std::forward, std::move_if_noexcept
+
+#include "ara/core/internal/location_utils.h"    // For capturing file/line details
+#include "ara/core/internal/violation_handler.h" // To Trigger the violation
+#include "ara/core/internal/trivial_ops.h"       // Block-memory fast paths for trivially copyable types
+#include "ara/core/memory_resource.h"            // For ara::core::pmr::PolymorphicAllocator
+
+namespace ara {
+namespace core {
+
+/**********************************************************************************************************************
+ *  CLASS: Vector
+ *********************************************************************************************************************/
+/*!
+ * \brief  A dynamically sized, contiguous container for the Adaptive AUTOSAR platform.
+ *
+ * \tparam T          Type of elements stored in the vector.
+ * \tparam Allocator  Allocator type; its pointer type must be T*.
+ *
+ * \details
+ * - Behaves like std::vector, except that every error is a Violation (terminates the process):
+ *   - at() with index >= size()                                   => VectorAccessOutOfRangeViolation
+ *   - a request for more than max_size() elements                 => CapacityExceededViolation
+ *   - the allocator returns nullptr (memory resource exhausted)   => OutOfMemoryViolation
+ * - Allocator propagation follows std::allocator_traits (a PolymorphicAllocator never propagates).
+ * - Capacity grows geometrically (x2). Pair with reserve() during initialization for a fixed footprint.
+ *
+ * \note Unless ARA_CORE_ARRAY_ENABLE_CONDITIONAL_EXCEPTIONS is defined, T must be no-throw move/copy constructible
+ *       and assignable, aligning with [SWS_CORE_00040] and ara::core::Array.
+ *
+ * \note  [SWS_CORE_01301], [SWS_CORE_00040], [SWS_CORE_00090]
+ */
+template <typename T, typename Allocator = pmr::PolymorphicAllocator<T>>
+class Vector final
+{
+    using AllocTraits = std::allocator_traits<Allocator>;
+
+public:
+#ifdef ARA_CORE_ARRAY_ENABLE_CONDITIONAL_EXCEPTIONS
+    // In Conditional Safe Mode, allow potentially-throwing types
+#else
+    /*!
+     * \brief Enforce that T cannot throw exceptions during move or copy operations.
+     *
+     * \note  [SWS_CORE_00040]
+     */
+    static_assert(std::is_nothrow_move_constructible_v<T> &&
+                  std::is_nothrow_move_assignable_v<T> &&
+                  std::is_nothrow_copy_constructible_v<T> &&
+                  std::is_nothrow_copy_assignable_v<T>,
+                "\n[ERROR] in ara::core::Vector: The type T must be move and copy constructible\n"
+                "        and assignable without throwing exceptions. Please ensure that T's constructors and\n"
+                "        assignment operators are marked 'noexcept'.\n");
+#endif
+
+    static_assert(std::is_same_v<typename AllocTraits::value_type, T>,
+                "\n[ERROR] in ara::core::Vector: Allocator::value_type must be T.\n");
+    static_assert(std::is_same_v<typename AllocTraits::pointer, T*>,
+                "\n[ERROR] in ara::core::Vector: Allocator must use raw pointers (T*).\n");
+
+    // -----------------------------------------------------------------------------------
+    // TYPE ALIASES (public)
+    // -----------------------------------------------------------------------------------
+    using value_type             = T;
+    using allocator_type         = Allocator;
+    using size_type              = std::size_t;
+    using difference_type        = std::ptrdiff_t;
+    using reference              = T&;
+    using const_reference        = const T&;
+    using pointer                = T*;
+    using const_pointer          = const T*;
+    using iterator               = T*;
+    using const_iterator         = const T*;
+    using reverse_iterator       = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+private:
+    /*! \brief Copy operations are no-throw (always true in Safe Mode). */
+    static constexpr bool kNothrowCopy = std::is_nothrow_copy_constructible_v<T> &&
+                                         std::is_nothrow_copy_assignable_v<T>;
+
+    /*! \brief Move operations are no-throw (always true in Safe Mode). */
+    static constexpr bool kNothrowMove = std::is_nothrow_move_constructible_v<T> &&
+                                         std::is_nothrow_move_assignable_v<T>;
+
+    /*! \brief Trait: It is at least a forward iterator (the range size can be computed up front). */
+    template <typename It>
+    using EnableIfForwardIterator = std::enable_if_t<
+        std::is_base_of_v<std::forward_iterator_tag, typename std::iterator_traits<It>::iterator_category>>;
+
+public:
+    // -----------------------------------------------------------------------------------
+    // 1) CONSTRUCTORS / DESTRUCTOR
+    // -----------------------------------------------------------------------------------
+    /*!
+     * \brief  Constructs an empty vector with a default-constructed allocator (PolymorphicAllocator: default resource).
+     */
+    Vector() noexcept(noexcept(Allocator())) : Vector(Allocator()) {}
+
+    /*!
+     * \brief  Constructs an empty vector using \c alloc. Does not allocate.
+     */
+    explicit Vector(const Allocator& alloc) noexcept
+        : data_{nullptr}, size_{0U}, capacity_{0U}, alloc_(alloc)
+    {
+    }
+
+    /*!
+     * \brief  Constructs \c count value-initialized elements.
+     */
+    explicit Vector(size_type count, const Allocator& alloc = Allocator())
+        noexcept(std::is_nothrow_default_constructible_v<T>)
+        : Vector(alloc)
+    {
+        resize(count);
+    }
+
+    /*!
+     * \brief  Constructs \c count copies of \c value.
+     */
+    Vector(size_type count, const T& value, const Allocator& alloc = Allocator()) noexcept(kNothrowCopy)
+        : Vector(alloc)
+    {
+        AppendFill(count, value);
+    }
+
+    /*!
+     * \brief  Constructs from the forward range [first, last).
+     */
+    template <typename ForwardIt, typename = EnableIfForwardIterator<ForwardIt>>
+    Vector(ForwardIt first, ForwardIt last, const Allocator& alloc = Allocator()) noexcept(kNothrowCopy)
+        : Vector(alloc)
+    {
+        AssignRange(first, static_cast<size_type>(std::distance(first, last)));
+    }
+
+    /*!
+     * \brief  Constructs from an initializer list.
+     */
+    Vector(std::initializer_list<T> init, const Allocator& alloc = Allocator()) noexcept(kNothrowCopy)
+        : Vector(alloc)
+    {
+        AssignRange(init.begin(), init.size());
+    }
+
+    /*!
+     * \brief  Copy constructor; the allocator is obtained by select_on_container_copy_construction().
+     *
+     * \note   With PolymorphicAllocator the copy uses the default resource, as with std::pmr.
+     */
+    Vector(const Vector& other) noexcept(kNothrowCopy)
+        : Vector(AllocTraits::select_on_container_copy_construction(other.alloc_))
+    {
+        AssignRange(other.begin(), other.size());
+    }
+
+    /*!
+     * \brief  Copy constructor with an explicit allocator.
+     */
+    Vector(const Vector& other, const Allocator& alloc) noexcept(kNothrowCopy)
+        : Vector(alloc)
+    {
+        AssignRange(other.begin(), other.size());
+    }
+
+    /*!
+     * \brief  Move constructor; steals the storage and the allocator. Never allocates.
+     */
+    Vector(Vector&& other) noexcept
+        : data_{other.data_}, size_{other.size_}, capacity_{other.capacity_}, alloc_(std::move(other.alloc_))
+    {
+        other.data_     = nullptr;
+        other.size_     = 0U;
+        other.capacity_ = 0U;
+    }
+
+    /*!
+     * \brief  Move constructor with an explicit allocator.
+     *
+     * \details
+     * - Equal allocators => the storage is stolen.
+     * - Otherwise the elements are moved one by one into storage obtained from \c alloc.
+     */
+    Vector(Vector&& other, const Allocator& alloc) noexcept(kNothrowMove)
+        : Vector(alloc)
+    {
+        if (alloc_ == other.alloc_) {
+            StealStorage(other);
+        } else {
+            AssignRange(std::make_move_iterator(other.begin()), other.size());
+            other.clear();
+        }
+    }
+
+    /*!
+     * \brief  Destroys all elements and returns the storage to the allocator.
+     */
+    ~Vector()
+    {
+        ReleaseStorage();
+    }
+
+    // -----------------------------------------------------------------------------------
+    // 2) ASSIGNMENT
+    // -----------------------------------------------------------------------------------
+    /*!
+     * \brief  Copy assignment. Reuses the existing storage when it is large enough.
+     */
+    auto operator=(const Vector& other) noexcept(kNothrowCopy) -> Vector&
+    {
+        if (this != &other) {
+            if constexpr (AllocTraits::propagate_on_container_copy_assignment::value) {
+                if (!(alloc_ == other.alloc_)) {
+                    ReleaseStorage();
+                }
+                alloc_ = other.alloc_;
+            }
+            AssignRange(other.begin(), other.size());
+        }
+        return *this;
+    }
+
+    /*!
+     * \brief  Move assignment.
+     *
+     * \details
+     * - Propagating or equal allocators => the storage is stolen (no allocation, no element moves).
+     * - Otherwise the elements are moved one by one into the existing allocator's storage.
+     */
+    auto operator=(Vector&& other)
+        noexcept(AllocTraits::propagate_on_container_move_assignment::value ||
+                 AllocTraits::is_always_equal::value || kNothrowMove) -> Vector&
+    {
+        if (this != &other) {
+            if constexpr (AllocTraits::propagate_on_container_move_assignment::value) {
+                ReleaseStorage();
+                alloc_ = std::move(other.alloc_);
+                StealStorage(other);
+            } else {
+                if (alloc_ == other.alloc_) {
+                    ReleaseStorage();
+                    StealStorage(other);
+                } else {
+                    AssignRange(std::make_move_iterator(other.begin()), other.size());
+                    other.clear();
+                }
+            }
+        }
+        return *this;
+    }
+
+    /*!
+     * \brief  Replaces the contents with the initializer list.
+     */
+    auto operator=(std::initializer_list<T> init) noexcept(kNothrowCopy) -> Vector&
+    {
+        AssignRange(init.begin(), init.size());
+        return *this;
+    }
+
+    /*!
+     * \brief  Replaces the contents with \c count copies of \c value.
+     */
+    auto assign(size_type count, const T& value) noexcept(kNothrowCopy) -> void
+    {
+        if (count > capacity_) {
+            Vector replacement(count, value, alloc_);
+            swap(replacement);
+            return;
+        }
+
+        size_type const common = (count < size_) ? count : size_;
+        internal::FillRange(data_, common, value);
+        if (count > size_) {
+            for (T* slot = data_ + size_; slot != (data_ + count); ++slot) {
+                AllocTraits::construct(alloc_, slot, value);
+            }
+        } else {
+            DestroyRange(data_ + count, data_ + size_);
+        }
+        size_ = count;
+    }
+
+    /*!
+     * \brief  Replaces the contents with the forward range [first, last).
+     */
+    template <typename ForwardIt, typename = EnableIfForwardIterator<ForwardIt>>
+    auto assign(ForwardIt first, ForwardIt last) noexcept(kNothrowCopy) -> void
+    {
+        AssignRange(first, static_cast<size_type>(std::distance(first, last)));
+    }
+
+    /*!
+     * \brief  Replaces the contents with the initializer list.
+     */
+    auto assign(std::initializer_list<T> init) noexcept(kNothrowCopy) -> void
+    {
+        AssignRange(init.begin(), init.size());
+    }
+
+    /*!
+     * \brief  Returns a copy of the allocator.
+     */
+    auto get_allocator() const noexcept -> allocator_type
+    {
+        return alloc_;
+    }
+
+    // -----------------------------------------------------------------------------------
+    // 3) ELEMENT ACCESS
+    // -----------------------------------------------------------------------------------
+    /*!
+     * \brief  Checked element access => triggers Violation if out-of-range.
+     *
+     * \note   If idx >= size() => logs & terminates. No exceptions.
+     */
+    auto at(size_type idx) noexcept -> T&
+    {
+        if (idx >= size_) {
+            TriggerOutOfRangeViolation(ARA_CORE_INTERNAL_FILELINE, idx, size_);
+        }
+        return data_[idx];
+    }
+
+    /*!
+     * \brief  Checked element access (const) => triggers Violation if out-of-range.
+     *
+     * \note   If idx >= size() => logs & terminates. No exceptions.
+     */
+    auto at(size_type idx) const noexcept -> const T&
+    {
+        if (idx >= size_) {
+            TriggerOutOfRangeViolation(ARA_CORE_INTERNAL_FILELINE, idx, size_);
+        }
+        return data_[idx];
+    }
+
+    /*! \brief Unchecked element access. \pre idx < size(). */
+    auto operator[](size_type idx) noexcept -> T& { return data_[idx]; }
+
+    /*! \brief Unchecked element access (const). \pre idx < size(). */
+    auto operator[](size_type idx) const noexcept -> const T& { return data_[idx]; }
+
+    /*! \brief First element. \pre !empty(). */
+    auto front() noexcept -> T& { return data_[0]; }
+
+    /*! \brief First element (const). \pre !empty(). */
+    auto front() const noexcept -> const T& { return data_[0]; }
+
+    /*! \brief Last element. \pre !empty(). */
+    auto back() noexcept -> T& { return data_[size_ - 1U]; }
+
+    /*! \brief Last element (const). \pre !empty(). */
+    auto back() const noexcept -> const T& { return data_[size_ - 1U]; }
+
+    /*! \brief Pointer to the underlying storage (nullptr if nothing was ever allocated). */
+    auto data() noexcept -> T* { return data_; }
+
+    /*! \brief Pointer to the underlying storage (const). */
+    auto data() const noexcept -> const T* { return data_; }
+
+    // -----------------------------------------------------------------------------------
+    // 4) ITERATORS
+    // -----------------------------------------------------------------------------------
+    auto begin() noexcept -> iterator { return data_; }
+    auto begin() const noexcept -> const_iterator { return data_; }
+    auto cbegin() const noexcept -> const_iterator { return data_; }
+    auto end() noexcept -> iterator { return data_ + size_; }
+    auto end() const noexcept -> const_iterator { return data_ + size_; }
+    auto cend() const noexcept -> const_iterator { return data_ + size_; }
+    auto rbegin() noexcept -> reverse_iterator { return reverse_iterator(end()); }
+    auto rbegin() const noexcept -> const_reverse_iterator { return const_reverse_iterator(end()); }
+    auto crbegin() const noexcept -> const_reverse_iterator { return const_reverse_iterator(end()); }
+    auto rend() noexcept -> reverse_iterator { return reverse_iterator(begin()); }
+    auto rend() const noexcept -> const_reverse_iterator { return const_reverse_iterator(begin()); }
+    auto crend() const noexcept -> const_reverse_iterator { return const_reverse_iterator(begin()); }
+
+    // -----------------------------------------------------------------------------------
+    // 5) CAPACITY
+    // -----------------------------------------------------------------------------------
+    /*! \brief Returns whether the vector holds no element. */
+    [[nodiscard]] auto empty() const noexcept -> bool { return size_ == 0U; }
+
+    /*! \brief Returns the number of elements. */
+    auto size() const noexcept -> size_type { return size_; }
+
+    /*! \brief Returns the number of elements the current storage can hold. */
+    auto capacity() const noexcept -> size_type { return capacity_; }
+
+    /*!
+     * \brief  Returns the maximum number of elements (bounded by the allocator and by difference_type).
+     */
+    auto max_size() const noexcept -> size_type
+    {
+        constexpr size_type kDifferenceLimit =
+            static_cast<size_type>(std::numeric_limits<difference_type>::max()) / sizeof(T);
+        size_type const allocatorLimit = AllocTraits::max_size(alloc_);
+        return (allocatorLimit < kDifferenceLimit) ? allocatorLimit : kDifferenceLimit;
+    }
+
+    /*!
+     * \brief  Ensures capacity() >= \c newCapacity.
+     *
+     * \note   Intended for the initialization phase: after reserve(), push_back()/emplace_back() do not allocate
+     *         as long as size() stays within capacity().
+     */
+    auto reserve(size_type newCapacity) noexcept(kNothrowMove) -> void
+    {
+        if (newCapacity > capacity_) {
+            if (newCapacity > max_size()) {
+                TriggerCapacityViolation(ARA_CORE_INTERNAL_FILELINE, newCapacity);
+            }
+            Reallocate(newCapacity);
+        }
+    }
+
+    /*!
+     * \brief  Reduces capacity() to size(), returning unused storage to the allocator.
+     */
+    auto shrink_to_fit() noexcept(kNothrowMove) -> void
+    {
+        if (size_ < capacity_) {
+            if (size_ == 0U) {
+                ReleaseStorage();
+            } else {
+                Reallocate(size_);
+            }
+        }
+    }
+
+    // -----------------------------------------------------------------------------------
+    // 6) MODIFIERS
+    // -----------------------------------------------------------------------------------
+    /*!
+     * \brief  Destroys all elements; capacity() is unchanged.
+     */
+    auto clear() noexcept -> void
+    {
+        DestroyRange(data_, data_ + size_);
+        size_ = 0U;
+    }
+
+    /*!
+     * \brief  Inserts a copy of \c value before \c pos.
+     */
+    auto insert(const_iterator pos, const T& value) noexcept(kNothrowCopy && kNothrowMove) -> iterator
+    {
+        return emplace(pos, value);
+    }
+
+    /*!
+     * \brief  Inserts \c value (moved) before \c pos.
+     */
+    auto insert(const_iterator pos, T&& value) noexcept(kNothrowMove) -> iterator
+    {
+        return emplace(pos, std::move(value));
+    }
+
+    /*!
+     * \brief  Inserts \c count copies of \c value before \c pos.
+     */
+    auto insert(const_iterator pos, size_type count, const T& value)
+        noexcept(kNothrowCopy && kNothrowMove) -> iterator
+    {
+        size_type const index   = static_cast<size_type>(pos - data_);
+        size_type const oldSize = size_;
+        AppendFill(count, value);
+        internal::RotateRange(data_, index, oldSize, size_);
+        return data_ + index;
+    }
+
+    /*!
+     * \brief  Inserts the forward range [first, last) before \c pos.
+     *
+     * \pre    [first, last) does not refer to elements of \c *this.
+     */
+    template <typename ForwardIt, typename = EnableIfForwardIterator<ForwardIt>>
+    auto insert(const_iterator pos, ForwardIt first, ForwardIt last)
+        noexcept(kNothrowCopy && kNothrowMove) -> iterator
+    {
+        size_type const index   = static_cast<size_type>(pos - data_);
+        size_type const oldSize = size_;
+        size_type const count   = static_cast<size_type>(std::distance(first, last));
+        reserve(RecommendCapacity(count));
+        for (; first != last; ++first) {
+            AllocTraits::construct(alloc_, data_ + size_, *first);
+            ++size_;
+        }
+        internal::RotateRange(data_, index, oldSize, size_);
+        return data_ + index;
+    }
+
+    /*!
+     * \brief  Inserts the initializer list before \c pos.
+     */
+    auto insert(const_iterator pos, std::initializer_list<T> init) noexcept(kNothrowCopy && kNothrowMove) -> iterator
+    {
+        return insert(pos, init.begin(), init.end());
+    }
+
+    /*!
+     * \brief  Constructs an element in place before \c pos.
+     *
+     * \details
+     * - Appends the new element, then rotates it into position. \c args may refer to elements of \c *this.
+     */
+    template <typename... Args>
+    auto emplace(const_iterator pos, Args&&... args)
+        noexcept(std::is_nothrow_constructible_v<T, Args&&...> && kNothrowMove) -> iterator
+    {
+        size_type const index = static_cast<size_type>(pos - data_);
+        emplace_back(std::forward<Args>(args)...);
+        internal::RotateRange(data_, index, size_ - 1U, size_);
+        return data_ + index;
+    }
+
+    /*!
+     * \brief  Erases the element at \c pos.
+     */
+    auto erase(const_iterator pos) noexcept(kNothrowMove) -> iterator
+    {
+        return erase(pos, pos + 1);
+    }
+
+    /*!
+     * \brief  Erases the elements in [first, last).
+     */
+    auto erase(const_iterator first, const_iterator last) noexcept(kNothrowMove) -> iterator
+    {
+        size_type const index   = static_cast<size_type>(first - data_);
+        size_type const removed = static_cast<size_type>(last - first);
+        if (removed > 0U) {
+            for (size_type i = index + removed; i < size_; ++i) {
+                data_[i - removed] = std::move(data_[i]);
+            }
+            DestroyRange(data_ + (size_ - removed), data_ + size_);
+            size_ -= removed;
+        }
+        return data_ + index;
+    }
+
+    /*!
+     * \brief  Appends a copy of \c value.
+     */
+    auto push_back(const T& value) noexcept(kNothrowCopy && kNothrowMove) -> void
+    {
+        emplace_back(value);
+    }
+
+    /*!
+     * \brief  Appends \c value (moved).
+     */
+    auto push_back(T&& value) noexcept(kNothrowMove) -> void
+    {
+        emplace_back(std::move(value));
+    }
+
+    /*!
+     * \brief  Constructs an element in place at the end.
+     *
+     * \return Reference to the new element.
+     *
+     * \details
+     * - When storage must grow, the new element is constructed in the new storage before the existing ones are
+     *   relocated, so \c args may refer to elements of \c *this.
+     */
+    template <typename... Args>
+    auto emplace_back(Args&&... args)
+        noexcept(std::is_nothrow_constructible_v<T, Args&&...> && kNothrowMove) -> T&
+    {
+        if (size_ == capacity_) {
+            size_type const newCapacity = RecommendCapacity(1U);
+            T* const newData = AllocateStorage(newCapacity);
+            AllocTraits::construct(alloc_, newData + size_, std::forward<Args>(args)...);
+            AdoptStorage(newData, newCapacity);
+        } else {
+            AllocTraits::construct(alloc_, data_ + size_, std::forward<Args>(args)...);
+        }
+        ++size_;
+        return back();
+    }
+
+    /*!
+     * \brief  Removes the last element. \pre !empty().
+     */
+    auto pop_back() noexcept -> void
+    {
+        --size_;
+        AllocTraits::destroy(alloc_, data_ + size_);
+    }
+
+    /*!
+     * \brief  Resizes to \c count elements; new elements are value-initialized.
+     */
+    auto resize(size_type count) noexcept(std::is_nothrow_default_constructible_v<T> && kNothrowMove) -> void
+    {
+        if (count < size_) {
+            DestroyRange(data_ + count, data_ + size_);
+            size_ = count;
+            return;
+        }
+
+        reserve(RecommendCapacity(count - size_));
+        for (; size_ < count; ++size_) {
+            AllocTraits::construct(alloc_, data_ + size_);
+        }
+    }
+
+    /*!
+     * \brief  Resizes to \c count elements; new elements are copies of \c value.
+     */
+    auto resize(size_type count, const T& value) noexcept(kNothrowCopy && kNothrowMove) -> void
+    {
+        if (count < size_) {
+            DestroyRange(data_ + count, data_ + size_);
+            size_ = count;
+            return;
+        }
+
+        AppendFill(count - size_, value);
+    }
+
+    /*!
+     * \brief  Exchanges the contents with \c other. Never allocates.
+     *
+     * \pre    The allocators propagate on swap or compare equal (as for std::vector).
+     */
+    auto swap(Vector& other) noexcept -> void
+    {
+        if constexpr (AllocTraits::propagate_on_container_swap::value) {
+            using std::swap;
+            swap(alloc_, other.alloc_);
+        }
+        std::swap(data_, other.data_);
+        std::swap(size_, other.size_);
+        std::swap(capacity_, other.capacity_);
+    }
+
+private:
+    // -----------------------------------------------------------------------------------
+    // STORAGE MANAGEMENT (private)
+    // -----------------------------------------------------------------------------------
+    /*!
+     * \brief  Returns the capacity to use when \c additional more elements are needed.
+     *
+     * \details
+     * - Geometric growth (x2), at least size() + additional, at most max_size().
+     * - size() + additional > max_size() => CapacityExceededViolation.
+     */
+    auto RecommendCapacity(size_type additional) const noexcept -> size_type
+    {
+        size_type const maximum = max_size();
+        if (additional > (maximum - size_)) {
+            TriggerCapacityViolation(ARA_CORE_INTERNAL_FILELINE, additional, maximum - size_);
+        }
+
+        size_type const required = size_ + additional;
+        if (required <= capacity_) {
+            return capacity_;
+        }
+        if (capacity_ >= (maximum / 2U)) {
+            return maximum;
+        }
+        size_type const doubled = capacity_ * 2U;
+        return (doubled > required) ? doubled : required;
+    }
+
+    /*!
+     * \brief  Obtains storage for \c count elements; exhaustion => OutOfMemoryViolation.
+     */
+    auto AllocateStorage(size_type count) noexcept -> T*
+    {
+        T* const storage = AllocTraits::allocate(alloc_, count);
+        if (storage == nullptr) {
+            auto& violation_trigger = ara::core::internal::ViolationHandler::Instance();
+            violation_trigger.TriggerOutOfMemoryViolation(ARA_CORE_INTERNAL_FILELINE, count * sizeof(T));
+        }
+        return storage;
+    }
+
+    /*!
+     * \brief  Relocates the current elements into \c newData and makes it the storage.
+     */
+    auto AdoptStorage(T* newData, size_type newCapacity) noexcept(kNothrowMove) -> void
+    {
+        Relocate(newData, data_, size_);
+        if (data_ != nullptr) {
+            AllocTraits::deallocate(alloc_, data_, capacity_);
+        }
+        data_     = newData;
+        capacity_ = newCapacity;
+    }
+
+    /*!
+     * \brief  Moves the elements into fresh storage of exactly \c newCapacity elements.
+     */
+    auto Reallocate(size_type newCapacity) noexcept(kNothrowMove) -> void
+    {
+        AdoptStorage(AllocateStorage(newCapacity), newCapacity);
+    }
+
+    /*!
+     * \brief  Destroys all elements and returns the storage.
+     */
+    auto ReleaseStorage() noexcept -> void
+    {
+        clear();
+        if (data_ != nullptr) {
+            AllocTraits::deallocate(alloc_, data_, capacity_);
+            data_     = nullptr;
+            capacity_ = 0U;
+        }
+    }
+
+    /*!
+     * \brief  Takes over the storage of \c other (which must be empty-handed afterwards).
+     */
+    auto StealStorage(Vector& other) noexcept -> void
+    {
+        data_           = other.data_;
+        size_           = other.size_;
+        capacity_       = other.capacity_;
+        other.data_     = nullptr;
+        other.size_     = 0U;
+        other.capacity_ = 0U;
+    }
+
+    /*!
+     * \brief  Move-constructs \c count elements from \c src into uninitialized \c dst and destroys the sources.
+     *
+     * \details
+     * - Trivially copyable T => one memcpy.
+     */
+    auto Relocate(T* dst, T* src, size_type count) noexcept(kNothrowMove) -> void
+    {
+        if constexpr (internal::is_block_copyable_v<T>) {
+            if (count > 0U) {
+                std::memcpy(static_cast<void*>(dst), static_cast<const void*>(src), count * sizeof(T));
+            }
+        } else {
+            for (size_type i = 0U; i < count; ++i) {
+                AllocTraits::construct(alloc_, dst + i, std::move_if_noexcept(src[i]));
+                AllocTraits::destroy(alloc_, src + i);
+            }
+        }
+    }
+
+    /*!
+     * \brief  Destroys the elements in [first, last) (no-op for trivially destructible T).
+     */
+    auto DestroyRange(T* first, T* last) noexcept -> void
+    {
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            for (; first != last; ++first) {
+                AllocTraits::destroy(alloc_, first);
+            }
+        }
+    }
+
+    /*!
+     * \brief  Appends \c count copies of \c value.
+     *
+     * \details
+     * - When storage must grow, the copies are made in the new storage before the existing elements are
+     *   relocated, so \c value may refer to an element of \c *this.
+     */
+    auto AppendFill(size_type count, const T& value) noexcept(kNothrowCopy && kNothrowMove) -> void
+    {
+        if (count > (capacity_ - size_)) {
+            size_type const newCapacity = RecommendCapacity(count);
+            T* const newData = AllocateStorage(newCapacity);
+            for (T* slot = newData + size_; slot != (newData + size_ + count); ++slot) {
+                AllocTraits::construct(alloc_, slot, value);
+            }
+            AdoptStorage(newData, newCapacity);
+        } else {
+            for (T* slot = data_ + size_; slot != (data_ + size_ + count); ++slot) {
+                AllocTraits::construct(alloc_, slot, value);
+            }
+        }
+        size_ += count;
+    }
+
+    /*!
+     * \brief  Replaces the contents with \c count elements read from \c first.
+     *
+     * \details
+     * - Fits in capacity() => existing elements are assigned, the rest constructed or destroyed.
+     * - Otherwise => fresh storage of exactly \c count elements.
+     */
+    template <typename InputIt>
+    auto AssignRange(InputIt first, size_type count) noexcept(kNothrowCopy && kNothrowMove) -> void
+    {
+        if (count > capacity_) {
+            if (count > max_size()) {
+                TriggerCapacityViolation(ARA_CORE_INTERNAL_FILELINE, count);
+            }
+            T* const newData = AllocateStorage(count);
+            for (T* slot = newData; slot != (newData + count); ++slot, ++first) {
+                AllocTraits::construct(alloc_, slot, *first);
+            }
+            ReleaseStorage();
+            data_     = newData;
+            size_     = count;
+            capacity_ = count;
+            return;
+        }
+
+        size_type const common = (count < size_) ? count : size_;
+        for (T* slot = data_; slot != (data_ + common); ++slot, ++first) {
+            *slot = *first;
+        }
+        if (count > size_) {
+            for (T* slot = data_ + size_; slot != (data_ + count); ++slot, ++first) {
+                AllocTraits::construct(alloc_, slot, *first);
+            }
+        } else {
+            DestroyRange(data_ + count, data_ + size_);
+        }
+        size_ = count;
+    }
+
+    // -----------------------------------------------------------------------------------
+    // VIOLATIONS (private)
+    // -----------------------------------------------------------------------------------
+    /*!
+     * \brief Logs + terminates upon vector-access-out-of-range.
+     *
+     * \note  [SWS_CORE_00090]
+     */
+    [[noreturn]] auto TriggerOutOfRangeViolation(std::string_view location,
+                                                 size_type invalidIndex,
+                                                 size_type vectorSize) const noexcept -> void
+    {
+        auto& violation_trigger = ara::core::internal::ViolationHandler::Instance();
+        violation_trigger.TriggerVectorAccessOutOfRangeViolation(location, invalidIndex, vectorSize);
+    }
+
+    /*!
+     * \brief Logs + terminates when more than max_size() elements are requested.
+     *
+     * \note  [SWS_CORE_00090]
+     */
+    [[noreturn]] auto TriggerCapacityViolation(std::string_view location,
+                                               size_type requested,
+                                               size_type maximum) const noexcept -> void
+    {
+        auto& violation_trigger = ara::core::internal::ViolationHandler::Instance();
+        violation_trigger.TriggerCapacityExceededViolation(location, requested, maximum);
+    }
+
+    /*!
+     * \brief Logs + terminates when more than max_size() elements are requested.
+     */
+    [[noreturn]] auto TriggerCapacityViolation(std::string_view location, size_type requested) const noexcept -> void
+    {
+        TriggerCapacityViolation(location, requested, max_size());
+    }
+
+    T*          data_;      /*!< Start of the storage (nullptr if none). */
+    size_type   size_;      /*!< Number of constructed elements.          */
+    size_type   capacity_;  /*!< Number of elements the storage can hold. */
+    Allocator   alloc_;     /*!< The allocator providing the storage.     */
+};
+
+/**********************************************************************************************************************
+ *  NON-MEMBER FUNCTIONS
+ *********************************************************************************************************************/
+/*!
+ * \brief  Equality: same size and element-wise equal (memcmp for bitwise-comparable T).
+ */
+template <typename T, typename Allocator>
+inline auto operator==(const Vector<T, Allocator>& lhs, const Vector<T, Allocator>& rhs)
+    noexcept(noexcept(std::declval<const T&>() == std::declval<const T&>())) -> bool
+{
+    return (lhs.size() == rhs.size()) && internal::EqualRanges(lhs.data(), rhs.data(), lhs.size());
+}
+
+template <typename T, typename Allocator>
+inline auto operator!=(const Vector<T, Allocator>& lhs, const Vector<T, Allocator>& rhs)
+    noexcept(noexcept(lhs == rhs)) -> bool
+{
+    return !(lhs == rhs);
+}
+
+/*!
+ * \brief  Lexicographical ordering using only T's operator<.
+ */
+template <typename T, typename Allocator>
+inline auto operator<(const Vector<T, Allocator>& lhs, const Vector<T, Allocator>& rhs)
+    noexcept(noexcept(std::declval<const T&>() < std::declval<const T&>())) -> bool
+{
+    return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template <typename T, typename Allocator>
+inline auto operator>(const Vector<T, Allocator>& lhs, const Vector<T, Allocator>& rhs)
+    noexcept(noexcept(rhs < lhs)) -> bool
+{
+    return rhs < lhs;
+}
+
+template <typename T, typename Allocator>
+inline auto operator<=(const Vector<T, Allocator>& lhs, const Vector<T, Allocator>& rhs)
+    noexcept(noexcept(rhs < lhs)) -> bool
+{
+    return !(rhs < lhs);
+}
+
+template <typename T, typename Allocator>
+inline auto operator>=(const Vector<T, Allocator>& lhs, const Vector<T, Allocator>& rhs)
+    noexcept(noexcept(lhs < rhs)) -> bool
+{
+    return !(lhs < rhs);
+}
+
+/*!
+ * \brief  Exchanges the contents of two vectors.
+ */
+template <typename T, typename Allocator>
+inline auto swap(Vector<T, Allocator>& lhs, Vector<T, Allocator>& rhs) noexcept -> void
+{
+    lhs.swap(rhs);
+}
+
+namespace pmr {
+
+/*!
+ * \brief  Vector whose storage comes from a MemoryResource (the default Vector already is one).
+ */
+template <typename T>
+using Vector = ara::core::Vector<T, PolymorphicAllocator<T>>;
+
+} // namespace pmr
+
+} // namespace core
+} // namespace ara
+
+#endif // OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_CORE_VECTOR_H_
@@ -0,0 +1,88 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project (CXX_STANDARD 17)
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara/log/common.h
+ *  \brief      Common types of the ara::log functional cluster.
+ *
+ *  \details    Defines the severity levels (LogLevel) and the sink selection (LogMode) shared by the Logger front end
+ *              and the asynchronous LogBackend.
+ *
+ *  \note       Based on the Adaptive AUTOSAR SWS (e.g., R24-11) requirements, especially:
+ *              - [SWS_LOG_00018] (LogLevel)
+ *              - [SWS_LOG_00019] (LogMode)
+ *********************************************************************************************************************/
+
+#ifndef OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_LOG_COMMON_H_
+#define OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_LOG_COMMON_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <cstdint>       // For std::uint8_t
+
+namespace ara {
+namespace log {
+
+/**********************************************************************************************************************
+ *  ENUM: LogLevel
+ *********************************************************************************************************************/
+/*!
+ * \brief  Severity of a log message; a message is emitted if its level is less than or equal to the threshold.
+ *
+ * \note   [SWS_LOG_00018]
+ */
+enum class LogLevel : std::uint8_t {
+    kOff     = 0x00,   /*!< No logging */
+    kFatal   = 0x01,   /*!< Fatal error, not recoverable */
+    kError   = 0x02,   /*!< Error with impact on correct functionality */
+    kWarn    = 0x03,   /*!< Warning if correct behavior cannot be ensured */
+    kInfo    = 0x04,   /*!< Message of the normal operation */
+    kDebug   = 0x05,   /*!< Debug information */
+    kVerbose = 0x06    /*!< Highest grade of information */
+};
+
+/**********************************************************************************************************************
+ *  ENUM: LogMode
+ *********************************************************************************************************************/
+/*!
+ * \brief  Sinks of the LogBackend; values can be combined with operator|.
+ *
+ * \details
+ * - kRemote:  The platform system logger (slogger2 on QNX, syslog on Linux).
+ * - kFile:    A file opened in append mode.
+ * - kConsole: stdout (kError and kFatal messages go to stderr).
+ *
+ * \note   [SWS_LOG_00019]
+ */
+enum class LogMode : std::uint8_t {
+    kRemote  = 0x01,
+    kFile    = 0x02,
+    kConsole = 0x04
+};
+
+/*!
+ * \brief  Combines two LogMode values.
+ */
+constexpr auto operator|(LogMode lhs, LogMode rhs) noexcept -> LogMode
+{
+    return static_cast<LogMode>(static_cast<std::uint8_t>(lhs) | static_cast<std::uint8_t>(rhs));
+}
+
+/*!
+ * \brief  Whether \c mode contains \c sink.
+ */
+constexpr auto HasLogMode(LogMode mode, LogMode sink) noexcept -> bool
+{
+    return (static_cast<std::uint8_t>(mode) & static_cast<std::uint8_t>(sink)) != 0U;
+}
+
+} // namespace log
+} // namespace ara
+
+#endif // OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_LOG_COMMON_H_
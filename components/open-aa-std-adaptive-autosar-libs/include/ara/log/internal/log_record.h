@@ -0,0 +1,233 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project (CXX_STANDARD 17)
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara/log/internal/log_record.h
+ *  \brief      Binary log record and the producer hooks of the asynchronous LogBackend.
+ *
+ *  \details    A log call does not format anything: it stores the address of its format string (the format ID), the
+ *              context, the level, a timestamp and the raw arguments into a fixed-size Record. The Record is written
+ *              in place into the calling thread's SPSC ring of the LogBackend and formatted later by the backend
+ *              thread.
+ *
+ *              Payload encoding, one entry per argument:
+ *              - [ArgType][8 bytes]               for bool, char, integers, floating point values and pointers.
+ *              - [ArgType::kString][length][text] for strings; the text is copied (not referenced) and truncated to
+ *                the free payload space (at most 255 bytes).
+ *              Arguments that do not fit anymore are dropped; their placeholders are printed as "{}".
+ *********************************************************************************************************************/
+
+#ifndef OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_LOG_INTERNAL_LOG_RECORD_H_
+#define OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_LOG_INTERNAL_LOG_RECORD_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include "ara/log/common.h"
+
+#include <cstddef>       // For std::size_t
+#include <cstdint>       // For fixed-width integer types
+#include <cstring>       // For std::memcpy, std::strlen
+#include <string_view>   // For std::string_view
+#include <type_traits>   // For std::is_integral_v, std::is_enum_v, ...
+
+namespace ara {
+namespace log {
+namespace internal {
+
+/**********************************************************************************************************************
+ *  ENUM: ArgType
+ *********************************************************************************************************************/
+/*!
+ * \brief  Type tag of an encoded argument.
+ */
+enum class ArgType : std::uint8_t {
+    kBool = 0,
+    kChar,
+    kSigned,
+    kUnsigned,
+    kDouble,
+    kString,
+    kPointer
+};
+
+/**********************************************************************************************************************
+ *  STRUCT: Record
+ *********************************************************************************************************************/
+/*!
+ * \brief  Size of one Record (two cache lines).
+ */
+constexpr std::size_t kRecordSize{128U};
+
+/*!
+ * \brief  Bytes available for the encoded arguments of one Record.
+ */
+constexpr std::size_t kPayloadCapacity{101U};
+
+/*!
+ * \brief  One log message in binary form.
+ *
+ * \details \c format and \c context must point to storage that outlives the LogBackend (string literals).
+ */
+struct Record {
+    std::int64_t  timestamp{0};             /*!< Steady clock time of the log call in nanoseconds */
+    const char*   format{nullptr};          /*!< Format string ("{}" placeholders); its address is the format ID */
+    const char*   context{nullptr};         /*!< Context of the Logger */
+    LogLevel      level{LogLevel::kOff};    /*!< Severity */
+    std::uint8_t  argCount{0U};             /*!< Number of encoded arguments */
+    std::uint8_t  payloadSize{0U};          /*!< Used bytes of payload */
+    std::uint8_t  payload[kPayloadCapacity]{};
+};
+
+static_assert(sizeof(Record) == kRecordSize, "Record must be exactly kRecordSize bytes");
+
+/**********************************************************************************************************************
+ *  CLASS: RecordWriter
+ *********************************************************************************************************************/
+/*!
+ * \brief  Encodes arguments into the payload of a Record.
+ */
+class RecordWriter final {
+public:
+    /*!
+     * \brief  Starts an empty payload in \c record.
+     */
+    explicit RecordWriter(Record& record) noexcept : record_{record}
+    {
+        record_.argCount    = 0U;
+        record_.payloadSize = 0U;
+    }
+
+    /*!
+     * \brief  Appends a fixed-size argument (8 bytes value).
+     */
+    auto PutValue(ArgType type, const void* value) noexcept -> void
+    {
+        constexpr std::size_t kEntrySize{1U + sizeof(std::uint64_t)};
+        if ((static_cast<std::size_t>(record_.payloadSize) + kEntrySize) <= kPayloadCapacity) {
+            std::uint8_t* const entry = &record_.payload[record_.payloadSize];
+            entry[0] = static_cast<std::uint8_t>(type);
+            std::memcpy(&entry[1], value, sizeof(std::uint64_t));
+            record_.payloadSize = static_cast<std::uint8_t>(record_.payloadSize + kEntrySize);
+            ++record_.argCount;
+        }
+    }
+
+    /*!
+     * \brief  Appends a string argument, truncated to the free payload space.
+     */
+    auto PutString(std::string_view text) noexcept -> void
+    {
+        constexpr std::size_t kHeaderSize{2U};
+        std::size_t const used = static_cast<std::size_t>(record_.payloadSize);
+        if ((used + kHeaderSize) <= kPayloadCapacity) {
+            std::size_t length = kPayloadCapacity - used - kHeaderSize;
+            length = (text.size() < length) ? text.size() : length;
+            length = (length < 255U) ? length : 255U;
+
+            std::uint8_t* const entry = &record_.payload[used];
+            entry[0] = static_cast<std::uint8_t>(ArgType::kString);
+            entry[1] = static_cast<std::uint8_t>(length);
+            if (length > 0U) {
+                std::memcpy(&entry[kHeaderSize], text.data(), length);
+            }
+            record_.payloadSize = static_cast<std::uint8_t>(used + kHeaderSize + length);
+            ++record_.argCount;
+        }
+    }
+
+    /*!
+     * \brief  Encodes one argument according to its type.
+     */
+    template <typename T>
+    auto Put(const T& value) noexcept -> void
+    {
+        using Type = std::remove_cv_t<std::remove_reference_t<T>>;
+
+        if constexpr (std::is_same_v<Type, bool>) {
+            std::uint64_t const raw = value ? 1U : 0U;
+            PutValue(ArgType::kBool, &raw);
+        } else if constexpr (std::is_same_v<Type, char>) {
+            std::uint64_t const raw = static_cast<std::uint8_t>(value);
+            PutValue(ArgType::kChar, &raw);
+        } else if constexpr (std::is_enum_v<Type>) {
+            Put(static_cast<std::underlying_type_t<Type>>(value));
+        } else if constexpr (std::is_integral_v<Type> && std::is_signed_v<Type>) {
+            std::int64_t const raw = static_cast<std::int64_t>(value);
+            PutValue(ArgType::kSigned, &raw);
+        } else if constexpr (std::is_integral_v<Type>) {
+            std::uint64_t const raw = static_cast<std::uint64_t>(value);
+            PutValue(ArgType::kUnsigned, &raw);
+        } else if constexpr (std::is_floating_point_v<Type>) {
+            double const raw = static_cast<double>(value);
+            PutValue(ArgType::kDouble, &raw);
+        } else if constexpr (std::is_array_v<Type> || std::is_same_v<Type, const char*> ||
+                             std::is_same_v<Type, char*>) {
+            const char* const text = value;
+            PutString((text != nullptr) ? std::string_view(text) : std::string_view("(null)"));
+        } else if constexpr (std::is_convertible_v<const Type&, std::string_view>) {
+            PutString(std::string_view(value));
+        } else if constexpr (std::is_pointer_v<Type>) {
+            std::uint64_t const raw = static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(value));
+            PutValue(ArgType::kPointer, &raw);
+        } else {
+            static_assert(std::is_pointer_v<Type>, "Unsupported ara::log argument type");
+        }
+    }
+
+private:
+    Record& record_;
+};
+
+/**********************************************************************************************************************
+ *  SECTION: Producer hooks (implemented by the LogBackend)
+ *********************************************************************************************************************/
+/*!
+ * \brief  Whether the backend thread is running; otherwise log calls are formatted synchronously.
+ */
+auto IsAsynchronous() noexcept -> bool;
+
+/*!
+ * \brief  Process-wide threshold of the LogBackend.
+ */
+auto GetThreshold() noexcept -> LogLevel;
+
+/*!
+ * \brief  Returns the next free Record of the calling thread's ring.
+ *
+ * \return The Record to fill, or nullptr if the ring is full or no ring is left (the message is counted as dropped).
+ *
+ * \note   Wait-free; no allocation and no system call. Must be followed by CommitRecord() on the same thread.
+ */
+auto AcquireRecord() noexcept -> Record*;
+
+/*!
+ * \brief  Publishes the Record returned by the last AcquireRecord() of the calling thread.
+ *
+ * \note   If the backend stopped since IsAsynchronous() was checked, the caller writes the pending Records itself
+ *         (LogBackend::Flush()), so a Stop() racing with the log call loses nothing.
+ */
+auto CommitRecord() noexcept -> void;
+
+/*!
+ * \brief  Formats \c record and writes it on the calling thread (used for kFatal and when no backend runs).
+ */
+auto EmitRecord(const Record& record) noexcept -> void;
+
+/*!
+ * \brief  Formats \c record as one line ("[context][LEVEL] message\n", optionally prefixed by the timestamp).
+ *
+ * \return Number of characters written to \c buffer (at most \c capacity, always ending with '\n').
+ */
+auto FormatRecord(const Record& record, char* buffer, std::size_t capacity, bool timestamp) noexcept -> std::size_t;
+
+} // namespace internal
+} // namespace log
+} // namespace ara
+
+#endif // OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_LOG_INTERNAL_LOG_RECORD_H_
@@ -0,0 +1,219 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project (CXX_STANDARD 17)
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara/log/log_backend.h
+ *  \brief      Declaration of the asynchronous ara::log::LogBackend.
+ *
+ *  \details    The LogBackend owns kMaxThreads single-producer/single-consumer rings of binary Records in static
+ *              storage. A thread logging for the first time claims a free ring and keeps it until it exits. A
+ *              low-priority (SCHED_OTHER) backend thread merges the rings in timestamp order, formats the Records and
+ *              writes them in batches to the configured sinks (LogMode).
+ *
+ *  \note       No heap allocation: rings, batches and line buffers are statically sized.
+ *********************************************************************************************************************/
+
+#ifndef OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_LOG_LOG_BACKEND_H_
+#define OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_LOG_LOG_BACKEND_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include "ara/log/common.h"
+#include "ara/log/internal/log_record.h"
+
+#include <pthread.h>     // For pthread_t
+#include <atomic>        // For std::atomic
+#include <chrono>        // For std::chrono::milliseconds
+#include <cstddef>       // For std::size_t
+#include <cstdint>       // For fixed-width integer types
+#include <mutex>         // For std::mutex
+
+namespace ara {
+namespace log {
+
+/**********************************************************************************************************************
+ *  ENUM: ErrorCode
+ *********************************************************************************************************************/
+/*!
+ * \brief  Result of LogBackend::Start().
+ */
+enum class ErrorCode : std::uint8_t {
+    Success = 0,            /*!< The backend thread is running */
+    AlreadyRunning,         /*!< Start() was called twice */
+    InvalidArgument,        /*!< kFile without a file path, or a drain period of zero */
+    SinkFailure,            /*!< The log file could not be opened */
+    ThreadCreationFailed    /*!< The backend thread could not be created */
+};
+
+/**********************************************************************************************************************
+ *  STRUCT: BackendConfig
+ *********************************************************************************************************************/
+/*!
+ * \brief  Configuration of the LogBackend.
+ *
+ * \details
+ * - applicationId: Identifier given to the system logger (kRemote).
+ * - timestamps:    Prefix each line with the steady clock time in seconds.
+ * - drainPeriod:   Sleep of the backend thread when all rings are empty (bounds the output latency).
+ */
+struct BackendConfig {
+    LogMode                   mode{LogMode::kConsole};
+    LogLevel                  level{LogLevel::kInfo};
+    const char*               filePath{nullptr};
+    const char*               applicationId{"OpenAA"};
+    bool                      timestamps{false};
+    std::chrono::milliseconds drainPeriod{1};
+};
+
+/**********************************************************************************************************************
+ *  CLASS: LogBackend
+ *********************************************************************************************************************/
+/*!
+ * \brief  Process-wide asynchronous log backend (singleton).
+ */
+class LogBackend final {
+public:
+    /*!
+     * \brief  Maximum number of threads logging concurrently; further threads drop their messages.
+     */
+    static constexpr std::size_t kMaxThreads{16U};
+
+    /*!
+     * \brief  Records per thread ring (power of two).
+     */
+    static constexpr std::size_t kRingCapacity{256U};
+
+    /*!
+     * \brief  Maximum length of a formatted line, including the newline; longer lines are truncated.
+     */
+    static constexpr std::size_t kMaxLineLength{512U};
+
+    /*!
+     * \brief  Returns the singleton.
+     */
+    static auto Instance() noexcept -> LogBackend&;
+
+    /*!
+     * \brief  Opens the sinks and starts the backend thread.
+     *
+     * \return ErrorCode::Success, AlreadyRunning, InvalidArgument, SinkFailure or ThreadCreationFailed.
+     */
+    auto Start(const BackendConfig& config) noexcept -> ErrorCode;
+
+    /*!
+     * \brief  Writes all pending messages, stops the backend thread and closes the sinks. Safe to call when stopped.
+     */
+    auto Stop() noexcept -> void;
+
+    /*!
+     * \brief  Returns once every message committed before the call has been written (and the rings of exited
+     *         threads have been released). Must not be called from a real-time thread.
+     */
+    auto Flush() noexcept -> void;
+
+    /*!
+     * \brief  Whether the backend thread is running.
+     */
+    auto IsRunning() const noexcept -> bool;
+
+    /*!
+     * \brief  Sets the process-wide threshold (also effective while stopped).
+     */
+    auto SetLevel(LogLevel level) noexcept -> void;
+
+    /*!
+     * \brief  Process-wide threshold.
+     */
+    auto GetLevel() const noexcept -> LogLevel;
+
+    /*!
+     * \brief  Total number of messages dropped because a ring was full or no ring was left.
+     */
+    auto GetDroppedCount() const noexcept -> std::uint64_t;
+
+    LogBackend(const LogBackend&) = delete;
+    LogBackend(LogBackend&&) = delete;
+    auto operator=(const LogBackend&) -> LogBackend& = delete;
+    auto operator=(LogBackend&&) -> LogBackend& = delete;
+
+private:
+    LogBackend() noexcept = default;
+
+    /*!
+     * \brief  Stops the backend thread (see Stop()).
+     */
+    ~LogBackend() noexcept;
+
+    /*!
+     * \brief  pthread entry point; \c argument is the LogBackend.
+     */
+    static auto ThreadEntry(void* argument) noexcept -> void*;
+
+    /*!
+     * \brief  Drain loop of the backend thread.
+     */
+    auto Run() noexcept -> void;
+
+    /*!
+     * \brief  Writes up to \c limit Records in timestamp order, then reports drops and releases orphaned rings.
+     *
+     * \return Number of Records written.
+     */
+    auto Drain(std::size_t limit) noexcept -> std::size_t;
+
+    /*!
+     * \brief  Appends a formatted line to the batches of the configured sinks.
+     */
+    auto Output(LogLevel level, const char* line, std::size_t length) noexcept -> void;
+
+    /*!
+     * \brief  Writes and empties the batches.
+     */
+    auto FlushBatches() noexcept -> void;
+
+    /*!
+     * \brief  Formats \c record and writes it directly to the sinks, bypassing the rings.
+     *
+     * \note   Runs on the producer thread under control_, so Start() and Stop() cannot change or close the sinks
+     *         during the write.
+     */
+    auto WriteNow(const internal::Record& record) noexcept -> void;
+
+    friend auto internal::EmitRecord(const internal::Record& record) noexcept -> void;
+
+    /*!
+     * \brief  Sink configuration, changed by Start() and Stop() under control_ while no backend thread runs.
+     */
+    BackendConfig              config_{};
+    int                        fileFd_{-1};
+
+    /*!
+     * \brief  Output batches, used by the draining thread only.
+     */
+    static constexpr std::size_t kBatchSize{8192U};
+    char                       stdoutBatch_[kBatchSize]{};
+    char                       stderrBatch_[kBatchSize]{};
+    char                       fileBatch_[kBatchSize]{};
+    std::size_t                stdoutSize_{0U};
+    std::size_t                stderrSize_{0U};
+    std::size_t                fileSize_{0U};
+    std::uint64_t              reportedDrops_{0U};
+
+    pthread_t                  thread_{};
+    bool                       threadStarted_{false};
+    std::mutex                 control_{};
+    std::atomic<bool>          running_{false};
+    std::atomic<std::uint64_t> flushRequested_{0U};
+    std::atomic<std::uint64_t> flushCompleted_{0U};
+};
+
+} // namespace log
+} // namespace ara
+
+#endif // OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_LOG_LOG_BACKEND_H_
@@ -0,0 +1,169 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project (CXX_STANDARD 17)
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara/log/logger.h
+ *  \brief      Declaration of the ara::log::Logger front end.
+ *
+ *  \details    A Logger is a constexpr value (context name + threshold). Its log calls take a format string with
+ *              "{}" placeholders and the arguments:
+ *
+ *                  constexpr ara::log::Logger kLogger{"demo mngr"};
+ *                  kLogger.LogInfo("Manager cycle: {} ms", running_cycle_ms);
+ *
+ *              While the LogBackend runs, a call only copies the format ID (the address of the format string) and the
+ *              raw arguments into the calling thread's ring buffer: no formatting, no lock, no allocation and no
+ *              system call on the calling thread. Formatting and output happen on the backend thread.
+ *
+ *  \note       The format string and the context must be string literals (or otherwise outlive the LogBackend).
+ *              Based on [SWS_LOG_00007] (Logger::IsEnabled), with a format-string API instead of LogStream.
+ *********************************************************************************************************************/
+
+#ifndef OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_LOG_LOGGER_H_
+#define OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_LOG_LOGGER_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include "ara/log/common.h"
+#include "ara/log/internal/log_record.h"
+
+#include <chrono>        // For std::chrono::steady_clock
+#include <cstdint>       // For std::int64_t
+
+namespace ara {
+namespace log {
+
+/**********************************************************************************************************************
+ *  CLASS: Logger
+ *********************************************************************************************************************/
+/*!
+ * \brief  Logging front end of one context.
+ *
+ * \details
+ * - A message is emitted if its level is enabled by both the Logger threshold and the LogBackend threshold.
+ * - kFatal messages are always written synchronously on the calling thread (they usually precede termination).
+ * - Before LogBackend::Start() and after LogBackend::Stop() all messages are written synchronously to the console.
+ * - If the ring of the calling thread is full, the message is dropped and counted; the backend reports the count.
+ */
+class Logger final {
+public:
+    /*!
+     * \brief  Creates a Logger for \c context (printed as "[context]") with the threshold \c threshold.
+     */
+    constexpr explicit Logger(const char* context, LogLevel threshold = LogLevel::kVerbose) noexcept
+        : context_{context}, threshold_{threshold}
+    {
+    }
+
+    /*!
+     * \brief  Context name of the Logger.
+     */
+    constexpr auto GetContext() const noexcept -> const char*
+    {
+        return context_;
+    }
+
+    /*!
+     * \brief  Whether a message of \c level would be emitted.
+     *
+     * \note   [SWS_LOG_00007]
+     */
+    auto IsEnabled(LogLevel level) const noexcept -> bool
+    {
+        return (level != LogLevel::kOff) && (level <= threshold_) && (level <= internal::GetThreshold());
+    }
+
+    /*!
+     * \brief  Logs \c format with \c args at \c level.
+     */
+    template <typename... Args>
+    auto Log(LogLevel level, const char* format, const Args&... args) const noexcept -> void
+    {
+        if (!IsEnabled(level)) {
+            return;
+        }
+
+        if ((level == LogLevel::kFatal) || !internal::IsAsynchronous()) {
+            internal::Record record{};
+            Fill(record, level, format, args...);
+            internal::EmitRecord(record);
+            return;
+        }
+
+        internal::Record* const record = internal::AcquireRecord();
+        if (record != nullptr) {
+            Fill(*record, level, format, args...);
+            internal::CommitRecord();
+        }
+    }
+
+    template <typename... Args>
+    auto LogFatal(const char* format, const Args&... args) const noexcept -> void
+    {
+        Log(LogLevel::kFatal, format, args...);
+    }
+
+    template <typename... Args>
+    auto LogError(const char* format, const Args&... args) const noexcept -> void
+    {
+        Log(LogLevel::kError, format, args...);
+    }
+
+    template <typename... Args>
+    auto LogWarn(const char* format, const Args&... args) const noexcept -> void
+    {
+        Log(LogLevel::kWarn, format, args...);
+    }
+
+    template <typename... Args>
+    auto LogInfo(const char* format, const Args&... args) const noexcept -> void
+    {
+        Log(LogLevel::kInfo, format, args...);
+    }
+
+    template <typename... Args>
+    auto LogDebug(const char* format, const Args&... args) const noexcept -> void
+    {
+        Log(LogLevel::kDebug, format, args...);
+    }
+
+    template <typename... Args>
+    auto LogVerbose(const char* format, const Args&... args) const noexcept -> void
+    {
+        Log(LogLevel::kVerbose, format, args...);
+    }
+
+private:
+    /*!
+     * \brief  Writes the header and the encoded arguments into \c record.
+     */
+    template <typename... Args>
+    auto Fill(internal::Record& record, LogLevel level, const char* format, const Args&... args) const noexcept
+        -> void
+    {
+        record.timestamp = static_cast<std::int64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count());
+        record.format  = format;
+        record.context = context_;
+        record.level   = level;
+
+        internal::RecordWriter writer{record};
+        (writer.Put(args), ...);
+        static_cast<void>(writer);
+    }
+
+    const char* context_;
+    LogLevel    threshold_;
+};
+
+} // namespace log
+} // namespace ara
+
+#endif // OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_LOG_LOGGER_H_
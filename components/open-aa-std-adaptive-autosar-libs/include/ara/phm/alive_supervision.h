@@ -0,0 +1,399 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project (CXX_STANDARD 17)
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara/phm/alive_supervision.h
+ *  \brief      Declaration of the ara::phm alive supervision over a shared-memory heartbeat table.
+ *
+ *  \details    A HeartbeatTable in a named shared-memory segment (HeartbeatSegment) holds kCapacity heartbeat slots,
+ *              one per cache line. Each cyclic task registers a SupervisedEntity and reports alive once per cycle:
+ *              the report stores a beat count and the absolute monotonic deadline of the next report (release time
+ *              + period + tolerance) with plain atomic stores, without a system call or a lock.
+ *
+ *              A supervisor process maps the same segment (read-only is enough) and checks all slots with plain
+ *              loads (AliveSupervisor): a slot whose deadline lies in the past is Expired. A task that stalls, hangs
+ *              or crashes is therefore detected once its deadline has passed, i.e., at most one period plus the
+ *              tolerance plus the polling interval of the supervisor after its last report.
+ *
+ *  \note       Modeled after the alive supervision of AUTOSAR Platform Health Management (ara::phm); the API is an
+ *              OpenAA one. No heap allocation happens at any point.
+ *********************************************************************************************************************/
+
+#ifndef OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_PHM_ALIVE_SUPERVISION_H_
+#define OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_PHM_ALIVE_SUPERVISION_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <atomic>        // For std::atomic
+#include <chrono>        // For std::chrono::nanoseconds
+#include <cstddef>       // For std::size_t
+#include <cstdint>       // For fixed-width integer types
+
+#include "ara/core/fixed_string.h"                  // For ara::core::BasicFixedString
+#include "ara/core/span.h"                          // For ara::core::Span
+#include "ara/os/interface/shm/shared_memory.h"     // For ara::os::interface::shm::SharedMemory
+#include "ara/os/interface/shm/seqlock.h"           // For ara::os::interface::shm::kCacheLineSize
+#include "ara/os/interface/timer/deadline_timer.h"  // For ara::os::interface::timer::MonotonicTime
+
+namespace ara {
+namespace phm {
+
+/**********************************************************************************************************************
+ *  TYPE ALIAS: MonotonicTime
+ *********************************************************************************************************************/
+/*!
+ * \brief  Point in time on CLOCK_MONOTONIC, the same in every process (e.g., CycleInfo::release).
+ */
+using MonotonicTime = ara::os::interface::timer::MonotonicTime;
+
+/**********************************************************************************************************************
+ *  ENUM: ErrorCode
+ *********************************************************************************************************************/
+/*!
+ * \brief  Result of the HeartbeatSegment and SupervisedEntity operations.
+ */
+enum class ErrorCode : std::uint8_t {
+    Success = 0,            /*!< Operation completed successfully */
+    InvalidArgument,        /*!< Invalid segment name, empty entity name or a period <= 0 */
+    SegmentNotFound,        /*!< Open(): no heartbeat segment with this name exists */
+    SegmentExists,          /*!< Create(): a segment with this name exists */
+    SegmentFailure,         /*!< Creating, opening or mapping the segment failed (e.g., permissions, already open) */
+    IncompatibleSegment,    /*!< The segment is not an initialized heartbeat table of this version */
+    CapacityExceeded,       /*!< All slots of the table are registered to running processes */
+    ReadOnly                /*!< Registering needs a writable mapping */
+};
+
+/**********************************************************************************************************************
+ *  ENUM: SupervisionStatus
+ *********************************************************************************************************************/
+/*!
+ * \brief  Alive supervision status of one entity, as seen by the supervisor.
+ */
+enum class SupervisionStatus : std::uint8_t {
+    Deactivated = 0,        /*!< The entity deactivated its supervision (e.g., orderly shutdown) */
+    Ok,                     /*!< The deadline of the next report has not passed */
+    Expired                 /*!< The deadline passed without a report: the task stalled, hangs or died */
+};
+
+/**********************************************************************************************************************
+ *  STRUCT: SupervisionConfig
+ *********************************************************************************************************************/
+/*!
+ * \brief  Registration of a SupervisedEntity.
+ *
+ * \details
+ * - name:       Name shown by the supervisor, at most HeartbeatSlot::kNameCapacity characters (cut otherwise). An
+ *               entity registering a name whose previous owner process has exited takes over its slot.
+ * - period:     Expected interval between two reports (the cycle period), > 0.
+ * - tolerance:  Lateness accepted on top of the period (wake-up latency, execution time jitter), >= 0.
+ */
+struct SupervisionConfig {
+    const char*              name{nullptr};
+    std::chrono::nanoseconds period{0};
+    std::chrono::nanoseconds tolerance{0};
+};
+
+namespace internal {
+
+/**********************************************************************************************************************
+ *  STRUCT: HeartbeatSlot
+ *********************************************************************************************************************/
+/*!
+ * \brief  Ownership state of a HeartbeatSlot.
+ */
+enum class SlotState : std::uint32_t {
+    kFree = 0,       /*!< Never registered */
+    kClaimed,        /*!< Being (re-)registered by pid; reclaimable once pid died; not reported by the supervisor */
+    kActive,         /*!< Supervised */
+    kDeactivated     /*!< Deactivated by its owner; reusable */
+};
+
+/*!
+ * \brief  Heartbeat of one entity, alone on its cache line(s) so that reporters never share a line.
+ *
+ * \details All fields are atomics (the name as 64-bit words), so that the supervisor reads them without a data race
+ *          while the owner writes them. The owner is the only writer once the slot is claimed.
+ */
+struct alignas(ara::os::interface::shm::kCacheLineSize) HeartbeatSlot {
+    static constexpr std::size_t kNameWords{3U};
+    static constexpr std::size_t kNameCapacity{kNameWords * sizeof(std::uint64_t)};
+
+    std::atomic<SlotState>     state{SlotState::kFree};
+    std::atomic<std::int32_t>  pid{0};                   /*!< Owner process */
+    std::atomic<std::int64_t>  deadline{0};              /*!< Latest time of the next report (ns) */
+    std::atomic<std::int64_t>  lastReport{0};            /*!< Time of the last report (ns) */
+    std::atomic<std::uint64_t> reports{0U};              /*!< Reports since registered */
+    std::atomic<std::int64_t>  period{0};                /*!< Configured period (ns) */
+    std::atomic<std::uint64_t> name[kNameWords]{};       /*!< Name, zero-padded */
+};
+
+static_assert(sizeof(HeartbeatSlot) == ara::os::interface::shm::kCacheLineSize,
+              "ara::phm: a heartbeat slot must fill exactly one cache line");
+static_assert(std::atomic<std::int64_t>::is_always_lock_free && std::atomic<SlotState>::is_always_lock_free,
+              "ara::phm: the heartbeat atomics must be lock-free to be shared between processes");
+
+} // namespace internal
+
+/**********************************************************************************************************************
+ *  CLASS: HeartbeatTable
+ *********************************************************************************************************************/
+/*!
+ * \brief  The shared table of heartbeat slots (the content of a HeartbeatSegment).
+ *
+ * \details Standard layout and trivially destructible: constructed in place by HeartbeatSegment::Create().
+ */
+class alignas(ara::os::interface::shm::kCacheLineSize) HeartbeatTable final {
+public:
+    /*!
+     * \brief  Number of entities a table supervises.
+     */
+    static constexpr std::size_t kCapacity{64U};
+
+    /*!
+     * \brief  Marks an initialized table ("OAPH") and its layout version.
+     */
+    static constexpr std::uint32_t kMagic{0x4F415048U};
+    static constexpr std::uint32_t kVersion{1U};
+
+    /*!
+     * \brief  Publishes the table after its construction (creator side).
+     */
+    auto Publish() noexcept -> void
+    {
+        version_.store(kVersion, std::memory_order_relaxed);
+        magic_.store(kMagic, std::memory_order_release);
+    }
+
+    /*!
+     * \brief  Whether the creator published a table of this version.
+     */
+    auto IsValid() const noexcept -> bool
+    {
+        return (magic_.load(std::memory_order_acquire) == kMagic) &&
+               (version_.load(std::memory_order_relaxed) == kVersion);
+    }
+
+    auto GetSlot(std::size_t index) noexcept -> internal::HeartbeatSlot& { return slots_[index]; }
+    auto GetSlot(std::size_t index) const noexcept -> const internal::HeartbeatSlot& { return slots_[index]; }
+
+private:
+    std::atomic<std::uint32_t> magic_{0U};
+    std::atomic<std::uint32_t> version_{0U};
+    internal::HeartbeatSlot    slots_[kCapacity]{};
+};
+
+/**********************************************************************************************************************
+ *  CLASS: HeartbeatSegment
+ *********************************************************************************************************************/
+/*!
+ * \brief  Mapping of the named shared-memory segment holding a HeartbeatTable.
+ *
+ * \details
+ * - The supervisor usually creates the segment (and unlinks it on shutdown); the supervised processes open it.
+ *   OpenOrCreate() lets either start first.
+ * - Closing never removes the segment; see Unlink().
+ */
+class HeartbeatSegment final {
+public:
+    /*!
+     * \brief  Name of the segment used when none is given.
+     */
+    static constexpr const char* kDefaultName{"/openaa_phm"};
+
+    HeartbeatSegment() noexcept = default;
+    ~HeartbeatSegment() noexcept = default;
+
+    HeartbeatSegment(const HeartbeatSegment&) = delete;
+    HeartbeatSegment(HeartbeatSegment&&) = delete;
+    auto operator=(const HeartbeatSegment&) -> HeartbeatSegment& = delete;
+    auto operator=(HeartbeatSegment&&) -> HeartbeatSegment& = delete;
+
+    /*!
+     * \brief  Creates the segment \c name (which must not exist) with an empty table, mapped read-write.
+     *
+     * \return ErrorCode::Success, InvalidArgument, SegmentExists or SegmentFailure.
+     */
+    auto Create(const char* name = kDefaultName) noexcept -> ErrorCode;
+
+    /*!
+     * \brief  Opens the existing segment \c name (\c writable: to register entities, else to supervise only).
+     *
+     * \return ErrorCode::Success, InvalidArgument, SegmentNotFound, SegmentFailure or IncompatibleSegment.
+     */
+    auto Open(const char* name = kDefaultName, bool writable = true) noexcept -> ErrorCode;
+
+    /*!
+     * \brief  Open(name, true), or Create(name) if it does not exist yet.
+     */
+    auto OpenOrCreate(const char* name = kDefaultName) noexcept -> ErrorCode;
+
+    /*!
+     * \brief  Unmaps the segment. Safe to call if none is mapped.
+     */
+    auto Close() noexcept -> void;
+
+    /*!
+     * \brief  Removes the name of segment \c name.
+     *
+     * \return ErrorCode::Success, InvalidArgument, SegmentNotFound or SegmentFailure.
+     */
+    static auto Unlink(const char* name = kDefaultName) noexcept -> ErrorCode;
+
+    /*!
+     * \brief  The table (nullptr if not open or mapped read-only).
+     */
+    auto GetTable() const noexcept -> HeartbeatTable* { return table_; }
+
+    /*!
+     * \brief  The table for supervision (nullptr if not open).
+     */
+    auto GetView() const noexcept -> const HeartbeatTable* { return view_; }
+
+private:
+    /*!
+     * \brief  Constructs and publishes the table of the segment just created.
+     */
+    auto InitializeTable(const char* name) noexcept -> ErrorCode;
+
+    ara::os::interface::shm::SharedMemory memory_{};
+    HeartbeatTable*                       table_{nullptr};
+    const HeartbeatTable*                 view_{nullptr};
+};
+
+/**********************************************************************************************************************
+ *  CLASS: SupervisedEntity
+ *********************************************************************************************************************/
+/*!
+ * \brief  Reporting side of the alive supervision: one slot of a HeartbeatTable, owned by one task.
+ *
+ * \details
+ * - ReportAlive() is called by one thread at a time (the task's own cycle); it is wait-free and inline.
+ * - Deactivate() (also run by the destructor) ends the supervision on an orderly shutdown; a process that dies
+ *   without it is reported Expired.
+ *
+ * \code
+ *   entity.ReportAlive(info.release);   // in the task of a CyclicExecutive rate group
+ * \endcode
+ */
+class SupervisedEntity final {
+public:
+    SupervisedEntity() noexcept = default;
+
+    /*!
+     * \brief  Deactivates the supervision.
+     */
+    ~SupervisedEntity() noexcept { Deactivate(); }
+
+    SupervisedEntity(const SupervisedEntity&) = delete;
+    SupervisedEntity(SupervisedEntity&&) = delete;
+    auto operator=(const SupervisedEntity&) -> SupervisedEntity& = delete;
+    auto operator=(SupervisedEntity&&) -> SupervisedEntity& = delete;
+
+    /*!
+     * \brief  Claims a slot of \c segment for \c config; the first report is due by \c now + period + tolerance.
+     *
+     * \details Takes over the slot of the same name if its owner exited (or deactivated it), else the first free or
+     *          deactivated slot, or a slot left claimed by a process that died while registering. Registering again
+     *          first deactivates the current slot.
+     *
+     * \return ErrorCode::Success, InvalidArgument, IncompatibleSegment (not open), ReadOnly or CapacityExceeded.
+     */
+    auto Register(const HeartbeatSegment& segment, const SupervisionConfig& config, MonotonicTime now) noexcept
+        -> ErrorCode;
+
+    /*!
+     * \brief  Reports alive for the cycle released at \c release: the next report is due by release + period +
+     *         tolerance. Does nothing if not registered.
+     */
+    auto ReportAlive(MonotonicTime release) noexcept -> void
+    {
+        if (slot_ != nullptr) {
+            ++reports_;
+            std::int64_t const time = static_cast<std::int64_t>(release.count());
+            slot_->lastReport.store(time, std::memory_order_relaxed);
+            slot_->reports.store(reports_, std::memory_order_relaxed);
+            slot_->deadline.store(time + budget_, std::memory_order_release);
+        }
+    }
+
+    /*!
+     * \brief  ReportAlive() at the current monotonic time (one clock read, a vDSO call on Linux).
+     */
+    auto ReportAlive() noexcept -> void;
+
+    /*!
+     * \brief  Ends the supervision of the slot. Safe to call if not registered.
+     */
+    auto Deactivate() noexcept -> void;
+
+    /*!
+     * \brief  Whether a slot is registered.
+     */
+    auto IsRegistered() const noexcept -> bool { return slot_ != nullptr; }
+
+private:
+    internal::HeartbeatSlot* slot_{nullptr};
+    std::int64_t             budget_{0};     /*!< period + tolerance (ns) */
+    std::uint64_t            reports_{0U};
+};
+
+/**********************************************************************************************************************
+ *  STRUCT: EntityStatus
+ *********************************************************************************************************************/
+/*!
+ * \brief  Snapshot of one supervised entity, filled by AliveSupervisor::Check().
+ */
+struct EntityStatus {
+    using Name = ara::core::BasicFixedString<internal::HeartbeatSlot::kNameCapacity>;
+
+    std::size_t              slot{0U};                               /*!< Index in the table */
+    Name                     name{};
+    SupervisionStatus        status{SupervisionStatus::Deactivated};
+    std::int32_t             pid{0};                                 /*!< Owner process */
+    std::uint64_t            reports{0U};                            /*!< Reports since registered */
+    std::chrono::nanoseconds period{0};
+    std::chrono::nanoseconds overdue{0};                             /*!< now - deadline if Expired */
+};
+
+/**********************************************************************************************************************
+ *  CLASS: AliveSupervisor
+ *********************************************************************************************************************/
+/*!
+ * \brief  Supervising side: evaluates every slot of a HeartbeatTable with plain loads.
+ *
+ * \details Only reads the table, so it works on a read-only mapping and never disturbs the reporters' cache lines
+ *          beyond sharing them for reading.
+ */
+class AliveSupervisor final {
+public:
+    /*!
+     * \brief  Supervises the table of \c segment (nothing if the segment is not open).
+     */
+    explicit AliveSupervisor(const HeartbeatSegment& segment) noexcept : table_{segment.GetView()} {}
+
+    /*!
+     * \brief  Writes the status of the registered entities (in slot order) at time \c now into \c statuses.
+     *
+     * \return The number of registered entities (may exceed statuses.size(); the rest is not written).
+     */
+    auto Check(MonotonicTime now, ara::core::Span<EntityStatus> statuses) const noexcept -> std::size_t;
+
+    /*!
+     * \brief  Number of entities whose deadline passed at time \c now (the fast path of a periodic check).
+     */
+    auto CountExpired(MonotonicTime now) const noexcept -> std::size_t;
+
+private:
+    const HeartbeatTable* table_;
+};
+
+} // namespace phm
+} // namespace ara
+
+#endif // OPEN_AA_ADAPTIVE_AUTOSAR_LIBS_INCLUDE_ARA_PHM_ALIVE_SUPERVISION_H_
@@ -0,0 +1,402 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project (CXX_STANDARD 17)
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara/core/executor.cpp
+ *  \brief      Implementation of the work-stealing ara::core::Executor.
+ *
+ *  \details    A worker that finds no task spins kSpinCount searches, then announces itself in \c sleeping_ and waits
+ *              on the semaphore. Push() publishes the task before it reads \c sleeping_ and the worker announces
+ *              itself before its last search (both separated by sequentially consistent fences), so a task pushed
+ *              while a worker goes to sleep is either found by that worker or wakes it.
+ *********************************************************************************************************************/
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include "ara/core/executor.h"
+
+#include <cerrno>        // For errno, EINTR
+#include <cstdio>        // For std::snprintf
+#include <thread>        // For std::this_thread::yield
+
+namespace ara {
+namespace core {
+
+namespace {
+
+/**********************************************************************************************************************
+ *  SECTION: File-local state
+ *********************************************************************************************************************/
+/*!
+ * \brief  The executor and worker index of the calling thread (trivially destructible).
+ */
+struct WorkerIdentity {
+    const Executor* owner{nullptr};
+    std::size_t     index{0U};
+};
+
+thread_local WorkerIdentity tWorker{};
+
+/**********************************************************************************************************************
+ *  SECTION: File-local helpers
+ *********************************************************************************************************************/
+/*!
+ * \brief  Spin-wait hint to the CPU (releases pipeline resources to the sibling hyperthread).
+ */
+inline auto CpuRelax() noexcept -> void
+{
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__)
+    asm volatile("yield" ::: "memory");
+#endif
+}
+
+/*!
+ * \brief  Maps the result of starting a worker thread onto an ExecutorErrorCode.
+ */
+inline auto ToExecutorErrorCode(ara::os::interface::thread::ErrorCode error) noexcept -> ExecutorErrorCode
+{
+    return (error == ara::os::interface::thread::ErrorCode::InvalidArgument) ? ExecutorErrorCode::InvalidArgument
+                                                                             : ExecutorErrorCode::ThreadCreationFailed;
+}
+
+} // namespace
+
+/**********************************************************************************************************************
+ *  FUNCTION: Executor::Executor / ~Executor / Instance
+ *********************************************************************************************************************/
+Executor::Executor() noexcept
+{
+    static_cast<void>(::sem_init(&wake_, 0, 0U));
+}
+
+Executor::~Executor() noexcept
+{
+    Stop();
+    static_cast<void>(::sem_destroy(&wake_));
+}
+
+auto Executor::Instance() noexcept -> Executor&
+{
+    static Executor instance{};
+    return instance;
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: Executor::Start
+ *********************************************************************************************************************/
+auto Executor::Start(const ExecutorConfig& config) noexcept -> ExecutorErrorCode
+{
+    using ara::os::interface::thread::CpuSet;
+    using ara::os::interface::thread::Thread;
+    using ara::os::interface::thread::ThreadConfig;
+
+    std::lock_guard<std::mutex> lock{control_};
+    if (running_.load(std::memory_order_acquire)) {
+        return ExecutorErrorCode::AlreadyRunning;
+    }
+
+    CpuSet cpus = config.cpus;
+    if ((cpus.Count() == 0U) &&
+        (Thread::GetCurrentAffinity(cpus) != ara::os::interface::thread::ErrorCode::Success)) {
+        return ExecutorErrorCode::ThreadCreationFailed;
+    }
+    std::size_t cpuList[CpuSet::kMaxCpus]{};
+    std::size_t cpuCount{0U};
+    for (std::size_t cpu = 0U; cpu < CpuSet::kMaxCpus; ++cpu) {
+        if (cpus.Contains(cpu)) {
+            cpuList[cpuCount++] = cpu;
+        }
+    }
+    if (cpuCount == 0U) {
+        return ExecutorErrorCode::InvalidArgument;
+    }
+
+    std::size_t count = config.workerCount;
+    if (count == 0U) {
+        count = (cpuCount > 1U) ? (cpuCount - 1U) : 1U;
+        count = (count > kMaxWorkers) ? kMaxWorkers : count;
+    } else if (count > kMaxWorkers) {
+        return ExecutorErrorCode::InvalidArgument;
+    }
+
+    // Wake-ups left over from the previous run
+    while (::sem_trywait(&wake_) == 0) {
+    }
+    workerCount_ = count;
+    stopping_.store(false, std::memory_order_seq_cst);
+
+    for (std::size_t i = 0U; i < count; ++i) {
+        Worker& worker = workers_[i];
+        worker.owner = this;
+        worker.index = i;
+        // i < kMaxWorkers: the modulo only bounds the digits for the compiler, the name fits the 16 bytes
+        static_cast<void>(std::snprintf(worker.name, sizeof(worker.name), "ara_worker_%u",
+                                        static_cast<unsigned>(i % 100U)));
+
+        ThreadConfig threadConfig{};
+        threadConfig.name          = worker.name;
+        threadConfig.entry         = &Executor::WorkerEntry;
+        threadConfig.context       = &worker;
+        threadConfig.policy        = config.policy;
+        threadConfig.priority      = config.priority;
+        threadConfig.stackSize     = config.stackSize;
+        threadConfig.stackPrefault = config.stackPrefault;
+        if (config.pinWorkers) {
+            static_cast<void>(threadConfig.affinity.Add(cpuList[(i + 1U) % cpuCount]));
+        } else {
+            threadConfig.affinity = cpus;
+        }
+
+        ara::os::interface::thread::ErrorCode const started = worker.thread.Start(threadConfig);
+        if (started != ara::os::interface::thread::ErrorCode::Success) {
+            JoinWorkers(i);
+            workerCount_ = 0U;
+            return ToExecutorErrorCode(started);
+        }
+    }
+
+    running_.store(true, std::memory_order_release);
+    return ExecutorErrorCode::Success;
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: Executor::Stop
+ *********************************************************************************************************************/
+auto Executor::Stop() noexcept -> void
+{
+    std::lock_guard<std::mutex> lock{control_};
+    if (!running_.exchange(false, std::memory_order_seq_cst)) {
+        return;
+    }
+    // A Submit() that saw the executor running has queued its task before the workers are told to stop
+    while (submitting_.load(std::memory_order_seq_cst) != 0U) {
+        std::this_thread::yield();
+    }
+    JoinWorkers(workerCount_);
+    workerCount_ = 0U;
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: Executor::IsRunning / GetWorkerCount / GetCurrentWorkerIndex / GetDefaultGrain
+ *********************************************************************************************************************/
+auto Executor::IsRunning() const noexcept -> bool
+{
+    return running_.load(std::memory_order_acquire);
+}
+
+auto Executor::GetWorkerCount() const noexcept -> std::size_t
+{
+    return IsRunning() ? workerCount_ : 0U;
+}
+
+auto Executor::GetCurrentWorkerIndex() const noexcept -> std::size_t
+{
+    return (tWorker.owner == this) ? tWorker.index : kMaxWorkers;
+}
+
+auto Executor::GetDefaultGrain(std::size_t count) const noexcept -> std::size_t
+{
+    std::size_t const tasks = 8U * (GetWorkerCount() + 1U);
+    std::size_t const grain = count / tasks;
+    return (grain > 0U) ? grain : 1U;
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: Executor::ParallelFor
+ *********************************************************************************************************************/
+/*!
+ * \brief  The completion counter lives on the caller's stack: tasks decrement it by the size of their range after
+ *         running it, and the caller returns only once it reached zero.
+ */
+auto Executor::ParallelFor(std::size_t count, std::size_t grain, TaskFunction function, void* context) noexcept
+    -> void
+{
+    if ((count == 0U) || (function == nullptr)) {
+        return;
+    }
+    std::size_t const taskGrain = (grain == 0U) ? GetDefaultGrain(count) : grain;
+    if (!IsRunning() || (count <= taskGrain)) {
+        function(context, 0U, count);
+        return;
+    }
+
+    std::atomic<std::size_t> remaining{count};
+    std::size_t const self = GetCurrentWorkerIndex();
+    Execute(internal::Task{function, context, 0U, count, taskGrain, &remaining}, self);
+
+    internal::Task task{};
+    while (remaining.load(std::memory_order_acquire) != 0U) {
+        if (FindTask(self, task)) {
+            Execute(task, self);
+        } else {
+            CpuRelax();
+        }
+    }
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: Executor::Submit
+ *********************************************************************************************************************/
+auto Executor::Submit(TaskFunction function, void* context) noexcept -> bool
+{
+    if (function == nullptr) {
+        return false;
+    }
+
+    // Announced before the running check, so that Stop() either is seen here or waits for the push
+    static_cast<void>(submitting_.fetch_add(1U, std::memory_order_seq_cst));
+    bool const pushed = running_.load(std::memory_order_seq_cst) &&
+                        Push(internal::Task{function, context, 0U, 1U, 1U, nullptr}, GetCurrentWorkerIndex());
+    static_cast<void>(submitting_.fetch_sub(1U, std::memory_order_release));
+    return pushed;
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: Executor::WorkerEntry / RunWorker
+ *********************************************************************************************************************/
+auto Executor::WorkerEntry(void* context) noexcept -> void
+{
+    Worker& worker = *static_cast<Worker*>(context);
+    worker.owner->RunWorker(worker);
+}
+
+auto Executor::RunWorker(Worker& worker) noexcept -> void
+{
+    tWorker = WorkerIdentity{this, worker.index};
+
+    internal::Task task{};
+    std::size_t spins{0U};
+    for (;;) {
+        if (FindTask(worker.index, task)) {
+            Execute(task, worker.index);
+            spins = 0U;
+            continue;
+        }
+        if (stopping_.load(std::memory_order_acquire)) {
+            if (!HasQueuedTask()) {
+                break;
+            }
+            continue;
+        }
+        if (++spins < kSpinCount) {
+            CpuRelax();
+            continue;
+        }
+
+        // Announce the sleep before the last search, so that a concurrent Push() either is seen here or wakes us
+        spins = 0U;
+        static_cast<void>(sleeping_.fetch_add(1U, std::memory_order_seq_cst));
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (!HasQueuedTask() && !stopping_.load(std::memory_order_seq_cst)) {
+            while ((::sem_wait(&wake_) != 0) && (errno == EINTR)) {
+            }
+        }
+        static_cast<void>(sleeping_.fetch_sub(1U, std::memory_order_relaxed));
+    }
+
+    tWorker = WorkerIdentity{};
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: Executor::Push
+ *********************************************************************************************************************/
+auto Executor::Push(const internal::Task& task, std::size_t self) noexcept -> bool
+{
+    bool const pushed = (self < workerCount_) ? workers_[self].deque.Push(task) : submissions_.TryPush(task);
+    if (pushed) {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (sleeping_.load(std::memory_order_relaxed) != 0U) {
+            static_cast<void>(::sem_post(&wake_));
+        }
+    }
+    return pushed;
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: Executor::FindTask
+ *********************************************************************************************************************/
+/*!
+ * \brief  Workers start stealing at their right neighbour, so that thieves spread over the victims.
+ */
+auto Executor::FindTask(std::size_t self, internal::Task& task) noexcept -> bool
+{
+    std::size_t const count = workerCount_;
+    if ((self < count) && workers_[self].deque.Pop(task)) {
+        return true;
+    }
+    if (submissions_.TryPop(task)) {
+        return true;
+    }
+    std::size_t const first = (self < count) ? (self + 1U) : 0U;
+    for (std::size_t offset = 0U; offset < count; ++offset) {
+        std::size_t const victim = (first + offset) % count;
+        if ((victim != self) && workers_[victim].deque.Steal(task)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: Executor::HasQueuedTask
+ *********************************************************************************************************************/
+auto Executor::HasQueuedTask() const noexcept -> bool
+{
+    if (!submissions_.IsEmpty()) {
+        return true;
+    }
+    for (std::size_t i = 0U; i < workerCount_; ++i) {
+        if (!workers_[i].deque.IsEmpty()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: Executor::Execute
+ *********************************************************************************************************************/
+/*!
+ * \brief  A full queue stops the splitting: the rest of the range then runs here in one piece.
+ */
+auto Executor::Execute(internal::Task task, std::size_t self) noexcept -> void
+{
+    while ((task.end - task.begin) > task.grain) {
+        std::size_t const middle = task.begin + ((task.end - task.begin) / 2U);
+        internal::Task upper = task;
+        upper.begin = middle;
+        if (!Push(upper, self)) {
+            break;
+        }
+        task.end = middle;
+    }
+
+    task.function(task.context, task.begin, task.end);
+    if (task.remaining != nullptr) {
+        static_cast<void>(task.remaining->fetch_sub(task.end - task.begin, std::memory_order_acq_rel));
+    }
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: Executor::JoinWorkers
+ *********************************************************************************************************************/
+auto Executor::JoinWorkers(std::size_t count) noexcept -> void
+{
+    stopping_.store(true, std::memory_order_seq_cst);
+    for (std::size_t i = 0U; i < count; ++i) {
+        static_cast<void>(::sem_post(&wake_));
+    }
+    for (std::size_t i = 0U; i < count; ++i) {
+        static_cast<void>(workers_[i].thread.Join());
+    }
+}
+
+} // namespace core
+} // namespace ara
@@ -0,0 +1,433 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project (CXX_STANDARD 17)
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara/core/flight_recorder.cpp
+ *  \brief      Implementation of the ara::core::FlightRecorder rings, dump and crash handlers.
+ *
+ *  \details    The rings are claimed like the ara::log thread rings: a compare-and-swap on the state of a static
+ *              slot, and a pthread key destructor marking the ring of an exiting thread. The dump path only uses
+ *              async-signal-safe calls (clock_gettime, write, lseek, ftruncate, sigaction, raise) and formats into
+ *              stack buffers.
+ *
+ *              Dump layout (text, one record per line, oldest first):
+ *                  [App flr]: Flight recorder dump: <n> threads, ages in ns before the dump
+ *                  [App flr]: thread <tid> (running|exited): <kept> of <written> records
+ *                  [App flr]:   -<age> <tag> <arg0> <arg1>
+ *********************************************************************************************************************/
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include "ara/core/flight_recorder.h"
+#include "ara/core/fixed_string.h"  // For BasicFixedString, ToFixedString
+
+#include <cerrno>        // For errno, EINTR
+#include <csignal>       // For sigaction, raise, SIG*
+#include <string_view>   // For std::string_view
+#include <fcntl.h>       // For open, O_* flags, posix_fallocate
+#include <pthread.h>     // For pthread_key_create, pthread_setspecific, pthread_self
+#include <time.h>        // For clock_gettime, CLOCK_MONOTONIC
+#include <unistd.h>      // For write, lseek, ftruncate, STDERR_FILENO
+
+#if defined(__linux__)
+    #include <sys/syscall.h> // For SYS_gettid
+#endif
+
+namespace ara {
+namespace core {
+
+namespace internal {
+
+namespace {
+
+/**********************************************************************************************************************
+ *  SECTION: Rings
+ *********************************************************************************************************************/
+/*!
+ * \brief  Static storage of all rings.
+ */
+FlightRing gFlightRings[FlightRecorder::kMaxThreads]{};
+
+/*!
+ * \brief  Shared ring of the threads that found no free ring; written concurrently and never dumped.
+ */
+FlightRing gOverflowRing{};
+
+/*!
+ * \brief  Calibration reference: FlightRecorder::Now() and CLOCK_MONOTONIC (ns) taken at the same moment.
+ */
+std::atomic<std::uint64_t> gReferenceTicks{0U};
+std::atomic<std::uint64_t> gReferenceNanoseconds{0U};
+
+/*!
+ * \brief  Dump destination: a preallocated dump file, or STDERR_FILENO.
+ */
+std::atomic<int> gDumpFd{STDERR_FILENO};
+
+/*!
+ * \brief  Set by the first DumpOnce().
+ */
+std::atomic<bool> gDumped{false};
+
+/*!
+ * \brief  Reads CLOCK_MONOTONIC in nanoseconds.
+ */
+auto MonotonicNanoseconds() noexcept -> std::uint64_t
+{
+    struct timespec now{};
+    static_cast<void>(::clock_gettime(CLOCK_MONOTONIC, &now));
+    return (static_cast<std::uint64_t>(now.tv_sec) * 1000000000U) + static_cast<std::uint64_t>(now.tv_nsec);
+}
+
+/*!
+ * \brief  Takes a new calibration reference.
+ */
+auto Calibrate() noexcept -> bool
+{
+    gReferenceTicks.store(FlightRecorder::Now(), std::memory_order_relaxed);
+    gReferenceNanoseconds.store(MonotonicNanoseconds(), std::memory_order_relaxed);
+    return true;
+}
+
+/*!
+ * \brief  Takes the first calibration reference during static initialization, so that any dump has one.
+ */
+[[maybe_unused]] bool const kEagerCalibration = Calibrate();
+
+/*!
+ * \brief  OS thread ID of the calling thread.
+ */
+auto CurrentThreadId() noexcept -> std::uint64_t
+{
+#if defined(__linux__)
+    return static_cast<std::uint64_t>(::syscall(SYS_gettid));
+#else
+    return static_cast<std::uint64_t>(::pthread_self());  // The thread ID on QNX
+#endif
+}
+
+/*!
+ * \brief  pthread key destructor: marks the ring of an exiting thread, which keeps its records for the dump.
+ */
+auto ReleaseFlightRing(void* ring) noexcept -> void
+{
+    static_cast<FlightRing*>(ring)->state.store(FlightRingState::kExited, std::memory_order_release);
+}
+
+/*!
+ * \brief  Returns the pthread key whose destructor releases the ring of an exiting thread.
+ */
+auto FlightRingKey() noexcept -> pthread_key_t
+{
+    static pthread_key_t const key = []() noexcept {
+        pthread_key_t created{};
+        static_cast<void>(pthread_key_create(&created, &ReleaseFlightRing));
+        return created;
+    }();
+    return key;
+}
+
+/*!
+ * \brief  Claims the first ring in state \c from for the calling thread.
+ */
+auto TryClaim(FlightRingState from) noexcept -> FlightRing*
+{
+    for (FlightRing& ring : gFlightRings) {
+        FlightRingState expected{from};
+        if ((ring.state.load(std::memory_order_relaxed) == from) &&
+            ring.state.compare_exchange_strong(expected, FlightRingState::kActive, std::memory_order_acquire,
+                                               std::memory_order_relaxed)) {
+            ring.written.store(0U, std::memory_order_relaxed);
+            ring.threadId.store(CurrentThreadId(), std::memory_order_relaxed);
+            static_cast<void>(pthread_setspecific(FlightRingKey(), &ring));
+            return &ring;
+        }
+    }
+    return nullptr;
+}
+
+/**********************************************************************************************************************
+ *  SECTION: Dump
+ *********************************************************************************************************************/
+/*!
+ * \brief  Prefix of every dump line.
+ */
+constexpr std::string_view kLinePrefix{"[App flr]: "};
+
+/*!
+ * \brief  Batches dump lines in a stack buffer and writes them with write(2), retrying on partial writes and EINTR.
+ */
+class DumpWriter final {
+public:
+    explicit DumpWriter(int fd) noexcept : fd_{fd} {}
+
+    DumpWriter(const DumpWriter&) = delete;
+    auto operator=(const DumpWriter&) -> DumpWriter& = delete;
+
+    ~DumpWriter() noexcept { Flush(); }
+
+    /*!
+     * \brief  Appends one line (the prefix and the newline are added here).
+     */
+    auto Line(std::string_view text) noexcept -> void
+    {
+        if ((buffer_.size() + kLinePrefix.size() + text.size() + 1U) > buffer_.capacity()) {
+            Flush();
+        }
+        buffer_.append(kLinePrefix).append(text).push_back('\n');
+    }
+
+    auto Flush() noexcept -> void
+    {
+        char const* data      = buffer_.data();
+        std::size_t remaining = buffer_.size();
+        while (remaining > 0U) {
+            ssize_t const written = ::write(fd_, data, remaining);
+            if (written < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                break; // Nothing more can be done on the abort path
+            }
+            data      += written;
+            remaining -= static_cast<std::size_t>(written);
+            total_    += static_cast<std::size_t>(written);
+        }
+        buffer_.clear();
+    }
+
+    auto GetTotal() const noexcept -> std::size_t { return total_; }
+
+private:
+    int                     fd_;
+    std::size_t             total_{0U};
+    BasicFixedString<4096U> buffer_{};
+};
+
+/*!
+ * \brief  Appends at most \c limit characters of the null-terminated \c text.
+ */
+template <std::size_t N>
+auto AppendBounded(BasicFixedString<N>& line, const char* text, std::size_t limit) noexcept -> void
+{
+    if (text == nullptr) {
+        line.append("?");
+        return;
+    }
+    std::size_t length{0U};
+    while ((length < limit) && (text[length] != '\0')) {
+        ++length;
+    }
+    line.append(std::string_view(text, length));
+}
+
+} // namespace
+
+/**********************************************************************************************************************
+ *  FUNCTION: ClaimFlightRing
+ *********************************************************************************************************************/
+/*!
+ * \brief  Claims a never used ring, else the ring of an exited thread, else the overflow ring.
+ */
+auto ClaimFlightRing() noexcept -> FlightRing*
+{
+    FlightRing* ring = TryClaim(FlightRingState::kFree);
+    if (ring == nullptr) {
+        ring = TryClaim(FlightRingState::kExited);
+    }
+    if (ring == nullptr) {
+        ring = &gOverflowRing;
+    }
+    tFlightRing = ring;
+    return ring;
+}
+
+} // namespace internal
+
+namespace {
+
+/*!
+ * \brief  Critical signals dumped by the crash handlers.
+ */
+constexpr int kCrashSignals[]{SIGSEGV, SIGBUS, SIGFPE, SIGILL, SIGABRT};
+
+/*!
+ * \brief  Crash handler: dumps once, then re-raises the signal, which now takes its default action (SA_RESETHAND).
+ */
+extern "C" void FlightRecorderCrashHandler(int signo)
+{
+    FlightRecorder::DumpOnce();
+    static_cast<void>(::raise(signo));
+}
+
+} // namespace
+
+/**********************************************************************************************************************
+ *  FUNCTION: FlightRecorder::Configure
+ *********************************************************************************************************************/
+/*!
+ * \brief  Applies \c config (see FlightRecorderConfig), recalibrates the counter and claims the caller's ring.
+ */
+auto FlightRecorder::Configure(const FlightRecorderConfig& config) noexcept -> FlightRecorderErrorCode
+{
+    FlightRecorderErrorCode result{FlightRecorderErrorCode::Success};
+
+    static_cast<void>(internal::Calibrate());
+    if (internal::tFlightRing == nullptr) {
+        static_cast<void>(internal::ClaimFlightRing());
+    }
+
+    if (config.dumpPath != nullptr) {
+        int const fd = ::open(config.dumpPath, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+        bool preallocated = (fd >= 0);
+#if defined(__linux__)
+        preallocated = preallocated && (::posix_fallocate(fd, 0, static_cast<off_t>(kMaxDumpSize)) == 0);
+#endif
+        if (preallocated) {
+            int const previous = internal::gDumpFd.exchange(fd, std::memory_order_acq_rel);
+            if (previous != STDERR_FILENO) {
+                static_cast<void>(::close(previous));
+            }
+        } else {
+            if (fd >= 0) {
+                static_cast<void>(::close(fd));
+            }
+            result = FlightRecorderErrorCode::DumpFileFailed;
+        }
+    }
+
+    if (config.installCrashHandlers) {
+        struct sigaction action{};
+        action.sa_handler = &FlightRecorderCrashHandler;
+        action.sa_flags   = SA_RESETHAND;
+        static_cast<void>(sigemptyset(&action.sa_mask));
+        for (int const signo : kCrashSignals) {
+            if (::sigaction(signo, &action, nullptr) != 0) {
+                result = FlightRecorderErrorCode::SignalHandlerFailed;
+            }
+        }
+    }
+
+    return result;
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: FlightRecorder::Dump
+ *********************************************************************************************************************/
+/*!
+ * \brief  Writes all rings to the configured destination; a dump file is rewritten from its start and cut to size.
+ */
+auto FlightRecorder::Dump() noexcept -> std::size_t
+{
+    int const fd = internal::gDumpFd.load(std::memory_order_acquire);
+    if (fd == STDERR_FILENO) {
+        return DumpTo(fd);
+    }
+
+    static_cast<void>(::lseek(fd, 0, SEEK_SET));
+    std::size_t const records = DumpTo(fd);
+    off_t const end = ::lseek(fd, 0, SEEK_CUR);
+    if ((end >= 0) && (::ftruncate(fd, end) != 0)) {
+        // The dump itself is complete; only the tail of a longer earlier dump is left behind it
+        internal::DumpWriter report{STDERR_FILENO};
+        report.Line("dump file not truncated, records after the last one are stale");
+    }
+    return records;
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: FlightRecorder::DumpTo
+ *********************************************************************************************************************/
+/*!
+ * \brief  Formats every claimed ring, oldest record first, with ages converted from counter ticks to nanoseconds.
+ */
+auto FlightRecorder::DumpTo(int fd) noexcept -> std::size_t
+{
+    using internal::FlightRing;
+    using internal::FlightRingState;
+
+    /* Ticks per nanosecond over the time since the reference */
+    std::uint64_t const nowTicks       = Now();
+    std::uint64_t const nowNanoseconds = internal::MonotonicNanoseconds();
+    std::uint64_t const elapsedTicks   = nowTicks - internal::gReferenceTicks.load(std::memory_order_relaxed);
+    std::uint64_t const elapsedNs      = nowNanoseconds -
+                                         internal::gReferenceNanoseconds.load(std::memory_order_relaxed);
+    double const nsPerTick = ((elapsedTicks > 0U) && (elapsedNs > 0U))
+                                 ? (static_cast<double>(elapsedNs) / static_cast<double>(elapsedTicks))
+                                 : 1.0;
+
+    std::size_t threads{0U};
+    for (const FlightRing& ring : internal::gFlightRings) {
+        threads += (ring.state.load(std::memory_order_acquire) != FlightRingState::kFree) ? 1U : 0U;
+    }
+
+    internal::DumpWriter writer{fd};
+    BasicFixedString<kMaxLineLength> line{};
+    line.append("Flight recorder dump: ").append(ToFixedString(threads))
+        .append(" threads, ages in ns before the dump");
+    writer.Line(line);
+
+    std::size_t records{0U};
+    for (const FlightRing& ring : internal::gFlightRings) {
+        FlightRingState const state = ring.state.load(std::memory_order_acquire);
+        if (state == FlightRingState::kFree) {
+            continue;
+        }
+        std::uint64_t const written = ring.written.load(std::memory_order_acquire);
+        std::uint64_t const kept    = (written < kRecordCapacity) ? written : kRecordCapacity;
+
+        line.clear();
+        line.append("thread ").append(ToFixedString(ring.threadId.load(std::memory_order_relaxed)))
+            .append((state == FlightRingState::kActive) ? " (running): " : " (exited): ")
+            .append(ToFixedString(kept)).append(" of ").append(ToFixedString(written)).append(" records");
+        writer.Line(line);
+
+        for (std::uint64_t index = written - kept; index < written; ++index) {
+            const internal::FlightRecord& record = ring.records[index & (kRecordCapacity - 1U)];
+            std::uint64_t const ticks = record.timestamp.load(std::memory_order_relaxed);
+            std::uint64_t const age   =
+                (nowTicks > ticks) ? static_cast<std::uint64_t>(static_cast<double>(nowTicks - ticks) * nsPerTick) : 0U;
+            line.clear();
+            line.append("  -").append(ToFixedString(age)).append(" ");
+            internal::AppendBounded(line, record.tag.load(std::memory_order_relaxed), kMaxLineLength / 2U);
+            line.append(" ").append(ToFixedString(record.arg0.load(std::memory_order_relaxed)))
+                .append(" ").append(ToFixedString(record.arg1.load(std::memory_order_relaxed)));
+            writer.Line(line);
+            ++records;
+        }
+    }
+
+    return records;
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: FlightRecorder::DumpOnce
+ *********************************************************************************************************************/
+/*!
+ * \brief  Dumps on the first call only.
+ */
+auto FlightRecorder::DumpOnce() noexcept -> void
+{
+    if (!internal::gDumped.exchange(true, std::memory_order_acq_rel)) {
+        static_cast<void>(Dump());
+    }
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: FlightRecorder::GetUnassignedRecords
+ *********************************************************************************************************************/
+/*!
+ * \brief  Records written into the overflow ring (approximate: its writers race on the index).
+ */
+auto FlightRecorder::GetUnassignedRecords() noexcept -> std::uint64_t
+{
+    return internal::gOverflowRing.written.load(std::memory_order_relaxed);
+}
+
+} // namespace core
+} // namespace ara
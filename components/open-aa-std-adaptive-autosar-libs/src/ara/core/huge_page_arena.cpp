@@ -0,0 +1,472 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project (CXX_STANDARD 17)
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara/core/huge_page_arena.cpp
+ *  \brief      Implementation of ara::core::pmr::HugePageArena.
+ *
+ *  \details    The platform part (MapRegion) creates the mapping, places it on the NUMA node and pre-faults it; the
+ *              bump allocation is the same as ArenaResource. Map() runs at startup; allocate() neither calls the
+ *              kernel nor throws.
+ *********************************************************************************************************************/
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include "ara/core/huge_page_arena.h"
+
+#include <cstddef>       // For std::size_t
+#include <cstdint>       // For std::uintptr_t, std::int32_t
+#include <cstdio>        // For std::snprintf
+#include <cstdlib>       // For std::strtoull
+#include <fcntl.h>       // For open, O_RDONLY, O_RDWR
+#include <sys/mman.h>    // For mmap, munmap, madvise, MAP_*, PROT_*
+#include <unistd.h>      // For sysconf, read, close
+
+#if defined(__linux__)
+#include <cerrno>              // For errno, ENOSYS
+#include <linux/mempolicy.h>   // For MPOL_BIND, MPOL_DEFAULT
+#include <sys/syscall.h>       // For SYS_set_mempolicy, SYS_get_mempolicy, SYS_mbind
+#endif
+
+namespace ara {
+namespace core {
+namespace pmr {
+
+namespace {
+
+/**********************************************************************************************************************
+ *  SECTION: File-local helpers
+ *********************************************************************************************************************/
+/*!
+ * \brief  Base page size used when the system cannot report one.
+ */
+constexpr std::size_t kFallbackPageSize{4096U};
+
+/*!
+ * \brief  Region placed by MapRegion().
+ */
+struct Mapping {
+    void*       address{nullptr};   /*!< Start of the region, aligned to the huge page size */
+    std::size_t pageSize{0U};       /*!< Size of the pages backing it */
+    bool        hugePages{false};   /*!< Backed by huge pages of the requested size */
+};
+
+/*!
+ * \brief  Returns the adjustment needed to align \c address to \c alignment (a power of two).
+ */
+inline auto AlignmentPadding(void const* address, std::size_t alignment) noexcept -> std::size_t
+{
+    std::uintptr_t const value = reinterpret_cast<std::uintptr_t>(address);
+    return static_cast<std::size_t>((alignment - (value & (alignment - 1U))) & (alignment - 1U));
+}
+
+/*!
+ * \brief  Rounds \c value up to a multiple of \c alignment (a power of two).
+ */
+constexpr auto RoundUp(std::size_t value, std::size_t alignment) noexcept -> std::size_t
+{
+    return (value + (alignment - 1U)) & ~(alignment - 1U);
+}
+
+/*!
+ * \brief  Returns whether \c value is a non-zero power of two.
+ */
+constexpr auto IsPowerOfTwo(std::size_t value) noexcept -> bool
+{
+    return (value != 0U) && ((value & (value - 1U)) == 0U);
+}
+
+/*!
+ * \brief  Returns the base page size of the system.
+ */
+auto GetBasePageSize() noexcept -> std::size_t
+{
+    long const reported = ::sysconf(_SC_PAGESIZE);
+    return (reported > 0) ? static_cast<std::size_t>(reported) : kFallbackPageSize;
+}
+
+/*!
+ * \brief  Writes one zero byte per \c pageSize bytes of the region, through a volatile pointer.
+ */
+auto TouchPages(void* address, std::size_t bytes, std::size_t pageSize) noexcept -> void
+{
+    volatile char* const base = static_cast<volatile char*>(address);
+    for (std::size_t offset = 0U; offset < bytes; offset += pageSize) {
+        base[offset] = 0;
+    }
+}
+
+/*!
+ * \brief  Maps \c size bytes of anonymous base pages aligned to \c alignment (the unaligned head and tail of a
+ *         larger reservation are unmapped again).
+ *
+ * \return The region, or nullptr.
+ */
+auto MapAlignedBasePages(std::size_t size, std::size_t alignment) noexcept -> void*
+{
+    std::size_t const reserved = size + alignment;
+    void* const reservation = ::mmap(nullptr, reserved, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (reservation == MAP_FAILED) {
+        return nullptr;
+    }
+    char* const base       = static_cast<char*>(reservation);
+    std::size_t const head = AlignmentPadding(base, alignment);
+    std::size_t const tail = reserved - head - size;
+    if (head > 0U) {
+        static_cast<void>(::munmap(base, head));
+    }
+    if (tail > 0U) {
+        static_cast<void>(::munmap(base + head + size, tail));
+    }
+    return base + head;
+}
+
+#if defined(__linux__)
+/**********************************************************************************************************************
+ *  SECTION: Linux
+ *********************************************************************************************************************/
+/*!
+ * \brief  Highest NUMA node (exclusive) a HugePageArena can be bound to.
+ */
+constexpr std::size_t kMaxNumaNodes{1024U};
+
+/*!
+ * \brief  Bits per word of a kernel node mask.
+ */
+constexpr std::size_t kNodeMaskWordBits{8U * sizeof(unsigned long)};
+
+/*!
+ * \brief  Node mask in the layout of set_mempolicy() / mbind().
+ */
+struct NodeMask {
+    unsigned long words[kMaxNumaNodes / kNodeMaskWordBits]{};
+};
+
+/*!
+ * \brief  Node count passed as maxnode (the kernel reads maxnode - 1 bits).
+ */
+constexpr unsigned long kMaxNode{kMaxNumaNodes + 1U};
+
+/*!
+ * \brief  Reads the decimal number in the sysfs file \c path.
+ *
+ * \return \c true if the file exists and holds a number.
+ */
+auto ReadSysfsCount(const char* path, std::size_t& value) noexcept -> bool
+{
+    int const fd = ::open(path, O_RDONLY | O_CLOEXEC);
+    if (fd == -1) {
+        return false;
+    }
+    char text[32]{};
+    ssize_t const length = ::read(fd, text, sizeof(text) - 1U);
+    static_cast<void>(::close(fd));
+    if (length <= 0) {
+        return false;
+    }
+    char* end{nullptr};
+    value = static_cast<std::size_t>(std::strtoull(text, &end, 10));
+    return end != text;
+}
+
+/*!
+ * \brief  Memory policy of the calling thread, bound to one node for the lifetime of the object.
+ *
+ * \details The thread policy places the pages faulted while the region is mapped and pre-faulted (with
+ *          mlockall(MCL_FUTURE), mmap() itself faults them); mbind() places the pages faulted later.
+ */
+class ThreadNodePolicy final {
+public:
+    ThreadNodePolicy() noexcept = default;
+    ThreadNodePolicy(const ThreadNodePolicy&) = delete;
+    auto operator=(const ThreadNodePolicy&) -> ThreadNodePolicy& = delete;
+
+    /*!
+     * \brief  Restores the previous policy of the thread.
+     */
+    ~ThreadNodePolicy()
+    {
+        if (bound_) {
+            NodeMask* const mask = (previousMode_ == MPOL_DEFAULT) ? nullptr : &previousMask_;
+            static_cast<void>(::syscall(SYS_set_mempolicy, previousMode_, mask, kMaxNode));
+        }
+    }
+
+    /*!
+     * \brief  Binds the thread to \c node.
+     *
+     * \return Success, or NodeUnavailable if the node does not exist. Node 0 on a kernel without NUMA support is
+     *         accepted without a binding.
+     */
+    auto Bind(std::int32_t node) noexcept -> HugePageErrorCode
+    {
+        std::size_t const index = static_cast<std::size_t>(node);
+        mask_.words[index / kNodeMaskWordBits] = 1UL << (index % kNodeMaskWordBits);
+        if (::syscall(SYS_get_mempolicy, &previousMode_, &previousMask_, kMaxNode, nullptr, 0UL) != 0) {
+            previousMode_ = MPOL_DEFAULT;
+        }
+        if (::syscall(SYS_set_mempolicy, MPOL_BIND, &mask_, kMaxNode) != 0) {
+            return ((errno == ENOSYS) && (node == 0)) ? HugePageErrorCode::Success
+                                                      : HugePageErrorCode::NodeUnavailable;
+        }
+        bound_ = true;
+        return HugePageErrorCode::Success;
+    }
+
+    /*!
+     * \brief  Binds the region to the node of Bind() (no effect without a binding).
+     */
+    auto BindRegion(void* address, std::size_t size) noexcept -> void
+    {
+        if (bound_) {
+            static_cast<void>(::syscall(SYS_mbind, address, size, MPOL_BIND, &mask_, kMaxNode, 0U));
+        }
+    }
+
+private:
+    NodeMask mask_{};
+    NodeMask previousMask_{};
+    int      previousMode_{MPOL_DEFAULT};
+    bool     bound_{false};
+};
+
+/*!
+ * \brief  Returns whether \c node has at least \c pages free huge pages of \c pageBytes bytes.
+ *
+ * \details Huge pages are reserved from the global pool at mmap(), but faulted from the pool of the bound node; a
+ *          bound node without free pages would raise SIGBUS on the first touch instead of failing the mapping.
+ */
+auto NodeHasFreeHugePages(std::int32_t node, std::size_t pageBytes, std::size_t pages) noexcept -> bool
+{
+    char path[128]{};
+    static_cast<void>(std::snprintf(path, sizeof(path),
+                                    "/sys/devices/system/node/node%d/hugepages/hugepages-%zukB/free_hugepages",
+                                    static_cast<int>(node), pageBytes / 1024U));
+    std::size_t free{0U};
+    return ReadSysfsCount(path, free) && (free >= pages);
+}
+
+/*!
+ * \brief  Returns whether the sysfs directory of \c node exists (true on kernels without NUMA for node 0).
+ */
+auto NodeExists(std::int32_t node) noexcept -> bool
+{
+    char path[64]{};
+    static_cast<void>(std::snprintf(path, sizeof(path), "/sys/devices/system/node/node%d", static_cast<int>(node)));
+    return (::access(path, F_OK) == 0) || ((node == 0) && (::access("/sys/devices/system/node", F_OK) != 0));
+}
+
+/*!
+ * \brief  Linux: MAP_HUGETLB mapping of the configured page size, or 2 MiB aligned base pages advised for
+ *         transparent huge pages; bound to the node and pre-faulted.
+ */
+auto MapRegion(const HugePageArenaConfig& config, std::size_t size, std::size_t hugeBytes, Mapping& mapping) noexcept
+    -> HugePageErrorCode
+{
+    if (config.typedMemory != nullptr) {
+        return HugePageErrorCode::InvalidArgument;
+    }
+
+    ThreadNodePolicy policy{};
+    bool hugePagesOnNode{true};
+    if (config.numaNode != kAnyNumaNode) {
+        if ((config.numaNode < 0) || (static_cast<std::size_t>(config.numaNode) >= kMaxNumaNodes) ||
+            !NodeExists(config.numaNode)) {
+            return HugePageErrorCode::NodeUnavailable;
+        }
+        HugePageErrorCode const bound = policy.Bind(config.numaNode);
+        if (bound != HugePageErrorCode::Success) {
+            return bound;
+        }
+        hugePagesOnNode = NodeHasFreeHugePages(config.numaNode, hugeBytes, size / hugeBytes);
+    }
+
+    // MAP_HUGE_SHIFT encodes log2 of the page size in the flags
+    int const sizeBits = (config.pageSize == HugePageSize::Huge1GiB) ? 30 : 21;
+    int const hugeFlags = MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | (sizeBits << MAP_HUGE_SHIFT);
+    void* address = hugePagesOnNode ? ::mmap(nullptr, size, PROT_READ | PROT_WRITE, hugeFlags, -1, 0) : MAP_FAILED;
+    mapping.hugePages = (address != MAP_FAILED);
+    mapping.pageSize  = hugeBytes;
+    if (!mapping.hugePages) {
+        if (!config.allowSmallPages) {
+            return HugePageErrorCode::HugePagesUnavailable;
+        }
+        address = MapAlignedBasePages(size, hugeBytes);
+        if (address == nullptr) {
+            return HugePageErrorCode::ResourceFailure;
+        }
+        // Transparent huge pages fill the aligned 2 MiB ranges where the system allows it
+        static_cast<void>(::madvise(address, size, MADV_HUGEPAGE));
+        mapping.pageSize = GetBasePageSize();
+    }
+
+    policy.BindRegion(address, size);
+    if (config.prefault) {
+        TouchPages(address, size, mapping.pageSize);
+    }
+    mapping.address = address;
+    return HugePageErrorCode::Success;
+}
+
+#elif defined(__QNXNTO__)
+/**********************************************************************************************************************
+ *  SECTION: QNX
+ *********************************************************************************************************************/
+/*!
+ * \brief  QNX: physically contiguous memory (MAP_PHYS), or memory of the typed memory pool, which the kernel maps
+ *         with large pages; base pages as fallback. The memory (and its node) is selected by the typed memory name.
+ */
+auto MapRegion(const HugePageArenaConfig& config, std::size_t size, std::size_t hugeBytes, Mapping& mapping) noexcept
+    -> HugePageErrorCode
+{
+    if (config.numaNode != kAnyNumaNode) {
+        return HugePageErrorCode::InvalidArgument;
+    }
+
+    void* address{MAP_FAILED};
+    if (config.typedMemory != nullptr) {
+        int const pool = ::posix_typed_mem_open(config.typedMemory, O_RDWR, POSIX_TYPED_MEM_ALLOCATE_CONTIG);
+        if (pool == -1) {
+            return HugePageErrorCode::InvalidArgument;
+        }
+        address = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, pool, 0);
+        static_cast<void>(::close(pool));
+    } else {
+        address = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANON | MAP_PHYS, NOFD, 0);
+    }
+    mapping.hugePages = (address != MAP_FAILED);
+    mapping.pageSize  = hugeBytes;
+    if (!mapping.hugePages) {
+        if (!config.allowSmallPages) {
+            return HugePageErrorCode::HugePagesUnavailable;
+        }
+        address = MapAlignedBasePages(size, hugeBytes);
+        if (address == nullptr) {
+            return HugePageErrorCode::ResourceFailure;
+        }
+        mapping.pageSize = GetBasePageSize();
+    }
+
+    if (config.prefault) {
+        TouchPages(address, size, mapping.pageSize);
+    }
+    mapping.address = address;
+    return HugePageErrorCode::Success;
+}
+
+#else
+/*!
+ * \brief  Other platforms: base pages only.
+ */
+auto MapRegion(const HugePageArenaConfig& config, std::size_t size, std::size_t hugeBytes, Mapping& mapping) noexcept
+    -> HugePageErrorCode
+{
+    if ((config.numaNode != kAnyNumaNode) || (config.typedMemory != nullptr)) {
+        return HugePageErrorCode::InvalidArgument;
+    }
+    if (!config.allowSmallPages) {
+        return HugePageErrorCode::HugePagesUnavailable;
+    }
+    void* const address = MapAlignedBasePages(size, hugeBytes);
+    if (address == nullptr) {
+        return HugePageErrorCode::ResourceFailure;
+    }
+    mapping.pageSize = GetBasePageSize();
+    if (config.prefault) {
+        TouchPages(address, size, mapping.pageSize);
+    }
+    mapping.address = address;
+    return HugePageErrorCode::Success;
+}
+#endif
+
+} // namespace
+
+/**********************************************************************************************************************
+ *  CLASS: HugePageArena
+ *********************************************************************************************************************/
+HugePageArena::~HugePageArena()
+{
+    Unmap();
+}
+
+auto HugePageArena::Map() noexcept -> HugePageErrorCode
+{
+    if (buffer_ != nullptr) {
+        return HugePageErrorCode::AlreadyMapped;
+    }
+
+    std::size_t const hugeBytes = GetHugePageBytes(config_.pageSize);
+    // The fallback reserves one extra huge page for the alignment
+    if ((config_.capacity == 0U) || (config_.capacity > (~std::size_t{0U} - (2U * hugeBytes)))) {
+        return HugePageErrorCode::InvalidArgument;
+    }
+    std::size_t const size = RoundUp(config_.capacity, hugeBytes);
+
+    Mapping mapping{};
+    HugePageErrorCode const result = MapRegion(config_, size, hugeBytes, mapping);
+    if (result != HugePageErrorCode::Success) {
+        return result;
+    }
+
+    buffer_        = static_cast<char*>(mapping.address);
+    capacity_      = size;
+    used_          = 0U;
+    highWaterMark_ = 0U;
+    pageSize_      = mapping.pageSize;
+    hugePages_     = mapping.hugePages;
+    return HugePageErrorCode::Success;
+}
+
+auto HugePageArena::Unmap() noexcept -> void
+{
+    if (buffer_ == nullptr) {
+        return;
+    }
+    static_cast<void>(::munmap(buffer_, capacity_));
+    buffer_        = nullptr;
+    capacity_      = 0U;
+    used_          = 0U;
+    highWaterMark_ = 0U;
+    pageSize_      = 0U;
+    hugePages_     = false;
+}
+
+auto HugePageArena::do_allocate(std::size_t bytes, std::size_t alignment) noexcept -> void*
+{
+    if ((buffer_ == nullptr) || !IsPowerOfTwo(alignment)) {
+        return nullptr;
+    }
+
+    std::size_t const remaining = capacity_ - used_;
+    std::size_t const padding   = AlignmentPadding(buffer_ + used_, alignment);
+    if ((padding > remaining) || (bytes > (remaining - padding))) {
+        return nullptr;
+    }
+
+    char* const result = buffer_ + used_ + padding;
+    used_ += padding + bytes;
+    if (used_ > highWaterMark_) {
+        highWaterMark_ = used_;
+    }
+    return result;
+}
+
+auto HugePageArena::do_deallocate(void* /*p*/, std::size_t /*bytes*/, std::size_t /*alignment*/) noexcept -> void
+{
+    // Arena: memory is only reclaimed by reset() or Unmap()
+}
+
+auto HugePageArena::do_is_equal(const MemoryResource& other) const noexcept -> bool
+{
+    return this == &other;
+}
+
+} // namespace pmr
+} // namespace core
+} // namespace ara
@@ -0,0 +1,318 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project (CXX_STANDARD 17)
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara/core/initialization.cpp
+ *  \brief      Implementation of ara::core::Initialize() and ara::core::Deinitialize().
+ *
+ *  \details    Each phase is timed with the steady clock; the report is kept in static storage and logged once at
+ *              the end of Initialize(). No function in this file allocates.
+ *********************************************************************************************************************/
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include "ara/core/initialization.h"
+
+#include <atomic>        // For std::atomic
+#include <chrono>        // For std::chrono::steady_clock
+#include <cstddef>       // For std::size_t
+#include <cstdint>       // For std::int64_t
+#include <limits.h>      // For PTHREAD_STACK_MIN
+#include <pthread.h>     // For pthread_attr_t, pthread_[gs]etattr_default_np
+#include <sys/mman.h>    // For mlockall, munlockall
+
+#include "ara/core/internal/violation_handler.h"  // For ViolationHandler::Instance
+#include "ara/log/logger.h"                        // For ara::log::Logger
+
+namespace ara {
+namespace core {
+
+namespace {
+
+/**********************************************************************************************************************
+ *  SECTION: File-local state
+ *********************************************************************************************************************/
+/*!
+ * \brief  Logger of the initialization report.
+ */
+constexpr ara::log::Logger kLogger{"ara core"};
+
+/*!
+ * \brief  Size of the stack frame touched per recursion step of PrefaultStack() (one page or more).
+ */
+constexpr std::size_t kStackChunkSize{4096U};
+
+/*!
+ * \brief  Whether Initialize() succeeded and Deinitialize() was not called since.
+ */
+std::atomic<bool> gInitialized{false};
+
+/*!
+ * \brief  Report of the last Initialize(); written only by Initialize().
+ */
+InitializationReport gReport{};
+
+/*!
+ * \brief  State restored by Deinitialize().
+ */
+pmr::MemoryResource* gPreviousDefaultResource{nullptr};
+bool                 gDefaultResourceReplaced{false};
+std::size_t          gPreviousThreadStackSize{0U};
+
+/**********************************************************************************************************************
+ *  SECTION: File-local helpers
+ *********************************************************************************************************************/
+/*!
+ * \brief  Returns the time elapsed since \c start.
+ */
+inline auto ElapsedSince(std::chrono::steady_clock::time_point start) noexcept -> std::chrono::nanoseconds
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+}
+
+/*!
+ * \brief  Converts a phase duration to whole microseconds for the log line.
+ */
+inline auto ToMicroseconds(std::chrono::nanoseconds duration) noexcept -> std::int64_t
+{
+    return static_cast<std::int64_t>(std::chrono::duration_cast<std::chrono::microseconds>(duration).count());
+}
+
+/*!
+ * \brief  Touches one kStackChunkSize frame and recurses until \c remaining bytes of stack have been touched.
+ *
+ * \details The read after the recursive call keeps the frame alive, so the call cannot become a tail call that
+ *          reuses the same stack page.
+ */
+[[gnu::noinline]] auto TouchStack(std::size_t remaining) noexcept -> void
+{
+    volatile char frame[kStackChunkSize];
+    frame[0U] = 0;
+    frame[kStackChunkSize - 1U] = 0;
+    if (remaining > kStackChunkSize) {
+        TouchStack(remaining - kStackChunkSize);
+    }
+    static_cast<void>(frame[0U]);
+}
+
+/*!
+ * \brief  Applies \c stackSize as default stack size of threads created afterwards.
+ *
+ * \return \c true if the platform supports it and the size was accepted.
+ *
+ * \note   glibc only (pthread_setattr_default_np); elsewhere the platform default is kept.
+ */
+auto SetDefaultThreadStackSize(std::size_t stackSize) noexcept -> bool
+{
+#if defined(__GLIBC__)
+    pthread_attr_t attributes{};
+    if (::pthread_getattr_default_np(&attributes) != 0) {
+        return false;
+    }
+
+    // PTHREAD_STACK_MIN is a call to sysconf() (of type long) since glibc 2.34
+    std::size_t const minimum = static_cast<std::size_t>(PTHREAD_STACK_MIN);
+    bool applied{false};
+    std::size_t previous{0U};
+    if ((::pthread_attr_getstacksize(&attributes, &previous) == 0) &&
+        (::pthread_attr_setstacksize(&attributes, (stackSize < minimum) ? minimum : stackSize) == 0) &&
+        (::pthread_setattr_default_np(&attributes) == 0)) {
+        gPreviousThreadStackSize = previous;
+        applied = true;
+    }
+    static_cast<void>(::pthread_attr_destroy(&attributes));
+    return applied;
+#else
+    static_cast<void>(stackSize);
+    return false;
+#endif
+}
+
+} // namespace
+
+/**********************************************************************************************************************
+ *  FUNCTION: PrefaultStack
+ *********************************************************************************************************************/
+auto PrefaultStack(std::size_t bytes) noexcept -> void
+{
+    if (bytes > 0U) {
+        TouchStack(bytes);
+    }
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: Initialize
+ *********************************************************************************************************************/
+/*!
+ * \brief  Runs the phases described in initialization.h and records their durations.
+ *
+ * \note   [SWS_CORE_10001]
+ */
+auto Initialize(const InitConfig& config) noexcept -> InitErrorCode
+{
+    if (gInitialized.load(std::memory_order_acquire)) {
+        return InitErrorCode::AlreadyInitialized;
+    }
+
+    using Clock = std::chrono::steady_clock;
+    InitializationReport report{};
+    Clock::time_point const begin = Clock::now();
+
+    /* 1. Memory lock: first, so that every page touched below stays resident */
+    Clock::time_point start = Clock::now();
+    if (config.lockMemory) {
+        report.memoryLocked = (::mlockall(MCL_CURRENT | MCL_FUTURE) == 0);
+        if (!report.memoryLocked && config.requireMemoryLock) {
+            return InitErrorCode::MemoryLockFailed;
+        }
+    }
+    report.memoryLock = ElapsedSince(start);
+
+    /* 2. Stacks: bound the stacks of future threads, then touch the stack of the calling thread */
+    start = Clock::now();
+    if (config.threadStackSize > 0U) {
+        report.threadStackSizeSet = SetDefaultThreadStackSize(config.threadStackSize);
+    }
+    PrefaultStack(config.stackPrefault);
+    report.stacks = ElapsedSince(start);
+
+    /* 3. Singletons: construct them here instead of on the first use on a live path */
+    start = Clock::now();
+    static_cast<void>(ara::core::internal::ViolationHandler::Instance());
+    static_cast<void>(ara::log::LogBackend::Instance());
+    static_cast<void>(pmr::NewDeleteResource());
+    static_cast<void>(pmr::NullMemoryResource());
+    bool flightRecorderFailed{false};
+    if (config.flightRecorder != nullptr) {
+        report.flightRecorderConfigured =
+            (FlightRecorder::Configure(*config.flightRecorder) == FlightRecorderErrorCode::Success);
+        flightRecorderFailed = !report.flightRecorderConfigured;
+    }
+    report.singletons = ElapsedSince(start);
+
+    /* 4. Memory resources */
+    start = Clock::now();
+    gDefaultResourceReplaced = (config.defaultResource != nullptr);
+    if (gDefaultResourceReplaced) {
+        gPreviousDefaultResource = pmr::SetDefaultResource(config.defaultResource);
+    }
+    bool hugePageArenaFailed{false};
+    for (pmr::HugePageArena* const arena : config.hugePageArenas) {
+        if ((arena == nullptr) || arena->IsMapped()) {
+            continue;
+        }
+        if (arena->Map() != pmr::HugePageErrorCode::Success) {
+            hugePageArenaFailed = true;
+            continue;
+        }
+        ++report.hugePageArenasMapped;
+        report.hugePageArenasOnBasePages += arena->IsHugePageBacked() ? 0U : 1U;
+    }
+    for (pmr::ArenaResource* const arena : config.arenas) {
+        if (arena != nullptr) {
+            arena->prefault();
+        }
+    }
+    report.memoryResources = ElapsedSince(start);
+
+    /* 5. Log backend */
+    start = Clock::now();
+    bool logBackendFailed{false};
+    if (config.logBackend != nullptr) {
+        ara::log::ErrorCode const result = ara::log::LogBackend::Instance().Start(*config.logBackend);
+        report.logBackendStarted = (result == ara::log::ErrorCode::Success);
+        logBackendFailed = !report.logBackendStarted && (result != ara::log::ErrorCode::AlreadyRunning);
+    }
+    report.logBackend = ElapsedSince(start);
+
+    /* 6. Executor: last, so that the workers inherit the memory lock and the default stack size */
+    start = Clock::now();
+    bool executorFailed{false};
+    if (config.executor != nullptr) {
+        ExecutorErrorCode const result = Executor::Instance().Start(*config.executor);
+        report.executorStarted = (result == ExecutorErrorCode::Success);
+        executorFailed = !report.executorStarted && (result != ExecutorErrorCode::AlreadyRunning);
+    }
+    report.executor = ElapsedSince(start);
+
+    report.total = ElapsedSince(begin);
+    gReport = report;
+    gInitialized.store(true, std::memory_order_release);
+
+    kLogger.LogInfo("Initialize: memory lock {} us (locked: {}), stacks {} us, singletons {} us, "
+                    "memory resources {} us, log backend {} us, executor {} us ({} workers), total {} us",
+                    ToMicroseconds(report.memoryLock), report.memoryLocked, ToMicroseconds(report.stacks),
+                    ToMicroseconds(report.singletons), ToMicroseconds(report.memoryResources),
+                    ToMicroseconds(report.logBackend), ToMicroseconds(report.executor),
+                    Executor::Instance().GetWorkerCount(), ToMicroseconds(report.total));
+    if (config.lockMemory && !report.memoryLocked) {
+        kLogger.LogWarn("Initialize: mlockall failed, pages may be faulted on the live path.");
+    }
+    if (hugePageArenaFailed || (report.hugePageArenasOnBasePages > 0U)) {
+        kLogger.LogWarn("Initialize: {} huge-page arenas mapped, {} of them on base pages, failed: {}",
+                        report.hugePageArenasMapped, report.hugePageArenasOnBasePages, hugePageArenaFailed);
+    }
+
+    if (executorFailed) {
+        return InitErrorCode::ExecutorFailed;
+    }
+    if (logBackendFailed) {
+        return InitErrorCode::LogBackendFailed;
+    }
+    if (flightRecorderFailed) {
+        return InitErrorCode::FlightRecorderFailed;
+    }
+    return hugePageArenaFailed ? InitErrorCode::HugePageArenaFailed : InitErrorCode::Success;
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: Deinitialize
+ *********************************************************************************************************************/
+/*!
+ * \brief  Stops what Initialize() started and restores the state it replaced.
+ *
+ * \note   [SWS_CORE_10002]
+ */
+auto Deinitialize() noexcept -> InitErrorCode
+{
+    if (!gInitialized.exchange(false, std::memory_order_acq_rel)) {
+        return InitErrorCode::NotInitialized;
+    }
+
+    if (gReport.executorStarted) {
+        Executor::Instance().Stop();
+    }
+    if (gReport.logBackendStarted) {
+        ara::log::LogBackend::Instance().Stop();
+    }
+    if (gDefaultResourceReplaced) {
+        static_cast<void>(pmr::SetDefaultResource(gPreviousDefaultResource));
+        gDefaultResourceReplaced = false;
+    }
+#if defined(__GLIBC__)
+    if (gReport.threadStackSizeSet) {
+        static_cast<void>(SetDefaultThreadStackSize(gPreviousThreadStackSize));
+    }
+#endif
+    if (gReport.memoryLocked) {
+        static_cast<void>(::munlockall());
+    }
+
+    return InitErrorCode::Success;
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: GetInitializationReport
+ *********************************************************************************************************************/
+auto GetInitializationReport() noexcept -> const InitializationReport&
+{
+    return gReport;
+}
+
+} // namespace core
+} // namespace ara
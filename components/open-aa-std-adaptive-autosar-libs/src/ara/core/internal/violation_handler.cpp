@@ -26,21 +26,74 @@
  *  INCLUDES
  *********************************************************************************************************************/
 #include <cstddef>       // For std::size_t
-#include <string>        // For std::string
-#include <iostream>      // For std::cerr
+#include <cstdint>       // For std::uint32_t
 #include <cstdlib>       // For std::terminate
-#include <cstring>       // For std::strncpy
+#include <cstring>       // For std::memcpy
+#include <cerrno>        // For errno, EINTR
+#include <unistd.h>      // For write, STDERR_FILENO
 
 // Include OS Abstraction Layer headers for ProcessInteraction
-#include "ara/os/interface/process/process_factory.h"       // For ProcessFactory
+#include "ara/os/interface/process/process_factory.h"       // For PlatformProcessAccess
+#include "ara/os/interface/process/process_stats.h"         // For the near-miss counters
+#include "ara/os/interface/trace/trace.h"                   // For PlatformTraceAccess
 
 #include <string_view>                                      // Required for std::string_view
 #include "ara/core/internal/violation_handler.h"
+#include "ara/core/fixed_string.h"                          // For BasicFixedString, ToFixedString
+#include "ara/core/flight_recorder.h"                       // For FlightRecorder
 
 namespace ara {
 namespace core {
 namespace internal {
 
+namespace {
+
+/*!
+ * \brief  Forces construction of the ViolationHandler singleton during static initialization.
+ *
+ * \details
+ * Resolves the process identifier at startup instead of on the first violation.
+ */
+auto const& kEagerViolationHandler = ViolationHandler::Instance();
+
+/*!
+ * \brief  Fires the violation probe and records the violation in the flight recorder, so that both the tracer and the
+ *         dump show it next to the last cycles before the abort.
+ */
+auto RecordViolation(ViolationKind kind) noexcept -> void
+{
+    ara::os::interface::trace::PlatformTraceAccess::Violation(static_cast<std::uint32_t>(kind));
+    FlightRecorder::Record("ara::core violation", static_cast<std::uint64_t>(kind));
+}
+
+} // namespace
+
+/**********************************************************************************************************************
+ *  FUNCTION: RecordNearMiss
+ *********************************************************************************************************************/
+/*!
+ * \brief  Counts a refused operation in the process-wide near-miss counters of the OS Abstraction Layer.
+ */
+auto RecordNearMiss(ViolationKind kind) noexcept -> void
+{
+    static_assert(static_cast<std::size_t>(ViolationKind::InvalidState) < ara::os::interface::process::kNearMissKinds,
+                  "Every ViolationKind needs a near-miss counter");
+    ara::os::interface::process::RecordNearMiss(static_cast<std::uint8_t>(kind));
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: ViolationHandler::ViolationHandler
+ *********************************************************************************************************************/
+/*!
+ * \brief  Constructs the singleton and caches the process identifier.
+ *
+ * \note   [SWS_CORE_00090]
+ */
+ViolationHandler::ViolationHandler() noexcept
+{
+    ResolveProcessIdentifier();
+}
+
 /**********************************************************************************************************************
  *  FUNCTION: ViolationHandler::Instance
  *********************************************************************************************************************/
@@ -72,7 +125,8 @@ auto ViolationHandler::Instance() noexcept -> ViolationHandler&
  * \param  arraySize    The size of the array.
  *
  * \details
- * Constructs the violation message as per [SWS_CORE_13017], logs it, and terminates the process.
+ * Builds the violation message as per [SWS_CORE_13017] in a stack buffer, writes it with a single write(2)
+ * call, and terminates the process.
  *
  * \note   [SWS_CORE_13017], [SWS_CORE_00090]
  */
@@ -80,15 +134,230 @@ auto ViolationHandler::Instance() noexcept -> ViolationHandler&
                                                               std::size_t indexValue,
                                                               std::size_t arraySize) noexcept -> void
 {
-    std::cerr << "[App vlt][FATAL]: Violation detected in " << GetProcessIdentifier()
-              << " at " << location
-              << ": Array access out of range: Tried to access "
-              << indexValue << " in array of size " << arraySize << ".\n";
+    RecordViolation(ViolationKind::ArrayAccessOutOfRange);
+
+    BasicFixedString<kViolationMessageCapacity> message{};
+
+    message.append("[App vlt][FATAL]: Violation detected in ").append(GetProcessIdentifier())
+           .append(" at ").append(location)
+           .append(": Array access out of range: Tried to access ")
+           .append(ToFixedString(indexValue)).append(" in array of size ")
+           .append(ToFixedString(arraySize)).append(".\n");
+
+    WriteToStderr(message.view());
 
     // Terminate the process as per AUTOSAR requirements
     Abort();
 }
 
+/**********************************************************************************************************************
+ *  FUNCTION: ReportArrayAccessOutOfRange
+ *********************************************************************************************************************/
+/*!
+ * \brief  Cold trampoline of ara::core::Array::at(); forwards to the ViolationHandler singleton.
+ *
+ * \note   [SWS_CORE_13017], [SWS_CORE_00090]
+ */
+[[noreturn]] auto ReportArrayAccessOutOfRange(std::string_view location,
+                                              std::size_t indexValue,
+                                              std::size_t arraySize) noexcept -> void
+{
+    ViolationHandler::Instance().TriggerArrayAccessOutOfRangeViolation(location, indexValue, arraySize);
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: ViolationHandler::TriggerVectorAccessOutOfRangeViolation
+ *********************************************************************************************************************/
+/*!
+ * \brief  Triggers a VectorAccessOutOfRangeViolation.
+ *
+ * \note   [SWS_CORE_00090]
+ */
+[[noreturn]] auto ViolationHandler::TriggerVectorAccessOutOfRangeViolation(std::string_view location,
+                                                                           std::size_t indexValue,
+                                                                           std::size_t vectorSize) noexcept -> void
+{
+    RecordViolation(ViolationKind::VectorAccessOutOfRange);
+
+    BasicFixedString<kViolationMessageCapacity> message{};
+
+    message.append("[App vlt][FATAL]: Violation detected in ").append(GetProcessIdentifier())
+           .append(" at ").append(location)
+           .append(": Vector access out of range: Tried to access ")
+           .append(ToFixedString(indexValue)).append(" in vector of size ")
+           .append(ToFixedString(vectorSize)).append(".\n");
+
+    WriteToStderr(message.view());
+    Abort();
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: ViolationHandler::TriggerSpanAccessOutOfRangeViolation
+ *********************************************************************************************************************/
+/*!
+ * \brief  Triggers a SpanAccessOutOfRangeViolation.
+ *
+ * \note   [SWS_CORE_00090]
+ */
+[[noreturn]] auto ViolationHandler::TriggerSpanAccessOutOfRangeViolation(std::string_view location,
+                                                                         std::size_t indexValue,
+                                                                         std::size_t spanSize) noexcept -> void
+{
+    RecordViolation(ViolationKind::SpanAccessOutOfRange);
+
+    BasicFixedString<kViolationMessageCapacity> message{};
+
+    message.append("[App vlt][FATAL]: Violation detected in ").append(GetProcessIdentifier())
+           .append(" at ").append(location)
+           .append(": Span access out of range: Tried to access ")
+           .append(ToFixedString(indexValue)).append(" in span of size ")
+           .append(ToFixedString(spanSize)).append(".\n");
+
+    WriteToStderr(message.view());
+    Abort();
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: ViolationHandler::TriggerSpanExtentMismatchViolation
+ *********************************************************************************************************************/
+/*!
+ * \brief  Triggers a SpanExtentMismatchViolation.
+ *
+ * \note   [SWS_CORE_00090]
+ */
+[[noreturn]] auto ViolationHandler::TriggerSpanExtentMismatchViolation(std::string_view location,
+                                                                       std::size_t count,
+                                                                       std::size_t extent) noexcept -> void
+{
+    RecordViolation(ViolationKind::SpanExtentMismatch);
+
+    BasicFixedString<kViolationMessageCapacity> message{};
+
+    message.append("[App vlt][FATAL]: Violation detected in ").append(GetProcessIdentifier())
+           .append(" at ").append(location)
+           .append(": Span extent mismatch: Tried to view ")
+           .append(ToFixedString(count)).append(" elements as a span of extent ")
+           .append(ToFixedString(extent)).append(".\n");
+
+    WriteToStderr(message.view());
+    Abort();
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: ReportSpanAccessOutOfRange / ReportSpanExtentMismatch
+ *********************************************************************************************************************/
+/*!
+ * \brief  Cold trampolines of ara::core::Span; forward to the ViolationHandler singleton.
+ *
+ * \note   [SWS_CORE_00090]
+ */
+[[noreturn]] auto ReportSpanAccessOutOfRange(std::string_view location,
+                                             std::size_t indexValue,
+                                             std::size_t spanSize) noexcept -> void
+{
+    ViolationHandler::Instance().TriggerSpanAccessOutOfRangeViolation(location, indexValue, spanSize);
+}
+
+[[noreturn]] auto ReportSpanExtentMismatch(std::string_view location,
+                                           std::size_t count,
+                                           std::size_t extent) noexcept -> void
+{
+    ViolationHandler::Instance().TriggerSpanExtentMismatchViolation(location, count, extent);
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: ReportCapacityExceeded / ReportInvalidState
+ *********************************************************************************************************************/
+/*!
+ * \brief  Cold trampolines of the fixed pools and state machines; forward to the ViolationHandler singleton.
+ *
+ * \note   [SWS_CORE_00090]
+ */
+[[noreturn]] auto ReportCapacityExceeded(std::string_view location,
+                                         std::size_t requestedSize,
+                                         std::size_t maximumSize) noexcept -> void
+{
+    ViolationHandler::Instance().TriggerCapacityExceededViolation(location, requestedSize, maximumSize);
+}
+
+[[noreturn]] auto ReportInvalidState(std::string_view location, std::string_view reason) noexcept -> void
+{
+    ViolationHandler::Instance().TriggerInvalidStateViolation(location, reason);
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: ViolationHandler::TriggerCapacityExceededViolation
+ *********************************************************************************************************************/
+/*!
+ * \brief  Triggers a CapacityExceededViolation.
+ *
+ * \note   [SWS_CORE_00090]
+ */
+[[noreturn]] auto ViolationHandler::TriggerCapacityExceededViolation(std::string_view location,
+                                                                     std::size_t requestedSize,
+                                                                     std::size_t maximumSize) noexcept -> void
+{
+    RecordViolation(ViolationKind::CapacityExceeded);
+
+    BasicFixedString<kViolationMessageCapacity> message{};
+
+    message.append("[App vlt][FATAL]: Violation detected in ").append(GetProcessIdentifier())
+           .append(" at ").append(location)
+           .append(": Container capacity exceeded: Requested ")
+           .append(ToFixedString(requestedSize)).append(" elements, maximum is ")
+           .append(ToFixedString(maximumSize)).append(".\n");
+
+    WriteToStderr(message.view());
+    Abort();
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: ViolationHandler::TriggerOutOfMemoryViolation
+ *********************************************************************************************************************/
+/*!
+ * \brief  Triggers an OutOfMemoryViolation.
+ *
+ * \note   [SWS_CORE_00090]
+ */
+[[noreturn]] auto ViolationHandler::TriggerOutOfMemoryViolation(std::string_view location,
+                                                                std::size_t requestedBytes) noexcept -> void
+{
+    RecordViolation(ViolationKind::OutOfMemory);
+
+    BasicFixedString<kViolationMessageCapacity> message{};
+
+    message.append("[App vlt][FATAL]: Violation detected in ").append(GetProcessIdentifier())
+           .append(" at ").append(location)
+           .append(": Memory resource exhausted: Failed to allocate ")
+           .append(ToFixedString(requestedBytes)).append(" bytes.\n");
+
+    WriteToStderr(message.view());
+    Abort();
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: ViolationHandler::TriggerInvalidStateViolation
+ *********************************************************************************************************************/
+/*!
+ * \brief  Triggers an InvalidStateViolation.
+ *
+ * \note   [SWS_CORE_00090]
+ */
+[[noreturn]] auto ViolationHandler::TriggerInvalidStateViolation(std::string_view location,
+                                                                 std::string_view reason) noexcept -> void
+{
+    RecordViolation(ViolationKind::InvalidState);
+
+    BasicFixedString<kViolationMessageCapacity> message{};
+
+    message.append("[App vlt][FATAL]: Violation detected in ").append(GetProcessIdentifier())
+           .append(" at ").append(location)
+           .append(": Invalid state: ").append(reason).append(".\n");
+
+    WriteToStderr(message.view());
+    Abort();
+}
+
 
 /**********************************************************************************************************************
  *  FUNCTION: ViolationHandler::Abort
@@ -97,13 +366,15 @@ auto ViolationHandler::Instance() noexcept -> ViolationHandler&
  * \brief  Handles the termination of the process upon violation detection.
  *
  * \details
- * Logs a fatal error message to std::cerr and calls std::terminate() to abort the process.
+ * Dumps the flight recorder (once, see FlightRecorder::DumpOnce()), writes a fatal error message to stderr and calls
+ * std::terminate() to abort the process.
  *
  * \note   [SWS_CORE_00090]
  */
 [[noreturn]] auto ViolationHandler::Abort() noexcept -> void
 {
-    std::cerr << "FATAL: Process aborted due to a critical violation in ara::core::Array.\n";
+    FlightRecorder::DumpOnce();
+    WriteToStderr("FATAL: Process aborted due to a critical violation in ara::core.\n");
     std::terminate();
 }
 
@@ -113,33 +384,75 @@ auto ViolationHandler::Instance() noexcept -> ViolationHandler&
 /*!
  * \brief  Retrieves the identifier of the current process.
  *
- * \return The process identifier as a std::string.
+ * \return The cached process identifier.
+ *
+ * \note   [SWS_CORE_00090]
+ */
+auto ViolationHandler::GetProcessIdentifier() const noexcept -> std::string_view
+{
+    return std::string_view(process_identifier_, process_identifier_length_);
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: ViolationHandler::ResolveProcessIdentifier
+ *********************************************************************************************************************/
+/*!
+ * \brief  Resolves the process name once and stores it in process_identifier_.
  *
  * \details
- * Interacts with the OS Abstraction Layer to obtain the name of the current process. If the process name
- * cannot be retrieved, defaults to "UnknownProcess" or "UnsupportedPlatform" based on the context.
+ * Interacts with the OS Abstraction Layer (static PlatformProcessAccess backend) to obtain the name of the
+ * current process. If the process name cannot be retrieved, defaults to "UnknownProcess". Unsupported platforms
+ * are rejected at compile time by the OS Abstraction Layer.
  *
  * \note   [SWS_CORE_00090]
  */
-auto ViolationHandler::GetProcessIdentifier() noexcept -> std::string
+auto ViolationHandler::ResolveProcessIdentifier() noexcept -> void
 {
-    constexpr std::size_t process_name_buffer_size = 256;
-    char buf[process_name_buffer_size] = {0};
+    std::string_view fallback{};
 
-    auto processInteraction = ara::os::interface::process::ProcessFactory::CreateInstance();
-    if (processInteraction) {
-        auto error = processInteraction->GetProcessName(buf, process_name_buffer_size);
-        if (error != ara::os::interface::process::ErrorCode::Success) {
-            std::strncpy(buf, "UnknownProcess", process_name_buffer_size - 1);
-        }
-    } else {
-        std::strncpy(buf, "UnsupportedPlatform", process_name_buffer_size - 1);
+    // Static platform backend: no heap allocation and no virtual dispatch
+    auto error = ara::os::interface::process::PlatformProcessAccess::GetProcessName(process_identifier_,
+                                                                                   kProcessIdentifierCapacity);
+    if (error != ara::os::interface::process::ErrorCode::Success) {
+        fallback = "UnknownProcess";
+    }
+
+    if (!fallback.empty()) {
+        std::memcpy(process_identifier_, fallback.data(), fallback.size());
+        process_identifier_[fallback.size()] = '\0';
     }
 
-    return std::string(buf);
+    process_identifier_[kProcessIdentifierCapacity - 1U] = '\0';
+    process_identifier_length_ = std::string_view(process_identifier_).size();
 }
 
+/**********************************************************************************************************************
+ *  FUNCTION: ViolationHandler::WriteToStderr
+ *********************************************************************************************************************/
+/*!
+ * \brief  Writes \c message to STDERR_FILENO, retrying on partial writes and EINTR.
+ *
+ * \param  message  The message to write.
+ *
+ * \note   Async-signal-safe.
+ */
+auto ViolationHandler::WriteToStderr(std::string_view message) noexcept -> void
+{
+    char const* data      = message.data();
+    std::size_t remaining = message.size();
 
+    while (remaining > 0U) {
+        ssize_t const written = ::write(STDERR_FILENO, data, remaining);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return; // Nothing more can be done on the abort path
+        }
+        data      += written;
+        remaining -= static_cast<std::size_t>(written);
+    }
+}
 
 } // namespace internal
 } // namespace core
@@ -0,0 +1,439 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project (CXX_STANDARD 17)
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara/core/memory_resource.cpp
+ *  \brief      Implementation of the ara::core::pmr memory resources.
+ *
+ *  \details    Provides the global resources (new/delete, null, default), page pre-faulting, and the monotonic,
+ *              pool and arena resources. No function in this file throws; exhaustion is reported as nullptr.
+ *********************************************************************************************************************/
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include "ara/core/memory_resource.h"
+
+#include <atomic>        // For std::atomic
+#include <cstddef>       // For std::size_t
+#include <cstdint>       // For std::uintptr_t
+#include <new>           // For ::operator new(std::nothrow), std::align_val_t
+#include <unistd.h>      // For sysconf, _SC_PAGESIZE
+
+namespace ara {
+namespace core {
+namespace pmr {
+
+namespace {
+
+/**********************************************************************************************************************
+ *  SECTION: File-local helpers
+ *********************************************************************************************************************/
+/*!
+ * \brief  Page size used when the system cannot report one.
+ */
+constexpr std::size_t kFallbackPageSize{4096U};
+
+/*!
+ * \brief  Returns the adjustment needed to align \c address to \c alignment (a power of two).
+ */
+inline auto AlignmentPadding(void const* address, std::size_t alignment) noexcept -> std::size_t
+{
+    std::uintptr_t const value = reinterpret_cast<std::uintptr_t>(address);
+    return static_cast<std::size_t>((alignment - (value & (alignment - 1U))) & (alignment - 1U));
+}
+
+/*!
+ * \brief  Rounds \c value up to a multiple of \c alignment (a power of two).
+ */
+constexpr auto RoundUp(std::size_t value, std::size_t alignment) noexcept -> std::size_t
+{
+    return (value + (alignment - 1U)) & ~(alignment - 1U);
+}
+
+/*!
+ * \brief  Returns whether \c value is a non-zero power of two.
+ */
+constexpr auto IsPowerOfTwo(std::size_t value) noexcept -> bool
+{
+    return (value != 0U) && ((value & (value - 1U)) == 0U);
+}
+
+/**********************************************************************************************************************
+ *  CLASS: NewDeleteResourceImpl (file-local)
+ *********************************************************************************************************************/
+/*!
+ * \brief  Forwards to the aligned, non-throwing global operator new/delete.
+ */
+class NewDeleteResourceImpl final : public MemoryResource {
+private:
+    auto do_allocate(std::size_t bytes, std::size_t alignment) noexcept -> void* override
+    {
+        return ::operator new(bytes, std::align_val_t{alignment}, std::nothrow);
+    }
+
+    auto do_deallocate(void* p, std::size_t bytes, std::size_t alignment) noexcept -> void override
+    {
+        ::operator delete(p, bytes, std::align_val_t{alignment});
+    }
+
+    auto do_is_equal(const MemoryResource& other) const noexcept -> bool override
+    {
+        return this == &other;
+    }
+};
+
+/**********************************************************************************************************************
+ *  CLASS: NullMemoryResourceImpl (file-local)
+ *********************************************************************************************************************/
+/*!
+ * \brief  Refuses every allocation.
+ */
+class NullMemoryResourceImpl final : public MemoryResource {
+private:
+    auto do_allocate(std::size_t /*bytes*/, std::size_t /*alignment*/) noexcept -> void* override
+    {
+        return nullptr;
+    }
+
+    auto do_deallocate(void* /*p*/, std::size_t /*bytes*/, std::size_t /*alignment*/) noexcept -> void override
+    {
+    }
+
+    auto do_is_equal(const MemoryResource& other) const noexcept -> bool override
+    {
+        return this == &other;
+    }
+};
+
+/*!
+ * \brief  Singletons of the stateless global resources (constant-initialized, never destroyed before use ends).
+ */
+NewDeleteResourceImpl   gNewDeleteResource;
+NullMemoryResourceImpl  gNullMemoryResource;
+
+/*!
+ * \brief  The process-wide default resource; nullptr means NewDeleteResource().
+ */
+std::atomic<MemoryResource*> gDefaultResource{nullptr};
+
+} // namespace
+
+/**********************************************************************************************************************
+ *  SECTION: Global Resources
+ *********************************************************************************************************************/
+auto NewDeleteResource() noexcept -> MemoryResource*
+{
+    return &gNewDeleteResource;
+}
+
+auto NullMemoryResource() noexcept -> MemoryResource*
+{
+    return &gNullMemoryResource;
+}
+
+auto GetDefaultResource() noexcept -> MemoryResource*
+{
+    MemoryResource* const resource = gDefaultResource.load(std::memory_order_acquire);
+    return (resource != nullptr) ? resource : NewDeleteResource();
+}
+
+auto SetDefaultResource(MemoryResource* resource) noexcept -> MemoryResource*
+{
+    MemoryResource* const previous = gDefaultResource.exchange(resource, std::memory_order_acq_rel);
+    return (previous != nullptr) ? previous : NewDeleteResource();
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: PrefaultMemory
+ *********************************************************************************************************************/
+/*!
+ * \brief  Touches one byte per page of the region, through a volatile pointer so the stores are not elided.
+ */
+auto PrefaultMemory(void* address, std::size_t bytes) noexcept -> void
+{
+    if ((address == nullptr) || (bytes == 0U)) {
+        return;
+    }
+
+    long const reported = ::sysconf(_SC_PAGESIZE);
+    std::size_t const pageSize = (reported > 0) ? static_cast<std::size_t>(reported) : kFallbackPageSize;
+
+    volatile char* const base = static_cast<volatile char*>(address);
+    for (std::size_t offset = 0U; offset < bytes; offset += pageSize) {
+        base[offset] = 0;
+    }
+    base[bytes - 1U] = 0;
+}
+
+/**********************************************************************************************************************
+ *  CLASS: MonotonicBufferResource
+ *********************************************************************************************************************/
+MonotonicBufferResource::MonotonicBufferResource(void* buffer, std::size_t bufferSize,
+                                                 MemoryResource* upstream) noexcept
+    : upstream_{upstream},
+      initialBuffer_{buffer},
+      initialSize_{bufferSize},
+      current_{static_cast<char*>(buffer)},
+      remaining_{bufferSize},
+      nextChunkSize_{(bufferSize > 0U) ? (bufferSize * 2U) : kFallbackPageSize},
+      chunks_{nullptr}
+{
+}
+
+MonotonicBufferResource::MonotonicBufferResource(std::size_t initialSize, MemoryResource* upstream) noexcept
+    : upstream_{upstream},
+      initialBuffer_{nullptr},
+      initialSize_{0U},
+      current_{nullptr},
+      remaining_{0U},
+      nextChunkSize_{(initialSize > 0U) ? initialSize : kFallbackPageSize},
+      chunks_{nullptr}
+{
+}
+
+MonotonicBufferResource::~MonotonicBufferResource()
+{
+    release();
+}
+
+auto MonotonicBufferResource::release() noexcept -> void
+{
+    while (chunks_ != nullptr) {
+        ChunkHeader* const next = chunks_->next;
+        upstream_->deallocate(chunks_, chunks_->size, kMaxAlign);
+        chunks_ = next;
+    }
+
+    current_   = static_cast<char*>(initialBuffer_);
+    remaining_ = initialSize_;
+}
+
+auto MonotonicBufferResource::AllocateFromCurrent(std::size_t bytes, std::size_t alignment) noexcept -> void*
+{
+    if (current_ == nullptr) {
+        return nullptr;
+    }
+
+    std::size_t const padding = AlignmentPadding(current_, alignment);
+    if ((padding > remaining_) || (bytes > (remaining_ - padding))) {
+        return nullptr;
+    }
+
+    char* const result = current_ + padding;
+    current_   = result + bytes;
+    remaining_ -= padding + bytes;
+    return result;
+}
+
+auto MonotonicBufferResource::do_allocate(std::size_t bytes, std::size_t alignment) noexcept -> void*
+{
+    if (!IsPowerOfTwo(alignment)) {
+        return nullptr;
+    }
+
+    void* result = AllocateFromCurrent(bytes, alignment);
+    if (result != nullptr) {
+        return result;
+    }
+
+    // Current buffer exhausted: request a new chunk large enough for header, padding and payload
+    std::size_t const header   = RoundUp(sizeof(ChunkHeader), kMaxAlign);
+    std::size_t const required = header + bytes + alignment;
+    if (required < bytes) {
+        return nullptr; // Overflow
+    }
+
+    std::size_t chunkSize = nextChunkSize_;
+    while (chunkSize < required) {
+        if (chunkSize > (static_cast<std::size_t>(-1) / 2U)) {
+            return nullptr; // Doubling would wrap
+        }
+        chunkSize *= 2U;
+    }
+
+    void* const chunk = allocate_upstream(*upstream_, chunkSize, kMaxAlign);
+    if (chunk == nullptr) {
+        return nullptr;
+    }
+
+    ChunkHeader* const node = static_cast<ChunkHeader*>(chunk);
+    node->next = chunks_;
+    node->size = chunkSize;
+    chunks_    = node;
+
+    current_       = static_cast<char*>(chunk) + header;
+    remaining_     = chunkSize - header;
+    nextChunkSize_ = (chunkSize > (static_cast<std::size_t>(-1) / 2U)) ? chunkSize : (chunkSize * 2U);
+
+    return AllocateFromCurrent(bytes, alignment);
+}
+
+auto MonotonicBufferResource::do_deallocate(void* /*p*/, std::size_t /*bytes*/,
+                                            std::size_t /*alignment*/) noexcept -> void
+{
+    // Monotonic: memory is only reclaimed by release()
+}
+
+auto MonotonicBufferResource::do_is_equal(const MemoryResource& other) const noexcept -> bool
+{
+    return this == &other;
+}
+
+/**********************************************************************************************************************
+ *  CLASS: PoolResource
+ *********************************************************************************************************************/
+PoolResource::PoolResource(std::size_t blockSize, std::size_t blockCount,
+                           MemoryResource* upstream, bool prefault) noexcept
+    : upstream_{upstream},
+      blockSize_{RoundUp((blockSize < sizeof(FreeBlock)) ? sizeof(FreeBlock) : blockSize, kMaxAlign)},
+      blockCount_{0U},
+      freeCount_{0U},
+      chunk_{nullptr},
+      chunkSize_{0U},
+      freeList_{nullptr}
+{
+    if ((blockCount == 0U) || (blockCount > (static_cast<std::size_t>(-1) / blockSize_))) {
+        return;
+    }
+
+    chunkSize_ = blockSize_ * blockCount;
+    chunk_     = allocate_upstream(*upstream_, chunkSize_, kMaxAlign);
+    if (chunk_ == nullptr) {
+        chunkSize_ = 0U;
+        return;
+    }
+
+    if (prefault) {
+        PrefaultMemory(chunk_, chunkSize_);
+    }
+
+    // Thread the free list in address order, so the first allocations are contiguous
+    char* const base = static_cast<char*>(chunk_);
+    for (std::size_t i = blockCount; i > 0U; --i) {
+        FreeBlock* const block = reinterpret_cast<FreeBlock*>(base + ((i - 1U) * blockSize_));
+        block->next = freeList_;
+        freeList_   = block;
+    }
+
+    blockCount_ = blockCount;
+    freeCount_  = blockCount;
+}
+
+PoolResource::~PoolResource()
+{
+    if (chunk_ != nullptr) {
+        upstream_->deallocate(chunk_, chunkSize_, kMaxAlign);
+    }
+}
+
+auto PoolResource::do_allocate(std::size_t bytes, std::size_t alignment) noexcept -> void*
+{
+    if ((bytes > blockSize_) || (alignment > kMaxAlign) || (freeList_ == nullptr)) {
+        return nullptr;
+    }
+
+    FreeBlock* const block = freeList_;
+    freeList_ = block->next;
+    --freeCount_;
+    return block;
+}
+
+auto PoolResource::do_deallocate(void* p, std::size_t /*bytes*/, std::size_t /*alignment*/) noexcept -> void
+{
+    if (p == nullptr) {
+        return;
+    }
+
+    FreeBlock* const block = static_cast<FreeBlock*>(p);
+    block->next = freeList_;
+    freeList_   = block;
+    ++freeCount_;
+}
+
+auto PoolResource::do_is_equal(const MemoryResource& other) const noexcept -> bool
+{
+    return this == &other;
+}
+
+/**********************************************************************************************************************
+ *  CLASS: ArenaResource
+ *********************************************************************************************************************/
+ArenaResource::ArenaResource(std::size_t capacity, MemoryResource* upstream, bool prefault) noexcept
+    : upstream_{upstream},
+      buffer_{nullptr},
+      capacity_{0U},
+      used_{0U},
+      highWaterMark_{0U}
+{
+    if (capacity == 0U) {
+        return;
+    }
+
+    buffer_ = static_cast<char*>(allocate_upstream(*upstream_, capacity, kMaxAlign));
+    if (buffer_ == nullptr) {
+        return;
+    }
+
+    capacity_ = capacity;
+    if (prefault) {
+        this->prefault();
+    }
+}
+
+ArenaResource::ArenaResource(void* buffer, std::size_t capacity, bool prefault) noexcept
+    : upstream_{nullptr},
+      buffer_{static_cast<char*>(buffer)},
+      capacity_{(buffer != nullptr) ? capacity : 0U},
+      used_{0U},
+      highWaterMark_{0U}
+{
+    if (prefault) {
+        this->prefault();
+    }
+}
+
+ArenaResource::~ArenaResource()
+{
+    if ((upstream_ != nullptr) && (buffer_ != nullptr)) {
+        upstream_->deallocate(buffer_, capacity_, kMaxAlign);
+    }
+}
+
+auto ArenaResource::do_allocate(std::size_t bytes, std::size_t alignment) noexcept -> void*
+{
+    if ((buffer_ == nullptr) || !IsPowerOfTwo(alignment)) {
+        return nullptr;
+    }
+
+    std::size_t const remaining = capacity_ - used_;
+    std::size_t const padding   = AlignmentPadding(buffer_ + used_, alignment);
+    if ((padding > remaining) || (bytes > (remaining - padding))) {
+        return nullptr;
+    }
+
+    char* const result = buffer_ + used_ + padding;
+    used_ += padding + bytes;
+    if (used_ > highWaterMark_) {
+        highWaterMark_ = used_;
+    }
+    return result;
+}
+
+auto ArenaResource::do_deallocate(void* /*p*/, std::size_t /*bytes*/, std::size_t /*alignment*/) noexcept -> void
+{
+    // Arena: memory is only reclaimed by reset()
+}
+
+auto ArenaResource::do_is_equal(const MemoryResource& other) const noexcept -> bool
+{
+    return this == &other;
+}
+
+} // namespace pmr
+} // namespace core
+} // namespace ara
@@ -0,0 +1,777 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project (CXX_STANDARD 17)
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara/log/log_backend.cpp
+ *  \brief      Implementation of the ara::log::LogBackend and of the producer hooks.
+ *
+ *  \details    Producer side (any thread): claims one ThreadRing on its first message, then writes Records in place
+ *              and publishes them with a release store of the ring tail. Consumer side (backend thread, or the caller
+ *              of Stop()/Flush() when no backend thread runs): merges the rings by timestamp, formats each Record
+ *              into a line and appends it to the batch of every configured sink.
+ *
+ *              The ring of an exiting thread is marked orphaned by a pthread key destructor and released by the
+ *              consumer once it has been drained.
+ *********************************************************************************************************************/
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include "ara/log/log_backend.h"
+#include "ara/log/internal/log_record.h"
+#include "ara/core/interference_size.h"  // For ara::core::kDestructiveInterferenceSize
+
+#include <atomic>        // For std::atomic
+#include <cerrno>        // For errno, EINTR
+#include <cstddef>       // For std::size_t
+#include <cstdint>       // For fixed-width integer types
+#include <cstdio>        // For std::snprintf
+#include <cstring>       // For std::memcpy, std::strlen
+#include <thread>        // For std::this_thread::sleep_for
+#include <fcntl.h>       // For open, O_* flags
+#include <unistd.h>      // For write, close, STDOUT_FILENO, STDERR_FILENO
+
+#if defined(__QNXNTO__)
+    #include <sys/slog.h>    // For slogf, _SLOG_* severities
+    #include <sys/slogcodes.h>
+#else
+    #include <syslog.h>      // For openlog, syslog, closelog
+#endif
+
+namespace ara {
+namespace log {
+
+namespace {
+
+/**********************************************************************************************************************
+ *  SECTION: Thread rings
+ *********************************************************************************************************************/
+/*!
+ * \brief  Ownership state of a ThreadRing.
+ */
+enum class RingState : std::uint8_t {
+    kFree = 0,   /*!< Available for the next thread that logs */
+    kActive,     /*!< Owned by a running thread */
+    kOrphaned    /*!< The owner exited; released by the consumer once drained */
+};
+
+static_assert((LogBackend::kRingCapacity & (LogBackend::kRingCapacity - 1U)) == 0U,
+              "kRingCapacity must be a power of two");
+
+/*!
+ * \brief  SPSC ring of one thread. Producer and consumer indices live on separate cache lines.
+ */
+struct ThreadRing {
+    static constexpr std::size_t kLine{ara::core::kDestructiveInterferenceSize};
+
+    alignas(kLine) std::atomic<std::uint64_t> tail{0U};     /*!< Next Record to write (producer) */
+    alignas(kLine) std::atomic<std::uint64_t> head{0U};     /*!< Next Record to read (consumer) */
+    alignas(kLine) std::atomic<RingState>     state{RingState::kFree};
+    std::atomic<std::uint64_t>                dropped{0U};  /*!< Messages dropped because the ring was full */
+    internal::Record                          records[LogBackend::kRingCapacity]{};
+};
+
+/*!
+ * \brief  Static storage of all rings.
+ */
+ThreadRing gRings[LogBackend::kMaxThreads]{};
+
+/*!
+ * \brief  Messages dropped because no ring was left.
+ */
+std::atomic<std::uint64_t> gUnassignedDrops{0U};
+
+/*!
+ * \brief  Process-wide threshold.
+ */
+std::atomic<LogLevel> gThreshold{LogLevel::kInfo};
+
+/*!
+ * \brief  Producer-side view of the calling thread's ring (trivially destructible).
+ */
+struct ThreadHandle {
+    ThreadRing*   ring{nullptr};
+    std::uint64_t cachedHead{0U};   /*!< Last observed consumer index, refreshed when the ring looks full */
+};
+
+thread_local ThreadHandle tHandle{};
+
+/*!
+ * \brief  pthread key destructor: marks the ring of an exiting thread as orphaned.
+ */
+auto ReleaseThreadRing(void* ring) noexcept -> void
+{
+    static_cast<ThreadRing*>(ring)->state.store(RingState::kOrphaned, std::memory_order_release);
+}
+
+/*!
+ * \brief  Returns the pthread key whose destructor releases the ring of an exiting thread.
+ */
+auto RingKey() noexcept -> pthread_key_t
+{
+    static pthread_key_t const key = []() noexcept {
+        pthread_key_t created{};
+        static_cast<void>(pthread_key_create(&created, &ReleaseThreadRing));
+        return created;
+    }();
+    return key;
+}
+
+/*!
+ * \brief  Claims a free ring for the calling thread.
+ *
+ * \return The ring, or nullptr if all kMaxThreads rings are owned.
+ */
+auto ClaimRing() noexcept -> ThreadRing*
+{
+    for (ThreadRing& ring : gRings) {
+        RingState expected{RingState::kFree};
+        if ((ring.state.load(std::memory_order_relaxed) == RingState::kFree) &&
+            ring.state.compare_exchange_strong(expected, RingState::kActive, std::memory_order_acquire,
+                                               std::memory_order_relaxed)) {
+            static_cast<void>(pthread_setspecific(RingKey(), &ring));
+            tHandle.ring       = &ring;
+            tHandle.cachedHead = ring.head.load(std::memory_order_acquire);
+            return &ring;
+        }
+    }
+    return nullptr;
+}
+
+/**********************************************************************************************************************
+ *  SECTION: Formatting
+ *********************************************************************************************************************/
+/*!
+ * \brief  Names of the log levels, indexed by LogLevel.
+ */
+constexpr const char* kLevelNames[]{"OFF", "FATAL", "ERROR", "WARN", "INFO", "DEBUG", "VERBOSE"};
+
+/*!
+ * \brief  Bounded line builder; always keeps one character for the terminating newline.
+ */
+class LineBuilder final {
+public:
+    LineBuilder(char* buffer, std::size_t capacity) noexcept
+        : buffer_{buffer}, limit_{(capacity > 0U) ? (capacity - 1U) : 0U}
+    {
+    }
+
+    auto Append(const char* text, std::size_t length) noexcept -> void
+    {
+        std::size_t const free  = limit_ - size_;
+        std::size_t const count = (length < free) ? length : free;
+        if (count > 0U) {
+            std::memcpy(&buffer_[size_], text, count);
+            size_ += count;
+        }
+    }
+
+    auto Append(const char* text) noexcept -> void
+    {
+        Append(text, std::strlen(text));
+    }
+
+    auto Append(char character) noexcept -> void
+    {
+        if (size_ < limit_) {
+            buffer_[size_] = character;
+            ++size_;
+        }
+    }
+
+    auto AppendSigned(std::int64_t value) noexcept -> void
+    {
+        char digits[kDigitsSize]{};
+        AppendDigits(digits, std::snprintf(digits, sizeof(digits), "%lld", static_cast<long long>(value)));
+    }
+
+    auto AppendUnsigned(std::uint64_t value) noexcept -> void
+    {
+        char digits[kDigitsSize]{};
+        AppendDigits(digits, std::snprintf(digits, sizeof(digits), "%llu", static_cast<unsigned long long>(value)));
+    }
+
+    /*!
+     * \brief  Appends \c value zero-padded to six digits (fraction of a timestamp).
+     */
+    auto AppendSixDigits(std::uint64_t value) noexcept -> void
+    {
+        char digits[kDigitsSize]{};
+        AppendDigits(digits, std::snprintf(digits, sizeof(digits), "%06llu", static_cast<unsigned long long>(value)));
+    }
+
+    auto AppendHex(std::uint64_t value) noexcept -> void
+    {
+        char digits[kDigitsSize]{};
+        AppendDigits(digits, std::snprintf(digits, sizeof(digits), "0x%llx", static_cast<unsigned long long>(value)));
+    }
+
+    auto AppendDouble(double value) noexcept -> void
+    {
+        char digits[kDigitsSize]{};
+        AppendDigits(digits, std::snprintf(digits, sizeof(digits), "%g", value));
+    }
+
+    auto Finish() noexcept -> std::size_t
+    {
+        if (limit_ == 0U) {
+            return 0U;
+        }
+        buffer_[size_] = '\n';
+        return size_ + 1U;
+    }
+
+private:
+    static constexpr std::size_t kDigitsSize{32U};
+
+    /*!
+     * \brief  Appends the snprintf output \c digits of \c length characters.
+     */
+    auto AppendDigits(const char* digits, int length) noexcept -> void
+    {
+        if (length > 0) {
+            std::size_t const count = static_cast<std::size_t>(length);
+            Append(digits, (count < kDigitsSize) ? count : (kDigitsSize - 1U));
+        }
+    }
+
+    char*       buffer_;
+    std::size_t limit_;
+    std::size_t size_{0U};
+};
+
+/*!
+ * \brief  Reads the encoded arguments of a Record in order.
+ */
+class ArgReader final {
+public:
+    explicit ArgReader(const internal::Record& record) noexcept : record_{record} {}
+
+    /*!
+     * \brief  Appends the next argument to \c line.
+     *
+     * \return false if no argument is left.
+     */
+    auto AppendNext(LineBuilder& line) noexcept -> bool
+    {
+        std::size_t const size = static_cast<std::size_t>(record_.payloadSize);
+        if (offset_ >= size) {
+            return false;
+        }
+
+        internal::ArgType const type = static_cast<internal::ArgType>(record_.payload[offset_]);
+        if (type == internal::ArgType::kString) {
+            std::size_t const length = static_cast<std::size_t>(record_.payload[offset_ + 1U]);
+            line.Append(reinterpret_cast<const char*>(&record_.payload[offset_ + 2U]), length);
+            offset_ += 2U + length;
+            return true;
+        }
+
+        std::uint64_t raw{0U};
+        std::memcpy(&raw, &record_.payload[offset_ + 1U], sizeof(raw));
+        offset_ += 1U + sizeof(raw);
+
+        switch (type) {
+            case internal::ArgType::kBool:
+                line.Append((raw != 0U) ? "true" : "false");
+                break;
+            case internal::ArgType::kChar:
+                line.Append(static_cast<char>(raw));
+                break;
+            case internal::ArgType::kSigned: {
+                std::int64_t value{0};
+                std::memcpy(&value, &raw, sizeof(value));
+                line.AppendSigned(value);
+                break;
+            }
+            case internal::ArgType::kUnsigned:
+                line.AppendUnsigned(raw);
+                break;
+            case internal::ArgType::kDouble: {
+                double value{0.0};
+                std::memcpy(&value, &raw, sizeof(value));
+                line.AppendDouble(value);
+                break;
+            }
+            case internal::ArgType::kPointer:
+                line.AppendHex(raw);
+                break;
+            default:
+                line.Append('?');
+                break;
+        }
+        return true;
+    }
+
+private:
+    const internal::Record& record_;
+    std::size_t             offset_{0U};
+};
+
+/**********************************************************************************************************************
+ *  SECTION: Sinks
+ *********************************************************************************************************************/
+/*!
+ * \brief  Writes \c size bytes to \c fd, retrying on partial writes and EINTR.
+ */
+auto WriteAll(int fd, const char* data, std::size_t size) noexcept -> void
+{
+    while (size > 0U) {
+        ssize_t const written = ::write(fd, data, size);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return;
+        }
+        data += written;
+        size -= static_cast<std::size_t>(written);
+    }
+}
+
+/*!
+ * \brief  Whether messages of \c level go to stderr (instead of stdout) on the console.
+ */
+constexpr auto IsErrorLevel(LogLevel level) noexcept -> bool
+{
+    return (level == LogLevel::kFatal) || (level == LogLevel::kError);
+}
+
+/*!
+ * \brief  Sends one line (without its newline) to the platform system logger.
+ */
+auto WriteRemote(LogLevel level, const char* line, std::size_t length) noexcept -> void
+{
+    int const size = static_cast<int>((length > 0U) ? (length - 1U) : 0U);
+#if defined(__QNXNTO__)
+    int severity{_SLOG_INFO};
+    switch (level) {
+        case LogLevel::kFatal:   severity = _SLOG_CRITICAL; break;
+        case LogLevel::kError:   severity = _SLOG_ERROR;    break;
+        case LogLevel::kWarn:    severity = _SLOG_WARNING;  break;
+        case LogLevel::kDebug:   severity = _SLOG_DEBUG1;   break;
+        case LogLevel::kVerbose: severity = _SLOG_DEBUG2;   break;
+        default:                 break;
+    }
+    static_cast<void>(slogf(_SLOG_SETCODE(_SLOGC_PRIVATE_START, 0), severity, "%.*s", size, line));
+#else
+    int priority{LOG_INFO};
+    switch (level) {
+        case LogLevel::kFatal:   priority = LOG_CRIT;    break;
+        case LogLevel::kError:   priority = LOG_ERR;     break;
+        case LogLevel::kWarn:    priority = LOG_WARNING; break;
+        case LogLevel::kDebug:   priority = LOG_DEBUG;   break;
+        case LogLevel::kVerbose: priority = LOG_DEBUG;   break;
+        default:                 break;
+    }
+    syslog(priority, "%.*s", size, line);
+#endif
+}
+
+/**********************************************************************************************************************
+ *  SECTION: Consumer helpers
+ *********************************************************************************************************************/
+/*!
+ * \brief  Records written per Drain() call of the backend thread before it checks for a stop request.
+ */
+constexpr std::size_t kDrainLimit{LogBackend::kRingCapacity * LogBackend::kMaxThreads};
+
+/*!
+ * \brief  Poll interval of Flush() while waiting for the backend thread.
+ */
+constexpr std::chrono::microseconds kFlushPollInterval{100};
+
+/*!
+ * \brief  Total number of dropped messages.
+ */
+auto TotalDrops() noexcept -> std::uint64_t
+{
+    std::uint64_t total = gUnassignedDrops.load(std::memory_order_relaxed);
+    for (const ThreadRing& ring : gRings) {
+        total += ring.dropped.load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+} // namespace
+
+/**********************************************************************************************************************
+ *  SECTION: Producer hooks
+ *********************************************************************************************************************/
+namespace internal {
+
+auto IsAsynchronous() noexcept -> bool
+{
+    return LogBackend::Instance().IsRunning();
+}
+
+auto GetThreshold() noexcept -> LogLevel
+{
+    return gThreshold.load(std::memory_order_relaxed);
+}
+
+auto AcquireRecord() noexcept -> Record*
+{
+    ThreadRing* ring = tHandle.ring;
+    if (ring == nullptr) {
+        ring = ClaimRing();
+        if (ring == nullptr) {
+            gUnassignedDrops.fetch_add(1U, std::memory_order_relaxed);
+            return nullptr;
+        }
+    }
+
+    std::uint64_t const tail = ring->tail.load(std::memory_order_relaxed);
+    if ((tail - tHandle.cachedHead) >= LogBackend::kRingCapacity) {
+        tHandle.cachedHead = ring->head.load(std::memory_order_acquire);
+        if ((tail - tHandle.cachedHead) >= LogBackend::kRingCapacity) {
+            ring->dropped.fetch_add(1U, std::memory_order_relaxed);
+            return nullptr;
+        }
+    }
+    return &ring->records[tail & (LogBackend::kRingCapacity - 1U)];
+}
+
+auto CommitRecord() noexcept -> void
+{
+    ThreadRing* const ring = tHandle.ring;
+    ring->tail.store(ring->tail.load(std::memory_order_relaxed) + 1U, std::memory_order_release);
+
+    // Pairs with the fence in Stop(): either its final Drain() sees the Record, or this thread sees the backend
+    // stopped and writes the Record itself (Flush() drains under the control lock once no backend thread runs)
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (!IsAsynchronous()) {
+        LogBackend::Instance().Flush();
+    }
+}
+
+auto EmitRecord(const Record& record) noexcept -> void
+{
+    LogBackend::Instance().WriteNow(record);
+}
+
+auto FormatRecord(const Record& record, char* buffer, std::size_t capacity, bool timestamp) noexcept -> std::size_t
+{
+    LineBuilder line{buffer, capacity};
+
+    if (timestamp) {
+        std::uint64_t const nanoseconds = static_cast<std::uint64_t>((record.timestamp > 0) ? record.timestamp : 0);
+        line.Append('[');
+        line.AppendUnsigned(nanoseconds / 1000000000U);
+        line.Append('.');
+        line.AppendSixDigits((nanoseconds % 1000000000U) / 1000U);
+        line.Append(']');
+    }
+
+    std::size_t const levelIndex = static_cast<std::size_t>(record.level);
+    line.Append('[');
+    line.Append((record.context != nullptr) ? record.context : "");
+    line.Append("][");
+    line.Append((levelIndex < (sizeof(kLevelNames) / sizeof(kLevelNames[0]))) ? kLevelNames[levelIndex] : "?");
+    line.Append("] ");
+
+    ArgReader arguments{record};
+    const char* format = (record.format != nullptr) ? record.format : "";
+    while (*format != '\0') {
+        if ((format[0] == '{') && (format[1] == '}')) {
+            if (!arguments.AppendNext(line)) {
+                line.Append("{}", 2U);
+            }
+            format += 2;
+        } else if (((format[0] == '{') && (format[1] == '{')) || ((format[0] == '}') && (format[1] == '}'))) {
+            line.Append(format[0]);
+            format += 2;
+        } else {
+            line.Append(format[0]);
+            ++format;
+        }
+    }
+
+    return line.Finish();
+}
+
+} // namespace internal
+
+/**********************************************************************************************************************
+ *  SECTION: LogBackend
+ *********************************************************************************************************************/
+auto LogBackend::Instance() noexcept -> LogBackend&
+{
+    static LogBackend instance;
+    return instance;
+}
+
+LogBackend::~LogBackend() noexcept
+{
+    Stop();
+}
+
+auto LogBackend::Start(const BackendConfig& config) noexcept -> ErrorCode
+{
+    std::lock_guard<std::mutex> lock(control_);
+
+    if (threadStarted_) {
+        return ErrorCode::AlreadyRunning;
+    }
+    if ((config.drainPeriod.count() <= 0) ||
+        (HasLogMode(config.mode, LogMode::kFile) && (config.filePath == nullptr))) {
+        return ErrorCode::InvalidArgument;
+    }
+
+    if (HasLogMode(config.mode, LogMode::kFile)) {
+        fileFd_ = ::open(config.filePath, O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+        if (fileFd_ < 0) {
+            return ErrorCode::SinkFailure;
+        }
+    }
+#if !defined(__QNXNTO__)
+    if (HasLogMode(config.mode, LogMode::kRemote)) {
+        openlog(config.applicationId, LOG_PID, LOG_USER);
+    }
+#endif
+
+    config_ = config;
+    gThreshold.store(config.level, std::memory_order_relaxed);
+    running_.store(true, std::memory_order_release);
+
+    // The backend thread must never compete with real-time threads: SCHED_OTHER regardless of the caller
+    pthread_attr_t attributes{};
+    sched_param parameters{};
+    parameters.sched_priority = 0;
+    bool created = (pthread_attr_init(&attributes) == 0);
+    if (created) {
+        created = (pthread_attr_setinheritsched(&attributes, PTHREAD_EXPLICIT_SCHED) == 0) &&
+                  (pthread_attr_setschedpolicy(&attributes, SCHED_OTHER) == 0) &&
+                  (pthread_attr_setschedparam(&attributes, &parameters) == 0) &&
+                  (pthread_create(&thread_, &attributes, &LogBackend::ThreadEntry, this) == 0);
+        static_cast<void>(pthread_attr_destroy(&attributes));
+    }
+
+    if (!created) {
+        running_.store(false, std::memory_order_release);
+        if (fileFd_ >= 0) {
+            static_cast<void>(::close(fileFd_));
+            fileFd_ = -1;
+        }
+        config_ = BackendConfig{};
+        return ErrorCode::ThreadCreationFailed;
+    }
+
+    static_cast<void>(pthread_setname_np(thread_, "ara_log"));
+    threadStarted_ = true;
+    return ErrorCode::Success;
+}
+
+auto LogBackend::Stop() noexcept -> void
+{
+    std::lock_guard<std::mutex> lock(control_);
+
+    if (!threadStarted_) {
+        return;
+    }
+
+    running_.store(false, std::memory_order_release);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    static_cast<void>(pthread_join(thread_, nullptr));
+    threadStarted_ = false;
+
+    // Producers now write synchronously; write what is left in the rings. A producer that committed after this
+    // Drain() has seen running_ false and flushes its Record itself
+    while (Drain(kDrainLimit) > 0U) {
+    }
+
+    if (fileFd_ >= 0) {
+        static_cast<void>(::close(fileFd_));
+        fileFd_ = -1;
+    }
+#if !defined(__QNXNTO__)
+    if (HasLogMode(config_.mode, LogMode::kRemote)) {
+        closelog();
+    }
+#endif
+    config_ = BackendConfig{};
+}
+
+auto LogBackend::Flush() noexcept -> void
+{
+    std::lock_guard<std::mutex> lock(control_);
+
+    if (!threadStarted_) {
+        while (Drain(kDrainLimit) > 0U) {
+        }
+        return;
+    }
+
+    std::uint64_t const ticket = flushRequested_.fetch_add(1U, std::memory_order_acq_rel) + 1U;
+    while (flushCompleted_.load(std::memory_order_acquire) < ticket) {
+        std::this_thread::sleep_for(kFlushPollInterval);
+    }
+}
+
+auto LogBackend::IsRunning() const noexcept -> bool
+{
+    return running_.load(std::memory_order_acquire);
+}
+
+auto LogBackend::SetLevel(LogLevel level) noexcept -> void
+{
+    gThreshold.store(level, std::memory_order_relaxed);
+}
+
+auto LogBackend::GetLevel() const noexcept -> LogLevel
+{
+    return gThreshold.load(std::memory_order_relaxed);
+}
+
+auto LogBackend::GetDroppedCount() const noexcept -> std::uint64_t
+{
+    return TotalDrops();
+}
+
+auto LogBackend::ThreadEntry(void* argument) noexcept -> void*
+{
+    static_cast<LogBackend*>(argument)->Run();
+    return nullptr;
+}
+
+auto LogBackend::Run() noexcept -> void
+{
+    while (running_.load(std::memory_order_acquire)) {
+        std::uint64_t const requested = flushRequested_.load(std::memory_order_acquire);
+        if (Drain(kDrainLimit) == 0U) {
+            // Everything committed before the flush request has been written
+            flushCompleted_.store(requested, std::memory_order_release);
+            std::this_thread::sleep_for(config_.drainPeriod);
+        }
+    }
+}
+
+auto LogBackend::Drain(std::size_t limit) noexcept -> std::size_t
+{
+    std::uint64_t heads[kMaxThreads]{};
+    std::uint64_t tails[kMaxThreads]{};
+    for (std::size_t index = 0U; index < kMaxThreads; ++index) {
+        heads[index] = gRings[index].head.load(std::memory_order_relaxed);
+        tails[index] = gRings[index].tail.load(std::memory_order_acquire);
+    }
+
+    char line[kMaxLineLength];
+    std::size_t written = 0U;
+    while (written < limit) {
+        // k-way merge: the oldest head Record of all rings
+        std::size_t oldest = kMaxThreads;
+        for (std::size_t index = 0U; index < kMaxThreads; ++index) {
+            if ((heads[index] != tails[index]) &&
+                ((oldest == kMaxThreads) ||
+                 (gRings[index].records[heads[index] & (kRingCapacity - 1U)].timestamp <
+                  gRings[oldest].records[heads[oldest] & (kRingCapacity - 1U)].timestamp))) {
+                oldest = index;
+            }
+        }
+        if (oldest == kMaxThreads) {
+            break;
+        }
+
+        const internal::Record& record = gRings[oldest].records[heads[oldest] & (kRingCapacity - 1U)];
+        LogLevel const level = record.level;
+        std::size_t const length = internal::FormatRecord(record, line, sizeof(line), config_.timestamps);
+        ++heads[oldest];
+        gRings[oldest].head.store(heads[oldest], std::memory_order_release);
+
+        Output(level, line, length);
+        ++written;
+    }
+
+    std::uint64_t const drops = TotalDrops();
+    if (drops != reportedDrops_) {
+        LineBuilder report{line, sizeof(line)};
+        report.Append("[ara_log][WARN] ");
+        report.AppendUnsigned(drops - reportedDrops_);
+        report.Append(" log messages dropped (ring buffers full)");
+        Output(LogLevel::kWarn, line, report.Finish());
+        reportedDrops_ = drops;
+    }
+
+    FlushBatches();
+
+    for (ThreadRing& ring : gRings) {
+        RingState expected{RingState::kOrphaned};
+        if ((ring.state.load(std::memory_order_acquire) == RingState::kOrphaned) &&
+            (ring.tail.load(std::memory_order_acquire) == ring.head.load(std::memory_order_relaxed))) {
+            static_cast<void>(ring.state.compare_exchange_strong(expected, RingState::kFree,
+                                                                 std::memory_order_release,
+                                                                 std::memory_order_relaxed));
+        }
+    }
+
+    return written;
+}
+
+auto LogBackend::Output(LogLevel level, const char* line, std::size_t length) noexcept -> void
+{
+    auto const append = [line, length](char* batch, std::size_t& size, int fd) noexcept {
+        if ((size + length) > kBatchSize) {
+            WriteAll(fd, batch, size);
+            size = 0U;
+        }
+        std::memcpy(&batch[size], line, length);
+        size += length;
+    };
+
+    if (HasLogMode(config_.mode, LogMode::kConsole)) {
+        if (IsErrorLevel(level)) {
+            append(stderrBatch_, stderrSize_, STDERR_FILENO);
+        } else {
+            append(stdoutBatch_, stdoutSize_, STDOUT_FILENO);
+        }
+    }
+    if (fileFd_ >= 0) {
+        append(fileBatch_, fileSize_, fileFd_);
+    }
+    if (HasLogMode(config_.mode, LogMode::kRemote)) {
+        WriteRemote(level, line, length);
+    }
+}
+
+auto LogBackend::FlushBatches() noexcept -> void
+{
+    if (stdoutSize_ > 0U) {
+        WriteAll(STDOUT_FILENO, stdoutBatch_, stdoutSize_);
+        stdoutSize_ = 0U;
+    }
+    if (stderrSize_ > 0U) {
+        WriteAll(STDERR_FILENO, stderrBatch_, stderrSize_);
+        stderrSize_ = 0U;
+    }
+    if ((fileSize_ > 0U) && (fileFd_ >= 0)) {
+        WriteAll(fileFd_, fileBatch_, fileSize_);
+    }
+    fileSize_ = 0U;
+}
+
+auto LogBackend::WriteNow(const internal::Record& record) noexcept -> void
+{
+    // Start() and Stop() change the sinks under the same lock: the file stays open until this write is done
+    std::lock_guard<std::mutex> lock(control_);
+
+    bool const running = IsRunning();
+    char line[kMaxLineLength];
+    std::size_t const length = internal::FormatRecord(record, line, sizeof(line), running && config_.timestamps);
+
+    if (!running || HasLogMode(config_.mode, LogMode::kConsole)) {
+        WriteAll(IsErrorLevel(record.level) ? STDERR_FILENO : STDOUT_FILENO, line, length);
+    }
+    if (running && (fileFd_ >= 0)) {
+        WriteAll(fileFd_, line, length);
+    }
+    if (running && HasLogMode(config_.mode, LogMode::kRemote)) {
+        WriteRemote(record.level, line, length);
+    }
+}
+
+} // namespace log
+} // namespace ara
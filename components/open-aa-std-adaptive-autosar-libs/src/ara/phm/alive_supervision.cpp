@@ -0,0 +1,399 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project (CXX_STANDARD 17)
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara/phm/alive_supervision.cpp
+ *  \brief      Implementation of the ara::phm heartbeat segment, supervised entity and alive supervisor.
+ *
+ *  \details    Only registration and segment handling make system calls (shm_open, mmap, getpid, kill); reporting and
+ *              checking are plain atomic stores and loads on the shared table.
+ *********************************************************************************************************************/
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include "ara/phm/alive_supervision.h"
+
+#include <cerrno>        // For errno, EPERM
+#include <csignal>       // For kill
+#include <cstring>       // For std::memcpy
+#include <string_view>   // For std::string_view
+#include <unistd.h>      // For getpid
+
+#include "ara/os/interface/timer/cyclic_executive.h"  // For PlatformDeadlineTimer::Now
+
+namespace ara {
+namespace phm {
+
+namespace {
+
+using ara::os::interface::shm::SegmentConfig;
+using ShmErrorCode = ara::os::interface::shm::ErrorCode;
+using internal::HeartbeatSlot;
+using internal::SlotState;
+
+/**********************************************************************************************************************
+ *  SECTION: File-local helpers
+ *********************************************************************************************************************/
+/*!
+ * \brief  Name of an entity as the zero-padded words stored in a slot.
+ */
+struct PackedName {
+    std::uint64_t words[HeartbeatSlot::kNameWords]{};
+};
+
+/*!
+ * \brief  Packs \c name, cut to HeartbeatSlot::kNameCapacity characters.
+ */
+auto PackName(std::string_view name) noexcept -> PackedName
+{
+    char bytes[HeartbeatSlot::kNameCapacity]{};
+    std::size_t const length = (name.size() < sizeof(bytes)) ? name.size() : sizeof(bytes);
+    std::memcpy(bytes, name.data(), length);
+
+    PackedName packed{};
+    std::memcpy(packed.words, bytes, sizeof(bytes));
+    return packed;
+}
+
+/*!
+ * \brief  Whether \c slot carries the name \c packed.
+ */
+auto HasName(const HeartbeatSlot& slot, const PackedName& packed) noexcept -> bool
+{
+    for (std::size_t i = 0U; i < HeartbeatSlot::kNameWords; ++i) {
+        if (slot.name[i].load(std::memory_order_relaxed) != packed.words[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/*!
+ * \brief  Whether process \c pid exists (EPERM: it exists but belongs to another user).
+ */
+auto IsProcessAlive(std::int32_t pid) noexcept -> bool
+{
+    return (pid > 0) && ((::kill(static_cast<pid_t>(pid), 0) == 0) || (errno == EPERM));
+}
+
+/*!
+ * \brief  Moves \c slot from \c expected to kClaimed and its owner from \c owner (read before) to \c self.
+ *
+ * \details The owner is published right with the claim, so that a claim abandoned by a dead process is taken over by
+ *          the same owner exchange: of a claimant and a registrant taking the claim over, exactly one wins the slot.
+ */
+auto TryClaim(HeartbeatSlot& slot, SlotState expected, std::int32_t owner, std::int32_t self) noexcept -> bool
+{
+    return slot.state.compare_exchange_strong(expected, SlotState::kClaimed, std::memory_order_acquire,
+                                              std::memory_order_relaxed) &&
+           slot.pid.compare_exchange_strong(owner, self, std::memory_order_acq_rel, std::memory_order_relaxed);
+}
+
+/*!
+ * \brief  Whether \c slot in \c state may be claimed from its \c owner: deactivated, or the owner process is gone.
+ */
+auto IsOwnerGone(SlotState state, std::int32_t owner) noexcept -> bool
+{
+    return (state == SlotState::kDeactivated) || !IsProcessAlive(owner);
+}
+
+/*!
+ * \brief  Maps a shared-memory error of Create() / Open().
+ */
+auto ToErrorCode(ShmErrorCode error) noexcept -> ErrorCode
+{
+    switch (error) {
+        case ShmErrorCode::Success:
+            return ErrorCode::Success;
+        case ShmErrorCode::InvalidArgument:
+            return ErrorCode::InvalidArgument;
+        case ShmErrorCode::NotFound:
+            return ErrorCode::SegmentNotFound;
+        case ShmErrorCode::AlreadyExists:
+            return ErrorCode::SegmentExists;
+        case ShmErrorCode::SizeMismatch:
+            return ErrorCode::IncompatibleSegment;
+        default:
+            return ErrorCode::SegmentFailure;
+    }
+}
+
+/*!
+ * \brief  Configuration of the heartbeat segment \c name.
+ */
+auto MakeSegmentConfig(const char* name, bool writable) noexcept -> SegmentConfig
+{
+    SegmentConfig config{};
+    config.name     = name;
+    config.size     = sizeof(HeartbeatTable);
+    config.writable = writable;
+    config.prefault = true;
+    return config;
+}
+
+} // namespace
+
+/**********************************************************************************************************************
+ *  FUNCTION: HeartbeatSegment::Create
+ *********************************************************************************************************************/
+auto HeartbeatSegment::Create(const char* name) noexcept -> ErrorCode
+{
+    ShmErrorCode const created = memory_.Create(MakeSegmentConfig(name, true));
+    return (created == ShmErrorCode::Success) ? InitializeTable(name) : ToErrorCode(created);
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: HeartbeatSegment::InitializeTable
+ *********************************************************************************************************************/
+/*!
+ * \brief  Constructs the table in the new segment and publishes it; removes the segment again on a failure.
+ */
+auto HeartbeatSegment::InitializeTable(const char* name) noexcept -> ErrorCode
+{
+    table_ = memory_.Emplace<HeartbeatTable>();
+    if (table_ == nullptr) {
+        Close();
+        static_cast<void>(ara::os::interface::shm::SharedMemory::Unlink(name));
+        return ErrorCode::SegmentFailure;
+    }
+    table_->Publish();
+    view_ = table_;
+    return ErrorCode::Success;
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: HeartbeatSegment::Open
+ *********************************************************************************************************************/
+/*!
+ * \brief  Opens the segment and checks that it holds a published table of this version.
+ *
+ * \note   A segment that is still being created reports IncompatibleSegment until its creator published the table.
+ */
+auto HeartbeatSegment::Open(const char* name, bool writable) noexcept -> ErrorCode
+{
+    ShmErrorCode const opened = memory_.Open(MakeSegmentConfig(name, writable));
+    if (opened != ShmErrorCode::Success) {
+        return ToErrorCode(opened);
+    }
+
+    view_ = memory_.Attach<const HeartbeatTable>();
+    if ((view_ == nullptr) || !view_->IsValid()) {
+        Close();
+        return ErrorCode::IncompatibleSegment;
+    }
+    table_ = writable ? memory_.Attach<HeartbeatTable>() : nullptr;
+    return ErrorCode::Success;
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: HeartbeatSegment::OpenOrCreate
+ *********************************************************************************************************************/
+/*!
+ * \brief  Opens the segment, creates it if it does not exist, and opens it again if another process created it in
+ *         between.
+ */
+auto HeartbeatSegment::OpenOrCreate(const char* name) noexcept -> ErrorCode
+{
+    ErrorCode result = Open(name, true);
+    if (result == ErrorCode::SegmentNotFound) {
+        ShmErrorCode const created = memory_.Create(MakeSegmentConfig(name, true));
+        if (created == ShmErrorCode::Success) {
+            result = InitializeTable(name);
+        } else if (created == ShmErrorCode::AlreadyExists) {
+            result = Open(name, true);
+        } else {
+            result = ToErrorCode(created);
+        }
+    }
+    return result;
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: HeartbeatSegment::Close / Unlink
+ *********************************************************************************************************************/
+auto HeartbeatSegment::Close() noexcept -> void
+{
+    table_ = nullptr;
+    view_  = nullptr;
+    memory_.Close();
+}
+
+auto HeartbeatSegment::Unlink(const char* name) noexcept -> ErrorCode
+{
+    return ToErrorCode(ara::os::interface::shm::SharedMemory::Unlink(name));
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: SupervisedEntity::Register
+ *********************************************************************************************************************/
+/*!
+ * \brief  Claims a slot (same name of an exited owner first, then a free or deactivated one) and activates it.
+ */
+auto SupervisedEntity::Register(const HeartbeatSegment& segment, const SupervisionConfig& config,
+                                MonotonicTime now) noexcept -> ErrorCode
+{
+    Deactivate();
+
+    if (segment.GetView() == nullptr) {
+        return ErrorCode::IncompatibleSegment;
+    }
+    HeartbeatTable* const table = segment.GetTable();
+    if (table == nullptr) {
+        return ErrorCode::ReadOnly;
+    }
+    if ((config.name == nullptr) || (config.name[0] == '\0') || (config.period.count() <= 0) ||
+        (config.tolerance.count() < 0)) {
+        return ErrorCode::InvalidArgument;
+    }
+
+    PackedName const name = PackName(config.name);
+    std::int32_t const self = static_cast<std::int32_t>(::getpid());
+    HeartbeatSlot* claimed{nullptr};
+
+    /* 1. The slot of a previous instance of this entity (restart after a crash or an orderly shutdown) */
+    for (std::size_t i = 0U; (claimed == nullptr) && (i < HeartbeatTable::kCapacity); ++i) {
+        HeartbeatSlot& slot = table->GetSlot(i);
+        SlotState const state = slot.state.load(std::memory_order_acquire);
+        if ((state == SlotState::kFree) || !HasName(slot, name)) {
+            continue;
+        }
+        std::int32_t const owner = slot.pid.load(std::memory_order_acquire);
+        if (IsOwnerGone(state, owner) && TryClaim(slot, state, owner, self)) {
+            claimed = &slot;
+        }
+    }
+
+    /* 2. A free or deactivated slot, or one whose claimant died before activating it */
+    for (std::size_t i = 0U; (claimed == nullptr) && (i < HeartbeatTable::kCapacity); ++i) {
+        HeartbeatSlot& slot = table->GetSlot(i);
+        SlotState const state = slot.state.load(std::memory_order_acquire);
+        if (state == SlotState::kActive) {
+            continue;
+        }
+        std::int32_t const owner = slot.pid.load(std::memory_order_acquire);
+        if (((state != SlotState::kClaimed) || IsOwnerGone(state, owner)) && TryClaim(slot, state, owner, self)) {
+            claimed = &slot;
+        }
+    }
+
+    if (claimed == nullptr) {
+        return ErrorCode::CapacityExceeded;
+    }
+
+    budget_  = static_cast<std::int64_t>((config.period + config.tolerance).count());
+    reports_ = 0U;
+    std::int64_t const time = static_cast<std::int64_t>(now.count());
+    claimed->period.store(static_cast<std::int64_t>(config.period.count()), std::memory_order_relaxed);
+    for (std::size_t i = 0U; i < HeartbeatSlot::kNameWords; ++i) {
+        claimed->name[i].store(name.words[i], std::memory_order_relaxed);
+    }
+    claimed->reports.store(0U, std::memory_order_relaxed);
+    claimed->lastReport.store(time, std::memory_order_relaxed);
+    claimed->deadline.store(time + budget_, std::memory_order_relaxed);
+    claimed->state.store(SlotState::kActive, std::memory_order_release);
+
+    slot_ = claimed;
+    return ErrorCode::Success;
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: SupervisedEntity::ReportAlive / Deactivate
+ *********************************************************************************************************************/
+auto SupervisedEntity::ReportAlive() noexcept -> void
+{
+    ReportAlive(ara::os::interface::timer::PlatformDeadlineTimer::Now());
+}
+
+auto SupervisedEntity::Deactivate() noexcept -> void
+{
+    if (slot_ != nullptr) {
+        slot_->state.store(SlotState::kDeactivated, std::memory_order_release);
+        slot_ = nullptr;
+    }
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: AliveSupervisor::Check
+ *********************************************************************************************************************/
+/*!
+ * \brief  Evaluates the deadline of every registered slot against \c now.
+ */
+auto AliveSupervisor::Check(MonotonicTime now, ara::core::Span<EntityStatus> statuses) const noexcept -> std::size_t
+{
+    if (table_ == nullptr) {
+        return 0U;
+    }
+
+    std::int64_t const time = static_cast<std::int64_t>(now.count());
+    std::size_t registered{0U};
+    for (std::size_t i = 0U; i < HeartbeatTable::kCapacity; ++i) {
+        const HeartbeatSlot& slot = table_->GetSlot(i);
+        SlotState const state = slot.state.load(std::memory_order_acquire);
+        if ((state == SlotState::kFree) || (state == SlotState::kClaimed)) {
+            continue;
+        }
+        if (registered < statuses.size()) {
+            EntityStatus& status = statuses[registered];
+            std::int64_t const deadline = slot.deadline.load(std::memory_order_acquire);
+
+            char bytes[HeartbeatSlot::kNameCapacity];
+            for (std::size_t word = 0U; word < HeartbeatSlot::kNameWords; ++word) {
+                std::uint64_t const value = slot.name[word].load(std::memory_order_relaxed);
+                std::memcpy(&bytes[word * sizeof(value)], &value, sizeof(value));
+            }
+            std::size_t length{0U};
+            while ((length < sizeof(bytes)) && (bytes[length] != '\0')) {
+                ++length;
+            }
+
+            status.slot    = i;
+            status.name.assign(std::string_view(bytes, length));
+            status.pid     = slot.pid.load(std::memory_order_relaxed);
+            status.reports = slot.reports.load(std::memory_order_relaxed);
+            status.period  = std::chrono::nanoseconds(slot.period.load(std::memory_order_relaxed));
+            status.overdue = std::chrono::nanoseconds(0);
+            if (state == SlotState::kDeactivated) {
+                status.status = SupervisionStatus::Deactivated;
+            } else if (time > deadline) {
+                status.status  = SupervisionStatus::Expired;
+                status.overdue = std::chrono::nanoseconds(time - deadline);
+            } else {
+                status.status = SupervisionStatus::Ok;
+            }
+        }
+        ++registered;
+    }
+    return registered;
+}
+
+/**********************************************************************************************************************
+ *  FUNCTION: AliveSupervisor::CountExpired
+ *********************************************************************************************************************/
+/*!
+ * \brief  One state and one deadline load per slot.
+ */
+auto AliveSupervisor::CountExpired(MonotonicTime now) const noexcept -> std::size_t
+{
+    if (table_ == nullptr) {
+        return 0U;
+    }
+
+    std::int64_t const time = static_cast<std::int64_t>(now.count());
+    std::size_t expired{0U};
+    for (std::size_t i = 0U; i < HeartbeatTable::kCapacity; ++i) {
+        const HeartbeatSlot& slot = table_->GetSlot(i);
+        if ((slot.state.load(std::memory_order_acquire) == SlotState::kActive) &&
+            (time > slot.deadline.load(std::memory_order_acquire))) {
+            ++expired;
+        }
+    }
+    return expired;
+}
+
+} // namespace phm
+} // namespace ara
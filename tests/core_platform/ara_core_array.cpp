@@ -25,6 +25,9 @@
  *              12. Partial initialization
  *              13. Negative scenarios (compile-time & run-time) - commented out by default
  *              14. Two-dimensional (nested) arrays
+ *              15. Trivially-copyable fast paths (swap, fill, comparisons) and constexpr evaluation
+ *              16. InplaceVector (fixed capacity, in-place storage)
+ *              17. Bounds-check policies of at() (target-wide default, per-instantiation override)
  *
  *  \note       All variables are used, preventing compiler warnings about unused variables.
  *********************************************************************************************************************/
@@ -33,6 +36,7 @@
 #include <iostream>         // For std::cout (demonstrations)
 #include <string>           // For std::string
 #include <cassert>          // For runtime checks via assert
+#include <cstdint>          // For std::uint8_t, std::int8_t, std::int32_t
 
 /**********************************************************************************************************************
  *  FORWARD DECLARATIONS
@@ -51,6 +55,25 @@ void TestReverseIterators();           // Test #11
 void TestPartialInitialization();      // Test #12
 void TestNegativeScenarios();          // Test #13 (commented code)
 void TestTwoDimensionalArrays();       // Test #14
+void TestTriviallyCopyableFastPaths(); // Test #15
+void TestInplaceVector();              // Test #16
+void TestBoundsCheckPolicies();        // Test #17
+
+/**********************************************************************************************************************
+ *  BOUNDS-CHECK POLICY OVERRIDES (Test #17)
+ *********************************************************************************************************************/
+/*!
+ * \brief  Per-instantiation policies; they must be visible before the first use of at() on these types.
+ */
+template <>
+struct ara::core::ArrayBoundsCheck<std::uint32_t, 8U> {
+    static constexpr ara::core::BoundsCheckPolicy value{ara::core::BoundsCheckPolicy::kAssumeInRange};
+};
+
+template <>
+struct ara::core::ArrayBoundsCheck<std::uint32_t, 4U> {
+    static constexpr ara::core::BoundsCheckPolicy value{ara::core::BoundsCheckPolicy::kDebugOnly};
+};
 
 /**********************************************************************************************************************
  *  DEMO TYPES FOR TESTING
@@ -200,6 +223,37 @@ struct SafeTestStruct
     }
 };
 
+/*!
+ * \brief  A sample type with a non-trivial destructor to test element lifetimes inside ara::core::InplaceVector
+ *
+ * \details
+ * - liveCount tracks the number of constructed and not yet destroyed objects.
+ */
+class LifetimeTestClass
+{
+public:
+    static std::size_t liveCount;
+
+    explicit LifetimeTestClass(int value) noexcept : value_(value) { ++liveCount; }
+    LifetimeTestClass(const LifetimeTestClass& other) noexcept : value_(other.value_) { ++liveCount; }
+    LifetimeTestClass(LifetimeTestClass&& other) noexcept : value_(other.value_) { other.value_ = -1; ++liveCount; }
+    ~LifetimeTestClass() { --liveCount; }
+
+    LifetimeTestClass& operator=(const LifetimeTestClass& other) noexcept { value_ = other.value_; return *this; }
+    LifetimeTestClass& operator=(LifetimeTestClass&& other) noexcept {
+        value_ = other.value_;
+        other.value_ = -1;
+        return *this;
+    }
+
+    int GetValue() const noexcept { return value_; }
+
+private:
+    int value_;
+};
+
+std::size_t LifetimeTestClass::liveCount = 0U;
+
 /**********************************************************************************************************************
  *  MAIN AND MENU
  *********************************************************************************************************************/
@@ -219,7 +273,10 @@ static void PrintUsage(const char* prog) {
               << " 11  - Reverse Iterators\n"
               << " 12  - Partial Initialization\n"
               << " 13  - Negative Scenarios (commented out)\n"
-              << " 14  - Two-Dimensional Arrays\n";
+              << " 14  - Two-Dimensional Arrays\n"
+              << " 15  - Trivially-Copyable Fast Paths\n"
+              << " 16  - InplaceVector\n"
+              << " 17  - Bounds-Check Policies\n";
 }
 
 int main(int argc, char* argv[])
@@ -244,6 +301,9 @@ int main(int argc, char* argv[])
     else if (choice == "12") TestPartialInitialization();
     else if (choice == "13") TestNegativeScenarios();
     else if (choice == "14") TestTwoDimensionalArrays();
+    else if (choice == "15") TestTriviallyCopyableFastPaths();
+    else if (choice == "16") TestInplaceVector();
+    else if (choice == "17") TestBoundsCheckPolicies();
     else {
         std::cout << "Invalid test number: " << choice << "\n";
         PrintUsage(argv[0]);
@@ -1030,3 +1090,224 @@ void TestTwoDimensionalArrays()
         assert(strMatrix[0][1] == "Universe");
     #endif
 }
+
+/*!
+ * \brief Test #15: Trivially-copyable fast paths (block swap/fill/compare) and constexpr correctness
+ */
+void TestTriviallyCopyableFastPaths()
+{
+    std::cout << "\n=== Test 15: Trivially-Copyable Fast Paths ===\n";
+
+    // Compile-time evaluation must keep using the generic element-wise path
+    using Byte = std::uint8_t;
+    constexpr ara::core::Array<Byte,4> kLow  = {Byte{1}, Byte{2}, Byte{3}, Byte{4}};
+    constexpr ara::core::Array<Byte,4> kHigh = {Byte{1}, Byte{2}, Byte{3}, Byte{5}};
+    static_assert(kLow == kLow,  "constexpr operator== must be usable in constant evaluation");
+    static_assert(kLow != kHigh, "constexpr operator!= must be usable in constant evaluation");
+    static_assert(kLow < kHigh,  "constexpr operator< must be usable in constant evaluation");
+
+    // Large byte payloads => memcmp / memset / chunked memcpy swap
+    ara::core::Array<std::uint8_t,4096> payloadA{};
+    ara::core::Array<std::uint8_t,4096> payloadB{};
+    payloadA.fill(0xAB);
+    payloadB.fill(0xAB);
+    std::size_t filled = 0;
+    for (auto b : payloadA) {
+        filled += (b == 0xAB) ? 1U : 0U;
+    }
+    std::cout << "payloadA bytes equal to 0xAB after fill => " << filled << " (expected 4096)\n";
+    assert(filled == payloadA.size());
+    assert(payloadA == payloadB);
+    assert(!(payloadA < payloadB));
+
+    payloadB[4095] = 0xAC;
+    std::cout << "payloadA < payloadB (last byte differs) => " << (payloadA < payloadB) << " (expected true)\n";
+    assert(payloadA != payloadB);
+    assert(payloadA < payloadB);
+    assert(payloadB > payloadA);
+
+    // Swap must cover the full-chunk part and the tail
+    payloadA[0]    = 0x01;
+    payloadA[300]  = 0x02;
+    payloadA.swap(payloadB);
+    assert(payloadB[0] == 0x01 && payloadB[300] == 0x02 && payloadB[4095] == 0xAB);
+    assert(payloadA[0] == 0xAB && payloadA[300] == 0xAB && payloadA[4095] == 0xAC);
+
+    // Signed bytes must keep signed ordering (no memcmp ordering for signed types)
+    using SignedByte = std::int8_t;
+    ara::core::Array<SignedByte,2> negative = {SignedByte{-1}, SignedByte{0}};
+    ara::core::Array<SignedByte,2> positive = {SignedByte{1},  SignedByte{0}};
+    std::cout << "{-1,0} < {1,0} (int8_t) => " << (negative < positive) << " (expected true)\n";
+    assert(negative < positive);
+    assert(negative != positive);
+
+    // Wider integral types use memcmp for equality and element-wise ordering
+    ara::core::Array<std::int32_t,5> ints1 = {256, 1, 2, 3, 4};
+    ara::core::Array<std::int32_t,5> ints2 = {1, 2, 3, 4, 5};
+    assert(ints2 < ints1);   // 1 < 256 although the first byte of 256 is 0x00 on little endian
+    ints2 = ints1;
+    assert(ints1 == ints2);
+
+    // Nested arrays of bytes are bitwise-comparable as a whole
+    ara::core::Array<ara::core::Array<std::uint8_t,3>,2> nested1 = {
+        ara::core::Array<Byte,3>{Byte{1}, Byte{2}, Byte{3}},
+        ara::core::Array<Byte,3>{Byte{4}, Byte{5}, Byte{6}}
+    };
+    auto nested2 = nested1;
+    assert(nested1 == nested2);
+    nested2[1][2] = 7;
+    assert(nested1 != nested2);
+    assert(nested1 < nested2);
+
+    // Non-trivial types stay on the generic path
+    ara::core::Array<SafeTestClass,2> objs1 = { SafeTestClass(1), SafeTestClass(2) };
+    ara::core::Array<SafeTestClass,2> objs2 = { SafeTestClass(3), SafeTestClass(4) };
+    objs1.swap(objs2);
+    assert(objs1[0].GetValue() == 3 && objs2[1].GetValue() == 2);
+
+    std::cout << "All fast-path checks passed.\n";
+}
+
+/*!
+ * \brief Test #16: InplaceVector (fixed capacity, uninitialized in-place storage)
+ */
+void TestInplaceVector()
+{
+    std::cout << "\n=== Test 16: InplaceVector ===\n";
+
+    // Observers are usable in constant evaluation; trivially copyable T keeps the vector trivially destructible
+    using Byte = std::uint8_t;
+    constexpr ara::core::InplaceVector<Byte,8> kEmpty{};
+    static_assert(kEmpty.empty() && kEmpty.size() == 0U, "constexpr observers must be usable in constant evaluation");
+    static_assert(ara::core::InplaceVector<Byte,8>::capacity() == 8U, "capacity() must equal N");
+    static_assert(std::is_trivially_destructible_v<ara::core::InplaceVector<Byte,8>>,
+                  "InplaceVector of a trivially destructible T must be trivially destructible");
+    static_assert(!std::is_trivially_destructible_v<ara::core::InplaceVector<LifetimeTestClass,2>>,
+                  "InplaceVector of a non-trivial T must destroy its elements");
+    static_assert(ara::core::InplaceVector<Byte,0>::capacity() == 0U, "zero capacity must be supported");
+
+    // Trivially copyable elements: push, insert, erase, compare, memcpy copy
+    ara::core::InplaceVector<std::int32_t,8> ints = {1, 2, 4};
+    ints.push_back(5);
+    ints.insert(ints.begin() + 2, 3);
+    std::cout << "ints after insert => ";
+    for (auto v : ints) {
+        std::cout << v << " ";
+    }
+    std::cout << "(expected 1 2 3 4 5)\n";
+    assert(ints.size() == 5U && ints[2] == 3 && ints.back() == 5);
+
+    ints.insert(ints.begin(), 2U, 0);
+    assert(ints.size() == 7U && ints.front() == 0 && ints[2] == 1);
+    ints.erase(ints.begin(), ints.begin() + 2);
+    assert(ints.size() == 5U && ints.front() == 1);
+
+    auto intsCopy = ints;
+    assert(intsCopy == ints);
+    intsCopy.pop_back();
+    assert(intsCopy != ints && intsCopy < ints);
+
+    ints.resize(8U, 9);
+    std::cout << "ints.full() after resize(8) => " << ints.full() << " (expected true)\n";
+    assert(ints.full() && ints[7] == 9);
+
+    // try_push_back reports a full vector without a violation
+    std::int32_t* rejected = ints.try_push_back(10);
+    std::cout << "try_push_back on full vector => " << (rejected == nullptr ? "nullptr" : "element")
+              << " (expected nullptr)\n";
+    assert(rejected == nullptr);
+
+    ints.clear();
+    assert(ints.empty());
+    std::int32_t* accepted = ints.try_emplace_back(42);
+    std::cout << "try_emplace_back on empty vector => " << *accepted << " (expected 42)\n";
+    assert(accepted != nullptr && *accepted == 42 && ints.size() == 1U);
+
+    // Non-trivial elements are constructed and destroyed one by one
+    {
+        using Obj = LifetimeTestClass;
+        ara::core::InplaceVector<Obj,4> objs;
+        objs.emplace_back(2);
+        objs.emplace(objs.begin(), 1);
+        objs.push_back(Obj(4));
+        objs.insert(objs.begin() + 2, Obj(3));
+        assert(objs.full());
+        std::cout << "objs => " << objs[0].GetValue() << " " << objs[1].GetValue() << " " << objs[2].GetValue()
+                  << " " << objs[3].GetValue() << " (expected 1 2 3 4), live = " << Obj::liveCount << "\n";
+        assert(objs[0].GetValue() == 1 && objs[2].GetValue() == 3 && objs[3].GetValue() == 4);
+        assert(Obj::liveCount == 4U);
+
+        ara::core::InplaceVector<Obj,4> moved(std::move(objs));
+        assert(moved.size() == 4U && moved.at(1).GetValue() == 2);
+
+        ara::core::InplaceVector<Obj,4> other = {Obj(9)};
+        moved.swap(other);
+        assert(moved.size() == 1U && moved[0].GetValue() == 9);
+        assert(other.size() == 4U && other[3].GetValue() == 4);
+
+        other.erase(other.begin() + 1);
+        assert(other.size() == 3U && other[1].GetValue() == 3);
+        other.resize(1U, Obj(0));
+        assert(other.size() == 1U && other.front().GetValue() == 1);
+        assert(Obj::liveCount == 6U);   // objs (4 moved-from) + moved (1) + other (1)
+    }
+    std::cout << "LifetimeTestClass live objects after scope => " << LifetimeTestClass::liveCount
+              << " (expected 0)\n";
+    assert(LifetimeTestClass::liveCount == 0U);
+
+    // User-defined class keeps its copy/move semantics
+    ara::core::InplaceVector<SafeTestClass,3> objs(2U, SafeTestClass(7));
+    objs.assign({SafeTestClass(1), SafeTestClass(2), SafeTestClass(3)});
+    assert(objs.size() == 3U && objs.back().GetValue() == 3);
+
+    std::cout << "All InplaceVector checks passed.\n";
+
+    // Exceeding the capacity => CapacityExceededViolation (commented out: terminates the process)
+    // ints.resize(9U);
+}
+
+/*!
+ * \brief Test #17: Bounds-check policies of at()
+ */
+void TestBoundsCheckPolicies()
+{
+    std::cout << "\n=== Test 17: Bounds-Check Policies ===\n";
+    using ara::core::ArrayBoundsCheck;
+    using ara::core::BoundsCheckPolicy;
+
+    static_assert(ArrayBoundsCheck<int, 3U>::value == BoundsCheckPolicy::ARA_CORE_ARRAY_BOUNDS_CHECK_POLICY,
+                  "Instantiations without a specialization use the target-wide default");
+    static_assert(ArrayBoundsCheck<std::uint32_t, 8U>::value == BoundsCheckPolicy::kAssumeInRange,
+                  "Per-instantiation override");
+    static_assert(ArrayBoundsCheck<std::uint32_t, 4U>::value == BoundsCheckPolicy::kDebugOnly,
+                  "Per-instantiation override");
+    std::cout << "Default policy = " << static_cast<int>(ArrayBoundsCheck<int, 3U>::value)
+              << " (0 = always, 1 = debug-only, 2 = assume-in-range)\n";
+
+    // In-range accesses behave identically under every policy
+    ara::core::Array<std::uint32_t, 8U> assumed{1U, 2U, 3U, 4U, 5U, 6U, 7U, 8U};
+    ara::core::Array<std::uint32_t, 4U> debugOnly{10U, 20U, 30U, 40U};
+    ara::core::Array<int, 3U> always{100, 200, 300};
+    unsigned int assumedSum = 0U;
+    unsigned int debugSum = 0U;
+    int alwaysSum = 0;
+    for (std::size_t i = 0U; i < assumed.size(); ++i) {
+        assumedSum += assumed.at(i);
+    }
+    for (std::size_t i = 0U; i < debugOnly.size(); ++i) {
+        debugSum += debugOnly.at(i);
+    }
+    for (std::size_t i = 0U; i < always.size(); ++i) {
+        alwaysSum += always.at(i);
+    }
+    assumed.at(7U) = 80U;
+    assert((assumedSum == 36U) && (debugSum == 100U) && (alwaysSum == 600) && (assumed[7] == 80U));
+    std::cout << "Sums via at(): assume-in-range = " << assumedSum << ", debug-only = " << debugSum
+              << ", always = " << alwaysSum << " (expected 36, 100, 600); write through at() = " << assumed[7]
+              << " (expected 80)\n";
+
+    // at() stays usable in constant expressions under every policy
+    constexpr ara::core::Array<std::uint32_t, 8U> kTable{11U, 12U, 13U, 14U, 15U, 16U, 17U, 18U};
+    static_assert(kTable.at(7U) == 18U, "constexpr at() with kAssumeInRange");
+    std::cout << "constexpr kTable.at(7) = " << kTable.at(7U) << " (expected 18)\n";
+}
@@ -0,0 +1,197 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara_core_fixed_string.cpp
+ *  \brief      Test application for ara::core::BasicFixedString and ToFixedString.
+ *
+ *  \details    This file contains multiple test functions covering:
+ *              1.  Construction, observers and null termination
+ *              2.  constexpr concatenation of fixed strings and string literals
+ *              3.  ToFixedString for signed / unsigned integers (limits included), at compile and run time
+ *              4.  Run-time append with truncation, assign() and clear()
+ *              5.  Comparisons and StringView conversion
+ *
+ *  \note       All variables are used, preventing compiler warnings about unused variables.
+ *********************************************************************************************************************/
+
+#include "ara/core/fixed_string.h"  // The fixed string implementation header
+#include <iostream>                 // For std::cout (demonstrations)
+#include <string>                   // For std::string (menu only)
+#include <cassert>                  // For runtime checks via assert
+#include <cstdint>                  // For std::int8_t, std::int64_t, std::uint64_t
+#include <cstring>                  // For std::strlen
+#include <limits>                   // For std::numeric_limits
+#include <type_traits>              // For std::is_same_v, std::is_trivially_copyable_v
+
+using ara::core::BasicFixedString;
+using ara::core::StringView;
+using ara::core::ToFixedString;
+
+/**********************************************************************************************************************
+ *  FORWARD DECLARATIONS
+ *********************************************************************************************************************/
+void TestConstruction();      // Test #1
+void TestConcatenation();     // Test #2
+void TestIntegerFormatting(); // Test #3
+void TestTruncation();        // Test #4
+void TestComparison();        // Test #5
+
+/**********************************************************************************************************************
+ *  MAIN AND MENU
+ *********************************************************************************************************************/
+static void PrintUsage(const char* prog) {
+    std::cout << "Usage: " << prog << " [test_number]\n"
+              << "List of Available Tests:\n"
+              << "  1  - Construction and Observers\n"
+              << "  2  - constexpr Concatenation\n"
+              << "  3  - Integer Formatting (ToFixedString)\n"
+              << "  4  - Run-Time Append and Truncation\n"
+              << "  5  - Comparisons and StringView\n";
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc != 2) {
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    std::string choice = argv[1];
+    if      (choice == "1")  TestConstruction();
+    else if (choice == "2")  TestConcatenation();
+    else if (choice == "3")  TestIntegerFormatting();
+    else if (choice == "4")  TestTruncation();
+    else if (choice == "5")  TestComparison();
+    else {
+        std::cout << "Invalid test number.\n";
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    return 0;
+}
+
+/**********************************************************************************************************************
+ *  TEST IMPLEMENTATIONS
+ *********************************************************************************************************************/
+/*!
+ * \brief Test #1: Construction, observers and null termination
+ */
+void TestConstruction()
+{
+    std::cout << "\n=== Test 1: Construction and Observers ===\n";
+    static_assert(std::is_trivially_copyable_v<BasicFixedString<16U>>);
+    static_assert(BasicFixedString<16U>::capacity() == 16U);
+
+    constexpr BasicFixedString<16U> kEmpty{};
+    constexpr BasicFixedString<16U> kTag{"demo mngr"};
+    constexpr BasicFixedString kDeduced{"ara"};
+    static_assert(std::is_same_v<decltype(kDeduced), const BasicFixedString<3U>>);
+    static_assert(kEmpty.empty() && (kTag.size() == 9U) && (kTag[0] == 'd') && (kDeduced.size() == 3U));
+
+    BasicFixedString<8U> runtime{StringView("exec")};
+    runtime.push_back('M');
+
+    assert(std::strlen(kTag.c_str()) == 9U);
+    assert((runtime.size() == 5U) && (runtime.view() == "execM") && !runtime.truncated());
+    std::cout << "Tag = \"" << kTag.c_str() << "\" (" << kTag.size() << "), deduced capacity = "
+              << kDeduced.capacity() << ", runtime = \"" << runtime.c_str() << "\""
+              << " (expected \"demo mngr\" (9), 3, \"execM\")\n";
+}
+
+/*!
+ * \brief Test #2: constexpr concatenation of fixed strings and string literals
+ */
+void TestConcatenation()
+{
+    std::cout << "\n=== Test 2: constexpr Concatenation ===\n";
+    constexpr BasicFixedString kComponent{"ara"};
+    constexpr BasicFixedString kModule{"core"};
+    constexpr auto kName = kComponent + "::" + kModule;
+    constexpr auto kPrefixed = "[" + kName + "]";
+
+    static_assert(std::is_same_v<decltype(kName), const BasicFixedString<9U>>);
+    static_assert(kName == StringView("ara::core"));
+    static_assert(kPrefixed == StringView("[ara::core]"));
+    static_assert(!kPrefixed.truncated());
+
+    std::cout << "Name = \"" << kName.c_str() << "\", prefixed = \"" << kPrefixed.c_str() << "\", capacity = "
+              << kPrefixed.capacity() << " (expected \"ara::core\", \"[ara::core]\", 11)\n";
+}
+
+/*!
+ * \brief Test #3: ToFixedString for signed / unsigned integers, at compile and run time
+ */
+void TestIntegerFormatting()
+{
+    std::cout << "\n=== Test 3: Integer Formatting ===\n";
+    static_assert(ToFixedString(0U) == StringView("0"));
+    static_assert(ToFixedString(-42) == StringView("-42"));
+    static_assert(ToFixedString(std::numeric_limits<std::int8_t>::min()) == StringView("-128"));
+    static_assert(ToFixedString(std::numeric_limits<std::int64_t>::min()) == StringView("-9223372036854775808"));
+    static_assert(ToFixedString(std::numeric_limits<std::uint64_t>::max()) == StringView("18446744073709551615"));
+    static_assert(decltype(ToFixedString(std::uint64_t{0U}))::capacity() == 20U);
+
+    constexpr auto kMessage = BasicFixedString{"cycle "} + ToFixedString(250U) + " ms";
+    static_assert(kMessage == StringView("cycle 250 ms"));
+
+    volatile std::int32_t input = -2147483647 - 1;
+    auto const runtime = ToFixedString(static_cast<std::int32_t>(input));
+    assert(runtime == StringView("-2147483648"));
+    std::cout << "Message = \"" << kMessage.c_str() << "\", INT32_MIN = " << runtime.c_str()
+              << " (expected \"cycle 250 ms\", -2147483648)\n";
+}
+
+/*!
+ * \brief Test #4: Run-time append with truncation, assign() and clear()
+ */
+void TestTruncation()
+{
+    std::cout << "\n=== Test 4: Run-Time Append and Truncation ===\n";
+    BasicFixedString<8U> text{};
+    text.append("abc").append(ToFixedString(12345U));
+    bool const fullFits = !text.truncated() && (text.size() == 8U);
+
+    text += "xyz";
+    bool const dropped = text.truncated() && (text.view() == "abc12345") && (text.c_str()[8] == '\0');
+
+    text.assign("new");
+    bool const reset = !text.truncated() && (text.view() == "new");
+
+    text.clear();
+    bool const cleared = text.empty() && (text.c_str()[0] == '\0');
+
+    assert(fullFits && dropped && reset && cleared);
+    std::cout << "Fits = " << fullFits << ", truncated keeps \"abc12345\" = " << dropped << ", assign resets = "
+              << reset << ", clear = " << cleared << " (expected 1, 1, 1, 1)\n";
+}
+
+/*!
+ * \brief Test #5: Comparisons and StringView conversion
+ */
+void TestComparison()
+{
+    std::cout << "\n=== Test 5: Comparisons and StringView ===\n";
+    BasicFixedString<16U> const lhs{"ProcessA"};
+    BasicFixedString<32U> const rhs{"ProcessA"};
+    BasicFixedString<16U> const other{"ProcessB"};
+
+    // Different capacities compare by content
+    bool const equal = (lhs == rhs);
+    bool const notEqual = (lhs != other);
+    bool const withView = (lhs == StringView("ProcessA")) && (StringView("ProcessB") == other);
+
+    // Implicit conversion for APIs taking a StringView
+    StringView const view = lhs;
+    bool const prefix = (view.substr(0U, 7U) == "Process");
+
+    assert(equal && notEqual && withView && prefix);
+    std::cout << "Equal across capacities = " << equal << ", not equal = " << notEqual << ", with StringView = "
+              << withView << ", view prefix = " << prefix << " (expected 1, 1, 1, 1)\n";
+}
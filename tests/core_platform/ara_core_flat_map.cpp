@@ -0,0 +1,175 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara_core_flat_map.cpp
+ *  \brief      Test application for the ara::core::FlatMap sorted fixed-capacity map.
+ *
+ *  \details    This file contains multiple test functions covering:
+ *              1.  constexpr tables: sorted at compile time, lookups in constant expressions
+ *              2.  Insert / InsertOrAssign / Erase against std::map over a pseudo-random operation sequence
+ *              3.  Custom ordering, key and value spans, at()
+ *
+ *  \note       All variables are used, preventing compiler warnings about unused variables.
+ *********************************************************************************************************************/
+
+#include "ara/core/flat_map.h"  // The map under test
+#include "ara/core/fixed_string.h"  // For ara::core::BasicFixedString values
+#include <iostream>         // For std::cout (demonstrations)
+#include <string>           // For std::string
+#include <cassert>          // For runtime checks via assert
+#include <cstdint>          // For std::uint16_t, std::uint32_t
+#include <functional>       // For std::greater
+#include <map>              // For std::map (reference)
+
+using ara::core::FlatMap;
+using ara::core::MakeFlatMap;
+
+/**********************************************************************************************************************
+ *  FORWARD DECLARATIONS
+ *********************************************************************************************************************/
+void TestConstexprTable();      // Test #1
+void TestAgainstStdMap();       // Test #2
+void TestOrderingAndSpans();    // Test #3
+
+/**********************************************************************************************************************
+ *  MAIN AND MENU
+ *********************************************************************************************************************/
+static void PrintUsage(const char* prog) {
+    std::cout << "Usage: " << prog << " [test_number]\n"
+              << "List of Available Tests:\n"
+              << "  1  - constexpr Tables\n"
+              << "  2  - Modifiers against std::map\n"
+              << "  3  - Ordering, Spans and at()\n";
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc != 2) {
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    std::string choice = argv[1];
+    if      (choice == "1")  TestConstexprTable();
+    else if (choice == "2")  TestAgainstStdMap();
+    else if (choice == "3")  TestOrderingAndSpans();
+    else {
+        std::cout << "Invalid test number: " << choice << "\n";
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    return 0;
+}
+
+/**********************************************************************************************************************
+ *  TEST DEFINITIONS
+ *********************************************************************************************************************/
+
+/*!
+ * \brief Test #1: constexpr tables: sorted at compile time, lookups in constant expressions
+ */
+void TestConstexprTable()
+{
+    std::cout << "\n=== Test 1: constexpr Tables ===\n";
+    // Service ID -> instance ID, listed out of order
+    constexpr auto kInstances = MakeFlatMap<std::uint16_t, std::uint16_t>(
+        {{0x1234U, 1U}, {0x0042U, 2U}, {0x7F00U, 3U}, {0x0100U, 4U}, {0x1000U, 5U}});
+    static_assert((kInstances.size() == 5U) && (decltype(kInstances)::capacity() == 5U));
+    static_assert((kInstances.GetKeys()[0] == 0x0042U) && (kInstances.GetKeys()[4] == 0x7F00U));
+    static_assert((*kInstances.Find(0x1234U) == 1U) && (kInstances.Find(0x1235U) == nullptr));
+    static_assert(kInstances.Contains(0x0100U) && !kInstances.Contains(0U) && !kInstances.Contains(0xFFFFU));
+    static_assert((kInstances.LowerBound(0x0043U) == 1U) && (kInstances.LowerBound(0xFFFFU) == 5U));
+
+    constexpr FlatMap<int, char, 8U> kSpare{{3, 'c'}, {1, 'a'}, {2, 'b'}};
+    static_assert((kSpare.size() == 3U) && (kSpare.at(2) == 'b'));
+
+    // The same lookups at run time
+    volatile std::uint16_t probe = 0x1000U;
+    const std::uint16_t* instance = kInstances.Find(static_cast<std::uint16_t>(probe));
+    bool const found = (instance != nullptr) && (*instance == 5U);
+
+    std::cout << "instance of service 0x1000 = " << (found ? *instance : 0U) << "\n";
+    assert(found);
+    std::cout << "[SUCCESS] constexpr FlatMaps are built and searched at compile time.\n";
+}
+
+/*!
+ * \brief Test #2: Insert / InsertOrAssign / Erase against std::map over a pseudo-random operation sequence
+ */
+void TestAgainstStdMap()
+{
+    std::cout << "\n=== Test 2: Modifiers against std::map ===\n";
+    static FlatMap<std::uint32_t, std::uint32_t, 64U> map{};
+    std::map<std::uint32_t, std::uint32_t> reference{};
+
+    std::uint32_t state = 12345U;
+    bool agrees = true;
+    for (std::uint32_t step = 0U; step < 20000U; ++step) {
+        state = (state * 1664525U) + 1013904223U;
+        std::uint32_t const key = (state >> 16U) % 97U;
+        std::uint32_t const operation = (state >> 8U) % 3U;
+        if ((operation == 0U) && (reference.size() < 64U)) {
+            bool const inserted = map.Insert(key, step);
+            agrees = agrees && (inserted == reference.emplace(key, step).second);
+        } else if ((operation == 1U) && ((reference.size() < 64U) || (reference.count(key) != 0U))) {
+            bool const inserted = map.InsertOrAssign(key, step);
+            agrees = agrees && (inserted == reference.insert_or_assign(key, step).second);
+        } else {
+            agrees = agrees && (map.Erase(key) == (reference.erase(key) == 1U));
+        }
+    }
+
+    // Same size, same keys in the same order, same values
+    agrees = agrees && (map.size() == reference.size());
+    std::size_t index = 0U;
+    for (const auto& entry : reference) {
+        agrees = agrees && (map.GetKeys()[index] == entry.first) && (map.GetValues()[index] == entry.second) &&
+                 (*map.Find(entry.first) == entry.second);
+        ++index;
+    }
+    for (std::uint32_t key = 0U; key < 100U; ++key) {
+        agrees = agrees && (map.Contains(key) == (reference.count(key) == 1U));
+    }
+
+    map.clear();
+    assert(map.empty() && (map.Find(0U) == nullptr));
+
+    std::cout << "entries after 20000 operations: " << reference.size() << "\n";
+    assert(agrees);
+    std::cout << "[SUCCESS] FlatMap matches std::map.\n";
+}
+
+/*!
+ * \brief Test #3: Custom ordering, key and value spans, at()
+ */
+void TestOrderingAndSpans()
+{
+    std::cout << "\n=== Test 3: Ordering, Spans and at() ===\n";
+    using Name = ara::core::BasicFixedString<15U>;
+    FlatMap<int, Name, 4U, std::greater<int>> map{{1, Name{"one"}}, {3, Name{"three"}}, {2, Name{"two"}}};
+
+    assert((map.GetKeys()[0] == 3) && (map.GetKeys()[2] == 1) && (map.LowerBound(2) == 1U));
+
+    // Values are mutable through at(), Find() and the value span
+    map.at(2) += "!";
+    *map.Find(1) = Name{"uno"};
+    map.GetValues()[0] = Name{"tres"};
+    assert((map.at(1) == "uno") && (map.at(2) == "two!") && (map.at(3) == "tres"));
+
+    [[maybe_unused]] bool const fits = map.Insert(4, Name{"four"}) && !map.Insert(4, Name{"again"});
+    assert(fits && (map.size() == map.capacity()));
+
+    std::cout << "keys:";
+    for (int const key : map.GetKeys()) {
+        std::cout << " " << key << "=" << map.at(key).c_str();
+    }
+    std::cout << "\n";
+    std::cout << "[SUCCESS] Custom ordering and spans work.\n";
+}
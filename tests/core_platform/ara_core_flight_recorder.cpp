@@ -0,0 +1,393 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara_core_flight_recorder.cpp
+ *  \brief      Test application for ara::core::FlightRecorder.
+ *
+ *  \details    This file contains multiple test functions covering:
+ *              1.  Record() and DumpTo(): header, ring and record lines with tags and arguments
+ *              2.  Ring wrap-around: the newest kRecordCapacity records survive, oldest first, ages decreasing
+ *              3.  Rings per thread: running and exited threads, overflow ring, reuse of exited rings
+ *              4.  Violation in a forked child: dump file written before the abort, violation recorded last
+ *              5.  Crash handler in a forked child (SIGSEGV) and DumpOnce() writing a single dump
+ *
+ *  \note       All variables are used, preventing compiler warnings about unused variables.
+ *********************************************************************************************************************/
+
+#include "ara/core/flight_recorder.h"                // The class under test
+#include "ara/core/internal/violation_handler.h"     // For ReportInvalidState, ViolationKind
+#include <atomic>           // For std::atomic
+#include <iostream>         // For std::cout (demonstrations)
+#include <sstream>          // For std::istringstream
+#include <string>           // For std::string
+#include <thread>           // For std::thread
+#include <vector>           // For std::vector
+#include <cassert>          // For runtime checks via assert
+#include <csignal>          // For SIGSEGV, SIGABRT, raise
+#include <cstdint>          // For std::uint64_t
+#include <cstdio>           // For std::tmpfile, std::fclose, fileno
+#include <fcntl.h>          // For open
+#include <sys/wait.h>       // For waitpid
+#include <unistd.h>         // For fork, _exit, read, lseek, getpid
+
+using ara::core::FlightRecorder;
+using ara::core::FlightRecorderConfig;
+using ara::core::FlightRecorderErrorCode;
+using ara::core::internal::ViolationKind;
+
+/**********************************************************************************************************************
+ *  FORWARD DECLARATIONS
+ *********************************************************************************************************************/
+void TestRecordAndDump();       // Test #1
+void TestWrapAround();          // Test #2
+void TestThreadRings();         // Test #3
+void TestViolationDump();       // Test #4
+void TestCrashHandler();        // Test #5
+
+/**********************************************************************************************************************
+ *  HELPERS
+ *********************************************************************************************************************/
+/*!
+ * \brief  Reads the whole file \c fd from its start.
+ */
+static auto ReadAll(int fd) -> std::string
+{
+    std::string content{};
+    static_cast<void>(::lseek(fd, 0, SEEK_SET));
+    char buffer[4096];
+    ssize_t count{0};
+    while ((count = ::read(fd, buffer, sizeof(buffer))) > 0) {
+        content.append(buffer, static_cast<std::size_t>(count));
+    }
+    return content;
+}
+
+/*!
+ * \brief  Dumps all rings into a temporary file and returns its content; \c records receives the return value.
+ */
+static auto DumpToString(std::size_t& records) -> std::string
+{
+    std::FILE* const file = std::tmpfile();
+    assert(file != nullptr);
+    records = FlightRecorder::DumpTo(::fileno(file));
+    std::string content = ReadAll(::fileno(file));
+    static_cast<void>(std::fclose(file));
+    return content;
+}
+
+/*!
+ * \brief  Counts the occurrences of \c needle in \c text.
+ */
+static auto Count(const std::string& text, const std::string& needle) -> std::size_t
+{
+    std::size_t count{0U};
+    for (std::size_t at = text.find(needle); at != std::string::npos; at = text.find(needle, at + needle.size())) {
+        ++count;
+    }
+    return count;
+}
+
+/*!
+ * \brief  A parsed record line: "[App flr]:   -<age> <tag> <arg0> <arg1>" (the tag must not contain spaces).
+ */
+struct RecordLine {
+    std::uint64_t age{0U};
+    std::string   tag{};
+    std::uint64_t arg0{0U};
+    std::uint64_t arg1{0U};
+};
+
+/*!
+ * \brief  Parses the record lines of \c dump whose tag is \c tag.
+ */
+static auto RecordsTagged(const std::string& dump, const std::string& tag) -> std::vector<RecordLine>
+{
+    std::vector<RecordLine> records{};
+    std::istringstream lines{dump};
+    std::string line{};
+    std::string const prefix{"[App flr]:   -"};
+    while (std::getline(lines, line)) {
+        if (line.compare(0U, prefix.size(), prefix) != 0) {
+            continue;
+        }
+        std::istringstream fields{line.substr(prefix.size())};
+        RecordLine record{};
+        if ((fields >> record.age >> record.tag >> record.arg0 >> record.arg1) && (record.tag == tag)) {
+            records.push_back(record);
+        }
+    }
+    return records;
+}
+
+/*!
+ * \brief  Forks a child running \c body (which must not return normally) and returns its wait status.
+ */
+template <typename Body>
+static auto RunChild(Body body) -> int
+{
+    pid_t const pid = ::fork();
+    assert(pid >= 0);
+    if (pid == 0) {
+        body();
+        ::_exit(0);
+    }
+    int status{0};
+    static_cast<void>(::waitpid(pid, &status, 0));
+    return status;
+}
+
+/*!
+ * \brief  Path of a per-process dump file in /tmp.
+ */
+static auto DumpPath(const char* name) -> std::string
+{
+    return std::string{"/tmp/ara_core_flight_recorder_"} + name + "_" + std::to_string(::getpid()) + ".dump";
+}
+
+/**********************************************************************************************************************
+ *  MAIN AND MENU
+ *********************************************************************************************************************/
+static void PrintUsage(const char* prog) {
+    std::cout << "Usage: " << prog << " [test_number]\n"
+              << "List of Available Tests:\n"
+              << "  1  - Record and Dump\n"
+              << "  2  - Wrap-Around\n"
+              << "  3  - Thread Rings\n"
+              << "  4  - Violation Dump\n"
+              << "  5  - Crash Handler and DumpOnce\n";
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc != 2) {
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    std::string choice = argv[1];
+    if      (choice == "1")  TestRecordAndDump();
+    else if (choice == "2")  TestWrapAround();
+    else if (choice == "3")  TestThreadRings();
+    else if (choice == "4")  TestViolationDump();
+    else if (choice == "5")  TestCrashHandler();
+    else {
+        std::cout << "Invalid test number: " << choice << "\n";
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    return 0;
+}
+
+/**********************************************************************************************************************
+ *  TEST DEFINITIONS
+ *********************************************************************************************************************/
+
+/*!
+ * \brief Test #1: Record() and DumpTo(): header, ring and record lines with tags and arguments
+ */
+void TestRecordAndDump()
+{
+    std::cout << "\n=== Test 1: Record and Dump ===\n";
+    static_assert(noexcept(FlightRecorder::Record("tag")));
+    static_assert(sizeof(ara::core::internal::FlightRecord) == 32U);
+
+    FlightRecorder::Record("first", 1U, 2U);
+    FlightRecorder::Record("second", 3U);
+    FlightRecorder::Record("third", 0xFFFF'FFFF'FFFF'FFFFULL, 5U);
+
+    std::size_t records{0U};
+    std::string const dump = DumpToString(records);
+    std::cout << dump;
+
+    std::vector<RecordLine> const first  = RecordsTagged(dump, "first");
+    std::vector<RecordLine> const second = RecordsTagged(dump, "second");
+    std::vector<RecordLine> const third  = RecordsTagged(dump, "third");
+
+    assert(records == 3U);
+    assert(dump.find("[App flr]: Flight recorder dump: 1 threads") == 0U);
+    assert(dump.find(" (running): 3 of 3 records\n") != std::string::npos);
+    assert((first.size() == 1U) && (first[0].arg0 == 1U) && (first[0].arg1 == 2U));
+    assert((second.size() == 1U) && (second[0].arg0 == 3U) && (second[0].arg1 == 0U));
+    assert((third.size() == 1U) && (third[0].arg0 == 0xFFFF'FFFF'FFFF'FFFFULL));
+    assert((first.size() == 1U) && (third.size() == 1U) && (first[0].age >= third[0].age));
+    assert(FlightRecorder::GetUnassignedRecords() == 0U);
+    std::cout << "[SUCCESS] The dump lists the thread's ring and every record with its arguments.\n";
+}
+
+/*!
+ * \brief Test #2: Ring wrap-around: the newest kRecordCapacity records survive, oldest first, ages decreasing
+ */
+void TestWrapAround()
+{
+    std::cout << "\n=== Test 2: Wrap-Around ===\n";
+    constexpr std::uint64_t kWritten{1000U};
+    for (std::uint64_t index = 0U; index < kWritten; ++index) {
+        FlightRecorder::Record("step", index, index * 2U);
+    }
+
+    std::size_t records{0U};
+    std::string const dump = DumpToString(records);
+    std::vector<RecordLine> const steps = RecordsTagged(dump, "step");
+
+    bool inOrder = (steps.size() == FlightRecorder::kRecordCapacity);
+    for (std::size_t index = 0U; inOrder && (index < steps.size()); ++index) {
+        std::uint64_t const expected = kWritten - FlightRecorder::kRecordCapacity + index;
+        inOrder = (steps[index].arg0 == expected) && (steps[index].arg1 == expected * 2U) &&
+                  ((index == 0U) || (steps[index].age <= steps[index - 1U].age));
+    }
+
+    std::cout << "kept " << steps.size() << " of " << kWritten << " records, first " << steps.front().arg0
+              << ", last " << steps.back().arg0 << ", oldest age " << steps.front().age << " ns\n";
+    assert((records == FlightRecorder::kRecordCapacity) && inOrder);
+    assert(dump.find(" (running): 256 of 1000 records\n") != std::string::npos);
+    std::cout << "[SUCCESS] The ring keeps the newest records in order.\n";
+}
+
+/*!
+ * \brief Test #3: Rings per thread: running and exited threads, overflow ring, reuse of exited rings
+ */
+void TestThreadRings()
+{
+    std::cout << "\n=== Test 3: Thread Rings ===\n";
+    FlightRecorder::Record("main", 0U);
+
+    /* More threads than rings, all alive at the same time: the last ones share the overflow ring */
+    constexpr std::size_t kThreads{FlightRecorder::kMaxThreads + 4U};
+    std::atomic<std::size_t> recorded{0U};
+    std::atomic<bool> release{false};
+    std::vector<std::thread> threads{};
+    for (std::size_t index = 0U; index < kThreads; ++index) {
+        threads.emplace_back([&recorded, &release, index]() {
+            FlightRecorder::Record("worker", index);
+            recorded.fetch_add(1U);
+            while (!release.load()) {
+                std::this_thread::yield();
+            }
+        });
+    }
+    while (recorded.load() < kThreads) {
+        std::this_thread::yield();
+    }
+    std::size_t records{0U};
+    std::string const running = DumpToString(records);
+    release.store(true);
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    std::uint64_t const unassigned = FlightRecorder::GetUnassignedRecords();
+    assert(unassigned == (kThreads - (FlightRecorder::kMaxThreads - 1U)));
+    assert(Count(running, " (running): ") == FlightRecorder::kMaxThreads);
+    assert(RecordsTagged(running, "worker").size() == (FlightRecorder::kMaxThreads - 1U));
+
+    /* The rings of the exited workers are kept, then reused by a new thread */
+    std::string const exited = DumpToString(records);
+    assert(Count(exited, " (exited): 1 of 1 records\n") == (FlightRecorder::kMaxThreads - 1U));
+    std::thread([]() { FlightRecorder::Record("reused", 7U); }).join();
+    std::string const reused = DumpToString(records);
+    assert(RecordsTagged(reused, "reused").size() == 1U);
+    assert(RecordsTagged(reused, "worker").size() == (FlightRecorder::kMaxThreads - 2U));
+    assert(FlightRecorder::GetUnassignedRecords() == unassigned);
+
+    std::cout << "rings " << Count(running, " (running): ") << ", unassigned records " << unassigned
+              << ", exited rings " << Count(exited, " (exited): ") << "\n";
+    std::cout << "[SUCCESS] Each thread records into its own ring; exited rings are kept and reused.\n";
+}
+
+/*!
+ * \brief Test #4: Violation in a forked child: dump file written before the abort, violation recorded last
+ */
+void TestViolationDump()
+{
+    std::cout << "\n=== Test 4: Violation Dump ===\n";
+    std::string const path = DumpPath("violation");
+
+    [[maybe_unused]] int const status = RunChild([&path]() {
+        FlightRecorderConfig config{};
+        config.dumpPath = path.c_str();
+        config.installCrashHandlers = true;
+        if (FlightRecorder::Configure(config) != FlightRecorderErrorCode::Success) {
+            ::_exit(2);
+        }
+        for (std::uint64_t cycle = 0U; cycle < 10U; ++cycle) {
+            FlightRecorder::Record("child_cycle", cycle, 100U + cycle);
+        }
+        ara::core::internal::ReportInvalidState("flight recorder test", "forced violation");
+    });
+
+    int const fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    std::string const dump = (fd >= 0) ? ReadAll(fd) : std::string{};
+    if (fd >= 0) {
+        static_cast<void>(::close(fd));
+    }
+    static_cast<void>(::unlink(path.c_str()));
+    std::cout << dump;
+
+    std::vector<RecordLine> const cycles = RecordsTagged(dump, "child_cycle");
+    std::string const violation =
+        "ara::core violation " + std::to_string(static_cast<int>(ViolationKind::InvalidState)) + " 0\n";
+
+    assert(WIFSIGNALED(status) && (WTERMSIG(status) == SIGABRT));
+    assert((cycles.size() == 10U) && (cycles.back().arg0 == 9U) && (cycles.back().arg1 == 109U));
+    assert(dump.rfind("[App flr]:   -") != std::string::npos);
+    assert(dump.find(violation, dump.rfind("[App flr]:   -")) != std::string::npos);   // The violation is recorded last
+    assert(Count(dump, "Flight recorder dump:") == 1U);
+    std::cout << "[SUCCESS] The violation handler dumps the rings to the dump file (once) before aborting.\n";
+}
+
+/*!
+ * \brief Test #5: Crash handler in a forked child (SIGSEGV) and DumpOnce() writing a single dump
+ */
+void TestCrashHandler()
+{
+    std::cout << "\n=== Test 5: Crash Handler and DumpOnce ===\n";
+    std::string const path = DumpPath("crash");
+
+    int const status = RunChild([&path]() {
+        FlightRecorderConfig config{};
+        config.dumpPath = path.c_str();
+        if (FlightRecorder::Configure(config) != FlightRecorderErrorCode::Success) {
+            ::_exit(2);
+        }
+        FlightRecorder::Record("before_crash", 42U);
+        static_cast<void>(std::raise(SIGSEGV));
+    });
+
+    int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    std::string const crash = (fd >= 0) ? ReadAll(fd) : std::string{};
+    if (fd >= 0) {
+        static_cast<void>(::close(fd));
+    }
+    bool const crashed = WIFSIGNALED(status) && (WTERMSIG(status) == SIGSEGV);
+    assert(RecordsTagged(crash, "before_crash").size() == 1U);
+
+    /* DumpOnce(): the second call leaves the dump file as written by the first */
+    FlightRecorderConfig config{};
+    config.dumpPath = path.c_str();
+    config.installCrashHandlers = false;
+    [[maybe_unused]] FlightRecorderErrorCode const configured = FlightRecorder::Configure(config);
+    FlightRecorder::Record("first_dump", 1U);
+    FlightRecorder::DumpOnce();
+    FlightRecorder::Record("after_dump", 2U);
+    FlightRecorder::DumpOnce();
+    fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    std::string const once = (fd >= 0) ? ReadAll(fd) : std::string{};
+    if (fd >= 0) {
+        static_cast<void>(::close(fd));
+    }
+    static_cast<void>(::unlink(path.c_str()));
+    assert(RecordsTagged(once, "first_dump").size() == 1U);
+    assert(RecordsTagged(once, "after_dump").empty() && (Count(once, "Flight recorder dump:") == 1U));
+
+    std::cout << "child " << (crashed ? "killed by SIGSEGV" : "not crashed") << ", crash dump of " << crash.size()
+              << " bytes, DumpOnce file of " << once.size() << " bytes\n";
+    assert(crashed && (configured == FlightRecorderErrorCode::Success));
+    std::cout << "[SUCCESS] Critical signals are dumped before their default action; DumpOnce() dumps once.\n";
+}
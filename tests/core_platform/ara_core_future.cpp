@@ -0,0 +1,365 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara_core_future.cpp
+ *  \brief      Test application for ara::core::Future, ara::core::Promise and ara::core::Result.
+ *
+ *  \details    This file contains multiple test functions covering:
+ *              1.  Result<T, E> / Result<void, E>, set_value() from another thread, wait_for() timeout, SetError()
+ *              2.  Broken promise: destroying an unsatisfied Promise completes the Future with an error
+ *              3.  then() chains on the Executor: worker thread, Result propagation, ready and stopped cases
+ *              4.  then() on an EventLoop (loop thread) and unwrapping of a continuation returning a Future
+ *              5.  State pool: capacity specialization, reuse, and concurrent Promise / Future pairs
+ *
+ *  \note       All variables are used, preventing compiler warnings about unused variables.
+ *********************************************************************************************************************/
+
+#include "ara/core/future.h"                    // The Future / Promise under test
+#include "ara/core/result.h"                    // For ara::core::Result
+#include "ara/os/interface/event/event_loop.h"  // For the EventLoop execution context
+#include <iostream>         // For std::cout (demonstrations)
+#include <string>           // For std::string
+#include <cassert>          // For runtime checks via assert
+#include <atomic>           // For std::atomic
+#include <chrono>           // For std::chrono durations
+#include <cstdint>          // For std::uint32_t
+#include <pthread.h>        // For pthread_self, pthread_equal
+#include <thread>           // For std::thread, std::this_thread::sleep_for
+
+using ara::core::Executor;
+using ara::core::ExecutorConfig;
+using ara::core::ExecutorErrorCode;
+using ara::core::Future;
+using ara::core::future_errc;
+using ara::core::future_status;
+using ara::core::Promise;
+using ara::core::Result;
+using ara::os::interface::event::ErrorCode;
+using ara::os::interface::event::Event;
+using ara::os::interface::event::EventLoop;
+
+/*!
+ * \brief  Value type with its own, small state pool (see test #5).
+ */
+struct Sample {
+    std::uint32_t id{0U};
+};
+
+template <>
+struct ara::core::FutureStateCapacity<Sample, future_errc> {
+    static constexpr std::size_t value{4U};
+};
+
+/**********************************************************************************************************************
+ *  FORWARD DECLARATIONS
+ *********************************************************************************************************************/
+void TestBasics();              // Test #1
+void TestBrokenPromise();       // Test #2
+void TestExecutorChain();       // Test #3
+void TestEventLoopAndUnwrap();  // Test #4
+void TestStatePool();           // Test #5
+
+/**********************************************************************************************************************
+ *  HELPERS
+ *********************************************************************************************************************/
+/*!
+ * \brief  Starts Executor::Instance() with \c workers workers and asserts success.
+ */
+static void StartWorkers(std::size_t workers)
+{
+    ExecutorConfig config{};
+    config.workerCount = workers;
+    ExecutorErrorCode const result = Executor::Instance().Start(config);
+    assert(result == ExecutorErrorCode::Success);
+    static_cast<void>(result);
+}
+
+/*!
+ * \brief  Timer handler that never fires in the tests (the EventLoop needs one source to run).
+ */
+static void Ignore(void*, const Event&) noexcept {}
+
+/*!
+ * \brief  Free states of the pool of Future<T, future_errc>.
+ */
+template <typename T>
+static auto Available() noexcept -> std::size_t
+{
+    return ara::core::internal::FutureStatePool<T, future_errc>::Instance().GetAvailable();
+}
+
+/**********************************************************************************************************************
+ *  MAIN AND MENU
+ *********************************************************************************************************************/
+static void PrintUsage(const char* prog) {
+    std::cout << "Usage: " << prog << " [test_number]\n"
+              << "List of Available Tests:\n"
+              << "  1  - Result, set_value / get, wait_for, SetError\n"
+              << "  2  - Broken Promise\n"
+              << "  3  - then() Chains on the Executor\n"
+              << "  4  - then() on an EventLoop and Unwrapping\n"
+              << "  5  - State Pool\n";
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc != 2) {
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    std::string choice = argv[1];
+    if      (choice == "1")  TestBasics();
+    else if (choice == "2")  TestBrokenPromise();
+    else if (choice == "3")  TestExecutorChain();
+    else if (choice == "4")  TestEventLoopAndUnwrap();
+    else if (choice == "5")  TestStatePool();
+    else {
+        std::cout << "Invalid test number: " << choice << "\n";
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    return 0;
+}
+
+/**********************************************************************************************************************
+ *  TEST DEFINITIONS
+ *********************************************************************************************************************/
+
+/*!
+ * \brief Test #1: Result<T, E> / Result<void, E>, set_value() from another thread, wait_for() timeout, SetError()
+ */
+void TestBasics()
+{
+    std::cout << "\n=== Test 1: Result, set_value / get, wait_for, SetError ===\n";
+    Result<int, future_errc> const value{7};
+    Result<int, future_errc> const error{future_errc::no_state};
+    Result<void, future_errc> const done{};
+    assert(value.HasValue() && (*value == 7) && !error && (error.Error() == future_errc::no_state));
+    assert((error.ValueOr(-1) == -1) && done.HasValue());
+    std::cout << "Result value = " << *value << ", error ValueOr = " << error.ValueOr(-1)
+              << ", void success = " << done.HasValue() << " (expected 7, -1, 1)\n";
+
+    Promise<int> promise{};
+    Future<int> future = promise.get_future();
+    future_status const early = future.wait_for(std::chrono::milliseconds{20});
+    assert(!future.is_ready());
+
+    std::thread producer([&promise]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds{20});
+        promise.set_value(42);
+    });
+    int const got = future.get();
+    producer.join();
+    assert((early == future_status::timeout) && (got == 42) && !future.valid());
+    std::cout << "wait_for before set_value = timeout: " << (early == future_status::timeout)
+              << ", get() = " << got << ", valid after get = " << future.valid() << " (expected 1, 42, 0)\n";
+
+    Promise<std::string> failing{};
+    Future<std::string> failed = failing.get_future();
+    failing.SetError(future_errc::no_state);
+    Result<std::string, future_errc> const result = failed.GetResult();
+
+    Promise<void> signal{};
+    Future<void> signalled = signal.get_future();
+    signal.set_value();
+    future_status const status = signalled.wait_for(std::chrono::seconds{0});
+    signalled.get();
+    assert(!result.HasValue() && (result.Error() == future_errc::no_state) && (status == future_status::ready));
+    std::cout << "SetError -> error " << static_cast<int>(result.Error()) << ", void set_value ready = "
+              << (status == future_status::ready) << " (expected 104, 1)\n";
+}
+
+/*!
+ * \brief Test #2: Broken promise: destroying an unsatisfied Promise completes the Future with an error
+ */
+void TestBrokenPromise()
+{
+    std::cout << "\n=== Test 2: Broken Promise ===\n";
+    std::size_t const before = Available<double>();
+    Future<double> orphan{};
+    {
+        Promise<double> promise{};
+        orphan = promise.get_future();
+        assert(Available<double>() == (before - 1U));
+    }
+    bool const ready = orphan.is_ready();
+    Result<double, future_errc> const result = orphan.GetResult();
+    std::size_t const after = Available<double>();
+
+    // A Promise without a Future still returns its state
+    { Promise<double> unused{}; }
+    std::size_t const unusedAfter = Available<double>();
+
+    assert(ready && !result.HasValue() && (result.Error() == future_errc::broken_promise));
+    assert((after == before) && (unusedAfter == before));
+    std::cout << "ready after Promise destroyed = " << ready << ", error = " << static_cast<int>(result.Error())
+              << ", free states " << before << " -> " << after << " -> " << unusedAfter << " (expected 1, 101, "
+              << before << " -> " << before << " -> " << before << ")\n";
+}
+
+/*!
+ * \brief Test #3: then() chains on the Executor: worker thread, Result propagation, ready and stopped cases
+ */
+void TestExecutorChain()
+{
+    std::cout << "\n=== Test 3: then() Chains on the Executor ===\n";
+    Executor& executor = Executor::Instance();
+
+    // Stopped executor: Submit() is refused and the continuation runs inline on the completing thread
+    Promise<int> inlinePromise{};
+    std::atomic<bool> onCaller{false};
+    Future<int> inlineNext = inlinePromise.get_future().then([&executor, &onCaller](Future<int> f) noexcept {
+        onCaller.store(executor.GetCurrentWorkerIndex() == Executor::kMaxWorkers);
+        return f.get() * 2;
+    });
+    inlinePromise.set_value(5);
+    assert(inlineNext.is_ready());
+    [[maybe_unused]] int const inlineValue = inlineNext.get();
+    assert(onCaller.load() && (inlineValue == 10));
+
+    StartWorkers(2U);
+    std::atomic<std::size_t> onWorker{0U};
+    Promise<int> promise{};
+    Future<std::string> chained = promise.get_future()
+        .then([&executor, &onWorker](Future<int> f) noexcept {
+            onWorker += (executor.GetCurrentWorkerIndex() < Executor::kMaxWorkers) ? 1U : 0U;
+            return f.get() + 1;
+        })
+        .then([&executor, &onWorker](Future<int> f) noexcept -> Result<int, future_errc> {
+            onWorker += (executor.GetCurrentWorkerIndex() < Executor::kMaxWorkers) ? 1U : 0U;
+            int const value = f.get();
+            return (value > 0) ? Result<int, future_errc>{value * 10}
+                               : Result<int, future_errc>{future_errc::no_state};
+        })
+        .then([](Future<int> f) noexcept { return std::to_string(f.get()); });
+    promise.set_value(4);
+    std::string const text = chained.get();
+
+    // Continuation registered on an already ready Future, and an error passed through a chain
+    Promise<int> ready{};
+    ready.set_value(1);
+    Future<void> afterReady = ready.get_future().then([](Future<int> f) noexcept { static_cast<void>(f.get()); });
+    afterReady.get();
+
+    Promise<int> failing{};
+    Future<bool> sawError = failing.get_future().then([](Future<int> f) noexcept {
+        Result<int, future_errc> const result = f.GetResult();
+        return !result.HasValue() && (result.Error() == future_errc::no_state);
+    });
+    failing.SetError(future_errc::no_state);
+    bool const errorSeen = sawError.get();
+    executor.Stop();
+
+    assert((text == "50") && (onWorker.load() == 2U) && errorSeen);
+    std::cout << "stopped executor: inline = " << onCaller.load() << ", value = " << inlineValue
+              << "; chain 4 -> +1 -> x10 -> string = \"" << text << "\", on workers = " << onWorker.load()
+              << ", error seen = " << errorSeen << " (expected 1, 10; \"50\", 2, 1)\n";
+}
+
+/*!
+ * \brief Test #4: then() on an EventLoop (loop thread) and unwrapping of a continuation returning a Future
+ */
+void TestEventLoopAndUnwrap()
+{
+    std::cout << "\n=== Test 4: then() on an EventLoop and Unwrapping ===\n";
+    EventLoop loop{};
+    ErrorCode const added = loop.AddTimer(std::chrono::seconds{10}, &Ignore, nullptr);
+    pthread_t const loopThread = ::pthread_self();
+
+    std::atomic<bool> onLoop{false};
+    Promise<int> promise{};
+    Future<int> next = promise.get_future().then(
+        [loopThread, &onLoop](Future<int> f) noexcept {
+            onLoop.store(::pthread_equal(::pthread_self(), loopThread) != 0);
+            return f.get() * 3;
+        },
+        loop);
+
+    // Completed on another thread, the continuation is posted to the loop and runs in RunOnce()
+    std::thread producer([&promise]() { promise.set_value(14); });
+    producer.join();
+    bool const pendingBeforeLoop = !next.is_ready();
+    ErrorCode const once = loop.RunOnce(std::chrono::milliseconds{5000});
+    int const value = next.get();
+
+    // A continuation returning Future<U> yields Future<U> completed by the inner Future
+    Promise<int> inner{};
+    Promise<int> outer{};
+    Future<int> unwrapped = outer.get_future().then(
+        [&inner](Future<int> f) noexcept {
+            static_cast<void>(f.get());
+            return inner.get_future();
+        },
+        loop);
+    outer.set_value(0);
+    ErrorCode const second = loop.RunOnce(std::chrono::milliseconds{5000});
+    bool const waitsForInner = !unwrapped.is_ready();
+    inner.set_value(99);
+    int const innerValue = unwrapped.get();
+    loop.Close();
+
+    assert((added == ErrorCode::Success) && (once == ErrorCode::Success) && (second == ErrorCode::Success));
+    assert(pendingBeforeLoop && onLoop.load() && (value == 42) && waitsForInner && (innerValue == 99));
+    std::cout << "AddTimer/RunOnce x2 = " << static_cast<int>(added) << "/" << static_cast<int>(once)
+              << static_cast<int>(second) << ", pending until the loop ran = " << pendingBeforeLoop
+              << ", on the loop thread = " << onLoop.load() << ", value = " << value
+              << ", unwrapped waits for inner = " << waitsForInner << ", unwrapped value = " << innerValue
+              << " (expected 0/00, 1, 1, 42, 1, 99)\n";
+}
+
+/*!
+ * \brief Test #5: State pool: capacity specialization, reuse, and concurrent Promise / Future pairs
+ */
+void TestStatePool()
+{
+    std::cout << "\n=== Test 5: State Pool ===\n";
+    constexpr std::size_t kCapacity = ara::core::internal::FutureStatePool<Sample, future_errc>::kCapacity;
+    std::size_t const initial = Available<Sample>();
+    {
+        Promise<Sample> promises[kCapacity]{};
+        assert(Available<Sample>() == 0U);
+        for (std::uint32_t i = 0U; i < kCapacity; ++i) {
+            promises[i].set_value(Sample{i});
+        }
+    }
+    std::size_t const afterFull = Available<Sample>();
+
+    // Pairs created and completed by several threads at once, with continuations on the executor
+    StartWorkers(2U);
+    constexpr std::size_t kThreads{4U};
+    constexpr std::uint32_t kRounds{2000U};
+    std::atomic<std::uint32_t> sum{0U};
+    std::thread threads[kThreads];
+    for (std::thread& thread : threads) {
+        thread = std::thread([&sum]() {
+            for (std::uint32_t round = 0U; round < kRounds; ++round) {
+                Promise<Sample> promise{};
+                Future<std::uint32_t> next =
+                    promise.get_future().then([](Future<Sample> f) noexcept { return f.get().id; });
+                promise.set_value(Sample{1U});
+                sum += next.get();
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    Executor::Instance().Stop();
+    std::size_t const afterStress = Available<Sample>();
+    std::size_t const chainedFree = Available<std::uint32_t>();
+
+    assert((kCapacity == 4U) && (initial == kCapacity) && (afterFull == kCapacity));
+    assert((sum.load() == (kThreads * kRounds)) && (afterStress == kCapacity));
+    assert(chainedFree == (ara::core::FutureStateCapacity<std::uint32_t, future_errc>::value));
+    std::cout << "capacity = " << kCapacity << ", free " << initial << " -> 0 -> " << afterFull
+              << ", concurrent sum = " << sum.load() << ", free after = " << afterStress << "/" << chainedFree
+              << " (expected 4, 4 -> 0 -> 4, " << (kThreads * kRounds) << ", 4/64)\n";
+}
@@ -0,0 +1,360 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara_core_huge_page_arena.cpp
+ *  \brief      Test application for ara::core::pmr::HugePageArena.
+ *
+ *  \details    This file contains multiple test functions covering:
+ *              1.  Mapping and allocation: alignment of the region, pre-faulted pages, bump allocation, exhaustion,
+ *                  reset, lifecycle error codes
+ *              2.  Huge pages only: success with free huge pages, HugePagesUnavailable without
+ *              3.  NUMA placement: pages of a node-bound arena on that node, unknown nodes rejected
+ *              4.  Containers: Vector through PolymorphicAllocator, MdArray and InplaceVector through New()
+ *              5.  Initialize(): arenas mapped by Initialize, failures reported as HugePageArenaFailed
+ *
+ *  \note       The runner may have no reserved huge pages; the tests then check the base-page fallback and the
+ *              HugePagesUnavailable path instead.
+ *********************************************************************************************************************/
+
+#include "ara/core/huge_page_arena.h"  // The arena under test
+#include "ara/core/initialization.h"   // For ara::core::Initialize, Deinitialize
+#include "ara/core/md_array.h"         // For ara::core::MdArray
+#include "ara/core/vector.h"           // For ara::core::Vector
+#include <iostream>         // For std::cout (demonstrations)
+#include <string>           // For std::string
+#include <cassert>          // For runtime checks via assert
+#include <cstddef>          // For std::size_t
+#include <cstdint>          // For std::uintptr_t
+#include <cstdio>           // For std::FILE, std::fopen, std::fscanf
+#include <sys/mman.h>       // For mincore
+#include <unistd.h>         // For sysconf
+#if defined(__linux__)
+#include <linux/mempolicy.h>   // For MPOL_F_NODE, MPOL_F_ADDR
+#include <sys/syscall.h>       // For SYS_get_mempolicy
+#endif
+
+using ara::core::InitConfig;
+using ara::core::InitErrorCode;
+using ara::core::pmr::HugePageArena;
+using ara::core::pmr::HugePageArenaConfig;
+using ara::core::pmr::HugePageErrorCode;
+using ara::core::pmr::HugePageSize;
+
+constexpr std::size_t kHugePage = ara::core::pmr::GetHugePageBytes(HugePageSize::Huge2MiB);
+
+/**********************************************************************************************************************
+ *  FORWARD DECLARATIONS
+ *********************************************************************************************************************/
+void TestMapping();             // Test #1
+void TestHugePagesOnly();       // Test #2
+void TestNumaPlacement();       // Test #3
+void TestContainers();          // Test #4
+void TestInitialize();          // Test #5
+
+/**********************************************************************************************************************
+ *  HELPERS
+ *********************************************************************************************************************/
+/*!
+ * \brief  Returns the number of free 2 MiB huge pages of the system (0 if unknown).
+ */
+static auto FreeHugePages() -> std::size_t
+{
+    std::size_t free{0U};
+    std::FILE* const file = std::fopen("/sys/kernel/mm/hugepages/hugepages-2048kB/free_hugepages", "r");
+    if (file != nullptr) {
+        if (std::fscanf(file, "%zu", &free) != 1) {
+            free = 0U;
+        }
+        static_cast<void>(std::fclose(file));
+    }
+    return free;
+}
+
+/*!
+ * \brief  Returns whether every base page of [address, address + bytes) is resident.
+ */
+static auto AllResident(void* address, std::size_t bytes) -> bool
+{
+    std::size_t const page = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+    static unsigned char residency[(64U * 1024U * 1024U) / 4096U];
+    std::size_t const pages = (bytes + page - 1U) / page;
+    if ((pages > sizeof(residency)) || (::mincore(address, bytes, residency) != 0)) {
+        return false;
+    }
+    bool resident{true};
+    for (std::size_t i = 0U; i < pages; ++i) {
+        resident = resident && ((residency[i] & 1U) != 0U);
+    }
+    return resident;
+}
+
+/*!
+ * \brief  Returns the NUMA node of the page at \c address (-1 if the kernel cannot tell).
+ */
+static auto NodeOf(void* address) -> int
+{
+#if defined(__linux__)
+    int node{-1};
+    if (::syscall(SYS_get_mempolicy, &node, nullptr, 0UL, address, MPOL_F_NODE | MPOL_F_ADDR) != 0) {
+        return -1;
+    }
+    return node;
+#else
+    static_cast<void>(address);
+    return -1;
+#endif
+}
+
+/*!
+ * \brief  Configuration of an unbound 2 MiB arena of \c capacity bytes.
+ */
+static auto ArenaConfig(std::size_t capacity) -> HugePageArenaConfig
+{
+    HugePageArenaConfig config{};
+    config.capacity = capacity;
+    return config;
+}
+
+/*!
+ * \brief  Exact comparison that also works for floating-point types without -Wfloat-equal.
+ */
+template <typename T>
+static auto SameValue(T lhs, T rhs) -> bool
+{
+    return !(lhs < rhs) && !(rhs < lhs);
+}
+
+/**********************************************************************************************************************
+ *  MAIN AND MENU
+ *********************************************************************************************************************/
+static void PrintUsage(const char* prog) {
+    std::cout << "Usage: " << prog << " [test_number]\n"
+              << "List of Available Tests:\n"
+              << "  1  - Mapping and Allocation\n"
+              << "  2  - Huge Pages Only\n"
+              << "  3  - NUMA Placement\n"
+              << "  4  - Containers\n"
+              << "  5  - Initialize\n";
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc != 2) {
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    std::string choice = argv[1];
+    if      (choice == "1")  TestMapping();
+    else if (choice == "2")  TestHugePagesOnly();
+    else if (choice == "3")  TestNumaPlacement();
+    else if (choice == "4")  TestContainers();
+    else if (choice == "5")  TestInitialize();
+    else {
+        std::cout << "Invalid test number: " << choice << "\n";
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    return 0;
+}
+
+/**********************************************************************************************************************
+ *  TEST DEFINITIONS
+ *********************************************************************************************************************/
+
+/*!
+ * \brief Test #1: Mapping and allocation: alignment, pre-faulted pages, bump allocation, exhaustion, reset, lifecycle
+ */
+void TestMapping()
+{
+    std::cout << "\n=== Test 1: Mapping and Allocation ===\n";
+    HugePageArena arena{ArenaConfig(3U * 1024U * 1024U)};
+    assert(!arena.IsMapped() && (arena.allocate(64U) == nullptr) && (arena.capacity() == 0U));
+
+    [[maybe_unused]] HugePageErrorCode const mapped = arena.Map();
+    assert(mapped == HugePageErrorCode::Success);
+    std::uintptr_t const base = reinterpret_cast<std::uintptr_t>(arena.GetData());
+    bool const aligned   = ((base % kHugePage) == 0U) && (arena.capacity() == 2U * kHugePage);
+    bool const resident  = AllResident(arena.GetData(), arena.capacity());
+    [[maybe_unused]] HugePageErrorCode const twice = arena.Map();
+    assert(aligned && resident && (twice == HugePageErrorCode::AlreadyMapped));
+
+    // Bump allocation with the requested alignments
+    [[maybe_unused]] void* const first = arena.allocate(100U, 8U);
+    void* const second = arena.allocate(4096U, 4096U);
+    assert((first == arena.GetData()) && ((reinterpret_cast<std::uintptr_t>(second) % 4096U) == 0U));
+    assert(arena.used() == 8192U);
+    [[maybe_unused]] void* const tooLarge   = arena.allocate(arena.capacity(), 8U);
+    [[maybe_unused]] void* const misaligned = arena.allocate(8U, 3U);
+    assert((tooLarge == nullptr) && (misaligned == nullptr));
+    arena.deallocate(second, 4096U, 4096U);
+    assert(arena.used() == 8192U);
+    arena.reset();
+    assert((arena.used() == 0U) && (arena.highWaterMark() == 8192U));
+    [[maybe_unused]] void* const whole = arena.allocate(arena.capacity(), 8U);
+    assert(whole == arena.GetData());
+
+    arena.Unmap();
+    assert(!arena.IsMapped() && (arena.allocate(8U) == nullptr) && (arena.GetPageSize() == 0U));
+    [[maybe_unused]] HugePageErrorCode const remapped = arena.Map();
+    HugePageArena empty{ArenaConfig(0U)};
+    [[maybe_unused]] HugePageErrorCode const zero = empty.Map();
+
+    std::cout << "2 MiB pages: " << arena.IsHugePageBacked() << ", page size " << arena.GetPageSize()
+              << ", aligned " << aligned << ", resident " << resident << "\n";
+    assert((remapped == HugePageErrorCode::Success) && (zero == HugePageErrorCode::InvalidArgument));
+    std::cout << "[SUCCESS] The arena maps an aligned, pre-faulted region and hands it out as a bump arena.\n";
+}
+
+/*!
+ * \brief Test #2: Huge pages only: success with free huge pages, HugePagesUnavailable without
+ */
+void TestHugePagesOnly()
+{
+    std::cout << "\n=== Test 2: Huge Pages Only ===\n";
+    std::size_t const free = FreeHugePages();
+    HugePageArenaConfig config = ArenaConfig(2U * kHugePage);
+    config.allowSmallPages = false;
+    HugePageArena arena{config};
+    HugePageErrorCode const result = arena.Map();
+
+    std::cout << free << " free 2 MiB pages, Map() = " << static_cast<int>(result) << ", huge pages "
+              << arena.IsHugePageBacked() << "\n";
+    if (free >= 2U) {
+        assert((result == HugePageErrorCode::Success) && arena.IsHugePageBacked() &&
+               (arena.GetPageSize() == kHugePage) && AllResident(arena.GetData(), arena.capacity()));
+    } else {
+        assert((result == HugePageErrorCode::HugePagesUnavailable) && !arena.IsMapped());
+    }
+
+    // The same request with the fallback always gets a region
+    config.allowSmallPages = true;
+    HugePageArena fallback{config};
+    [[maybe_unused]] HugePageErrorCode const fallbackResult = fallback.Map();
+    assert((fallbackResult == HugePageErrorCode::Success) && (fallback.IsHugePageBacked() == (free >= 4U)));
+    std::cout << "[SUCCESS] Huge pages are used when reserved, and reported as unavailable otherwise.\n";
+}
+
+/*!
+ * \brief Test #3: NUMA placement: pages of a node-bound arena on that node, unknown nodes rejected
+ */
+void TestNumaPlacement()
+{
+    std::cout << "\n=== Test 3: NUMA Placement ===\n";
+    HugePageArenaConfig config = ArenaConfig(kHugePage);
+    config.numaNode = 0;
+    HugePageArena bound{config};
+    [[maybe_unused]] HugePageErrorCode const result = bound.Map();
+    assert(result == HugePageErrorCode::Success);
+
+    char* const data = static_cast<char*>(bound.GetData());
+    int const firstNode = NodeOf(data);
+    int const lastNode  = NodeOf(data + bound.capacity() - 1U);
+
+    config.numaNode = 1000;
+    HugePageArena missing{config};
+    HugePageErrorCode const unknown = missing.Map();
+    config.numaNode = -2;
+    HugePageArena negative{config};
+    [[maybe_unused]] HugePageErrorCode const invalid = negative.Map();
+
+    std::cout << "node 0 arena: first page on node " << firstNode << ", last page on node " << lastNode
+              << "; node 1000: " << static_cast<int>(unknown) << "\n";
+    assert(((firstNode == 0) || (firstNode == -1)) && ((lastNode == 0) || (lastNode == -1)));
+    assert((unknown == HugePageErrorCode::NodeUnavailable) && (invalid == HugePageErrorCode::NodeUnavailable));
+    assert(!missing.IsMapped() && !negative.IsMapped());
+    std::cout << "[SUCCESS] Bound arenas are placed on their node; unknown nodes are rejected.\n";
+}
+
+/*!
+ * \brief Test #4: Containers: Vector through PolymorphicAllocator, MdArray and InplaceVector through New()
+ */
+void TestContainers()
+{
+    std::cout << "\n=== Test 4: Containers ===\n";
+    HugePageArena arena{ArenaConfig(4U * kHugePage)};
+    [[maybe_unused]] HugePageErrorCode const mapped = arena.Map();
+    assert(mapped == HugePageErrorCode::Success);
+    char* const begin = static_cast<char*>(arena.GetData());
+    char* const end   = begin + arena.capacity();
+    [[maybe_unused]] auto inArena = [begin, end](const void* p) {
+        return (static_cast<const char*>(p) >= begin) && (static_cast<const char*>(p) < end);
+    };
+
+    // A 1 MiB frame store placed in the arena, zero-initialized
+    using Frame = ara::core::MdArray<float, 512U, 512U>;
+    Frame* const frame = arena.New<Frame>();
+    assert(frame != nullptr);
+    (*frame)(511U, 511U) = 1.0F;
+    assert(inArena(frame) &&
+           ((reinterpret_cast<std::uintptr_t>(frame) % ara::core::kDestructiveInterferenceSize) == 0U));
+    assert(SameValue((*frame)(0U, 0U), 0.0F) && SameValue((*frame)(511U, 511U), 1.0F));
+
+    using Track = ara::core::InplaceVector<std::uint32_t, 4096U>;
+    Track* const tracks = arena.New<Track>();
+    for (std::uint32_t i = 0U; i < 100U; ++i) {
+        tracks->push_back(i);
+    }
+    assert(inArena(tracks) && (tracks->size() == 100U) && ((*tracks)[99U] == 99U));
+
+    ara::core::Vector<double> samples{ara::core::pmr::PolymorphicAllocator<double>{&arena}};
+    samples.reserve(10000U);
+    for (std::size_t i = 0U; i < 10000U; ++i) {
+        samples.push_back(static_cast<double>(i));
+    }
+    assert(inArena(samples.data()) && (samples.size() == 10000U) && SameValue(samples[9999U], 9999.0));
+
+    // Exhaustion: New() returns nullptr instead of overrunning the region
+    using Huge = ara::core::Array<std::uint8_t, 8U * 1024U * 1024U>;
+    [[maybe_unused]] Huge* const tooLarge = arena.New<Huge>();
+
+    std::cout << "frame at +" << (reinterpret_cast<char*>(frame) - begin) << ", " << arena.used() << " of "
+              << arena.capacity() << " bytes used\n";
+    assert(tooLarge == nullptr);
+    std::cout << "[SUCCESS] Vector, MdArray and InplaceVector storage comes from the arena.\n";
+}
+
+/*!
+ * \brief Test #5: Initialize(): arenas mapped by Initialize, failures reported as HugePageArenaFailed
+ */
+void TestInitialize()
+{
+    std::cout << "\n=== Test 5: Initialize ===\n";
+    HugePageArena frames{ArenaConfig(kHugePage)};
+    HugePageArena tables{ArenaConfig(kHugePage)};
+    HugePageArena* const arenas[] = {&frames, &tables, nullptr};
+
+    InitConfig config{};
+    config.lockMemory = false;
+    config.hugePageArenas = ara::core::Span<HugePageArena* const>{arenas};
+    InitErrorCode const result = ara::core::Initialize(config);
+    ara::core::InitializationReport const report = ara::core::GetInitializationReport();
+    static_cast<void>(ara::core::Deinitialize());
+    assert(frames.IsMapped() && tables.IsMapped() && (report.hugePageArenasMapped == 2U));  // Left to their owner
+
+    // One arena that cannot be mapped: everything else is initialized
+    HugePageArenaConfig badConfig = ArenaConfig(kHugePage);
+    badConfig.numaNode = 1000;
+    HugePageArena bad{badConfig};
+    HugePageArena good{ArenaConfig(kHugePage)};
+    HugePageArena* const mixed[] = {&bad, &good};
+    config.hugePageArenas = ara::core::Span<HugePageArena* const>{mixed};
+    InitErrorCode const failed = ara::core::Initialize(config);
+    [[maybe_unused]] ara::core::InitializationReport const failedReport = ara::core::GetInitializationReport();
+    [[maybe_unused]] InitErrorCode const cleanup = ara::core::Deinitialize();
+
+    std::cout << "Init = " << static_cast<int>(result) << " (" << report.hugePageArenasMapped << " mapped, "
+              << report.hugePageArenasOnBasePages << " on base pages), with a bad node = "
+              << static_cast<int>(failed) << "\n";
+    assert(result == InitErrorCode::Success);
+    assert((failed == InitErrorCode::HugePageArenaFailed) && (cleanup == InitErrorCode::Success));
+    assert(!bad.IsMapped() && good.IsMapped() && (failedReport.hugePageArenasMapped == 1U));
+    std::cout << "[SUCCESS] Initialize() maps the huge-page arenas and reports the ones it could not map.\n";
+}
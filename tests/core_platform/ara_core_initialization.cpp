@@ -0,0 +1,253 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara_core_initialization.cpp
+ *  \brief      Test application for ara::core::Initialize() and ara::core::Deinitialize().
+ *
+ *  \details    This file contains multiple test functions covering:
+ *              1.  Lifecycle and error codes (double Initialize, Deinitialize without Initialize)
+ *              2.  Memory lock (optional and required) and the phase report
+ *              3.  Default memory resource and arena pre-faulting, restored by Deinitialize
+ *              4.  LogBackend started by Initialize and stopped by Deinitialize
+ *              5.  Stack pre-faulting and the default stack size of threads created afterwards
+ *
+ *  \note       mlockall needs CAP_IPC_LOCK or a sufficient RLIMIT_MEMLOCK; the tests accept both outcomes and
+ *              only check that the reported result is consistent.
+ *********************************************************************************************************************/
+
+#include "ara/core/initialization.h"  // The initialization implementation header
+#include <iostream>                   // For std::cout (demonstrations)
+#include <string>                     // For std::string (menu only)
+#include <cassert>                    // For runtime checks via assert
+#include <cstddef>                    // For std::size_t
+#include <pthread.h>                  // For pthread_create, pthread_getattr_np
+
+using ara::core::InitConfig;
+using ara::core::InitErrorCode;
+using ara::core::InitializationReport;
+using ara::core::Initialize;
+using ara::core::Deinitialize;
+using ara::core::GetInitializationReport;
+namespace pmr = ara::core::pmr;
+
+/**********************************************************************************************************************
+ *  FORWARD DECLARATIONS
+ *********************************************************************************************************************/
+void TestLifecycle();        // Test #1
+void TestMemoryLock();       // Test #2
+void TestMemoryResources();  // Test #3
+void TestLogBackend();       // Test #4
+void TestStacks();           // Test #5
+
+/**********************************************************************************************************************
+ *  MAIN AND MENU
+ *********************************************************************************************************************/
+static void PrintUsage(const char* prog) {
+    std::cout << "Usage: " << prog << " [test_number]\n"
+              << "List of Available Tests:\n"
+              << "  1  - Lifecycle and Error Codes\n"
+              << "  2  - Memory Lock and Phase Report\n"
+              << "  3  - Default Resource and Arena Pre-Faulting\n"
+              << "  4  - LogBackend Start / Stop\n"
+              << "  5  - Stack Pre-Faulting and Thread Stack Size\n";
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc != 2) {
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    std::string choice = argv[1];
+    if      (choice == "1")  TestLifecycle();
+    else if (choice == "2")  TestMemoryLock();
+    else if (choice == "3")  TestMemoryResources();
+    else if (choice == "4")  TestLogBackend();
+    else if (choice == "5")  TestStacks();
+    else {
+        std::cout << "Invalid test number.\n";
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    return 0;
+}
+
+/**********************************************************************************************************************
+ *  HELPERS
+ *********************************************************************************************************************/
+/*!
+ * \brief Configuration without memory lock, so that the tests do not depend on the privileges of the runner.
+ */
+static auto UnlockedConfig() -> InitConfig
+{
+    InitConfig config{};
+    config.lockMemory = false;
+    return config;
+}
+
+/*!
+ * \brief Thread entry storing the size of its own stack into \c arg (a std::size_t).
+ */
+static auto QueryStackSize(void* arg) -> void*
+{
+    std::size_t* const result = static_cast<std::size_t*>(arg);
+#if defined(__GLIBC__)
+    pthread_attr_t attributes{};
+    if (::pthread_getattr_np(::pthread_self(), &attributes) == 0) {
+        static_cast<void>(::pthread_attr_getstacksize(&attributes, result));
+        static_cast<void>(::pthread_attr_destroy(&attributes));
+    }
+#else
+    *result = 0U;
+#endif
+    return nullptr;
+}
+
+/**********************************************************************************************************************
+ *  TEST IMPLEMENTATIONS
+ *********************************************************************************************************************/
+/*!
+ * \brief Test #1: Lifecycle and error codes
+ */
+void TestLifecycle()
+{
+    std::cout << "\n=== Test 1: Lifecycle and Error Codes ===\n";
+    InitErrorCode const early  = Deinitialize();
+    InitErrorCode const first  = Initialize(UnlockedConfig());
+    InitErrorCode const second = Initialize(UnlockedConfig());
+    InitErrorCode const done   = Deinitialize();
+    InitErrorCode const twice  = Deinitialize();
+    InitErrorCode const again  = Initialize(UnlockedConfig());
+    static_cast<void>(Deinitialize());
+
+    assert(early == InitErrorCode::NotInitialized);
+    assert((first == InitErrorCode::Success) && (second == InitErrorCode::AlreadyInitialized));
+    assert((done == InitErrorCode::Success) && (twice == InitErrorCode::NotInitialized));
+    assert(again == InitErrorCode::Success);
+    std::cout << "Deinit early = " << static_cast<int>(early) << ", init = " << static_cast<int>(first)
+              << ", init again = " << static_cast<int>(second) << ", deinit = " << static_cast<int>(done)
+              << ", deinit again = " << static_cast<int>(twice) << ", re-init = " << static_cast<int>(again)
+              << " (expected 2, 0, 1, 0, 2, 0)\n";
+}
+
+/*!
+ * \brief Test #2: Memory lock (optional and required) and the phase report
+ */
+void TestMemoryLock()
+{
+    std::cout << "\n=== Test 2: Memory Lock and Phase Report ===\n";
+    InitConfig config{};
+    config.lockMemory = true;
+    InitErrorCode const optional = Initialize(config);
+    InitializationReport const report = GetInitializationReport();
+    static_cast<void>(Deinitialize());
+
+    // With requireMemoryLock, a failed mlockall aborts Initialize() and leaves nothing initialized
+    config.requireMemoryLock = true;
+    InitErrorCode const required = Initialize(config);
+    bool const consistent = report.memoryLocked ? (required == InitErrorCode::Success)
+                                                : (required == InitErrorCode::MemoryLockFailed);
+    InitErrorCode const cleanup = Deinitialize();
+    bool const cleanupOk = (required == InitErrorCode::Success) ? (cleanup == InitErrorCode::Success)
+                                                                : (cleanup == InitErrorCode::NotInitialized);
+
+    bool const totalCovers = (report.total >= report.memoryLock + report.stacks + report.singletons +
+                                              report.memoryResources + report.logBackend);
+    assert((optional == InitErrorCode::Success) && consistent && cleanupOk && totalCovers);
+    std::cout << "Optional lock = " << static_cast<int>(optional) << ", locked = " << report.memoryLocked
+              << ", required lock consistent = " << consistent << ", cleanup = " << cleanupOk
+              << ", total covers phases = " << totalCovers << " (" << report.total.count() << " ns)"
+              << " (expected 0, 0|1, 1, 1, 1)\n";
+}
+
+/*!
+ * \brief Test #3: Default memory resource and arena pre-faulting, restored by Deinitialize
+ */
+void TestMemoryResources()
+{
+    std::cout << "\n=== Test 3: Default Resource and Arena Pre-Faulting ===\n";
+    pmr::MemoryResource* const before = pmr::GetDefaultResource();
+    pmr::ArenaResource arena{64U * 1024U, pmr::NewDeleteResource()};
+    pmr::ArenaResource scratch{16U * 1024U, pmr::NewDeleteResource()};
+    pmr::ArenaResource* const arenas[] = {&arena, &scratch};
+
+    InitConfig config = UnlockedConfig();
+    config.defaultResource = &arena;
+    config.arenas = ara::core::Span<pmr::ArenaResource* const>{arenas};
+    InitErrorCode const result = Initialize(config);
+    bool const installed = (pmr::GetDefaultResource() == &arena);
+    bool const untouched = (arena.used() == 0U) && (scratch.used() == 0U);
+
+    static_cast<void>(Deinitialize());
+    bool const restored = (pmr::GetDefaultResource() == before);
+
+    assert((result == InitErrorCode::Success) && installed && untouched && restored);
+    std::cout << "Init = " << static_cast<int>(result) << ", default installed = " << installed
+              << ", arenas unused after pre-fault = " << untouched << ", restored = " << restored
+              << " (expected 0, 1, 1, 1)\n";
+}
+
+/*!
+ * \brief Test #4: LogBackend started by Initialize and stopped by Deinitialize
+ */
+void TestLogBackend()
+{
+    std::cout << "\n=== Test 4: LogBackend Start / Stop ===\n";
+    ara::log::BackendConfig logConfig{};
+    logConfig.drainPeriod = std::chrono::milliseconds{0};  // Rejected by the backend
+    InitConfig config = UnlockedConfig();
+    config.logBackend = &logConfig;
+    InitErrorCode const rejected = Initialize(config);
+    bool const rejectedStopped = !ara::log::LogBackend::Instance().IsRunning();
+    static_cast<void>(Deinitialize());
+
+    logConfig.drainPeriod = std::chrono::milliseconds{1};
+    InitErrorCode const started = Initialize(config);
+    bool const running = ara::log::LogBackend::Instance().IsRunning() && GetInitializationReport().logBackendStarted;
+    static_cast<void>(Deinitialize());
+    bool const stopped = !ara::log::LogBackend::Instance().IsRunning();
+
+    assert((rejected == InitErrorCode::LogBackendFailed) && rejectedStopped);
+    assert((started == InitErrorCode::Success) && running && stopped);
+    std::cout << "Invalid config = " << static_cast<int>(rejected) << ", not running = " << rejectedStopped
+              << ", valid config = " << static_cast<int>(started) << ", running = " << running
+              << ", stopped by Deinitialize = " << stopped << " (expected 4, 1, 0, 1, 1)\n";
+}
+
+/*!
+ * \brief Test #5: Stack pre-faulting and the default stack size of threads created afterwards
+ */
+void TestStacks()
+{
+    std::cout << "\n=== Test 5: Stack Pre-Faulting and Thread Stack Size ===\n";
+    constexpr std::size_t kStackSize{512U * 1024U};
+    ara::core::PrefaultStack(128U * 1024U);
+
+    InitConfig config = UnlockedConfig();
+    config.threadStackSize = kStackSize;
+    InitErrorCode const result = Initialize(config);
+    bool const applied = GetInitializationReport().threadStackSizeSet;
+
+    std::size_t threadStack{0U};
+    pthread_t thread{};
+    bool const created = (::pthread_create(&thread, nullptr, &QueryStackSize, &threadStack) == 0);
+    if (created) {
+        static_cast<void>(::pthread_join(thread, nullptr));
+    }
+    static_cast<void>(Deinitialize());
+
+    // Without pthread_setattr_default_np (non-glibc), the platform default is kept
+    bool const sizeOk = !applied || (threadStack == kStackSize);
+    assert((result == InitErrorCode::Success) && created && sizeOk);
+    std::cout << "Init = " << static_cast<int>(result) << ", default applied = " << applied
+              << ", thread stack = " << threadStack << " bytes, matches = " << sizeOk
+              << " (expected 0, 1, 524288, 1 on glibc)\n";
+}
@@ -0,0 +1,378 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara_core_md_array.cpp
+ *  \brief      Test application for the ara::core::BasicMdArray multi-dimensional array and its MdSpan views.
+ *
+ *  \details    This file contains multiple test functions covering:
+ *              1.  Layouts: constexpr offsets of LayoutRight, LayoutLeft and LayoutTiled, size and constexpr arrays
+ *              2.  Element access and whole-block operations: operator(), at(), Row() spans, fill / swap /
+ *                  comparison, the storage as an ara::core::simd operand
+ *              3.  Sub-views: relative indices, nested sub-views, views of a tiled array, const views
+ *              4.  Iteration: storage order of every layout, row-major views, ForEachTile edge blocks,
+ *                  ForEachBlocked, a blocked transpose against a naive one
+ *              5.  Violations: out-of-range at() and Subview() in forked children
+ *
+ *  \note       All variables are used, preventing compiler warnings about unused variables.
+ *********************************************************************************************************************/
+
+#include "ara/core/md_array.h"  // The container under test
+#include "ara/core/simd.h"      // For ara::core::simd kernels over the storage
+#include <iostream>         // For std::cout (demonstrations)
+#include <string>           // For std::string
+#include <cassert>          // For runtime checks via assert
+#include <csignal>          // For SIGABRT
+#include <cstdint>          // For std::int32_t
+#include <type_traits>      // For std::is_same_v
+#include <sys/wait.h>       // For waitpid
+#include <unistd.h>         // For fork, _exit
+
+using ara::core::BasicMdArray;
+using ara::core::ColMajorMdArray;
+using ara::core::LayoutLeft;
+using ara::core::LayoutRight;
+using ara::core::LayoutTiled;
+using ara::core::MdArray;
+using ara::core::MdIndex;
+using ara::core::Span;
+
+using Tiled = BasicMdArray<int, LayoutTiled<2U, 4U>, 4U, 8U>;
+
+/**********************************************************************************************************************
+ *  FORWARD DECLARATIONS
+ *********************************************************************************************************************/
+void TestLayouts();             // Test #1
+void TestAccess();              // Test #2
+void TestSubviews();            // Test #3
+void TestIteration();           // Test #4
+void TestViolations();          // Test #5
+
+/**********************************************************************************************************************
+ *  HELPERS
+ *********************************************************************************************************************/
+/*!
+ * \brief  Fills \c array with value(index) = 100 * row + column through its (row, column) indices.
+ */
+template <typename Array2D>
+static auto FillByIndex(Array2D& array) -> void
+{
+    for (std::size_t row = 0U; row < array.extent(0U); ++row) {
+        for (std::size_t column = 0U; column < array.extent(1U); ++column) {
+            array(row, column) = static_cast<int>((100U * row) + column);
+        }
+    }
+}
+
+/*!
+ * \brief  Forks a child running \c body and returns whether it was killed by SIGABRT (the violation path).
+ */
+template <typename Body>
+static auto AbortsInChild(Body body) -> bool
+{
+    pid_t const pid = ::fork();
+    assert(pid >= 0);
+    if (pid == 0) {
+        body();
+        ::_exit(0);
+    }
+    int status{0};
+    static_cast<void>(::waitpid(pid, &status, 0));
+    return WIFSIGNALED(status) && (WTERMSIG(status) == SIGABRT);
+}
+
+/**********************************************************************************************************************
+ *  MAIN AND MENU
+ *********************************************************************************************************************/
+static void PrintUsage(const char* prog) {
+    std::cout << "Usage: " << prog << " [test_number]\n"
+              << "List of Available Tests:\n"
+              << "  1  - Layouts\n"
+              << "  2  - Element Access and Whole-Block Operations\n"
+              << "  3  - Sub-Views\n"
+              << "  4  - Iteration\n"
+              << "  5  - Violations\n";
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc != 2) {
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    std::string choice = argv[1];
+    if      (choice == "1")  TestLayouts();
+    else if (choice == "2")  TestAccess();
+    else if (choice == "3")  TestSubviews();
+    else if (choice == "4")  TestIteration();
+    else if (choice == "5")  TestViolations();
+    else {
+        std::cout << "Invalid test number: " << choice << "\n";
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    return 0;
+}
+
+/**********************************************************************************************************************
+ *  TEST DEFINITIONS
+ *********************************************************************************************************************/
+
+/*!
+ * \brief Test #1: Layouts: constexpr offsets of LayoutRight, LayoutLeft and LayoutTiled, size and constexpr arrays
+ */
+void TestLayouts()
+{
+    std::cout << "\n=== Test 1: Layouts ===\n";
+    using Right = LayoutRight::Mapping<3U, 4U, 5U>;
+    using Left  = LayoutLeft::Mapping<3U, 4U, 5U>;
+    using Tile  = Tiled::Mapping;
+
+    static_assert(Right::kRank == 3U && Right::kSize == 60U);
+    static_assert(Right::Offset(MdIndex<3U>{1U, 2U, 3U}) == (1U * 20U) + (2U * 5U) + 3U);
+    static_assert(Left::Offset(MdIndex<3U>{1U, 2U, 3U}) == 1U + (2U * 3U) + (3U * 12U));
+    static_assert(Tile::kTileSize == 8U);
+    // (1, 5): tile (0, 1) -> block 1, inside the tile (1, 1) -> 5
+    static_assert(Tile::Offset(MdIndex<2U>{1U, 5U}) == 8U + 5U);
+    // (2, 0): tile (1, 0) -> block 2
+    static_assert(Tile::Offset(MdIndex<2U>{2U, 0U}) == 16U);
+
+    static_assert(sizeof(MdArray<float, 4U, 8U>) == 32U * sizeof(float));
+    static_assert(sizeof(Tiled) == 32U * sizeof(int));
+    static_assert(MdArray<float, 4U, 8U>::rank() == 2U && MdArray<float, 4U, 8U>::extent(1U) == 8U);
+    static_assert(std::is_same_v<MdArray<int, 2U, 3U>::Storage, ara::core::Array<int, 6U>>);
+
+    // Built and read by the compiler: elements in storage order
+    constexpr MdArray<int, 2U, 3U> kRowMajor{1, 2, 3, 4, 5, 6};
+    constexpr ColMajorMdArray<int, 2U, 3U> kColMajor{1, 2, 3, 4, 5, 6};
+    static_assert(kRowMajor(1U, 0U) == 4 && kRowMajor(0U, 2U) == 3);
+    static_assert(kColMajor(1U, 0U) == 2 && kColMajor(0U, 2U) == 5);
+
+    // Every index maps to a distinct offset below the size
+    bool seen[Tiled::size()]{};
+    bool unique{true};
+    for (std::size_t row = 0U; row < 4U; ++row) {
+        for (std::size_t column = 0U; column < 8U; ++column) {
+            std::size_t const offset = Tile::Offset(MdIndex<2U>{row, column});
+            unique = unique && (offset < Tiled::size()) && !seen[offset];
+            seen[offset] = true;
+        }
+    }
+
+    std::cout << "tiled 4x8 in 2x4 tiles: (1, 5) at offset " << Tile::Offset(MdIndex<2U>{1U, 5U}) << "\n";
+    assert(unique);
+    std::cout << "[SUCCESS] Offsets of all layouts are computed at compile time and are unique.\n";
+}
+
+/*!
+ * \brief Test #2: Element access and whole-block operations
+ */
+void TestAccess()
+{
+    std::cout << "\n=== Test 2: Element Access and Whole-Block Operations ===\n";
+    MdArray<int, 3U, 4U> matrix{};
+    FillByIndex(matrix);
+    assert(matrix(2U, 3U) == 203 && matrix.at(1U, 2U) == 102 && matrix(MdIndex<2U>{2U, 1U}) == 201);
+    assert(matrix.Flat()[4U] == 100);  // Row-major: (1, 0) follows (0, 3)
+
+    // Rows are contiguous static-extent spans
+    Span<int, 4U> row = matrix.Row(1U);
+    static_assert(std::is_same_v<decltype(matrix.Row(1U)), Span<int, 4U>>);
+    row[3U] = -1;
+    assert((row.data() == &matrix(1U, 0U)) && (matrix(1U, 3U) == -1));
+
+    // Whole-block operations on the storage
+    MdArray<int, 3U, 4U> copy = matrix;
+    assert(copy == matrix);
+    copy.fill(7);
+    assert((copy != matrix) && (copy(2U, 2U) == 7));
+    swap(copy, matrix);
+    assert((matrix(0U, 0U) == 7) && (copy(2U, 3U) == 203));
+
+    // The storage is an ara::core::simd operand
+    MdArray<float, 8U, 8U> lhs{};
+    MdArray<float, 8U, 8U> rhs{};
+    lhs.fill(1.5F);
+    rhs.fill(2.0F);
+    lhs(3U, 5U) = 10.0F;
+    ara::core::Array<float, 64U> const sum = ara::core::simd::Add(lhs.Flat(), rhs.Flat());
+    float const dot = static_cast<float>(ara::core::simd::Dot(lhs.Flat(), rhs.Flat()));
+
+    // Column-major: the first index is contiguous
+    ColMajorMdArray<int, 3U, 4U> columns{};
+    FillByIndex(columns);
+    assert((columns.Flat()[1U] == 100) && (columns.Flat()[3U] == 1));
+
+    int count{0};
+    for (int const value : copy) {
+        count += (value != 0) ? 1 : 0;
+    }
+
+    std::cout << "sum(3, 5) = " << sum[(3U * 8U) + 5U] << ", dot = " << dot << ", " << count << " non-zero\n";
+    assert((sum[(3U * 8U) + 5U] == 12.0F) && (sum[0U] == 3.5F) && (dot == ((63.0F * 3.0F) + 20.0F)));
+    assert(count == 11);  // (0, 0) is zero
+    std::cout << "[SUCCESS] Elements, rows and the whole block are reachable without copies.\n";
+}
+
+/*!
+ * \brief Test #3: Sub-views: relative indices, nested sub-views, views of a tiled array, const views
+ */
+void TestSubviews()
+{
+    std::cout << "\n=== Test 3: Sub-Views ===\n";
+    MdArray<int, 6U, 8U> image{};
+    FillByIndex(image);
+
+    auto window = image.Subview(MdIndex<2U>{2U, 3U}, MdIndex<2U>{3U, 4U});
+    assert((window.extent(0U) == 3U) && (window.extent(1U) == 4U) && (window.size() == 12U));
+    assert((window(0U, 0U) == 203) && (window(2U, 3U) == 406) && (window.at(1U, 1U) == 304));
+    assert((window.Row(1U).size() == 4U) && (window.Row(1U)[0U] == 303));
+
+    // Writes through the view land in the array
+    window(1U, 2U) = -5;
+    assert(image(3U, 5U) == -5);
+
+    // Nested sub-view: indices relative to the inner origin
+    [[maybe_unused]] auto inner = window.Subview(MdIndex<2U>{1U, 1U}, MdIndex<2U>{2U, 2U});
+    assert((inner(0U, 0U) == 304) && (inner(1U, 1U) == 405));
+    assert((inner.GetOrigin()[0U] == 3U) && (inner.GetOrigin()[1U] == 4U));
+
+    // A view of a tiled array spans several tiles
+    Tiled tiled{};
+    FillByIndex(tiled);
+    auto across = tiled.Subview(MdIndex<2U>{1U, 2U}, MdIndex<2U>{2U, 4U});
+    int sum{0};
+    across.ForEach([&sum](int& value) noexcept { sum += value; });
+    // Rows 1 and 2, columns 2..5
+    [[maybe_unused]] int const expected = (100 + 100 + 100 + 100 + 2 + 3 + 4 + 5) + (200 + 200 + 200 + 200 + 2 + 3 + 4 + 5);
+
+    // Const views
+    MdArray<int, 6U, 8U> const& constImage = image;
+    ara::core::MdSpan<const int, LayoutRight, 6U, 8U> const readOnly = constImage.GetView();
+    [[maybe_unused]] ara::core::MdSpan<const int, LayoutRight, 6U, 8U> const converted = window;
+    static_assert(std::is_same_v<decltype(readOnly(0U, 0U)), const int&>);
+
+    std::cout << "window(0, 0) = " << window(0U, 0U) << ", tiled window sum " << sum << "\n";
+    assert(sum == expected);
+    assert((readOnly(5U, 7U) == 507) && (converted(1U, 2U) == -5));
+    std::cout << "[SUCCESS] Sub-views address their box of any layout in place.\n";
+}
+
+/*!
+ * \brief Test #4: Iteration: storage order, row-major views, ForEachTile edge blocks, ForEachBlocked, transpose
+ */
+void TestIteration()
+{
+    std::cout << "\n=== Test 4: Iteration ===\n";
+
+    /* Storage order: every layout visits consecutive addresses, each index exactly once */
+    [[maybe_unused]] auto storageOrder = [](auto& array) {
+        const auto* expected = array.data();
+        bool consecutive{true};
+        std::size_t visited{0U};
+        array.ForEachIndexed([&](const auto& index, auto& value) noexcept {
+            consecutive = consecutive && (&value == expected) && (&array(index) == &value);
+            ++expected;
+            ++visited;
+        });
+        return consecutive && (visited == array.size());
+    };
+    MdArray<int, 3U, 5U> right{};
+    ColMajorMdArray<int, 3U, 5U> left{};
+    Tiled tiled{};
+    BasicMdArray<int, LayoutTiled<2U, 2U, 2U>, 4U, 2U, 6U> tiled3d{};
+    assert(storageOrder(right) && storageOrder(left) && storageOrder(tiled) && storageOrder(tiled3d));
+
+    /* Views iterate row-major with relative indices */
+    MdArray<int, 5U, 7U> grid{};
+    FillByIndex(grid);
+    std::size_t position{0U};
+    bool rowMajor{true};
+    grid.Subview(MdIndex<2U>{1U, 2U}, MdIndex<2U>{3U, 4U})
+        .ForEachIndexed([&position, &rowMajor](const MdIndex<2U>& index, int& value) noexcept {
+            rowMajor = rowMajor && (((index[0U] * 4U) + index[1U]) == position) &&
+                       (value == static_cast<int>((100U * (index[0U] + 1U)) + index[1U] + 2U));
+            ++position;
+        });
+    assert(rowMajor && (position == 12U));
+
+    /* ForEachTile: 5x7 in 2x3 blocks -> 3x3 blocks, the last row / column cut */
+    std::size_t tiles{0U};
+    std::size_t covered{0U};
+    std::size_t smallest{6U};
+    grid.ForEachTile<2U, 3U>([&](const MdArray<int, 5U, 7U>::View& block) noexcept {
+        ++tiles;
+        covered += block.size();
+        smallest = (block.size() < smallest) ? block.size() : smallest;
+    });
+    assert((tiles == 9U) && (covered == 35U) && (smallest == 1U));
+
+    /* ForEachBlocked: every element once, with its index in the array */
+    MdArray<int, 5U, 7U> hits{};
+    grid.ForEachBlocked<2U, 3U>([&hits](const MdIndex<2U>& index, int& value) noexcept {
+        hits(index) += (value == static_cast<int>((100U * index[0U]) + index[1U])) ? 1 : 100;
+    });
+    bool once{true};
+    for (int const hit : hits) {
+        once = once && (hit == 1);
+    }
+    assert(once);
+
+    /* Blocked transpose against the naive one */
+    static MdArray<float, 64U, 48U> source{};
+    static MdArray<float, 48U, 64U> naive{};
+    static MdArray<float, 48U, 64U> blocked{};
+    for (std::size_t i = 0U; i < source.size(); ++i) {
+        source.Flat()[i] = static_cast<float>(i);
+    }
+    for (std::size_t row = 0U; row < 64U; ++row) {
+        for (std::size_t column = 0U; column < 48U; ++column) {
+            naive(column, row) = source(row, column);
+        }
+    }
+    source.ForEachBlocked<16U, 16U>([](const MdIndex<2U>& index, float& value) noexcept {
+        blocked(index[1U], index[0U]) = value;
+    });
+
+    std::cout << tiles << " tiles covering " << covered << " elements, transpose "
+              << ((blocked == naive) ? "matches" : "differs") << "\n";
+    assert(blocked == naive);
+    std::cout << "[SUCCESS] Storage order, view order and blocked order visit every element once.\n";
+}
+
+/*!
+ * \brief Test #5: Violations: out-of-range at() and Subview() in forked children
+ */
+void TestViolations()
+{
+    std::cout << "\n=== Test 5: Violations ===\n";
+    bool const atAborts = AbortsInChild([]() {
+        MdArray<int, 3U, 4U> matrix{};
+        static_cast<void>(matrix.at(1U, 4U));
+    });
+    bool const viewAtAborts = AbortsInChild([]() {
+        MdArray<int, 3U, 4U> matrix{};
+        static_cast<void>(matrix.Subview(MdIndex<2U>{1U, 1U}, MdIndex<2U>{2U, 2U}).at(2U, 0U));
+    });
+    bool const subviewAborts = AbortsInChild([]() {
+        MdArray<int, 3U, 4U> matrix{};
+        static_cast<void>(matrix.Subview(MdIndex<2U>{2U, 1U}, MdIndex<2U>{2U, 2U}));
+    });
+    bool const inRange = !AbortsInChild([]() {
+        MdArray<int, 3U, 4U> matrix{};
+        static_cast<void>(matrix.at(2U, 3U));
+        static_cast<void>(matrix.Subview(MdIndex<2U>{3U, 4U}, MdIndex<2U>{0U, 0U}));
+    });
+
+    std::cout << "at(): " << atAborts << ", view at(): " << viewAtAborts << ", Subview(): " << subviewAborts
+              << ", in range: " << inRange << "\n";
+    assert(atAborts && viewAtAborts && subviewAborts && inRange);
+    std::cout << "[SUCCESS] Out-of-range accesses and sub-views go through the violation handler.\n";
+}
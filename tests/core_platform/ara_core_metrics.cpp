@@ -0,0 +1,280 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara_core_metrics.cpp
+ *  \brief      Test application for the ara::core::internal::metrics histograms.
+ *
+ *  \details    This file contains multiple test functions covering:
+ *              1.  Bucket mapping: exact region, contiguity, relative resolution
+ *              2.  Percentiles, min, max and mean of a known distribution
+ *              3.  Empty histogram, clamping beyond the range, Reset()
+ *              4.  Snapshots taken while another thread keeps recording
+ *              5.  CycleMetrics (latency, execution time, overruns)
+ *
+ *  \note       All variables are used, preventing compiler warnings about unused variables.
+ *********************************************************************************************************************/
+
+#include "ara/core/internal/metrics.h"  // The metrics histograms
+#include <iostream>         // For std::cout (demonstrations)
+#include <string>           // For std::string
+#include <cassert>          // For runtime checks via assert
+#include <atomic>           // For std::atomic
+#include <cstdint>          // For std::uint64_t
+#include <thread>           // For std::thread
+
+using ara::core::internal::metrics::CycleMetrics;
+using ara::core::internal::metrics::CycleMetricsSummary;
+using ara::core::internal::metrics::HistogramSummary;
+using ara::core::internal::metrics::LatencyHistogram;
+
+/**********************************************************************************************************************
+ *  FORWARD DECLARATIONS
+ *********************************************************************************************************************/
+void TestBucketMapping();       // Test #1
+void TestPercentiles();         // Test #2
+void TestEdgeCases();           // Test #3
+void TestConcurrentSnapshot();  // Test #4
+void TestCycleMetrics();        // Test #5
+
+/**********************************************************************************************************************
+ *  HELPERS
+ *********************************************************************************************************************/
+/*!
+ * \brief  True if \c actual is within the histogram resolution (1 / kSubBucketCount) above \c expected.
+ */
+static auto WithinResolution(std::uint64_t actual, std::uint64_t expected) -> bool
+{
+    return (actual >= expected) && ((actual - expected) <= (expected / LatencyHistogram::kSubBucketCount));
+}
+
+/*!
+ * \brief  Histograms with static storage duration (the concurrency test shares them between threads).
+ */
+static LatencyHistogram gSharedHistogram;
+
+/**********************************************************************************************************************
+ *  MAIN AND MENU
+ *********************************************************************************************************************/
+static void PrintUsage(const char* prog) {
+    std::cout << "Usage: " << prog << " [test_number]\n"
+              << "List of Available Tests:\n"
+              << "  1  - Bucket Mapping\n"
+              << "  2  - Percentiles of a Known Distribution\n"
+              << "  3  - Empty Histogram, Clamping and Reset\n"
+              << "  4  - Concurrent Recording and Snapshots\n"
+              << "  5  - CycleMetrics\n";
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc != 2) {
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    std::string choice = argv[1];
+    if      (choice == "1")  TestBucketMapping();
+    else if (choice == "2")  TestPercentiles();
+    else if (choice == "3")  TestEdgeCases();
+    else if (choice == "4")  TestConcurrentSnapshot();
+    else if (choice == "5")  TestCycleMetrics();
+    else {
+        std::cout << "Invalid test number: " << choice << "\n";
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    return 0;
+}
+
+/**********************************************************************************************************************
+ *  TEST DEFINITIONS
+ *********************************************************************************************************************/
+
+/*!
+ * \brief Test #1: Bucket mapping
+ */
+void TestBucketMapping()
+{
+    std::cout << "\n=== Test 1: Bucket Mapping ===\n";
+    std::cout << "Buckets = " << LatencyHistogram::kBucketCount << ", sub-buckets = "
+              << LatencyHistogram::kSubBucketCount << "\n";
+
+    std::size_t exactErrors = 0U;
+    for (std::uint64_t value = 0U; value < LatencyHistogram::kSubBucketCount; ++value) {
+        exactErrors += (LatencyHistogram::IndexOf(value) == static_cast<std::size_t>(value)) ? 0U : 1U;
+    }
+    assert(exactErrors == 0U);
+    std::cout << "Exact region mismatches = " << exactErrors << " (expected 0)\n";
+
+    std::size_t mappingErrors = 0U;
+    std::size_t gapErrors = 0U;
+    std::size_t resolutionErrors = 0U;
+    for (std::size_t index = 0U; index < LatencyHistogram::kBucketCount; ++index) {
+        std::uint64_t const lowest  = LatencyHistogram::LowestEquivalentValue(index);
+        std::uint64_t const highest = LatencyHistogram::HighestEquivalentValue(index);
+        mappingErrors += (LatencyHistogram::IndexOf(lowest) == index) ? 0U : 1U;
+        mappingErrors += (LatencyHistogram::IndexOf(highest) == index) ? 0U : 1U;
+        if ((index + 1U) < LatencyHistogram::kBucketCount) {
+            gapErrors += (LatencyHistogram::LowestEquivalentValue(index + 1U) == (highest + 1U)) ? 0U : 1U;
+        }
+        resolutionErrors += ((highest - lowest) <= (lowest / LatencyHistogram::kSubBucketCount)) ? 0U : 1U;
+    }
+    assert(mappingErrors == 0U);
+    assert(gapErrors == 0U);
+    assert(resolutionErrors == 0U);
+    std::cout << "Mapping errors = " << mappingErrors << ", gaps = " << gapErrors << ", resolution errors = "
+              << resolutionErrors << " (expected 0, 0, 0)\n";
+
+    std::size_t const index1000 = LatencyHistogram::IndexOf(1000U);
+    std::cout << "1000 ns -> bucket " << index1000 << " [" << LatencyHistogram::LowestEquivalentValue(index1000)
+              << ", " << LatencyHistogram::HighestEquivalentValue(index1000) << "]\n";
+}
+
+/*!
+ * \brief Test #2: Percentiles of the uniform distribution 1 .. 100000
+ */
+void TestPercentiles()
+{
+    std::cout << "\n=== Test 2: Percentiles of a Known Distribution ===\n";
+    LatencyHistogram histogram;
+    constexpr std::uint64_t kSamples{100000U};
+    for (std::uint64_t value = 1U; value <= kSamples; ++value) {
+        histogram.Record(value);
+    }
+
+    HistogramSummary const summary = histogram.GetSummary();
+    bool const p50Ok  = WithinResolution(summary.p50, 50000U);
+    bool const p99Ok  = WithinResolution(summary.p99, 99000U);
+    bool const p999Ok = WithinResolution(summary.p999, 99900U);
+    assert(summary.count == kSamples);
+    assert((summary.min == 1U) && (summary.max == kSamples));
+    assert(summary.mean == 50000U);
+    assert(p50Ok && p99Ok && p999Ok);
+    std::cout << "count = " << summary.count << ", min = " << summary.min << ", max = " << summary.max
+              << ", mean = " << summary.mean << " (expected 100000, 1, 100000, 50000)\n";
+    std::cout << "p50 = " << summary.p50 << ", p99 = " << summary.p99 << ", p99.9 = " << summary.p999
+              << " (within 1/32 above 50000, 99000, 99900: " << p50Ok << p99Ok << p999Ok << ", expected 111)\n";
+
+    LatencyHistogram::Snapshot const snapshot = histogram.GetSnapshot();
+    std::uint64_t const p100 = snapshot.ValueAtPercentile(100.0);
+    std::uint64_t const p0   = snapshot.ValueAtPercentile(0.0);
+    assert(p100 == kSamples);
+    assert(p0 == 1U);
+    std::cout << "p0 = " << p0 << ", p100 = " << p100 << " (expected 1, 100000)\n";
+}
+
+/*!
+ * \brief Test #3: Empty histogram, clamping beyond the range, Reset()
+ */
+void TestEdgeCases()
+{
+    std::cout << "\n=== Test 3: Empty Histogram, Clamping and Reset ===\n";
+    LatencyHistogram histogram;
+    HistogramSummary const empty = histogram.GetSummary();
+    assert((empty.count == 0U) && (empty.min == 0U) && (empty.max == 0U) && (empty.p99 == 0U));
+    std::cout << "Empty: count = " << empty.count << ", min = " << empty.min << ", max = " << empty.max
+              << ", p99 = " << empty.p99 << " (expected 0, 0, 0, 0)\n";
+
+    std::uint64_t const huge = std::uint64_t{1U} << 50U;
+    histogram.Record(huge);
+    histogram.Record(0U);
+    LatencyHistogram::Snapshot const snapshot = histogram.GetSnapshot();
+    std::uint64_t const lastBucket = snapshot.BucketCount(LatencyHistogram::kBucketCount - 1U);
+    std::uint64_t const zeroBucket = snapshot.BucketCount(0U);
+    std::uint64_t const p100 = snapshot.ValueAtPercentile(100.0);
+    assert((lastBucket == 1U) && (zeroBucket == 1U));
+    assert(snapshot.Max() == huge);
+    assert(snapshot.Min() == 0U);
+    assert(p100 == LatencyHistogram::HighestEquivalentValue(LatencyHistogram::kBucketCount - 1U));
+    std::cout << "Clamped: last bucket = " << lastBucket << ", zero bucket = " << zeroBucket << ", exact max = "
+              << snapshot.Max() << ", p100 = " << p100 << " (range end)\n";
+
+    histogram.Reset();
+    HistogramSummary const reset = histogram.GetSummary();
+    assert((reset.count == 0U) && (reset.max == 0U) && (histogram.GetCount() == 0U));
+    histogram.Record(42U);
+    HistogramSummary const after = histogram.GetSummary();
+    assert((after.min == 42U) && (after.max == 42U) && (after.p50 == 42U));
+    std::cout << "After Reset: count = " << reset.count << "; after Record(42): min/max/p50 = " << after.min << "/"
+              << after.max << "/" << after.p50 << " (expected 0; 42/42/42)\n";
+}
+
+/*!
+ * \brief Test #4: Snapshots taken while another thread keeps recording
+ */
+void TestConcurrentSnapshot()
+{
+    std::cout << "\n=== Test 4: Concurrent Recording and Snapshots ===\n";
+    constexpr std::uint64_t kSamples{500000U};
+    std::atomic<bool> done{false};
+
+    std::thread writer([&done]() {
+        for (std::uint64_t i = 0U; i < kSamples; ++i) {
+            gSharedHistogram.Record(1000U + (i % 4096U));
+        }
+        done.store(true, std::memory_order_release);
+    });
+
+    std::uint64_t snapshots = 0U;
+    std::uint64_t previous  = 0U;
+    std::uint64_t regressions = 0U;
+    std::uint64_t outOfRange = 0U;
+    while (!done.load(std::memory_order_acquire)) {
+        HistogramSummary const summary = gSharedHistogram.GetSummary();
+        regressions += (summary.count < previous) ? 1U : 0U;
+        if ((summary.count > 0U) && ((summary.p50 < 1000U) || (summary.p999 > 5200U))) {
+            ++outOfRange;
+        }
+        previous = summary.count;
+        ++snapshots;
+    }
+    writer.join();
+
+    HistogramSummary const final = gSharedHistogram.GetSummary();
+    assert(regressions == 0U);
+    assert(outOfRange == 0U);
+    assert(final.count == kSamples);
+    assert((final.min == 1000U) && (final.max == 5095U));
+    std::cout << "Snapshots during recording = " << snapshots << ", count regressions = " << regressions
+              << ", out-of-range percentiles = " << outOfRange << " (expected 0, 0)\n";
+    std::cout << "Final count = " << final.count << ", min = " << final.min << ", max = " << final.max
+              << " (expected 500000, 1000, 5095)\n";
+}
+
+/*!
+ * \brief Test #5: CycleMetrics
+ */
+void TestCycleMetrics()
+{
+    std::cout << "\n=== Test 5: CycleMetrics ===\n";
+    static CycleMetrics metrics;
+    for (std::int64_t cycle = 0; cycle < 1000; ++cycle) {
+        metrics.RecordCycle(2000 + cycle, 50000);
+    }
+    metrics.RecordCycle(-5, 1000000);
+    metrics.RecordOverrun();
+
+    CycleMetricsSummary const summary = metrics.GetSummary();
+    assert(summary.wakeUpLatency.count == 1001U);
+    assert(summary.executionTime.count == 1001U);
+    assert(summary.wakeUpLatency.min == 0U);
+    assert(summary.executionTime.max == 1000000U);
+    assert(summary.overruns == 1U);
+    assert(WithinResolution(summary.executionTime.p99, 50000U));
+    std::cout << "latency: count = " << summary.wakeUpLatency.count << ", min = " << summary.wakeUpLatency.min
+              << ", p50 = " << summary.wakeUpLatency.p50 << "; execution: p99 = " << summary.executionTime.p99
+              << ", max = " << summary.executionTime.max << "; overruns = " << summary.overruns
+              << " (expected 1001, 0, ~2500; ~50000, 1000000; 1)\n";
+
+    metrics.Reset();
+    assert((metrics.GetOverruns() == 0U) && (metrics.WakeUpLatency().GetCount() == 0U));
+    std::cout << "After Reset: overruns = " << metrics.GetOverruns() << ", samples = "
+              << metrics.ExecutionTime().GetCount() << " (expected 0, 0)\n";
+}
@@ -0,0 +1,450 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara_core_parallel.cpp
+ *  \brief      Test application for ara::core::Executor and the ara::core::parallel algorithms.
+ *
+ *  \details    This file contains multiple test functions covering:
+ *              1.  Stopped executor: serial fallback on the calling thread, Submit() refused
+ *              2.  for_each / transform / reduce over Array, Span, Vector and InplaceVector
+ *              3.  Grain control: every index exactly once, tasks of at most one grain, pinned named workers
+ *              4.  Nested ParallelFor() from inside tasks, Submit() and a deterministic floating-point reduce
+ *              5.  Start() / Stop() results, restart and the default worker count
+ *              6.  Submit() racing Stop(): every accepted task runs before Stop() returns
+ *
+ *              The workers are pinned to CPUs from the affinity of the test process, so the tests also pass in
+ *              containers restricted to a subset of the CPUs (or to a single one).
+ *
+ *  \note       All variables are used, preventing compiler warnings about unused variables.
+ *********************************************************************************************************************/
+
+#include "ara/core/parallel.h"   // The parallel algorithms and the Executor
+#include "ara/core/array.h"      // For ara::core::Array, ara::core::InplaceVector
+#include "ara/core/span.h"       // For ara::core::Span
+#include "ara/core/vector.h"     // For ara::core::Vector
+#include <iostream>         // For std::cout (demonstrations)
+#include <string>           // For std::string
+#include <cassert>          // For runtime checks via assert
+#include <atomic>           // For std::atomic
+#include <cmath>            // For std::fabs
+#include <cstdint>          // For std::uint64_t
+#include <cstring>          // For std::strncmp
+#include <pthread.h>        // For pthread_getname_np
+#include <thread>           // For std::this_thread::yield
+
+using ara::core::Array;
+using ara::core::Executor;
+using ara::core::ExecutorConfig;
+using ara::core::ExecutorErrorCode;
+using ara::os::interface::thread::CpuSet;
+using ara::os::interface::thread::Thread;
+
+/**********************************************************************************************************************
+ *  FORWARD DECLARATIONS
+ *********************************************************************************************************************/
+void TestSerialFallback();       // Test #1
+void TestAlgorithms();           // Test #2
+void TestGrainControl();         // Test #3
+void TestNestedAndSubmit();      // Test #4
+void TestStartStop();            // Test #5
+void TestSubmitDuringStop();     // Test #6
+
+/**********************************************************************************************************************
+ *  HELPERS
+ *********************************************************************************************************************/
+/*!
+ * \brief  Large containers with static storage duration (they are shared with the workers).
+ */
+static Array<std::uint64_t, 100000U> gInput;
+static Array<std::uint64_t, 100000U> gOutput;
+
+/*!
+ * \brief  Relative comparison for reductions whose summation order differs from the sequential one.
+ */
+static auto NearlyEqual(double lhs, double rhs) -> bool
+{
+    double const scale = std::fabs(lhs) > 1.0 ? std::fabs(lhs) : 1.0;
+    return std::fabs(lhs - rhs) <= (1e-12 * scale);
+}
+
+/*!
+ * \brief  Starts \c executor with \c workers workers and asserts success.
+ */
+static void StartWorkers(Executor& executor, std::size_t workers)
+{
+    ExecutorConfig config{};
+    config.workerCount = workers;
+    ExecutorErrorCode const result = executor.Start(config);
+    assert(result == ExecutorErrorCode::Success);
+    static_cast<void>(result);
+}
+
+/**********************************************************************************************************************
+ *  MAIN AND MENU
+ *********************************************************************************************************************/
+static void PrintUsage(const char* prog) {
+    std::cout << "Usage: " << prog << " [test_number]\n"
+              << "List of Available Tests:\n"
+              << "  1  - Stopped Executor: Serial Fallback\n"
+              << "  2  - for_each / transform / reduce over the Containers\n"
+              << "  3  - Grain Control and Pinned Workers\n"
+              << "  4  - Nested ParallelFor, Submit, Deterministic Reduce\n"
+              << "  5  - Start / Stop\n"
+              << "  6  - Submit Racing Stop\n";
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc != 2) {
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    std::string choice = argv[1];
+    if      (choice == "1")  TestSerialFallback();
+    else if (choice == "2")  TestAlgorithms();
+    else if (choice == "3")  TestGrainControl();
+    else if (choice == "4")  TestNestedAndSubmit();
+    else if (choice == "5")  TestStartStop();
+    else if (choice == "6")  TestSubmitDuringStop();
+    else {
+        std::cout << "Invalid test number: " << choice << "\n";
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    return 0;
+}
+
+/**********************************************************************************************************************
+ *  TEST DEFINITIONS
+ *********************************************************************************************************************/
+
+/*!
+ * \brief Test #1: Stopped executor: serial fallback on the calling thread, Submit() refused
+ */
+void TestSerialFallback()
+{
+    std::cout << "\n=== Test 1: Stopped Executor: Serial Fallback ===\n";
+    Executor& executor = Executor::Instance();
+    assert(!executor.IsRunning() && (executor.GetWorkerCount() == 0U));
+
+    Array<int, 1000U> values{};
+    std::size_t offCaller{0U};
+    ara::core::parallel::for_each(values, [&executor, &offCaller](int& value) noexcept {
+        value = 7;
+        offCaller += (executor.GetCurrentWorkerIndex() == Executor::kMaxWorkers) ? 0U : 1U;
+    });
+    std::size_t sevens{0U};
+    for (int const value : values) {
+        sevens += (value == 7) ? 1U : 0U;
+    }
+    assert((sevens == 1000U) && (offCaller == 0U));
+    std::cout << "for_each: " << sevens << " elements, " << offCaller << " off the caller (expected 1000, 0)\n";
+
+    int const sum = ara::core::parallel::reduce(values, 1, [](int a, int b) noexcept { return a + b; });
+    assert(sum == 7001);
+    std::cout << "reduce = " << sum << " (expected 7001)\n";
+
+    auto const noop = [](void*, std::size_t, std::size_t) noexcept {};
+    bool const submitted = executor.Submit(noop, nullptr);
+    assert(!submitted);
+    std::cout << "Submit while stopped = " << submitted << " (expected 0)\n";
+}
+
+/*!
+ * \brief Test #2: for_each / transform / reduce over Array, Span, Vector and InplaceVector
+ */
+void TestAlgorithms()
+{
+    std::cout << "\n=== Test 2: for_each / transform / reduce over the Containers ===\n";
+    Executor executor{};
+    StartWorkers(executor, 3U);
+
+    // Array: fill with the index (for_each sees the elements in place), square into a second Array
+    std::size_t index{0U};
+    for (std::uint64_t& value : gInput) {
+        value = index++;
+    }
+    ara::core::parallel::for_each(executor, gInput, [](std::uint64_t& value) noexcept { value += 1U; });
+    ara::core::parallel::transform(executor, gInput, gOutput,
+                                   [](std::uint64_t value) noexcept { return value * value; });
+    std::size_t errors{0U};
+    for (std::size_t i = 0U; i < gInput.size(); ++i) {
+        errors += ((gInput[i] == (i + 1U)) && (gOutput[i] == ((i + 1U) * (i + 1U)))) ? 0U : 1U;
+    }
+    assert(errors == 0U);
+    std::cout << "Array for_each + transform: errors = " << errors << " (expected 0)\n";
+
+    auto const plus = [](std::uint64_t a, std::uint64_t b) noexcept { return a + b; };
+    std::uint64_t const n = gInput.size();
+    std::uint64_t const arraySum = ara::core::parallel::reduce(executor, gInput, std::uint64_t{0U}, plus);
+    assert(arraySum == ((n * (n + 1U)) / 2U));
+    std::cout << "Array reduce = " << arraySum << " (expected " << ((n * (n + 1U)) / 2U) << ")\n";
+
+    // Span: a sub-view only touches its own elements
+    ara::core::Span<std::uint64_t> view{gInput.data() + 10U, 100U};
+    ara::core::parallel::for_each(executor, view, [](std::uint64_t& value) noexcept { value = 0U; }, 8U);
+    std::uint64_t const spanSum = ara::core::parallel::reduce(executor, view, std::uint64_t{5U}, plus, 8U);
+    assert((spanSum == 5U) && (gInput[9U] == 10U) && (gInput[10U] == 0U) && (gInput[110U] == 111U));
+    std::cout << "Span reduce = " << spanSum << ", around the view = " << gInput[9U] << ", " << gInput[110U]
+              << " (expected 5, 10, 111)\n";
+
+    // Vector and InplaceVector
+    ara::core::Vector<int> vector(5000U, 2);
+    ara::core::InplaceVector<int, 5000U> inplace(5000U, 0);
+    ara::core::parallel::transform(executor, vector, inplace, [](int value) noexcept { return value * 3; });
+    int const vectorSum = ara::core::parallel::reduce(executor, inplace, 0, [](int a, int b) noexcept { return a + b; });
+    assert(vectorSum == 30000);
+    std::cout << "Vector -> InplaceVector transform, reduce = " << vectorSum << " (expected 30000)\n";
+
+    executor.Stop();
+}
+
+/*!
+ * \brief Test #3: Grain control: every index exactly once, tasks of at most one grain, pinned named workers
+ */
+void TestGrainControl()
+{
+    std::cout << "\n=== Test 3: Grain Control and Pinned Workers ===\n";
+    Executor executor{};
+    StartWorkers(executor, 3U);
+
+    struct Context {
+        Executor*                 executor;
+        std::atomic<std::uint8_t> visits[4096U];
+        std::atomic<std::size_t>  tasks;
+        std::atomic<std::size_t>  oversized;
+        std::atomic<std::size_t>  onWorkers;
+    };
+    static Context context{};
+    context.executor = &executor;
+
+    auto const body = [](void* raw, std::size_t begin, std::size_t end) noexcept {
+        Context& self = *static_cast<Context*>(raw);
+        self.tasks.fetch_add(1U);
+        self.oversized.fetch_add(((end - begin) > 64U) ? 1U : 0U);
+        self.onWorkers.fetch_add((self.executor->GetCurrentWorkerIndex() < Executor::kMaxWorkers) ? 1U : 0U);
+        for (std::size_t i = begin; i < end; ++i) {
+            self.visits[i].fetch_add(1U);
+        }
+    };
+    executor.ParallelFor(4096U, 64U, body, &context);
+
+    std::size_t wrongVisits{0U};
+    for (std::atomic<std::uint8_t>& visit : context.visits) {
+        wrongVisits += (visit.load() == 1U) ? 0U : 1U;
+    }
+    assert((wrongVisits == 0U) && (context.tasks.load() == 64U) && (context.oversized.load() == 0U));
+    std::cout << "4096 indices, grain 64: wrong visits = " << wrongVisits << ", tasks = " << context.tasks.load()
+              << ", oversized = " << context.oversized.load() << " (expected 0, 64, 0)\n";
+    std::cout << "Tasks run by workers = " << context.onWorkers.load() << " (depends on the scheduling)\n";
+
+    std::size_t const grain = executor.GetDefaultGrain(100000U);
+    assert(grain == (100000U / (8U * 4U)));
+    std::cout << "Default grain for 100000 indices and 3 workers = " << grain << " (expected 3125)\n";
+
+    // Each worker checks its own name and single-CPU affinity
+    struct WorkerCheck {
+        std::atomic<std::size_t> pinned{0U};
+        std::atomic<std::size_t> named{0U};
+        std::atomic<std::size_t> done{0U};
+    };
+    static WorkerCheck check{};
+    auto const inspect = [](void* raw, std::size_t, std::size_t) noexcept {
+        WorkerCheck& self = *static_cast<WorkerCheck*>(raw);
+        CpuSet affinity{};
+        if ((Thread::GetCurrentAffinity(affinity) == ara::os::interface::thread::ErrorCode::Success) &&
+            (affinity.Count() == 1U)) {
+            self.pinned.fetch_add(1U);
+        }
+        char name[16]{};
+        if ((::pthread_getname_np(::pthread_self(), name, sizeof(name)) == 0) &&
+            (std::strncmp(name, "ara_worker_", 11U) == 0)) {
+            self.named.fetch_add(1U);
+        }
+        self.done.fetch_add(1U);
+    };
+    for (std::size_t i = 0U; i < 8U; ++i) {
+        bool const submitted = executor.Submit(inspect, &check);
+        assert(submitted);
+        static_cast<void>(submitted);
+    }
+    while (check.done.load() != 8U) {
+        std::this_thread::yield();
+    }
+    assert((check.pinned.load() == 8U) && (check.named.load() == 8U));
+    std::cout << "Submitted tasks on pinned / named workers = " << check.pinned.load() << " / "
+              << check.named.load() << " (expected 8 / 8)\n";
+
+    executor.Stop();
+}
+
+/*!
+ * \brief Test #4: Nested ParallelFor() from inside tasks, Submit() and a deterministic floating-point reduce
+ */
+void TestNestedAndSubmit()
+{
+    std::cout << "\n=== Test 4: Nested ParallelFor, Submit, Deterministic Reduce ===\n";
+    Executor executor{};
+    StartWorkers(executor, 3U);
+
+    // 16 outer tasks each run an inner ParallelFor of 1000 indices on the same executor
+    struct Nested {
+        Executor*                 executor;
+        std::atomic<std::size_t>  inner;
+    };
+    static Nested nested{};
+    nested.executor = &executor;
+    auto const outerBody = [](void* raw, std::size_t begin, std::size_t end) noexcept {
+        auto const innerBody = [](void* context, std::size_t innerBegin, std::size_t innerEnd) noexcept {
+            static_cast<Nested*>(context)->inner.fetch_add(innerEnd - innerBegin);
+        };
+        for (std::size_t i = begin; i < end; ++i) {
+            static_cast<Nested*>(raw)->executor->ParallelFor(1000U, 10U, innerBody, raw);
+        }
+    };
+    executor.ParallelFor(16U, 1U, outerBody, &nested);
+    assert(nested.inner.load() == 16000U);
+    std::cout << "Nested: inner indices = " << nested.inner.load() << " (expected 16000)\n";
+
+    // Fire-and-forget tasks
+    static std::atomic<std::size_t> fired{0U};
+    for (std::size_t i = 0U; i < 100U; ++i) {
+        bool const submitted = executor.Submit([](void*, std::size_t, std::size_t) noexcept { fired.fetch_add(1U); },
+                                               nullptr);
+        assert(submitted);
+        static_cast<void>(submitted);
+    }
+    while (fired.load() != 100U) {
+        std::this_thread::yield();
+    }
+    std::cout << "Submit: tasks run = " << fired.load() << " (expected 100)\n";
+
+    // Floating-point reductions: the chunked summation order differs from the sequential one by rounding only
+    static Array<double, 50000U> values{};
+    double sequential{0.0};
+    for (std::size_t i = 0U; i < values.size(); ++i) {
+        values[i] = 1.0 / static_cast<double>(i + 1U);
+        sequential += values[i];
+    }
+    auto const plus = [](double a, double b) noexcept { return a + b; };
+    double const first = ara::core::parallel::reduce(executor, values, 0.0, plus, 100U);
+    std::size_t differences{NearlyEqual(first, sequential) ? 0U : 1U};
+    for (std::size_t run = 0U; run < 20U; ++run) {
+        differences += NearlyEqual(ara::core::parallel::reduce(executor, values, 0.0, plus, 100U), first) ? 0U : 1U;
+    }
+    assert(differences == 0U);
+    std::cout << "Harmonic sum = " << first << ", differing repetitions = " << differences << " (expected 0)\n";
+
+    executor.Stop();
+}
+
+/*!
+ * \brief Test #5: Start() / Stop() results, restart and the default worker count
+ */
+void TestStartStop()
+{
+    std::cout << "\n=== Test 5: Start / Stop ===\n";
+    Executor executor{};
+
+    ExecutorConfig tooMany{};
+    tooMany.workerCount = Executor::kMaxWorkers + 1U;
+    ExecutorErrorCode const invalid = executor.Start(tooMany);
+    assert((invalid == ExecutorErrorCode::InvalidArgument) && !executor.IsRunning());
+    std::cout << "Start with " << tooMany.workerCount << " workers = " << static_cast<int>(invalid)
+              << " (expected 2)\n";
+
+    // Default: one worker less than the CPUs of the caller, at least one
+    CpuSet affinity{};
+    static_cast<void>(Thread::GetCurrentAffinity(affinity));
+    std::size_t const cpus = affinity.Count();
+    std::size_t expected = (cpus > 1U) ? (cpus - 1U) : 1U;
+    expected = (expected > Executor::kMaxWorkers) ? Executor::kMaxWorkers : expected;
+    ExecutorErrorCode const started = executor.Start();
+    ExecutorErrorCode const again = executor.Start();
+    assert((started == ExecutorErrorCode::Success) && (again == ExecutorErrorCode::AlreadyRunning));
+    assert(executor.GetWorkerCount() == expected);
+    std::cout << "Start / Start = " << static_cast<int>(started) << " / " << static_cast<int>(again)
+              << ", workers = " << executor.GetWorkerCount() << " (expected 0 / 1, " << expected << ")\n";
+
+    executor.Stop();
+    executor.Stop();
+    assert(!executor.IsRunning() && (executor.GetWorkerCount() == 0U));
+    std::cout << "After Stop twice: running = " << executor.IsRunning() << " (expected 0)\n";
+
+    // Restart with another count; the run after the restart sees all indices
+    StartWorkers(executor, 2U);
+    std::atomic<std::size_t> count{0U};
+    executor.ParallelFor(10000U, 0U, [](void* raw, std::size_t begin, std::size_t end) noexcept {
+        static_cast<std::atomic<std::size_t>*>(raw)->fetch_add(end - begin);
+    }, &count);
+    assert((executor.GetWorkerCount() == 2U) && (count.load() == 10000U));
+    std::cout << "Restarted with " << executor.GetWorkerCount() << " workers, indices = " << count.load()
+              << " (expected 2, 10000)\n";
+    executor.Stop();
+}
+
+/*!
+ * \brief Test #6: Submit() racing Stop(): every accepted task runs before Stop() returns
+ */
+void TestSubmitDuringStop()
+{
+    std::cout << "\n=== Test 6: Submit Racing Stop ===\n";
+    constexpr std::size_t kCycles{100U};
+    constexpr std::size_t kSubmitters{2U};
+    Executor executor{};
+    static std::atomic<std::size_t> ran{0U};
+    std::atomic<std::size_t> accepted{0U};
+    std::atomic<bool> paused{false};
+    std::atomic<std::size_t> parked{0U};
+    std::atomic<bool> done{false};
+
+    auto const submitter = [&]() {
+        while (!done.load()) {
+            if (paused.load()) {
+                parked.fetch_add(1U);
+                while (paused.load()) {
+                    std::this_thread::yield();
+                }
+                parked.fetch_sub(1U);
+                continue;
+            }
+            if (executor.Submit([](void*, std::size_t, std::size_t) noexcept { ran.fetch_add(1U); }, nullptr)) {
+                accepted.fetch_add(1U);
+            }
+        }
+    };
+    std::thread first(submitter);
+    std::thread second(submitter);
+
+    // After each Stop() the submitters are parked: with no worker left, every accepted task must already have run
+    std::size_t stranded = 0U;
+    for (std::size_t cycle = 0U; cycle < kCycles; ++cycle) {
+        StartWorkers(executor, 2U);
+        std::this_thread::yield();
+        executor.Stop();
+        paused.store(true);
+        while (parked.load() != kSubmitters) {
+            std::this_thread::yield();
+        }
+        std::size_t const runNow = ran.load();
+        std::size_t const acceptedNow = accepted.load();
+        stranded += (acceptedNow > runNow) ? (acceptedNow - runNow) : 0U;
+        accepted.store(runNow);     // A stranded task would run after the next Start(): count it only once
+        paused.store(false);
+    }
+    done.store(true);
+    first.join();
+    second.join();
+
+    assert(stranded == 0U);
+    std::cout << "Cycles = " << kCycles << ", tasks run = " << ran.load() << ", accepted but not run by Stop() = "
+              << stranded << " (expected 0)\n";
+}
@@ -0,0 +1,185 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara_core_perfect_hash.cpp
+ *  \brief      Test application for the ara::core::PerfectHashMap constexpr lookup table.
+ *
+ *  \details    This file contains multiple test functions covering:
+ *              1.  A constexpr signal table: built by the compiler, lookups in constant expressions
+ *              2.  A larger compile-time table of sparse IDs: every key found, no foreign key matches
+ *              3.  Enumeration keys, a single entry and a table built at run time
+ *
+ *  \note       All variables are used, preventing compiler warnings about unused variables.
+ *********************************************************************************************************************/
+
+#include "ara/core/perfect_hash.h"  // The table under test
+#include <iostream>         // For std::cout (demonstrations)
+#include <string>           // For std::string
+#include <cassert>          // For runtime checks via assert
+#include <csignal>          // For the signal numbers
+#include <cstdint>          // For std::uint32_t
+
+using ara::core::MakePerfectHashMap;
+using ara::core::PerfectHashMap;
+
+/**********************************************************************************************************************
+ *  FORWARD DECLARATIONS
+ *********************************************************************************************************************/
+void TestSignalTable();         // Test #1
+void TestSparseIds();           // Test #2
+void TestEnumAndRuntime();      // Test #3
+
+/**********************************************************************************************************************
+ *  HELPERS
+ *********************************************************************************************************************/
+/*!
+ * \brief  Number of entries of the sparse ID table.
+ */
+constexpr std::size_t kIdCount = 200U;
+
+/*!
+ * \brief  Entries of the sparse ID table, in a C array as the PerfectHashMap constructor expects.
+ */
+struct IdEntries {
+    std::pair<std::uint32_t, std::uint32_t> values[kIdCount];
+};
+
+/*!
+ * \brief  Sparse, irregular IDs: (i * 2654435761) >> 8, mapped to i.
+ */
+constexpr auto MakeIdEntries() noexcept -> IdEntries
+{
+    IdEntries entries{};
+    for (std::uint32_t i = 0U; i < kIdCount; ++i) {
+        entries.values[i].first  = (i * 2654435761U) >> 8U;
+        entries.values[i].second = i;
+    }
+    return entries;
+}
+
+/*!
+ * \brief  Service states used as enumeration keys.
+ */
+enum class ServiceState : std::uint8_t { kOffered = 1U, kStopped = 7U, kRequested = 42U, kFailed = 200U };
+
+/**********************************************************************************************************************
+ *  MAIN AND MENU
+ *********************************************************************************************************************/
+static void PrintUsage(const char* prog) {
+    std::cout << "Usage: " << prog << " [test_number]\n"
+              << "List of Available Tests:\n"
+              << "  1  - constexpr Signal Table\n"
+              << "  2  - Sparse IDs\n"
+              << "  3  - Enumeration Keys and Run-time Tables\n";
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc != 2) {
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    std::string choice = argv[1];
+    if      (choice == "1")  TestSignalTable();
+    else if (choice == "2")  TestSparseIds();
+    else if (choice == "3")  TestEnumAndRuntime();
+    else {
+        std::cout << "Invalid test number: " << choice << "\n";
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    return 0;
+}
+
+/**********************************************************************************************************************
+ *  TEST DEFINITIONS
+ *********************************************************************************************************************/
+
+/*!
+ * \brief Test #1: A constexpr signal table: built by the compiler, lookups in constant expressions
+ */
+void TestSignalTable()
+{
+    std::cout << "\n=== Test 1: constexpr Signal Table ===\n";
+    constexpr auto kNames = MakePerfectHashMap<int, const char*>(
+        {{SIGTERM, "SIGTERM"}, {SIGINT, "SIGINT"}, {SIGABRT, "SIGABRT"}, {SIGBUS, "SIGBUS"}, {SIGILL, "SIGILL"},
+         {SIGFPE, "SIGFPE"}, {SIGSEGV, "SIGSEGV"}});
+    static_assert((kNames.size() == 7U) && (decltype(kNames)::kSlotCount == 16U));
+    static_assert(kNames.Contains(SIGSEGV) && !kNames.Contains(SIGHUP) && !kNames.Contains(0));
+    static_assert((kNames.Find(SIGKILL) == nullptr) && (kNames.at(SIGINT)[3] == 'I'));
+
+    volatile int probe = SIGTERM;
+    const char* const* name = kNames.Find(probe);
+    bool const found = (name != nullptr) && (std::string{*name} == "SIGTERM");
+
+    std::cout << "signal " << SIGTERM << " = " << (found ? *name : "?") << "\n";
+    assert(found);
+    std::cout << "[SUCCESS] The signal table is built and searched at compile time.\n";
+}
+
+/*!
+ * \brief Test #2: A larger compile-time table of sparse IDs: every key found, no foreign key matches
+ */
+void TestSparseIds()
+{
+    std::cout << "\n=== Test 2: Sparse IDs ===\n";
+    static constexpr IdEntries kEntries = MakeIdEntries();
+    static constexpr PerfectHashMap<std::uint32_t, std::uint32_t, kIdCount> kTable{kEntries.values};
+    static_assert(*kTable.Find(kEntries.values[123].first) == 123U);
+
+    bool allFound = true;
+    for (const auto& entry : kEntries.values) {
+        const std::uint32_t* value = kTable.Find(entry.first);
+        allFound = allFound && (value != nullptr) && (*value == entry.second);
+    }
+
+    std::size_t foreign = 0U;
+    for (std::uint32_t key = 0U; key < 100000U; ++key) {
+        bool const isKey = [&key]() {
+            for (const auto& entry : kEntries.values) {
+                if (entry.first == key) {
+                    return true;
+                }
+            }
+            return false;
+        }();
+        foreign += (!isKey && kTable.Contains(key)) ? 1U : 0U;
+    }
+
+    std::cout << kIdCount << " keys in " << decltype(kTable)::kSlotCount << " slots / "
+              << decltype(kTable)::kBucketCount << " buckets, foreign matches: " << foreign << "\n";
+    assert(allFound && (foreign == 0U));
+    std::cout << "[SUCCESS] Every key maps to its own slot.\n";
+}
+
+/*!
+ * \brief Test #3: Enumeration keys, a single entry and a table built at run time
+ */
+void TestEnumAndRuntime()
+{
+    std::cout << "\n=== Test 3: Enumeration Keys and Run-time Tables ===\n";
+    constexpr auto kCodes = MakePerfectHashMap<ServiceState, int>(
+        {{ServiceState::kOffered, 10}, {ServiceState::kStopped, 20}, {ServiceState::kRequested, 30}});
+    static_assert((kCodes.at(ServiceState::kRequested) == 30) && !kCodes.Contains(ServiceState::kFailed));
+
+    constexpr auto kSingle = MakePerfectHashMap<long, int>({{-5L, 1}});
+    static_assert((decltype(kSingle)::kSlotCount == 2U) && kSingle.Contains(-5L) && !kSingle.Contains(5L));
+
+    // Keys only known at run time: the table is built when the constructor runs
+    volatile std::uint32_t base = 100U;
+    std::uint32_t const first = base;
+    PerfectHashMap<std::uint32_t, std::uint32_t, 3U> const scaled{
+        {{first, first * 2U}, {first * 3U, first * 4U}, {first * 5U, first * 6U}}};
+
+    std::cout << "scaled[100] = " << scaled.at(100U) << "\n";
+    assert((scaled.at(300U) == 400U) && (scaled.Find(200U) == nullptr) && (*scaled.Find(500U) == 600U));
+    std::cout << "[SUCCESS] Enumeration keys and run-time tables work.\n";
+}
@@ -0,0 +1,377 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara_core_ring.cpp
+ *  \brief      Test application for ara::core::SpscRing and ara::core::MpmcRing.
+ *
+ *  \details    This file contains multiple test functions covering:
+ *              1.  SpscRing FIFO order, full / empty and wrap-around
+ *              2.  SpscRing PushBatch / PopBatch (partial batches, wrap-around)
+ *              3.  SpscRing with one producer and one consumer thread
+ *              4.  MpmcRing FIFO order, full / empty and batches
+ *              5.  MpmcRing with four producer and four consumer threads
+ *              6.  Move-only elements (std::unique_ptr)
+ *
+ *  \note       All variables are used, preventing compiler warnings about unused variables.
+ *********************************************************************************************************************/
+
+#include "ara/core/ring.h"  // The ring buffers
+#include <iostream>         // For std::cout (demonstrations)
+#include <string>           // For std::string
+#include <cassert>          // For runtime checks via assert
+#include <atomic>           // For std::atomic
+#include <cstdint>          // For std::uint64_t
+#include <memory>           // For std::unique_ptr
+#include <thread>           // For std::thread
+#include <vector>           // For std::vector (thread handles)
+
+using ara::core::MpmcRing;
+using ara::core::SpscRing;
+
+/**********************************************************************************************************************
+ *  FORWARD DECLARATIONS
+ *********************************************************************************************************************/
+void TestSpscBasic();           // Test #1
+void TestSpscBatch();           // Test #2
+void TestSpscConcurrent();      // Test #3
+void TestMpmcBasic();           // Test #4
+void TestMpmcConcurrent();      // Test #5
+void TestMoveOnly();            // Test #6
+
+/**********************************************************************************************************************
+ *  HELPERS
+ *********************************************************************************************************************/
+/*!
+ * \brief  Rings with static storage duration (the concurrency tests share them between threads).
+ */
+static SpscRing<std::uint64_t, 1024U> gSpscRing;
+static MpmcRing<std::uint64_t, 1024U> gMpmcRing;
+
+/**********************************************************************************************************************
+ *  MAIN AND MENU
+ *********************************************************************************************************************/
+static void PrintUsage(const char* prog) {
+    std::cout << "Usage: " << prog << " [test_number]\n"
+              << "List of Available Tests:\n"
+              << "  1  - SpscRing FIFO, Full / Empty, Wrap-Around\n"
+              << "  2  - SpscRing Batches\n"
+              << "  3  - SpscRing Producer / Consumer Threads\n"
+              << "  4  - MpmcRing FIFO, Full / Empty, Batches\n"
+              << "  5  - MpmcRing 4 Producers / 4 Consumers\n"
+              << "  6  - Move-Only Elements\n";
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc != 2) {
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    std::string choice = argv[1];
+    if      (choice == "1")  TestSpscBasic();
+    else if (choice == "2")  TestSpscBatch();
+    else if (choice == "3")  TestSpscConcurrent();
+    else if (choice == "4")  TestMpmcBasic();
+    else if (choice == "5")  TestMpmcConcurrent();
+    else if (choice == "6")  TestMoveOnly();
+    else {
+        std::cout << "Invalid test number: " << choice << "\n";
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    return 0;
+}
+
+/**********************************************************************************************************************
+ *  TEST DEFINITIONS
+ *********************************************************************************************************************/
+
+/*!
+ * \brief Test #1: SpscRing FIFO order, full / empty and wrap-around
+ */
+void TestSpscBasic()
+{
+    std::cout << "\n=== Test 1: SpscRing FIFO, Full / Empty, Wrap-Around ===\n";
+    static SpscRing<int, 4U> ring;
+    static_assert(SpscRing<int, 4U>::Capacity() == 4U, "capacity");
+
+    int value = -1;
+    bool const emptyPop = ring.TryPop(value);
+    assert(!emptyPop && (value == -1) && ring.IsEmpty());
+    std::cout << "Pop on empty ring = " << emptyPop << " (expected 0)\n";
+
+    std::size_t orderErrors = 0U;
+    std::size_t pushFailures = 0U;
+    int next = 0;
+    int expected = 0;
+    for (int lap = 0; lap < 10; ++lap) {           // 10 laps of 3 pushes / 3 pops wrap the 4-slot ring
+        for (int i = 0; i < 3; ++i) {
+            pushFailures += ring.TryPush(next++) ? 0U : 1U;
+        }
+        for (int i = 0; i < 3; ++i) {
+            bool const popped = ring.TryPop(value);
+            orderErrors += (popped && (value == expected)) ? 0U : 1U;
+            ++expected;
+        }
+    }
+    assert((pushFailures == 0U) && (orderErrors == 0U));
+    std::cout << "Wrap-around: push failures = " << pushFailures << ", order errors = " << orderErrors
+              << " (expected 0, 0)\n";
+
+    for (int i = 0; i < 4; ++i) {
+        static_cast<void>(ring.TryPush(100 + i));
+    }
+    bool const fullPush = ring.TryPush(999);
+    std::size_t const fullSize = ring.Size();
+    assert(!fullPush && (fullSize == 4U));
+    bool const popped = ring.TryPop(value);
+    assert(popped && (value == 100));
+    std::cout << "Full ring: push = " << fullPush << ", size = " << fullSize << ", pop = " << popped << ", first = " << value
+              << " (expected 0, 4, 1, 100)\n";
+}
+
+/*!
+ * \brief Test #2: SpscRing PushBatch / PopBatch
+ */
+void TestSpscBatch()
+{
+    std::cout << "\n=== Test 2: SpscRing Batches ===\n";
+    static SpscRing<std::uint64_t, 8U> ring;
+    std::uint64_t input[12]{};
+    for (std::uint64_t i = 0U; i < 12U; ++i) {
+        input[i] = i;
+    }
+
+    std::size_t const firstPush = ring.PushBatch(input, 5U);
+    std::uint64_t output[12]{};
+    std::size_t const firstPop = ring.PopBatch(output, 3U);
+    assert((firstPush == 5U) && (firstPop == 3U) && (output[0] == 0U) && (output[2] == 2U));
+
+    // 2 left; 6 free slots, so only 6 of 12 fit; the batch wraps around the end of the slots
+    std::size_t const partialPush = ring.PushBatch(input, 12U);
+    std::size_t const size = ring.Size();
+    assert((partialPush == 6U) && (size == 8U));
+    std::cout << "Pushed " << firstPush << ", popped " << firstPop << ", then pushed " << partialPush << " of 12, size = " << size
+              << " (expected 5, 3, 6, 8)\n";
+
+    std::size_t const allPop = ring.PopBatch(output, 12U);
+    bool const order = (output[0] == 3U) && (output[1] == 4U) && (output[2] == 0U) && (output[7] == 5U);
+    std::size_t const emptyPop = ring.PopBatch(output, 4U);
+    assert((allPop == 8U) && order && (emptyPop == 0U));
+    std::cout << "PopBatch(12) = " << allPop << ", order ok = " << order << ", PopBatch on empty = " << emptyPop
+              << " (expected 8, 1, 0)\n";
+}
+
+/*!
+ * \brief Test #3: SpscRing with one producer and one consumer thread
+ */
+void TestSpscConcurrent()
+{
+    std::cout << "\n=== Test 3: SpscRing Producer / Consumer Threads ===\n";
+    constexpr std::uint64_t kItems{2000000U};
+
+    std::thread producer([]() {
+        std::uint64_t next = 0U;
+        std::uint64_t batch[16]{};
+        while (next < kItems) {
+            if ((next % 3U) == 0U) {                // Mix single pushes and batches
+                if (gSpscRing.TryPush(next)) {
+                    ++next;
+                }
+            } else {
+                std::uint64_t count = 0U;
+                for (; (count < 16U) && ((next + count) < kItems); ++count) {
+                    batch[count] = next + count;
+                }
+                next += gSpscRing.PushBatch(batch, static_cast<std::size_t>(count));
+            }
+        }
+    });
+
+    std::uint64_t expected = 0U;
+    std::uint64_t orderErrors = 0U;
+    std::uint64_t sum = 0U;
+    std::uint64_t batch[32]{};
+    while (expected < kItems) {
+        std::size_t const popped = gSpscRing.PopBatch(batch, 32U);
+        for (std::size_t i = 0U; i < popped; ++i) {
+            orderErrors += (batch[i] == expected) ? 0U : 1U;
+            sum += batch[i];
+            ++expected;
+        }
+        std::uint64_t single = 0U;
+        if (gSpscRing.TryPop(single)) {
+            orderErrors += (single == expected) ? 0U : 1U;
+            sum += single;
+            ++expected;
+        }
+    }
+    producer.join();
+
+    std::uint64_t const expectedSum = (kItems * (kItems - 1U)) / 2U;
+    assert(orderErrors == 0U);
+    assert(sum == expectedSum);
+    assert(gSpscRing.IsEmpty());
+    std::cout << "Items = " << expected << ", order errors = " << orderErrors << ", sum ok = "
+              << (sum == expectedSum) << " (expected 2000000, 0, 1)\n";
+}
+
+/*!
+ * \brief Test #4: MpmcRing FIFO order, full / empty and batches
+ */
+void TestMpmcBasic()
+{
+    std::cout << "\n=== Test 4: MpmcRing FIFO, Full / Empty, Batches ===\n";
+    static MpmcRing<int, 4U> ring;
+
+    int value = -1;
+    bool const emptyPop = ring.TryPop(value);
+    assert(!emptyPop && (value == -1));
+
+    std::size_t orderErrors = 0U;
+    int expected = 0;
+    for (int next = 0; next < 30; next += 3) {
+        for (int i = 0; i < 3; ++i) {
+            orderErrors += ring.TryPush(next + i) ? 0U : 1U;
+        }
+        for (int i = 0; i < 3; ++i) {
+            orderErrors += (ring.TryPop(value) && (value == expected)) ? 0U : 1U;
+            ++expected;
+        }
+    }
+    assert(orderErrors == 0U);
+    std::cout << "Pop on empty = " << emptyPop << ", wrap-around errors = " << orderErrors << " (expected 0, 0)\n";
+
+    int input[6]{10, 11, 12, 13, 14, 15};
+    std::size_t const pushed = ring.PushBatch(input, 6U);
+    bool const fullPush = ring.TryPush(99);
+    int output[6]{};
+    std::size_t const popped = ring.PopBatch(output, 3U);
+    std::size_t const pushedAgain = ring.PushBatch(input + 4, 2U);  // Wraps around
+    std::size_t const rest = ring.PopBatch(output + 3, 6U);
+    bool const order = (output[0] == 10) && (output[2] == 12) && (output[3] == 13) && (output[4] == 14) &&
+                       (output[5] == 15);
+    assert((pushed == 4U) && !fullPush && (popped == 3U) && (pushedAgain == 2U) && (rest == 3U) && order);
+    assert(ring.IsEmpty());
+    std::cout << "PushBatch(6) = " << pushed << ", push on full = " << fullPush << ", PopBatch(3) = " << popped
+              << ", PushBatch(2) = " << pushedAgain << ", PopBatch(6) = " << rest << ", order ok = " << order
+              << " (expected 4, 0, 3, 2, 3, 1)\n";
+}
+
+/*!
+ * \brief Test #5: MpmcRing with four producer and four consumer threads
+ */
+void TestMpmcConcurrent()
+{
+    std::cout << "\n=== Test 5: MpmcRing 4 Producers / 4 Consumers ===\n";
+    constexpr std::uint64_t kProducers{4U};
+    constexpr std::uint64_t kConsumers{4U};
+    constexpr std::uint64_t kPerProducer{250000U};
+    constexpr std::uint64_t kTotal{kProducers * kPerProducer};
+
+    // Items are (producer << 32) | sequence; every consumer must see each producer's sequence increase
+    static std::uint64_t consumed[kConsumers]{};
+    static std::uint64_t sums[kConsumers]{};
+    static std::uint64_t orderErrors[kConsumers]{};
+    static std::atomic<std::uint64_t> totalConsumed{0U};
+
+    std::vector<std::thread> threads;
+    for (std::uint64_t p = 0U; p < kProducers; ++p) {
+        threads.emplace_back([p]() {
+            std::uint64_t sequence = 0U;
+            std::uint64_t batch[8]{};
+            while (sequence < kPerProducer) {
+                if ((sequence & 1U) == 0U) {
+                    if (gMpmcRing.TryPush((p << 32U) | sequence)) {
+                        ++sequence;
+                    }
+                } else {
+                    std::uint64_t count = 0U;
+                    for (; (count < 8U) && ((sequence + count) < kPerProducer); ++count) {
+                        batch[count] = (p << 32U) | (sequence + count);
+                    }
+                    sequence += gMpmcRing.PushBatch(batch, static_cast<std::size_t>(count));
+                }
+            }
+        });
+    }
+    for (std::uint64_t c = 0U; c < kConsumers; ++c) {
+        threads.emplace_back([c]() {
+            std::uint64_t last[kProducers]{};
+            bool seen[kProducers]{};
+            std::uint64_t batch[8]{};
+            while (totalConsumed.load(std::memory_order_relaxed) < kTotal) {
+                std::size_t const popped = gMpmcRing.PopBatch(batch, ((c & 1U) == 0U) ? 1U : 8U);
+                for (std::size_t i = 0U; i < popped; ++i) {
+                    std::uint64_t const producer = batch[i] >> 32U;
+                    std::uint64_t const sequence = batch[i] & 0xFFFFFFFFU;
+                    if (seen[producer] && (sequence <= last[producer])) {
+                        ++orderErrors[c];
+                    }
+                    seen[producer] = true;
+                    last[producer] = sequence;
+                    sums[c] += sequence;
+                }
+                consumed[c] += popped;
+                totalConsumed.fetch_add(popped, std::memory_order_relaxed);
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    std::uint64_t count = 0U;
+    std::uint64_t sum = 0U;
+    std::uint64_t errors = 0U;
+    for (std::uint64_t c = 0U; c < kConsumers; ++c) {
+        count += consumed[c];
+        sum += sums[c];
+        errors += orderErrors[c];
+    }
+    std::uint64_t const expectedSum = kProducers * ((kPerProducer * (kPerProducer - 1U)) / 2U);
+    assert(count == kTotal);
+    assert(sum == expectedSum);
+    assert(errors == 0U);
+    assert(gMpmcRing.IsEmpty());
+    std::cout << "Consumed = " << count << ", sum ok = " << (sum == expectedSum) << ", per-producer order errors = "
+              << errors << " (expected 1000000, 1, 0)\n";
+}
+
+/*!
+ * \brief Test #6: Move-only elements
+ */
+void TestMoveOnly()
+{
+    std::cout << "\n=== Test 6: Move-Only Elements ===\n";
+    static SpscRing<std::unique_ptr<int>, 2U> spsc;
+    static MpmcRing<std::unique_ptr<int>, 2U> mpmc;
+
+    std::unique_ptr<int> item = std::make_unique<int>(7);
+    bool const spscPush = spsc.TryPush(std::move(item));
+    std::unique_ptr<int> out;
+    bool const spscPop = spsc.TryPop(out);
+    assert(spscPush && spscPop && (item == nullptr) && (out != nullptr) && (*out == 7));
+
+    bool const mpmcPush = mpmc.TryPush(std::move(out));
+    std::unique_ptr<int> back;
+    bool const mpmcPop = mpmc.TryPop(back);
+    assert(mpmcPush && mpmcPop && (out == nullptr) && (back != nullptr) && (*back == 7));
+
+    // A failed push leaves the argument untouched
+    static_cast<void>(mpmc.TryPush(std::make_unique<int>(1)));
+    static_cast<void>(mpmc.TryPush(std::make_unique<int>(2)));
+    bool const fullPush = mpmc.TryPush(std::move(back));
+    assert(!fullPush && (back != nullptr));
+    std::cout << "SPSC push/pop = " << spscPush << spscPop << ", MPMC push/pop = " << mpmcPush << mpmcPop
+              << ", push on full = " << fullPush << ", keeps the value = " << (back != nullptr)
+              << " (expected 11, 11, 0, 1)\n";
+}
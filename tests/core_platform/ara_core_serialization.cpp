@@ -0,0 +1,308 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara_core_serialization.cpp
+ *  \brief      Test application for the ara::core::serialization wire format.
+ *
+ *  \details    This file contains multiple test functions covering:
+ *              1.  Wire traits and byte-exact images of scalars and Arrays in both byte orders
+ *              2.  Round trips of every element size, with counts covering the vector blocks and the scalar tails
+ *              3.  Nested Arrays flattened into one transfer (block copy equals the object representation)
+ *              4.  In-place WireView over an unaligned received buffer, nested sub-views, short buffers
+ *              5.  WireWriter / WireReader over a message of several members, overflow handling
+ *
+ *  \note       All variables are used, preventing compiler warnings about unused variables.
+ *********************************************************************************************************************/
+
+#include "ara/core/serialization.h"  // The serialization under test
+#include "ara/core/array.h"          // For ara::core::Array
+#include <iostream>         // For std::cout (demonstrations)
+#include <string>           // For std::string
+#include <cassert>          // For runtime checks via assert
+#include <cstdint>          // For the fixed-width integers
+#include <cstring>          // For std::memcmp
+
+using ara::core::Array;
+using ara::core::Span;
+using ara::core::serialization::ByteOrder;
+using ara::core::serialization::Deserialize;
+using ara::core::serialization::kIsWireType;
+using ara::core::serialization::kWireSize;
+using ara::core::serialization::MakeWireView;
+using ara::core::serialization::Serialize;
+using ara::core::serialization::WireReader;
+using ara::core::serialization::WireWriter;
+
+/*!
+ * \brief  Enumeration serialized as its underlying type.
+ */
+enum class Gear : std::uint16_t { kPark = 0x0102U, kDrive = 0x0304U };
+
+/**********************************************************************************************************************
+ *  FORWARD DECLARATIONS
+ *********************************************************************************************************************/
+void TestWireImages();          // Test #1
+void TestRoundTrips();          // Test #2
+void TestNestedArrays();        // Test #3
+void TestWireView();            // Test #4
+void TestWriterReader();        // Test #5
+
+/**********************************************************************************************************************
+ *  HELPERS
+ *********************************************************************************************************************/
+/*!
+ * \brief  Exact comparison that also works for floating-point types without -Wfloat-equal.
+ */
+template <typename T>
+static auto SameValue(T lhs, T rhs) -> bool
+{
+    return !(lhs < rhs) && !(rhs < lhs);
+}
+
+/*!
+ * \brief  Serializes an Array<T, N> of distinct values in \c Order and checks it against a per-element reference,
+ *         then deserializes it back.
+ */
+template <typename T, std::size_t N, ByteOrder Order>
+static auto RoundTrip() -> bool
+{
+    Array<T, N> values{};
+    for (std::size_t i = 0U; i < N; ++i) {
+        values[i] = static_cast<T>((i * 0x01020304050607ULL) + 0x1122334455667788ULL);
+    }
+    static Array<std::uint8_t, kWireSize<Array<T, N>> + 1U> wire{};
+    std::size_t const written = Serialize<Order>(values, Span<std::uint8_t>{wire.data() + 1U, kWireSize<Array<T, N>>});
+
+    // Reference: every element byte by byte, most significant first for big endian
+    bool matches = (written == (N * sizeof(T)));
+    for (std::size_t i = 0U; i < N; ++i) {
+        std::uint64_t bits{0U};
+        std::memcpy(&bits, &values[i], sizeof(T));
+        for (std::size_t byte = 0U; byte < sizeof(T); ++byte) {
+            std::size_t const shift = (Order == ByteOrder::kBigEndian) ? (sizeof(T) - 1U - byte) : byte;
+            std::uint8_t const expected = static_cast<std::uint8_t>(bits >> (8U * shift));
+            matches = matches && (wire[1U + (i * sizeof(T)) + byte] == expected);
+        }
+    }
+
+    Array<T, N> decoded{};
+    std::size_t const read = Deserialize<Order>(Span<const std::uint8_t>{wire.data() + 1U, written}, decoded);
+    return matches && (read == written) && (std::memcmp(decoded.data(), values.data(), sizeof(values)) == 0);
+}
+
+/*!
+ * \brief  RoundTrip() of T for several counts and both byte orders.
+ */
+template <typename T>
+static auto RoundTrips() -> bool
+{
+    return RoundTrip<T, 1U, ByteOrder::kBigEndian>() && RoundTrip<T, 7U, ByteOrder::kBigEndian>() &&
+           RoundTrip<T, 16U, ByteOrder::kBigEndian>() && RoundTrip<T, 33U, ByteOrder::kBigEndian>() &&
+           RoundTrip<T, 100U, ByteOrder::kBigEndian>() && RoundTrip<T, 33U, ByteOrder::kLittleEndian>();
+}
+
+/**********************************************************************************************************************
+ *  MAIN AND MENU
+ *********************************************************************************************************************/
+static void PrintUsage(const char* prog) {
+    std::cout << "Usage: " << prog << " [test_number]\n"
+              << "List of Available Tests:\n"
+              << "  1  - Wire Traits and Byte Images\n"
+              << "  2  - Round Trips (Vector Blocks and Tails)\n"
+              << "  3  - Nested Arrays\n"
+              << "  4  - In-place WireView\n"
+              << "  5  - WireWriter / WireReader\n";
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc != 2) {
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    std::string choice = argv[1];
+    if      (choice == "1")  TestWireImages();
+    else if (choice == "2")  TestRoundTrips();
+    else if (choice == "3")  TestNestedArrays();
+    else if (choice == "4")  TestWireView();
+    else if (choice == "5")  TestWriterReader();
+    else {
+        std::cout << "Invalid test number: " << choice << "\n";
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    return 0;
+}
+
+/**********************************************************************************************************************
+ *  TEST DEFINITIONS
+ *********************************************************************************************************************/
+
+/*!
+ * \brief Test #1: Wire traits and byte-exact images of scalars and Arrays in both byte orders
+ */
+void TestWireImages()
+{
+    std::cout << "\n=== Test 1: Wire Traits and Byte Images ===\n";
+    static_assert(kIsWireType<std::uint32_t> && kIsWireType<double> && kIsWireType<Gear>);
+    static_assert(!kIsWireType<bool> && !kIsWireType<std::string> && !kIsWireType<Array<bool, 4U>>);
+    static_assert((kWireSize<Array<std::uint16_t, 5U>> == 10U) && (kWireSize<Array<Array<float, 3U>, 4U>> == 48U));
+
+    Array<std::uint8_t, 8U> wire{};
+    [[maybe_unused]] std::size_t const scalar = Serialize(std::uint32_t{0x11223344U}, wire);
+    bool const bigEndian = (wire[0] == 0x11U) && (wire[1] == 0x22U) && (wire[2] == 0x33U) && (wire[3] == 0x44U);
+
+    [[maybe_unused]] std::size_t const little = Serialize<ByteOrder::kLittleEndian>(std::uint32_t{0x11223344U}, wire);
+    bool const littleEndian = (wire[0] == 0x44U) && (wire[1] == 0x33U) && (wire[2] == 0x22U) && (wire[3] == 0x11U);
+
+    Array<std::uint16_t, 2U> const pair{std::uint16_t{0xA1B2U}, std::uint16_t{0xC3D4U}};
+    [[maybe_unused]] std::size_t const array = Serialize(pair, wire);
+    bool const arrayImage = (wire[0] == 0xA1U) && (wire[1] == 0xB2U) && (wire[2] == 0xC3U) && (wire[3] == 0xD4U);
+
+    [[maybe_unused]] std::size_t const gear = Serialize(Gear::kDrive, Span<std::uint8_t>{wire.data() + 4U, 2U});
+    bool const gearImage = (wire[4] == 0x03U) && (wire[5] == 0x04U);
+
+    // A buffer too short is refused without writing
+    constexpr std::uint8_t kFill{0xEEU};
+    Array<std::uint8_t, 3U> shortBuffer{kFill, kFill, kFill};
+    std::size_t const refused = Serialize(std::uint32_t{0U}, shortBuffer);
+    bool const untouched = (shortBuffer[0] == kFill) && (shortBuffer[2] == kFill);
+
+    assert((scalar == 4U) && bigEndian && (little == 4U) && littleEndian);
+    assert((array == 4U) && arrayImage && (gear == 2U) && gearImage && (refused == 0U) && untouched);
+    std::cout << "uint32 BE/LE = " << bigEndian << littleEndian << ", Array<uint16, 2> image = " << arrayImage
+              << ", enum image = " << gearImage << ", short buffer refused = " << (refused == 0U) << "/" << untouched
+              << ", swap backend = " << ara::core::serialization::ByteSwapBackendName()
+              << " (expected 11, 1, 1, 1/1)\n";
+}
+
+/*!
+ * \brief Test #2: Round trips of every element size, with counts covering the vector blocks and the scalar tails
+ */
+void TestRoundTrips()
+{
+    std::cout << "\n=== Test 2: Round Trips (Vector Blocks and Tails) ===\n";
+    bool const u8  = RoundTrips<std::uint8_t>();
+    bool const i16 = RoundTrips<std::int16_t>();
+    bool const u32 = RoundTrips<std::uint32_t>();
+    bool const i64 = RoundTrips<std::int64_t>();
+    bool const f32 = RoundTrips<float>();
+    bool const f64 = RoundTrips<double>();
+    assert(u8 && i16 && u32 && i64 && f32 && f64);
+    std::cout << "uint8/int16/uint32/int64/float/double = " << u8 << i16 << u32 << i64 << f32 << f64
+              << " (expected 111111)\n";
+}
+
+/*!
+ * \brief Test #3: Nested Arrays flattened into one transfer (block copy equals the object representation)
+ */
+void TestNestedArrays()
+{
+    std::cout << "\n=== Test 3: Nested Arrays ===\n";
+    using Matrix = Array<Array<std::uint32_t, 3U>, 4U>;
+    Matrix matrix{};
+    for (std::size_t row = 0U; row < 4U; ++row) {
+        for (std::size_t column = 0U; column < 3U; ++column) {
+            matrix[row][column] = static_cast<std::uint32_t>((row * 0x100U) + column);
+        }
+    }
+
+    Array<std::uint8_t, kWireSize<Matrix>> native{};
+    [[maybe_unused]] std::size_t const nativeBytes = Serialize<ara::core::serialization::kNativeByteOrder>(matrix, native);
+    bool const blockCopy = (std::memcmp(native.data(), &matrix, sizeof(Matrix)) == 0);
+
+    Array<std::uint8_t, kWireSize<Matrix>> network{};
+    std::size_t const networkBytes = Serialize(matrix, network);
+    bool const flattened = (network[(5U * 4U) + 2U] == 0x01U) && (network[(5U * 4U) + 3U] == 0x02U);
+
+    Matrix decoded{};
+    [[maybe_unused]] std::size_t const read = Deserialize(network, decoded);
+    bool const same = (decoded == matrix);
+
+    assert((nativeBytes == 48U) && blockCopy && (networkBytes == 48U) && flattened && (read == 48U) && same);
+    std::cout << "4x3 uint32: " << networkBytes << " bytes, native = object bytes: " << blockCopy
+              << ", element [1][2] at flat index 5: " << flattened << ", round trip: " << same
+              << " (expected 48, 1, 1, 1)\n";
+}
+
+/*!
+ * \brief Test #4: In-place WireView over an unaligned received buffer, nested sub-views, short buffers
+ */
+void TestWireView()
+{
+    std::cout << "\n=== Test 4: In-place WireView ===\n";
+    using Samples = Array<Array<std::int16_t, 4U>, 2U>;
+    Samples samples{};
+    for (std::size_t i = 0U; i < 8U; ++i) {
+        samples[i / 4U][i % 4U] = static_cast<std::int16_t>(-1000 + static_cast<int>(i * 300U));
+    }
+
+    // The payload starts at an odd offset of the receive buffer
+    Array<std::uint8_t, 1U + kWireSize<Samples>> received{};
+    std::size_t const written = Serialize(samples, Span<std::uint8_t>{received.data() + 1U, kWireSize<Samples>});
+    auto const view = MakeWireView<Samples>(Span<const std::uint8_t>{received.data() + 1U, written});
+    assert(view.has_value());
+
+    auto const row = (*view)[1U];
+    std::int16_t const element = row[2U];
+    Array<std::int16_t, 4U> const decodedRow = row.Get();
+    Samples const whole = view->Get();
+    bool const inPlace = (view->data() == (received.data() + 1U)) && (row.data() == (received.data() + 9U));
+
+    auto const tooShort = MakeWireView<Samples>(Span<const std::uint8_t>{received.data(), kWireSize<Samples> - 1U});
+
+    assert((element == samples[1U][2U]) && (decodedRow == samples[1U]) && (whole == samples) && inPlace);
+    assert((view->size() == 2U) && (row.size() == 4U) && !tooShort.has_value());
+    std::cout << "view[1][2] = " << element << ", row and whole decode equal = " << (decodedRow == samples[1U])
+              << (whole == samples) << ", views point into the buffer = " << inPlace
+              << ", short buffer -> no view = " << !tooShort.has_value() << " (expected " << samples[1U][2U]
+              << ", 11, 1, 1)\n";
+}
+
+/*!
+ * \brief Test #5: WireWriter / WireReader over a message of several members, overflow handling
+ */
+void TestWriterReader()
+{
+    std::cout << "\n=== Test 5: WireWriter / WireReader ===\n";
+    Array<std::uint8_t, 64U> buffer{};
+    WireWriter<> writer{buffer};
+    Array<float, 3U> const position{1.5F, -2.25F, 3.0F};
+    [[maybe_unused]] bool const written = writer.Write(std::uint16_t{0x1234U}) && writer.Write(Gear::kPark) &&
+                                          writer.Write(position) && writer.Write(std::uint8_t{7U});
+    std::size_t const size = writer.GetOffset();
+
+    WireReader<> reader{writer.Written()};
+    std::uint16_t id{0U};
+    Gear gear{Gear::kDrive};
+    [[maybe_unused]] bool const header = reader.Read(id) && reader.Read(gear);
+    auto const positionView = reader.View<Array<float, 3U>>();
+    std::uint8_t flags{0U};
+    [[maybe_unused]] bool const tail = reader.Read(flags);
+    assert(reader.GetRemaining() == 0U);
+    bool const overrun = !reader.Read(flags) && !reader.Ok();
+
+    // A writer refuses a member that does not fit and every later one
+    Array<std::uint8_t, 5U> small{};
+    WireWriter<> smallWriter{small};
+    bool const first = smallWriter.Write(std::uint32_t{1U});
+    bool const second = smallWriter.Write(std::uint16_t{2U});
+    bool const third = smallWriter.Write(std::uint8_t{3U});
+
+    assert(written && (size == 17U) && header && (id == 0x1234U) && (gear == Gear::kPark));
+    assert(positionView.has_value() && (positionView->Get() == position) && SameValue((*positionView)[1U], -2.25F));
+    assert(tail && (flags == 7U) && overrun);
+    assert(first && !second && !third && !smallWriter.Ok() && (smallWriter.GetOffset() == 4U));
+    std::cout << "message = " << size << " bytes, id = 0x" << std::hex << id << std::dec
+              << ", position[1] = " << (*positionView)[1U] << ", flags = " << static_cast<int>(flags)
+              << ", read past end refused = " << overrun << ", writer overflow = " << first << second << third
+              << " (expected 17, 0x1234, -2.25, 7, 1, 100)\n";
+}
@@ -0,0 +1,371 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara_core_simd.cpp
+ *  \brief      Test application for the ara::core::simd algorithms.
+ *
+ *  \details    This file contains multiple test functions covering:
+ *              1.  Element-wise float kernels (Add, Sub, Mul, Fma, Min, Max) against a scalar reference
+ *              2.  Element-wise std::int16_t kernels, including wrap-around
+ *              3.  float reductions (Sum, Dot, ReduceMin, ReduceMax)
+ *              4.  std::int16_t reductions with std::int32_t accumulation
+ *              5.  Scalar fallback types and empty arrays
+ *
+ *              Every kernel is checked for several sizes N, so that body-only, tail-only and body + tail loops
+ *              are all exercised for the selected backend.
+ *
+ *  \note       All variables are used, preventing compiler warnings about unused variables.
+ *********************************************************************************************************************/
+
+#include "ara/core/simd.h"  // The ara::core::simd algorithms
+#include <iostream>         // For std::cout (demonstrations)
+#include <string>           // For std::string
+#include <cassert>          // For runtime checks via assert
+#include <cmath>            // For std::fabs
+#include <cstdint>          // For std::int16_t, std::int32_t, std::uint8_t
+
+/**********************************************************************************************************************
+ *  FORWARD DECLARATIONS
+ *********************************************************************************************************************/
+void TestElementWiseFloat();     // Test #1
+void TestElementWiseInt16();     // Test #2
+void TestReductionsFloat();      // Test #3
+void TestReductionsInt16();      // Test #4
+void TestScalarFallback();       // Test #5
+
+/**********************************************************************************************************************
+ *  HELPERS
+ *********************************************************************************************************************/
+/*!
+ * \brief  Returns an Array whose element i is generator(i).
+ */
+template <typename T, std::size_t N, typename Generator>
+static auto MakeArray(Generator generator) -> ara::core::Array<T, N>
+{
+    ara::core::Array<T, N> result{};
+    for (std::size_t i = 0U; i < N; ++i) {
+        result[i] = generator(i);
+    }
+    return result;
+}
+
+/*!
+ * \brief  Exact comparison that also works for floating-point types without -Wfloat-equal.
+ */
+template <typename T>
+static auto SameValue(T lhs, T rhs) -> bool
+{
+    return !(lhs < rhs) && !(rhs < lhs);
+}
+
+/*!
+ * \brief  Relative comparison for reductions whose summation order is backend-defined.
+ */
+static auto NearlyEqual(float lhs, float rhs) -> bool
+{
+    float const scale = std::fabs(lhs) > 1.0F ? std::fabs(lhs) : 1.0F;
+    return std::fabs(lhs - rhs) <= (1e-5F * scale);
+}
+
+/*!
+ * \brief  Checks every element-wise float kernel for one size N; returns the number of mismatches.
+ */
+template <std::size_t N>
+static auto CheckElementWiseFloat() -> std::size_t
+{
+    auto const a = MakeArray<float, N>([](std::size_t i) { return static_cast<float>(i) * 0.5F - 3.0F; });
+    auto const b = MakeArray<float, N>([](std::size_t i) { return 7.0F - static_cast<float>(i % 11U); });
+    auto const c = MakeArray<float, N>([](std::size_t i) { return static_cast<float>(i % 3U); });
+
+    auto const sum  = ara::core::simd::Add(a, b);
+    auto const diff = ara::core::simd::Sub(a, b);
+    auto const prod = ara::core::simd::Mul(a, b);
+    auto const fma  = ara::core::simd::Fma(a, b, c);
+    auto const mn   = ara::core::simd::Min(a, b);
+    auto const mx   = ara::core::simd::Max(a, b);
+
+    std::size_t mismatches = 0U;
+    for (std::size_t i = 0U; i < N; ++i) {
+        // Inputs are multiples of 0.5 in a small range => all results are exact, fused or not
+        mismatches += SameValue(sum[i],  a[i] + b[i]) ? 0U : 1U;
+        mismatches += SameValue(diff[i], a[i] - b[i]) ? 0U : 1U;
+        mismatches += SameValue(prod[i], a[i] * b[i]) ? 0U : 1U;
+        mismatches += SameValue(fma[i],  a[i] * b[i] + c[i]) ? 0U : 1U;
+        mismatches += SameValue(mn[i],   (b[i] < a[i]) ? b[i] : a[i]) ? 0U : 1U;
+        mismatches += SameValue(mx[i],   (b[i] > a[i]) ? b[i] : a[i]) ? 0U : 1U;
+    }
+    std::cout << "  N = " << N << ": mismatches = " << mismatches << " (expected 0)\n";
+    return mismatches;
+}
+
+/*!
+ * \brief  Checks every element-wise int16_t kernel for one size N; returns the number of mismatches.
+ */
+template <std::size_t N>
+static auto CheckElementWiseInt16() -> std::size_t
+{
+    using I16 = std::int16_t;
+    auto const a = MakeArray<I16, N>([](std::size_t i) { return static_cast<I16>(static_cast<int>(i * 997U) - 30000); });
+    auto const b = MakeArray<I16, N>([](std::size_t i) { return static_cast<I16>(32000 - static_cast<int>(i * 389U)); });
+    auto const c = MakeArray<I16, N>([](std::size_t i) { return static_cast<I16>(static_cast<int>(i % 7U) - 3); });
+
+    auto const sum  = ara::core::simd::Add(a, b);
+    auto const diff = ara::core::simd::Sub(a, b);
+    auto const prod = ara::core::simd::Mul(a, b);
+    auto const fma  = ara::core::simd::Fma(a, b, c);
+    auto const mn   = ara::core::simd::Min(a, b);
+    auto const mx   = ara::core::simd::Max(a, b);
+
+    std::size_t mismatches = 0U;
+    for (std::size_t i = 0U; i < N; ++i) {
+        int const x = a[i];
+        int const y = b[i];
+        int const z = c[i];
+        mismatches += (sum[i]  == static_cast<I16>(static_cast<std::uint16_t>(x + y))) ? 0U : 1U;
+        mismatches += (diff[i] == static_cast<I16>(static_cast<std::uint16_t>(x - y))) ? 0U : 1U;
+        mismatches += (prod[i] == static_cast<I16>(static_cast<std::uint16_t>((x * y) & 0xFFFF))) ? 0U : 1U;
+        mismatches += (fma[i]  == static_cast<I16>(static_cast<std::uint16_t>(((x * y) + z) & 0xFFFF))) ? 0U : 1U;
+        mismatches += (mn[i]   == ((y < x) ? b[i] : a[i])) ? 0U : 1U;
+        mismatches += (mx[i]   == ((y > x) ? b[i] : a[i])) ? 0U : 1U;
+    }
+    std::cout << "  N = " << N << ": mismatches = " << mismatches << " (expected 0)\n";
+    return mismatches;
+}
+
+/*!
+ * \brief  Checks the float reductions for one size N; returns the number of mismatches.
+ */
+template <std::size_t N>
+static auto CheckReductionsFloat() -> std::size_t
+{
+    auto const a = MakeArray<float, N>([](std::size_t i) { return static_cast<float>((i * 37U) % 101U) * 0.25F - 12.0F; });
+    auto const b = MakeArray<float, N>([](std::size_t i) { return static_cast<float>(i % 9U) - 4.0F; });
+
+    float refSum = 0.0F;
+    float refDot = 0.0F;
+    float refMin = a[0];
+    float refMax = a[0];
+    for (std::size_t i = 0U; i < N; ++i) {
+        refSum += a[i];
+        refDot += a[i] * b[i];
+        refMin = (a[i] < refMin) ? a[i] : refMin;
+        refMax = (a[i] > refMax) ? a[i] : refMax;
+    }
+
+    float const sum = ara::core::simd::Sum(a);
+    float const dot = ara::core::simd::Dot(a, b);
+    float const mn  = ara::core::simd::ReduceMin(a);
+    float const mx  = ara::core::simd::ReduceMax(a);
+
+    std::size_t mismatches = 0U;
+    mismatches += NearlyEqual(sum, refSum) ? 0U : 1U;
+    mismatches += NearlyEqual(dot, refDot) ? 0U : 1U;
+    mismatches += SameValue(mn, refMin) ? 0U : 1U;
+    mismatches += SameValue(mx, refMax) ? 0U : 1U;
+    std::cout << "  N = " << N << ": sum = " << sum << " (expected " << refSum << "), dot = " << dot
+              << " (expected " << refDot << "), min = " << mn << ", max = " << mx << "\n";
+    return mismatches;
+}
+
+/*!
+ * \brief  Checks the int16_t reductions for one size N; returns the number of mismatches.
+ */
+template <std::size_t N>
+static auto CheckReductionsInt16() -> std::size_t
+{
+    using I16 = std::int16_t;
+    auto const a = MakeArray<I16, N>([](std::size_t i) { return static_cast<I16>(30000 - static_cast<int>((i * 7919U) % 60001U)); });
+    auto const b = MakeArray<I16, N>([](std::size_t i) { return static_cast<I16>(static_cast<int>(i % 13U) - 6); });
+
+    std::int32_t refSum = 0;
+    std::int32_t refDot = 0;
+    I16 refMin = a[0];
+    I16 refMax = a[0];
+    for (std::size_t i = 0U; i < N; ++i) {
+        refSum += a[i];
+        refDot += static_cast<std::int32_t>(a[i]) * b[i];
+        refMin = (a[i] < refMin) ? a[i] : refMin;
+        refMax = (a[i] > refMax) ? a[i] : refMax;
+    }
+
+    std::int32_t const sum = ara::core::simd::Sum(a);
+    std::int32_t const dot = ara::core::simd::Dot(a, b);
+    I16 const mn = ara::core::simd::ReduceMin(a);
+    I16 const mx = ara::core::simd::ReduceMax(a);
+
+    std::size_t mismatches = 0U;
+    mismatches += (sum == refSum) ? 0U : 1U;
+    mismatches += (dot == refDot) ? 0U : 1U;
+    mismatches += (mn == refMin) ? 0U : 1U;
+    mismatches += (mx == refMax) ? 0U : 1U;
+    std::cout << "  N = " << N << ": sum = " << sum << " (expected " << refSum << "), dot = " << dot
+              << " (expected " << refDot << "), min = " << mn << ", max = " << mx << "\n";
+    return mismatches;
+}
+
+/**********************************************************************************************************************
+ *  MAIN AND MENU
+ *********************************************************************************************************************/
+static void PrintUsage(const char* prog) {
+    std::cout << "Usage: " << prog << " [test_number]\n"
+              << "List of Available Tests:\n"
+              << "  1  - Element-Wise float Kernels\n"
+              << "  2  - Element-Wise int16_t Kernels\n"
+              << "  3  - float Reductions\n"
+              << "  4  - int16_t Reductions\n"
+              << "  5  - Scalar Fallback and Empty Arrays\n";
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc != 2) {
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    std::string choice = argv[1];
+    if      (choice == "1")  TestElementWiseFloat();
+    else if (choice == "2")  TestElementWiseInt16();
+    else if (choice == "3")  TestReductionsFloat();
+    else if (choice == "4")  TestReductionsInt16();
+    else if (choice == "5")  TestScalarFallback();
+    else {
+        std::cout << "Invalid test number: " << choice << "\n";
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    return 0;
+}
+
+/**********************************************************************************************************************
+ *  TEST DEFINITIONS
+ *********************************************************************************************************************/
+
+/*!
+ * \brief Test #1: Element-wise float kernels against a scalar reference
+ */
+void TestElementWiseFloat()
+{
+    std::cout << "\n=== Test 1: Element-Wise float Kernels (backend: "
+              << ara::core::simd::BackendName<float>() << ") ===\n";
+    std::size_t mismatches = 0U;
+    mismatches += CheckElementWiseFloat<1>();
+    mismatches += CheckElementWiseFloat<3>();
+    mismatches += CheckElementWiseFloat<4>();
+    mismatches += CheckElementWiseFloat<8>();
+    mismatches += CheckElementWiseFloat<16>();
+    mismatches += CheckElementWiseFloat<19>();
+    mismatches += CheckElementWiseFloat<64>();
+    mismatches += CheckElementWiseFloat<101>();
+    std::cout << "Total mismatches = " << mismatches << " (expected 0)\n";
+    assert(mismatches == 0U);
+}
+
+/*!
+ * \brief Test #2: Element-wise int16_t kernels, including wrap-around
+ */
+void TestElementWiseInt16()
+{
+    std::cout << "\n=== Test 2: Element-Wise int16_t Kernels (backend: "
+              << ara::core::simd::BackendName<std::int16_t>() << ") ===\n";
+    std::size_t mismatches = 0U;
+    mismatches += CheckElementWiseInt16<1>();
+    mismatches += CheckElementWiseInt16<7>();
+    mismatches += CheckElementWiseInt16<8>();
+    mismatches += CheckElementWiseInt16<16>();
+    mismatches += CheckElementWiseInt16<32>();
+    mismatches += CheckElementWiseInt16<45>();
+    mismatches += CheckElementWiseInt16<256>();
+    std::cout << "Total mismatches = " << mismatches << " (expected 0)\n";
+    assert(mismatches == 0U);
+}
+
+/*!
+ * \brief Test #3: float reductions (Sum, Dot, ReduceMin, ReduceMax)
+ */
+void TestReductionsFloat()
+{
+    std::cout << "\n=== Test 3: float Reductions (backend: "
+              << ara::core::simd::BackendName<float>() << ") ===\n";
+    std::size_t mismatches = 0U;
+    mismatches += CheckReductionsFloat<1>();
+    mismatches += CheckReductionsFloat<5>();
+    mismatches += CheckReductionsFloat<16>();
+    mismatches += CheckReductionsFloat<33>();
+    mismatches += CheckReductionsFloat<128>();
+    mismatches += CheckReductionsFloat<1000>();
+    std::cout << "Total mismatches = " << mismatches << " (expected 0)\n";
+    assert(mismatches == 0U);
+}
+
+/*!
+ * \brief Test #4: int16_t reductions with int32_t accumulation
+ */
+void TestReductionsInt16()
+{
+    std::cout << "\n=== Test 4: int16_t Reductions (backend: "
+              << ara::core::simd::BackendName<std::int16_t>() << ") ===\n";
+    std::size_t mismatches = 0U;
+    mismatches += CheckReductionsInt16<1>();
+    mismatches += CheckReductionsInt16<9>();
+    mismatches += CheckReductionsInt16<32>();
+    mismatches += CheckReductionsInt16<67>();
+    mismatches += CheckReductionsInt16<512>();
+    mismatches += CheckReductionsInt16<2048>();
+
+    // The int32 accumulator must hold sums far outside the int16_t range
+    ara::core::Array<std::int16_t, 100> large{};
+    large.fill(30000);
+    std::int32_t const largeSum = ara::core::simd::Sum(large);
+    std::cout << "Sum of 100 x 30000 = " << largeSum << " (expected 3000000)\n";
+    mismatches += (largeSum == 3000000) ? 0U : 1U;
+
+    std::cout << "Total mismatches = " << mismatches << " (expected 0)\n";
+    assert(mismatches == 0U);
+}
+
+/*!
+ * \brief Test #5: Scalar fallback types and empty arrays
+ */
+void TestScalarFallback()
+{
+    std::cout << "\n=== Test 5: Scalar Fallback and Empty Arrays ===\n";
+    std::cout << "backend for double = " << ara::core::simd::BackendName<double>()
+              << ", for std::int32_t = " << ara::core::simd::BackendName<std::int32_t>() << " (expected scalar)\n";
+    assert(ara::core::simd::BackendName<double>() == "scalar");
+
+    ara::core::Array<double, 5> d1 = {1.0, 2.0, 3.0, 4.0, 5.0};
+    ara::core::Array<double, 5> d2 = {5.0, 4.0, 3.0, 2.0, 1.0};
+    double const dot = ara::core::simd::Dot(d1, d2);
+    std::cout << "Dot(double) = " << dot << " (expected 35)\n";
+    assert(SameValue(dot, 35.0));
+    assert(SameValue(ara::core::simd::ReduceMax(ara::core::simd::Min(d1, d2)), 3.0));
+
+    ara::core::Array<std::int32_t, 4> i1 = {1, -2, 3, -4};
+    auto const squared = ara::core::simd::Mul(i1, i1);
+    std::int32_t const total = ara::core::simd::Sum(squared);
+    std::cout << "Sum of squares (int32_t) = " << total << " (expected 30)\n";
+    assert(total == 30);
+
+    // uint8_t accumulates in uint32_t
+    ara::core::Array<std::uint8_t, 300> bytes{};
+    bytes.fill(std::uint8_t{255});
+    std::uint32_t const byteSum = ara::core::simd::Sum(bytes);
+    std::cout << "Sum of 300 x 255 (uint8_t) = " << byteSum << " (expected 76500)\n";
+    assert(byteSum == 76500U);
+
+    // Empty arrays: reductions return 0, element-wise kernels return empty arrays
+    ara::core::Array<float, 0> empty{};
+    float const emptySum = ara::core::simd::Sum(empty);
+    auto const emptyAdd = ara::core::simd::Add(empty, empty);
+    std::cout << "Sum(empty) = " << emptySum << ", Add(empty).size() = " << emptyAdd.size() << " (expected 0, 0)\n";
+    assert(SameValue(emptySum, 0.0F));
+    assert(emptyAdd.empty());
+}
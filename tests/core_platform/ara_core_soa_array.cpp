@@ -0,0 +1,249 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara_core_soa_array.cpp
+ *  \brief      Test application for the ara::core::SoaArray structure-of-arrays container.
+ *
+ *  \details    This file contains multiple test functions covering:
+ *              1.  Field lookup by tag, column types and the cache-line alignment of every column
+ *              2.  Row proxies: element references, Assign / Load, range-for over the rows
+ *              3.  Columns as ara::core::simd operands and as static-extent Spans
+ *              4.  Read-only access through a const SoaArray, checked at()
+ *
+ *  \note       All variables are used, preventing compiler warnings about unused variables.
+ *********************************************************************************************************************/
+
+#include "ara/core/soa_array.h"  // The container under test
+#include "ara/core/simd.h"       // For ara::core::simd kernels over the columns
+#include <iostream>         // For std::cout (demonstrations)
+#include <string>           // For std::string
+#include <cassert>          // For runtime checks via assert
+#include <cmath>            // For std::fabs
+#include <cstdint>          // For std::uint8_t, std::uint32_t, std::uintptr_t
+#include <tuple>            // For std::get
+#include <type_traits>      // For std::is_same_v
+
+using ara::core::Array;
+using ara::core::SoaArray;
+using ara::core::SoaField;
+using ara::core::Span;
+
+/*!
+ * \brief  Field tags of the test record.
+ */
+struct PosX {};
+struct PosY {};
+struct Id {};
+struct Valid {};
+
+using Tracks = SoaArray<37U, SoaField<PosX, float>, SoaField<PosY, float>, SoaField<Id, std::uint32_t>,
+                        SoaField<Valid, std::uint8_t>>;
+
+/**********************************************************************************************************************
+ *  FORWARD DECLARATIONS
+ *********************************************************************************************************************/
+void TestLayout();              // Test #1
+void TestRows();                // Test #2
+void TestColumns();             // Test #3
+void TestConstAccess();         // Test #4
+
+/**********************************************************************************************************************
+ *  HELPERS
+ *********************************************************************************************************************/
+/*!
+ * \brief  Whether \c pointer lies on a cache-line boundary.
+ */
+static auto IsCacheLineAligned(const void* pointer) -> bool
+{
+    return (reinterpret_cast<std::uintptr_t>(pointer) % ara::core::kConstructiveInterferenceSize) == 0U;
+}
+
+/*!
+ * \brief  Exact comparison that also works for floating-point types without -Wfloat-equal.
+ */
+template <typename T>
+static auto SameValue(T lhs, T rhs) -> bool
+{
+    return !(lhs < rhs) && !(rhs < lhs);
+}
+
+/*!
+ * \brief  Relative comparison for reductions whose summation order is backend-defined.
+ */
+[[maybe_unused]] static auto NearlyEqual(float lhs, float rhs) -> bool
+{
+    float const scale = std::fabs(lhs) > 1.0F ? std::fabs(lhs) : 1.0F;
+    return std::fabs(lhs - rhs) <= (1e-5F * scale);
+}
+
+/*!
+ * \brief  Fills every row of \c tracks with values derived from the row index.
+ */
+static auto FillTracks(Tracks& tracks) -> void
+{
+    for (auto row : tracks) {
+        std::size_t const i = row.GetIndex();
+        row.Assign(static_cast<float>(i), static_cast<float>(2U * i), static_cast<std::uint32_t>(1000U + i),
+                   static_cast<std::uint8_t>(i % 2U));
+    }
+}
+
+/**********************************************************************************************************************
+ *  MAIN AND MENU
+ *********************************************************************************************************************/
+static void PrintUsage(const char* prog) {
+    std::cout << "Usage: " << prog << " [test_number]\n"
+              << "List of Available Tests:\n"
+              << "  1  - Field Lookup and Layout\n"
+              << "  2  - Row Proxies\n"
+              << "  3  - Columns as SIMD Operands and Spans\n"
+              << "  4  - Const Access\n";
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc != 2) {
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    std::string choice = argv[1];
+    if      (choice == "1")  TestLayout();
+    else if (choice == "2")  TestRows();
+    else if (choice == "3")  TestColumns();
+    else if (choice == "4")  TestConstAccess();
+    else {
+        std::cout << "Invalid test number: " << choice << "\n";
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    return 0;
+}
+
+/**********************************************************************************************************************
+ *  TEST DEFINITIONS
+ *********************************************************************************************************************/
+
+/*!
+ * \brief Test #1: Field lookup by tag, column types and the cache-line alignment of every column
+ */
+void TestLayout()
+{
+    std::cout << "\n=== Test 1: Field Lookup and Layout ===\n";
+    static_assert((Tracks::kFieldCount == 4U) && (Tracks::size() == 37U));
+    static_assert((Tracks::kIndexOf<PosX> == 0U) && (Tracks::kIndexOf<Id> == 2U) && (Tracks::kIndexOf<Valid> == 3U));
+    static_assert(std::is_same_v<Tracks::FieldType<Id>, std::uint32_t>);
+    static_assert(std::is_same_v<decltype(std::declval<Tracks&>().Column<PosY>()), Array<float, 37U>&>);
+    static_assert(std::is_same_v<decltype(std::declval<const Tracks&>().ColumnSpan<Valid>()),
+                                 Span<const std::uint8_t, 37U>>);
+    static_assert((alignof(Tracks) == ara::core::kConstructiveInterferenceSize) && (sizeof(Tracks) == (3U * 192U) + 64U));
+
+    static Tracks tracks{};
+    bool const aligned = IsCacheLineAligned(tracks.Column<PosX>().data()) &&
+                         IsCacheLineAligned(tracks.Column<PosY>().data()) &&
+                         IsCacheLineAligned(tracks.Column<Id>().data()) &&
+                         IsCacheLineAligned(tracks.Column<Valid>().data());
+
+    std::cout << "sizeof(Tracks) = " << sizeof(Tracks) << ", columns aligned: " << aligned << "\n";
+    assert(aligned);
+    assert(SameValue(tracks.Get<PosX>(0U), 0.0F) && (tracks.Get<Id>(36U) == 0U));
+    std::cout << "[SUCCESS] Fields are found by tag and every column starts on its own cache line.\n";
+}
+
+/*!
+ * \brief Test #2: Row proxies: element references, Assign / Load, range-for over the rows
+ */
+void TestRows()
+{
+    std::cout << "\n=== Test 2: Row Proxies ===\n";
+    static Tracks tracks{};
+    FillTracks(tracks);
+
+    // A row proxy references the elements in the columns
+    Tracks::Row row = tracks[5U];
+    row.Get<PosY>() += 0.5F;
+    assert(SameValue(tracks.Get<PosY>(5U), 10.5F) && (tracks.Column<Id>()[5U] == 1005U));
+
+    auto const values = tracks[7U].Load();
+    assert(SameValue(std::get<0>(values), 7.0F) && SameValue(std::get<1>(values), 14.0F));
+    assert((std::get<2>(values) == 1007U) && (std::get<3>(values) == 1U));
+
+    // Range-for visits every row once, in order
+    std::size_t visited = 0U;
+    std::uint32_t validIds = 0U;
+    for (auto current : tracks) {
+        visited += (current.GetIndex() == visited) ? 1U : 0U;
+        if (current.Get<Valid>() != 0U) {
+            ++validIds;
+            current.Get<Id>() = 0U;
+        }
+    }
+    assert((visited == Tracks::size()) && (validIds == 18U));
+    assert((tracks.Get<Id>(1U) == 0U) && (tracks.Get<Id>(2U) == 1002U));
+
+    std::cout << "row 7 = (" << std::get<0>(values) << ", " << std::get<1>(values) << ", " << std::get<2>(values)
+              << "), valid rows = " << validIds << "\n";
+    std::cout << "[SUCCESS] Row proxies read and write the elements in place.\n";
+}
+
+/*!
+ * \brief Test #3: Columns as ara::core::simd operands and as static-extent Spans
+ */
+void TestColumns()
+{
+    std::cout << "\n=== Test 3: Columns as SIMD Operands and Spans ===\n";
+    static Tracks tracks{};
+    FillTracks(tracks);
+
+    // Kernels run on whole columns; the result is written back to a column
+    float const dot = ara::core::simd::Dot(tracks.Column<PosX>(), tracks.Column<PosY>());
+    float expected = 0.0F;
+    for (std::size_t i = 0U; i < Tracks::size(); ++i) {
+        expected += tracks.Get<PosX>(i) * tracks.Get<PosY>(i);
+    }
+    tracks.Column<PosX>() = ara::core::simd::Add(tracks.Column<PosX>(), tracks.Column<PosY>());
+    assert(NearlyEqual(dot, expected) && SameValue(tracks.Get<PosX>(36U), 108.0F));
+
+    // A Span aliases the column
+    Span<std::uint32_t, Tracks::size()> ids = tracks.ColumnSpan<Id>();
+    ids[3U] = 42U;
+    assert((ids.size() == Tracks::size()) && (tracks[3U].Get<Id>() == 42U));
+    assert(ids.data() == tracks.Column<Id>().data());
+
+    tracks.Fill<Valid>(std::uint8_t{1U});
+    assert(ara::core::simd::Sum(tracks.Column<Valid>()) == 37U);
+
+    std::cout << "dot(PosX, PosY) = " << dot << "\n";
+    std::cout << "[SUCCESS] Columns feed the SIMD kernels and Spans without copies.\n";
+}
+
+/*!
+ * \brief Test #4: Read-only access through a const SoaArray, checked at()
+ */
+void TestConstAccess()
+{
+    std::cout << "\n=== Test 4: Const Access ===\n";
+    static Tracks tracks{};
+    FillTracks(tracks);
+    const Tracks& view = tracks;
+
+    static_assert(std::is_same_v<decltype(view[0U].Get<PosX>()), const float&>);
+    static_assert(std::is_same_v<decltype(*view.begin()), Tracks::ConstRow>);
+
+    float sum = 0.0F;
+    for (auto row : view) {
+        sum += row.Get<PosX>();
+    }
+
+    std::cout << "sum(PosX) = " << sum << "\n";
+    assert(SameValue(sum, 666.0F));
+    assert((view.at(36U).Get<Id>() == 1036U) && (tracks.at(0U).GetIndex() == 0U));
+    std::cout << "[SUCCESS] A const SoaArray yields read-only rows.\n";
+}
@@ -0,0 +1,340 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara_core_span.cpp
+ *  \brief      Test application for the ara::core::Span template class.
+ *
+ *  \details    This file contains multiple test functions covering:
+ *              1.  Construction (Array, built-in array, pointer / count, pointer range, container) and layout
+ *              2.  Static sub-views first<K>(), last<K>(), subspan<O, K>() and their compile-time extents
+ *              3.  Run-time sub-views and conversions (static <-> dynamic, mutable -> const)
+ *              4.  Zero-copy Span<const T, N> parameters over ara::core::Array<T, N>
+ *              5.  Iterators, as_bytes() / as_writable_bytes(), MakeSpan() and deduction guides
+ *              6.  Violation handling (operator[] out of range)
+ *              7.  Violation handling (static extent over a sequence of another length)
+ *
+ *  \note       All variables are used, preventing compiler warnings about unused variables.
+ *********************************************************************************************************************/
+
+#include "ara/core/span.h"  // The Span implementation header
+#include <iostream>         // For std::cout (demonstrations)
+#include <string>           // For std::string
+#include <cassert>          // For runtime checks via assert
+#include <cstddef>          // For std::size_t, std::byte
+#include <cstdint>          // For std::uint32_t
+#include <type_traits>      // For std::is_same_v
+#include <vector>           // For std::vector (contiguous container)
+
+using ara::core::Array;
+using ara::core::dynamic_extent;
+using ara::core::Span;
+
+/**********************************************************************************************************************
+ *  FORWARD DECLARATIONS
+ *********************************************************************************************************************/
+void TestConstruction();        // Test #1
+void TestStaticSubviews();      // Test #2
+void TestDynamicSubviews();     // Test #3
+void TestZeroCopyParameters();  // Test #4
+void TestIteratorsAndBytes();   // Test #5
+void TestIndexViolation();      // Test #6
+void TestExtentViolation();     // Test #7
+
+/**********************************************************************************************************************
+ *  HELPERS
+ *********************************************************************************************************************/
+/*!
+ * \brief  A signal-processing style function: fixed window, no template on the container, no copy.
+ */
+static auto Energy(Span<const float, 8U> window) noexcept -> float
+{
+    float sum = 0.0F;
+    for (std::size_t i = 0U; i < window.size(); ++i) {
+        sum += window[i] * window[i];
+    }
+    return sum;
+}
+
+/*!
+ * \brief  A function over any number of elements (dynamic extent).
+ */
+static auto Sum(Span<const std::uint32_t> values) noexcept -> std::uint32_t
+{
+    std::uint32_t sum = 0U;
+    for (std::uint32_t const value : values) {
+        sum += value;
+    }
+    return sum;
+}
+
+/**********************************************************************************************************************
+ *  MAIN AND MENU
+ *********************************************************************************************************************/
+static void PrintUsage(const char* prog) {
+    std::cout << "Usage: " << prog << " [test_number]\n"
+              << "List of Available Tests:\n"
+              << "  1  - Construction and Layout\n"
+              << "  2  - Static Sub-Views (first<K>, last<K>, subspan<O, K>)\n"
+              << "  3  - Run-Time Sub-Views and Conversions\n"
+              << "  4  - Zero-Copy Span Parameters over Array\n"
+              << "  5  - Iterators, as_bytes, MakeSpan, Deduction Guides\n"
+              << "  6  - Violation Handling (operator[] out of range)\n"
+              << "  7  - Violation Handling (extent mismatch)\n";
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc != 2) {
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    std::string choice = argv[1];
+    if      (choice == "1")  TestConstruction();
+    else if (choice == "2")  TestStaticSubviews();
+    else if (choice == "3")  TestDynamicSubviews();
+    else if (choice == "4")  TestZeroCopyParameters();
+    else if (choice == "5")  TestIteratorsAndBytes();
+    else if (choice == "6")  TestIndexViolation();
+    else if (choice == "7")  TestExtentViolation();
+    else {
+        std::cout << "Invalid test number.\n";
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    return 0;
+}
+
+/**********************************************************************************************************************
+ *  TEST IMPLEMENTATIONS
+ *********************************************************************************************************************/
+/*!
+ * \brief Test #1: Construction and layout
+ */
+void TestConstruction()
+{
+    std::cout << "\n=== Test 1: Construction and Layout ===\n";
+
+    // A static extent stores only the pointer
+    static_assert(sizeof(Span<int, 4U>) == sizeof(int*));
+    static_assert(sizeof(Span<int>) == (sizeof(int*) + sizeof(std::size_t)));
+    static_assert(Span<int, 4U>::extent == 4U);
+    static_assert(Span<int>::extent == dynamic_extent);
+
+    Array<int, 4> arr = {1, 2, 3, 4};
+    Span<int, 4U> const fromArray{arr};
+    Span<const int> const fromArrayDynamic{arr};
+    int raw[3] = {5, 6, 7};
+    Span<int, 3U> const fromRaw{raw};
+    Span<int> const fromPointer{raw, 2U};
+    Span<int, 2U> const fromRange{raw + 1, raw + 3};
+    std::vector<int> vec{8, 9};
+    Span<const int> const fromVector{vec};
+    Span<int> const empty{};
+
+    assert((fromArray.data() == arr.data()) && (fromArray.size() == 4U));
+    assert((fromArrayDynamic.data() == arr.data()) && (fromArrayDynamic.size() == 4U));
+    assert((fromRaw[2] == 7) && (fromPointer.size() == 2U) && (fromRange[0] == 6) && (fromRange[1] == 7));
+    assert((fromVector.size() == 2U) && (fromVector[1] == 9));
+    assert(empty.empty() && (empty.data() == nullptr));
+
+    // Writes go through to the viewed Array
+    fromArray[0] = 10;
+    assert(arr[0] == 10);
+
+    std::cout << "Array view: data shared = " << (fromArray.data() == arr.data()) << ", size = " << fromArray.size()
+              << " (expected 1, 4)\n"
+              << "Raw / pointer / range / vector: " << fromRaw[2] << ", " << fromPointer.size() << ", "
+              << fromRange[0] << fromRange[1] << ", " << fromVector[1] << " (expected 7, 2, 67, 9)\n"
+              << "Empty span: " << empty.empty() << ", write-through arr[0] = " << arr[0] << " (expected 1, 10)\n";
+}
+
+/*!
+ * \brief Test #2: Static sub-views keep their extent at compile time
+ */
+void TestStaticSubviews()
+{
+    std::cout << "\n=== Test 2: Static Sub-Views ===\n";
+    static constexpr Array<std::uint32_t, 8> kTable = {1U, 2U, 3U, 4U, 5U, 6U, 7U, 8U};
+    constexpr Span<const std::uint32_t, 8U> kView{kTable};
+
+    constexpr auto kHead = kView.first<3U>();
+    constexpr auto kTail = kView.last<2U>();
+    constexpr auto kMiddle = kView.subspan<2U, 4U>();
+    constexpr auto kRest = kView.subspan<5U>();
+
+    static_assert(std::is_same_v<decltype(kHead), const Span<const std::uint32_t, 3U>>);
+    static_assert(std::is_same_v<decltype(kTail), const Span<const std::uint32_t, 2U>>);
+    static_assert(std::is_same_v<decltype(kMiddle), const Span<const std::uint32_t, 4U>>);
+    static_assert(std::is_same_v<decltype(kRest), const Span<const std::uint32_t, 3U>>);
+
+    // Evaluated at compile time, including the element access checks
+    static_assert((kHead[0] == 1U) && (kHead[2] == 3U));
+    static_assert((kTail[0] == 7U) && (kTail[1] == 8U));
+    static_assert((kMiddle.front() == 3U) && (kMiddle.back() == 6U));
+    static_assert((kRest.size() == 3U) && (kRest[0] == 6U));
+
+    // A dynamic span yields static sub-views too (checked at run time)
+    Span<const std::uint32_t> const dynamicView{kTable};
+    auto const head = dynamicView.first<2U>();
+    auto const window = dynamicView.subspan<4U, 2U>();
+    static_assert(std::is_same_v<decltype(head), const Span<const std::uint32_t, 2U>>);
+    static_assert(std::is_same_v<decltype(window), const Span<const std::uint32_t, 2U>>);
+    assert((head[1] == 2U) && (window[0] == 5U) && (window[1] == 6U));
+
+    std::cout << "first<3> = " << kHead[0] << kHead[1] << kHead[2] << ", last<2> = " << kTail[0] << kTail[1]
+              << ", subspan<2,4> = " << kMiddle.front() << ".." << kMiddle.back() << ", subspan<5> size = "
+              << kRest.size() << " (expected 123, 78, 3..6, 3)\n"
+              << "Dynamic first<2>[1] = " << head[1] << ", subspan<4,2> = " << window[0] << window[1]
+              << " (expected 2, 56)\n";
+}
+
+/*!
+ * \brief Test #3: Run-time sub-views and conversions
+ */
+void TestDynamicSubviews()
+{
+    std::cout << "\n=== Test 3: Run-Time Sub-Views and Conversions ===\n";
+    Array<std::uint32_t, 6> arr = {10U, 20U, 30U, 40U, 50U, 60U};
+    Span<std::uint32_t, 6U> const fixed{arr};
+
+    // Static -> dynamic and mutable -> const are implicit
+    Span<std::uint32_t> const dynamicView = fixed;
+    Span<const std::uint32_t, 6U> const readOnly = fixed;
+
+    Span<std::uint32_t> const head = dynamicView.first(2U);
+    Span<std::uint32_t> const tail = dynamicView.last(3U);
+    Span<std::uint32_t> const middle = dynamicView.subspan(1U, 4U);
+    Span<std::uint32_t> const rest = dynamicView.subspan(4U);
+    Span<std::uint32_t> const none = dynamicView.subspan(6U);
+
+    // Dynamic -> static is explicit (and checked)
+    Span<std::uint32_t, 4U> const window{middle};
+
+    assert((head.size() == 2U) && (head[1] == 20U));
+    assert((tail.size() == 3U) && (tail[0] == 40U));
+    assert((middle.size() == 4U) && (middle.front() == 20U) && (middle.back() == 50U));
+    assert((rest.size() == 2U) && (rest[1] == 60U));
+    assert(none.empty());
+    assert((window[3] == 50U) && (readOnly[5] == 60U));
+    assert(Sum(fixed) == 210U);
+
+    std::cout << "first(2) = " << head[0] << "," << head[1] << ", last(3)[0] = " << tail[0] << ", subspan(1,4) = "
+              << middle.front() << ".." << middle.back() << ", subspan(4).size = " << rest.size()
+              << ", subspan(6).empty = " << none.empty() << " (expected 10,20, 40, 20..50, 2, 1)\n"
+              << "Explicit Span<T, 4>[3] = " << window[3] << ", Sum(fixed) = " << Sum(fixed)
+              << " (expected 50, 210)\n";
+}
+
+/*!
+ * \brief Test #4: Zero-copy Span<const T, N> parameters over ara::core::Array<T, N>
+ */
+void TestZeroCopyParameters()
+{
+    std::cout << "\n=== Test 4: Zero-Copy Span Parameters ===\n";
+    Array<float, 8> samples = {1.0F, 2.0F, 1.0F, 2.0F, 1.0F, 2.0F, 1.0F, 2.0F};
+    Array<float, 16> frame{};
+    for (std::size_t i = 0U; i < frame.size(); ++i) {
+        frame[i] = 1.0F;
+    }
+
+    // The window of a larger frame is passed without a copy into a temporary Array<float, 8>
+    Span<float, 16U> const frameView{frame};
+    float const whole = Energy(samples);
+    float const lower = Energy(frameView.first<8U>());
+    float const upper = Energy(frameView.subspan<8U, 8U>());
+
+    // Vector-like containers work through the dynamic extent
+    std::vector<std::uint32_t> values{1U, 2U, 3U, 4U};
+    std::uint32_t const total = Sum(values);
+
+    bool const wholeOk = (whole > 19.99F) && (whole < 20.01F);
+    bool const lowerOk = (lower > 7.99F) && (lower < 8.01F);
+    bool const upperOk = (upper > 7.99F) && (upper < 8.01F);
+    assert(wholeOk && lowerOk && upperOk);
+    assert(total == 10U);
+    std::cout << "Energy(Array<8>) = " << whole << ", Energy(frame.first<8>) = " << lower
+              << ", Energy(frame.subspan<8,8>) = " << upper << ", Sum(std::vector) = " << total
+              << " (expected 20, 8, 8, 10)\n"
+              << "Within tolerance: " << wholeOk << lowerOk << upperOk << " (expected 111)\n";
+}
+
+/*!
+ * \brief Test #5: Iterators, as_bytes() / as_writable_bytes(), MakeSpan() and deduction guides
+ */
+void TestIteratorsAndBytes()
+{
+    std::cout << "\n=== Test 5: Iterators, Bytes, MakeSpan, Deduction Guides ===\n";
+    Array<std::uint32_t, 4> arr = {1U, 2U, 3U, 4U};
+    const Array<std::uint32_t, 4>& constArr = arr;
+
+    ara::core::Span deduced{arr};
+    ara::core::Span deducedConst{constArr};
+    static_assert(std::is_same_v<decltype(deduced), Span<std::uint32_t, 4U>>);
+    static_assert(std::is_same_v<decltype(deducedConst), Span<const std::uint32_t, 4U>>);
+
+    std::uint32_t forward = 0U;
+    for (auto it = deduced.begin(); it != deduced.end(); ++it) {
+        forward = (forward * 10U) + *it;
+    }
+    std::uint32_t backward = 0U;
+    for (auto it = deducedConst.crbegin(); it != deducedConst.crend(); ++it) {
+        backward = (backward * 10U) + *it;
+    }
+
+    auto const bytes = ara::core::as_bytes(deduced);
+    auto const writable = ara::core::as_writable_bytes(deduced);
+    static_assert(decltype(bytes)::extent == (4U * sizeof(std::uint32_t)));
+    writable[0] = std::byte{0x7F};
+
+    auto const made = ara::core::MakeSpan(arr);
+    auto const madeDynamic = ara::core::MakeSpan(arr.data() + 1, 2U);
+    static_assert(std::is_same_v<decltype(made), const Span<std::uint32_t, 4U>>);
+
+    assert((forward == 1234U) && (backward == 4321U));
+    assert(bytes.size() == 16U);
+    assert((arr[0] & 0xFFU) == 0x7FU);
+    assert((made.data() == arr.data()) && (madeDynamic.size() == 2U) && (madeDynamic[0] == 2U));
+    std::cout << "Forward = " << forward << ", crbegin..crend = " << backward << ", as_bytes size = "
+              << bytes.size() << ", low byte after write = " << (arr[0] & 0xFFU) << ", MakeSpan(ptr, 2)[0] = "
+              << madeDynamic[0] << " (expected 1234, 4321, 16, 127, 2)\n";
+}
+
+/*!
+ * \brief Test #6: Violation handling (operator[] out of range)
+ */
+void TestIndexViolation()
+{
+    std::cout << "\n=== Test 6: Violation Handling (operator[]) ===\n";
+    Array<int, 3> arr = {10, 20, 30};
+    Span<int> const view{arr};
+    volatile std::size_t index = 3U;
+
+    std::cout << "view[2] = " << view[2] << " (expected 30)\n";
+    std::cout << "Attempting view[3] => out-of-range => violation.\n";
+    // This next call should trigger a violation (and terminate the process)
+    int const value = view[index];
+    std::cout << "Unreachable: " << value << "\n";
+}
+
+/*!
+ * \brief Test #7: Violation handling (static extent over a sequence of another length)
+ */
+void TestExtentViolation()
+{
+    std::cout << "\n=== Test 7: Violation Handling (Extent Mismatch) ===\n";
+    Array<int, 3> arr = {10, 20, 30};
+    Span<int> const view{arr};
+
+    std::cout << "Attempting Span<int, 4>{Span<int> of size 3} => violation.\n";
+    // This next conversion should trigger a violation (and terminate the process)
+    Span<int, 4U> const fixed{view};
+    std::cout << "Unreachable: " << fixed.size() << "\n";
+}
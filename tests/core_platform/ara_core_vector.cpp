@@ -0,0 +1,496 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara_core_vector.cpp
+ *  \brief      Test application for ara::core::Vector and the ara::core::pmr memory resources.
+ *
+ *  \details    This file contains multiple test functions covering:
+ *              1.  Element access, push_back/emplace_back and iteration
+ *              2.  insert(), erase(), resize() and assign()
+ *              3.  Copy and move semantics (non-trivial element type)
+ *              4.  Comparison operators and swap()
+ *              5.  MonotonicBufferResource
+ *              6.  PoolResource
+ *              7.  ArenaResource (prefault, reset, high-water mark) and the default resource
+ *              8.  Violation handling (out-of-range at())
+ *              9.  Violation handling (memory resource exhausted)
+ *              10. std::allocator compatibility and self-referencing insertion
+ *
+ *  \note       All variables are used, preventing compiler warnings about unused variables.
+ *********************************************************************************************************************/
+
+#include "ara/core/vector.h"          // The custom Vector implementation header
+#include "ara/core/memory_resource.h" // The ara::core::pmr memory resources
+#include <iostream>                   // For std::cout (demonstrations)
+#include <memory>                     // For std::allocator
+#include <string>                     // For std::string
+#include <cassert>                    // For runtime checks via assert
+#include <cstdint>                    // For std::uint8_t, std::uint32_t
+
+/**********************************************************************************************************************
+ *  FORWARD DECLARATIONS
+ *********************************************************************************************************************/
+void TestElementAccessAndGrowth();     // Test #1
+void TestInsertEraseResizeAssign();    // Test #2
+void TestCopyAndMoveSemantics();       // Test #3
+void TestComparisonAndSwap();          // Test #4
+void TestMonotonicBufferResource();    // Test #5
+void TestPoolResource();               // Test #6
+void TestArenaResource();              // Test #7
+void TestViolationOutOfRange();        // Test #8
+void TestViolationOutOfMemory();       // Test #9
+void TestStdAllocatorAndAliasing();    // Test #10
+
+/**********************************************************************************************************************
+ *  DEMO TYPES FOR TESTING
+ *********************************************************************************************************************/
+/*!
+ * \brief  A non-trivially-copyable type counting its live instances.
+ *
+ * \details
+ * - All copy/move operations are noexcept to satisfy Safe Mode's requirements.
+ */
+class TrackedValue
+{
+public:
+    static std::size_t liveCount;
+
+    TrackedValue() noexcept : value_(0) { ++liveCount; }
+    explicit TrackedValue(int value) noexcept : value_(value) { ++liveCount; }
+    TrackedValue(const TrackedValue& other) noexcept : value_(other.value_) { ++liveCount; }
+    TrackedValue(TrackedValue&& other) noexcept : value_(other.value_) { other.value_ = -1; ++liveCount; }
+    ~TrackedValue() { --liveCount; }
+
+    TrackedValue& operator=(const TrackedValue& other) noexcept { value_ = other.value_; return *this; }
+    TrackedValue& operator=(TrackedValue&& other) noexcept {
+        value_ = other.value_;
+        other.value_ = -1;
+        return *this;
+    }
+
+    bool operator==(const TrackedValue& rhs) const noexcept { return value_ == rhs.value_; }
+    bool operator<(const TrackedValue& rhs) const noexcept { return value_ < rhs.value_; }
+
+    int GetValue() const noexcept { return value_; }
+
+private:
+    int value_;
+};
+
+std::size_t TrackedValue::liveCount = 0U;
+
+/**********************************************************************************************************************
+ *  MAIN AND MENU
+ *********************************************************************************************************************/
+static void PrintUsage(const char* prog) {
+    std::cout << "Usage: " << prog << " [test_number]\n"
+              << "List of Available Tests:\n"
+              << "  1  - Element Access and Growth\n"
+              << "  2  - insert/erase/resize/assign\n"
+              << "  3  - Copy and Move Semantics\n"
+              << "  4  - Comparison Operators and swap\n"
+              << "  5  - MonotonicBufferResource\n"
+              << "  6  - PoolResource\n"
+              << "  7  - ArenaResource and Default Resource\n"
+              << "  8  - Violation Handling (Out-of-Range)\n"
+              << "  9  - Violation Handling (Memory Resource Exhausted)\n"
+              << " 10  - std::allocator Compatibility and Aliasing\n";
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc != 2) {
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    std::string choice = argv[1];
+    if      (choice == "1")  TestElementAccessAndGrowth();
+    else if (choice == "2")  TestInsertEraseResizeAssign();
+    else if (choice == "3")  TestCopyAndMoveSemantics();
+    else if (choice == "4")  TestComparisonAndSwap();
+    else if (choice == "5")  TestMonotonicBufferResource();
+    else if (choice == "6")  TestPoolResource();
+    else if (choice == "7")  TestArenaResource();
+    else if (choice == "8")  TestViolationOutOfRange();
+    else if (choice == "9")  TestViolationOutOfMemory();
+    else if (choice == "10") TestStdAllocatorAndAliasing();
+    else {
+        std::cout << "Invalid test number: " << choice << "\n";
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    return 0;
+}
+
+/**********************************************************************************************************************
+ *  TEST DEFINITIONS
+ *********************************************************************************************************************/
+
+/*!
+ * \brief Test #1: Element access, push_back/emplace_back and iteration
+ */
+void TestElementAccessAndGrowth()
+{
+    std::cout << "\n=== Test 1: Element Access and Growth ===\n";
+    ara::core::Vector<int> vec;
+    assert(vec.empty());
+
+    for (std::size_t i = 1U; i <= 100U; ++i) {
+        vec.push_back(static_cast<int>(i));
+    }
+    int& last = vec.emplace_back(101);
+    std::cout << "emplace_back returned " << last << " (expected 101)\n";
+
+    std::cout << "size = " << vec.size() << " (expected 101), capacity = " << vec.capacity() << "\n";
+    assert(vec.size() == 101U);
+    assert(vec.capacity() >= vec.size());
+    assert(last == 101);
+
+    std::cout << "vec.at(9) = " << vec.at(9) << " (expected 10)\n";
+    assert(vec.at(9) == 10);
+    assert(vec[0] == 1);
+    assert(vec.front() == 1);
+    assert(vec.back() == 101);
+
+    int sum = 0;
+    for (int value : vec) {
+        sum += value;
+    }
+    std::cout << "Sum of elements = " << sum << " (expected 5151)\n";
+    assert(sum == 5151);
+
+    int reverseFirst = *vec.rbegin();
+    std::cout << "*rbegin() = " << reverseFirst << " (expected 101)\n";
+    assert(reverseFirst == 101);
+
+    vec.pop_back();
+    vec.reserve(500);
+    std::cout << "After pop_back + reserve(500): size = " << vec.size() << ", capacity = " << vec.capacity() << "\n";
+    assert(vec.size() == 100U);
+    assert(vec.capacity() == 500U);
+
+    vec.shrink_to_fit();
+    assert(vec.capacity() == 100U);
+    vec.clear();
+    assert(vec.empty());
+}
+
+/*!
+ * \brief Test #2: insert(), erase(), resize() and assign()
+ */
+void TestInsertEraseResizeAssign()
+{
+    std::cout << "\n=== Test 2: insert/erase/resize/assign ===\n";
+    ara::core::Vector<int> vec = {1, 2, 5};
+
+    vec.insert(vec.begin() + 2, 4);
+    vec.insert(vec.begin() + 2, 3);
+    vec.insert(vec.begin(), 2U, 0);
+    vec.insert(vec.end(), {6, 7});
+
+    std::cout << "After inserts: ";
+    for (int v : vec) std::cout << v << " ";
+    std::cout << "(expected 0 0 1 2 3 4 5 6 7)\n";
+    assert((vec == ara::core::Vector<int>{0, 0, 1, 2, 3, 4, 5, 6, 7}));
+
+    auto it = vec.erase(vec.begin());
+    std::cout << "erase() returned an iterator to " << *it << " (expected 0)\n";
+    assert(*it == 0);
+    vec.erase(vec.begin(), vec.begin() + 2);
+    assert((vec == ara::core::Vector<int>{2, 3, 4, 5, 6, 7}));
+
+    vec.resize(8, 9);
+    assert(vec.size() == 8U && vec[7] == 9);
+    vec.resize(3);
+    assert((vec == ara::core::Vector<int>{2, 3, 4}));
+    vec.resize(5);
+    assert(vec[4] == 0);
+
+    vec.assign(4U, 42);
+    assert((vec == ara::core::Vector<int>{42, 42, 42, 42}));
+    vec.assign({7, 8});
+    assert((vec == ara::core::Vector<int>{7, 8}));
+
+    int raw[] = {10, 20, 30};
+    vec.assign(raw, raw + 3);
+    std::cout << "After assign(range): ";
+    for (int v : vec) std::cout << v << " ";
+    std::cout << "(expected 10 20 30)\n";
+    assert((vec == ara::core::Vector<int>{10, 20, 30}));
+
+    ara::core::Vector<int> counted(3U, 5);
+    ara::core::Vector<int> sized(3U);
+    assert(counted.size() == 3U && counted[2] == 5);
+    assert(sized.size() == 3U && sized[2] == 0);
+}
+
+/*!
+ * \brief Test #3: Copy and move semantics (non-trivial element type)
+ */
+void TestCopyAndMoveSemantics()
+{
+    std::cout << "\n=== Test 3: Copy and Move Semantics ===\n";
+    {
+        ara::core::Vector<TrackedValue> original;
+        for (std::size_t i = 0U; i < 10U; ++i) {
+            original.emplace_back(static_cast<int>(i));
+        }
+        original.insert(original.begin(), TrackedValue(-5));
+        original.erase(original.begin());
+
+        ara::core::Vector<TrackedValue> copy(original);
+        assert(copy == original);
+
+        const TrackedValue* storage = original.data();
+        ara::core::Vector<TrackedValue> moved(std::move(original));
+        std::cout << "Move constructor kept the storage: " << (moved.data() == storage) << " (expected true)\n";
+        assert(moved.data() == storage);
+        assert(original.empty());
+
+        ara::core::Vector<TrackedValue> assigned;
+        assigned = copy;
+        assigned = std::move(moved);
+        assert(assigned == copy);
+
+        std::cout << "Live TrackedValue instances = " << TrackedValue::liveCount << " (expected 20)\n";
+        assert(TrackedValue::liveCount == 20U);
+    }
+    std::cout << "Live TrackedValue instances after scope = " << TrackedValue::liveCount << " (expected 0)\n";
+    assert(TrackedValue::liveCount == 0U);
+}
+
+/*!
+ * \brief Test #4: Comparison operators and swap()
+ */
+void TestComparisonAndSwap()
+{
+    std::cout << "\n=== Test 4: Comparison Operators and swap ===\n";
+    ara::core::Vector<int> a = {1, 2, 3};
+    ara::core::Vector<int> b = {1, 2, 3};
+    ara::core::Vector<int> c = {1, 2, 4};
+    ara::core::Vector<int> d = {1, 2};
+
+    std::cout << "a == b => " << (a == b) << " (expected true)\n";
+    assert(a == b);
+    assert(a != c);
+    assert(a < c);
+    assert(d < a);
+    assert(a <= b);
+    assert(c > a);
+    assert(c >= a);
+
+    using Byte = std::uint8_t;
+    ara::core::Vector<Byte> bytesA(64U, Byte{7});
+    ara::core::Vector<Byte> bytesB(64U, Byte{7});
+    bytesB.back() = Byte{8};
+    assert(bytesA < bytesB);
+    assert(bytesA != bytesB);
+
+    swap(a, d);
+    std::cout << "After swap: a.size() = " << a.size() << " (expected 2), d.size() = " << d.size() << "\n";
+    assert(a.size() == 2U && d.size() == 3U);
+}
+
+/*!
+ * \brief Test #5: MonotonicBufferResource over a stack buffer, growing from upstream
+ */
+void TestMonotonicBufferResource()
+{
+    std::cout << "\n=== Test 5: MonotonicBufferResource ===\n";
+    alignas(std::max_align_t) unsigned char buffer[256];
+    ara::core::pmr::MonotonicBufferResource monotonic(buffer, sizeof(buffer),
+                                                      ara::core::pmr::NullMemoryResource());
+
+    ara::core::pmr::Vector<std::uint32_t> vec(&monotonic);
+    vec.reserve(16);
+    for (std::uint32_t i = 0; i < 16U; ++i) {
+        vec.push_back(i);
+    }
+
+    const unsigned char* begin = buffer;
+    const unsigned char* data  = reinterpret_cast<const unsigned char*>(vec.data());
+    bool inBuffer = (data >= begin) && (data < begin + sizeof(buffer));
+    std::cout << "Vector storage lies in the stack buffer: " << inBuffer << " (expected true)\n";
+    assert(inBuffer);
+
+    // Exhausting the buffer with a null upstream fails instead of touching the heap
+    void* refused = monotonic.allocate(1024U);
+    std::cout << "Oversized request with null upstream => " << (refused == nullptr) << " (expected true)\n";
+    assert(refused == nullptr);
+
+    // With the heap as upstream, the resource grows
+    ara::core::pmr::MonotonicBufferResource growing(64U, ara::core::pmr::NewDeleteResource());
+    ara::core::pmr::Vector<std::uint32_t> grown(&growing);
+    for (std::uint32_t i = 0; i < 1000U; ++i) {
+        grown.push_back(i);
+    }
+    std::cout << "grown.size() = " << grown.size() << " (expected 1000)\n";
+    assert(grown.size() == 1000U && grown[999] == 999U);
+
+    // A request no chunk size can cover is refused instead of doubling the chunk size past SIZE_MAX
+    void* huge = growing.allocate(static_cast<std::size_t>(-1) - 1024U);
+    std::cout << "Request close to SIZE_MAX => " << (huge == nullptr) << " (expected true)\n";
+    assert(huge == nullptr);
+    grown.clear();
+    grown.shrink_to_fit();
+    growing.release();
+}
+
+/*!
+ * \brief Test #6: PoolResource with fixed-size blocks
+ */
+void TestPoolResource()
+{
+    std::cout << "\n=== Test 6: PoolResource ===\n";
+    ara::core::pmr::PoolResource pool(64U, 4U, ara::core::pmr::NewDeleteResource(), true);
+    std::cout << "blockSize = " << pool.blockSize() << ", blockCount = " << pool.blockCount() << " (expected 4)\n";
+    assert(pool.blockCount() == 4U);
+    assert(pool.blockSize() >= 64U);
+
+    void* blocks[4];
+    for (auto& block : blocks) {
+        block = pool.allocate(48U);
+        assert(block != nullptr);
+    }
+    void* exhausted = pool.allocate(8U);
+    std::cout << "Allocation from an empty pool => " << (exhausted == nullptr) << " (expected true)\n";
+    assert(exhausted == nullptr);
+    assert(pool.freeBlocks() == 0U);
+
+    pool.deallocate(blocks[2], 48U);
+    void* reused = pool.allocate(16U);
+    std::cout << "Freed block is reused => " << (reused == blocks[2]) << " (expected true)\n";
+    assert(reused == blocks[2]);
+
+    void* tooLarge = pool.allocate(pool.blockSize() + 1U);
+    std::cout << "Request larger than a block => " << (tooLarge == nullptr) << " (expected true)\n";
+    assert(tooLarge == nullptr);
+
+    for (auto& block : blocks) {
+        pool.deallocate(block, 48U);
+    }
+    assert(pool.freeBlocks() == 4U);
+
+    // Vector with bounded capacity: one block holds 16 uint32_t
+    ara::core::pmr::Vector<std::uint32_t> vec(&pool);
+    vec.reserve(16);
+    for (std::uint32_t i = 0; i < 16U; ++i) {
+        vec.push_back(i * 2U);
+    }
+    std::cout << "vec.back() = " << vec.back() << " (expected 30)\n";
+    assert(vec.back() == 30U);
+    assert(pool.freeBlocks() == 3U);
+}
+
+/*!
+ * \brief Test #7: ArenaResource (prefault, reset, high-water mark) and the default resource
+ */
+void TestArenaResource()
+{
+    std::cout << "\n=== Test 7: ArenaResource and Default Resource ===\n";
+    ara::core::pmr::ArenaResource arena(64U * 1024U, ara::core::pmr::NewDeleteResource(), true);
+    std::cout << "arena.capacity() = " << arena.capacity() << " (expected 65536)\n";
+    assert(arena.capacity() == 64U * 1024U);
+
+    // Route every default-constructed Vector to the arena
+    ara::core::pmr::MemoryResource* previous = ara::core::pmr::SetDefaultResource(&arena);
+    std::cout << "Previous default is NewDeleteResource() => "
+              << (previous == ara::core::pmr::NewDeleteResource()) << " (expected true)\n";
+    assert(previous == ara::core::pmr::NewDeleteResource());
+    assert(ara::core::pmr::GetDefaultResource() == &arena);
+    {
+        ara::core::Vector<std::uint64_t> vec;
+        vec.reserve(128);
+        for (std::uint64_t i = 0; i < 128U; ++i) {
+            vec.push_back(i);
+        }
+        assert(vec.get_allocator().resource() == &arena);
+        std::cout << "arena.used() = " << arena.used() << " (expected >= 1024)\n";
+        assert(arena.used() >= 128U * sizeof(std::uint64_t));
+    }
+    ara::core::pmr::SetDefaultResource(nullptr);
+    assert(ara::core::pmr::GetDefaultResource() == ara::core::pmr::NewDeleteResource());
+
+    std::size_t const highWater = arena.highWaterMark();
+    arena.reset();
+    std::cout << "After reset: used = " << arena.used() << " (expected 0), highWaterMark = " << highWater << "\n";
+    assert(arena.used() == 0U);
+    assert(arena.highWaterMark() == highWater);
+
+    // Arena over caller-provided storage
+    alignas(std::max_align_t) unsigned char storage[128];
+    ara::core::pmr::ArenaResource local(storage, sizeof(storage));
+    void* first  = local.allocate(100U, 1U);
+    void* second = local.allocate(100U, 1U);
+    std::cout << "First allocation at the start of the storage => " << (first == storage) << " (expected true)\n";
+    std::cout << "Second 100-byte allocation from a 128-byte arena => " << (second == nullptr)
+              << " (expected true)\n";
+    assert(first == storage);
+    assert(second == nullptr);
+}
+
+/*!
+ * \brief Test #8: Violation handling (out-of-range at())
+ */
+void TestViolationOutOfRange()
+{
+    std::cout << "\n=== Test 8: Violation Handling (Out-of-Range) ===\n";
+    ara::core::Vector<int> vec = {1, 2, 3};
+
+    std::cout << "Attempting vec.at(3) on a vector of size 3 => Violation should occur.\n";
+    int value = vec.at(3);
+
+    // Not reached
+    std::cout << "Value: " << value << "\n";
+}
+
+/*!
+ * \brief Test #9: Violation handling (memory resource exhausted)
+ */
+void TestViolationOutOfMemory()
+{
+    std::cout << "\n=== Test 9: Violation Handling (Memory Resource Exhausted) ===\n";
+    ara::core::pmr::ArenaResource arena(256U, ara::core::pmr::NewDeleteResource());
+    ara::core::pmr::Vector<std::uint64_t> vec(&arena);
+
+    std::cout << "Growing a vector beyond a 256-byte arena => Violation should occur.\n";
+    for (std::uint64_t i = 0; i < 1024U; ++i) {
+        vec.push_back(i);
+    }
+
+    // Not reached
+    std::cout << "Size: " << vec.size() << "\n";
+}
+
+/*!
+ * \brief Test #10: std::allocator compatibility and self-referencing insertion
+ */
+void TestStdAllocatorAndAliasing()
+{
+    std::cout << "\n=== Test 10: std::allocator Compatibility and Aliasing ===\n";
+    ara::core::Vector<int, std::allocator<int>> vec = {1, 2, 3};
+    vec.shrink_to_fit();
+    assert(vec.size() == vec.capacity());
+
+    // Growth while the argument refers to an element of the vector itself
+    vec.push_back(vec[0]);
+    vec.insert(vec.begin(), 3U, vec.back());
+    std::cout << "After aliasing insertions: ";
+    for (int v : vec) std::cout << v << " ";
+    std::cout << "(expected 1 1 1 1 2 3 1)\n";
+    assert((vec == ara::core::Vector<int, std::allocator<int>>{1, 1, 1, 1, 2, 3, 1}));
+
+    ara::core::Vector<TrackedValue, std::allocator<TrackedValue>> tracked(2U, TrackedValue(5));
+    tracked.shrink_to_fit();
+    tracked.push_back(tracked.front());
+    std::cout << "tracked.back() = " << tracked.back().GetValue() << " (expected 5)\n";
+    assert(tracked.back().GetValue() == 5);
+}
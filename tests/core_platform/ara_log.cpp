@@ -0,0 +1,426 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara_log.cpp
+ *  \brief      Test application for the ara::log Logger and asynchronous LogBackend.
+ *
+ *  \details    This file contains multiple test functions covering:
+ *              1.  Record encoding and formatting of all argument types
+ *              2.  Payload and line truncation
+ *              3.  Asynchronous file sink, several threads, per-thread order
+ *              4.  Full rings: written + dropped messages add up
+ *              5.  Thresholds and synchronous kFatal messages
+ *              6.  Rings of exited threads are reused
+ *              7.  Synchronous kFatal writers racing Start() and Stop()
+ *
+ *              The backend tests log to a file in /tmp and read it back after Flush() or Stop().
+ *
+ *  \note       All variables are used, preventing compiler warnings about unused variables.
+ *********************************************************************************************************************/
+
+#include "ara/log/logger.h"       // The ara::log::Logger
+#include "ara/log/log_backend.h"  // The ara::log::LogBackend
+#include <iostream>         // For std::cout (demonstrations)
+#include <fstream>          // For std::ifstream
+#include <string>           // For std::string, std::getline
+#include <cassert>          // For runtime checks via assert
+#include <cstdint>          // For fixed-width integer types
+#include <cstdio>           // For std::remove, std::sscanf
+#include <atomic>           // For std::atomic
+#include <thread>           // For std::thread
+#include <fcntl.h>          // For open, O_* flags
+#include <unistd.h>         // For getpid, close
+
+using ara::log::BackendConfig;
+using ara::log::ErrorCode;
+using ara::log::LogBackend;
+using ara::log::Logger;
+using ara::log::LogLevel;
+using ara::log::LogMode;
+
+/**********************************************************************************************************************
+ *  FORWARD DECLARATIONS
+ *********************************************************************************************************************/
+void TestFormatting();          // Test #1
+void TestTruncation();          // Test #2
+void TestAsyncFileSink();       // Test #3
+void TestDroppedMessages();     // Test #4
+void TestLevels();              // Test #5
+void TestRingReuse();           // Test #6
+void TestStopWithSyncWriters();  // Test #7
+
+/**********************************************************************************************************************
+ *  HELPERS
+ *********************************************************************************************************************/
+/*!
+ * \brief  Logger used by the backend tests.
+ */
+constexpr Logger kLogger{"test"};
+
+/*!
+ * \brief  Encodes \c args into a Record of context "test", level kInfo, and formats it.
+ */
+template <typename... Args>
+static auto Format(const char* format, const Args&... args) -> std::string
+{
+    ara::log::internal::Record record{};
+    record.format  = format;
+    record.context = "test";
+    record.level   = LogLevel::kInfo;
+    ara::log::internal::RecordWriter writer{record};
+    (writer.Put(args), ...);
+
+    char line[LogBackend::kMaxLineLength];
+    std::size_t const length = ara::log::internal::FormatRecord(record, line, sizeof(line), false);
+    return std::string(line, length);
+}
+
+/*!
+ * \brief  Path of the log file of this test process.
+ */
+static auto LogFilePath() -> std::string
+{
+    return "/tmp/ara_log_test_" + std::to_string(static_cast<long>(getpid())) + ".log";
+}
+
+/*!
+ * \brief  Starts the backend with a fresh log file (and no console output).
+ */
+static auto StartFileBackend(const std::string& path, std::chrono::milliseconds drainPeriod) -> ErrorCode
+{
+    static_cast<void>(std::remove(path.c_str()));
+    BackendConfig config{};
+    config.mode        = LogMode::kFile;
+    config.level       = LogLevel::kVerbose;
+    config.filePath    = path.c_str();
+    config.drainPeriod = drainPeriod;
+    return LogBackend::Instance().Start(config);
+}
+
+/*!
+ * \brief  Counts the lines of \c path containing \c text.
+ */
+static auto CountLines(const std::string& path, const std::string& text) -> std::size_t
+{
+    std::ifstream file(path);
+    std::string line;
+    std::size_t count = 0U;
+    while (std::getline(file, line)) {
+        count += (line.find(text) != std::string::npos) ? 1U : 0U;
+    }
+    return count;
+}
+
+/**********************************************************************************************************************
+ *  MAIN AND MENU
+ *********************************************************************************************************************/
+static void PrintUsage(const char* prog) {
+    std::cout << "Usage: " << prog << " [test_number]\n"
+              << "List of Available Tests:\n"
+              << "  1  - Record Encoding and Formatting\n"
+              << "  2  - Payload and Line Truncation\n"
+              << "  3  - Asynchronous File Sink with Several Threads\n"
+              << "  4  - Dropped Messages on Full Rings\n"
+              << "  5  - Thresholds and Synchronous kFatal\n"
+              << "  6  - Reuse of the Rings of Exited Threads\n"
+              << "  7  - Synchronous kFatal Writers Racing Start() and Stop()\n";
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc != 2) {
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    std::string choice = argv[1];
+    if      (choice == "1")  TestFormatting();
+    else if (choice == "2")  TestTruncation();
+    else if (choice == "3")  TestAsyncFileSink();
+    else if (choice == "4")  TestDroppedMessages();
+    else if (choice == "5")  TestLevels();
+    else if (choice == "6")  TestRingReuse();
+    else if (choice == "7")  TestStopWithSyncWriters();
+    else {
+        std::cout << "Invalid test number: " << choice << "\n";
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    return 0;
+}
+
+/**********************************************************************************************************************
+ *  TEST DEFINITIONS
+ *********************************************************************************************************************/
+
+/*!
+ * \brief Test #1: Record encoding and formatting of all argument types
+ */
+void TestFormatting()
+{
+    std::cout << "\n=== Test 1: Record Encoding and Formatting ===\n";
+    enum class Color : std::uint8_t { kRed = 2 };
+    std::string const owned{"owned"};
+
+    std::string const line = Format("i={} u={} d={} b={} c={} s={} v={} e={} {{x}} missing={}",
+                                    -42, 7U, 2.5, true, 'z', "text", owned, Color::kRed);
+    std::string const expected{"[test][INFO] i=-42 u=7 d=2.5 b=true c=z s=text v=owned e=2 {x} missing={}\n"};
+    assert(line == expected);
+    std::cout << "Formatted: " << line << "Expected:  " << expected;
+
+    std::string const pointer = Format("p={}", static_cast<const void*>(&owned));
+    assert(pointer.find("p=0x") != std::string::npos);
+    std::cout << "Pointer:   " << pointer;
+
+    static_assert(sizeof(ara::log::internal::Record) == 128U, "Record must span two cache lines");
+    std::cout << "sizeof(Record) = " << sizeof(ara::log::internal::Record) << " (expected 128)\n";
+}
+
+/*!
+ * \brief Test #2: Payload and line truncation
+ */
+void TestTruncation()
+{
+    std::cout << "\n=== Test 2: Payload and Line Truncation ===\n";
+    std::string const longText(300U, 'a');
+
+    // The string fills the payload: it is truncated to the free space, the following integer is dropped
+    std::string const line = Format("{} / {}", longText, 5);
+    std::size_t const copied = line.find(" / ") - std::string("[test][INFO] ").size();
+    assert(copied == (ara::log::internal::kPayloadCapacity - 2U));
+    assert(line.find(" / {}") != std::string::npos);
+    std::cout << "Copied characters = " << copied << " (expected " << (ara::log::internal::kPayloadCapacity - 2U)
+              << "), dropped argument printed as {}: " << (line.find(" / {}") != std::string::npos) << "\n";
+
+    // Twelve integers do not fit into the payload (9 bytes each): the twelfth is dropped
+    std::string const many = Format("{} {} {} {} {} {} {} {} {} {} {} {}", 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12);
+    assert(many == "[test][INFO] 1 2 3 4 5 6 7 8 9 10 11 {}\n");
+    std::cout << "Twelve integers: " << many;
+
+    // A format string longer than the line is cut, the newline is kept
+    std::string const longFormat(2U * LogBackend::kMaxLineLength, 'f');
+    std::string const cut = Format(longFormat.c_str());
+    assert(cut.size() == LogBackend::kMaxLineLength);
+    assert(cut.back() == '\n');
+    std::cout << "Long line length = " << cut.size() << " (expected " << LogBackend::kMaxLineLength << ")\n";
+}
+
+/*!
+ * \brief Test #3: Asynchronous file sink, several threads, per-thread order
+ */
+void TestAsyncFileSink()
+{
+    std::cout << "\n=== Test 3: Asynchronous File Sink with Several Threads ===\n";
+    constexpr std::uint32_t kThreads{4U};
+    constexpr std::uint32_t kMessages{200U};    // Below kRingCapacity: nothing may be dropped
+    std::string const path = LogFilePath();
+
+    ErrorCode const started = StartFileBackend(path, std::chrono::milliseconds(1));
+    ErrorCode const again   = LogBackend::Instance().Start(BackendConfig{});
+    assert(started == ErrorCode::Success);
+    assert(again == ErrorCode::AlreadyRunning);
+    assert(LogBackend::Instance().IsRunning());
+    std::cout << "Start = " << static_cast<int>(started) << ", second Start = " << static_cast<int>(again)
+              << " (expected 0, 1)\n";
+
+    std::uint64_t const droppedBefore = LogBackend::Instance().GetDroppedCount();
+    std::thread workers[kThreads];
+    for (std::uint32_t worker = 0U; worker < kThreads; ++worker) {
+        workers[worker] = std::thread([worker]() {
+            for (std::uint32_t message = 0U; message < kMessages; ++message) {
+                kLogger.LogInfo("worker {} message {}", worker, message);
+            }
+        });
+    }
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    LogBackend::Instance().Stop();
+    assert(!LogBackend::Instance().IsRunning());
+
+    std::ifstream file(path);
+    std::string line;
+    std::size_t total = 0U;
+    std::size_t orderErrors = 0U;
+    std::int64_t next[kThreads]{};
+    while (std::getline(file, line)) {
+        unsigned worker = 0U;
+        unsigned message = 0U;
+        if (std::sscanf(line.c_str(), "[test][INFO] worker %u message %u", &worker, &message) == 2) {
+            orderErrors += ((worker < kThreads) && (static_cast<std::int64_t>(message) == next[worker])) ? 0U : 1U;
+            if (worker < kThreads) {
+                next[worker] = static_cast<std::int64_t>(message) + 1;
+            }
+            ++total;
+        }
+    }
+    std::uint64_t const dropped = LogBackend::Instance().GetDroppedCount() - droppedBefore;
+    assert(total == (kThreads * kMessages));
+    assert(orderErrors == 0U);
+    assert(dropped == 0U);
+    std::cout << "Lines = " << total << ", order errors = " << orderErrors << ", dropped = " << dropped
+              << " (expected 800, 0, 0)\n";
+    static_cast<void>(std::remove(path.c_str()));
+}
+
+/*!
+ * \brief Test #4: Full rings: written + dropped messages add up
+ */
+void TestDroppedMessages()
+{
+    std::cout << "\n=== Test 4: Dropped Messages on Full Rings ===\n";
+    constexpr std::uint32_t kMessages{4000U};
+    std::string const path = LogFilePath();
+
+    // A slow drain period lets the burst overflow the ring of this thread
+    ErrorCode const started = StartFileBackend(path, std::chrono::milliseconds(50));
+    assert(started == ErrorCode::Success);
+    std::cout << "Start = " << static_cast<int>(started) << " (expected 0)\n";
+
+    std::uint64_t const droppedBefore = LogBackend::Instance().GetDroppedCount();
+    for (std::uint32_t message = 0U; message < kMessages; ++message) {
+        kLogger.LogInfo("burst {}", message);
+    }
+    LogBackend::Instance().Stop();
+
+    std::uint64_t const dropped = LogBackend::Instance().GetDroppedCount() - droppedBefore;
+    std::size_t const written = CountLines(path, "[test][INFO] burst ");
+    std::size_t const reports = CountLines(path, "log messages dropped");
+    assert((written + dropped) == kMessages);
+    assert(written >= LogBackend::kRingCapacity);
+    assert((dropped == 0U) || (reports >= 1U));
+    std::cout << "Written = " << written << ", dropped = " << dropped << " (sum " << (written + dropped)
+              << ", expected 4000), drop reports = " << reports << "\n";
+    static_cast<void>(std::remove(path.c_str()));
+}
+
+/*!
+ * \brief Test #5: Thresholds and synchronous kFatal messages
+ */
+void TestLevels()
+{
+    std::cout << "\n=== Test 5: Thresholds and Synchronous kFatal ===\n";
+    constexpr Logger kQuiet{"quiet", LogLevel::kWarn};
+    std::string const path = LogFilePath();
+
+    ErrorCode const started = StartFileBackend(path, std::chrono::milliseconds(1));
+    assert(started == ErrorCode::Success);
+    std::cout << "Start = " << static_cast<int>(started) << " (expected 0)\n";
+    LogBackend::Instance().SetLevel(LogLevel::kInfo);
+
+    bool const debugEnabled = kLogger.IsEnabled(LogLevel::kDebug);
+    bool const infoEnabled  = kLogger.IsEnabled(LogLevel::kInfo);
+    bool const quietInfo    = kQuiet.IsEnabled(LogLevel::kInfo);
+    bool const offEnabled   = kLogger.IsEnabled(LogLevel::kOff);
+    assert(!debugEnabled && infoEnabled && !quietInfo && !offEnabled);
+    std::cout << "Enabled: debug = " << debugEnabled << ", info = " << infoEnabled << ", quiet info = " << quietInfo
+              << ", off = " << offEnabled << " (expected 0, 1, 0, 0)\n";
+
+    kLogger.LogDebug("filtered by the backend threshold");
+    kQuiet.LogInfo("filtered by the logger threshold");
+    kQuiet.LogWarn("quiet warning {}", 1);
+    kLogger.LogFatal("fatal {} written synchronously", 42);
+
+    // kFatal bypasses the rings: it is in the file before any flush
+    std::size_t const fatalBeforeFlush = CountLines(path, "[test][FATAL] fatal 42 written synchronously");
+    LogBackend::Instance().Flush();
+    std::size_t const warnings = CountLines(path, "[quiet][WARN] quiet warning 1");
+    std::size_t const filtered = CountLines(path, "filtered");
+    LogBackend::Instance().Stop();
+
+    assert(fatalBeforeFlush == 1U);
+    assert(warnings == 1U);
+    assert(filtered == 0U);
+    std::cout << "Fatal before Flush = " << fatalBeforeFlush << ", warnings = " << warnings << ", filtered lines = "
+              << filtered << " (expected 1, 1, 0)\n";
+
+    // Stopped: synchronous console output
+    std::cout << std::flush;
+    kLogger.LogInfo("synchronous console message after Stop()");
+    static_cast<void>(std::remove(path.c_str()));
+}
+
+/*!
+ * \brief Test #6: Rings of exited threads are reused
+ */
+void TestRingReuse()
+{
+    std::cout << "\n=== Test 6: Reuse of the Rings of Exited Threads ===\n";
+    constexpr std::size_t kThreads{3U * LogBackend::kMaxThreads};
+    std::string const path = LogFilePath();
+
+    ErrorCode const started = StartFileBackend(path, std::chrono::milliseconds(1));
+    assert(started == ErrorCode::Success);
+    std::cout << "Start = " << static_cast<int>(started) << " (expected 0)\n";
+
+    std::uint64_t const droppedBefore = LogBackend::Instance().GetDroppedCount();
+    for (std::size_t index = 0U; index < kThreads; ++index) {
+        std::thread worker([index]() { kLogger.LogInfo("short-lived thread {}", index); });
+        worker.join();
+        LogBackend::Instance().Flush();     // Writes the message and releases the orphaned ring
+    }
+    LogBackend::Instance().Stop();
+
+    std::size_t const written = CountLines(path, "[test][INFO] short-lived thread ");
+    std::uint64_t const dropped = LogBackend::Instance().GetDroppedCount() - droppedBefore;
+    assert(written == kThreads);
+    assert(dropped == 0U);
+    std::cout << "Threads = " << kThreads << ", lines = " << written << ", dropped = " << dropped
+              << " (expected 48, 48, 0)\n";
+    static_cast<void>(std::remove(path.c_str()));
+}
+
+/*!
+ * \brief Test #7: Synchronous kFatal writers racing Start() and Stop()
+ */
+void TestStopWithSyncWriters()
+{
+    std::cout << "\n=== Test 7: Synchronous kFatal Writers Racing Start() and Stop() ===\n";
+    constexpr std::size_t kCycles{50U};
+    std::string const path = LogFilePath();
+    std::string const decoyPath = path + ".decoy";
+    static_cast<void>(std::remove(decoyPath.c_str()));
+
+    std::atomic<bool> done{false};
+    auto const writer = [&done]() {
+        std::size_t index = 0U;
+        while (!done.load()) {
+            kLogger.LogFatal("racing fatal {}", index);
+            ++index;
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+        }
+    };
+    std::thread first(writer);
+    std::thread second(writer);
+
+    std::size_t failedStarts = 0U;
+    for (std::size_t cycle = 0U; cycle < kCycles; ++cycle) {
+        failedStarts += (StartFileBackend(path, std::chrono::milliseconds(1)) == ErrorCode::Success) ? 0U : 1U;
+        std::this_thread::sleep_for(std::chrono::microseconds(500));
+        LogBackend::Instance().Stop();
+
+        // The decoy most likely reuses the descriptor Stop() just closed: no log line may end up in it
+        int const decoy = ::open(decoyPath.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+        std::this_thread::sleep_for(std::chrono::microseconds(500));
+        static_cast<void>(::close(decoy));
+    }
+    done.store(true);
+    first.join();
+    second.join();
+
+    std::size_t const strayLines = CountLines(decoyPath, "racing fatal");
+    std::size_t const fileLines  = CountLines(path, "[test][FATAL] racing fatal ");
+    assert(failedStarts == 0U);
+    assert(strayLines == 0U);
+    std::cout << "Failed starts = " << failedStarts << ", lines in the reused descriptor = " << strayLines
+              << ", lines in the log file = " << fileLines << " (expected 0, 0, any)\n";
+    static_cast<void>(std::remove(path.c_str()));
+    static_cast<void>(std::remove(decoyPath.c_str()));
+}
@@ -0,0 +1,534 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara_os_cyclic_executive.cpp
+ *  \brief      Test application for the ara::os::interface::timer DeadlineTimer and CyclicExecutive.
+ *
+ *  \details    This file contains multiple test functions covering:
+ *              1.  DeadlineTimer: absolute sleeping, deadlines in the past, Interrupt()
+ *              2.  Configuration validation (arguments, capacity, running state), Stop() latency
+ *              3.  Release grid of a single rate group (epoch + offset + k * period, no drift)
+ *              4.  Several rate groups sharing one epoch
+ *              5.  OverrunPolicy::Skip
+ *              6.  OverrunPolicy::CatchUp
+ *              7.  OverrunPolicy::Report
+ *              8.  CycleMetrics attached to a rate group
+ *
+ *              Timing checks only assert what the scheduler guarantees (grid positions, ordering, lower bounds);
+ *              counts derived from wall-clock time use generous margins so that loaded machines do not fail.
+ *
+ *  \note       All variables are used, preventing compiler warnings about unused variables.
+ *********************************************************************************************************************/
+
+#include "ara/os/interface/timer/cyclic_executive.h"  // The CyclicExecutive and PlatformDeadlineTimer
+#include <iostream>         // For std::cout (demonstrations)
+#include <string>           // For std::string
+#include <cassert>          // For runtime checks via assert
+#include <chrono>           // For std::chrono durations
+#include <cstdint>          // For std::uint64_t
+#include <thread>           // For std::this_thread::sleep_for
+
+using ara::os::interface::timer::CycleInfo;
+using ara::os::interface::timer::CyclicExecutive;
+using ara::os::interface::timer::ErrorCode;
+using ara::os::interface::timer::MonotonicTime;
+using ara::os::interface::timer::OverrunInfo;
+using ara::os::interface::timer::OverrunPolicy;
+using ara::os::interface::timer::PlatformDeadlineTimer;
+using ara::os::interface::timer::RateGroupConfig;
+using ara::os::interface::timer::RateGroupStatistics;
+using ara::core::internal::metrics::CycleMetrics;
+using ara::core::internal::metrics::CycleMetricsSummary;
+
+/**********************************************************************************************************************
+ *  FORWARD DECLARATIONS
+ *********************************************************************************************************************/
+void TestDeadlineTimer();           // Test #1
+void TestConfiguration();           // Test #2
+void TestReleaseGrid();             // Test #3
+void TestMultipleRateGroups();      // Test #4
+void TestOverrunSkip();             // Test #5
+void TestOverrunCatchUp();          // Test #6
+void TestOverrunReport();           // Test #7
+void TestCycleMetrics();            // Test #8
+
+/**********************************************************************************************************************
+ *  HELPERS
+ *********************************************************************************************************************/
+/*!
+ * \brief  Records the CycleInfo of every executed cycle (written by the rate group thread, read after Stop()).
+ */
+struct Recorder {
+    static constexpr std::size_t kCapacity{512U};
+
+    CycleInfo     cycles[kCapacity]{};
+    std::size_t   count{0U};
+    static constexpr std::size_t kSlowOrdinal{3U};  // The third executed cycle sleeps for slowDuration
+
+    std::uint64_t slowCycle{UINT64_MAX};            // Release index of that cycle, set when it runs
+    std::chrono::nanoseconds slowDuration{0};
+    OverrunInfo   slowOverrun{};
+    std::size_t   overrunReports{0U};
+};
+
+/*!
+ * \brief  Task recording its CycleInfo; the configured slow cycle overruns on purpose.
+ */
+static void RecordCycle(void* context, const CycleInfo& info) noexcept
+{
+    Recorder& recorder = *static_cast<Recorder*>(context);
+    if (recorder.count < Recorder::kCapacity) {
+        recorder.cycles[recorder.count] = info;
+        ++recorder.count;
+    }
+    if ((recorder.count == Recorder::kSlowOrdinal) && (recorder.slowDuration.count() > 0)) {
+        recorder.slowCycle = info.cycle;
+        std::this_thread::sleep_for(recorder.slowDuration);
+    }
+}
+
+/*!
+ * \brief  Overrun handler counting the reports and recording the one of the slow cycle.
+ */
+static void RecordOverrun(void* context, const OverrunInfo& info) noexcept
+{
+    Recorder& recorder = *static_cast<Recorder*>(context);
+    if (info.cycle == recorder.slowCycle) {
+        recorder.slowOverrun = info;
+    }
+    ++recorder.overrunReports;
+}
+
+/*!
+ * \brief  Returns a rate group configuration recording into \c recorder.
+ */
+static auto MakeConfig(Recorder& recorder, std::chrono::nanoseconds period, std::chrono::nanoseconds offset,
+                       OverrunPolicy policy) -> RateGroupConfig
+{
+    RateGroupConfig config{};
+    config.name           = "test_rg";
+    config.period         = period;
+    config.offset         = offset;
+    config.policy         = policy;
+    config.task           = &RecordCycle;
+    config.overrunHandler = &RecordOverrun;
+    config.context        = &recorder;
+    return config;
+}
+
+/*!
+ * \brief  Counts recorded cycles whose release is not exactly on the grid epoch + offset + cycle * period.
+ */
+static auto CountOffGrid(const Recorder& recorder, MonotonicTime epoch, std::chrono::nanoseconds period,
+                         std::chrono::nanoseconds offset) -> std::size_t
+{
+    std::size_t offGrid = 0U;
+    for (std::size_t i = 0U; i < recorder.count; ++i) {
+        const CycleInfo& info = recorder.cycles[i];
+        MonotonicTime const expected = epoch + offset + (period * static_cast<std::int64_t>(info.cycle));
+        if ((info.release != expected) || (info.lateness.count() < 0)) {
+            ++offGrid;
+        }
+    }
+    return offGrid;
+}
+
+/*!
+ * \brief  Counts recorded cycles whose index is not strictly increasing.
+ */
+static auto CountNonIncreasing(const Recorder& recorder) -> std::size_t
+{
+    std::size_t errors = 0U;
+    for (std::size_t i = 1U; i < recorder.count; ++i) {
+        if (recorder.cycles[i].cycle <= recorder.cycles[i - 1U].cycle) {
+            ++errors;
+        }
+    }
+    return errors;
+}
+
+/*!
+ * \brief  Runs a single rate group for \c runTime and fills \c statistics.
+ */
+static auto RunSingle(const RateGroupConfig& config, std::chrono::milliseconds runTime,
+                      RateGroupStatistics& statistics) -> MonotonicTime
+{
+    CyclicExecutive executive;
+    ErrorCode const added   = executive.AddRateGroup(config);
+    ErrorCode const started = executive.Start();
+    assert(added == ErrorCode::Success);
+    assert(started == ErrorCode::Success);
+    std::cout << "  AddRateGroup = " << static_cast<int>(added) << ", Start = " << static_cast<int>(started)
+              << " (expected 0, 0)\n";
+
+    std::this_thread::sleep_for(runTime);
+    executive.Stop();
+
+    statistics = executive.GetStatistics(0U);
+    return executive.GetEpoch();
+}
+
+/**********************************************************************************************************************
+ *  MAIN AND MENU
+ *********************************************************************************************************************/
+static void PrintUsage(const char* prog) {
+    std::cout << "Usage: " << prog << " [test_number]\n"
+              << "List of Available Tests:\n"
+              << "  1  - DeadlineTimer\n"
+              << "  2  - Configuration Validation\n"
+              << "  3  - Release Grid of a Single Rate Group\n"
+              << "  4  - Several Rate Groups on One Epoch\n"
+              << "  5  - OverrunPolicy::Skip\n"
+              << "  6  - OverrunPolicy::CatchUp\n"
+              << "  7  - OverrunPolicy::Report\n"
+              << "  8  - CycleMetrics Attached to a Rate Group\n";
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc != 2) {
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    std::string choice = argv[1];
+    if      (choice == "1")  TestDeadlineTimer();
+    else if (choice == "2")  TestConfiguration();
+    else if (choice == "3")  TestReleaseGrid();
+    else if (choice == "4")  TestMultipleRateGroups();
+    else if (choice == "5")  TestOverrunSkip();
+    else if (choice == "6")  TestOverrunCatchUp();
+    else if (choice == "7")  TestOverrunReport();
+    else if (choice == "8")  TestCycleMetrics();
+    else {
+        std::cout << "Invalid test number: " << choice << "\n";
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    return 0;
+}
+
+/**********************************************************************************************************************
+ *  TEST DEFINITIONS
+ *********************************************************************************************************************/
+
+/*!
+ * \brief Test #1: DeadlineTimer sleeps until (not for) the deadline
+ */
+void TestDeadlineTimer()
+{
+    std::cout << "\n=== Test 1: DeadlineTimer ===\n";
+    PlatformDeadlineTimer timer;
+    ErrorCode const opened = timer.Open();
+    assert(opened == ErrorCode::Success);
+
+    MonotonicTime const before   = PlatformDeadlineTimer::Now();
+    MonotonicTime const deadline = before + std::chrono::milliseconds(3);
+    ErrorCode const slept = timer.SleepUntil(deadline);
+    MonotonicTime const woke = PlatformDeadlineTimer::Now();
+    assert(slept == ErrorCode::Success);
+    assert(woke >= deadline);
+    std::cout << "Open = " << static_cast<int>(opened) << ", SleepUntil = " << static_cast<int>(slept)
+              << ", woke after deadline = " << (woke >= deadline) << " (expected 0, 0, 1)\n";
+
+    MonotonicTime const pastStart = PlatformDeadlineTimer::Now();
+    ErrorCode const pastSlept = timer.SleepUntil(pastStart - std::chrono::seconds(1));
+    MonotonicTime const pastWoke = PlatformDeadlineTimer::Now();
+    assert(pastSlept == ErrorCode::Success);
+    assert((pastWoke - pastStart) < std::chrono::milliseconds(100));
+    std::cout << "Past deadline: SleepUntil = " << static_cast<int>(pastSlept) << ", returned immediately = "
+              << ((pastWoke - pastStart) < std::chrono::milliseconds(100)) << " (expected 0, 1)\n";
+
+    timer.Interrupt();
+    MonotonicTime const interruptStart = PlatformDeadlineTimer::Now();
+    ErrorCode const interrupted = timer.SleepUntil(interruptStart + std::chrono::seconds(10));
+    ErrorCode const afterInterrupt = timer.SleepUntil(PlatformDeadlineTimer::Now() + std::chrono::milliseconds(1));
+    bool const early = (PlatformDeadlineTimer::Now() - interruptStart) < std::chrono::seconds(1);
+    assert(interrupted == ErrorCode::Interrupted);
+    assert(afterInterrupt == ErrorCode::Success);
+    assert(early);
+    std::cout << "Interrupt before sleep: SleepUntil = " << static_cast<int>(interrupted) << ", next SleepUntil = "
+              << static_cast<int>(afterInterrupt) << ", returned early = " << early << " (expected "
+              << static_cast<int>(ErrorCode::Interrupted) << ", 0, 1)\n";
+
+    timer.Close();
+}
+
+/*!
+ * \brief Test #2: Configuration validation
+ */
+void TestConfiguration()
+{
+    std::cout << "\n=== Test 2: Configuration Validation ===\n";
+    Recorder recorder;
+    CyclicExecutive executive;
+    std::chrono::milliseconds const period{10};
+
+    RateGroupConfig noTask = MakeConfig(recorder, period, std::chrono::nanoseconds{0}, OverrunPolicy::Skip);
+    noTask.task = nullptr;
+    RateGroupConfig zeroPeriod = MakeConfig(recorder, std::chrono::nanoseconds{0}, std::chrono::nanoseconds{0},
+                                            OverrunPolicy::Skip);
+    RateGroupConfig badOffset = MakeConfig(recorder, period, period, OverrunPolicy::Skip);
+    RateGroupConfig noHandler = MakeConfig(recorder, period, std::chrono::nanoseconds{0}, OverrunPolicy::Report);
+    noHandler.overrunHandler = nullptr;
+    RateGroupConfig badPriority = MakeConfig(recorder, period, std::chrono::nanoseconds{0}, OverrunPolicy::Skip);
+    badPriority.priority = -1;
+
+    std::size_t rejected = 0U;
+    rejected += (executive.AddRateGroup(noTask) == ErrorCode::InvalidArgument) ? 1U : 0U;
+    rejected += (executive.AddRateGroup(zeroPeriod) == ErrorCode::InvalidArgument) ? 1U : 0U;
+    rejected += (executive.AddRateGroup(badOffset) == ErrorCode::InvalidArgument) ? 1U : 0U;
+    rejected += (executive.AddRateGroup(noHandler) == ErrorCode::InvalidArgument) ? 1U : 0U;
+    rejected += (executive.AddRateGroup(badPriority) == ErrorCode::InvalidArgument) ? 1U : 0U;
+    assert(rejected == 5U);
+    std::cout << "Invalid configurations rejected = " << rejected << " (expected 5)\n";
+
+    ErrorCode const emptyStart = executive.Start();
+    assert(emptyStart == ErrorCode::InvalidArgument);
+    std::cout << "Start without rate groups = " << static_cast<int>(emptyStart) << " (expected "
+              << static_cast<int>(ErrorCode::InvalidArgument) << ")\n";
+
+    RateGroupConfig const valid = MakeConfig(recorder, period, std::chrono::nanoseconds{0}, OverrunPolicy::Skip);
+    std::size_t added = 0U;
+    for (std::size_t i = 0U; i < CyclicExecutive::kMaxRateGroups; ++i) {
+        added += (executive.AddRateGroup(valid) == ErrorCode::Success) ? 1U : 0U;
+    }
+    ErrorCode const overflow = executive.AddRateGroup(valid);
+    assert(added == CyclicExecutive::kMaxRateGroups);
+    assert(overflow == ErrorCode::CapacityExceeded);
+    std::cout << "Added = " << added << ", one more = " << static_cast<int>(overflow) << " (expected "
+              << CyclicExecutive::kMaxRateGroups << ", " << static_cast<int>(ErrorCode::CapacityExceeded) << ")\n";
+
+    CyclicExecutive running;
+    Recorder runningRecorder;
+    ErrorCode const first = running.AddRateGroup(
+        MakeConfig(runningRecorder, period, std::chrono::nanoseconds{0}, OverrunPolicy::Skip));
+    ErrorCode const started = running.Start();
+    ErrorCode const secondStart = running.Start();
+    ErrorCode const lateAdd = running.AddRateGroup(
+        MakeConfig(runningRecorder, period, std::chrono::nanoseconds{0}, OverrunPolicy::Skip));
+    bool const wasRunning = running.IsRunning();
+    running.Stop();
+    running.Stop();
+    bool const isRunning = running.IsRunning();
+
+    CyclicExecutive slow;
+    Recorder slowRecorder;
+    ErrorCode const slowAdded = slow.AddRateGroup(
+        MakeConfig(slowRecorder, std::chrono::seconds(10), std::chrono::nanoseconds{0}, OverrunPolicy::Skip));
+    ErrorCode const slowStarted = slow.Start();
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    MonotonicTime const stopBegin = PlatformDeadlineTimer::Now();
+    slow.Stop();
+    std::chrono::nanoseconds const stopLatency = PlatformDeadlineTimer::Now() - stopBegin;
+    assert((slowAdded == ErrorCode::Success) && (slowStarted == ErrorCode::Success));
+    assert(stopLatency < std::chrono::seconds(1));
+    std::cout << "Stop() of a 10 s rate group took " << stopLatency.count() << " ns (expected well below 1 s), added = "
+              << static_cast<int>(slowAdded) << ", started = " << static_cast<int>(slowStarted) << "\n";
+    assert(first == ErrorCode::Success);
+    assert(started == ErrorCode::Success);
+    assert(secondStart == ErrorCode::AlreadyRunning);
+    assert(lateAdd == ErrorCode::AlreadyRunning);
+    assert(wasRunning && !isRunning);
+    std::cout << "Start twice = " << static_cast<int>(secondStart) << ", Add while running = "
+              << static_cast<int>(lateAdd) << " (expected " << static_cast<int>(ErrorCode::AlreadyRunning)
+              << "), running before/after Stop = " << wasRunning << "/" << isRunning << " (expected 1/0)\n";
+    std::cout << "Count = " << running.GetRateGroupCount() << ", invalid statistics index cycles = "
+              << running.GetStatistics(7U).cycles << " (expected 1, 0), first = " << static_cast<int>(first)
+              << ", started = " << static_cast<int>(started) << "\n";
+}
+
+/*!
+ * \brief Test #3: Every release of a rate group lies exactly on epoch + offset + k * period
+ */
+void TestReleaseGrid()
+{
+    std::cout << "\n=== Test 3: Release Grid of a Single Rate Group ===\n";
+    Recorder recorder;
+    std::chrono::milliseconds const period{5};
+    std::chrono::milliseconds const offset{1};
+    RateGroupStatistics statistics{};
+    MonotonicTime const epoch = RunSingle(MakeConfig(recorder, period, offset, OverrunPolicy::Skip),
+                                          std::chrono::milliseconds(200), statistics);
+
+    std::size_t const offGrid    = CountOffGrid(recorder, epoch, period, offset);
+    std::size_t const nonMonotic = CountNonIncreasing(recorder);
+    assert(offGrid == 0U);
+    assert(nonMonotic == 0U);
+    assert(statistics.cycles == recorder.count);
+    assert(recorder.count >= 10U);
+    std::cout << "Cycles = " << statistics.cycles << " (about 40, at least 10), off-grid = " << offGrid
+              << ", non-increasing = " << nonMonotic << " (expected 0, 0)\n";
+    std::cout << "Max lateness = " << statistics.maxLateness.count() << " ns, overruns = " << statistics.overruns
+              << ", last error = " << static_cast<int>(statistics.lastError) << "\n";
+}
+
+/*!
+ * \brief Test #4: Several rate groups released on one common epoch
+ */
+void TestMultipleRateGroups()
+{
+    std::cout << "\n=== Test 4: Several Rate Groups on One Epoch ===\n";
+    Recorder fast;
+    Recorder slow;
+    std::chrono::milliseconds const fastPeriod{2};
+    std::chrono::milliseconds const slowPeriod{8};
+    std::chrono::milliseconds const slowOffset{1};
+
+    CyclicExecutive executive;
+    ErrorCode const addedFast = executive.AddRateGroup(
+        MakeConfig(fast, fastPeriod, std::chrono::nanoseconds{0}, OverrunPolicy::Skip));
+    ErrorCode const addedSlow = executive.AddRateGroup(
+        MakeConfig(slow, slowPeriod, slowOffset, OverrunPolicy::Skip));
+    ErrorCode const started = executive.Start();
+    assert((addedFast == ErrorCode::Success) && (addedSlow == ErrorCode::Success));
+    assert(started == ErrorCode::Success);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    executive.Stop();
+
+    MonotonicTime const epoch = executive.GetEpoch();
+    std::size_t const offGrid = CountOffGrid(fast, epoch, fastPeriod, std::chrono::nanoseconds{0}) +
+                                CountOffGrid(slow, epoch, slowPeriod, slowOffset);
+    RateGroupStatistics const fastStatistics = executive.GetStatistics(0U);
+    RateGroupStatistics const slowStatistics = executive.GetStatistics(1U);
+    std::uint64_t const fastReleases = fast.cycles[fast.count - 1U].cycle + 1U;
+    std::uint64_t const slowReleases = slow.cycles[slow.count - 1U].cycle + 1U;
+    assert(offGrid == 0U);
+    assert(slow.count >= 5U);
+    assert((fastReleases >= (3U * slowReleases)) && (fastReleases <= ((4U * slowReleases) + 4U)));
+    std::cout << "Fast cycles = " << fastStatistics.cycles << ", slow cycles = " << slowStatistics.cycles
+              << " (ratio about 4), releases = " << fastReleases << "/" << slowReleases << ", off-grid = " << offGrid
+              << " (expected 0), added = " << static_cast<int>(addedFast) << "/" << static_cast<int>(addedSlow)
+              << ", started = " << static_cast<int>(started) << "\n";
+}
+
+/*!
+ * \brief Test #5: A slow cycle drops the releases that passed while it ran
+ */
+void TestOverrunSkip()
+{
+    std::cout << "\n=== Test 5: OverrunPolicy::Skip ===\n";
+    Recorder recorder;
+    recorder.slowDuration = std::chrono::milliseconds(13);
+    std::chrono::milliseconds const period{4};
+    RateGroupStatistics statistics{};
+    MonotonicTime const epoch = RunSingle(MakeConfig(recorder, period, std::chrono::nanoseconds{0},
+                                                               OverrunPolicy::Skip),
+                                          std::chrono::milliseconds(100), statistics);
+
+    std::size_t gapAfterSlow = 0U;
+    for (std::size_t i = 1U; i < recorder.count; ++i) {
+        if (recorder.cycles[i - 1U].cycle == recorder.slowCycle) {
+            gapAfterSlow = static_cast<std::size_t>(recorder.cycles[i].cycle - recorder.slowCycle);
+        }
+    }
+    std::size_t const offGrid = CountOffGrid(recorder, epoch, period, std::chrono::nanoseconds{0});
+    assert(statistics.overruns >= 1U);
+    assert(statistics.skippedReleases >= 3U);
+    assert(gapAfterSlow >= 4U);
+    assert(offGrid == 0U);
+    assert((statistics.cycles + statistics.skippedReleases) == (recorder.cycles[recorder.count - 1U].cycle + 1U));
+    std::cout << "Overruns = " << statistics.overruns << ", skipped = " << statistics.skippedReleases
+              << " (at least 1, 3), next cycle after slow one = +" << gapAfterSlow << " (at least +4), off-grid = "
+              << offGrid << " (expected 0)\n";
+}
+
+/*!
+ * \brief Test #6: A slow cycle is followed by the passed releases, back-to-back
+ */
+void TestOverrunCatchUp()
+{
+    std::cout << "\n=== Test 6: OverrunPolicy::CatchUp ===\n";
+    Recorder recorder;
+    recorder.slowDuration = std::chrono::milliseconds(13);
+    std::chrono::milliseconds const period{4};
+    RateGroupStatistics statistics{};
+    MonotonicTime const epoch = RunSingle(MakeConfig(recorder, period, std::chrono::nanoseconds{0},
+                                                               OverrunPolicy::CatchUp),
+                                          std::chrono::milliseconds(100), statistics);
+
+    std::size_t gaps = 0U;
+    for (std::size_t i = 1U; i < recorder.count; ++i) {
+        gaps += (recorder.cycles[i].cycle != (recorder.cycles[i - 1U].cycle + 1U)) ? 1U : 0U;
+    }
+    std::chrono::nanoseconds const catchUpLateness =
+        (recorder.count > 3U) ? recorder.cycles[3].lateness : std::chrono::nanoseconds{0};
+    std::size_t const offGrid = CountOffGrid(recorder, epoch, period, std::chrono::nanoseconds{0});
+    assert(statistics.overruns >= 1U);
+    assert(statistics.skippedReleases == 0U);
+    assert(gaps == 0U);
+    assert(offGrid == 0U);
+    assert(catchUpLateness >= std::chrono::milliseconds(1));
+    std::cout << "Overruns = " << statistics.overruns << ", skipped = " << statistics.skippedReleases
+              << ", gaps = " << gaps << " (at least 1, 0, 0), lateness of first caught-up cycle = "
+              << catchUpLateness.count() << " ns, off-grid = " << offGrid << " (expected 0)\n";
+}
+
+/*!
+ * \brief Test #7: A slow cycle is reported to the overrun handler
+ */
+void TestOverrunReport()
+{
+    std::cout << "\n=== Test 7: OverrunPolicy::Report ===\n";
+    Recorder recorder;
+    recorder.slowDuration = std::chrono::milliseconds(13);
+    std::chrono::milliseconds const period{4};
+    RateGroupStatistics statistics{};
+    MonotonicTime const epoch = RunSingle(MakeConfig(recorder, period, std::chrono::nanoseconds{0},
+                                                               OverrunPolicy::Report),
+                                          std::chrono::milliseconds(100), statistics);
+
+    std::size_t const offGrid = CountOffGrid(recorder, epoch, period, std::chrono::nanoseconds{0});
+    assert(recorder.overrunReports == statistics.overruns);
+    assert(recorder.overrunReports >= 1U);
+    assert(recorder.slowOverrun.missedReleases >= 3U);
+    assert(recorder.slowOverrun.executionTime >= std::chrono::milliseconds(13));
+    assert(statistics.skippedReleases >= recorder.slowOverrun.missedReleases);
+    assert(offGrid == 0U);
+    std::cout << "Reports = " << recorder.overrunReports << " (overruns = " << statistics.overruns
+              << "), slow: cycle " << recorder.slowOverrun.cycle << ", missed " << recorder.slowOverrun.missedReleases
+              << " (at least 3), execution " << recorder.slowOverrun.executionTime.count()
+              << " ns, off-grid = " << offGrid << " (expected 0)\n";
+}
+
+/*!
+ * \brief Test #8: The CycleMetrics of a rate group see every cycle and every overrun
+ */
+void TestCycleMetrics()
+{
+    std::cout << "\n=== Test 8: CycleMetrics Attached to a Rate Group ===\n";
+    static CycleMetrics metrics;
+    Recorder recorder;
+    recorder.slowDuration = std::chrono::milliseconds(13);
+    std::chrono::milliseconds const period{4};
+    RateGroupConfig config = MakeConfig(recorder, period, std::chrono::nanoseconds{0}, OverrunPolicy::Skip);
+    config.metrics = &metrics;
+    RateGroupStatistics statistics{};
+    MonotonicTime const epoch = RunSingle(config, std::chrono::milliseconds(100), statistics);
+
+    CycleMetricsSummary const summary = metrics.GetSummary();
+    std::uint64_t const maxLateness = static_cast<std::uint64_t>(statistics.maxLateness.count());
+    std::uint64_t const maxExecution = static_cast<std::uint64_t>(statistics.maxExecutionTime.count());
+    assert(summary.wakeUpLatency.count == statistics.cycles);
+    assert(summary.executionTime.count == statistics.cycles);
+    assert(summary.overruns == statistics.overruns);
+    assert(summary.wakeUpLatency.max == maxLateness);
+    assert(summary.executionTime.max == maxExecution);
+    assert(summary.executionTime.max >= 13000000U);
+    assert(summary.executionTime.p50 <= summary.executionTime.p99);
+    std::cout << "Epoch = " << epoch.count() << " ns, cycles = " << statistics.cycles << ", samples = "
+              << summary.wakeUpLatency.count << "/" << summary.executionTime.count << ", overruns = "
+              << summary.overruns << " (samples equal cycles, overruns = " << statistics.overruns << ")\n";
+    std::cout << "Latency p50/p99/max = " << summary.wakeUpLatency.p50 << "/" << summary.wakeUpLatency.p99 << "/"
+              << summary.wakeUpLatency.max << " ns, execution p50/p99/max = " << summary.executionTime.p50 << "/"
+              << summary.executionTime.p99 << "/" << summary.executionTime.max << " ns (statistics max = " << maxLateness
+              << "/" << maxExecution << " ns)\n";
+}
@@ -0,0 +1,438 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara_os_event_loop.cpp
+ *  \brief      Test application for the ara::os::interface::event Reactor and EventLoop.
+ *
+ *  \details    This file contains multiple test functions covering:
+ *              1.  Configuration validation (arguments, capacity, running state)
+ *              2.  Periodic timer dispatch and Stop() from a handler
+ *              3.  Descriptor readiness (pipe), level-triggered, and RunOnce() timeouts
+ *              4.  Signal dispatch through the loop (signal sent to the whole process)
+ *              5.  Stop() before Run() and from another thread; all sources served by one thread
+ *              6.  Post() from other threads: tasks run on the loop thread, in order, bounded queue
+ *
+ *              Timing checks only assert lower bounds and generous upper bounds, so that loaded machines do not
+ *              fail.
+ *
+ *  \note       All variables are used, preventing compiler warnings about unused variables.
+ *********************************************************************************************************************/
+
+#include "ara/os/interface/event/event_loop.h"  // The EventLoop and PlatformReactor
+#include <iostream>         // For std::cout (demonstrations)
+#include <string>           // For std::string
+#include <cassert>          // For runtime checks via assert
+#include <chrono>           // For std::chrono durations
+#include <csignal>          // For SIGUSR1, SIGUSR2
+#include <cstdint>          // For std::uint64_t
+#include <initializer_list> // For the range-for over the recorders
+#include <pthread.h>        // For pthread_self, pthread_equal
+#include <signal.h>         // For kill
+#include <thread>           // For std::thread, std::this_thread::sleep_for
+#include <unistd.h>         // For pipe, read, write, close, getpid
+
+using ara::os::interface::event::ErrorCode;
+using ara::os::interface::event::Event;
+using ara::os::interface::event::EventLoop;
+using ara::os::interface::event::Readiness;
+using ara::os::interface::event::SourceKind;
+
+/**********************************************************************************************************************
+ *  FORWARD DECLARATIONS
+ *********************************************************************************************************************/
+void TestConfiguration();       // Test #1
+void TestTimer();               // Test #2
+void TestDescriptor();          // Test #3
+void TestSignal();              // Test #4
+void TestStop();                // Test #5
+void TestPost();                // Test #6
+
+/**********************************************************************************************************************
+ *  HELPERS
+ *********************************************************************************************************************/
+/*!
+ * \brief  State shared with the handlers (written on the loop thread, read after Run()).
+ */
+struct Recorder {
+    EventLoop*    loop{nullptr};
+    std::size_t   calls{0U};
+    std::size_t   stopAfter{0U};        // Stop the loop after this many calls (0: never)
+    std::uint64_t lastValue{0U};
+    std::uint64_t valueSum{0U};
+    SourceKind    lastKind{SourceKind::Signal};
+    int           descriptor{-1};       // Read one byte from it on every call (descriptor sources)
+    bool          sameThread{true};
+    pthread_t     expectedThread{};
+};
+
+/*!
+ * \brief  Context of a posted task: the recorder and the digit the task appends.
+ */
+struct PostedTag {
+    Recorder*     recorder{nullptr};
+    std::uint64_t value{0U};
+};
+
+/*!
+ * \brief  Handler recording the event and stopping the loop after Recorder::stopAfter calls.
+ */
+static void Record(void* context, const Event& event) noexcept
+{
+    Recorder& recorder = *static_cast<Recorder*>(context);
+    ++recorder.calls;
+    recorder.lastValue = event.value;
+    recorder.valueSum += event.value;
+    recorder.lastKind  = event.kind;
+    recorder.sameThread = recorder.sameThread && (::pthread_equal(::pthread_self(), recorder.expectedThread) != 0);
+    if (recorder.descriptor != -1) {
+        char byte{0};
+        ssize_t const consumed = ::read(recorder.descriptor, &byte, 1U);
+        static_cast<void>(consumed);
+    }
+    if ((recorder.stopAfter != 0U) && (recorder.calls >= recorder.stopAfter)) {
+        recorder.loop->Stop();
+    }
+}
+
+/*!
+ * \brief  Posted task: appends its tag to the Recorder::valueSum digits and records the thread.
+ */
+static void RecordPosted(void* context) noexcept
+{
+    PostedTag& tag = *static_cast<PostedTag*>(context);
+    ++tag.recorder->calls;
+    tag.recorder->valueSum = (tag.recorder->valueSum * 10U) + tag.value;
+    tag.recorder->sameThread =
+        tag.recorder->sameThread && (::pthread_equal(::pthread_self(), tag.recorder->expectedThread) != 0);
+}
+
+/*!
+ * \brief  Milliseconds elapsed since \c start on the steady clock.
+ */
+static auto ElapsedMs(std::chrono::steady_clock::time_point start) -> std::int64_t
+{
+    return static_cast<std::int64_t>(
+        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count());
+}
+
+/**********************************************************************************************************************
+ *  MAIN AND MENU
+ *********************************************************************************************************************/
+static void PrintUsage(const char* prog) {
+    std::cout << "Usage: " << prog << " [test_number]\n"
+              << "List of Available Tests:\n"
+              << "  1  - Configuration Validation\n"
+              << "  2  - Periodic Timer Dispatch\n"
+              << "  3  - Descriptor Readiness and RunOnce\n"
+              << "  4  - Signal Dispatch\n"
+              << "  5  - Stop() Semantics and Single Thread\n"
+              << "  6  - Post() to the Loop Thread\n";
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc != 2) {
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    std::string choice = argv[1];
+    if      (choice == "1")  TestConfiguration();
+    else if (choice == "2")  TestTimer();
+    else if (choice == "3")  TestDescriptor();
+    else if (choice == "4")  TestSignal();
+    else if (choice == "5")  TestStop();
+    else if (choice == "6")  TestPost();
+    else {
+        std::cout << "Invalid test number.\n";
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    return 0;
+}
+
+/**********************************************************************************************************************
+ *  TEST IMPLEMENTATIONS
+ *********************************************************************************************************************/
+/*!
+ * \brief Test #1: Configuration validation
+ */
+void TestConfiguration()
+{
+    std::cout << "\n=== Test 1: Configuration Validation ===\n";
+    EventLoop loop{};
+    Recorder recorder{};
+
+    // No source: Run() would block forever
+    ErrorCode const empty       = loop.Run();
+    ErrorCode const noHandler   = loop.AddTimer(std::chrono::milliseconds{1}, nullptr, &recorder);
+    ErrorCode const zeroPeriod  = loop.AddTimer(std::chrono::nanoseconds{0}, &Record, &recorder);
+    ErrorCode const badSignal   = loop.AddSignal(0, &Record, &recorder);
+    ErrorCode const badFd       = loop.AddDescriptor(-1, Readiness::kReadable, &Record, &recorder);
+    ErrorCode const noInterest  = loop.AddDescriptor(0, 0U, &Record, &recorder);
+    bool const noneAdded        = (loop.GetSourceCount() == 0U);
+
+    std::size_t added{0U};
+    while (loop.AddTimer(std::chrono::seconds{10}, &Record, &recorder) == ErrorCode::Success) {
+        ++added;
+    }
+    ErrorCode const full = loop.AddTimer(std::chrono::seconds{10}, &Record, &recorder);
+
+    loop.Close();
+    bool const closed = (loop.GetSourceCount() == 0U);
+    ErrorCode const reopened = loop.AddTimer(std::chrono::seconds{10}, &Record, &recorder);
+
+    assert((empty == ErrorCode::InvalidArgument) && (noHandler == ErrorCode::InvalidArgument));
+    assert((zeroPeriod == ErrorCode::InvalidArgument) && (badSignal == ErrorCode::InvalidArgument));
+    assert((badFd == ErrorCode::InvalidArgument) && (noInterest == ErrorCode::InvalidArgument) && noneAdded);
+    assert((added == EventLoop::kMaxSources) && (full == ErrorCode::CapacityExceeded));
+    assert(closed && (reopened == ErrorCode::Success));
+    std::cout << "Empty run = " << static_cast<int>(empty) << ", invalid arguments = "
+              << static_cast<int>(noHandler) << static_cast<int>(zeroPeriod) << static_cast<int>(badSignal)
+              << static_cast<int>(badFd) << static_cast<int>(noInterest) << ", none added = " << noneAdded
+              << ", sources added = " << added << ", then = " << static_cast<int>(full)
+              << ", closed = " << closed << ", re-added after Close() = " << static_cast<int>(reopened)
+              << " (expected 1, 11111, 1, " << EventLoop::kMaxSources << ", 2, 1, 0)\n";
+}
+
+/*!
+ * \brief Test #2: Periodic timer dispatch and Stop() from a handler
+ */
+void TestTimer()
+{
+    std::cout << "\n=== Test 2: Periodic Timer Dispatch ===\n";
+    constexpr std::size_t kExpiries{5U};
+    EventLoop loop{};
+    Recorder recorder{};
+    recorder.loop = &loop;
+    recorder.stopAfter = kExpiries;
+    recorder.expectedThread = ::pthread_self();
+
+    ErrorCode const added = loop.AddTimer(std::chrono::milliseconds{10}, &Record, &recorder);
+    auto const start = std::chrono::steady_clock::now();
+    ErrorCode const result = loop.Run();
+    std::int64_t const elapsed = ElapsedMs(start);
+
+    // Each dispatch reports the expirations since the last one; together they cover the elapsed periods
+    bool const countOk = (recorder.calls == kExpiries) && (recorder.valueSum >= kExpiries);
+    bool const timingOk = (elapsed >= 45) && (elapsed < 5000);
+    bool const stopped = !loop.IsRunning();
+
+    assert((added == ErrorCode::Success) && (result == ErrorCode::Success));
+    assert(countOk && timingOk && stopped && (recorder.lastKind == SourceKind::Timer) && recorder.sameThread);
+    std::cout << "Add/Run = " << static_cast<int>(added) << "/" << static_cast<int>(result)
+              << ", dispatches = " << recorder.calls << ", expirations = " << recorder.valueSum
+              << ", elapsed = " << elapsed << " ms, count/timing ok = " << countOk << "/" << timingOk
+              << ", stopped = " << stopped << " (expected 0/0, 5, >= 5, >= 50 ms, 1/1, 1)\n";
+}
+
+/*!
+ * \brief Test #3: Descriptor readiness (pipe), level-triggered, and RunOnce() timeouts
+ */
+void TestDescriptor()
+{
+    std::cout << "\n=== Test 3: Descriptor Readiness and RunOnce ===\n";
+    int fds[2]{-1, -1};
+    bool const piped = (::pipe(fds) == 0);
+    assert(piped);
+
+    EventLoop loop{};
+    Recorder recorder{};
+    recorder.loop = &loop;
+    recorder.descriptor = fds[0];
+    recorder.expectedThread = ::pthread_self();
+    ErrorCode const added = loop.AddDescriptor(fds[0], Readiness::kReadable, &Record, &recorder);
+
+    // Nothing written yet: a RunOnce() with a timeout returns without a dispatch
+    auto const start = std::chrono::steady_clock::now();
+    ErrorCode const idle = loop.RunOnce(std::chrono::milliseconds{20});
+    std::int64_t const idleMs = ElapsedMs(start);
+    bool const idleOk = (recorder.calls == 0U) && (idleMs >= 19);
+
+    // Two bytes, one consumed per dispatch: level-triggered readiness reports the second one again
+    char const bytes[2]{'a', 'b'};
+    ssize_t const written = ::write(fds[1], bytes, sizeof(bytes));
+    static_cast<void>(written);
+    ErrorCode const first  = loop.RunOnce(std::chrono::milliseconds{1000});
+    ErrorCode const second = loop.RunOnce(std::chrono::milliseconds{1000});
+    ErrorCode const drained = loop.RunOnce(std::chrono::nanoseconds{0});
+    bool const levelOk = (recorder.calls == 2U) && ((recorder.lastValue & Readiness::kReadable) != 0U);
+
+    // Writer thread: Run() wakes on the readiness and the handler stops the loop
+    recorder.stopAfter = 3U;
+    std::thread writer([&fds]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds{10});
+        char const byte{'c'};
+        ssize_t const sent = ::write(fds[1], &byte, 1U);
+        static_cast<void>(sent);
+    });
+    ErrorCode const run = loop.Run();
+    writer.join();
+
+    static_cast<void>(::close(fds[0]));
+    static_cast<void>(::close(fds[1]));
+
+    assert((added == ErrorCode::Success) && (idle == ErrorCode::Success) && idleOk);
+    assert((first == ErrorCode::Success) && (second == ErrorCode::Success) && (drained == ErrorCode::Success));
+    assert(levelOk && (run == ErrorCode::Success) && (recorder.calls == 3U) && recorder.sameThread);
+    std::cout << "Pipe = " << piped << ", Add/RunOnce x4/Run = " << static_cast<int>(added) << "/"
+              << static_cast<int>(idle) << static_cast<int>(first) << static_cast<int>(second)
+              << static_cast<int>(drained) << "/" << static_cast<int>(run)
+              << ", idle RunOnce without dispatch = " << idleOk << " (" << idleMs << " ms)"
+              << ", level-triggered = " << levelOk << ", woken by writer = " << (recorder.calls == 3U)
+              << " (expected 1, 0/0000/0, 1 (>= 20 ms), 1, 1)\n";
+}
+
+/*!
+ * \brief Test #4: Signal dispatch through the loop (signal sent to the whole process)
+ */
+void TestSignal()
+{
+    std::cout << "\n=== Test 4: Signal Dispatch ===\n";
+    EventLoop loop{};
+    Recorder usr1{};
+    Recorder usr2{};
+    usr1.loop = &loop;
+    usr2.loop = &loop;
+    usr2.stopAfter = 1U;
+    usr1.expectedThread = ::pthread_self();
+    usr2.expectedThread = ::pthread_self();
+
+    // Registered before any thread is created: the signals are blocked in the whole (single-threaded) process
+    ErrorCode const added1 = loop.AddSignal(SIGUSR1, &Record, &usr1);
+    ErrorCode const added2 = loop.AddSignal(SIGUSR2, &Record, &usr2);
+    ErrorCode const twice  = loop.AddSignal(SIGUSR1, &Record, &usr1);
+
+    static_cast<void>(::kill(::getpid(), SIGUSR1));
+    ErrorCode const once = loop.RunOnce(std::chrono::milliseconds{1000});
+    bool const usr1Ok = (usr1.calls == 1U) && (usr1.lastValue == static_cast<std::uint64_t>(SIGUSR1));
+
+    static_cast<void>(::kill(::getpid(), SIGUSR2));
+    ErrorCode const run = loop.Run();
+    bool const usr2Ok = (usr2.calls == 1U) && (usr2.lastValue == static_cast<std::uint64_t>(SIGUSR2));
+
+    assert((added1 == ErrorCode::Success) && (added2 == ErrorCode::Success));
+    assert((twice == ErrorCode::InvalidArgument) && (once == ErrorCode::Success) && (run == ErrorCode::Success));
+    assert(usr1Ok && usr2Ok && (usr2.lastKind == SourceKind::Signal) && usr1.sameThread);
+    std::cout << "Add x2/RunOnce/Run = " << static_cast<int>(added1) << static_cast<int>(added2) << "/"
+              << static_cast<int>(once) << "/" << static_cast<int>(run) << ", SIGUSR1 dispatched = " << usr1Ok
+              << ", SIGUSR2 stopped the loop = " << usr2Ok << ", duplicate rejected = "
+              << (twice == ErrorCode::InvalidArgument) << " (expected 00/0/0, 1, 1, 1)\n";
+}
+
+/*!
+ * \brief Test #5: Stop() before Run() and from another thread; all sources served by one thread
+ */
+void TestStop()
+{
+    std::cout << "\n=== Test 5: Stop() Semantics and Single Thread ===\n";
+    int fds[2]{-1, -1};
+    bool const piped = (::pipe(fds) == 0);
+    assert(piped);
+
+    EventLoop loop{};
+    Recorder slowTimer{};
+    Recorder fastTimer{};
+    Recorder descriptor{};
+    for (Recorder* recorder : {&slowTimer, &fastTimer, &descriptor}) {
+        recorder->loop = &loop;
+        recorder->expectedThread = ::pthread_self();
+    }
+    descriptor.descriptor = fds[0];
+    ErrorCode const added = ((loop.AddTimer(std::chrono::seconds{10}, &Record, &slowTimer) == ErrorCode::Success) &&
+                             (loop.AddTimer(std::chrono::milliseconds{5}, &Record, &fastTimer) == ErrorCode::Success) &&
+                             (loop.AddDescriptor(fds[0], Readiness::kReadable, &Record, &descriptor) ==
+                              ErrorCode::Success))
+                                ? ErrorCode::Success
+                                : ErrorCode::UnknownError;
+
+    // A stop request issued before Run() is not lost
+    loop.Stop();
+    auto start = std::chrono::steady_clock::now();
+    ErrorCode const early = loop.Run();
+    std::int64_t const earlyMs = ElapsedMs(start);
+
+    // Stop() from another thread, after it also fed the descriptor
+    std::thread stopper([&loop, &fds]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds{50});
+        char const byte{'x'};
+        ssize_t const sent = ::write(fds[1], &byte, 1U);
+        static_cast<void>(sent);
+        std::this_thread::sleep_for(std::chrono::milliseconds{20});
+        loop.Stop();
+    });
+    start = std::chrono::steady_clock::now();
+    ErrorCode const run = loop.Run();
+    std::int64_t const runMs = ElapsedMs(start);
+    stopper.join();
+
+    static_cast<void>(::close(fds[0]));
+    static_cast<void>(::close(fds[1]));
+
+    bool const served = (fastTimer.calls > 0U) && (descriptor.calls == 1U) && (slowTimer.calls == 0U);
+    bool const oneThread = fastTimer.sameThread && descriptor.sameThread;
+    assert((added == ErrorCode::Success) && (early == ErrorCode::Success) && (earlyMs < 1000));
+    assert((run == ErrorCode::Success) && (runMs >= 60) && (runMs < 5000) && served && oneThread);
+    std::cout << "Pipe = " << piped << ", Add/Run x2 = " << static_cast<int>(added) << "/"
+              << static_cast<int>(early) << static_cast<int>(run)
+              << ", early stop returned after " << earlyMs << " ms, stopped by thread after " << runMs
+              << " ms, timer + descriptor served = " << served << ", on one thread = " << oneThread
+              << " (expected 1, 0/00, ~0 ms, ~70 ms, 1, 1)\n";
+}
+
+/*!
+ * \brief Test #6: Post() from other threads: tasks run on the loop thread, in order, bounded queue
+ */
+void TestPost()
+{
+    std::cout << "\n=== Test 6: Post() to the Loop Thread ===\n";
+    EventLoop loop{};
+    Recorder timer{};
+    Recorder posted{};
+    posted.expectedThread = ::pthread_self();
+    ErrorCode const added = loop.AddTimer(std::chrono::seconds{10}, &Record, &timer);
+
+    // Three tasks posted by another thread wake the wait and run in posting order on the loop thread
+    PostedTag tags[3]{{&posted, 1U}, {&posted, 2U}, {&posted, 3U}};
+    std::thread poster([&loop, &tags]() {
+        for (PostedTag& tag : tags) {
+            bool const queued = loop.Post(&RecordPosted, &tag);
+            assert(queued);
+            static_cast<void>(queued);
+        }
+    });
+    poster.join();
+    auto const start = std::chrono::steady_clock::now();
+    ErrorCode const once = loop.RunOnce(std::chrono::milliseconds{5000});
+    std::int64_t const onceMs = ElapsedMs(start);
+    std::uint64_t const order = posted.valueSum;
+
+    // The queue holds kMaxPostedTasks tasks; a null task is refused
+    std::size_t queued{0U};
+    PostedTag filler{&posted, 0U};
+    while (loop.Post(&RecordPosted, &filler)) {
+        ++queued;
+    }
+    bool const nullRefused = !loop.Post(nullptr, &filler);
+    ErrorCode const drained = loop.RunOnce(std::chrono::nanoseconds{0});
+    std::size_t const calls = posted.calls;
+    loop.Close();
+
+    assert((added == ErrorCode::Success) && (once == ErrorCode::Success) && (onceMs < 1000));
+    assert((order == 123U) && posted.sameThread && (timer.calls == 0U));
+    assert((queued == EventLoop::kMaxPostedTasks) && nullRefused && (drained == ErrorCode::Success));
+    assert(calls == (3U + EventLoop::kMaxPostedTasks));
+    std::cout << "AddTimer/RunOnce x2 = " << static_cast<int>(added) << "/" << static_cast<int>(once)
+              << static_cast<int>(drained) << ", posted order = " << order << " after " << onceMs
+              << " ms, on the loop thread = " << posted.sameThread << ", queue capacity = " << queued
+              << ", null refused = " << nullRefused << ", tasks run = " << calls
+              << " (expected 0/00, 123, < 1000 ms, 1, " << EventLoop::kMaxPostedTasks << ", 1, "
+              << (3U + EventLoop::kMaxPostedTasks) << ")\n";
+}
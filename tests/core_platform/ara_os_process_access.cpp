@@ -0,0 +1,248 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara_os_process_access.cpp
+ *  \brief      Test application for the ara::os::interface::process::ProcessAccess static (CRTP) interface.
+ *
+ *  \details    This file contains multiple test functions covering:
+ *              1.  Process name retrieval through PlatformProcessAccess, cross-checked with /proc/self/comm and the
+ *                  virtual ProcessInteraction path
+ *              2.  Buffer one byte too small for the name (and exactly large enough)
+ *              3.  Buffer of capacity 0 and null buffer
+ *              4.  Process name read from a worker thread with a different thread name
+ *              5.  Static dispatch to a custom backend
+ *
+ *  \note       All variables are used, preventing compiler warnings about unused variables.
+ *********************************************************************************************************************/
+
+#include "ara/os/interface/process/process_access.h"     // ProcessAccess
+#include "ara/os/interface/process/process_factory.h"    // For PlatformProcessAccess, ProcessFactory
+#include <iostream>         // For std::cout (demonstrations)
+#include <fstream>          // For std::ifstream (reference reading of /proc/self/comm)
+#include <string>           // For std::string
+#include <cassert>          // For runtime checks via assert
+#include <cstring>          // For std::strcmp, std::strlen, std::memset
+#include <thread>           // For std::thread
+#include <pthread.h>        // For pthread_setname_np
+#include <sys/prctl.h>      // For prctl, PR_SET_NAME
+
+using ara::os::interface::process::ErrorCode;
+using ara::os::interface::process::PlatformProcessAccess;
+using ara::os::interface::process::ProcessAccess;
+using ara::os::interface::process::ProcessFactory;
+using ara::os::interface::process::ResourceUsage;
+
+/**********************************************************************************************************************
+ *  FORWARD DECLARATIONS
+ *********************************************************************************************************************/
+void TestNameRetrieval();       // Test #1
+void TestBufferTooSmall();      // Test #2
+void TestZeroCapacity();        // Test #3
+void TestNameFromWorker();      // Test #4
+void TestCustomBackend();       // Test #5
+
+/**********************************************************************************************************************
+ *  HELPERS
+ *********************************************************************************************************************/
+/*!
+ * \brief  Name the test process gives itself (fits the 15 characters of the kernel comm field).
+ */
+constexpr const char* kProcessName{"access_test"};
+
+/*!
+ * \brief  Size of the name buffers of the tests.
+ */
+constexpr std::size_t kNameBufferSize{64U};
+
+/*!
+ * \brief  The process name as read with iostreams from /proc/self/comm, without the trailing newline.
+ */
+static auto ReferenceName() -> std::string
+{
+    std::ifstream comm{"/proc/self/comm"};
+    std::string name{};
+    std::getline(comm, name);
+    return name;
+}
+
+/*!
+ * \brief  Backend answering from fixed values, counting its calls.
+ */
+class FakeProcessAccess final : public ProcessAccess<FakeProcessAccess> {
+public:
+    static auto GetProcessNameImpl(char* buffer, std::size_t bufferSize) noexcept -> ErrorCode
+    {
+        ++nameCalls;
+        if (bufferSize < 5U) {
+            return ErrorCode::BufferTooSmall;
+        }
+        std::memcpy(buffer, "fake", 5U);
+        return ErrorCode::Success;
+    }
+
+    static auto GetResourceUsageImpl(ResourceUsage& usage) noexcept -> ErrorCode
+    {
+        ++usageCalls;
+        usage.residentBytes = 4096U;
+        return ErrorCode::Success;
+    }
+
+    static int nameCalls;
+    static int usageCalls;
+};
+
+int FakeProcessAccess::nameCalls{0};
+int FakeProcessAccess::usageCalls{0};
+
+/**********************************************************************************************************************
+ *  MAIN FUNCTION
+ *********************************************************************************************************************/
+static void PrintUsage(const char* prog) {
+    std::cout << "Usage: " << prog << " [test_number]\n"
+              << "List of Available Tests:\n"
+              << "  1  - Process Name Retrieval\n"
+              << "  2  - Buffer Too Small\n"
+              << "  3  - Zero Capacity and Null Buffer\n"
+              << "  4  - Process Name from a Worker Thread\n"
+              << "  5  - Custom Backend\n";
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc != 2) {
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    // A known name: the executable name is longer than the kernel keeps
+    static_cast<void>(::prctl(PR_SET_NAME, kProcessName, 0, 0, 0));
+
+    std::string choice = argv[1];
+    if      (choice == "1")  TestNameRetrieval();
+    else if (choice == "2")  TestBufferTooSmall();
+    else if (choice == "3")  TestZeroCapacity();
+    else if (choice == "4")  TestNameFromWorker();
+    else if (choice == "5")  TestCustomBackend();
+    else {
+        std::cout << "Invalid test number.\n";
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    return 0;
+}
+
+/**********************************************************************************************************************
+ *  TEST IMPLEMENTATIONS
+ *********************************************************************************************************************/
+/*!
+ * \brief Test #1: Process name through PlatformProcessAccess, /proc/self/comm and ProcessInteraction
+ */
+void TestNameRetrieval()
+{
+    std::cout << "\n=== Test 1: Process Name Retrieval ===\n";
+    char name[kNameBufferSize]{};
+    ErrorCode const result = PlatformProcessAccess::GetProcessName(name, sizeof(name));
+    std::string const reference = ReferenceName();
+    std::cout << "GetProcessName => " << static_cast<int>(result) << ", \"" << name << "\", /proc/self/comm \""
+              << reference << "\" (expected 0, \"" << kProcessName << "\" twice)\n";
+    assert(result == ErrorCode::Success);
+    assert(std::strcmp(name, kProcessName) == 0);
+    assert(reference == name);
+
+    // The virtual path shares the platform implementation
+    auto const interaction = ProcessFactory::CreateInstance();
+    char virtualName[kNameBufferSize]{};
+    [[maybe_unused]] ErrorCode const virtualResult = interaction->GetProcessName(virtualName, sizeof(virtualName));
+    std::cout << "ProcessInteraction::GetProcessName => \"" << virtualName << "\"\n";
+    assert((virtualResult == ErrorCode::Success) && (std::strcmp(virtualName, name) == 0));
+}
+
+/*!
+ * \brief Test #2: A buffer without room for the terminator is refused and left untouched
+ */
+void TestBufferTooSmall()
+{
+    std::cout << "\n=== Test 2: Buffer Too Small ===\n";
+    std::size_t const length = std::strlen(kProcessName);
+
+    char buffer[kNameBufferSize];
+    std::memset(buffer, '#', sizeof(buffer));
+    ErrorCode const tooSmall = PlatformProcessAccess::GetProcessName(buffer, length);
+    std::cout << "Buffer of " << length << " bytes => " << static_cast<int>(tooSmall) << " (expected "
+              << static_cast<int>(ErrorCode::BufferTooSmall) << ")\n";
+    assert(tooSmall == ErrorCode::BufferTooSmall);
+    for (std::size_t index = 0U; index < sizeof(buffer); ++index) {
+        assert(buffer[index] == '#');
+    }
+
+    ErrorCode const exact = PlatformProcessAccess::GetProcessName(buffer, length + 1U);
+    std::cout << "Buffer of " << (length + 1U) << " bytes => " << static_cast<int>(exact) << ", \"" << buffer
+              << "\" (expected 0)\n";
+    assert(exact == ErrorCode::Success);
+    assert((std::strcmp(buffer, kProcessName) == 0) && (buffer[length + 1U] == '#'));
+}
+
+/*!
+ * \brief Test #3: A buffer of capacity 0 and a null buffer
+ */
+void TestZeroCapacity()
+{
+    std::cout << "\n=== Test 3: Zero Capacity and Null Buffer ===\n";
+    char buffer[1]{'#'};
+    ErrorCode const empty = PlatformProcessAccess::GetProcessName(buffer, 0U);
+    ErrorCode const null = PlatformProcessAccess::GetProcessName(nullptr, kNameBufferSize);
+    std::cout << "Capacity 0 => " << static_cast<int>(empty) << ", null buffer => " << static_cast<int>(null)
+              << " (expected " << static_cast<int>(ErrorCode::BufferTooSmall) << ", "
+              << static_cast<int>(ErrorCode::NullBuffer) << ")\n";
+    assert((empty == ErrorCode::BufferTooSmall) && (buffer[0] == '#'));
+    assert(null == ErrorCode::NullBuffer);
+}
+
+/*!
+ * \brief Test #4: A worker thread with its own name still reads the process name
+ */
+void TestNameFromWorker()
+{
+    std::cout << "\n=== Test 4: Process Name from a Worker Thread ===\n";
+    char name[kNameBufferSize]{};
+    ErrorCode result{ErrorCode::UnknownError};
+    std::thread worker{[&name, &result]() {
+        static_cast<void>(::pthread_setname_np(::pthread_self(), "worker_thread"));
+        result = PlatformProcessAccess::GetProcessName(name, sizeof(name));
+    }};
+    worker.join();
+
+    std::cout << "From \"worker_thread\" => " << static_cast<int>(result) << ", \"" << name << "\" (expected 0, \""
+              << kProcessName << "\")\n";
+    assert(result == ErrorCode::Success);
+    assert(std::strcmp(name, kProcessName) == 0);
+}
+
+/*!
+ * \brief Test #5: ProcessAccess<Backend> forwards to the static functions of the backend
+ */
+void TestCustomBackend()
+{
+    std::cout << "\n=== Test 5: Custom Backend ===\n";
+    char name[kNameBufferSize]{};
+    [[maybe_unused]] ErrorCode const named = FakeProcessAccess::GetProcessName(name, sizeof(name));
+    ErrorCode const refused = FakeProcessAccess::GetProcessName(name, 2U);
+    ResourceUsage usage{};
+    [[maybe_unused]] ErrorCode const used = FakeProcessAccess::GetResourceUsage(usage);
+
+    std::cout << "Name \"" << name << "\", refused " << static_cast<int>(refused) << ", resident "
+              << usage.residentBytes << ", calls " << FakeProcessAccess::nameCalls << "/"
+              << FakeProcessAccess::usageCalls << " (expected \"fake\", "
+              << static_cast<int>(ErrorCode::BufferTooSmall) << ", 4096, 2/1)\n";
+    assert((named == ErrorCode::Success) && (std::strcmp(name, "fake") == 0));
+    assert(refused == ErrorCode::BufferTooSmall);
+    assert((used == ErrorCode::Success) && (usage.residentBytes == 4096U));
+    assert((FakeProcessAccess::nameCalls == 2) && (FakeProcessAccess::usageCalls == 1));
+}
@@ -0,0 +1,445 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara_os_process_stats.cpp
+ *  \brief      Test application for ara::os::interface::process::ProcessStats and the ara::core near misses.
+ *
+ *  \details    This file contains multiple test functions covering:
+ *              1.  Sample() and Load(): pid, name, resident memory, page faults and CPU time of the process
+ *              2.  Managed threads: registration errors, per-thread CPU time, exit hook, reused handle, full table
+ *              3.  Near misses of a full InplaceVector and an exhausted memory resource
+ *              4.  Sampler thread: periodic snapshots read concurrently, Start() / Stop() errors, Stop() within a
+ *                  long period
+ *              5.  Publication into an external SeqLock (as placed in a SharedMemory segment)
+ *
+ *  \note       All variables are used, preventing compiler warnings about unused variables.
+ *********************************************************************************************************************/
+
+#include "ara/os/interface/process/process_stats.h"      // ProcessStats
+#include "ara/os/interface/process/process_factory.h"    // For PlatformProcessAccess
+#include "ara/core/array.h"                              // For ara::core::InplaceVector
+#include "ara/core/memory_resource.h"                    // For MonotonicBufferResource
+#include <iostream>         // For std::cout (demonstrations)
+#include <string>           // For std::string
+#include <cassert>          // For runtime checks via assert
+#include <atomic>           // For std::atomic
+#include <chrono>           // For std::chrono durations
+#include <cstdint>          // For std::uint64_t
+#include <cstring>          // For std::strcmp
+#include <thread>           // For std::thread, std::this_thread::sleep_for
+#include <unistd.h>         // For getpid
+
+using ara::core::internal::ViolationKind;
+using ara::os::interface::process::kMaxManagedThreads;
+using ara::os::interface::process::ProcessStats;
+using ara::os::interface::process::ProcessStatsConfig;
+using ara::os::interface::process::ProcessStatsErrorCode;
+using ara::os::interface::process::ProcessStatsSnapshot;
+using ara::os::interface::thread::Thread;
+using ara::os::interface::thread::ThreadConfig;
+
+/**********************************************************************************************************************
+ *  FORWARD DECLARATIONS
+ *********************************************************************************************************************/
+void TestSample();              // Test #1
+void TestManagedThreads();      // Test #2
+void TestNearMisses();          // Test #3
+void TestSampler();             // Test #4
+void TestExternalPublication(); // Test #5
+
+/**********************************************************************************************************************
+ *  HELPERS
+ *********************************************************************************************************************/
+/*!
+ * \brief  Near-miss counter of \c kind, as seen by the OS Abstraction Layer.
+ */
+static auto NearMisses(ViolationKind kind) noexcept -> std::uint64_t
+{
+    return ara::os::interface::process::GetNearMissCount(static_cast<std::uint8_t>(kind));
+}
+
+/*!
+ * \brief  State shared with a Spin entry.
+ */
+struct SpinState {
+    std::chrono::milliseconds spin{0};
+    std::atomic<bool>         release{true};    // The entry returns once this is true (after spinning)
+    ProcessStats*             stats{nullptr};   // If set, the entry registers itself first
+    ProcessStatsErrorCode     registration{ProcessStatsErrorCode::NotRegistered};
+    std::atomic<bool>         registered{false};
+};
+
+/*!
+ * \brief  Entry burning \c spin of CPU time, then waiting for the release.
+ */
+static void Spin(void* context) noexcept
+{
+    SpinState& state = *static_cast<SpinState*>(context);
+    if (state.stats != nullptr) {
+        state.registration = state.stats->RegisterCurrentThread("spinner_thread_long_name");
+        state.registered.store(true);
+    }
+    auto const end = std::chrono::steady_clock::now() + state.spin;
+    volatile std::uint64_t counter{0U};
+    while (std::chrono::steady_clock::now() < end) {
+        counter = counter + 1U;
+    }
+    while (!state.release.load()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    }
+}
+
+/**********************************************************************************************************************
+ *  MAIN FUNCTION
+ *********************************************************************************************************************/
+static void PrintUsage(const char* prog) {
+    std::cout << "Usage: " << prog << " [test_number]\n"
+              << "List of Available Tests:\n"
+              << "  1  - Sample and Load\n"
+              << "  2  - Managed Threads\n"
+              << "  3  - Near Misses\n"
+              << "  4  - Sampler Thread\n"
+              << "  5  - External Publication\n";
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc != 2) {
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    std::string choice = argv[1];
+    if      (choice == "1")  TestSample();
+    else if (choice == "2")  TestManagedThreads();
+    else if (choice == "3")  TestNearMisses();
+    else if (choice == "4")  TestSampler();
+    else if (choice == "5")  TestExternalPublication();
+    else {
+        std::cout << "Invalid test number.\n";
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    return 0;
+}
+
+/**********************************************************************************************************************
+ *  TEST IMPLEMENTATIONS
+ *********************************************************************************************************************/
+/*!
+ * \brief Test #1: Sample() and Load() of the process statistics
+ */
+void TestSample()
+{
+    std::cout << "\n=== Test 1: Sample and Load ===\n";
+    static ProcessStats stats{};
+
+    ProcessStatsSnapshot snapshot{};
+    bool const emptyRefused = !stats.Load(snapshot) && (stats.GetVersion() == 0U);
+
+    ProcessStatsErrorCode const first = stats.Sample();
+    ProcessStatsSnapshot before{};
+    [[maybe_unused]] bool const loaded = stats.Load(before);
+
+    char name[64]{};
+    static_cast<void>(ara::os::interface::process::PlatformProcessAccess::GetProcessName(name, sizeof(name)));
+    bool const identityOk = (before.pid == static_cast<std::int32_t>(::getpid())) &&
+                            (std::strcmp(before.name, name) == 0) && (before.sampleIndex == 1U) &&
+                            (before.threadCount == 0U);
+    bool const usageOk = (before.usage.residentBytes > 0U) && (before.usage.minorPageFaults > 0U) &&
+                         (before.usage.cpuTimeNs > 0U) && (before.sampleTimeNs > 0U);
+
+    // Touch 8 MiB of fresh memory: the resident set and the minor faults grow
+    constexpr std::size_t kTouched = 8U * 1024U * 1024U;
+    static char touched[kTouched];
+    for (std::size_t offset = 0U; offset < kTouched; offset += 4096U) {
+        touched[offset] = static_cast<char>(offset);
+    }
+    ProcessStatsErrorCode const second = stats.Sample();
+    ProcessStatsSnapshot after{};
+    static_cast<void>(stats.Load(after));
+    bool const growthOk = (after.usage.residentBytes >= (before.usage.residentBytes + (kTouched / 2U))) &&
+                          (after.usage.minorPageFaults > before.usage.minorPageFaults) &&
+                          (after.sampleIndex == 2U) && (stats.GetVersion() == 2U) &&
+                          (after.sampleTimeNs > before.sampleTimeNs);
+
+    assert(emptyRefused && loaded);
+    assert((first == ProcessStatsErrorCode::Success) && (second == ProcessStatsErrorCode::Success));
+    assert(identityOk && usageOk && growthOk);
+    std::cout << "Empty refused = " << emptyRefused << ", Sample = " << static_cast<int>(first)
+              << static_cast<int>(second) << ", pid " << before.pid << " '" << before.name << "', RSS "
+              << (before.usage.residentBytes / 1024U) << " -> " << (after.usage.residentBytes / 1024U)
+              << " KiB, minor faults " << before.usage.minorPageFaults << " -> " << after.usage.minorPageFaults
+              << ", context switches " << after.usage.voluntaryContextSwitches << "/"
+              << after.usage.involuntaryContextSwitches << ", identity/usage/growth = " << identityOk << usageOk
+              << growthOk << " (expected 1, 00, 111)\n";
+    static_cast<void>(touched[1]);
+}
+
+/*!
+ * \brief Test #2: Managed threads and their CPU time
+ */
+void TestManagedThreads()
+{
+    std::cout << "\n=== Test 2: Managed Threads ===\n";
+    static ProcessStats stats{};
+
+    ProcessStatsErrorCode const noName = stats.RegisterCurrentThread(nullptr);
+    ProcessStatsErrorCode const main = stats.RegisterCurrentThread("main");
+    ProcessStatsErrorCode const twice = stats.RegisterCurrentThread("main");
+
+    // The worker registers itself, so that its exit is detected
+    SpinState spinning{};
+    spinning.spin = std::chrono::milliseconds{50};
+    spinning.release.store(false);
+    spinning.stats = &stats;
+    Thread worker{};
+    ThreadConfig config{};
+    config.name    = "spinner";
+    config.entry   = &Spin;
+    config.context = &spinning;
+    bool const started = (worker.Start(config) == ara::os::interface::thread::ErrorCode::Success);
+    assert(started);
+    while (started && !spinning.registered.load()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    }
+    ProcessStatsErrorCode const spinner = spinning.registration;
+    pthread_t const spinnerHandle = worker.GetNativeHandle();
+
+    std::this_thread::sleep_for(std::chrono::milliseconds{80});
+    static_cast<void>(stats.Sample());
+    ProcessStatsSnapshot busy{};
+    static_cast<void>(stats.Load(busy));
+    assert((busy.threadCount == 2U) && (std::strcmp(busy.threads[0].name, "main") == 0));
+    assert((std::strcmp(busy.threads[1].name, "spinner_thread_") == 0) && busy.threads[0].alive);
+    assert(busy.threads[1].alive && (busy.threads[1].cpuTimeNs >= 30000000U));
+
+    // The worker exits: its exit hook takes its final CPU time; it is reported not alive until it is unregistered
+    spinning.release.store(true);
+    static_cast<void>(worker.Join());
+    static_cast<void>(stats.Sample());
+    ProcessStatsSnapshot exited{};
+    static_cast<void>(stats.Load(exited));
+    assert((exited.threadCount == 2U) && !exited.threads[1].alive && exited.threads[0].alive);
+    assert(exited.threads[1].cpuTimeNs >= busy.threads[1].cpuTimeNs);
+
+    // A new thread, which usually reuses the handle of the exited one, registers next to the exited entry
+    SpinState respawning{};
+    respawning.release.store(false);
+    respawning.stats = &stats;
+    Thread respawn{};
+    config.context = &respawning;
+    bool const respawned = (respawn.Start(config) == ara::os::interface::thread::ErrorCode::Success);
+    assert(respawned);
+    while (respawned && !respawning.registered.load()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    }
+    bool const handleReused = (::pthread_equal(respawn.GetNativeHandle(), spinnerHandle) != 0);
+    static_cast<void>(stats.Sample());
+    ProcessStatsSnapshot reused{};
+    static_cast<void>(stats.Load(reused));
+    assert((respawning.registration == ProcessStatsErrorCode::Success) && (reused.threadCount == 3U));
+    assert(!reused.threads[1].alive && reused.threads[2].alive);
+
+    // The exited entry goes first; the exit hook of the new thread marks its own entry
+    ProcessStatsErrorCode const removed = stats.UnregisterThread(spinnerHandle);
+    respawning.release.store(true);
+    static_cast<void>(respawn.Join());
+    static_cast<void>(stats.Sample());
+    ProcessStatsSnapshot respawnExited{};
+    static_cast<void>(stats.Load(respawnExited));
+    assert((respawnExited.threadCount == 2U) && !respawnExited.threads[1].alive);
+    [[maybe_unused]] ProcessStatsErrorCode const respawnRemoved = stats.UnregisterThread(respawn.GetNativeHandle());
+    ProcessStatsErrorCode const removedTwice = stats.UnregisterThread(spinnerHandle);
+    static_cast<void>(stats.Sample());
+    ProcessStatsSnapshot remaining{};
+    static_cast<void>(stats.Load(remaining));
+    assert((remaining.threadCount == 1U) && (std::strcmp(remaining.threads[0].name, "main") == 0));
+
+    // kMaxManagedThreads threads fill the table; registered from here, they are unregistered before the join
+    static SpinState idle{};
+    static Thread idlers[kMaxManagedThreads];
+    idle.release.store(false);
+    std::size_t registered{1U};
+    for (Thread& idler : idlers) {
+        ThreadConfig idleConfig{};
+        idleConfig.entry   = &Spin;
+        idleConfig.context = &idle;
+        if ((idler.Start(idleConfig) == ara::os::interface::thread::ErrorCode::Success) &&
+            (stats.RegisterThread(idler.GetNativeHandle(), "idler") == ProcessStatsErrorCode::Success)) {
+            ++registered;
+        }
+    }
+    assert(registered == kMaxManagedThreads);
+    for (Thread& idler : idlers) {
+        static_cast<void>(stats.UnregisterThread(idler.GetNativeHandle()));
+    }
+    idle.release.store(true);
+    for (Thread& idler : idlers) {
+        static_cast<void>(idler.Join());
+    }
+
+    assert(noName == ProcessStatsErrorCode::InvalidArgument);
+    assert((main == ProcessStatsErrorCode::Success) && (spinner == ProcessStatsErrorCode::Success));
+    assert((twice == ProcessStatsErrorCode::AlreadyRegistered));
+    assert((removed == ProcessStatsErrorCode::Success) && (removedTwice == ProcessStatsErrorCode::NotRegistered));
+    assert(respawnRemoved == ProcessStatsErrorCode::Success);
+    std::cout << "Register nullptr/main/spinner/twice = " << static_cast<int>(noName) << static_cast<int>(main)
+              << static_cast<int>(spinner) << static_cast<int>(twice) << ", spinner CPU "
+              << (busy.threads[1].cpuTimeNs / 1000000U) << " ms as '" << busy.threads[1].name << "', exited alive = "
+              << exited.threads[1].alive << ", unregister/twice = " << static_cast<int>(removed)
+              << static_cast<int>(removedTwice) << ", respawn reused the handle = " << handleReused
+              << ", table holds " << registered << " (expected 1003, >= 30 ms, 0, 04, " << kMaxManagedThreads
+              << ")\n";
+}
+
+/*!
+ * \brief Test #3: Near misses of a full InplaceVector and an exhausted memory resource
+ */
+void TestNearMisses()
+{
+    std::cout << "\n=== Test 3: Near Misses ===\n";
+    std::uint64_t const capacityBefore = NearMisses(ViolationKind::CapacityExceeded);
+    std::uint64_t const memoryBefore = NearMisses(ViolationKind::OutOfMemory);
+
+    ara::core::InplaceVector<int, 2U> vector{};
+    [[maybe_unused]] bool const roomOk = (vector.try_push_back(1) != nullptr) && (vector.try_push_back(2) != nullptr);
+    [[maybe_unused]] bool const fullRefused =
+        (vector.try_push_back(3) == nullptr) && (vector.try_emplace_back(4) == nullptr);
+
+    alignas(std::max_align_t) static char buffer[256];
+    ara::core::pmr::MonotonicBufferResource resource{buffer, sizeof(buffer),
+                                                     ara::core::pmr::NullMemoryResource()};
+    [[maybe_unused]] bool const fitOk = (resource.allocate(128U) != nullptr);
+    // Refused by the null upstream as well, but counted once: by the resource that was asked
+    [[maybe_unused]] bool const exhaustedRefused = (resource.allocate(512U) == nullptr);
+
+    std::uint64_t const capacityAfter = NearMisses(ViolationKind::CapacityExceeded);
+    std::uint64_t const memoryAfter = NearMisses(ViolationKind::OutOfMemory);
+    assert((capacityAfter == (capacityBefore + 2U)) && (memoryAfter == (memoryBefore + 1U)));
+    assert(NearMisses(ViolationKind::ArrayAccessOutOfRange) == 0U);
+
+    ProcessStats stats{};
+    static_cast<void>(stats.Sample());
+    ProcessStatsSnapshot snapshot{};
+    static_cast<void>(stats.Load(snapshot));
+    bool const publishedOk =
+        (snapshot.nearMisses[static_cast<std::size_t>(ViolationKind::CapacityExceeded)] == capacityAfter) &&
+        (snapshot.nearMisses[static_cast<std::size_t>(ViolationKind::OutOfMemory)] == memoryAfter);
+
+    assert(roomOk && fullRefused && fitOk && exhaustedRefused);
+    assert(publishedOk);
+    std::cout << "Capacity near misses " << capacityBefore << " -> " << capacityAfter << ", memory near misses "
+              << memoryBefore << " -> " << memoryAfter << ", published = " << publishedOk
+              << " (expected +2, +1, 1)\n";
+}
+
+/*!
+ * \brief Test #4: Periodic sampler thread read concurrently
+ */
+void TestSampler()
+{
+    std::cout << "\n=== Test 4: Sampler Thread ===\n";
+    static ProcessStats stats{};
+
+    ProcessStatsConfig zeroPeriod{};
+    zeroPeriod.period = std::chrono::milliseconds{0};
+    ProcessStatsErrorCode const invalid = stats.Start(zeroPeriod);
+
+    ProcessStatsConfig config{};
+    config.period = std::chrono::milliseconds{5};
+    ProcessStatsErrorCode const started = stats.Start(config);
+    ProcessStatsErrorCode const twice = stats.Start(config);
+    assert(stats.IsRunning());
+
+    // Readers load concurrently; every snapshot they see is complete and the samples only move forward
+    std::atomic<bool> stop{false};
+    std::atomic<std::uint64_t> loads{0U};
+    std::atomic<bool> consistent{true};
+    auto reader = [&]() {
+        std::uint64_t lastIndex{0U};
+        while (!stop.load()) {
+            ProcessStatsSnapshot snapshot{};
+            if (stats.Load(snapshot)) {
+                if ((snapshot.sampleIndex < lastIndex) || (snapshot.pid != static_cast<std::int32_t>(::getpid())) ||
+                    (snapshot.usage.residentBytes == 0U)) {
+                    consistent.store(false);
+                }
+                lastIndex = snapshot.sampleIndex;
+                loads.fetch_add(1U);
+            }
+        }
+    };
+    std::thread first{reader};
+    std::thread second{reader};
+    std::this_thread::sleep_for(std::chrono::milliseconds{100});
+    stop.store(true);
+    first.join();
+    second.join();
+
+    stats.Stop();
+    std::uint64_t const samples = stats.GetVersion();
+    std::this_thread::sleep_for(std::chrono::milliseconds{20});
+    bool const stoppedOk = !stats.IsRunning() && (stats.GetVersion() == samples);
+    ProcessStatsErrorCode const restarted = stats.Start(config);
+    stats.Stop();
+
+    // Stop() interrupts the sleep of the sampler instead of waiting for the end of a long period
+    ProcessStatsConfig slow{};
+    slow.period = std::chrono::milliseconds{10000};
+    std::uint64_t const beforeSlow = stats.GetVersion();
+    ProcessStatsErrorCode const slowStarted = stats.Start(slow);
+    while ((slowStarted == ProcessStatsErrorCode::Success) && (stats.GetVersion() == beforeSlow)) {
+        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds{20});
+    auto const stopBegin = std::chrono::steady_clock::now();
+    stats.Stop();
+    auto const stopLatency = std::chrono::steady_clock::now() - stopBegin;
+
+    assert((invalid == ProcessStatsErrorCode::InvalidArgument) && (started == ProcessStatsErrorCode::Success));
+    assert(twice == ProcessStatsErrorCode::AlreadyRunning);
+    assert((samples >= 5U) && (loads.load() > 0U) && consistent.load() && stoppedOk);
+    assert((restarted == ProcessStatsErrorCode::Success));
+    assert((slowStarted == ProcessStatsErrorCode::Success) && (stopLatency < std::chrono::seconds{1}));
+    std::cout << "Start zero period/valid/twice = " << static_cast<int>(invalid) << static_cast<int>(started)
+              << static_cast<int>(twice) << ", samples in 100 ms = " << samples << ", concurrent loads = "
+              << loads.load() << ", consistent = " << consistent.load() << ", stopped = " << stoppedOk
+              << ", restart = " << static_cast<int>(restarted) << ", stop within a 10 s period after "
+              << std::chrono::duration_cast<std::chrono::microseconds>(stopLatency).count()
+              << " us (expected 105, >= 5, > 0, 1, 1, 0, < 1 s)\n";
+}
+
+/*!
+ * \brief Test #5: Publication into an external SeqLock
+ */
+void TestExternalPublication()
+{
+    std::cout << "\n=== Test 5: External Publication ===\n";
+    // A monitor maps the same SeqLock from a SharedMemory segment; here it is a plain object
+    static ProcessStats::Publication publication{};
+    static ProcessStats stats{publication};
+
+    static_cast<void>(stats.RegisterCurrentThread("publisher"));
+    ProcessStatsErrorCode const sampled = stats.Sample();
+
+    ProcessStatsSnapshot seen{};
+    bool const loaded = publication.Load(seen);
+    bool const contentOk = (seen.pid == static_cast<std::int32_t>(::getpid())) && (seen.threadCount == 1U) &&
+                           (std::strcmp(seen.threads[0].name, "publisher") == 0) && (seen.threads[0].cpuTimeNs > 0U);
+    bool const versionOk = (publication.GetVersion() == 1U) && (stats.GetVersion() == 1U);
+    static_cast<void>(stats.UnregisterThread(::pthread_self()));
+
+    assert((sampled == ProcessStatsErrorCode::Success) && loaded && contentOk && versionOk);
+    std::cout << "Sample = " << static_cast<int>(sampled) << ", read from the publication = " << loaded
+              << ", thread '" << seen.threads[0].name << "' CPU " << (seen.threads[0].cpuTimeNs / 1000U)
+              << " us, snapshot size " << sizeof(ProcessStatsSnapshot) << " bytes, content/version = " << contentOk
+              << versionOk << " (expected 0, 1, 11)\n";
+}
@@ -0,0 +1,499 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara_os_shared_memory.cpp
+ *  \brief      Test application for the ara::os::interface::shm SharedMemory, SeqLock and PublishRing.
+ *
+ *  \details    This file contains multiple test functions covering:
+ *              1.  Segment names, Create/Open/Unlink outcomes and page-size rounding
+ *              2.  Span, Array and control-structure views (bounds, alignment, read-only mappings)
+ *              3.  SeqLock between a writer process and a reader process (no torn values)
+ *              4.  PublishRing between a writer process and a reader process (in-place frames, overwrite detection)
+ *              5.  Huge-page segments (applied, or HugePagesUnavailable when none are reserved) and prefaulting
+ *
+ *              Segment names carry the process identifier, so that concurrent test runs do not collide.
+ *
+ *  \note       All variables are used, preventing compiler warnings about unused variables.
+ *********************************************************************************************************************/
+
+#include "ara/os/interface/shm/shared_memory.h"  // The SharedMemory
+#include "ara/os/interface/shm/seqlock.h"        // The SeqLock
+#include "ara/os/interface/shm/publish_ring.h"   // The PublishRing
+#include "ara/core/array.h" // For ara::core::Array
+#include <iostream>         // For std::cout (demonstrations)
+#include <string>           // For std::string
+#include <cassert>          // For runtime checks via assert
+#include <cstdint>          // For std::uint32_t, std::uint64_t
+#include <cstdio>           // For std::snprintf
+#include <sys/wait.h>       // For waitpid
+#include <unistd.h>         // For fork, getpid, _exit, sysconf
+
+using ara::os::interface::shm::ErrorCode;
+using ara::os::interface::shm::PublishRing;
+using ara::os::interface::shm::SegmentConfig;
+using ara::os::interface::shm::SeqLock;
+using ara::os::interface::shm::SharedMemory;
+
+/**********************************************************************************************************************
+ *  FORWARD DECLARATIONS
+ *********************************************************************************************************************/
+void TestCreateOpen();      // Test #1
+void TestViews();           // Test #2
+void TestSeqLock();         // Test #3
+void TestPublishRing();     // Test #4
+void TestHugePages();       // Test #5
+
+/**********************************************************************************************************************
+ *  HELPERS
+ *********************************************************************************************************************/
+/*!
+ * \brief  Segment name "/ara_shm_test_<pid>_<suffix>".
+ */
+struct SegmentName {
+    char text[64]{};
+
+    explicit SegmentName(const char* suffix) noexcept
+    {
+        static_cast<void>(std::snprintf(text, sizeof(text), "/ara_shm_test_%ld_%s",
+                                        static_cast<long>(::getpid()), suffix));
+    }
+};
+
+/*!
+ * \brief  A value whose words must always agree; a torn copy shows up as a mismatch.
+ */
+struct Stamp {
+    std::uint64_t words[6]{};
+};
+
+/*!
+ * \brief  A sensor frame filled in place: every element carries the frame counter.
+ */
+struct Frame {
+    std::uint64_t counter{0U};
+    std::uint32_t pixels[4096]{};
+};
+
+/*!
+ * \brief  Number of stamps the writer process of test #3 stores.
+ */
+constexpr std::uint64_t kStamps{200000U};
+
+/*!
+ * \brief  Number of frames the writer process of test #4 publishes.
+ */
+constexpr std::uint64_t kPublications{20000U};
+
+/*!
+ * \brief  Base page size of the system.
+ */
+static auto PageSize() noexcept -> std::size_t
+{
+    long const pageSize = ::sysconf(_SC_PAGESIZE);
+    return (pageSize > 0) ? static_cast<std::size_t>(pageSize) : 4096U;
+}
+
+/*!
+ * \brief  A forked writer process.
+ */
+struct ChildProcess {
+    pid_t pid{-1};
+    int   status{0};
+    bool  reaped{false};
+
+    /*!
+     * \brief  Reaps the process if it has exited (\c wait: waits for it); returns whether it was reaped.
+     */
+    auto Reap(bool wait) noexcept -> bool
+    {
+        if (!reaped && (pid > 0)) {
+            reaped = (::waitpid(pid, &status, wait ? 0 : WNOHANG) == pid);
+        }
+        return reaped;
+    }
+
+    /*!
+     * \brief  Waits for the process and returns whether it exited with status 0.
+     */
+    auto Succeeded() noexcept -> bool
+    {
+        return Reap(true) && WIFEXITED(status) && (WEXITSTATUS(status) == 0);
+    }
+};
+
+/**********************************************************************************************************************
+ *  MAIN AND MENU
+ *********************************************************************************************************************/
+static void PrintUsage(const char* prog) {
+    std::cout << "Usage: " << prog << " [test_number]\n"
+              << "List of Available Tests:\n"
+              << "  1  - Create, Open and Unlink\n"
+              << "  2  - Span, Array and Control Views\n"
+              << "  3  - SeqLock Between Processes\n"
+              << "  4  - PublishRing Between Processes\n"
+              << "  5  - Huge Pages and Prefaulting\n";
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc != 2) {
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    std::string choice = argv[1];
+    if      (choice == "1")  TestCreateOpen();
+    else if (choice == "2")  TestViews();
+    else if (choice == "3")  TestSeqLock();
+    else if (choice == "4")  TestPublishRing();
+    else if (choice == "5")  TestHugePages();
+    else {
+        std::cout << "Invalid test number.\n";
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    return 0;
+}
+
+/**********************************************************************************************************************
+ *  TEST IMPLEMENTATIONS
+ *********************************************************************************************************************/
+/*!
+ * \brief Test #1: Segment names, Create/Open/Unlink outcomes and page-size rounding
+ */
+void TestCreateOpen()
+{
+    std::cout << "\n=== Test 1: Create, Open and Unlink ===\n";
+    bool const namesOk = SharedMemory::IsValidName("/segment") && !SharedMemory::IsValidName("segment") &&
+                         !SharedMemory::IsValidName("/") && !SharedMemory::IsValidName("/a/b") &&
+                         !SharedMemory::IsValidName(nullptr);
+
+    SegmentName const name{"create"};
+    SegmentConfig config{};
+    config.name = name.text;
+    config.size = 100U;
+
+    SharedMemory creator{};
+    ErrorCode const created   = creator.Create(config);
+    ErrorCode const reopened  = creator.Create(config);          // AlreadyOpen
+    SharedMemory second{};
+    ErrorCode const duplicate = second.Create(config);           // AlreadyExists
+    bool const roundedOk = (creator.GetSize() == PageSize()) && creator.IsWritable();
+
+    SegmentConfig tooLarge = config;
+    tooLarge.size = 2U * PageSize();
+    ErrorCode const mismatch = second.Open(tooLarge);            // SizeMismatch
+    SegmentConfig readOnly = config;
+    readOnly.writable = false;
+    ErrorCode const opened = second.Open(readOnly);
+    bool const openedOk = (second.GetSize() == creator.GetSize()) && !second.IsWritable();
+
+    SegmentConfig empty = config;
+    empty.size = 0U;
+    SegmentConfig typed = config;
+    typed.typedMemory = "/memory/ram/sysram";
+    SharedMemory third{};
+    ErrorCode const zeroSize = third.Create(empty);              // InvalidArgument
+#if defined(__linux__)
+    ErrorCode const typedMemory = third.Create(typed);           // Linux has no typed memory: InvalidArgument
+#else
+    ErrorCode const typedMemory = ErrorCode::InvalidArgument;
+#endif
+
+    std::size_t const size = creator.GetSize();
+    ErrorCode const unlinked = SharedMemory::Unlink(config.name);
+    assert(creator.IsOpen() && second.IsOpen());     // Unlinking keeps the mappings
+    ErrorCode const missing  = third.Open(config);               // NotFound
+    ErrorCode const unlinkedTwice = SharedMemory::Unlink(config.name);
+    creator.Close();
+    creator.Close();
+    bool const closedOk = !creator.IsOpen() && (creator.GetSize() == 0U) && (creator.GetData() == nullptr);
+
+    assert(namesOk && (created == ErrorCode::Success) && (reopened == ErrorCode::AlreadyOpen));
+    assert((duplicate == ErrorCode::AlreadyExists) && roundedOk && (mismatch == ErrorCode::SizeMismatch));
+    assert((opened == ErrorCode::Success) && openedOk);
+    assert((zeroSize == ErrorCode::InvalidArgument) && (typedMemory == ErrorCode::InvalidArgument));
+    assert((unlinked == ErrorCode::Success) && (missing == ErrorCode::NotFound));
+    assert((unlinkedTwice == ErrorCode::NotFound) && closedOk);
+    std::cout << "Names = " << namesOk << ", Create/again/duplicate = " << static_cast<int>(created)
+              << static_cast<int>(reopened) << static_cast<int>(duplicate) << ", size = " << size
+              << " (rounded = " << roundedOk << "), Open too large/read-only = " << static_cast<int>(mismatch)
+              << static_cast<int>(opened) << openedOk << ", zero size/typed memory = " << static_cast<int>(zeroSize)
+              << static_cast<int>(typedMemory) << ", Unlink/Open/Unlink = " << static_cast<int>(unlinked)
+              << static_cast<int>(missing) << static_cast<int>(unlinkedTwice) << ", closed = " << closedOk
+              << " (expected 1, 052, page size, 1, 601, 11, 033, 1)\n";
+}
+
+/*!
+ * \brief Test #2: Span, Array and control-structure views
+ */
+void TestViews()
+{
+    std::cout << "\n=== Test 2: Span, Array and Control Views ===\n";
+    SegmentName const name{"views"};
+    SegmentConfig config{};
+    config.name = name.text;
+    config.size = 4096U;
+
+    SharedMemory writer{};
+    ErrorCode const created = writer.Create(config);
+    config.writable = false;
+    SharedMemory reader{};
+    ErrorCode const opened = reader.Open(config);
+
+    // A zero-filled segment; writes through one mapping are visible through the other without a copy
+    ara::core::Span<std::uint32_t> const samples = writer.AsSpan<std::uint32_t>(64U, 16U);
+    for (std::size_t i = 0U; i < samples.size(); ++i) {
+        samples[i] = static_cast<std::uint32_t>(i * 3U);
+    }
+    ara::core::Span<const std::uint32_t> const seen = reader.AsSpan<const std::uint32_t>(64U, 16U);
+    bool spanOk = (samples.size() == 16U) && (seen.size() == 16U) && (seen.data() != samples.data());
+    for (std::size_t i = 0U; spanOk && (i < seen.size()); ++i) {
+        spanOk = (seen[i] == static_cast<std::uint32_t>(i * 3U));
+    }
+    bool const wholeOk = (writer.AsSpan<std::uint64_t>().size() == (writer.GetSize() / sizeof(std::uint64_t)));
+
+    using Table = ara::core::Array<std::uint16_t, 8>;
+    Table* const table = writer.As<Table>(256U);
+    if (table != nullptr) {
+        table->fill(7U);
+    }
+    const Table* const tableSeen = reader.As<const Table>(256U);
+    bool const arrayOk = (table != nullptr) && (tableSeen != nullptr) && ((*tableSeen)[7] == 7U);
+
+    // Out of bounds, misaligned, or writable through the read-only mapping: refused
+    bool const refusedOk = writer.AsSpan<std::uint32_t>(writer.GetSize() - 8U, 4U).empty() &&
+                           writer.AsSpan<std::uint32_t>(2U, 4U).empty() &&
+                           (writer.As<std::uint64_t>(4U) == nullptr) &&
+                           (writer.As<Table>(writer.GetSize()) == nullptr) &&
+                           reader.AsSpan<std::uint32_t>(64U, 16U).empty() &&
+                           (reader.As<Table>(256U) == nullptr) &&
+                           (reader.Emplace<SeqLock<std::uint64_t>>(512U) == nullptr);
+
+    // Control structures: constructed by the creator, attached by the others
+    SeqLock<std::uint64_t>* const lock = writer.Emplace<SeqLock<std::uint64_t>>(1024U);
+    if (lock != nullptr) {
+        lock->Store(42U);
+    }
+    const SeqLock<std::uint64_t>* const attached = reader.Attach<const SeqLock<std::uint64_t>>(1024U);
+    std::uint64_t value{0U};
+    bool const controlOk = (lock != nullptr) && (attached != nullptr) && attached->Load(value) && (value == 42U) &&
+                           (attached->GetVersion() == 1U);
+
+    static_cast<void>(SharedMemory::Unlink(name.text));
+
+    assert((created == ErrorCode::Success) && (opened == ErrorCode::Success));
+    assert(spanOk && wholeOk && arrayOk && refusedOk && controlOk);
+    std::cout << "Create/Open = " << static_cast<int>(created) << static_cast<int>(opened) << ", span shared = "
+              << spanOk << ", whole segment = " << wholeOk << ", Array = " << arrayOk << ", refused = " << refusedOk
+              << ", SeqLock attached = " << controlOk << " (expected 00, 1, 1, 1, 1, 1)\n";
+}
+
+/*!
+ * \brief Test #3: SeqLock between a writer process and a reader process
+ */
+void TestSeqLock()
+{
+    std::cout << "\n=== Test 3: SeqLock Between Processes ===\n";
+    SegmentName const name{"seqlock"};
+    SegmentConfig config{};
+    config.name = name.text;
+    config.size = sizeof(SeqLock<Stamp>);
+
+    SharedMemory creator{};
+    ErrorCode const created = creator.Create(config);
+    SeqLock<Stamp>* const lock = creator.Emplace<SeqLock<Stamp>>();
+
+    ChildProcess child{};
+    child.pid = ::fork();
+    if (child.pid == 0) {
+        // Writer process: opens the segment by name and stores stamps without ever waiting
+        SharedMemory writer{};
+        if ((writer.Open(config) != ErrorCode::Success)) {
+            ::_exit(1);
+        }
+        SeqLock<Stamp>* const shared = writer.Attach<SeqLock<Stamp>>();
+        if (shared == nullptr) {
+            ::_exit(1);
+        }
+        for (std::uint64_t stamp = 1U; stamp <= kStamps; ++stamp) {
+            Stamp value{};
+            for (std::uint64_t& word : value.words) {
+                word = stamp;
+            }
+            shared->Store(value);
+            // Leave gaps between the stores, as a periodic writer would, so the reader gets to copy in between
+            for (std::uint32_t volatile pause = 0U; pause < 64U; pause = pause + 1U) {
+            }
+        }
+        ::_exit(0);
+    }
+
+    // Reader process: every copy it accepts must be whole and stamps must never go backwards
+    std::uint64_t reads{0U};
+    std::uint64_t last{0U};
+    bool consistent{lock != nullptr};
+    while (consistent && (last < kStamps)) {
+        Stamp value{};
+        if (lock->TryLoad(value)) {
+            for (std::uint64_t const word : value.words) {
+                consistent = consistent && (word == value.words[0]);
+            }
+            consistent = consistent && (value.words[0] >= last);
+            last = value.words[0];
+            ++reads;
+        } else if (child.Reap(false)) {
+            break;
+        }
+    }
+    bool const childOk = child.Succeeded();
+    bool const versionOk = (lock != nullptr) && (lock->GetVersion() == kStamps);
+    static_cast<void>(SharedMemory::Unlink(name.text));
+
+    assert((created == ErrorCode::Success) && childOk && consistent && versionOk);
+    std::cout << "Create = " << static_cast<int>(created) << ", writer = " << childOk << ", reads = " << reads
+              << ", no torn or stale values = " << consistent << ", version = " << versionOk
+              << " (expected 0, 1, > 0, 1, 1)\n";
+}
+
+/*!
+ * \brief Test #4: PublishRing between a writer process and a reader process
+ */
+void TestPublishRing()
+{
+    std::cout << "\n=== Test 4: PublishRing Between Processes ===\n";
+    using Ring = PublishRing<Frame, 4>;
+    SegmentName const name{"ring"};
+    SegmentConfig config{};
+    config.name = name.text;
+    config.size = sizeof(Ring);
+
+    SharedMemory creator{};
+    ErrorCode const created = creator.Create(config);
+    Ring* const ring = creator.Emplace<Ring>();
+    Ring::View nothing{};
+    bool const emptyOk = (ring != nullptr) && !ring->GetLatest(nothing) && !ring->Get(0U, nothing);
+
+    ChildProcess child{};
+    child.pid = ::fork();
+    if (child.pid == 0) {
+        // Writer process: fills every frame in place, in the slot readers access it from
+        SharedMemory writer{};
+        if (writer.Open(config) != ErrorCode::Success) {
+            ::_exit(1);
+        }
+        Ring* const shared = writer.Attach<Ring>();
+        if (shared == nullptr) {
+            ::_exit(1);
+        }
+        for (std::uint64_t counter = 1U; counter <= kPublications; ++counter) {
+            Frame& frame = shared->BeginPublish();
+            frame.counter = counter;
+            for (std::uint32_t& pixel : frame.pixels) {
+                pixel = static_cast<std::uint32_t>(counter);
+            }
+            shared->EndPublish();
+        }
+        ::_exit(0);
+    }
+
+    // Reader process: reads the latest frame in place; a frame confirmed by IsValid() is never mixed
+    std::uint64_t validated{0U};
+    std::uint64_t discarded{0U};
+    bool consistent{ring != nullptr};
+    while (consistent && (ring->GetPublicationCount() < kPublications)) {
+        Ring::View view{};
+        if (!ring->GetLatest(view)) {
+            if (child.Reap(false)) {
+                break;
+            }
+            continue;
+        }
+        std::uint64_t const counter = view.data->counter;
+        bool whole = (counter == (view.publication + 1U));
+        for (std::uint32_t const pixel : view.data->pixels) {
+            whole = whole && (pixel == static_cast<std::uint32_t>(counter));
+        }
+        if (ring->IsValid(view)) {
+            consistent = whole;
+            ++validated;
+        } else {
+            ++discarded;
+        }
+    }
+    bool const childOk = child.Succeeded();
+
+    // Only the last Slots publications remain; older ones are reported as reused
+    Ring::View latest{};
+    Ring::View reused{};
+    bool const finalOk = (ring != nullptr) && (ring->GetPublicationCount() == kPublications) &&
+                         ring->GetLatest(latest) && (latest.publication == (kPublications - 1U)) &&
+                         (latest.data->counter == kPublications) && ring->Get(kPublications - 4U, reused) &&
+                         !ring->Get(kPublications - 5U, reused) && !ring->Get(kPublications, reused);
+    static_cast<void>(SharedMemory::Unlink(name.text));
+
+    assert((created == ErrorCode::Success) && emptyOk && childOk && consistent && finalOk);
+    std::cout << "Create = " << static_cast<int>(created) << ", empty = " << emptyOk << ", writer = " << childOk
+              << ", frames validated = " << validated << " (discarded as overwritten: " << discarded
+              << "), consistent = " << consistent << ", final slots = " << finalOk
+              << " (expected 0, 1, 1, >= 0, 1, 1)\n";
+}
+
+/*!
+ * \brief Test #5: Huge-page segments and prefaulting
+ */
+void TestHugePages()
+{
+    std::cout << "\n=== Test 5: Huge Pages and Prefaulting ===\n";
+    SegmentName const name{"huge"};
+    SegmentConfig config{};
+    config.name      = name.text;
+    config.size      = 1U;
+    config.hugePages = true;
+    config.prefault  = true;
+
+    // Applied with a size rounded to the huge page size, or refused as a whole without a segment left behind
+    SharedMemory huge{};
+    ErrorCode const created = huge.Create(config);
+    std::size_t const hugeSize = huge.GetSize();
+    bool hugeOk{false};
+    if (created == ErrorCode::Success) {
+        hugeOk = (huge.GetSize() > PageSize()) && ((huge.GetSize() % PageSize()) == 0U) &&
+                 (huge.AsSpan<const std::uint8_t>()[huge.GetSize() - 1U] == 0U);
+        huge.Close();
+        hugeOk = hugeOk && (SharedMemory::Unlink(config.name, true) == ErrorCode::Success);
+    } else {
+        SharedMemory probe{};
+        hugeOk = ((created == ErrorCode::HugePagesUnavailable) || (created == ErrorCode::PermissionDenied)) &&
+                 (probe.Open(config) != ErrorCode::Success);
+    }
+
+    // Prefaulting a regular segment on both sides keeps its zero-filled content
+    SegmentConfig regular{};
+    regular.name     = name.text;
+    regular.size     = 64U * PageSize();
+    regular.prefault = true;
+    SharedMemory creator{};
+    ErrorCode const regularCreated = creator.Create(regular);
+    SharedMemory opener{};
+    ErrorCode const regularOpened = opener.Open(regular);
+    ara::core::Span<const std::uint64_t> const words = opener.AsSpan<const std::uint64_t>();
+    bool zeroOk = (words.size() == (regular.size / sizeof(std::uint64_t)));
+    for (std::uint64_t const word : words) {
+        zeroOk = zeroOk && (word == 0U);
+    }
+    static_cast<void>(SharedMemory::Unlink(name.text));
+
+    assert(hugeOk && (regularCreated == ErrorCode::Success) && (regularOpened == ErrorCode::Success) && zeroOk);
+    std::cout << "Huge pages = " << static_cast<int>(created) << " (size " << hugeSize
+              << ", applied or refused = " << hugeOk << "), prefaulted Create/Open = "
+              << static_cast<int>(regularCreated) << static_cast<int>(regularOpened) << ", zero-filled = " << zeroOk
+              << " (expected 0 or 7, 1, 00, 1)\n";
+}
@@ -0,0 +1,308 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara_os_system.cpp
+ *  \brief      Test application for the ara::os::interface::system CPU topology and cache geometry.
+ *
+ *  \details    This file contains multiple test functions covering:
+ *              1.  ara::core interference sizes and their cross-check against the running system
+ *              2.  The topology of the running system (consistency with sysconf / sched_getaffinity)
+ *              3.  SystemFactory instance against PlatformSystemAccess
+ *              4.  Placement queries on constexpr big.LITTLE and SMT / NUMA topologies
+ *
+ *              The live checks only rely on invariants, so that they also pass in containers restricted to a subset
+ *              of the CPUs and on machines without cpufreq or NUMA information.
+ *
+ *  \note       All variables are used, preventing compiler warnings about unused variables.
+ *********************************************************************************************************************/
+
+#include "ara/os/interface/system/system_factory.h"  // The SystemFactory and PlatformSystemAccess
+#include "ara/core/interference_size.h"              // For the compile-time interference sizes
+#include "ara/core/ring.h"                           // For the padded ring indices
+#include <iostream>         // For std::cout (demonstrations)
+#include <string>           // For std::string
+#include <cassert>          // For runtime checks via assert
+#include <cstdint>          // For std::uint64_t
+#include <sched.h>          // For sched_getaffinity, CPU_COUNT
+#include <unistd.h>         // For sysconf
+
+using ara::os::interface::system::CacheType;
+using ara::os::interface::system::CheckDestructiveInterferenceSize;
+using ara::os::interface::system::CpuInfo;
+using ara::os::interface::system::CpuSet;
+using ara::os::interface::system::CpuTopology;
+using ara::os::interface::system::ErrorCode;
+using ara::os::interface::system::PlatformSystemAccess;
+using ara::os::interface::system::SystemFactory;
+
+/**********************************************************************************************************************
+ *  FORWARD DECLARATIONS
+ *********************************************************************************************************************/
+void TestInterferenceSize();    // Test #1
+void TestLiveTopology();        // Test #2
+void TestFactory();             // Test #3
+void TestPlacementQueries();    // Test #4
+
+/**********************************************************************************************************************
+ *  HELPERS
+ *********************************************************************************************************************/
+/*!
+ * \brief  The first 64 CPUs of a set as a bit mask.
+ */
+constexpr auto MaskOf(const CpuSet& cpus) noexcept -> std::uint64_t
+{
+    return cpus.GetWord(0U);
+}
+
+/*!
+ * \brief  Whether every CPU of \c subset is in \c set.
+ */
+static auto IsSubset(const CpuSet& subset, const CpuSet& set) -> bool
+{
+    for (std::size_t word = 0U; word < CpuSet::kWordCount; ++word) {
+        if ((subset.GetWord(word) & ~set.GetWord(word)) != 0U) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/*!
+ * \brief  Octa-core big.LITTLE SoC: CPUs 0-3 little (capacity 446, one shared L2), CPUs 4-7 big (private L2s),
+ *         one shared L3.
+ */
+constexpr auto MakeBigLittle() noexcept -> CpuTopology
+{
+    CpuTopology topology{};
+    topology.cpuCount = 8U;
+    for (std::size_t cpu = 0U; cpu < 8U; ++cpu) {
+        static_cast<void>(topology.online.Add(cpu));
+        static_cast<void>(topology.allowed.Add(cpu));
+        bool const big = (cpu >= 4U);
+        CpuInfo& info = topology.cpus[cpu];
+        info.clusterId = big ? 1U : 0U;
+        info.coreId = static_cast<std::uint16_t>(cpu);
+        info.capacity = big ? CpuInfo::kMaxCapacity : std::uint16_t{446U};
+        info.maxFrequencyKhz = big ? 2400000U : 1800000U;
+        info.cacheCount = 3U;
+        info.caches[0] = {1U, CacheType::Data, 64U, 32768U, 1U, static_cast<std::uint16_t>(cpu)};
+        info.caches[1] = {2U, CacheType::Unified, 64U, big ? 524288U : 131072U,
+                          big ? std::uint16_t{1U} : std::uint16_t{4U},
+                          big ? static_cast<std::uint16_t>(cpu) : std::uint16_t{0U}};
+        info.caches[2] = {3U, CacheType::Unified, 64U, 4194304U, 8U, 0U};
+    }
+    static_cast<void>(topology.isolated.Add(7U));
+    topology.cacheLineSize = 64U;
+    return topology;
+}
+
+/*!
+ * \brief  Two sockets, one NUMA node each, two cores per socket with two SMT threads each; CPU n and CPU n + 4 are
+ *         siblings (the usual x86 enumeration). CPU 7 is offline.
+ */
+constexpr auto MakeSmtNuma() noexcept -> CpuTopology
+{
+    CpuTopology topology{};
+    topology.cpuCount = 8U;
+    for (std::size_t cpu = 0U; cpu < 7U; ++cpu) {
+        static_cast<void>(topology.online.Add(cpu));
+        CpuInfo& info = topology.cpus[cpu];
+        info.packageId = static_cast<std::uint16_t>((cpu % 4U) / 2U);
+        info.clusterId = info.packageId;
+        info.numaNode = info.packageId;
+        info.coreId = static_cast<std::uint16_t>(cpu % 2U);
+    }
+    return topology;
+}
+
+/**********************************************************************************************************************
+ *  MAIN AND MENU
+ *********************************************************************************************************************/
+static void PrintUsage(const char* prog) {
+    std::cout << "Usage: " << prog << " [test_number]\n"
+              << "List of Available Tests:\n"
+              << "  1  - Interference Sizes\n"
+              << "  2  - Live Topology\n"
+              << "  3  - SystemFactory\n"
+              << "  4  - Placement Queries\n";
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc != 2) {
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    std::string choice = argv[1];
+    if      (choice == "1")  TestInterferenceSize();
+    else if (choice == "2")  TestLiveTopology();
+    else if (choice == "3")  TestFactory();
+    else if (choice == "4")  TestPlacementQueries();
+    else {
+        std::cout << "Invalid test number: " << choice << "\n";
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    return 0;
+}
+
+/**********************************************************************************************************************
+ *  TEST DEFINITIONS
+ *********************************************************************************************************************/
+
+/*!
+ * \brief Test #1: ara::core interference sizes and their cross-check against the running system
+ */
+void TestInterferenceSize()
+{
+    std::cout << "\n=== Test 1: Interference Sizes ===\n";
+    constexpr std::size_t kDestructive = ara::core::kDestructiveInterferenceSize;
+    static_assert(ara::core::internal::kCacheLineSize == kDestructive);
+    static_assert(alignof(ara::core::SpscRing<int, 8U>) == kDestructive);
+    static_assert(CheckDestructiveInterferenceSize(0U) == ErrorCode::RetrievalFailed);
+    static_assert(CheckDestructiveInterferenceSize(ara::core::kConstructiveInterferenceSize) == ErrorCode::Success);
+    static_assert(CheckDestructiveInterferenceSize(kDestructive) == ErrorCode::Success);
+    static_assert(CheckDestructiveInterferenceSize(kDestructive * 2U) == ErrorCode::InterferenceSizeTooSmall);
+
+    std::size_t const lineSize = PlatformSystemAccess::GetCacheLineSize();
+    [[maybe_unused]] ErrorCode const check = PlatformSystemAccess::CheckDestructiveInterferenceSize();
+
+    std::cout << "destructive " << kDestructive << " B, constructive " << ara::core::kConstructiveInterferenceSize
+              << " B, detected line " << lineSize << " B\n";
+    assert((check == CheckDestructiveInterferenceSize(lineSize)) && (check != ErrorCode::InterferenceSizeTooSmall));
+    assert((lineSize == 0U) || ((lineSize & (lineSize - 1U)) == 0U));
+    std::cout << "[SUCCESS] The build pads at least one cache line of this system.\n";
+}
+
+/*!
+ * \brief Test #2: The topology of the running system (consistency with sysconf / sched_getaffinity)
+ */
+void TestLiveTopology()
+{
+    std::cout << "\n=== Test 2: Live Topology ===\n";
+    static CpuTopology topology{};
+    ErrorCode const result = PlatformSystemAccess::GetCpuTopology(topology);
+    bool const read = (result == ErrorCode::Success) || (result == ErrorCode::Truncated);
+
+    long const onlineCount = ::sysconf(_SC_NPROCESSORS_ONLN);
+    cpu_set_t affinity;
+    CPU_ZERO(&affinity);
+    bool const affinityRead = (::sched_getaffinity(0, sizeof(affinity), &affinity) == 0);
+    [[maybe_unused]] bool const sets = read && (topology.cpuCount >= 1U) && (topology.online.Count() >= 1U) &&
+                                       ((result == ErrorCode::Truncated) ||
+                                        (topology.online.Count() == static_cast<std::size_t>(onlineCount))) &&
+                                       (!affinityRead || (result == ErrorCode::Truncated) ||
+                                        (topology.allowed.Count() == static_cast<std::size_t>(CPU_COUNT(&affinity)))) &&
+                                       IsSubset(topology.allowed, topology.online);
+
+    // Every online CPU belongs to its own core, cluster and L1 domain and has a valid capacity
+    bool perCpu = true;
+    for (std::size_t cpu = 0U; cpu < topology.cpuCount; ++cpu) {
+        if (!topology.online.Contains(cpu)) {
+            continue;
+        }
+        const CpuInfo& info = topology.cpus[cpu];
+        perCpu = perCpu && (info.capacity >= 1U) && (info.capacity <= CpuInfo::kMaxCapacity) &&
+                 topology.GetCoreCpus(cpu).Contains(cpu) && topology.GetClusterCpus(cpu).Contains(cpu) &&
+                 topology.GetNodeCpus(info.numaNode).Contains(cpu);
+        if (info.FindDataCache(1U) != nullptr) {
+            perCpu = perCpu && topology.GetCacheSharingCpus(cpu, 1U).Contains(cpu);
+        }
+    }
+    std::size_t const lineSize = topology.cacheLineSize;
+    [[maybe_unused]] bool const aggregates =
+        (topology.GetCoreCount() >= 1U) && (topology.GetCoreCount() <= topology.online.Count()) &&
+        (topology.GetNodeCount() >= 1U) && !topology.GetPerformanceCpus().IsEmpty() &&
+        ((lineSize == 0U) || ((lineSize & (lineSize - 1U)) == 0U));
+
+    std::cout << topology.online.Count() << " online CPUs (" << topology.allowed.Count() << " allowed, "
+              << topology.isolated.Count() << " isolated), " << topology.GetCoreCount() << " cores, "
+              << topology.GetNodeCount() << " NUMA nodes, line " << lineSize << " B, "
+              << (topology.IsHeterogeneous() ? "heterogeneous" : "homogeneous") << "\n";
+    const CpuInfo& first = topology.cpus[0];
+    for (std::size_t i = 0U; i < first.cacheCount; ++i) {
+        std::cout << "  cpu0 L" << static_cast<int>(first.caches[i].level)
+                  << ((first.caches[i].type == CacheType::Data) ? "d" :
+                      (first.caches[i].type == CacheType::Instruction) ? "i" : "")
+                  << ": " << (first.caches[i].size / 1024U) << " KiB, shared by " << first.caches[i].sharedCpuCount
+                  << " CPUs\n";
+    }
+    assert(sets && perCpu && aggregates);
+    std::cout << "[SUCCESS] The topology matches sysconf and the affinity of the process.\n";
+}
+
+/*!
+ * \brief Test #3: SystemFactory instance against PlatformSystemAccess
+ */
+void TestFactory()
+{
+    std::cout << "\n=== Test 3: SystemFactory ===\n";
+    auto const system = SystemFactory::CreateInstance();
+    static CpuTopology fromInstance{};
+    static CpuTopology fromAccess{};
+    bool const created = (system != nullptr);
+    ErrorCode const instanceResult = created ? system->GetCpuTopology(fromInstance) : ErrorCode::UnknownError;
+    ErrorCode const accessResult = PlatformSystemAccess::GetCpuTopology(fromAccess);
+
+    bool same = created && (instanceResult == accessResult) && (fromInstance.cpuCount == fromAccess.cpuCount) &&
+                (fromInstance.cacheLineSize == fromAccess.cacheLineSize) &&
+                (system->GetCacheLineSize() == PlatformSystemAccess::GetCacheLineSize());
+    for (std::size_t word = 0U; word < CpuSet::kWordCount; ++word) {
+        same = same && (fromInstance.online.GetWord(word) == fromAccess.online.GetWord(word));
+    }
+    for (std::size_t cpu = 0U; cpu < fromAccess.cpuCount; ++cpu) {
+        same = same && (fromInstance.cpus[cpu].coreId == fromAccess.cpus[cpu].coreId) &&
+               (fromInstance.cpus[cpu].capacity == fromAccess.cpus[cpu].capacity) &&
+               (fromInstance.cpus[cpu].cacheCount == fromAccess.cpus[cpu].cacheCount);
+    }
+
+    std::cout << "sizeof(CpuTopology) = " << sizeof(CpuTopology) << " bytes\n";
+    assert(same);
+    std::cout << "[SUCCESS] The virtual and the static interface report the same topology.\n";
+}
+
+/*!
+ * \brief Test #4: Placement queries on constexpr big.LITTLE and SMT / NUMA topologies
+ */
+void TestPlacementQueries()
+{
+    std::cout << "\n=== Test 4: Placement Queries ===\n";
+    static constexpr CpuTopology kBigLittle = MakeBigLittle();
+    static_assert(kBigLittle.IsHeterogeneous());
+    static_assert((MaskOf(kBigLittle.GetPerformanceCpus()) == 0xF0U) &&
+                  (MaskOf(kBigLittle.GetEfficiencyCpus()) == 0x0FU));
+    static_assert((MaskOf(kBigLittle.GetClusterCpus(2U)) == 0x0FU) && (MaskOf(kBigLittle.GetClusterCpus(5U)) == 0xF0U));
+    static_assert((MaskOf(kBigLittle.GetCacheSharingCpus(1U, 2U)) == 0x0FU) &&
+                  (MaskOf(kBigLittle.GetCacheSharingCpus(6U, 2U)) == 0x40U) &&
+                  (MaskOf(kBigLittle.GetCacheSharingCpus(6U, 3U)) == 0xFFU) &&
+                  kBigLittle.GetCacheSharingCpus(6U, 4U).IsEmpty());
+    static_assert((kBigLittle.GetCoreCount() == 8U) && (kBigLittle.GetNodeCount() == 1U));
+
+    static constexpr CpuTopology kSmtNuma = MakeSmtNuma();
+    static_assert(!kSmtNuma.IsHeterogeneous() && (MaskOf(kSmtNuma.GetPerformanceCpus()) == 0x7FU));
+    static_assert((MaskOf(kSmtNuma.GetCoreCpus(1U)) == 0x22U) && (MaskOf(kSmtNuma.GetCoreCpus(3U)) == 0x08U));
+    static_assert((MaskOf(kSmtNuma.GetNodeCpus(0U)) == 0x33U) && (MaskOf(kSmtNuma.GetNodeCpus(1U)) == 0x4CU));
+    static_assert((kSmtNuma.GetCoreCount() == 4U) && (kSmtNuma.GetNodeCount() == 2U));
+    static_assert(kSmtNuma.GetClusterCpus(7U).IsEmpty() && kSmtNuma.GetCoreCpus(7U).IsEmpty());
+
+    // Pinning plan for the big.LITTLE part: real-time work on the isolated big core, the pool on the others
+    CpuSet pool = kBigLittle.GetPerformanceCpus();
+    for (std::size_t cpu = 0U; cpu < kBigLittle.cpuCount; ++cpu) {
+        if (kBigLittle.isolated.Contains(cpu)) {
+            pool.Remove(cpu);
+        }
+    }
+
+    std::cout << "big cores 0x" << std::hex << MaskOf(kBigLittle.GetPerformanceCpus()) << ", pool 0x" << MaskOf(pool)
+              << std::dec << "\n";
+    assert(MaskOf(pool) == 0x70U);
+    std::cout << "[SUCCESS] Placement queries select clusters, cache domains, SMT siblings and nodes.\n";
+}
@@ -0,0 +1,442 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara_os_thread.cpp
+ *  \brief      Test application for the ara::os::interface::thread ThreadControl and Thread.
+ *
+ *  \details    This file contains multiple test functions covering:
+ *              1.  Configuration validation (entry, priorities, stack) and CpuSet operations
+ *              2.  Name and affinity applied before the entry runs; restart after Join()
+ *              3.  Stack size and stack prefaulting (page faults inside the entry)
+ *              4.  Scheduling policies (SCHED_FIFO / SCHED_RR need privileges: PermissionDenied otherwise)
+ *              5.  Rate groups of the CyclicExecutive pinned to a CPU
+ *
+ *              Affinity checks use a CPU from the affinity of the test process, so that they also pass in
+ *              containers restricted to a subset of the CPUs.
+ *
+ *  \note       All variables are used, preventing compiler warnings about unused variables.
+ *********************************************************************************************************************/
+
+#include "ara/os/interface/thread/thread.h"              // The Thread and PlatformThreadControl
+#include "ara/os/interface/timer/cyclic_executive.h"     // For the pinned rate groups
+#include <iostream>         // For std::cout (demonstrations)
+#include <string>           // For std::string
+#include <cassert>          // For runtime checks via assert
+#include <atomic>           // For std::atomic
+#include <chrono>           // For std::chrono durations
+#include <cstdint>          // For std::int32_t
+#include <cstring>          // For std::strcmp
+#include <pthread.h>        // For pthread_getname_np, pthread_getattr_np
+#include <sched.h>          // For sched_getcpu, sched_get_priority_min
+#include <sys/resource.h>   // For getrusage, RUSAGE_THREAD
+#include <thread>           // For std::this_thread::sleep_for
+
+using ara::os::interface::thread::CpuSet;
+using ara::os::interface::thread::ErrorCode;
+using ara::os::interface::thread::SchedulingInfo;
+using ara::os::interface::thread::SchedulingPolicy;
+using ara::os::interface::thread::Thread;
+using ara::os::interface::thread::ThreadConfig;
+
+/**********************************************************************************************************************
+ *  FORWARD DECLARATIONS
+ *********************************************************************************************************************/
+void TestConfiguration();       // Test #1
+void TestSetup();               // Test #2
+void TestStack();               // Test #3
+void TestScheduling();          // Test #4
+void TestPinnedRateGroup();     // Test #5
+
+/**********************************************************************************************************************
+ *  HELPERS
+ *********************************************************************************************************************/
+/*!
+ * \brief  State observed by an entry function on its own thread (read after Join()).
+ */
+struct Observation {
+    char               name[16]{};
+    CpuSet             affinity{};
+    int                cpu{-1};
+    SchedulingInfo     scheduling{};
+    std::size_t        stackSize{0U};
+    long               minorFaults{-1};
+    std::atomic<bool>  release{true};       // The entry returns once this is true
+    std::atomic<bool>  running{false};
+};
+
+/*!
+ * \brief  Number of stack bytes the Observe entry touches to count page faults.
+ */
+constexpr std::size_t kTouchedStack{64U * 1024U};
+
+/*!
+ * \brief  Minor page faults of the calling thread so far (-1 where not available).
+ */
+static auto ThreadMinorFaults() noexcept -> long
+{
+#if defined(RUSAGE_THREAD)
+    rusage usage{};
+    return (::getrusage(RUSAGE_THREAD, &usage) == 0) ? usage.ru_minflt : -1;
+#else
+    return -1;
+#endif
+}
+
+/*!
+ * \brief  Touches \c kTouchedStack bytes of stack below the caller.
+ */
+[[gnu::noinline]] static void TouchStack(std::size_t remaining) noexcept
+{
+    volatile char frame[4096];
+    frame[0] = 1;
+    frame[sizeof(frame) - 1U] = 1;
+    if (remaining > sizeof(frame)) {
+        TouchStack(remaining - sizeof(frame));
+    }
+    static_cast<void>(frame[0]);
+}
+
+/*!
+ * \brief  Entry recording name, affinity, CPU, scheduling, stack size and the page faults of touching its stack.
+ */
+static void Observe(void* context) noexcept
+{
+    Observation& observation = *static_cast<Observation*>(context);
+    observation.running.store(true);
+
+    static_cast<void>(::pthread_getname_np(::pthread_self(), observation.name, sizeof(observation.name)));
+    static_cast<void>(Thread::GetCurrentAffinity(observation.affinity));
+    observation.cpu        = ::sched_getcpu();
+    observation.scheduling = Thread::GetCurrentScheduling();
+
+#if defined(__GLIBC__)
+    pthread_attr_t attributes;
+    if (::pthread_getattr_np(::pthread_self(), &attributes) == 0) {
+        static_cast<void>(::pthread_attr_getstacksize(&attributes, &observation.stackSize));
+        static_cast<void>(::pthread_attr_destroy(&attributes));
+    }
+#endif
+
+    long const before = ThreadMinorFaults();
+    TouchStack(kTouchedStack);
+    long const after = ThreadMinorFaults();
+    observation.minorFaults = ((before >= 0) && (after >= 0)) ? (after - before) : -1;
+
+    while (!observation.release.load()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    }
+}
+
+/*!
+ * \brief  First CPU of the affinity of the calling thread.
+ */
+static auto FirstAllowedCpu() noexcept -> std::size_t
+{
+    CpuSet allowed{};
+    static_cast<void>(Thread::GetCurrentAffinity(allowed));
+    for (std::size_t cpu = 0U; cpu < CpuSet::kMaxCpus; ++cpu) {
+        if (allowed.Contains(cpu)) {
+            return cpu;
+        }
+    }
+    return 0U;
+}
+
+/**********************************************************************************************************************
+ *  MAIN AND MENU
+ *********************************************************************************************************************/
+static void PrintUsage(const char* prog) {
+    std::cout << "Usage: " << prog << " [test_number]\n"
+              << "List of Available Tests:\n"
+              << "  1  - Configuration Validation and CpuSet\n"
+              << "  2  - Name and Affinity Before the Entry\n"
+              << "  3  - Stack Size and Prefaulting\n"
+              << "  4  - Scheduling Policies\n"
+              << "  5  - Pinned Rate Group\n";
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc != 2) {
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    std::string choice = argv[1];
+    if      (choice == "1")  TestConfiguration();
+    else if (choice == "2")  TestSetup();
+    else if (choice == "3")  TestStack();
+    else if (choice == "4")  TestScheduling();
+    else if (choice == "5")  TestPinnedRateGroup();
+    else {
+        std::cout << "Invalid test number.\n";
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    return 0;
+}
+
+/**********************************************************************************************************************
+ *  TEST IMPLEMENTATIONS
+ *********************************************************************************************************************/
+/*!
+ * \brief Test #1: Configuration validation and CpuSet operations
+ */
+void TestConfiguration()
+{
+    std::cout << "\n=== Test 1: Configuration Validation and CpuSet ===\n";
+    Observation observation{};
+    ThreadConfig valid{};
+    valid.entry   = &Observe;
+    valid.context = &observation;
+
+    ThreadConfig noEntry = valid;
+    noEntry.entry = nullptr;
+    ThreadConfig inheritPriority = valid;
+    inheritPriority.priority = 10;
+    ThreadConfig fifoZero = valid;
+    fifoZero.policy = SchedulingPolicy::Fifo;
+    ThreadConfig tinyStack = valid;
+    tinyStack.stackSize = 1024U;
+    ThreadConfig prefaultAll = valid;
+    prefaultAll.stackSize = 64U * 1024U;
+    prefaultAll.stackPrefault = 64U * 1024U;
+
+    Thread thread{};
+    ErrorCode const results[5]{thread.Start(noEntry), thread.Start(inheritPriority), thread.Start(fifoZero),
+                               thread.Start(tinyStack), thread.Start(prefaultAll)};
+    bool allRejected{true};
+    for (ErrorCode const result : results) {
+        allRejected = allRejected && (result == ErrorCode::InvalidArgument);
+    }
+    ErrorCode const notStarted = thread.Join();
+
+    CpuSet cpus{};
+    bool const emptyAtFirst = cpus.IsEmpty();
+    bool const added = cpus.Add(0U) && cpus.Add(3U) && cpus.Add(CpuSet::kMaxCpus - 1U);
+    bool const outOfRange = !cpus.Add(CpuSet::kMaxCpus);
+    cpus.Remove(3U);
+    bool const setOk = (cpus.Count() == 2U) && cpus.Contains(0U) && !cpus.Contains(3U) &&
+                       cpus.Contains(CpuSet::kMaxCpus - 1U) && (cpus.GetWord(1U) == (std::uint64_t{1U} << 63U));
+
+    assert(allRejected && (notStarted == ErrorCode::NotStarted) && !thread.IsStarted());
+    assert(emptyAtFirst && added && outOfRange && setOk);
+    std::cout << "Invalid configurations rejected = " << allRejected << ", Join() without thread = "
+              << static_cast<int>(notStarted) << ", CpuSet empty/add/range/ops = " << emptyAtFirst << added
+              << outOfRange << setOk << ", CPUs configured = " << Thread::GetCpuCount()
+              << " (expected 1, 3, 1111, >= 1)\n";
+}
+
+/*!
+ * \brief Test #2: Name and affinity applied before the entry runs; restart after Join()
+ */
+void TestSetup()
+{
+    std::cout << "\n=== Test 2: Name and Affinity Before the Entry ===\n";
+    std::size_t const cpu = FirstAllowedCpu();
+    Observation observation{};
+    observation.release.store(false);
+
+    ThreadConfig config{};
+    config.name    = "ara_thread_setup_long_name";
+    config.entry   = &Observe;
+    config.context = &observation;
+    static_cast<void>(config.affinity.Add(cpu));
+
+    Thread thread{};
+    ErrorCode const started = thread.Start(config);
+    bool const startedFlag = thread.IsStarted();
+    ErrorCode const twice   = thread.Start(config);
+    observation.release.store(true);
+    ErrorCode const joined  = thread.Join();
+
+    // The name is truncated to 15 characters; the entry only ever ran on the requested CPU
+    bool const nameOk = (std::strcmp(observation.name, "ara_thread_setu") == 0);
+    bool const affinityOk = (observation.affinity.Count() == 1U) && observation.affinity.Contains(cpu) &&
+                            (observation.cpu == static_cast<int>(cpu));
+
+    Observation second{};
+    config.name    = "ara_restart";
+    config.context = &second;
+    config.affinity = CpuSet{};
+    ErrorCode const restarted = thread.Start(config);
+    ErrorCode const rejoined  = thread.Join();
+    bool const restartOk = (std::strcmp(second.name, "ara_restart") == 0) && !second.affinity.IsEmpty();
+
+    assert((started == ErrorCode::Success) && startedFlag && (twice == ErrorCode::AlreadyStarted));
+    assert((joined == ErrorCode::Success) && nameOk && affinityOk);
+    assert((restarted == ErrorCode::Success) && (rejoined == ErrorCode::Success) && restartOk);
+    std::cout << "Start/again/Join = " << static_cast<int>(started) << startedFlag << "/" << static_cast<int>(twice)
+              << "/" << static_cast<int>(joined) << ", name = '" << observation.name << "' " << nameOk << ", pinned to CPU " << cpu
+              << " = " << affinityOk << ", restart = " << static_cast<int>(restarted) << static_cast<int>(rejoined)
+              << restartOk << " (expected 01/2/0, 'ara_thread_setu' 1, 1, 001)\n";
+}
+
+/*!
+ * \brief Test #3: Stack size and stack prefaulting
+ */
+void TestStack()
+{
+    std::cout << "\n=== Test 3: Stack Size and Prefaulting ===\n";
+    constexpr std::size_t kStackSize{512U * 1024U};
+
+    ThreadConfig config{};
+    config.entry     = &Observe;
+    config.stackSize = kStackSize;
+
+    Observation cold{};
+    config.context = &cold;
+    Thread thread{};
+    ErrorCode const coldStart = thread.Start(config);
+    ErrorCode const coldJoin  = thread.Join();
+
+    // Prefault more than the entry touches: its stack pages are already present
+    Observation warm{};
+    config.context       = &warm;
+    config.stackPrefault = kTouchedStack + (64U * 1024U);
+    ErrorCode const warmStart = thread.Start(config);
+    ErrorCode const warmJoin  = thread.Join();
+
+    bool const sizeOk = (cold.stackSize == 0U) || (cold.stackSize >= kStackSize);
+    bool const faultsOk = (cold.minorFaults < 0) || (warm.minorFaults <= cold.minorFaults);
+
+    assert((coldStart == ErrorCode::Success) && (coldJoin == ErrorCode::Success));
+    assert((warmStart == ErrorCode::Success) && (warmJoin == ErrorCode::Success) && sizeOk && faultsOk);
+    std::cout << "Start/Join = " << static_cast<int>(coldStart) << static_cast<int>(coldJoin)
+              << static_cast<int>(warmStart) << static_cast<int>(warmJoin) << ", stack = " << cold.stackSize
+              << " bytes, page faults touching " << kTouchedStack << " bytes: without prefault = "
+              << cold.minorFaults << ", with prefault = " << warm.minorFaults << ", ok = " << sizeOk << faultsOk
+              << " (expected 0000, >= 524288, with <= without, 11)\n";
+}
+
+/*!
+ * \brief Test #4: Scheduling policies
+ */
+void TestScheduling()
+{
+    std::cout << "\n=== Test 4: Scheduling Policies ===\n";
+    SchedulingInfo const creator = Thread::GetCurrentScheduling();
+
+    ThreadConfig config{};
+    config.entry = &Observe;
+
+    Observation inherited{};
+    config.context = &inherited;
+    Thread thread{};
+    ErrorCode const inheritStart = thread.Start(config);
+    static_cast<void>(thread.Join());
+    bool const inheritOk = (inherited.scheduling.policy == creator.policy) &&
+                           (inherited.scheduling.priority == creator.priority);
+
+    Observation other{};
+    config.context  = &other;
+    config.policy   = SchedulingPolicy::Other;
+    config.priority = 0;
+    ErrorCode const otherStart = thread.Start(config);
+    static_cast<void>(thread.Join());
+    bool const otherOk = (other.scheduling.policy == SchedulingPolicy::Other);
+
+    // Real-time policies: applied exactly, or refused as a whole without running the entry
+    bool realTimeOk{true};
+    int permissionDenied{0};
+    for (SchedulingPolicy const policy : {SchedulingPolicy::Fifo, SchedulingPolicy::RoundRobin}) {
+        Observation realTime{};
+        config.context  = &realTime;
+        config.policy   = policy;
+        config.priority = ::sched_get_priority_min((policy == SchedulingPolicy::Fifo) ? SCHED_FIFO : SCHED_RR);
+        ErrorCode const result = thread.Start(config);
+        static_cast<void>(thread.Join());
+        if (result == ErrorCode::Success) {
+            realTimeOk = realTimeOk && (realTime.scheduling.policy == policy) &&
+                         (realTime.scheduling.priority == config.priority);
+        } else {
+            realTimeOk = realTimeOk && (result == ErrorCode::PermissionDenied) && !realTime.running.load();
+            ++permissionDenied;
+        }
+    }
+
+    assert((inheritStart == ErrorCode::Success) && inheritOk);
+    assert((otherStart == ErrorCode::Success) && otherOk && realTimeOk);
+    std::cout << "Inherit = " << static_cast<int>(inheritStart) << inheritOk << ", SCHED_OTHER = "
+              << static_cast<int>(otherStart) << otherOk << ", SCHED_FIFO/RR applied or refused = " << realTimeOk
+              << " (refused without privileges: " << permissionDenied << ")"
+              << " (expected 01, 01, 1)\n";
+}
+
+/*!
+ * \brief  State of the pinned rate group task.
+ */
+struct PinnedTask {
+    std::atomic<std::size_t> cycles{0U};
+    std::atomic<bool>        onCpu{true};
+    int                      cpu{-1};
+    char                     name[16]{};
+};
+
+/*!
+ * \brief  Rate group task checking the CPU it runs on.
+ */
+static void PinnedCycle(void* context, const ara::os::interface::timer::CycleInfo& info) noexcept
+{
+    static_cast<void>(info);
+    PinnedTask& task = *static_cast<PinnedTask*>(context);
+    if (task.cycles.load() == 0U) {
+        static_cast<void>(::pthread_getname_np(::pthread_self(), task.name, sizeof(task.name)));
+    }
+    if (::sched_getcpu() != task.cpu) {
+        task.onCpu.store(false);
+    }
+    task.cycles.fetch_add(1U);
+}
+
+/*!
+ * \brief Test #5: Rate groups of the CyclicExecutive pinned to a CPU
+ */
+void TestPinnedRateGroup()
+{
+    std::cout << "\n=== Test 5: Pinned Rate Group ===\n";
+    using ara::os::interface::timer::CyclicExecutive;
+    using ara::os::interface::timer::RateGroupConfig;
+
+    PinnedTask task{};
+    task.cpu = static_cast<int>(FirstAllowedCpu());
+
+    RateGroupConfig config{};
+    config.name    = "pinned_group";
+    config.period  = std::chrono::milliseconds{2};
+    config.task    = &PinnedCycle;
+    config.context = &task;
+    static_cast<void>(config.affinity.Add(static_cast<std::size_t>(task.cpu)));
+
+    CyclicExecutive executive{};
+    ara::os::interface::timer::ErrorCode const added = executive.AddRateGroup(config);
+    ara::os::interface::timer::ErrorCode const started = executive.Start();
+    std::this_thread::sleep_for(std::chrono::milliseconds{50});
+    executive.Stop();
+    bool const pinnedOk = (task.cycles.load() > 0U) && task.onCpu.load() &&
+                          (std::strcmp(task.name, "pinned_group") == 0);
+
+    // A CPU that does not exist cannot be applied: Start() fails and no thread is left running
+    bool refusedOk{true};
+    if (Thread::GetCpuCount() < CpuSet::kMaxCpus) {
+        CyclicExecutive invalid{};
+        config.affinity = CpuSet{};
+        static_cast<void>(config.affinity.Add(CpuSet::kMaxCpus - 1U));
+        static_cast<void>(invalid.AddRateGroup(config));
+        refusedOk = (invalid.Start() == ara::os::interface::timer::ErrorCode::ThreadCreationFailed);
+    }
+
+    assert((added == ara::os::interface::timer::ErrorCode::Success));
+    assert((started == ara::os::interface::timer::ErrorCode::Success) && pinnedOk && refusedOk);
+    std::cout << "Add/Start = " << static_cast<int>(added) << static_cast<int>(started) << ", cycles = "
+              << task.cycles.load() << ", all on CPU " << task.cpu << " = " << task.onCpu.load() << ", name = '"
+              << task.name << "', pinned = " << pinnedOk << ", missing CPU refused = " << refusedOk
+              << " (expected 00, > 0, 1, 'pinned_group', 1, 1)\n";
+}
@@ -0,0 +1,261 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara_os_trace.cpp
+ *  \brief      Test application for the ara::os::interface::trace probes.
+ *
+ *  \details    This file contains multiple test functions covering:
+ *              1.  Backend selection (PlatformTraceAccess against the ARA_OS_TRACE_BACKEND_* definition)
+ *              2.  Firing every probe of PlatformTraceAccess, also from a signal handler
+ *              3.  TraceAccess forwarding to a custom (recording) backend
+ *              4.  Stability of the ProbeId and ViolationKind values (part of the trace format)
+ *
+ *              No tracer is attached, so the probes of an enabled backend are only required not to fail.
+ *
+ *  \note       All variables are used, preventing compiler warnings about unused variables.
+ *********************************************************************************************************************/
+
+#include "ara/os/interface/trace/trace.h"            // The PlatformTraceAccess probes
+#include "ara/core/internal/violation_handler.h"     // For ara::core::internal::ViolationKind
+#include <iostream>         // For std::cout (demonstrations)
+#include <string>           // For std::string
+#include <type_traits>      // For std::is_same_v
+#include <cassert>          // For runtime checks via assert
+#include <csignal>          // For std::signal, std::raise, SIGUSR1
+#include <cstdint>          // For std::uint32_t, std::uint64_t
+
+using ara::os::interface::trace::NullTraceAccess;
+using ara::os::interface::trace::PlatformTraceAccess;
+using ara::os::interface::trace::ProbeId;
+using ara::os::interface::trace::TraceAccess;
+using ara::core::internal::ViolationKind;
+
+/**********************************************************************************************************************
+ *  FORWARD DECLARATIONS
+ *********************************************************************************************************************/
+void TestBackendSelection();    // Test #1
+void TestFireProbes();          // Test #2
+void TestCustomBackend();       // Test #3
+void TestProbeIds();            // Test #4
+
+/**********************************************************************************************************************
+ *  HELPERS
+ *********************************************************************************************************************/
+/*!
+ * \brief  Backend recording the last probe and its arguments.
+ */
+class RecordingTraceAccess final : public TraceAccess<RecordingTraceAccess> {
+public:
+    static constexpr bool kEnabled{true};
+
+    static auto CycleBeginImpl(std::uint32_t group, std::uint64_t cycle) noexcept -> void
+    {
+        Record(ProbeId::CycleBegin, group, cycle);
+    }
+
+    static auto CycleEndImpl(std::uint32_t group, std::uint64_t cycle) noexcept -> void
+    {
+        Record(ProbeId::CycleEnd, group, cycle);
+    }
+
+    static auto ShutdownSignalImpl(std::int32_t signo) noexcept -> void
+    {
+        Record(ProbeId::ShutdownSignal, static_cast<std::uint32_t>(signo), 0U);
+    }
+
+    static auto ViolationImpl(std::uint32_t kind) noexcept -> void
+    {
+        Record(ProbeId::Violation, kind, 0U);
+    }
+
+    static auto UserEventImpl(std::uint32_t id, std::uint64_t value) noexcept -> void
+    {
+        Record(ProbeId::UserEvent, id, value);
+    }
+
+    static ProbeId       lastProbe;
+    static std::uint32_t lastFirst;
+    static std::uint64_t lastSecond;
+    static std::uint32_t count;
+
+private:
+    static auto Record(ProbeId probe, std::uint32_t first, std::uint64_t second) noexcept -> void
+    {
+        lastProbe  = probe;
+        lastFirst  = first;
+        lastSecond = second;
+        ++count;
+    }
+};
+
+ProbeId       RecordingTraceAccess::lastProbe{ProbeId::UserEvent};
+std::uint32_t RecordingTraceAccess::lastFirst{0U};
+std::uint64_t RecordingTraceAccess::lastSecond{0U};
+std::uint32_t RecordingTraceAccess::count{0U};
+
+/*!
+ * \brief  Whether the recording backend saw \c probe with \c first and \c second as its latest probe.
+ */
+[[maybe_unused]] static auto Recorded(ProbeId probe, std::uint32_t first, std::uint64_t second) noexcept -> bool
+{
+    return (RecordingTraceAccess::lastProbe == probe) && (RecordingTraceAccess::lastFirst == first) &&
+           (RecordingTraceAccess::lastSecond == second);
+}
+
+/*!
+ * \brief  Number of signals the probe signal handler ran for.
+ */
+static volatile std::sig_atomic_t gSignalsTraced{0};
+
+/*!
+ * \brief  Signal handler firing the shutdown probe (probes are async-signal-safe).
+ */
+extern "C" void TraceSignal(int signo)
+{
+    PlatformTraceAccess::ShutdownSignal(static_cast<std::int32_t>(signo));
+    gSignalsTraced = gSignalsTraced + 1;
+}
+
+/**********************************************************************************************************************
+ *  MAIN AND MENU
+ *********************************************************************************************************************/
+static void PrintUsage(const char* prog) {
+    std::cout << "Usage: " << prog << " [test_number]\n"
+              << "List of Available Tests:\n"
+              << "  1  - Backend Selection\n"
+              << "  2  - Fire Probes\n"
+              << "  3  - Custom Backend\n"
+              << "  4  - Probe IDs\n";
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc != 2) {
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    std::string choice = argv[1];
+    if      (choice == "1")  TestBackendSelection();
+    else if (choice == "2")  TestFireProbes();
+    else if (choice == "3")  TestCustomBackend();
+    else if (choice == "4")  TestProbeIds();
+    else {
+        std::cout << "Invalid test number: " << choice << "\n";
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    return 0;
+}
+
+/**********************************************************************************************************************
+ *  TEST DEFINITIONS
+ *********************************************************************************************************************/
+
+/*!
+ * \brief Test #1: Backend selection (PlatformTraceAccess against the ARA_OS_TRACE_BACKEND_* definition)
+ */
+void TestBackendSelection()
+{
+    std::cout << "\n=== Test 1: Backend Selection ===\n";
+#if defined(ARA_OS_TRACE_BACKEND_USDT)
+    const char* const backend = "USDT";
+#elif defined(ARA_OS_TRACE_BACKEND_LTTNG)
+    const char* const backend = "LTTNG";
+#elif defined(ARA_OS_TRACE_BACKEND_TRACELOGGER)
+    const char* const backend = "TRACELOGGER";
+#else
+    const char* const backend = "NONE";
+    static_assert(std::is_same_v<PlatformTraceAccess, NullTraceAccess>);
+#endif
+    constexpr bool kCompiledOut = std::is_same_v<PlatformTraceAccess, NullTraceAccess>;
+    static_assert(PlatformTraceAccess::kEnabled != kCompiledOut);
+    static_assert(!NullTraceAccess::kEnabled);
+    static_assert(noexcept(PlatformTraceAccess::CycleBegin(0U, 0U)));
+    static_assert(noexcept(PlatformTraceAccess::Violation(0U)));
+
+    std::cout << "backend " << backend << ", probes " << (PlatformTraceAccess::kEnabled ? "enabled" : "compiled out")
+              << "\n";
+    std::cout << "[SUCCESS] PlatformTraceAccess matches the configured backend.\n";
+}
+
+/*!
+ * \brief Test #2: Firing every probe of PlatformTraceAccess, also from a signal handler
+ */
+void TestFireProbes()
+{
+    std::cout << "\n=== Test 2: Fire Probes ===\n";
+    constexpr std::uint32_t kGroup{3U};
+    for (std::uint64_t cycle = 0U; cycle < 1000U; ++cycle) {
+        PlatformTraceAccess::CycleBegin(kGroup, cycle);
+        PlatformTraceAccess::UserEvent(7U, cycle * 3U);
+        PlatformTraceAccess::CycleEnd(kGroup, cycle);
+    }
+    PlatformTraceAccess::Violation(static_cast<std::uint32_t>(ViolationKind::InvalidState));
+
+    auto const previous = std::signal(SIGUSR1, &TraceSignal);
+    bool const installed = (previous != SIG_ERR);
+    [[maybe_unused]] bool const raised = installed && (std::raise(SIGUSR1) == 0);
+    static_cast<void>(std::signal(SIGUSR1, previous));
+
+    std::cout << "3000 cycle probes, 1 violation probe, " << static_cast<int>(gSignalsTraced)
+              << " shutdown probe(s) from a signal handler\n";
+    assert(installed && raised && (gSignalsTraced == 1));
+    std::cout << "[SUCCESS] Every probe fires without a tracer attached.\n";
+}
+
+/*!
+ * \brief Test #3: TraceAccess forwarding to a custom (recording) backend
+ */
+void TestCustomBackend()
+{
+    std::cout << "\n=== Test 3: Custom Backend ===\n";
+    using Trace = RecordingTraceAccess;
+
+    Trace::CycleBegin(1U, 42U);
+    assert(Recorded(ProbeId::CycleBegin, 1U, 42U));
+    Trace::CycleEnd(1U, 42U);
+    assert(Recorded(ProbeId::CycleEnd, 1U, 42U));
+    Trace::ShutdownSignal(SIGTERM);
+    assert(Recorded(ProbeId::ShutdownSignal, static_cast<std::uint32_t>(SIGTERM), 0U));
+    constexpr std::uint32_t kKind{static_cast<std::uint32_t>(ViolationKind::CapacityExceeded)};
+    Trace::Violation(kKind);
+    assert(Recorded(ProbeId::Violation, kKind, 0U));
+    Trace::UserEvent(9U, 0x1'0000'0002ULL);
+    assert(Recorded(ProbeId::UserEvent, 9U, 0x1'0000'0002ULL));
+
+    std::cout << "recorded " << Trace::count << " probes\n";
+    assert(Trace::count == 5U);
+    std::cout << "[SUCCESS] TraceAccess forwards every probe and its arguments to the backend.\n";
+}
+
+/*!
+ * \brief Test #4: Stability of the ProbeId and ViolationKind values (part of the trace format)
+ */
+void TestProbeIds()
+{
+    std::cout << "\n=== Test 4: Probe IDs ===\n";
+    static_assert(static_cast<std::uint32_t>(ProbeId::CycleBegin) == 0U);
+    static_assert(static_cast<std::uint32_t>(ProbeId::CycleEnd) == 1U);
+    static_assert(static_cast<std::uint32_t>(ProbeId::ShutdownSignal) == 2U);
+    static_assert(static_cast<std::uint32_t>(ProbeId::Violation) == 3U);
+    static_assert(static_cast<std::uint32_t>(ProbeId::UserEvent) == 4U);
+
+    static_assert(static_cast<std::uint32_t>(ViolationKind::ArrayAccessOutOfRange) == 0U);
+    static_assert(static_cast<std::uint32_t>(ViolationKind::VectorAccessOutOfRange) == 1U);
+    static_assert(static_cast<std::uint32_t>(ViolationKind::SpanAccessOutOfRange) == 2U);
+    static_assert(static_cast<std::uint32_t>(ViolationKind::SpanExtentMismatch) == 3U);
+    static_assert(static_cast<std::uint32_t>(ViolationKind::CapacityExceeded) == 4U);
+    static_assert(static_cast<std::uint32_t>(ViolationKind::OutOfMemory) == 5U);
+    static_assert(static_cast<std::uint32_t>(ViolationKind::InvalidState) == 6U);
+
+    std::cout << "probe IDs 0-4, violation kinds 0-6\n";
+    std::cout << "[SUCCESS] The trace format is unchanged.\n";
+}
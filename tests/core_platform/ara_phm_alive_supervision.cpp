@@ -0,0 +1,491 @@
+/**********************************************************************************************************************
+ *  PROJECT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  OpenAA: Open Source Adaptive AUTOSAR Project
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file       ara_phm_alive_supervision.cpp
+ *  \brief      Test application for the ara::phm alive supervision.
+ *
+ *  \details    This file contains multiple test functions covering:
+ *              1.  HeartbeatSegment: Create, Open (writable / read-only), OpenOrCreate, Unlink and their errors
+ *              2.  Register, ReportAlive and Check on synthetic times: Ok, Expired with the overdue time, Deactivated,
+ *                  invalid arguments, read-only mapping and CapacityExceeded
+ *              3.  Forked reporter: Ok while it beats, Expired within period + tolerance + polling after it stalls,
+ *                  slot taken over by a new instance once the process died
+ *              4.  Layout: one cache line per slot, table trivially destructible, reporting noexcept
+ *              5.  Abandoned claims: slots left claimed by a dead process are reused, those of a live one are not
+ *
+ *  \note       All variables are used, preventing compiler warnings about unused variables.
+ *********************************************************************************************************************/
+
+#include "ara/phm/alive_supervision.h"                // The classes under test
+#include "ara/os/interface/timer/cyclic_executive.h"  // For PlatformDeadlineTimer::Now
+#include <array>            // For std::array
+#include <chrono>           // For std::chrono literals
+#include <cstdint>          // For std::uint64_t, std::int32_t
+#include <iostream>         // For std::cout (demonstrations)
+#include <string>           // For std::string
+#include <thread>           // For std::this_thread::sleep_for
+#include <type_traits>      // For std::is_trivially_destructible_v
+#include <utility>          // For std::declval
+#include <cassert>          // For runtime checks via assert
+#include <csignal>          // For SIGKILL, kill
+#include <sys/wait.h>       // For waitpid
+#include <unistd.h>         // For fork, _exit, getpid, pause
+
+using ara::phm::AliveSupervisor;
+using ara::phm::EntityStatus;
+using ara::phm::ErrorCode;
+using ara::phm::HeartbeatSegment;
+using ara::phm::HeartbeatTable;
+using ara::phm::MonotonicTime;
+using ara::phm::SupervisedEntity;
+using ara::phm::SupervisionConfig;
+using ara::phm::SupervisionStatus;
+using ara::phm::internal::HeartbeatSlot;
+using ara::phm::internal::SlotState;
+using namespace std::chrono_literals;
+
+/**********************************************************************************************************************
+ *  FORWARD DECLARATIONS
+ *********************************************************************************************************************/
+void TestSegment();             // Test #1
+void TestSupervision();         // Test #2
+void TestForkedReporter();      // Test #3
+void TestLayout();              // Test #4
+void TestAbandonedClaim();      // Test #5
+
+/**********************************************************************************************************************
+ *  HELPERS
+ *********************************************************************************************************************/
+/*!
+ * \brief  Per-process segment name, so that parallel test runs do not share a table.
+ */
+static auto SegmentName(const char* name) -> std::string
+{
+    return std::string{"/ara_phm_test_"} + name + "_" + std::to_string(::getpid());
+}
+
+/*!
+ * \brief  Current CLOCK_MONOTONIC time.
+ */
+static auto Now() noexcept -> MonotonicTime
+{
+    return ara::os::interface::timer::PlatformDeadlineTimer::Now();
+}
+
+/*!
+ * \brief  Registration of \c name with \c period and \c tolerance.
+ */
+static auto MakeConfig(const char* name, std::chrono::nanoseconds period, std::chrono::nanoseconds tolerance)
+    -> SupervisionConfig
+{
+    SupervisionConfig config{};
+    config.name      = name;
+    config.period    = period;
+    config.tolerance = tolerance;
+    return config;
+}
+
+/*!
+ * \brief  Checks \c segment at \c now and returns the status of the single entity \c name (Deactivated if absent).
+ */
+static auto StatusOf(const HeartbeatSegment& segment, MonotonicTime now, const char* name) -> EntityStatus
+{
+    std::array<EntityStatus, HeartbeatTable::kCapacity> statuses{};
+    std::size_t const registered = AliveSupervisor{segment}.Check(now, statuses);
+    for (std::size_t i = 0U; (i < registered) && (i < statuses.size()); ++i) {
+        if (statuses[i].name == name) {
+            return statuses[i];
+        }
+    }
+    return EntityStatus{};
+}
+
+/**********************************************************************************************************************
+ *  MAIN AND MENU
+ *********************************************************************************************************************/
+static void PrintUsage(const char* prog) {
+    std::cout << "Usage: " << prog << " [test_number]\n"
+              << "List of Available Tests:\n"
+              << "  1  - Heartbeat Segment\n"
+              << "  2  - Supervision on Synthetic Times\n"
+              << "  3  - Forked Reporter\n"
+              << "  4  - Layout\n"
+              << "  5  - Abandoned Claim\n";
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc != 2) {
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    std::string choice = argv[1];
+    if      (choice == "1")  TestSegment();
+    else if (choice == "2")  TestSupervision();
+    else if (choice == "3")  TestForkedReporter();
+    else if (choice == "4")  TestLayout();
+    else if (choice == "5")  TestAbandonedClaim();
+    else {
+        std::cout << "Invalid test number: " << choice << "\n";
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    return 0;
+}
+
+/**********************************************************************************************************************
+ *  TEST DEFINITIONS
+ *********************************************************************************************************************/
+
+/*!
+ * \brief Test #1: HeartbeatSegment: Create, Open (writable / read-only), OpenOrCreate, Unlink and their errors
+ */
+void TestSegment()
+{
+    std::cout << "\n=== Test 1: Heartbeat Segment ===\n";
+    std::string const name = SegmentName("segment");
+    static_cast<void>(HeartbeatSegment::Unlink(name.c_str()));
+
+    /* Nothing to open yet */
+    HeartbeatSegment reader{};
+    [[maybe_unused]] ErrorCode const missing = reader.Open(name.c_str());
+    assert((missing == ErrorCode::SegmentNotFound) && (reader.GetView() == nullptr) && (reader.GetTable() == nullptr));
+
+    /* Create, then the name is taken */
+    HeartbeatSegment creator{};
+    [[maybe_unused]] ErrorCode const created = creator.Create(name.c_str());
+    assert((created == ErrorCode::Success) && (creator.GetTable() != nullptr) && creator.GetView()->IsValid());
+    HeartbeatSegment second{};
+    [[maybe_unused]] ErrorCode const exists = second.Create(name.c_str());
+    assert(exists == ErrorCode::SegmentExists);
+
+    /* Writable and read-only openers map the same table */
+    [[maybe_unused]] ErrorCode const opened = reader.Open(name.c_str(), false);
+    assert((opened == ErrorCode::Success) && (reader.GetTable() == nullptr) && (reader.GetView() != nullptr));
+    HeartbeatSegment writer{};
+    [[maybe_unused]] ErrorCode const openedOrCreated = writer.OpenOrCreate(name.c_str());
+    assert((openedOrCreated == ErrorCode::Success) && (writer.GetTable() != nullptr));
+
+    /* A segment of the right size that was never published is not a heartbeat table */
+    std::string const raw = SegmentName("raw");
+    ara::os::interface::shm::SegmentConfig rawConfig{};
+    rawConfig.name = raw.c_str();
+    rawConfig.size = sizeof(HeartbeatTable);
+    ara::os::interface::shm::SharedMemory rawMemory{};
+    [[maybe_unused]] bool const rawCreated =
+        (rawMemory.Create(rawConfig) == ara::os::interface::shm::ErrorCode::Success);
+    HeartbeatSegment incompatible{};
+    [[maybe_unused]] ErrorCode const unpublished = incompatible.Open(raw.c_str());
+    assert(rawCreated && (unpublished == ErrorCode::IncompatibleSegment) && (incompatible.GetView() == nullptr));
+    rawMemory.Close();
+    static_cast<void>(ara::os::interface::shm::SharedMemory::Unlink(raw.c_str()));
+
+    /* OpenOrCreate on a fresh name creates */
+    std::string const fresh = SegmentName("fresh");
+    HeartbeatSegment lazy{};
+    [[maybe_unused]] ErrorCode const lazyCreated = lazy.OpenOrCreate(fresh.c_str());
+    assert((lazyCreated == ErrorCode::Success) && (lazy.GetView() != nullptr) && lazy.GetView()->IsValid());
+    lazy.Close();
+    static_cast<void>(HeartbeatSegment::Unlink(fresh.c_str()));
+
+    /* Invalid names; unlinking twice */
+    HeartbeatSegment invalid{};
+    [[maybe_unused]] ErrorCode const badName = invalid.Create(nullptr);
+    creator.Close();
+    reader.Close();
+    writer.Close();
+    [[maybe_unused]] ErrorCode const unlinked = HeartbeatSegment::Unlink(name.c_str());
+    [[maybe_unused]] ErrorCode const unlinkedTwice = HeartbeatSegment::Unlink(name.c_str());
+
+    std::cout << "table of " << sizeof(HeartbeatTable) << " bytes, " << HeartbeatTable::kCapacity << " slots\n";
+    assert(badName == ErrorCode::InvalidArgument);
+    assert((unlinked == ErrorCode::Success) && (unlinkedTwice == ErrorCode::SegmentNotFound));
+    std::cout << "[SUCCESS] Segments are created once, opened by name and rejected unless published.\n";
+}
+
+/*!
+ * \brief Test #2: Register, ReportAlive and Check on synthetic times
+ */
+void TestSupervision()
+{
+    std::cout << "\n=== Test 2: Supervision on Synthetic Times ===\n";
+    std::string const name = SegmentName("supervision");
+    static_cast<void>(HeartbeatSegment::Unlink(name.c_str()));
+    HeartbeatSegment segment{};
+    [[maybe_unused]] bool const created = (segment.Create(name.c_str()) == ErrorCode::Success);
+
+    /* Registered at t0: due by t0 + period + tolerance */
+    MonotonicTime const t0{1'000'000'000};
+    SupervisedEntity entity{};
+    [[maybe_unused]] ErrorCode const registered = entity.Register(segment, MakeConfig("cycle", 10ms, 2ms), t0);
+    assert(created && (registered == ErrorCode::Success) && entity.IsRegistered());
+    EntityStatus const fresh = StatusOf(segment, t0, "cycle");
+    EntityStatus const late = StatusOf(segment, t0 + 13ms, "cycle");
+    assert((fresh.status == SupervisionStatus::Ok) && (fresh.period == 10ms) && (fresh.pid == ::getpid()));
+    assert(StatusOf(segment, t0 + 12ms, "cycle").status == SupervisionStatus::Ok);
+    assert((late.status == SupervisionStatus::Expired) && (late.overdue == 1ms));
+
+    /* A report for the release at t0 + 10 ms moves the deadline to t0 + 22 ms */
+    entity.ReportAlive(t0 + 10ms);
+    EntityStatus const reported = StatusOf(segment, t0 + 13ms, "cycle");
+    assert((reported.status == SupervisionStatus::Ok) && (reported.reports == 1U));
+    assert(AliveSupervisor{segment}.CountExpired(t0 + 22ms) == 0U);
+    assert(AliveSupervisor{segment}.CountExpired(t0 + 23ms) == 1U);
+
+    /* Orderly shutdown */
+    entity.Deactivate();
+    assert(!entity.IsRegistered());
+    assert(StatusOf(segment, t0 + 1s, "cycle").status == SupervisionStatus::Deactivated);
+    assert(AliveSupervisor{segment}.CountExpired(t0 + 1s) == 0U);
+
+    std::cout << "fresh " << static_cast<int>(fresh.status) << ", late by " << late.overdue.count() << " ns, "
+              << reported.reports << " report(s), pid " << reported.pid << "\n";
+
+    /* Invalid registrations */
+    SupervisedEntity invalid{};
+    assert(invalid.Register(segment, MakeConfig(nullptr, 10ms, 0ms), t0) == ErrorCode::InvalidArgument);
+    assert(invalid.Register(segment, MakeConfig("", 10ms, 0ms), t0) == ErrorCode::InvalidArgument);
+    assert(invalid.Register(segment, MakeConfig("zero", 0ms, 0ms), t0) == ErrorCode::InvalidArgument);
+    assert(invalid.Register(segment, MakeConfig("negative", 10ms, -1ms), t0) == ErrorCode::InvalidArgument);
+    HeartbeatSegment const closed{};
+    assert(invalid.Register(closed, MakeConfig("closed", 10ms, 0ms), t0) == ErrorCode::IncompatibleSegment);
+    invalid.ReportAlive(t0);  // Not registered: does nothing
+
+    /* A read-only mapping supervises but cannot register */
+    HeartbeatSegment readOnly{};
+    [[maybe_unused]] bool const opened = (readOnly.Open(name.c_str(), false) == ErrorCode::Success);
+    assert(opened && (invalid.Register(readOnly, MakeConfig("reader", 10ms, 0ms), t0) == ErrorCode::ReadOnly));
+    readOnly.Close();
+
+    /* All slots taken by this (running) process: full until one is deactivated */
+    std::array<SupervisedEntity, HeartbeatTable::kCapacity> entities{};
+    std::array<std::string, HeartbeatTable::kCapacity> names{};
+    std::size_t taken{0U};
+    for (std::size_t i = 0U; i < entities.size(); ++i) {
+        names[i] = "task_" + std::to_string(i);
+        if (entities[i].Register(segment, MakeConfig(names[i].c_str(), 1ms, 0ms), t0) == ErrorCode::Success) {
+            ++taken;
+        }
+    }
+    SupervisedEntity overflow{};
+    [[maybe_unused]] ErrorCode const full = overflow.Register(segment, MakeConfig("overflow", 1ms, 0ms), t0);
+    entities[7U].Deactivate();
+    [[maybe_unused]] ErrorCode const reused = overflow.Register(segment, MakeConfig("overflow", 1ms, 0ms), t0);
+    std::array<EntityStatus, 4U> firstFour{};
+    std::size_t const total = AliveSupervisor{segment}.Check(t0 + 2ms, firstFour);
+
+    std::size_t const expired = AliveSupervisor{segment}.CountExpired(t0 + 2ms);
+    std::cout << taken << " slots taken, " << total << " entities, " << expired << " expired at t0 + 2 ms\n";
+    assert((taken == HeartbeatTable::kCapacity) && (full == ErrorCode::CapacityExceeded));
+    assert((reused == ErrorCode::Success) && (total == HeartbeatTable::kCapacity));
+    assert((firstFour[0U].name == "task_0") && (firstFour[0U].status == SupervisionStatus::Expired));
+    assert(expired == HeartbeatTable::kCapacity);
+
+    for (SupervisedEntity& each : entities) {
+        each.Deactivate();
+    }
+    overflow.Deactivate();
+    segment.Close();
+    static_cast<void>(HeartbeatSegment::Unlink(name.c_str()));
+    std::cout << "[SUCCESS] Deadlines are checked with plain loads: Ok, Expired by the overdue time, Deactivated.\n";
+}
+
+/*!
+ * \brief Test #3: Forked reporter detected within period + tolerance + polling after it stalls
+ */
+void TestForkedReporter()
+{
+    std::cout << "\n=== Test 3: Forked Reporter ===\n";
+    constexpr std::chrono::nanoseconds kPeriod{20ms};
+    constexpr std::chrono::nanoseconds kTolerance{30ms};
+    constexpr std::chrono::nanoseconds kPoll{2ms};
+    constexpr std::uint64_t kBeats{10U};
+
+    std::string const name = SegmentName("forked");
+    static_cast<void>(HeartbeatSegment::Unlink(name.c_str()));
+    HeartbeatSegment supervisor{};
+    [[maybe_unused]] bool const created = (supervisor.Create(name.c_str()) == ErrorCode::Success);
+
+    pid_t const pid = ::fork();
+    assert(pid >= 0);
+    if (pid == 0) {
+        // Reporter process: kBeats reports one period apart, then it stalls without deactivating
+        HeartbeatSegment segment{};
+        SupervisedEntity entity{};
+        if ((segment.Open(name.c_str()) != ErrorCode::Success) ||
+            (entity.Register(segment, MakeConfig("reporter", kPeriod, kTolerance), Now()) != ErrorCode::Success)) {
+            ::_exit(1);
+        }
+        for (std::uint64_t beat = 0U; beat < kBeats; ++beat) {
+            entity.ReportAlive();
+            std::this_thread::sleep_for(kPeriod);
+        }
+        while (true) {
+            static_cast<void>(::pause());
+        }
+    }
+
+    // Supervisor: poll until the reporter is registered, track its last report, wait for the expiry
+    MonotonicTime const start = Now();
+    MonotonicTime lastSeen{0};
+    std::uint64_t lastReports{0U};
+    [[maybe_unused]] bool wasOk{false};
+    EntityStatus status{};
+    while ((Now() - start) < 5s) {
+        MonotonicTime const now = Now();
+        status = StatusOf(supervisor, now, "reporter");
+        if (status.pid == pid) {
+            if (status.status == SupervisionStatus::Ok) {
+                wasOk = true;
+            }
+            if (status.reports != lastReports) {
+                lastReports = status.reports;
+                lastSeen = now;
+            }
+            if (status.status == SupervisionStatus::Expired) {
+                break;
+            }
+        }
+        std::this_thread::sleep_for(kPoll);
+    }
+    std::chrono::nanoseconds const detection = Now() - lastSeen;
+
+    // The reporter process died without deactivating: a new instance takes over its slot
+    static_cast<void>(::kill(pid, SIGKILL));
+    static_cast<void>(::waitpid(pid, nullptr, 0));
+    SupervisedEntity restarted{};
+    [[maybe_unused]] ErrorCode const registered =
+        restarted.Register(supervisor, MakeConfig("reporter", kPeriod, kTolerance), Now());
+    [[maybe_unused]] EntityStatus const takenOver = StatusOf(supervisor, Now(), "reporter");
+    std::array<EntityStatus, 2U> all{};
+    [[maybe_unused]] std::size_t const entities = AliveSupervisor{supervisor}.Check(Now(), all);
+
+    std::cout << "reporter expired after " << lastReports << " reports, detected "
+              << std::chrono::duration_cast<std::chrono::microseconds>(detection).count()
+              << " us after its last report (budget " << (kPeriod + kTolerance).count() / 1000 << " us)\n";
+    assert(created && wasOk && (status.status == SupervisionStatus::Expired) && (lastReports == kBeats));
+    // All kBeats reports were seen before the expiry; the observed last report lies at most one poll after the
+    // actual one, plus a generous slack for a loaded test machine
+    assert(detection <= kPeriod + kTolerance + kPoll + 50ms);
+    assert((registered == ErrorCode::Success) && (takenOver.slot == status.slot) && (takenOver.pid == ::getpid()));
+    assert((takenOver.status == SupervisionStatus::Ok) && (entities == 1U));
+
+    restarted.Deactivate();
+    supervisor.Close();
+    static_cast<void>(HeartbeatSegment::Unlink(name.c_str()));
+    std::cout << "[SUCCESS] A stalled process is detected within one period plus tolerance; its slot is reused.\n";
+}
+
+/*!
+ * \brief Test #4: Layout: one cache line per slot, table trivially destructible, reporting noexcept
+ */
+void TestLayout()
+{
+    std::cout << "\n=== Test 4: Layout ===\n";
+    constexpr std::size_t kLine = ara::os::interface::shm::kCacheLineSize;
+    static_assert(sizeof(HeartbeatSlot) == kLine);
+    static_assert(alignof(HeartbeatSlot) == kLine);
+    static_assert(sizeof(HeartbeatTable) == (HeartbeatTable::kCapacity + 1U) * kLine);
+    static_assert(std::is_trivially_destructible_v<HeartbeatTable>);
+    static_assert(std::is_standard_layout_v<HeartbeatTable>);
+    static_assert(noexcept(std::declval<SupervisedEntity&>().ReportAlive(std::declval<MonotonicTime>())));
+    static_assert(HeartbeatSlot::kNameCapacity == 24U);
+
+    std::string const name = SegmentName("layout");
+    static_cast<void>(HeartbeatSegment::Unlink(name.c_str()));
+    HeartbeatSegment segment{};
+    [[maybe_unused]] bool const created = (segment.Create(name.c_str()) == ErrorCode::Success);
+    HeartbeatTable* const table = segment.GetTable();
+
+    /* Neighbouring entities report on distinct cache lines */
+    SupervisedEntity first{};
+    SupervisedEntity second{};
+    SupervisionConfig const longName = MakeConfig("a_name_longer_than_24_characters", 1ms, 0ms);
+    [[maybe_unused]] bool const registered = (first.Register(segment, MakeConfig("first", 1ms, 0ms), Now()) == ErrorCode::Success) &&
+                                              (second.Register(segment, longName, Now()) == ErrorCode::Success);
+    [[maybe_unused]] auto const address = [table](std::size_t slot) {
+        return reinterpret_cast<std::uintptr_t>(&table->GetSlot(slot));
+    };
+    EntityStatus const cut = StatusOf(segment, Now(), "a_name_longer_than_24_ch");
+
+    std::cout << "slot " << sizeof(HeartbeatSlot) << " bytes, table " << sizeof(HeartbeatTable)
+              << " bytes, name cut to '" << cut.name.c_str() << "'\n";
+    assert(created && (table != nullptr) && registered);
+    assert(((address(1U) - address(0U)) == kLine) && ((address(0U) % kLine) == 0U));
+    assert((cut.slot == 1U) && (cut.name.size() == HeartbeatSlot::kNameCapacity));
+
+    first.Deactivate();
+    second.Deactivate();
+    segment.Close();
+    static_cast<void>(HeartbeatSegment::Unlink(name.c_str()));
+    std::cout << "[SUCCESS] Every slot owns a cache line; names are cut to the slot capacity.\n";
+}
+
+/*!
+ * \brief Test #5: Slots left claimed by a dead process are reused, those of a live one are not
+ */
+void TestAbandonedClaim()
+{
+    std::cout << "\n=== Test 5: Abandoned Claim ===\n";
+    std::string const name = SegmentName("abandoned");
+    static_cast<void>(HeartbeatSegment::Unlink(name.c_str()));
+    HeartbeatSegment segment{};
+    [[maybe_unused]] bool const created = (segment.Create(name.c_str()) == ErrorCode::Success);
+    HeartbeatTable* const table = segment.GetTable();
+    assert(created && (table != nullptr));
+
+    /* A process that exited and was reaped: its pid is gone */
+    pid_t const dead = ::fork();
+    assert(dead >= 0);
+    if (dead == 0) {
+        ::_exit(0);
+    }
+    static_cast<void>(::waitpid(dead, nullptr, 0));
+
+    /* Claims abandoned after the owner was published (slot 0) and before (slot 1), one still in progress (slot 2) */
+    std::array<std::int32_t, 3U> const claimants{static_cast<std::int32_t>(dead), 0,
+                                                 static_cast<std::int32_t>(::getppid())};
+    for (std::size_t i = 0U; i < claimants.size(); ++i) {
+        table->GetSlot(i).pid.store(claimants[i], std::memory_order_relaxed);
+        table->GetSlot(i).state.store(SlotState::kClaimed, std::memory_order_release);
+    }
+
+    /* The abandoned claims are reused like free slots; the claim of the live process stays */
+    MonotonicTime const t0{1'000'000'000};
+    std::array<SupervisedEntity, HeartbeatTable::kCapacity> entities{};
+    std::array<std::string, HeartbeatTable::kCapacity> names{};
+    std::size_t taken{0U};
+    for (std::size_t i = 0U; i < entities.size(); ++i) {
+        names[i] = "task_" + std::to_string(i);
+        if (entities[i].Register(segment, MakeConfig(names[i].c_str(), 1ms, 0ms), t0) == ErrorCode::Success) {
+            ++taken;
+        }
+    }
+    EntityStatus const first = StatusOf(segment, t0, names[0U].c_str());
+    EntityStatus const second = StatusOf(segment, t0, names[1U].c_str());
+    std::array<EntityStatus, 1U> some{};
+    std::size_t const total = AliveSupervisor{segment}.Check(t0, some);
+
+    std::cout << taken << " slots taken, abandoned claims reused as slots " << first.slot << " and " << second.slot
+              << ", " << total << " entities reported\n";
+    assert(taken == (HeartbeatTable::kCapacity - 1U));
+    assert((first.slot == 0U) && (second.slot == 1U) && (first.pid == ::getpid()) && (second.pid == ::getpid()));
+    assert(total == (HeartbeatTable::kCapacity - 1U));
+    assert((table->GetSlot(2U).state.load(std::memory_order_acquire) == SlotState::kClaimed) &&
+           (table->GetSlot(2U).pid.load(std::memory_order_relaxed) == claimants[2U]));
+
+    for (SupervisedEntity& each : entities) {
+        each.Deactivate();
+    }
+    segment.Close();
+    static_cast<void>(HeartbeatSegment::Unlink(name.c_str()));
+    std::cout << "[SUCCESS] A claim abandoned by a dead process is reclaimed; a live claimant keeps its slot.\n";
+}